@@ -0,0 +1,64 @@
+#include "core/cpu_convolution.h"
+
+#include <gflags/gflags.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+DEFINE_int32(repeat, 5, "Calls per shape and algorithm, the fastest one is reported");
+
+struct Case {
+	std::string name;
+	CpuConvolution::Shape shape;
+	bool gaussian;
+};
+
+void main(int argc, char** argv) {
+
+	gflags::ParseCommandLineFlags(&argc, &argv, true);
+
+	// The shapes of the cpu_convolution cost model test.
+	std::vector<Case> cases = {
+		{ "blur 3x128x128 k9", { 1, 3, 128, 128, 3, 9, 9, 128, 128, 4, 4, 1, 1, 1, 1 }, true },
+		{ "blur 3x256x256 k25", { 1, 3, 256, 256, 3, 25, 25, 256, 256, 12, 12, 1, 1, 1, 1 }, true },
+		{ "gabor 16x1x256x256 k25", { 1, 1, 256, 256, 16, 25, 25, 256, 256, 12, 12, 1, 1, 1, 1 }, false },
+		{ "dense 32x32x32 k3", { 8, 32, 32, 32, 32, 3, 3, 32, 32, 1, 1, 1, 1, 1, 1 }, false }
+	};
+	const char *names[] = { "auto", "gemm", "separable", "fft" };
+	std::cout << std::setw(24) << "shape" << std::setw(10) << "algorithm" << std::setw(12) << "ms" << std::endl;
+	for (auto &test : cases) {
+		auto &shape = test.shape;
+		std::vector<float> x((size_t)shape.n * shape.c * shape.h * shape.w), w((size_t)shape.k * shape.c * shape.r * shape.s);
+		std::vector<float> y((size_t)shape.n * shape.k * shape.p * shape.q);
+		for (size_t i = 0; i < x.size(); ++i)
+			x[i] = sin(0.37f * i);
+		// Diagonal Gaussian taps as ConvGaussianKernel makes them, or rotated Gabor-like taps.
+		for (int k = 0; k < shape.k; ++k)
+			for (int c = 0; c < shape.c; ++c)
+				for (int r = 0; r < shape.r; ++r)
+					for (int s = 0; s < shape.s; ++s) {
+						float dy = r - shape.r / 2.0f, dx = s - shape.s / 2.0f, theta = 3.141592f * k / shape.k;
+						float value = test.gaussian ? (k == c ? exp(-0.5f * (dx * dx + dy * dy) / 16.0f) / (2.0f * 3.141592f * 16.0f) : 0.0f) : exp(-0.5f * (dx * dx + dy * dy) / 36.0f) * cos(0.4f * (dx * cos(theta) + dy * sin(theta)) + c);
+						w[(((size_t)k * shape.c + c) * shape.r + r) * shape.s + s] = value;
+					}
+		auto chosen = CpuConvolution::choose_forward(shape, w.data());
+		std::vector<CpuConvolution::Algorithm> algorithms = { CpuConvolution::ALGO_GEMM };
+		if (chosen != CpuConvolution::ALGO_GEMM)
+			algorithms.push_back(chosen);
+		for (auto algorithm : algorithms) {
+			double best = 0;
+			for (int r = 0; r < FLAGS_repeat; ++r) {
+				auto start = std::chrono::steady_clock::now();
+				CpuConvolution::forward(shape, x.data(), w.data(), y.data(), algorithm);
+				double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+				best = r == 0 ? ms : std::min(best, ms);
+			}
+			std::cout << std::setw(24) << test.name << std::setw(10) << names[algorithm] << std::setw(12) << best << std::endl;
+		}
+	}
+}
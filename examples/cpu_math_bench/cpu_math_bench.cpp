@@ -0,0 +1,59 @@
+#include "core/cpu_math.h"
+
+#include <gflags/gflags.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+DEFINE_int32(n, 1 << 22, "Values per call");
+DEFINE_int32(repeat, 10, "Calls per function and tier, the fastest one is reported");
+
+struct Function {
+	std::string name;
+	double low, high;
+	void(*vector)(ExecutionContext::MathAccuracy, size_t, const float *, float *);
+	std::function<float(float)> scalar;
+};
+
+void main(int argc, char** argv) {
+
+	gflags::ParseCommandLineFlags(&argc, &argv, true);
+
+	std::vector<Function> functions = {
+		{ "exp", -87.3, 88.7, CpuMath::exp, [](float x) { return expf(x); } },
+		{ "log", 1e-30, 1e30, CpuMath::log, [](float x) { return logf(x); } },
+		{ "tanh", -10, 10, CpuMath::tanh, [](float x) { return tanhf(x); } },
+		{ "sigmoid", -30, 30, CpuMath::sigmoid, [](float x) { return 1 / (1 + expf(-x)); } }
+	};
+	const size_t n = FLAGS_n;
+	std::vector<float> x(n), y(n);
+	std::cout << "function tier       ns/value" << std::endl;
+	for (auto &f : functions) {
+		// log is swept in log space, the others linearly, the same inputs the accuracy test uses.
+		for (size_t i = 0; i < n; ++i) {
+			double t = (i + 0.5) / n;
+			x[i] = f.name == "log" ? (float)::exp(::log(f.low) + t * (::log(f.high) - ::log(f.low))) : (float)(f.low + t * (f.high - f.low));
+		}
+		// Tier -1 is the libm loop the vector kernels replace.
+		for (int tier = -1; tier <= ExecutionContext::MATH_FAST; ++tier) {
+			double best = 0;
+			for (int r = 0; r < FLAGS_repeat; ++r) {
+				auto start = std::chrono::steady_clock::now();
+				if (tier < 0)
+					std::transform(x.begin(), x.end(), y.begin(), f.scalar);
+				else
+					f.vector((ExecutionContext::MathAccuracy)tier, n, x.data(), y.data());
+				double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+				best = r == 0 ? seconds : std::min(best, seconds);
+			}
+			std::cout << std::left << std::setw(9) << f.name << std::setw(9) << (tier < 0 ? "libm" : tier == ExecutionContext::MATH_FAST ? "fast" : "accurate")
+				<< std::right << std::setw(10) << std::setprecision(3) << best * 1e9 / n << std::endl;
+		}
+	}
+}
@@ -1,6 +1,7 @@
 
 #include "core/deep_flow.h"
 #include "core/session.h"
+#include "nodes/resize.h"
 
 #include <random>
 #include <gflags/gflags.h>
@@ -76,27 +77,27 @@ std::shared_ptr<Session> create() {
 	auto g16 = deconv(&df, g8elu, g_solver, fn, fn, 3, 1, "g16"); // 16x16
 	auto g16elu = df.leaky_relu(g16, LeakyReluOp("g16elu"));
 	auto g16trgb = to_rgb(&df, g16, g_solver, fn, "g16trgb");
-	auto g16add = df.add(df.resize(g8trgb, 2, 2), g16trgb, AddOp("g16add"));
+	auto g16add = df.resize_add(g8trgb, g16trgb, 2, 2, ResizeOp("g16add"));
 	auto im16 = df.switcher(g16trgb, SwitchOp("im16"));
 	df.imwrite(im16, "i16-{it}", ImwriteOp("imw16"));
 
 	auto g32 = deconv(&df, g16elu, g_solver, fn, fn, 3, 1, "g32"); // 32x32
 	auto g32elu = df.leaky_relu(g32, LeakyReluOp("g32elu"));
 	auto g32trgb = to_rgb(&df, g32, g_solver, fn, "g32trgb");
-	auto g32add = df.add(df.resize(g16add, 2, 2), g32trgb, AddOp("g32add"));
+	auto g32add = df.resize_add(g16add, g32trgb, 2, 2, ResizeOp("g32add"));
 	auto im32 = df.switcher(g32trgb, SwitchOp("im32"));
 	df.imwrite(im32, "i32-{it}", ImwriteOp("imw32"));
 
 	auto g64 = deconv(&df, g32elu, g_solver, fn, fn, 3, 1, "g64"); // 64x64
 	auto g64elu = df.leaky_relu(g64, LeakyReluOp("g64elu"));
 	auto g64trgb = to_rgb(&df, g64, g_solver, fn, "g64trgb");
-	auto g64add = df.add(df.resize(g32add, 2, 2), g64trgb, AddOp("g64add"));
+	auto g64add = df.resize_add(g32add, g64trgb, 2, 2, ResizeOp("g64add"));
 	auto im64 = df.switcher(g64trgb, SwitchOp("im64"));
 	df.imwrite(im64, "i64-{it}", ImwriteOp("imw64"));
 
 	auto g128 = deconv(&df, g64elu, g_solver, fn, fn, 3, 1, "g128"); // 64x64 -> 128x128
 	auto g128trgb = to_rgb(&df, g128, g_solver, fn, "g128trgb");
-	auto g128add = df.add(df.resize(g64add, 2, 2), g128trgb, AddOp("g128add"));
+	auto g128add = df.resize_add(g64add, g128trgb, 2, 2, ResizeOp("g128add"));
 	auto im128 = df.switcher(g128trgb, SwitchOp("im128"));
 	df.imwrite(im128, "i128-{it}", ImwriteOp("imw128"));
 
@@ -158,11 +159,11 @@ void main(int argc, char** argv) {
 		0,  0,  0,  0  // stage 4
 	};
 
-	std::shared_ptr<Add> add_nodes[4] = {
-		std::dynamic_pointer_cast<Add>(session->get_node("g16add")),
-		std::dynamic_pointer_cast<Add>(session->get_node("g32add")),
-		std::dynamic_pointer_cast<Add>(session->get_node("g64add")),
-		std::dynamic_pointer_cast<Add>(session->get_node("g128add"))
+	std::shared_ptr<Resize> add_nodes[4] = {
+		std::dynamic_pointer_cast<Resize>(session->get_node("g16add")),
+		std::dynamic_pointer_cast<Resize>(session->get_node("g32add")),
+		std::dynamic_pointer_cast<Resize>(session->get_node("g64add")),
+		std::dynamic_pointer_cast<Resize>(session->get_node("g128add"))
 	};
 
 	std::shared_ptr<Multiplexer> main_multiplex[4] = {
@@ -156,6 +156,7 @@ void main(int argc, char** argv) {
 			execution_context->current_iteration = iter;
 			std::cout << "Iteration: [" << iter << "/" << FLAGS_iter << "]";
 
+			session->begin_step();
 			session->forward({ mnist_data });
 			session->forward({ discriminator_output }, { { discriminator_input, mnist_data->output(0)->value() } });
 			session->forward({ loss }, {
@@ -204,6 +205,7 @@ void main(int argc, char** argv) {
 			if (FLAGS_save_model != 0 && iter % FLAGS_save_model == 0) {
 				session->save("mnist_dcgan" + std::to_string(iter) + ".bin");
 			}
+			session->end_step();
 		}
 	}
 
@@ -27,12 +27,6 @@ void create_graph(DeepFlow *df) {
 	df->mnist_reader(FLAGS_mnist, MNISTReaderOp("mnist_train_labels").batch(FLAGS_batch).train().labels());
 	df->mnist_reader(FLAGS_mnist, MNISTReaderOp("mnist_test_labels").batch(FLAGS_batch).test().labels());
 
-	auto loss_softmax_input = df->place_holder({ FLAGS_batch, 10, 1, 1 }, PlaceholderOp("loss_softmax_input"));
-	auto loss_target_labels = df->place_holder({ FLAGS_batch, 10, 1, 1 }, PlaceholderOp("loss_target_labels"));
-	auto loss_softmax_log = df->log(loss_softmax_input, LogOp("loss_softmax_log").negate());
-	auto loss_softmax_dot = df->dot(loss_softmax_log, loss_target_labels);
-	auto loss = df->loss(loss_softmax_dot, LossOp("loss"));
-
 	auto pred_softmax_input = df->place_holder({ FLAGS_batch, 10, 1, 1 }, PlaceholderOp("pred_softmax_input"));
 	auto pred_target_labels = df->place_holder({ FLAGS_batch, 10, 1, 1 }, PlaceholderOp("pred_target_labels"));
 	auto max_actual = df->argmax(pred_softmax_input, 1, ArgmaxOp("pred_actual"));
@@ -44,6 +38,7 @@ void create_graph(DeepFlow *df) {
 	int fn = 64; 
 
 	auto net = df->place_holder({ FLAGS_batch, 1, 28, 28 }, PlaceholderOp("input"));
+	auto labels = df->place_holder({ FLAGS_batch, 10, 1, 1 }, PlaceholderOp("labels"));
 	net = df->conv2d(net, 1, fn, solver, ConvolutionOp("conv1").kernel(3).pad(1).stride(2).with_bias()); // 14x14	
 	net = df->leaky_relu(net);	
 	net = df->conv2d(net, fn, fn * 2, solver, ConvolutionOp("conv2").kernel(3).pad(1).stride(2).with_bias()); // 7x7	
@@ -53,7 +48,7 @@ void create_graph(DeepFlow *df) {
 	net = df->dense(net, { (fn * 4) * 4 * 4, 512, 1, 1 }, solver, DenseOp("fc1"));
 	//net = df->dropout(net);
 	net = df->dense(net, { 512, 10, 1, 1 }, solver, DenseOp("fc2"));
-	net = df->softmax(net, SoftmaxOp("output").by_instance());
+	df->softmax_cross_entropy(net, labels, SoftmaxCrossEntropyOp("output").by_instance());
 
 }
 
@@ -79,10 +74,8 @@ void main(int argc, char** argv) {
 	auto mnist_test_data = session->get_node("mnist_test_data");
 	auto mnist_train_labels = session->get_node("mnist_train_labels");
 	auto mnist_test_labels = session->get_node("mnist_test_labels");
-	auto loss_softmax_input = session->get_placeholder("loss_softmax_input");
-	auto loss_target_labels = session->get_placeholder("loss_target_labels");
-	auto loss = session->get_node("loss");	
 	auto input = session->get_placeholder("input");
+	auto labels = session->get_placeholder("labels");
 	auto output = session->get_node("output");
 	auto correct_count = session->get_node("correct_count");
 	auto pred_softmax_input = session->get_placeholder("pred_softmax_input");
@@ -98,8 +91,8 @@ void main(int argc, char** argv) {
 			acc->reset();
 			do {				execution_context->execution_mode = ExecutionContext::TEST;
 				session->forward({ mnist_test_data, mnist_test_labels });
-				session->forward({ output }, { { input , mnist_test_data->output(0)->value() } });
-				session->forward({ correct_count }, { { pred_softmax_input, output->output(0)->value() },{ pred_target_labels, mnist_test_labels->output(0)->value() } });
+				session->forward({ output }, { { input , mnist_test_data->output(0)->value() }, { labels, mnist_test_labels->output(0)->value() } });
+				session->forward({ correct_count }, { { pred_softmax_input, output->output(1)->value() },{ pred_target_labels, mnist_test_labels->output(0)->value() } });
 			} while (!mnist_test_data->is_last_batch());
 			{
 				auto num_correct = correct_count->output(0)->value()->to_float();
@@ -111,11 +104,9 @@ void main(int argc, char** argv) {
 				execution_context->execution_mode = ExecutionContext::TRAIN;
 				execution_context->current_iteration = epoch;
 				session->forward({ mnist_train_data, mnist_train_labels });					
-				session->forward({ output }, { { input , mnist_train_data->output(0)->value() } });
-				session->forward({ loss }, { { loss_softmax_input, output->output(0)->value() } , { loss_target_labels, mnist_train_labels->output(0)->value() } });
-				session->forward({ correct_count }, { { pred_softmax_input, output->output(0)->value() },{ pred_target_labels, mnist_train_labels->output(0)->value() } });
-				session->backward({ loss });
-				session->backward({ output }, { { output, loss_softmax_input->output(0)->diff() } });
+				session->forward({ output }, { { input , mnist_train_data->output(0)->value() }, { labels, mnist_train_labels->output(0)->value() } });
+				session->forward({ correct_count }, { { pred_softmax_input, output->output(1)->value() },{ pred_target_labels, mnist_train_labels->output(0)->value() } });
+				session->backward({ output });
 				session->apply_solvers("");
 			} while (!mnist_train_data->is_last_batch());
 			{
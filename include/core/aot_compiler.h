@@ -0,0 +1,83 @@
+#pragma once
+
+#include "core/export.h"
+
+#include "proto/deepflow.pb.h"
+
+#include <memory>
+#include <list>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+#include <array>
+
+class Session;
+class Node;
+
+// Compiles the forward (TEST) path of an initialized session into a standalone C++ translation unit.
+// Shapes become template arguments, activations live in a statically planned arena, chains of
+// elementwise nodes are fused into single loops and weights are embedded as constant arrays.
+class DeepFlowDllExport AotCompiler {
+public:
+	AotCompiler(Session *session, bool verbose = false);
+	std::string compile(std::list<std::string> fetches, const std::string &name);
+private:
+	struct Buffer {
+		enum Kind {
+			INPUT,
+			CONSTANT,
+			ARENA
+		};
+		Kind kind;
+		std::string symbol;
+		int size = 0;
+		int first_step = 0;
+		int last_step = 0;
+		int pending_reads = 0;
+		int offset = 0;
+		bool fetched = false;
+	};
+	struct Group {
+		bool open = false;
+		int output = -1;
+		std::array<int, 4> dims;
+		std::string head;
+		std::list<std::string> statements;
+		std::list<int> reads;
+		bool uses_channel = false;
+		bool uses_feature = false;
+	};
+	void _collect(std::shared_ptr<Node> node, std::set<Node*> &visited, std::list<std::shared_ptr<Node>> &order);
+	void _compile_node(std::shared_ptr<Node> node);
+	int _input(std::shared_ptr<Node> node, int index);
+	void _read(int buffer);
+	bool _can_overwrite(int buffer) const;
+	int _new_buffer(Buffer::Kind kind, int size, const std::string &symbol);
+	void _set_output(std::shared_ptr<Node> node, int index, int buffer);
+	int _constant(const std::string &name, const std::vector<float> &values);
+	std::string _ptr(int buffer) const;
+	void _pointwise(std::shared_ptr<Node> node, int num_inputs, const std::string &head, const std::string &statement, std::initializer_list<int> param_buffers = {});
+	void _flush();
+	// Opens the loop of a GraphFusion epilogue over buffer y, the output of node.
+	void _epilogue(std::shared_ptr<Node> node, int y, const deepflow::EpilogueParam &epilogue);
+	static std::string _stage(const deepflow::PointwiseStage &stage);
+	void _plan_arena();
+	std::string _symbol(const std::string &name) const;
+	static std::string _float(float value);
+	static std::string _kernel_source(const std::string &kernel);
+private:
+	Session *_session;
+	bool _verbose;
+	int _step = 0;
+	std::vector<Buffer> _buffers;
+	std::map<std::string, int> _output_buffers;
+	std::map<int, std::vector<float>> _constant_values;
+	std::set<Node*> _compiled;
+	std::set<std::string> _fetched_outputs;
+	std::set<std::string> _kernels;
+	std::set<std::string> _symbols;
+	std::string _body;
+	Group _group;
+	int _arena_size = 0;
+};
@@ -6,26 +6,55 @@
 
 #include <memory>
 #include <list>
+#include <map>
 
 class DeepFlowDllExport Caffe {
 	friend class DeepFlow;
-private:	
+private:
 	void _parse_net_deprecated(std::shared_ptr<caffe::NetParameter> net, std::initializer_list<std::pair<std::string, std::array<int, 4>>> inputs);
-	void _parse_layer_deprecated(const caffe::V1LayerParameter &layer);	
+	void _parse_layer_deprecated(const caffe::V1LayerParameter &layer);
 	std::string _parse_pooling_param(const caffe::PoolingParameter &param, const caffe::V1LayerParameter &layer);
 	std::string _parse_dropout_param(const caffe::DropoutParameter &param, const caffe::V1LayerParameter &layer);
 	std::string _parse_inner_product_param(const caffe::InnerProductParameter &param, const caffe::V1LayerParameter &layer);
 	std::string _parse_filler_param(std::initializer_list<int> dims, const caffe::FillerParameter &param, std::string name);
 	std::string _parse_relu_param(const caffe::ReLUParameter &param, const caffe::V1LayerParameter &layer);
 	std::string _parse_conv_param(const caffe::ConvolutionParameter &param, const caffe::V1LayerParameter &layer);
-	std::string _parse_softmax_param(const caffe::SoftmaxParameter &param, const caffe::V1LayerParameter &layer);	
+	std::string _parse_softmax_param(const caffe::SoftmaxParameter &param, const caffe::V1LayerParameter &layer);
 	void _parse_blob_param(const caffe::BlobProto &param);
 	void _fix_inplace_nodes();
+private:
+	void _parse_net(std::shared_ptr<caffe::NetParameter> net, std::initializer_list<std::pair<std::string, std::array<int, 4>>> inputs);
+	void _parse_input(const std::string &name, std::array<int, 4> dims);
+	bool _skip_layer(const caffe::LayerParameter &layer);
+	void _parse_conv_layer(caffe::LayerParameter *layer, bool transposed);
+	void _parse_batch_norm_layer(caffe::LayerParameter *layer, caffe::LayerParameter *scale_layer);
+	void _parse_scale_layer(caffe::LayerParameter *layer);
+	void _parse_relu_layer(const caffe::LayerParameter &layer);
+	void _parse_prelu_layer(caffe::LayerParameter *layer);
+	void _parse_pooling_layer(const caffe::LayerParameter &layer);
+	void _parse_inner_product_layer(caffe::LayerParameter *layer);
+	void _parse_softmax_layer(const caffe::LayerParameter &layer);
+	void _parse_concat_layer(const caffe::LayerParameter &layer);
+	void _parse_eltwise_layer(const caffe::LayerParameter &layer);
+	void _parse_dropout_layer(const caffe::LayerParameter &layer);
+	void _parse_flatten_layer(const caffe::LayerParameter &layer);
+	std::string _bottom(const caffe::LayerParameter &layer, int index) const;
+	std::array<int, 4> _bottom_dims(const caffe::LayerParameter &layer, int index) const;
+	void _set_top(const caffe::LayerParameter &layer, int index, const std::string &df_output, std::array<int, 4> dims);
+	std::string _blob_variable(caffe::BlobProto *blob, std::array<int, 4> dims, std::string name, int transpose_rows = 0);
+	std::string _constant_variable(std::array<int, 4> dims, float value, std::string name);
+	static int _blob_count(const caffe::BlobProto &blob);
+	static void _move_blob(caffe::BlobProto *blob, deepflow::TensorData *weights);
+	static void _copy_blob(const caffe::BlobProto &blob, deepflow::TensorData *weights, int transpose_rows = 0);
+	bool _load_cache(const std::string &file_path, const std::string &cache_file_path, std::initializer_list<std::pair<std::string, std::array<int, 4>>> inputs);
+	void _save_cache(const std::string &cache_file_path, int first_node, int first_initializer);
 private:
 	DeepFlow *df;
 	bool _verbose;
 	std::list<std::string> _inplace_nodes;
+	std::map<std::string, std::string> _blob_outputs;
+	std::map<std::string, std::array<int, 4>> _blob_dims;
 public:
 	Caffe(DeepFlow *df, bool verbose);
-	void load(std::string file_path, std::initializer_list<std::pair<std::string,std::array<int,4>>> inputs);
-};
\ No newline at end of file
+	void load(std::string file_path, std::initializer_list<std::pair<std::string,std::array<int,4>>> inputs, std::string cache_file_path = "");
+};
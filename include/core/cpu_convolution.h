@@ -0,0 +1,55 @@
+#pragma once
+
+#include "core/export.h"
+
+// Host 2D cross-correlation with cuDNN's three primitives over NCHW tensors:
+// x [n, c, h, w], w [k, c, r, s] and y [n, k, p, q], with y[p, q] reading x[u * p - pad_h + dilation_h * r,
+// v * q - pad_w + dilation_w * s]. Every product is a GEMM against gathered columns.
+//
+// Without dilation the filter taps are split by stride phase: taps r = ph + u * j all land on x rows
+// u * i + ph - pad_h, so each of the u * v phases is a dense stride 1 problem. backward_data (the
+// transposed convolution) then computes every x position once, as a GEMM of its phase, instead of
+// scattering into an upsampled grid whose inserted zeros would be multiplied; forward and
+// backward_filter gather one phase at a time, which cuts their column buffers by u * v. With
+// dilation they fall back to im2col, and backward_data to GEMM + col2im.
+//
+// Fixed filters such as blurs and filter banks have cheaper forms, chosen per call by a cost model
+// over the filter's (k, c) slices: when every nonzero slice is rank-1 (Gaussian kernels) each is
+// applied as a row pass and a column pass, O(r + s) per output instead of O(r * s), and zero slices
+// are skipped; large dense filters at stride 1 (Gabor banks) go through the FFT. backward_data at
+// stride 1 is a forward pass with the flipped filter and takes the same paths.
+//
+// The blocked variants take x, dx, y and dy in a channel block layout (see CpuLayout) and keep w in
+// [k, c, r, s]. Their GEMM rows are output positions: each filter tap gathers a contiguous run of
+// block channels, and the [(n, p, q)][k] product is y itself when y is NHWC.
+class DeepFlowDllExport CpuConvolution {
+public:
+	struct Shape {
+		int n, c, h, w;
+		int k, r, s;
+		int p, q;
+		int pad_h, pad_w;
+		int u, v;
+		int dilation_h, dilation_w;
+	};
+	enum Algorithm {
+		ALGO_AUTO = 0,
+		ALGO_GEMM = 1,
+		ALGO_SEPARABLE = 2,
+		ALGO_FFT = 3
+	};
+	// Output size of one axis, cudnnGetConvolution2dForwardOutputDim.
+	static int output_size(int input, int filter, int pad, int stride, int dilation);
+	// The algorithm forward picks for this filter.
+	static Algorithm choose_forward(const Shape &shape, const float *w);
+	// y = conv(x, w), an explicit algorithm must apply to the filter and shape.
+	static void forward(const Shape &shape, const float *x, const float *w, float *y, Algorithm algorithm = ALGO_AUTO);
+	// dx = conv^T(dy, w), also the forward pass of a transposed convolution.
+	static void backward_data(const Shape &shape, const float *w, const float *dy, float *dx);
+	// dw = sum over samples of dy (x) x
+	static void backward_filter(const Shape &shape, const float *x, const float *dy, float *dw);
+	// The three primitives with x and dx in channel block x_block, y and dy in y_block.
+	static void forward_blocked(const Shape &shape, int x_block, int y_block, const float *x, const float *w, float *y);
+	static void backward_data_blocked(const Shape &shape, int x_block, int y_block, const float *w, const float *dy, float *dx);
+	static void backward_filter_blocked(const Shape &shape, int x_block, int y_block, const float *x, const float *dy, float *dw);
+};
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "core/export.h"
+#include "core/execution_context.h"
+
+#include "cudnn.h"
+
+#include <cstddef>
+#include <cstdint>
+
+// Host elementwise kernels of the activation and math nodes. Every op is a functor instantiated over
+// one loop driver: AVX-512 or AVX2 vectors (whichever the build targets) with a scalar tail, split
+// across the pool above a size threshold. Per-channel operands of [outer, channels, inner] tensors are
+// broadcast once per (outer, channel) plane, so the inner loops carry no index arithmetic.
+class DeepFlowDllExport CpuElementwise {
+public:
+	// y = alpha * a + beta * b, b may be null when beta is zero.
+	static void add(size_t n, float alpha, const float *a, float beta, const float *b, float *y);
+	// y = alpha * x + beta * y, y is not read when beta is zero.
+	static void axpby(size_t n, float alpha, const float *x, float beta, float *y);
+	// y = alpha * a * b + beta * y, y is not read when beta is zero.
+	static void dot(size_t n, float alpha, const float *a, const float *b, float beta, float *y);
+
+	// cuDNN activation modes, coef is the clipping threshold or the elu alpha. Sigmoid, tanh and elu
+	// evaluate their transcendental at the given accuracy, the backward passes only read x and y.
+	static void activation_forward(ExecutionContext::MathAccuracy accuracy, cudnnActivationMode_t mode, float coef, size_t n, const float *x, float *y);
+	static void activation_backward(cudnnActivationMode_t mode, float coef, size_t n, const float *x, const float *y, const float *dy, float *dx);
+	// y_dx = x > 0 ? x_dy : slope * x_dy, forward passes x as x_dy.
+	static void leaky_relu(size_t n, float slope, const float *x, const float *x_dy, float *y_dx);
+
+	static void exp_forward(ExecutionContext::MathAccuracy accuracy, size_t n, const float *x, float *y);
+	static void exp_backward(ExecutionContext::MathAccuracy accuracy, size_t n, const float *x, const float *dy, float *dx);
+	static void log_forward(ExecutionContext::MathAccuracy accuracy, size_t n, float coef, const float *x, float *y);
+	static void log_backward(size_t n, float coef, const float *x, const float *dy, float *dx);
+	static void abs_forward(size_t n, const float *x, float *y);
+	static void abs_backward(size_t n, const float *x, const float *dy, float *dx);
+	static void square_forward(size_t n, const float *x, float *y);
+	static void square_backward(size_t n, const float *x, const float *dy, float *dx);
+
+	// y = max(a, b), dx = a >= b ? dy : 0 (b is the other input).
+	static void max_forward(size_t n, const float *a, const float *b, float *y);
+	static void max_backward(size_t n, const float *a, const float *b, const float *dy, float *dx);
+	// y = -min(a, b), dx = a <= b ? -dy : 0 (b is the other input).
+	static void nand_forward(size_t n, const float *a, const float *b, float *y);
+	static void nand_backward(size_t n, const float *a, const float *b, const float *dy, float *dx);
+	static void equal(size_t n, const float *a, const float *b, float *y);
+
+	// Inverted dropout: element i is kept with probability 1 - dropout and scaled by 1 / (1 - dropout).
+	// Its keep bit is bit i % 32 of mask[i / 32], drawn from word i of Philox stream step under seed,
+	// so the mask does not depend on how the loop is split across threads.
+	static void dropout_forward(size_t n, float dropout, uint64_t seed, uint64_t step, const float *x, float *y, uint32_t *mask);
+	static void dropout_backward(size_t n, float dropout, const uint32_t *mask, const float *dy, float *dx);
+
+	// Per-channel ops over [outer, channels, inner] tensors. The bias ops also take channel blocked
+	// [outer, channels / block, inner, block] tensors (see CpuLayout).
+	static void bias_add_forward(int outer, int channels, int inner, const float *x, const float *bias, float *y, int block = 1);
+	// dbias[c] = sum of dy over outer and inner.
+	static void bias_add_backward(int outer, int channels, int inner, const float *dy, float *dbias, int block = 1);
+	static void prelu_forward(int outer, int channels, int inner, const float *x, const float *w, float *y);
+	static void prelu_backward(int outer, int channels, int inner, const float *x, const float *w, const float *dy, float *dx);
+	// dw[c] = channels / size * sum of dy * x over the negative x of channel c.
+	static void prelu_backward_weight(int outer, int channels, int inner, const float *x, const float *dy, float *dw);
+	// The gate of plane (o, c) is a[o * a_channels + c] > 0.
+	static void dprelu_forward(int outer, int channels, int inner, int a_channels, const float *x, const float *a, float *y);
+	static void dprelu_backward(int outer, int channels, int inner, int a_channels, const float *x, const float *a, const float *dy, float *dx);
+
+	// Stages of fused nodes, numbered as deepflow::PointwiseStage::Op. coef is the clipping threshold,
+	// the elu alpha, the leaky slope or the log scale.
+	enum PointwiseOp {
+		POINTWISE_IDENTITY = 0,
+		POINTWISE_SIGMOID = 1,
+		POINTWISE_RELU = 2,
+		POINTWISE_TANH = 3,
+		POINTWISE_CLIPPED_RELU = 4,
+		POINTWISE_ELU = 5,
+		POINTWISE_LEAKY_RELU = 6,
+		POINTWISE_EXP = 7,
+		POINTWISE_LOG = 8,
+		POINTWISE_ABS = 9,
+		POINTWISE_SQUARE = 10
+	};
+	struct PointwiseStage {
+		PointwiseOp op;
+		float coef;
+	};
+	// y = stages[count - 1](... stages[0](x)), a tile at a time so no intermediate leaves the cache.
+	static void chain_forward(ExecutionContext::MathAccuracy accuracy, int count, const PointwiseStage *stages, size_t n, const float *x, float *y);
+	// dx of the chain, the intermediates of each tile are recomputed from x.
+	static void chain_backward(ExecutionContext::MathAccuracy accuracy, int count, const PointwiseStage *stages, size_t n, const float *x, const float *dy, float *dx);
+	// Conv and matmul epilogue over [outer, channels, inner] in place: y = op(y + bias[c]), bias may be
+	// null. op is identity or an activation whose derivative follows from y (not exp, log, abs, square).
+	// y may be channel blocked like the bias ops.
+	static void epilogue_forward(ExecutionContext::MathAccuracy accuracy, PointwiseOp op, float coef, int outer, int channels, int inner, const float *bias, float *y, int block = 1);
+	// dy = op'(y) * dy in place.
+	static void epilogue_backward(PointwiseOp op, float coef, size_t n, const float *y, float *dy);
+};
@@ -0,0 +1,14 @@
+#pragma once
+
+#include "core/export.h"
+
+// Host complex FFT over power-of-two sizes, real and imaginary parts in separate arrays so the
+// butterflies vectorize: the 2D transform runs the columns with whole rows as butterfly operands,
+// then the rows the same way over a transposed copy. The inverse is unnormalized: a forward then inverse pass scales by rows * columns.
+class DeepFlowDllExport CpuFft {
+public:
+	static bool is_power_of_two(int n);
+	static int next_power_of_two(int n);
+	// In place on [rows, columns] arrays, both sizes powers of two.
+	static void transform_2d(int rows, int columns, float *re, float *im, bool inverse);
+};
@@ -0,0 +1,12 @@
+#pragma once
+
+#include "core/export.h"
+
+// Host single precision matrix product on row-major matrices, the CPU counterpart of the cuBLAS
+// sgemm calls: C = alpha * op(A) * op(B) + beta * C with op(A) M x K and op(B) K x N. Panels of A
+// and B are packed per cache block and fed to a register-tiled vector micro kernel, blocks of C are
+// split across the pool. C is not read when beta is zero.
+class DeepFlowDllExport CpuGemm {
+public:
+	static void sgemm(bool trans_a, bool trans_b, int M, int N, int K, float alpha, const float *A, int lda, const float *B, int ldb, float beta, float *C, int ldc);
+};
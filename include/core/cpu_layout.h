@@ -0,0 +1,21 @@
+#pragma once
+
+#include "core/export.h"
+
+#include <array>
+#include <cstddef>
+
+// Host tensor layouts as channel blocks: element (n, c, h, w) of an [n, c, h, w] tensor with channel
+// block b lives at (((n * c / b + c / b) * h + h) * w + w) * b + c % b. Block 1 is NCHW, block c is
+// NHWC and kBlock is NCHW16C, which needs c to be a multiple of kBlock.
+class DeepFlowDllExport CpuLayout {
+public:
+	static const int kBlock = 16;
+	// Strides of the (n, c / split, h, w, c % split) view. split must be block unless the tensor is NCHW
+	// or NHWC, which are strided in c for any split.
+	static std::array<ptrdiff_t, 5> strides(std::array<int, 4> dims, int block, int split);
+	// The split both blocks can be viewed with.
+	static int split(int channels, int block_a, int block_b);
+	// dst = src with its channel block changed, dst and src do not overlap.
+	static void reorder(std::array<int, 4> dims, int src_block, const float *src, int dst_block, float *dst, float beta = 0.0f);
+};
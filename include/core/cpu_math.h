@@ -0,0 +1,17 @@
+#pragma once
+
+#include "core/export.h"
+#include "core/execution_context.h"
+
+#include <cstddef>
+
+// Host transcendentals over arrays, y[i] = f(x[i]), on the calling thread. The kernels are the ones
+// the elementwise and softmax engines inline: MATH_ACCURATE follows the Cephes single precision
+// algorithms, MATH_FAST trades the last digits for shorter polynomials (about 1e-4 relative error).
+class DeepFlowDllExport CpuMath {
+public:
+	static void exp(ExecutionContext::MathAccuracy accuracy, size_t n, const float *x, float *y);
+	static void log(ExecutionContext::MathAccuracy accuracy, size_t n, const float *x, float *y);
+	static void tanh(ExecutionContext::MathAccuracy accuracy, size_t n, const float *x, float *y);
+	static void sigmoid(ExecutionContext::MathAccuracy accuracy, size_t n, const float *x, float *y);
+};
@@ -0,0 +1,16 @@
+#pragma once
+
+#include "core/export.h"
+
+#include <cstddef>
+#include <functional>
+
+// Persistent pool of worker threads shared by the host kernels.
+class DeepFlowDllExport CpuParallel {
+public:
+	// Number of threads that run a parallel range, including the calling thread.
+	static int num_threads();
+	// Splits [0, n) into contiguous chunks of at least grain items and runs fn(begin, end) on
+	// every chunk, blocks until all of them are done. Nested calls run on the calling thread.
+	static void for_range(size_t n, size_t grain, const std::function<void(size_t, size_t)> &fn);
+};
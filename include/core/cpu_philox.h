@@ -0,0 +1,16 @@
+#pragma once
+
+#include "core/export.h"
+
+#include <cstddef>
+#include <cstdint>
+
+// Philox4x32-10 counter-based generator (Salmon et al., Random123): block b of stream s under key
+// seed is four 32-bit words that depend only on (seed, s, b), so any range of a stream can be
+// generated on any thread without carrying state. Blocks are computed in batches laid out across
+// lanes, which the compiler turns into 32x32->64 bit vector multiplies.
+class DeepFlowDllExport CpuPhilox {
+public:
+	// out[4 * i + j] = word j of block first_block + i, for i < blocks.
+	static void generate(uint64_t seed, uint64_t stream, uint64_t first_block, size_t blocks, uint32_t *out);
+};
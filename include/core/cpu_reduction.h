@@ -0,0 +1,19 @@
+#pragma once
+
+#include "core/export.h"
+#include "proto/deepflow.pb.h"
+
+#include <array>
+
+// Host reduction of an NCHW tensor over any subset of its dims, shared by the reduction nodes.
+// Adjacent dims are coalesced first, so every shape runs one of two loops: contiguous runs when the
+// innermost dim is reduced, or lanes of neighbouring outputs when it is kept. Sums are compensated
+// (blocked lane sums folded with Kahan), full reductions are split across the pool and merged.
+class DeepFlowDllExport CpuReduction {
+public:
+	// Bit i of axes selects dim i.
+	static std::array<int, 4> output_dims(std::array<int, 4> dims, int axes);
+	// y = alpha * op(x) + beta * y. When indices is not null MIN and MAX also store the flattened position of
+	// the selected element inside its reduced region, like CUDNN_REDUCE_TENSOR_FLATTENED_INDICES.
+	static void reduce(deepflow::ReduceParam_ReduceOp op, const float *x, std::array<int, 4> dims, int axes, float *y, float alpha = 1.0f, float beta = 0.0f, unsigned int *indices = nullptr);
+};
@@ -0,0 +1,15 @@
+#pragma once
+
+#include "core/export.h"
+#include "core/execution_context.h"
+
+// Host softmax over the middle dim of an [outer, channels, inner] view: INSTANCE mode is
+// [N, C * H * W, 1], CHANNEL mode is [N, C, H * W].
+class DeepFlowDllExport CpuSoftmax {
+public:
+	// y = softmax(x). When log_sum is not null it receives max + log(sum(exp(x - max))) of every
+	// softmax, [outer, inner], so log(y) can be formed without taking the log of a rounded y.
+	static void forward(const float *x, float *y, int outer, int channels, int inner, float *log_sum = nullptr, ExecutionContext::MathAccuracy accuracy = ExecutionContext::MATH_ACCURATE);
+	// dx = y * (dy - sum(dy * y)).
+	static void backward(const float *y, const float *dy, float *dx, int outer, int channels, int inner);
+};
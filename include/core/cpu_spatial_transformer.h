@@ -0,0 +1,23 @@
+#pragma once
+
+#include "core/export.h"
+
+// Host spatial transformer with cuDNN's conventions: the affine grid holds (x, y) pairs in
+// normalized [-1, 1] coordinates, an output location (h, w) of an [out_h, out_w] grid maps to
+// x = linspace(-1, 1, out_w)[w], y = linspace(-1, 1, out_h)[h], and the bilinear sampler reads
+// source pixel ((x + 1) (in_w - 1) / 2, (y + 1) (in_h - 1) / 2) with zeros outside the image.
+// The sampler works on a channels-last copy of x: output rows are cut into tiles whose four taps and
+// weights are computed once per location, then every location is a vector loop over channels.
+// The backward pass scatters dx into one buffer per (sample, row block), reduced in block order, so
+// results do not depend on scheduling.
+class DeepFlowDllExport CpuSpatialTransformer {
+public:
+	// theta [n, 2, 3] -> grid [n, out_h, out_w, 2].
+	static void grid_forward(int n, int out_h, int out_w, const float *theta, float *grid);
+	// dtheta = sum of dgrid times (x, y, 1) over the grid, overwritten.
+	static void grid_backward(int n, int out_h, int out_w, const float *dgrid, float *dtheta);
+	// x [n, c, in_h, in_w] sampled at grid [n, out_h, out_w, 2] -> y [n, c, out_h, out_w].
+	static void sampler_forward(int n, int c, int in_h, int in_w, int out_h, int out_w, const float *x, const float *grid, float *y);
+	// dx and dgrid are overwritten, dx may be null.
+	static void sampler_backward(int n, int c, int in_h, int in_w, int out_h, int out_w, const float *x, const float *grid, const float *dy, float *dx, float *dgrid);
+};
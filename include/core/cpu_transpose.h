@@ -0,0 +1,18 @@
+#pragma once
+
+#include "core/export.h"
+
+#include <cstddef>
+
+// Host strided copy shared by the layout nodes (patching, lifting, restructure, concate, reorder).
+// Both sides are described as views over the same index space, strides are in elements and may be
+// negative for flipped axes. Size-1 dims are dropped and adjacent dims coalesced first, then rows
+// that are contiguous on both sides become memcpy, a dim that is contiguous on the other side is
+// transposed in square tiles, and anything else is a strided gather. Offsets are advanced once per
+// row or tile and the outer dims are split across the pool.
+class DeepFlowDllExport CpuTranspose {
+public:
+	static const int kMaxDims = 8;
+	// dst[i] = src[i] + beta * dst[i] for every index i of sizes[0] x ... x sizes[num_dims - 1], outermost first.
+	static void copy(int num_dims, const int *sizes, const float *src, const ptrdiff_t *src_strides, float *dst, const ptrdiff_t *dst_strides, float beta = 0.0f);
+};
@@ -0,0 +1,316 @@
+#pragma once
+
+// SIMD primitives and vector math of the host engines. This header is internal: it is only included
+// from .cpp files, which all build for the same target ISA, and nothing in it is exported.
+//
+// Vec is the vector type of the build (AVX-512 or AVX2, a plain float otherwise). Every primitive has
+// a Vec and a float form, so one functor body serves the vector loop and its scalar tail.
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+#if defined(__AVX512F__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#if defined(__AVX512F__)
+
+static const size_t kVecWidth = 16;
+struct Vec { __m512 v; };
+typedef __mmask16 Mask;
+static inline Vec load(const float *p) { return { _mm512_loadu_ps(p) }; }
+static inline void store(float *p, Vec a) { _mm512_storeu_ps(p, a.v); }
+static inline Vec operator+(Vec a, Vec b) { return { _mm512_add_ps(a.v, b.v) }; }
+static inline Vec operator-(Vec a, Vec b) { return { _mm512_sub_ps(a.v, b.v) }; }
+static inline Vec operator*(Vec a, Vec b) { return { _mm512_mul_ps(a.v, b.v) }; }
+static inline Vec operator/(Vec a, Vec b) { return { _mm512_div_ps(a.v, b.v) }; }
+static inline Vec vfma(Vec a, Vec b, Vec c) { return { _mm512_fmadd_ps(a.v, b.v, c.v) }; }
+static inline Vec vmax(Vec a, Vec b) { return { _mm512_max_ps(a.v, b.v) }; }
+static inline Vec vmin(Vec a, Vec b) { return { _mm512_min_ps(a.v, b.v) }; }
+static inline Vec vabs(Vec a) { return { _mm512_abs_ps(a.v) }; }
+static inline Vec vround(Vec a) { return { _mm512_roundscale_ps(a.v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC) }; }
+static inline Mask vgt(Vec a, Vec b) { return _mm512_cmp_ps_mask(a.v, b.v, _CMP_GT_OQ); }
+static inline Mask vge(Vec a, Vec b) { return _mm512_cmp_ps_mask(a.v, b.v, _CMP_GE_OQ); }
+static inline Mask vlt(Vec a, Vec b) { return _mm512_cmp_ps_mask(a.v, b.v, _CMP_LT_OQ); }
+static inline Mask vle(Vec a, Vec b) { return _mm512_cmp_ps_mask(a.v, b.v, _CMP_LE_OQ); }
+static inline Mask veq(Vec a, Vec b) { return _mm512_cmp_ps_mask(a.v, b.v, _CMP_EQ_OQ); }
+static inline Mask vand(Mask a, Mask b) { return a & b; }
+static inline Vec vselect(Mask m, Vec a, Vec b) { return { _mm512_mask_blend_ps(m, b.v, a.v) }; }
+// Lane j set when bit j of bits is, and bit j set when p[j] <= last as unsigned: packed masks.
+static inline Mask vbits(uint32_t bits) { return (Mask)bits; }
+static inline uint32_t vbits_le(const uint32_t *p, uint32_t last) { return _mm512_cmple_epu32_mask(_mm512_loadu_si512(p), _mm512_set1_epi32((int)last)); }
+static inline float vsum(Vec a) { return _mm512_reduce_add_ps(a.v); }
+static inline Vec vcopysign(Vec magnitude, Vec sign)
+{
+	const __m512i mask = _mm512_set1_epi32(0x80000000);
+	return { _mm512_castsi512_ps(_mm512_or_si512(_mm512_andnot_si512(mask, _mm512_castps_si512(magnitude.v)), _mm512_and_si512(mask, _mm512_castps_si512(sign.v)))) };
+}
+static inline Vec vpow2i(Vec n) { return { _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_add_epi32(_mm512_cvtps_epi32(n.v), _mm512_set1_epi32(127)), 23)) }; }
+static inline Vec vfrexp(Vec a, Vec &e)
+{
+	const __m512i bits = _mm512_castps_si512(a.v);
+	e.v = _mm512_cvtepi32_ps(_mm512_sub_epi32(_mm512_srli_epi32(bits, 23), _mm512_set1_epi32(126)));
+	return { _mm512_castsi512_ps(_mm512_or_si512(_mm512_and_si512(bits, _mm512_set1_epi32(0x007fffff)), _mm512_set1_epi32(0x3f000000))) };
+}
+
+#elif defined(__AVX2__)
+
+static const size_t kVecWidth = 8;
+struct Vec { __m256 v; };
+struct Mask { __m256 v; };
+static inline Vec load(const float *p) { return { _mm256_loadu_ps(p) }; }
+static inline void store(float *p, Vec a) { _mm256_storeu_ps(p, a.v); }
+static inline Vec operator+(Vec a, Vec b) { return { _mm256_add_ps(a.v, b.v) }; }
+static inline Vec operator-(Vec a, Vec b) { return { _mm256_sub_ps(a.v, b.v) }; }
+static inline Vec operator*(Vec a, Vec b) { return { _mm256_mul_ps(a.v, b.v) }; }
+static inline Vec operator/(Vec a, Vec b) { return { _mm256_div_ps(a.v, b.v) }; }
+// MSVC's /arch:AVX2 implies FMA, other compilers announce it separately.
+#if defined(__FMA__) || defined(_MSC_VER)
+static inline Vec vfma(Vec a, Vec b, Vec c) { return { _mm256_fmadd_ps(a.v, b.v, c.v) }; }
+#else
+static inline Vec vfma(Vec a, Vec b, Vec c) { return { _mm256_add_ps(_mm256_mul_ps(a.v, b.v), c.v) }; }
+#endif
+static inline Vec vmax(Vec a, Vec b) { return { _mm256_max_ps(a.v, b.v) }; }
+static inline Vec vmin(Vec a, Vec b) { return { _mm256_min_ps(a.v, b.v) }; }
+static inline Vec vabs(Vec a) { return { _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a.v) }; }
+static inline Vec vround(Vec a) { return { _mm256_round_ps(a.v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC) }; }
+static inline Mask vgt(Vec a, Vec b) { return { _mm256_cmp_ps(a.v, b.v, _CMP_GT_OQ) }; }
+static inline Mask vge(Vec a, Vec b) { return { _mm256_cmp_ps(a.v, b.v, _CMP_GE_OQ) }; }
+static inline Mask vlt(Vec a, Vec b) { return { _mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ) }; }
+static inline Mask vle(Vec a, Vec b) { return { _mm256_cmp_ps(a.v, b.v, _CMP_LE_OQ) }; }
+static inline Mask veq(Vec a, Vec b) { return { _mm256_cmp_ps(a.v, b.v, _CMP_EQ_OQ) }; }
+static inline Mask vand(Mask a, Mask b) { return { _mm256_and_ps(a.v, b.v) }; }
+static inline Vec vselect(Mask m, Vec a, Vec b) { return { _mm256_blendv_ps(b.v, a.v, m.v) }; }
+// Lane j set when bit j of bits is, and bit j set when p[j] <= last as unsigned: packed masks.
+static inline Mask vbits(uint32_t bits)
+{
+	const __m256i lanes = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+	return { _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(_mm256_set1_epi32((int)bits), lanes), lanes)) };
+}
+static inline uint32_t vbits_le(const uint32_t *p, uint32_t last)
+{
+	// Unsigned order through the signed compare of both sides offset by 2^31.
+	const __m256i offset = _mm256_set1_epi32((int)0x80000000u);
+	const __m256i a = _mm256_xor_si256(_mm256_loadu_si256((const __m256i *)p), offset);
+	const __m256i above = _mm256_cmpgt_epi32(a, _mm256_xor_si256(_mm256_set1_epi32((int)last), offset));
+	return ~(uint32_t)_mm256_movemask_ps(_mm256_castsi256_ps(above)) & 0xffu;
+}
+static inline float vsum(Vec a)
+{
+	__m128 s = _mm_add_ps(_mm256_castps256_ps128(a.v), _mm256_extractf128_ps(a.v, 1));
+	s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+	s = _mm_add_ss(s, _mm_movehdup_ps(s));
+	return _mm_cvtss_f32(s);
+}
+static inline Vec vcopysign(Vec magnitude, Vec sign)
+{
+	const __m256 mask = _mm256_set1_ps(-0.0f);
+	return { _mm256_or_ps(_mm256_andnot_ps(mask, magnitude.v), _mm256_and_ps(mask, sign.v)) };
+}
+static inline Vec vpow2i(Vec n) { return { _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(_mm256_cvtps_epi32(n.v), _mm256_set1_epi32(127)), 23)) }; }
+static inline Vec vfrexp(Vec a, Vec &e)
+{
+	const __m256i bits = _mm256_castps_si256(a.v);
+	e.v = _mm256_cvtepi32_ps(_mm256_sub_epi32(_mm256_srli_epi32(bits, 23), _mm256_set1_epi32(126)));
+	return { _mm256_castsi256_ps(_mm256_or_si256(_mm256_and_si256(bits, _mm256_set1_epi32(0x007fffff)), _mm256_set1_epi32(0x3f000000))) };
+}
+
+#else
+
+static const size_t kVecWidth = 1;
+typedef float Vec;
+
+#endif
+
+#if defined(__AVX512F__) || defined(__AVX2__)
+template <class V> static inline V splat(float s);
+template <> inline float splat<float>(float s) { return s; }
+#if defined(__AVX512F__)
+template <> inline Vec splat<Vec>(float s) { return { _mm512_set1_ps(s) }; }
+#else
+template <> inline Vec splat<Vec>(float s) { return { _mm256_set1_ps(s) }; }
+#endif
+#else
+template <class V> static inline V splat(float s) { return s; }
+static inline float load(const float *p) { return *p; }
+static inline void store(float *p, float a) { *p = a; }
+static inline float vsum(float a) { return a; }
+static inline bool vbits(uint32_t bits) { return (bits & 1) != 0; }
+static inline uint32_t vbits_le(const uint32_t *p, uint32_t last) { return *p <= last ? 1u : 0u; }
+#endif
+
+static inline float vfma(float a, float b, float c) { return a * b + c; }
+static inline float vmax(float a, float b) { return a > b ? a : b; }
+static inline float vmin(float a, float b) { return a < b ? a : b; }
+static inline float vabs(float a) { return fabsf(a); }
+static inline float vround(float a) { return nearbyintf(a); }
+static inline bool vgt(float a, float b) { return a > b; }
+static inline bool vge(float a, float b) { return a >= b; }
+static inline bool vlt(float a, float b) { return a < b; }
+static inline bool vle(float a, float b) { return a <= b; }
+static inline bool veq(float a, float b) { return a == b; }
+static inline bool vand(bool a, bool b) { return a && b; }
+static inline float vselect(bool m, float a, float b) { return m ? a : b; }
+static inline float vcopysign(float magnitude, float sign) { return copysignf(magnitude, sign); }
+// 2^n for an integral n in [-126, 127].
+static inline float vpow2i(float n)
+{
+	if (n != n)
+		return n;
+	const int bits = ((int)n + 127) << 23;
+	float s;
+	memcpy(&s, &bits, sizeof(float));
+	return s;
+}
+// a = m * 2^e with m in [0.5, 1) for positive normal a.
+static inline float vfrexp(float a, float &e)
+{
+	int bits;
+	memcpy(&bits, &a, sizeof(float));
+	e = (float)(((bits >> 23) & 0xff) - 126);
+	bits = (bits & 0x007fffff) | 0x3f000000;
+	float m;
+	memcpy(&m, &bits, sizeof(float));
+	return m;
+}
+
+// Transcendentals in two tiers, picked by tag. AccurateMath follows the Cephes single precision
+// kernels (range reduction plus a minimax polynomial) and stays within a few ulp of libm; FastMath
+// uses shorter polynomials fitted for about 1e-4 relative error. Both are branch free, propagate NaN,
+// flush exp below FLT_MIN to 0 and overflow it to inf, and return -inf, NaN and inf for log of 0,
+// negatives and inf.
+struct AccurateMath {};
+struct FastMath {};
+
+static const float kExpLow = -87.33654f;
+static const float kExpHigh = 88.72284f;
+
+// p * 2^n for n in [-126, 128] where the clamped input x0 was in range, 0 below it (subnormal
+// results are flushed) and inf above it.
+template <class V>
+static inline V vexp_scale(V p, V n, V x0)
+{
+	const V y = p * vpow2i(vmin(n, splat<V>(127))) * vselect(vgt(n, splat<V>(127)), splat<V>(2), splat<V>(1));
+	return vselect(vlt(x0, splat<V>(kExpLow)), splat<V>(0), vselect(vgt(x0, splat<V>(kExpHigh)), splat<V>(std::numeric_limits<float>::infinity()), y));
+}
+
+// exp(x) = p(r) * 2^n with r = x - n * ln(2) split in two parts.
+template <class V>
+static inline V vexp(V x0, AccurateMath)
+{
+	const V x = vmax(splat<V>(kExpLow), vmin(splat<V>(kExpHigh), x0));
+	const V n = vround(x * splat<V>(1.44269504088896341f));
+	V r = vfma(n, splat<V>(-0.693359375f), x);
+	r = vfma(n, splat<V>(2.12194440e-4f), r);
+	V p = splat<V>(1.9875691500e-4f);
+	p = vfma(p, r, splat<V>(1.3981999507e-3f));
+	p = vfma(p, r, splat<V>(8.3334519073e-3f));
+	p = vfma(p, r, splat<V>(4.1665795894e-2f));
+	p = vfma(p, r, splat<V>(1.6666665459e-1f));
+	p = vfma(p, r, splat<V>(5.0000001201e-1f));
+	p = vfma(p * r, r, r + splat<V>(1));
+	return vexp_scale(p, n, x0);
+}
+
+// exp(x) = 2^f * 2^n with f = x * log2(e) - n, the cubic keeps exp(0) = 1 exact.
+template <class V>
+static inline V vexp(V x0, FastMath)
+{
+	const V x = vmax(splat<V>(kExpLow), vmin(splat<V>(kExpHigh), x0));
+	const V t = x * splat<V>(1.44269504088896341f);
+	const V n = vround(t);
+	const V f = t - n;
+	V p = splat<V>(0.0550091303738f);
+	p = vfma(p, f, splat<V>(0.242211461534f));
+	p = vfma(p, f, splat<V>(0.693282960914f));
+	p = vfma(p, f, splat<V>(1));
+	return vexp_scale(p, n, x0);
+}
+
+template <class V>
+static inline V vlog_special(V x, V y)
+{
+	const V inf = splat<V>(std::numeric_limits<float>::infinity());
+	const V special = vselect(veq(x, splat<V>(0)), splat<V>(0) - inf, vselect(veq(x, inf), inf, splat<V>(std::numeric_limits<float>::quiet_NaN())));
+	return vselect(vand(vgt(x, splat<V>(0)), vlt(x, inf)), y, special);
+}
+
+// log(x) = e * ln(2) + log(m) with m in [sqrt(0.5), sqrt(2)), denormal inputs are rescaled first.
+template <class V>
+static inline V vlog(V x, AccurateMath)
+{
+	const V denormal_scale = vselect(vlt(x, splat<V>(std::numeric_limits<float>::min())), splat<V>(8388608.0f), splat<V>(1));
+	V e;
+	V m = vfrexp(x * denormal_scale, e);
+	e = e - vselect(vgt(denormal_scale, splat<V>(1)), splat<V>(23), splat<V>(0));
+	const auto below = vlt(m, splat<V>(0.707106781186547524f));
+	e = e - vselect(below, splat<V>(1), splat<V>(0));
+	const V t = vselect(below, m + m, m) - splat<V>(1);
+	const V z = t * t;
+	V p = splat<V>(7.0376836292e-2f);
+	p = vfma(p, t, splat<V>(-1.1514610310e-1f));
+	p = vfma(p, t, splat<V>(1.1676998740e-1f));
+	p = vfma(p, t, splat<V>(-1.2420140846e-1f));
+	p = vfma(p, t, splat<V>(1.4249322787e-1f));
+	p = vfma(p, t, splat<V>(-1.6668057665e-1f));
+	p = vfma(p, t, splat<V>(2.0000714765e-1f));
+	p = vfma(p, t, splat<V>(-2.4999993993e-1f));
+	p = vfma(p, t, splat<V>(3.3333331174e-1f));
+	V y = p * t * z;
+	y = vfma(e, splat<V>(-2.12194440e-4f), y);
+	y = vfma(z, splat<V>(-0.5f), y);
+	y = vfma(e, splat<V>(0.693359375f), t + y);
+	return vlog_special(x, y);
+}
+
+template <class V>
+static inline V vlog(V x, FastMath)
+{
+	V e;
+	const V m = vfrexp(x, e);
+	const auto below = vlt(m, splat<V>(0.707106781186547524f));
+	e = e - vselect(below, splat<V>(1), splat<V>(0));
+	const V t = vselect(below, m + m, m) - splat<V>(1);
+	V p = splat<V>(0.176582488401f);
+	p = vfma(p, t, splat<V>(-0.270949460665f));
+	p = vfma(p, t, splat<V>(0.336389266668f));
+	p = vfma(p, t, splat<V>(-0.499450476678f));
+	p = vfma(p, t, splat<V>(0.999966171487f));
+	return vlog_special(x, vfma(e, splat<V>(0.693147180559945309f), p * t));
+}
+
+// Odd polynomial below |x| = 0.625, 1 - 2 / (exp(2|x|) + 1) with the sign of x above.
+template <class V>
+static inline V vtanh(V x, AccurateMath)
+{
+	const V a = vabs(x);
+	const V z = x * x;
+	V p = splat<V>(-5.70498872745e-3f);
+	p = vfma(p, z, splat<V>(2.06390887954e-2f));
+	p = vfma(p, z, splat<V>(-5.37397155531e-2f));
+	p = vfma(p, z, splat<V>(1.33314422036e-1f));
+	p = vfma(p, z, splat<V>(-3.33332819422e-1f));
+	const V small = vfma(p * z, x, x);
+	const V large = vcopysign(splat<V>(1) - splat<V>(2) / (vexp(a + a, AccurateMath()) + splat<V>(1)), x);
+	return vselect(vlt(a, splat<V>(0.625f)), small, large);
+}
+
+template <class V>
+static inline V vtanh(V x, FastMath)
+{
+	const V a = vabs(x);
+	const V z = x * x;
+	V p = splat<V>(0.106607952935f);
+	p = vfma(p, z, splat<V>(-0.329620578669f));
+	p = vfma(p, z, splat<V>(0.999920737263f));
+	const V large = vcopysign(splat<V>(1) - splat<V>(2) / (vexp(a + a, FastMath()) + splat<V>(1)), x);
+	return vselect(vlt(a, splat<V>(0.625f)), p * x, large);
+}
+
+template <class V, class Tier>
+static inline V vsigmoid(V x, Tier tier)
+{
+	return splat<V>(1) / (splat<V>(1) + vexp(splat<V>(0) - x, tier));
+}
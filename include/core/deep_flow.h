@@ -54,11 +54,14 @@ public:
 
 	// RESTRUCTURE
 	std::string restructure(std::string input, int first_dims, int second_dim, RestructureOp &params = RestructureOp());
+	// Channels or samples [begin, begin + size) of input, dim is 0 or 1.
+	std::string slice(std::string input, int dim, int begin, int size, SliceOp &params = SliceOp());
 	std::string pooling(std::string input, PoolingOp &params = PoolingOp());
 	std::string lifting(std::string input, LiftingOp &params = LiftingOp());	
 	std::string patching(std::string input, PatchingOp &params = PatchingOp());
 	std::string patch_sampling(std::string input, int patch_width, int patch_height, PatchSamplingOp &params = PatchSamplingOp());
 	std::string resize(std::string input, float height_scale, float width_scale, ResizeOp &params = ResizeOp());
+	std::string resize_add(std::string input, std::string other, float height_scale, float width_scale, ResizeOp &params = ResizeOp());
 	std::string concate(std::list<std::string> inputs, ConcateOp &params = ConcateOp());
 	std::string reshape(std::string input, std::array<int, 4> output_dims, ReshapeOp &params = ReshapeOp());	
 	std::string spatial_transformer(std::string input, std::string theta, std::string grid, SpatialTransformerOp &params = SpatialTransformerOp());
@@ -98,6 +101,7 @@ public:
 	std::string reduce_norm1(std::string input, int reduce_dimension, ReduceNorm1Op &params = ReduceNorm1Op());
 	std::string reduce_norm2(std::string input, int reduce_dimension, ReduceNorm2Op &params = ReduceNorm2Op());
 	std::string reduce_all(std::string input, ReduceAllOp &params = ReduceAllOp());	
+	std::string reduce(std::string input, ReduceOp &params);
 
 	//ACTIVATIONS
 	std::string leaky_relu(std::string a, LeakyReluOp &params = LeakyReluOp());
@@ -139,6 +143,7 @@ public:
 
 	// OTHER	
 	std::string loss(std::string input, LossOp &params = LossOp());
+	std::array<std::string, 2> softmax_cross_entropy(std::string logits, std::string labels, SoftmaxCrossEntropyOp &params = SoftmaxCrossEntropyOp());
 	std::string equal(std::string a, std::string b, EqualOp &params = EqualOp());	
 	std::array<std::string,2> accumulator(std::string input, AccumulatorOp &params = AccumulatorOp());
 	std::string replay_memory(std::string input, int capacity, ReplayMemoryOp &params = ReplayMemoryOp());
@@ -154,7 +159,7 @@ public:
 	std::shared_ptr<Session> session();
 
 	// CAFFE
-	void load_from_caffe_model(std::string file_path, std::initializer_list<std::pair<std::string, std::array<int, 4>>> inputs, bool verbose = false);
+	void load_from_caffe_model(std::string file_path, std::initializer_list<std::pair<std::string, std::array<int, 4>>> inputs, bool verbose = false, std::string cache_file_path = "");
 
 	void with(std::string scope);
 	void with(Tensor::DataPolicy policy);
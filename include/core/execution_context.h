@@ -4,6 +4,7 @@
 
 #include <string>
 #include <memory>
+#include <cstdint>
 
 class DeepFlowDllExport ExecutionContext {
 public:
@@ -15,12 +16,42 @@ public:
 		TRAIN = 0,
 		TEST = 1
 	};
+	// Host transcendentals (exp, log, tanh, sigmoid): within a few ulp of libm, or about 1e-4 relative.
+	enum MathAccuracy {
+		MATH_ACCURATE = 0,
+		MATH_FAST = 1
+	};
+	// Memory order of host activations, numbered as deepflow::NodeParam::Layout.
+	enum TensorLayout {
+		NCHW = 0,
+		NHWC = 1,
+		NCHW16C = 2
+	};
 	int current_epoch = 1;	
 	int current_iteration = 1;	
 	int debug_level = 0;
 	bool quit = false;	
 	ExecutionPreference execution_preference = PREFER_FASTEST;
 	ExecutionMode execution_mode = TRAIN;
+	MathAccuracy math_accuracy = MATH_ACCURATE;
+	// Run GraphFusion on the block when the session initializes, batch normalization is folded into
+	// weights only when execution_mode is TEST at that point.
+	bool fuse_graph = false;
+	// Run GraphSimplifier on the block when the session initializes, before fusion. Without fetches
+	// every node nothing reads stays live.
+	bool simplify_graph = false;
+	// Run GraphLayout on the block when the session initializes, after fusion, unless this is NCHW.
+	TensorLayout cpu_layout = NCHW;
+	// Session::backward() computes only the gradients that reach a variable with an enabled solver:
+	// nodes that feed no such variable are skipped and data gradients of inputs computed from none
+	// are not produced, placeholder diffs included. Recomputed whenever a solver is enabled or disabled.
+	bool prune_backward = false;
+	// Session::backward() applies the solver of a variable as soon as its gradient is complete, reading
+	// it from the variable's diff, and apply_solvers() does nothing. Gradients do not accumulate across
+	// backward passes then, variables on no backward path are not updated.
+	bool fused_update = false;
+	// Set by Session::begin_step(), 0 outside steps, see Node::is_memoizable().
+	uint64_t step = 0;
 };
 
 using ExecutionContextPtr = std::shared_ptr<ExecutionContext>;
\ No newline at end of file
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "core/export.h"
+
+#include "proto/deepflow.pb.h"
+
+#include <map>
+#include <string>
+
+// Graph rewrite run on a BlockParam before its nodes are created. Only intermediates with a single
+// consumer and the same data policy on both sides are fused, and every fused node takes the name and
+// output of the last node it replaces, so the rest of the graph is left untouched:
+//   inference: conv2d / matmul [-> bias_add] -> spatial batch_normalization, with stored weights,
+//              becomes a conv2d / matmul whose weights and bias hold the folded scale and shift.
+//   always:    conv2d / matmul [-> bias_add] [-> activation / leaky_relu] moves the bias and the
+//              activation into the conv2d / matmul epilogue.
+//   always:    two or more unary pointwise nodes in a row (activation, leaky_relu, exp, log, abs,
+//              square) become one fused_elementwise node.
+// Removed intermediates can no longer be looked up by name.
+class DeepFlowDllExport GraphFusion {
+public:
+	struct Report {
+		int nodes_removed = 0;
+		int folded_batch_norms = 0;
+		int epilogues = 0;
+		int chains = 0;
+		// Fused node name -> intermediate outputs it absorbed, each was a value and a diff shaped like
+		// the fused node's output.
+		std::map<std::string, int> absorbed_outputs;
+		// Values and diffs of variables removed outright.
+		size_t variable_bytes = 0;
+		// Everything eliminated, filled in by Session once the fused nodes know their shapes.
+		size_t bytes = 0;
+	};
+	static Report run(deepflow::BlockParam *block, bool inference);
+};
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "core/export.h"
+
+#include "proto/deepflow.pb.h"
+
+// Graph rewrite run on a BlockParam before its nodes are created, picks the memory layout of every
+// host node (NodeParam.layout). Nodes are visited in topological order:
+//   conv2d:    takes the preferred layout, NCHW16C only when its filter variable has multiples of 16
+//              filters (NHWC otherwise). It reads its input in any layout.
+//   followers: pointwise nodes, bias_add, spatial batch_normalization, concate, patching and
+//              restructure keep the layout of their data input, as far as they support it.
+//   others:    NCHW, as are nodes nothing reads, so feeds and fetches stay NCHW.
+// A reorder node is inserted wherever a consumer needs another layout than its producer has, one per
+// output and layout, shared by all its consumers. Device nodes stay NCHW.
+class DeepFlowDllExport GraphLayout {
+public:
+	struct Report {
+		int reorders = 0;
+		int nhwc = 0;
+		int nchw16c = 0;
+	};
+	static Report run(deepflow::BlockParam *block, deepflow::NodeParam::Layout preferred);
+};
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "core/export.h"
+
+#include "proto/deepflow.pb.h"
+
+#include <array>
+#include <functional>
+#include <list>
+#include <string>
+#include <vector>
+
+// Graph rewrite run on a BlockParam before its nodes are created, in three passes:
+//   deduplication: nodes of a pure op (no state, no randomness, no side effects) with the same
+//                  parameters and the same inputs collapse into the first of them, consumers of the
+//                  others read its outputs instead. Nodes are visited in topological order, so whole
+//                  duplicated subgraphs collapse.
+//   folding:       a pure single output node whose inputs are all constant, or that has no inputs,
+//                  becomes a solver-less variable holding its value, computed once by the evaluator.
+//                  Constants are variables without a solver whose values are stored or come from a
+//                  deterministic initializer, and the nodes folded from them. Constants left without
+//                  consumers are removed.
+//   elimination:   nodes nothing live depends on are removed. Live roots are the fetches, losses (softmax
+//                  cross entropy included) and variables with a solver, so sinks such as displays and printers that are not fetched
+//                  go. Without fetches every node without consumers is a root and nothing is removed.
+// Solver-less variables are assumed to keep their values, removed nodes can no longer be looked up by name.
+class DeepFlowDllExport GraphSimplifier {
+public:
+	struct Report {
+		int deduplicated = 0;
+		int folded = 0;
+		int dead = 0;
+		// Weights now stored in folded variables.
+		size_t constant_bytes = 0;
+	};
+	struct Constant {
+		std::array<int, 4> dims;
+		std::vector<float> data;
+	};
+	// Fills values with the first output of each named node of constants, a block of solver-less nodes.
+	typedef std::function<void(const deepflow::BlockParam &constants, const std::vector<std::string> &names, std::vector<Constant> *values)> Evaluator;
+	static Report run(deepflow::BlockParam *block, const std::list<std::string> &fetches, const Evaluator &evaluate);
+};
@@ -43,6 +43,10 @@ public:
 	void _forward();
 	void _backward();
 	virtual bool is_generator() { return false; }
+	// Within a step (see Session::begin_step()) a memoizable node runs at most once for the same input
+	// versions and keeps its outputs otherwise. Nodes whose outputs depend on more than their inputs and
+	// the execution context, or that act on every call, opt out.
+	virtual bool is_memoizable() { return !is_generator(); }
 	virtual bool is_last_batch() { return false; }
 	virtual std::string to_cpp() const = 0;
 	virtual void prep_for_saving() {}
@@ -51,6 +55,10 @@ public:
 	std::string scope() const;
 	virtual std::string op_name() const = 0;	
 	std::string _input_name_for_cpp(int i) const;	
+	// to_cpp() of the unfused nodes GraphFusion folded into a pointwise chain or an epilogue over input,
+	// the last statement defines the node's name.
+	std::string _pointwise_cpp(const std::vector<deepflow::PointwiseStage> &stages, std::string input) const;
+	std::string _epilogue_cpp(const deepflow::EpilogueParam &epilogue, const std::string &input) const;
 	void write_values(std::shared_ptr<Tensor> tensor, float alpha = 1.0, float beta = 0.0f);
 	void write_values(std::initializer_list<float> values);
 	void write_diffs(std::shared_ptr<Tensor> tensor, float alpha = 1.0, float beta = 0.0f);	
@@ -59,12 +67,22 @@ public:
 	void dot(const int n, const float alpha, const void *a, const void *b, const float beta, void *dst);
 	void fill(int n, const float value, void *dst, const float beta = 0);
 	void fill(const float value);
+	// Conv and matmul epilogue over [outer, channels, inner]: y = op(y + bias[c]) in place, bias may be null.
+	// block is the channel block of host outputs.
+	void epilogue_forward(const deepflow::EpilogueParam &epilogue, int outer, int channels, int inner, const float *bias, float *y, int block = 1);
+	// dy = op'(y) * dy in place, then dbias[c] = sum of dy over outer and inner unless dbias is null.
+	void epilogue_backward(const deepflow::EpilogueParam &epilogue, int outer, int channels, int inner, const float *y, float *dy, float *dbias, int block = 1);
 	std::vector<NodeInputPtr> &inputs();
 	std::vector<NodeOutputPtr> &outputs();
 	NodeInputPtr input(int index);
 	NodeOutputPtr output(int index);
 	bool isInitialized() const;
 	void setInitialized(bool status);
+	bool isFrozen() const;
+	void setFrozen(bool status);
+	// False when no input and no solver of the node needs a gradient, _backward() does nothing then.
+	bool needsBackward() const;
+	void setNeedsBackward(bool status);
 	deepflow::NodeParam *param();	
 	void setExecutionContext(ExecutionContextPtr context);
 	ExecutionContextPtr executionContext();
@@ -72,14 +90,21 @@ public:
 	virtual std::list<std::shared_ptr<Node>> outputNodes() const;
 	void print();
 	Tensor::DataPolicy policy() const;
+	bool is_cpu() const;
+	ExecutionContext::MathAccuracy math_accuracy() const;
 protected:	
 	std::vector<NodeInputPtr> _inputs;
 	std::vector<NodeOutputPtr> _outputs;
 	std::string _name = "Node";
 	std::string _scope = "Default";
 	bool _initialized = false;
+	bool _frozen = false;
+	bool _needs_backward = true;
 	deepflow::NodeParam *_param = nullptr;
 	ExecutionContextPtr _context = nullptr;
+	// Step of the last memoized run and the input versions it saw.
+	uint64_t _memo_step = 0;
+	std::vector<uint64_t> _memo_versions;
 	const float one = 1.0f;
 	const float zero = 0.0f;
 	int _verbose = 0;
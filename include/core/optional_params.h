@@ -4,6 +4,7 @@
 
 #include <string>
 #include <list>
+#include <vector>
 
 template<class T>
 class DeepFlowDllExport NodeOp {
@@ -286,10 +287,19 @@ public:
 	int _v_stride = 1;
 	int _h_stride = 1;
 	bool _same = false;
+	deepflow::PoolingParam_Mode _mode = deepflow::PoolingParam_Mode_MAX;
 public:
 	PoolingOp(std::string name = "pooling") {
 		this->name(name);
 	}
+	PoolingOp &max() {
+		this->_mode = deepflow::PoolingParam_Mode_MAX;
+		return *this;
+	}
+	PoolingOp &average(bool count_padding = false) {
+		this->_mode = count_padding ? deepflow::PoolingParam_Mode_AVERAGE_COUNT_INCLUDE_PADDING : deepflow::PoolingParam_Mode_AVERAGE_COUNT_EXCLUDE_PADDING;
+		return *this;
+	}
 	PoolingOp &same() {
 		this->_same = true;
 		_v_pad = floor(_window_h / 2);
@@ -416,10 +426,31 @@ public:
 };
 
 class ResizeOp : public NodeOp<ResizeOp> {
+public:
+	deepflow::ResizeParam_Mode _mode = deepflow::ResizeParam_Mode_NEAREST;
+	float _alpha = 1.0;
+	float _beta = 1.0;
 public:
 	ResizeOp(std::string name = "resize") {
 		this->name(name);
 	}
+	ResizeOp &nearest() {
+		_mode = deepflow::ResizeParam_Mode_NEAREST;
+		return *this;
+	}
+	ResizeOp &bilinear() {
+		_mode = deepflow::ResizeParam_Mode_BILINEAR;
+		return *this;
+	}
+	// Coefficients of resize_add, output = alpha * resize(input) + beta * other.
+	ResizeOp &alpha(float coef) {
+		_alpha = coef;
+		return *this;
+	}
+	ResizeOp &beta(float coef) {
+		_beta = coef;
+		return *this;
+	}
 };
 
 class ReshapeOp : public NodeOp<ReshapeOp> {
@@ -429,6 +460,13 @@ public:
 	}
 };
 
+class SliceOp : public NodeOp<SliceOp> {
+public:
+	SliceOp(std::string name = "slice") {
+		this->name(name);
+	}
+};
+
 class ConcateOp : public NodeOp<ConcateOp> {
 public:
 	ConcateOp(std::string name = "concate") {
@@ -600,6 +638,7 @@ public:
 class ReduceOp : public NodeOp<ReduceOp> {
 public:
 	int _reduce_dimention = 1;
+	std::vector<int> _reduce_dimentions;
 	deepflow::ReduceParam_ReduceOp _op = deepflow::ReduceParam_ReduceOp_AVG;
 	deepflow::ReduceParam::OutputType _output_type = deepflow::ReduceParam_OutputType_VALUES;
 	int _terminal = 0;
@@ -609,6 +648,11 @@ public:
 	}
 	ReduceOp &reduce(int dimension) {
 		this->_reduce_dimention = dimension;
+		this->_reduce_dimentions.clear();
+		return *this;
+	}
+	ReduceOp &reduce(std::initializer_list<int> dimensions) {
+		this->_reduce_dimentions = dimensions;
 		return *this;
 	}
 	ReduceOp &avg() {
@@ -864,6 +908,28 @@ public:
 	}
 };
 
+class SoftmaxCrossEntropyOp : public NodeOp<SoftmaxCrossEntropyOp> {
+public:
+	deepflow::SoftmaxParam_Mode _mode = deepflow::SoftmaxParam_Mode_INSTANCE;
+	float _alpha = 1.0f;
+public:
+	SoftmaxCrossEntropyOp(std::string name = "softmax_cross_entropy") {
+		this->name(name);
+	}
+	SoftmaxCrossEntropyOp &by_instance() {
+		_mode = deepflow::SoftmaxParam_Mode_INSTANCE;
+		return *this;
+	}
+	SoftmaxCrossEntropyOp &by_channel() {
+		_mode = deepflow::SoftmaxParam_Mode_CHANNEL;
+		return *this;
+	}
+	SoftmaxCrossEntropyOp &alpha(float value) {
+		this->_alpha = value;
+		return *this;
+	}
+};
+
 class RandomSelectorOp : public NodeOp<RandomSelectorOp> {
 public:
 	float _ratio = 0.5f;
@@ -1107,10 +1173,19 @@ public:
 };
 
 class ReplayMemoryOp : public NodeOp<ReplayMemoryOp> {
+public:
+	bool _prioritized = false;
+	float _alpha = 0.6f;
 public:
 	ReplayMemoryOp(std::string name = "replay_memory") {
 		this->name(name);
 	}
+	// Samples in proportion to priority ^ alpha instead of uniformly (CPU only).
+	ReplayMemoryOp &prioritized(float alpha = 0.6f) {
+		this->_prioritized = true;
+		this->_alpha = alpha;
+		return *this;
+	}
 };
 
 class BatchStddevOp : public NodeOp<BatchStddevOp> {
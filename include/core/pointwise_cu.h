@@ -0,0 +1,42 @@
+#pragma once
+
+#include "core/common_cu.h"
+
+// Device stages of fused nodes, numbered as deepflow::PointwiseStage::Op and CpuElementwise::PointwiseOp.
+
+__device__ __forceinline__
+float pointwise_forward(int op, float coef, float x)
+{
+	switch (op) {
+	case 1: return 1.0f / (1.0f + expf(-x));
+	case 2: return x > 0 ? x : 0.0f;
+	case 3: return tanhf(x);
+	case 4: return fminf(fmaxf(x, 0.0f), coef);
+	case 5: return x > 0 ? x : coef * (expf(x) - 1.0f);
+	case 6: return x > 0 ? x : x * coef;
+	case 7: return expf(x);
+	case 8: return coef * logf(x);
+	case 9: return fabsf(x);
+	case 10: return x * x;
+	default: return x;
+	}
+}
+
+// op'(x) * dy where y = op(x).
+__device__ __forceinline__
+float pointwise_backward(int op, float coef, float x, float y, float dy)
+{
+	switch (op) {
+	case 1: return dy * y * (1.0f - y);
+	case 2: return x > 0 ? dy : 0.0f;
+	case 3: return dy * (1.0f - y * y);
+	case 4: return x > 0 && x < coef ? dy : 0.0f;
+	case 5: return x > 0 ? dy : dy * (y + coef);
+	case 6: return x > 0 ? dy : dy * coef;
+	case 7: return y * dy;
+	case 8: return coef * dy / x;
+	case 9: return x > 0 ? dy : x < 0 ? -dy : 0.0f;
+	case 10: return 2.0f * x * dy;
+	default: return dy;
+	}
+}
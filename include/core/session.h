@@ -3,11 +3,15 @@
 #include "core/export.h"
 
 #include "core/deep_flow.h"
+#include "core/graph_fusion.h"
+#include "core/graph_layout.h"
+#include "core/graph_simplifier.h"
 #include "nodes/place_holder.h"
 #include "nodes/switch.h"
 #include "nodes/multiplexer.h"
 #include "nodes/add.h"
 #include "nodes/loss.h"
+#include "nodes/softmax_cross_entropy.h"
 #include "nodes/gaussian_kernel.h"
 #include "nodes/psnr.h"
 #include "nodes/accumulator.h"
@@ -18,18 +22,22 @@
 class Solver;
 class Variable;
 class Loss;
+class SharedWeights;
 
 class DeepFlowDllExport Session {
 	friend class DeepFlow;
 	friend class Node;
+	friend class AotCompiler;
 public:
 	Session() {}
 	Session(std::shared_ptr<Block> block) { _block = block; }
 	void create_nodes();
-	void initialize(std::shared_ptr<ExecutionContext> execution_context = nullptr);
+	void simplify(std::list<std::string> fetches = {}, std::shared_ptr<ExecutionContext> execution_context = nullptr);
+	void initialize(std::shared_ptr<ExecutionContext> execution_context = nullptr, bool init_report = false);
 	void set_execution_context(std::shared_ptr<ExecutionContext> execution_context);	
 	void mem_usage(size_t *free_byte, size_t *total_byte, float *used_byte_percentage);
 	std::string to_cpp(const std::string &scope = "") const;
+	std::string to_aot_cpp(std::list<std::string> fetches, const std::string &name = "deepflow_net", bool verbose = false);
 	std::shared_ptr<PlaceHolder> get_placeholder(const std::string &name, const std::string &scope = "");
 	template <class T = Node>
 	std::shared_ptr<T> get_node(std::string name, std::string scope = "", bool validate = true);	
@@ -39,6 +47,11 @@ public:
 	void clamp(float min, float max, const std::string &scope);
 	void backward(std::list<std::shared_ptr<Node>> end_nodes, std::list<std::pair<std::shared_ptr<Node>, std::shared_ptr<Tensor>>> feed_list = {});
 	void backward(const std::string &scope, std::list<std::pair<std::shared_ptr<Node>, std::shared_ptr<Tensor>>> feed_list = {});
+	// Between begin_step() and end_step() forward() skips the memoizable nodes whose inputs have the
+	// same versions as when they last ran in the step. Values written behind the session's back, and
+	// changes to the execution mode, are not seen until the next step.
+	void begin_step();
+	void end_step();
 	void apply_solvers(std::list<std::string> solver_names = {});
 	void apply_solvers(const std::string &scope);
 	void set_enabled_solvers(bool state, std::list<std::string> solver_names = {});
@@ -46,6 +59,10 @@ public:
 	void set_learning_rate(float lr, std::list<std::string> solver_names = {});
 	void set_learning_rate(float lr, const std::string &scope);
 	void save(std::string file_path, bool as_text = false);
+	void save_frozen(std::string file_path, std::list<std::string> fetches = {}, bool plan_memory = true, std::string shared_weights = "");
+	static std::shared_ptr<Session> load_frozen(std::string file_path, std::shared_ptr<ExecutionContext> execution_context = nullptr, std::string shared_weights = "");
+	void save_shared_weights(std::string source, const std::string &scope = "");
+	void map_shared_weights(std::string source);
 	void print_total_parameters(const std::string &scope);
 	void print_variables_info(const std::string &scope);
 	void print_nodes_info(const std::string &scope);
@@ -53,6 +70,9 @@ public:
 	std::shared_ptr<Node> end_node(const std::string &scope) const;
 	std::list<std::shared_ptr<Node>> end_nodes(const std::string &scope) const;
 	bool check_quit() { return _execution_context->quit; }
+	const GraphFusion::Report &fusion_report() const { return _fusion_report; }
+	const GraphSimplifier::Report &simplifier_report() const { return _simplifier_report; }
+	const GraphLayout::Report &layout_report() const { return _layout_report; }
 private:
 	template <class T>
 	std::list<std::shared_ptr<T>> _get_nodes(const std::string &scope);
@@ -63,14 +83,26 @@ private:
 	std::shared_ptr<Node> _create_node(deepflow::NodeParam *);
 	std::shared_ptr<Solver> _create_solver(deepflow::SolverParam *);	
 	void _insert_splits();
+	void _create_frozen_nodes(std::string shared_weights);
+	void _map_variables();
+	void _prune_backward();
 private:
 	bool _created = false;
 	bool _initialized = false;
+	bool _frozen = false;
+	uint64_t _steps = 0;
+	// Whether the pruning flags of the nodes are set, and the solver states they were computed for.
+	bool _pruned = false;
+	std::vector<bool> _pruned_solvers;
 	std::shared_ptr<ExecutionContext> _execution_context;
 	std::shared_ptr<Block> _block;
 	std::list<std::shared_ptr<Node>> _nodes;
 	std::list<std::shared_ptr<Variable>> _variables;	
 	std::map<std::shared_ptr<Variable>, std::shared_ptr<Solver>> _solvers;
+	std::shared_ptr<SharedWeights> _shared_weights;
+	GraphFusion::Report _fusion_report;
+	GraphSimplifier::Report _simplifier_report;
+	GraphLayout::Report _layout_report;
 };
 
 template<class T>
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "core/export.h"
+
+#include <memory>
+#include <list>
+#include <map>
+#include <string>
+#include <array>
+
+class Tensor;
+class Variable;
+
+// Read-only weights shared by every process on a host. The weights live in a file or, for
+// sources written as "shm://<name>", in a shared memory segment. Mapped variables of CPU
+// sessions point straight into the mapping, so all the processes share the same physical pages.
+class DeepFlowDllExport SharedWeights : public std::enable_shared_from_this<SharedWeights> {
+public:
+	SharedWeights(const std::string &source);
+	static void write(const std::string &source, std::list<std::shared_ptr<Variable>> variables);
+	std::shared_ptr<Tensor> tensor(const std::string &name);
+	bool contains(const std::string &name) const;
+	const std::string &source() const;
+private:
+	struct Entry {
+		std::array<int, 4> dims;
+		size_t offset;
+	};
+	static bool _is_shm(const std::string &source, std::string *name);
+private:
+	std::string _source;
+	std::shared_ptr<void> _region;
+	const char *_data = nullptr;
+	size_t _size = 0;
+	std::map<std::string, Entry> _entries;
+};
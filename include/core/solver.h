@@ -4,6 +4,9 @@
 #include "core/terminal.h"
 #include "proto/deepflow.pb.h"
 
+#include <list>
+#include <vector>
+
 class Variable;
 
 class DeepFlowDllExport Solver : public CudaHelper {
@@ -18,9 +21,13 @@ public:
 	bool has_the_same_param(std::shared_ptr<Solver> another) const;
 	void set_learning_rate(float lr);
 	void set_enabled(bool state);
+	bool enabled() const;
 protected:
+	// A buffer of the variable's size filled with value, on the host for host variables.
+	float *_state(std::shared_ptr<Variable> var, float value);
 	deepflow::SolverParam *_param;
 	bool _initialized = false;
 	float _learning_rate = 0.0f;	
 	bool _enabled = true;
+	std::list<std::vector<float>> _host_state;
 };
\ No newline at end of file
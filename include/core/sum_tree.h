@@ -0,0 +1,25 @@
+#pragma once
+
+#include "core/export.h"
+
+#include <vector>
+
+// Binary tree of partial sums over a fixed number of non-negative priorities, for sampling a slot
+// in proportion to its priority in O(log n). Leaves are padded to a power of two and every update
+// recomputes its ancestors from their children, so sums do not drift.
+class DeepFlowDllExport SumTree {
+public:
+	explicit SumTree(int capacity = 0);
+	void resize(int capacity);
+	int capacity() const;
+	void set(int slot, float priority);
+	float get(int slot) const;
+	float total() const;
+	// Slot whose range [sum of the slots before it, that sum + its priority) holds u, for
+	// 0 <= u < total(). Values at or past the total land on the last slot with a priority.
+	int find(float u) const;
+private:
+	int _capacity = 0;
+	int _leaves = 1;
+	std::vector<float> _tree;
+};
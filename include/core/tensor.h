@@ -7,6 +7,9 @@
 #include <string>
 #include <vector>
 #include <array>
+#include <atomic>
+#include <cstddef>
+#include <memory>
 
 #include "proto/deepflow.pb.h"
 #include "core/common_cu.h"
@@ -26,12 +29,25 @@ public:
 	{
 		GPU_ONLY_POLICY,
 		GPU_WITH_CPU_OFFLOAD_POLICY,
-		CUDA_MANAGED_POLICY
+		CUDA_MANAGED_POLICY,
+		CPU_ONLY_POLICY
+	};
+
+	// Memory order of host data, numbered as deepflow::NodeParam::Layout. dims() are [n, c, h, w] in
+	// every layout, set() and to_vec() take and return NCHW values.
+	enum Layout
+	{
+		NCHW,
+		NHWC,
+		NCHW16C
 	};
 
 	Tensor();	
 	Tensor(std::array<int, 4> dims, std::string name, DataPolicy policy);
 	Tensor(std::array<int, 4> dims, std::shared_ptr<Tensor> shadow_tensor, std::string name);
+	Tensor(std::array<int, 4> dims, std::shared_ptr<Tensor> arena, size_t offset, std::string name);
+	Tensor(std::array<int, 4> dims, const float *mapped_data, std::shared_ptr<void> mapping, std::string name);
+	Tensor(std::array<int, 4> dims, std::shared_ptr<Tensor> tensor, size_t offset, std::array<ptrdiff_t, 4> strides, std::string name);
 	void init(DataPolicy policy);	
 	std::string shape() const;
 	int size() const;
@@ -58,8 +74,32 @@ public:
 
 	std::string toString();
 	std::string name() const;
+	std::shared_ptr<Tensor> shadow_tensor() const;
+	// Serves the data of tensor from now on, without copying; nullptr goes back to this tensor's own buffer.
+	void shadow(std::shared_ptr<Tensor> tensor);
+	// Serves a window of the data of tensor from now on, without copying: element (n, c, h, w) is element
+	// offset + n * strides[0] + c * strides[1] + h * strides[2] + w * strides[3] of the data tensor's own
+	// strides() address. Both sides are NCHW. A strided window is gathered into a contiguous buffer by
+	// the first cpu_data() or gpu_data() after each view(), kernels that take strides read
+	// cpu_strided_data() instead. shadow(nullptr) goes back to this tensor's own buffer.
+	void view(std::shared_ptr<Tensor> tensor, size_t offset, std::array<ptrdiff_t, 4> strides);
+	size_t view_offset() const;
+	std::array<ptrdiff_t, 4> strides() const;
+	// False for a window whose elements are not one dense NCHW run.
+	bool is_contiguous() const;
+	// Host data at the window offset, indexed with strides(), without gathering it.
+	float * cpu_strided_data();
+	static std::array<ptrdiff_t, 4> contiguous_strides(std::array<int, 4> dims);
+	bool is_read_only() const;
+	Layout layout() const;
+	void set_layout(Layout layout);
+	// Channel block of the layout, see CpuLayout.
+	int channel_block() const;
 	
 	static size_t used_gpu();
+	static size_t allocated_by_thread();
+	// Counts memory a node allocates outside of a Tensor, such as a cuDNN workspace, towards allocated_by_thread().
+	static void add_allocated_by_thread(size_t bytes);
 
 protected:
 	std::array<int, 4> _dims;
@@ -73,8 +113,24 @@ protected:
 	DataLocation _location = CPU;
 	DataPolicy _policy;
 	std::shared_ptr<Tensor> _shadow_tensor;	
+	// Location of the own buffer while shadow() redirects, SHADOW when there is none.
+	DataLocation _unshadowed_location = SHADOW;
+	std::shared_ptr<Tensor> _arena;
+	std::shared_ptr<void> _mapping;
+	bool _read_only = false;
+	Layout _layout = NCHW;
+	// Set by view(), the shadow tensor is then the one the offset and strides address.
+	bool _window = false;
+	size_t _view_offset = 0;
+	std::array<ptrdiff_t, 4> _strides;
+	std::shared_ptr<Tensor> _gathered;
+	bool _gathered_stale = true;
 	cudaStream_t _stream = nullptr;
 	cudaEvent_t _offload_event = nullptr;
-	static size_t _used_gpu_mem_size;
+	static std::atomic<size_t> _used_gpu_mem_size;
+private:
+	bool _is_device() const;
+	float * _gather(bool device);
+	void _gather_gpu(const float *src, float *dst) const;
 };
 
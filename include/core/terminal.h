@@ -3,6 +3,8 @@
 #include "core/export.h"
 #include "core/tensor.h"
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -45,8 +47,14 @@ public:
 	virtual void disconnect();
 	std::shared_ptr<Node> connectedNode() const;
 	std::shared_ptr<Terminal> connectedTerminal() const;
+	// Version of the connected output.
+	uint64_t version() const;
+	// An input whose producer needs no gradient has no diff, see ExecutionContext::prune_backward.
+	void set_requires_grad(bool status);
+	bool requires_grad() const;
 protected:
 	std::shared_ptr<Terminal> _connected_terminal;
+	bool _requires_grad = true;
 };
 
 class DeepFlowDllExport NodeOutput : public Terminal {
@@ -54,6 +62,9 @@ public:
 	NodeOutput(std::shared_ptr<Node> parentNode, int index, const std::string &name);		
 	void initValue(std::array<int, 4> dims);
 	void initValue(std::array<int, 4> dims, std::shared_ptr<Tensor> tensor);
+	// The value is a window of tensor, see Tensor::view().
+	void initValue(std::array<int, 4> dims, std::shared_ptr<Tensor> tensor, size_t offset, std::array<ptrdiff_t, 4> strides);
+	void planValue(std::shared_ptr<Tensor> arena, size_t offset);
 	std::array<int, 4> dims();
 	void feed(std::shared_ptr<NodeOutput> t);
 	void initDiff();
@@ -69,12 +80,20 @@ public:
 	virtual std::set<std::shared_ptr<Terminal>> connectedTerminals() const;
 	void setEnabled(bool status);
 	bool enabled() const;
+	// Unique to the current contents of the value, changes whenever the value is written: by the forward
+	// of the node, a feed, a solver update or a reset.
+	uint64_t version() const;
+	void bump_version();
 protected:
 	std::set<std::shared_ptr<Terminal>> _connected_terminals;
 	std::shared_ptr<Tensor> _value;
 	std::shared_ptr<Tensor> _diff;
+	std::shared_ptr<Tensor> _arena;
+	size_t _arena_offset = 0;
 	std::string _name;
 	bool _enabled = false;
+	uint64_t _version = 0;
+	static std::atomic<uint64_t> _last_version;
 };
 
 using NodeOutputPtr = std::shared_ptr<NodeOutput>;
@@ -9,6 +9,7 @@ public:
 	int minNumInputs() { return 1; }
 	int minNumOutputs() { return 2; }	
 	std::string op_name() const override { return "accumulator"; }
+	bool is_memoizable() override { return false; }
 	void init();	
 	void forward();
 	void backward();
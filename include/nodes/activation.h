@@ -14,6 +14,8 @@ public:
 	void backward();
 	std::string to_cpp() const;
 private:
+	cudnnActivationMode_t _activation_mode;
+	float _coef = 0;
 	cudnnActivationDescriptor_t _activation_desc;
 	cudnnHandle_t _cudnnHandle;
 };
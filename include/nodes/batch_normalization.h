@@ -8,6 +8,8 @@ public:
 	int minNumInputs() { return 3; }
 	int minNumOutputs() { return 1; }	
 	std::string op_name() const override { return "batch_normalization"; }
+	// TRAIN normalizes with the batch statistics and updates the running ones, only TEST is repeatable.
+	bool is_memoizable() override { return _context && _context->execution_mode == ExecutionContext::TEST; }
 	void init();	
 	void forward();
 	void backward();
@@ -23,6 +25,11 @@ private:
 	float * _cachedVariance = nullptr;
 	float * _runningMean = nullptr;
 	float * _runningVariance = nullptr;
+	// The same statistics for nodes that run on the host.
+	std::vector<float> _hostCachedMean;
+	std::vector<float> _hostCachedVariance;
+	std::vector<float> _hostRunningMean;
+	std::vector<float> _hostRunningVariance;
 	size_t _bnScaleBiasMeanVarSize;
 	size_t _bnScaleBiasMeanVarSizeInBytes;
 };
\ No newline at end of file
@@ -21,4 +21,6 @@ private:
 	float *_d_std = nullptr;
 	size_t _workspaceSizeInBytes = 0;
 	int _inner_dim = 0;
+	std::vector<float> _avg;
+	std::vector<float> _std;
 };
\ No newline at end of file
@@ -1,17 +1,20 @@
 #pragma once
 
 #include "core/node.h"
+#include "core/cpu_convolution.h"
 
 class DeepFlowDllExport Convolution2D : public Node {
 public:
 	Convolution2D(deepflow::NodeParam *param);
-	int minNumInputs() { return 2; }
+	int minNumInputs() { return _param->conv_2d_param().epilogue().bias() ? 3 : 2; }
 	int minNumOutputs() { return 1; }	
 	std::string op_name() const override { return "conv2d"; }
 	void init();	
 	void forward();
 	void backward();
 	std::string to_cpp() const;
+private:
+	bool has_epilogue() const;
 protected:
 	cudnnHandle_t _cudnnHandle;		
 	cudnnTensorDescriptor_t _xDesc, _yDesc, _dxDesc, _dyDesc;
@@ -26,4 +29,5 @@ protected:
 	size_t _bwdFilterWorkspaceSize;
 	size_t _maxWorkspaceSize;
 	float *d_workspace;	
+	CpuConvolution::Shape _cpu_shape;
 };
@@ -10,6 +10,7 @@ public:
 	int minNumInputs() { return 1; }
 	int minNumOutputs() { return 0; }	
 	std::string op_name() const override { return "display"; }
+	bool is_memoizable() override { return false; }
 	void init();	
 	void forward();
 	void backward();
@@ -2,12 +2,16 @@
 
 #include "core/node.h"
 
+#include <cstdint>
+#include <vector>
+
 class DeepFlowDllExport Dropout : public Node {
 public:
 	Dropout(deepflow::NodeParam *param);
 	int minNumInputs() { return 1; }
 	int minNumOutputs() { return 1; }	
 	std::string op_name() const override { return "dropout"; }
+	bool is_memoizable() override { return _context && _context->execution_mode == ExecutionContext::TEST; }
 	void init();	
 	void forward();
 	void backward();
@@ -20,4 +24,8 @@ private:
 	float _dropout;	
 	float *d_states;
 	float *d_reserve;
+	// Host keep mask of the last training forward, bit i % 32 of word i / 32, and its Philox stream.
+	std::vector<uint32_t> _mask;
+	uint64_t _seed = 0;
+	uint64_t _step = 0;
 };
\ No newline at end of file
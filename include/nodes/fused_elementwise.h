@@ -0,0 +1,22 @@
+#pragma once
+
+#include "core/node.h"
+#include "core/cpu_elementwise.h"
+
+// A chain of unary pointwise nodes merged by GraphFusion. Forward evaluates every stage per element
+// (per tile on the host), backward recomputes the intermediates from the input instead of storing them.
+class DeepFlowDllExport FusedElementwise : public Node {
+public:
+	// Longest chain one node takes, the stages travel by value as kernel arguments.
+	static const int kMaxStages = 8;
+	FusedElementwise(deepflow::NodeParam *param);
+	int minNumInputs() { return 1; }
+	int minNumOutputs() { return 1; }
+	std::string op_name() const override { return "fused_elementwise"; }
+	void init();
+	void forward();
+	void backward();
+	std::string to_cpp() const;
+private:
+	std::vector<CpuElementwise::PointwiseStage> _stages;
+};
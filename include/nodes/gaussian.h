@@ -3,6 +3,7 @@
 #include "core/node.h"
 
 #include <random>
+#include <vector>
 
 /*
 	input 0: mean
@@ -16,6 +17,7 @@ public:
 	int minNumInputs() override { return 2; }
 	int minNumOutputs() override { return 1; }
 	std::string op_name() const override { return "gaussian"; }
+	bool is_memoizable() override { return false; }
 	void init() override;
 	void forward() override;
 	void backward() override;
@@ -24,6 +26,7 @@ private:
 	std::random_device _random_device;
 	std::mt19937 _mt19937;
 	float *_normal = nullptr;
+	std::vector<float> _host_normal;
 	size_t _size;
 };
 
@@ -15,4 +15,6 @@ public:
 private:
 	cudnnLRNDescriptor_t _normDesc;
 	cudnnHandle_t _cudnnHandle;
+	// Host path keeps k + alpha / n * sum(x^2) of every element for backward.
+	std::vector<float> _scale;
 };
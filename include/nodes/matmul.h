@@ -1,13 +1,14 @@
 #pragma once
 
 #include "core/node.h"
+#include "core/cpu_gemm.h"
 
 #include <cublas_v2.h>
 
 class DeepFlowDllExport MatMul : public Node {
 public:
 	MatMul(deepflow::NodeParam *param);
-	int minNumInputs() { return 2; }
+	int minNumInputs() { return _param->matmul_param().epilogue().bias() ? 3 : 2; }
 	int minNumOutputs() { return 1; }
 	std::string op_name() const override { return "matmul"; }
 	void init();		
@@ -15,6 +16,7 @@ public:
 	void backward();
 	std::string to_cpp() const;
 private:	
+	bool has_epilogue() const;
 	cublasHandle_t _handle;
 	int _col_A, _row_A, _col_B, _row_B;	
 };
\ No newline at end of file
@@ -9,6 +9,7 @@ public:
 	int minNumInputs();
 	int minNumOutputs() { return 1; }
 	std::string op_name() const override { return "multiplexer"; }
+	bool is_memoizable() override { return false; }
 	void init();	
 	void forward();
 	void backward();	
@@ -18,6 +19,5 @@ public:
 	void selectInput(int input);
 private:
 	int _num_inputs = 0;
-	size_t _output_size_in_bytes = -1;
 	int _selected_input = -1;
 };
\ No newline at end of file
@@ -10,6 +10,7 @@ public:
 	int minNumInputs() override{ return 1; }
 	int minNumOutputs() override { return 1; }
 	std::string op_name() const override { return "patch_sampling"; }
+	bool is_memoizable() override { return false; }
 	void init() override;
 	void forward() override;
 	void backward() override;
@@ -15,4 +15,6 @@ public:
 private:
 	cudnnHandle_t _cudnnHandle;	
 	cudnnPoolingDescriptor_t _poolingDesc;
-};
\ No newline at end of file
+	// Host max pooling keeps the position of every maximum so backward is a scatter.
+	std::vector<int> _argmax;
+};
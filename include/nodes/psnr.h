@@ -23,4 +23,6 @@ private:
 	float *_d_workspace;
 	size_t _workspaceSizeInBytes;
 	float _psnr = -1;
+	// Host path keeps the input - target differences here.
+	std::vector<float> _error;
 };
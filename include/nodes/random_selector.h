@@ -9,6 +9,7 @@ public:
 	int minNumInputs() { return 2; }
 	int minNumOutputs() { return 1; }
 	std::string op_name() const override { return "random_selector"; }
+	bool is_memoizable() override { return false; }
 	void init();	
 	void forward();
 	void backward();
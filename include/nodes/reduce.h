@@ -21,4 +21,6 @@ private:
 	deepflow::ReduceParam::OutputType _type;
 	float *_d_workspace;
 	size_t _workspaceSizeInBytes;
-};
\ No newline at end of file
+	// Bit i is set when dim i is reduced.
+	int _axes = 0;
+};
@@ -0,0 +1,17 @@
+#pragma once
+
+#include "core/node.h"
+
+// Host copy of its input in the layout of the node, inserted by GraphLayout where producers and
+// consumers disagree. Backward reorders the diff back.
+class DeepFlowDllExport Reorder : public Node {
+public:
+	Reorder(deepflow::NodeParam *param);
+	int minNumInputs() override { return 1; }
+	int minNumOutputs() override { return 1; }
+	std::string op_name() const override { return "reorder"; }
+	void init() override;
+	void forward() override;
+	void backward() override;
+	std::string to_cpp() const override;
+};
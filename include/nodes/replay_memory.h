@@ -1,6 +1,9 @@
 #pragma once
 
 #include "core/node.h"
+#include "core/sum_tree.h"
+
+#include <vector>
 
 class DeepFlowDllExport ReplayMemory : public Node {
 public:
@@ -8,10 +11,18 @@ public:
 	int minNumInputs() { return 1; }
 	int minNumOutputs() { return 1; }
 	std::string op_name() const override { return "replay_memory"; }
+	bool is_memoizable() override { return false; }
 	void init();	
 	void forward();
 	void backward();
 	std::string to_cpp() const;
+	// Memory slots of the samples in the last output, in batch order (CPU only).
+	const std::vector<int> &sampled_slots() const;
+	// Prioritized mode: slot i is drawn with probability (|priority| + eps) ^ alpha over the total.
+	// Slots written later start at the largest priority seen so far.
+	void update_priorities(const std::vector<int> &slots, const std::vector<float> &priorities);
+	// Importance sampling weights (size * P(slot)) ^ -beta of the last output, scaled to a maximum of 1.
+	std::vector<float> importance_weights(float beta) const;
 private:
 	int _num_samples_per_batch = 0;
 	int _capacity = 0;	
@@ -21,4 +32,10 @@ private:
 	int _available_samples = 0;
 	int _size_per_sample = 0;
 	float *dev_memory;
+	std::vector<float> _memory;
+	std::vector<int> _sampled_slots;
+	bool _prioritized = false;
+	float _alpha = 0;
+	float _max_priority = 1.0f;
+	SumTree _priorities;
 };
@@ -5,14 +5,31 @@
 class DeepFlowDllExport Resize : public Node {
 public:
 	Resize(deepflow::NodeParam *param);
-	int minNumInputs() { return 1; }
+	int minNumInputs() { return _add ? 2 : 1; }
 	int minNumOutputs() { return 1; }
 	std::string op_name() const override { return "resize"; }
-	void init();	
+	void init();
 	void forward();
 	void backward();
+	void setAlpha(float alpha);
+	void setBeta(float beta);
 	std::string to_cpp() const;
+	// Host sampling of one axis. Output o reads inputs tap[2o] and tap[2o + 1] with tap_weight[2o] and
+	// tap_weight[2o + 1], input i gathers the gradients of outputs grad_output[grad_begin[i] .. grad_begin[i + 1]).
+	struct Axis {
+		std::vector<int> tap;
+		std::vector<float> tap_weight;
+		std::vector<int> grad_begin;
+		std::vector<int> grad_output;
+		std::vector<float> grad_weight;
+	};
 protected:
 	float m_height_scale = 1;
 	float m_width_scale = 1;
-};
\ No newline at end of file
+	deepflow::ResizeParam_Mode _mode = deepflow::ResizeParam_Mode_NEAREST;
+	bool _add = false;
+	float _alpha = 1.0f;
+	float _beta = 1.0f;
+	Axis _rows;
+	Axis _columns;
+};
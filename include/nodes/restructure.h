@@ -13,7 +13,9 @@ public:
 	void backward();
 	std::string to_cpp() const;
 private:
+	std::array<ptrdiff_t, 4> _strides() const;
 	cudnnHandle_t _cudnnHandle;
 	int _first_dim;
 	int _second_dim;
+	bool _view = false;
 };
\ No newline at end of file
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "core/node.h"
+
+class DeepFlowDllExport Slice : public Node {
+public:
+	Slice(deepflow::NodeParam *param);
+	int minNumInputs() { return 1; }
+	int minNumOutputs() { return 1; }
+	std::string op_name() const override { return "slice"; }
+	void init();
+	void forward();
+	void backward();
+	std::string to_cpp() const;
+private:
+	size_t _offset() const;
+	int _dim;
+	int _begin;
+	int _size;
+};
@@ -14,6 +14,8 @@ public:
 	void forward();
 	void backward();
 	std::string to_cpp() const;
+private:
+	void _cpu_shape(int *outer, int *channels, int *inner) const;
 private:
 	cudnnHandle_t _cudnnHandle;
 	cudnnSoftmaxMode_t _mode;
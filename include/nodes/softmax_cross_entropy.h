@@ -0,0 +1,30 @@
+#pragma once
+
+#include "core/node.h"
+
+#include <cudnn.h>
+
+// Softmax of the logits (input 0) fused with the cross entropy against the labels (input 1).
+// Output 0 is the cross entropy averaged over the softmax instances, output 1 the probabilities.
+// Backward writes alpha * (p - y), averaged like the loss, into the logits gradient without going
+// through the softmax Jacobian.
+class DeepFlowDllExport SoftmaxCrossEntropy : public Node {
+public:
+	SoftmaxCrossEntropy(deepflow::NodeParam *param);
+	int minNumInputs() { return 2; }
+	int minNumOutputs() { return 2; }
+	std::string op_name() const override { return "softmax_cross_entropy"; }
+	void init();
+	void forward();
+	void backward();
+	std::string to_cpp() const;
+	float loss() const;
+private:
+	cudnnHandle_t _cudnnHandle;
+	cudnnSoftmaxMode_t _mode;
+	int _outer = 0;
+	int _channels = 0;
+	int _inner = 0;
+	float _alpha = 1.0f;
+	std::vector<float> _log_sum;
+};
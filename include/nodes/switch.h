@@ -8,6 +8,7 @@ public:
 	int minNumInputs() { return 1; }
 	int minNumOutputs();
 	std::string op_name() const override { return "switcher"; }
+	bool is_memoizable() override { return false; }
 	std::list<std::shared_ptr<Node>> outputNodes() const;
 	std::list<std::shared_ptr<Node>> inputNodes() const;
 	void init();
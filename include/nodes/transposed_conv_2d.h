@@ -1,6 +1,7 @@
 #pragma once
 
 #include "core/node.h"
+#include "core/cpu_convolution.h"
 
 class DeepFlowDllExport TransposedConvolution2D : public Node {
 public:
@@ -24,4 +25,6 @@ private:
 	size_t _maxWorkspaceSize = 0;
 	size_t _bwdFilterWorkspaceSize = 0;
 	float *d_workspace;
+	// The transposed convolution as the cuDNN convolution it inverts: x is the output, y the input.
+	CpuConvolution::Shape _cpu_shape;
 };
\ No newline at end of file
@@ -16,12 +16,21 @@ public:
 	std::string op_name() const override { return "variable"; }
 	virtual void forward();
 	virtual void backward();
+	// The accumulated gradients, the diff itself when nothing accumulates across backward passes.
 	float * gradients();
 	void reset_gradients();
+	// Called by solvers once their kernels, which zero the gradients they read, have run.
+	void gradients_applied();
 	void prep_for_saving();
 	void clamp(float min, float max);
+	void map_weights(std::shared_ptr<Tensor> weights);
 	virtual std::string to_cpp() const;
 protected:		
+	bool _accumulates() const;
 	std::shared_ptr<Initializer> _initializer;
+	// Allocated by the first backward that accumulates, see ExecutionContext::fused_update. Host
+	// variables accumulate into _host_grad.
 	float * _grad = nullptr;
+	std::vector<float> _host_grad;
+	std::shared_ptr<Tensor> _mapped_weights;
 };
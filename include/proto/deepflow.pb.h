@@ -83,12 +83,24 @@ extern DotParamDefaultTypeInternal _DotParam_default_instance_;
 class DropoutParam;
 class DropoutParamDefaultTypeInternal;
 extern DropoutParamDefaultTypeInternal _DropoutParam_default_instance_;
+class EpilogueParam;
+class EpilogueParamDefaultTypeInternal;
+extern EpilogueParamDefaultTypeInternal _EpilogueParam_default_instance_;
 class EqualParam;
 class EqualParamDefaultTypeInternal;
 extern EqualParamDefaultTypeInternal _EqualParam_default_instance_;
 class ExpParam;
 class ExpParamDefaultTypeInternal;
 extern ExpParamDefaultTypeInternal _ExpParam_default_instance_;
+class FrozenParam;
+class FrozenParamDefaultTypeInternal;
+extern FrozenParamDefaultTypeInternal _FrozenParam_default_instance_;
+class FrozenParam_Output;
+class FrozenParam_OutputDefaultTypeInternal;
+extern FrozenParam_OutputDefaultTypeInternal _FrozenParam_Output_default_instance_;
+class FusedElementwiseParam;
+class FusedElementwiseParamDefaultTypeInternal;
+extern FusedElementwiseParamDefaultTypeInternal _FusedElementwiseParam_default_instance_;
 class GaborKernelParam;
 class GaborKernelParamDefaultTypeInternal;
 extern GaborKernelParamDefaultTypeInternal _GaborKernelParam_default_instance_;
@@ -191,6 +203,9 @@ extern PatchingParamDefaultTypeInternal _PatchingParam_default_instance_;
 class PlaceHolderParam;
 class PlaceHolderParamDefaultTypeInternal;
 extern PlaceHolderParamDefaultTypeInternal _PlaceHolderParam_default_instance_;
+class PointwiseStage;
+class PointwiseStageDefaultTypeInternal;
+extern PointwiseStageDefaultTypeInternal _PointwiseStage_default_instance_;
 class PoolingParam;
 class PoolingParamDefaultTypeInternal;
 extern PoolingParamDefaultTypeInternal _PoolingParam_default_instance_;
@@ -212,6 +227,9 @@ extern ReduceAllParamDefaultTypeInternal _ReduceAllParam_default_instance_;
 class ReduceParam;
 class ReduceParamDefaultTypeInternal;
 extern ReduceParamDefaultTypeInternal _ReduceParam_default_instance_;
+class ReorderParam;
+class ReorderParamDefaultTypeInternal;
+extern ReorderParamDefaultTypeInternal _ReorderParam_default_instance_;
 class ReplayMemoryParam;
 class ReplayMemoryParamDefaultTypeInternal;
 extern ReplayMemoryParamDefaultTypeInternal _ReplayMemoryParam_default_instance_;
@@ -230,9 +248,15 @@ extern SGDSolverParamDefaultTypeInternal _SGDSolverParam_default_instance_;
 class SIOOutputParam;
 class SIOOutputParamDefaultTypeInternal;
 extern SIOOutputParamDefaultTypeInternal _SIOOutputParam_default_instance_;
+class SliceParam;
+class SliceParamDefaultTypeInternal;
+extern SliceParamDefaultTypeInternal _SliceParam_default_instance_;
 class SnapshotParam;
 class SnapshotParamDefaultTypeInternal;
 extern SnapshotParamDefaultTypeInternal _SnapshotParam_default_instance_;
+class SoftmaxCrossEntropyParam;
+class SoftmaxCrossEntropyParamDefaultTypeInternal;
+extern SoftmaxCrossEntropyParamDefaultTypeInternal _SoftmaxCrossEntropyParam_default_instance_;
 class SoftmaxParam;
 class SoftmaxParamDefaultTypeInternal;
 extern SoftmaxParamDefaultTypeInternal _SoftmaxParam_default_instance_;
@@ -339,6 +363,58 @@ inline bool LossParam_ReduceOp_Parse(
   return ::google::protobuf::internal::ParseNamedEnum<LossParam_ReduceOp>(
     LossParam_ReduceOp_descriptor(), name, value);
 }
+enum PoolingParam_Mode {
+  PoolingParam_Mode_MAX = 0,
+  PoolingParam_Mode_AVERAGE_COUNT_INCLUDE_PADDING = 1,
+  PoolingParam_Mode_AVERAGE_COUNT_EXCLUDE_PADDING = 2,
+  PoolingParam_Mode_PoolingParam_Mode_INT_MIN_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32min,
+  PoolingParam_Mode_PoolingParam_Mode_INT_MAX_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32max
+};
+bool PoolingParam_Mode_IsValid(int value);
+const PoolingParam_Mode PoolingParam_Mode_Mode_MIN = PoolingParam_Mode_MAX;
+const PoolingParam_Mode PoolingParam_Mode_Mode_MAX = PoolingParam_Mode_AVERAGE_COUNT_EXCLUDE_PADDING;
+const int PoolingParam_Mode_Mode_ARRAYSIZE = PoolingParam_Mode_Mode_MAX + 1;
+
+const ::google::protobuf::EnumDescriptor* PoolingParam_Mode_descriptor();
+inline const ::std::string& PoolingParam_Mode_Name(PoolingParam_Mode value) {
+  return ::google::protobuf::internal::NameOfEnum(
+    PoolingParam_Mode_descriptor(), value);
+}
+inline bool PoolingParam_Mode_Parse(
+    const ::std::string& name, PoolingParam_Mode* value) {
+  return ::google::protobuf::internal::ParseNamedEnum<PoolingParam_Mode>(
+    PoolingParam_Mode_descriptor(), name, value);
+}
+enum PointwiseStage_Op {
+  PointwiseStage_Op_IDENTITY = 0,
+  PointwiseStage_Op_SIGMOID = 1,
+  PointwiseStage_Op_RELU = 2,
+  PointwiseStage_Op_TANH = 3,
+  PointwiseStage_Op_CLIPPED_RELU = 4,
+  PointwiseStage_Op_ELU = 5,
+  PointwiseStage_Op_LEAKY_RELU = 6,
+  PointwiseStage_Op_EXP = 7,
+  PointwiseStage_Op_LOG = 8,
+  PointwiseStage_Op_ABS = 9,
+  PointwiseStage_Op_SQUARE = 10,
+  PointwiseStage_Op_PointwiseStage_Op_INT_MIN_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32min,
+  PointwiseStage_Op_PointwiseStage_Op_INT_MAX_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32max
+};
+bool PointwiseStage_Op_IsValid(int value);
+const PointwiseStage_Op PointwiseStage_Op_Op_MIN = PointwiseStage_Op_IDENTITY;
+const PointwiseStage_Op PointwiseStage_Op_Op_MAX = PointwiseStage_Op_SQUARE;
+const int PointwiseStage_Op_Op_ARRAYSIZE = PointwiseStage_Op_Op_MAX + 1;
+
+const ::google::protobuf::EnumDescriptor* PointwiseStage_Op_descriptor();
+inline const ::std::string& PointwiseStage_Op_Name(PointwiseStage_Op value) {
+  return ::google::protobuf::internal::NameOfEnum(
+    PointwiseStage_Op_descriptor(), value);
+}
+inline bool PointwiseStage_Op_Parse(
+    const ::std::string& name, PointwiseStage_Op* value) {
+  return ::google::protobuf::internal::ParseNamedEnum<PointwiseStage_Op>(
+    PointwiseStage_Op_descriptor(), name, value);
+}
 enum ReduceAllParam_ReduceAllOp {
   ReduceAllParam_ReduceAllOp_SUM = 0,
   ReduceAllParam_ReduceAllOp_AVG = 1,
@@ -516,6 +592,27 @@ inline bool BatchNormalizationParam_Mode_Parse(
   return ::google::protobuf::internal::ParseNamedEnum<BatchNormalizationParam_Mode>(
     BatchNormalizationParam_Mode_descriptor(), name, value);
 }
+enum ResizeParam_Mode {
+  ResizeParam_Mode_NEAREST = 0,
+  ResizeParam_Mode_BILINEAR = 1,
+  ResizeParam_Mode_ResizeParam_Mode_INT_MIN_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32min,
+  ResizeParam_Mode_ResizeParam_Mode_INT_MAX_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32max
+};
+bool ResizeParam_Mode_IsValid(int value);
+const ResizeParam_Mode ResizeParam_Mode_Mode_MIN = ResizeParam_Mode_NEAREST;
+const ResizeParam_Mode ResizeParam_Mode_Mode_MAX = ResizeParam_Mode_BILINEAR;
+const int ResizeParam_Mode_Mode_ARRAYSIZE = ResizeParam_Mode_Mode_MAX + 1;
+
+const ::google::protobuf::EnumDescriptor* ResizeParam_Mode_descriptor();
+inline const ::std::string& ResizeParam_Mode_Name(ResizeParam_Mode value) {
+  return ::google::protobuf::internal::NameOfEnum(
+    ResizeParam_Mode_descriptor(), value);
+}
+inline bool ResizeParam_Mode_Parse(
+    const ::std::string& name, ResizeParam_Mode* value) {
+  return ::google::protobuf::internal::ParseNamedEnum<ResizeParam_Mode>(
+    ResizeParam_Mode_descriptor(), name, value);
+}
 enum SoftmaxParam_Mode {
   SoftmaxParam_Mode_INSTANCE = 0,
   SoftmaxParam_Mode_CHANNEL = 1,
@@ -587,12 +684,13 @@ enum NodeParam_DataPolicy {
   NodeParam_DataPolicy_GPU_ONLY_POLICY = 0,
   NodeParam_DataPolicy_GPU_WITH_CPU_OFFLOAD_POLICY = 1,
   NodeParam_DataPolicy_CUDA_MANAGED_POLICY = 2,
+  NodeParam_DataPolicy_CPU_ONLY_POLICY = 3,
   NodeParam_DataPolicy_NodeParam_DataPolicy_INT_MIN_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32min,
   NodeParam_DataPolicy_NodeParam_DataPolicy_INT_MAX_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32max
 };
 bool NodeParam_DataPolicy_IsValid(int value);
 const NodeParam_DataPolicy NodeParam_DataPolicy_DataPolicy_MIN = NodeParam_DataPolicy_GPU_ONLY_POLICY;
-const NodeParam_DataPolicy NodeParam_DataPolicy_DataPolicy_MAX = NodeParam_DataPolicy_CUDA_MANAGED_POLICY;
+const NodeParam_DataPolicy NodeParam_DataPolicy_DataPolicy_MAX = NodeParam_DataPolicy_CPU_ONLY_POLICY;
 const int NodeParam_DataPolicy_DataPolicy_ARRAYSIZE = NodeParam_DataPolicy_DataPolicy_MAX + 1;
 
 const ::google::protobuf::EnumDescriptor* NodeParam_DataPolicy_descriptor();
@@ -605,6 +703,28 @@ inline bool NodeParam_DataPolicy_Parse(
   return ::google::protobuf::internal::ParseNamedEnum<NodeParam_DataPolicy>(
     NodeParam_DataPolicy_descriptor(), name, value);
 }
+enum NodeParam_Layout {
+  NodeParam_Layout_NCHW = 0,
+  NodeParam_Layout_NHWC = 1,
+  NodeParam_Layout_NCHW16C = 2,
+  NodeParam_Layout_NodeParam_Layout_INT_MIN_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32min,
+  NodeParam_Layout_NodeParam_Layout_INT_MAX_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32max
+};
+bool NodeParam_Layout_IsValid(int value);
+const NodeParam_Layout NodeParam_Layout_Layout_MIN = NodeParam_Layout_NCHW;
+const NodeParam_Layout NodeParam_Layout_Layout_MAX = NodeParam_Layout_NCHW16C;
+const int NodeParam_Layout_Layout_ARRAYSIZE = NodeParam_Layout_Layout_MAX + 1;
+
+const ::google::protobuf::EnumDescriptor* NodeParam_Layout_descriptor();
+inline const ::std::string& NodeParam_Layout_Name(NodeParam_Layout value) {
+  return ::google::protobuf::internal::NameOfEnum(
+    NodeParam_Layout_descriptor(), value);
+}
+inline bool NodeParam_Layout_Parse(
+    const ::std::string& name, NodeParam_Layout* value) {
+  return ::google::protobuf::internal::ParseNamedEnum<NodeParam_Layout>(
+    NodeParam_Layout_descriptor(), name, value);
+}
 enum ActionType {
   VALUES = 0,
   DIFFS = 1,
@@ -2488,6 +2608,34 @@ class PoolingParam : public ::google::protobuf::Message /* @@protoc_insertion_po
 
   // nested types ----------------------------------------------------
 
+  typedef PoolingParam_Mode Mode;
+  static const Mode MAX =
+    PoolingParam_Mode_MAX;
+  static const Mode AVERAGE_COUNT_INCLUDE_PADDING =
+    PoolingParam_Mode_AVERAGE_COUNT_INCLUDE_PADDING;
+  static const Mode AVERAGE_COUNT_EXCLUDE_PADDING =
+    PoolingParam_Mode_AVERAGE_COUNT_EXCLUDE_PADDING;
+  static inline bool Mode_IsValid(int value) {
+    return PoolingParam_Mode_IsValid(value);
+  }
+  static const Mode Mode_MIN =
+    PoolingParam_Mode_Mode_MIN;
+  static const Mode Mode_MAX =
+    PoolingParam_Mode_Mode_MAX;
+  static const int Mode_ARRAYSIZE =
+    PoolingParam_Mode_Mode_ARRAYSIZE;
+  static inline const ::google::protobuf::EnumDescriptor*
+  Mode_descriptor() {
+    return PoolingParam_Mode_descriptor();
+  }
+  static inline const ::std::string& Mode_Name(Mode value) {
+    return PoolingParam_Mode_Name(value);
+  }
+  static inline bool Mode_Parse(const ::std::string& name,
+      Mode* value) {
+    return PoolingParam_Mode_Parse(name, value);
+  }
+
   // accessors -------------------------------------------------------
 
   // int32 window_h = 1;
@@ -2526,6 +2674,12 @@ class PoolingParam : public ::google::protobuf::Message /* @@protoc_insertion_po
   ::google::protobuf::int32 v_stride() const;
   void set_v_stride(::google::protobuf::int32 value);
 
+  // .deepflow.PoolingParam.Mode mode = 7;
+  void clear_mode();
+  static const int kModeFieldNumber = 7;
+  ::deepflow::PoolingParam_Mode mode() const;
+  void set_mode(::deepflow::PoolingParam_Mode value);
+
   // @@protoc_insertion_point(class_scope:deepflow.PoolingParam)
  private:
 
@@ -2536,6 +2690,7 @@ class PoolingParam : public ::google::protobuf::Message /* @@protoc_insertion_po
   ::google::protobuf::int32 v_pad_;
   ::google::protobuf::int32 h_stride_;
   ::google::protobuf::int32 v_stride_;
+  int mode_;
   mutable int _cached_size_;
   friend struct protobuf_deepflow_2eproto::TableStruct;
 };
@@ -2720,6 +2875,15 @@ class Conv2dParam : public ::google::protobuf::Message /* @@protoc_insertion_poi
 
   // accessors -------------------------------------------------------
 
+  // .deepflow.EpilogueParam epilogue = 7;
+  bool has_epilogue() const;
+  void clear_epilogue();
+  static const int kEpilogueFieldNumber = 7;
+  const ::deepflow::EpilogueParam& epilogue() const;
+  ::deepflow::EpilogueParam* mutable_epilogue();
+  ::deepflow::EpilogueParam* release_epilogue();
+  void set_allocated_epilogue(::deepflow::EpilogueParam* epilogue);
+
   // int32 pad_h = 1;
   void clear_pad_h();
   static const int kPadHFieldNumber = 1;
@@ -2760,6 +2924,7 @@ class Conv2dParam : public ::google::protobuf::Message /* @@protoc_insertion_poi
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  ::deepflow::EpilogueParam* epilogue_;
   ::google::protobuf::int32 pad_h_;
   ::google::protobuf::int32 pad_w_;
   ::google::protobuf::int32 u_;
@@ -2915,48 +3080,58 @@ class MatMulParam : public ::google::protobuf::Message /* @@protoc_insertion_poi
 
   // accessors -------------------------------------------------------
 
+  // .deepflow.EpilogueParam epilogue = 1;
+  bool has_epilogue() const;
+  void clear_epilogue();
+  static const int kEpilogueFieldNumber = 1;
+  const ::deepflow::EpilogueParam& epilogue() const;
+  ::deepflow::EpilogueParam* mutable_epilogue();
+  ::deepflow::EpilogueParam* release_epilogue();
+  void set_allocated_epilogue(::deepflow::EpilogueParam* epilogue);
+
   // @@protoc_insertion_point(class_scope:deepflow.MatMulParam)
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  ::deepflow::EpilogueParam* epilogue_;
   mutable int _cached_size_;
   friend struct protobuf_deepflow_2eproto::TableStruct;
 };
 // -------------------------------------------------------------------
 
-class LeakyReluParam : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:deepflow.LeakyReluParam) */ {
+class PointwiseStage : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:deepflow.PointwiseStage) */ {
  public:
-  LeakyReluParam();
-  virtual ~LeakyReluParam();
+  PointwiseStage();
+  virtual ~PointwiseStage();
 
-  LeakyReluParam(const LeakyReluParam& from);
+  PointwiseStage(const PointwiseStage& from);
 
-  inline LeakyReluParam& operator=(const LeakyReluParam& from) {
+  inline PointwiseStage& operator=(const PointwiseStage& from) {
     CopyFrom(from);
     return *this;
   }
 
   static const ::google::protobuf::Descriptor* descriptor();
-  static const LeakyReluParam& default_instance();
+  static const PointwiseStage& default_instance();
 
-  static inline const LeakyReluParam* internal_default_instance() {
-    return reinterpret_cast<const LeakyReluParam*>(
-               &_LeakyReluParam_default_instance_);
+  static inline const PointwiseStage* internal_default_instance() {
+    return reinterpret_cast<const PointwiseStage*>(
+               &_PointwiseStage_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
     25;
 
-  void Swap(LeakyReluParam* other);
+  void Swap(PointwiseStage* other);
 
   // implements Message ----------------------------------------------
 
-  inline LeakyReluParam* New() const PROTOBUF_FINAL { return New(NULL); }
+  inline PointwiseStage* New() const PROTOBUF_FINAL { return New(NULL); }
 
-  LeakyReluParam* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  PointwiseStage* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
   void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
   void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void CopyFrom(const LeakyReluParam& from);
-  void MergeFrom(const LeakyReluParam& from);
+  void CopyFrom(const PointwiseStage& from);
+  void MergeFrom(const PointwiseStage& from);
   void Clear() PROTOBUF_FINAL;
   bool IsInitialized() const PROTOBUF_FINAL;
 
@@ -2972,7 +3147,7 @@ class LeakyReluParam : public ::google::protobuf::Message /* @@protoc_insertion_
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
-  void InternalSwap(LeakyReluParam* other);
+  void InternalSwap(PointwiseStage* other);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
     return NULL;
@@ -2986,57 +3161,108 @@ class LeakyReluParam : public ::google::protobuf::Message /* @@protoc_insertion_
 
   // nested types ----------------------------------------------------
 
+  typedef PointwiseStage_Op Op;
+  static const Op IDENTITY =
+    PointwiseStage_Op_IDENTITY;
+  static const Op SIGMOID =
+    PointwiseStage_Op_SIGMOID;
+  static const Op RELU =
+    PointwiseStage_Op_RELU;
+  static const Op TANH =
+    PointwiseStage_Op_TANH;
+  static const Op CLIPPED_RELU =
+    PointwiseStage_Op_CLIPPED_RELU;
+  static const Op ELU =
+    PointwiseStage_Op_ELU;
+  static const Op LEAKY_RELU =
+    PointwiseStage_Op_LEAKY_RELU;
+  static const Op EXP =
+    PointwiseStage_Op_EXP;
+  static const Op LOG =
+    PointwiseStage_Op_LOG;
+  static const Op ABS =
+    PointwiseStage_Op_ABS;
+  static const Op SQUARE =
+    PointwiseStage_Op_SQUARE;
+  static inline bool Op_IsValid(int value) {
+    return PointwiseStage_Op_IsValid(value);
+  }
+  static const Op Op_MIN =
+    PointwiseStage_Op_Op_MIN;
+  static const Op Op_MAX =
+    PointwiseStage_Op_Op_MAX;
+  static const int Op_ARRAYSIZE =
+    PointwiseStage_Op_Op_ARRAYSIZE;
+  static inline const ::google::protobuf::EnumDescriptor*
+  Op_descriptor() {
+    return PointwiseStage_Op_descriptor();
+  }
+  static inline const ::std::string& Op_Name(Op value) {
+    return PointwiseStage_Op_Name(value);
+  }
+  static inline bool Op_Parse(const ::std::string& name,
+      Op* value) {
+    return PointwiseStage_Op_Parse(name, value);
+  }
+
   // accessors -------------------------------------------------------
 
-  // float negative_slope = 1;
-  void clear_negative_slope();
-  static const int kNegativeSlopeFieldNumber = 1;
-  float negative_slope() const;
-  void set_negative_slope(float value);
+  // .deepflow.PointwiseStage.Op op = 1;
+  void clear_op();
+  static const int kOpFieldNumber = 1;
+  ::deepflow::PointwiseStage_Op op() const;
+  void set_op(::deepflow::PointwiseStage_Op value);
 
-  // @@protoc_insertion_point(class_scope:deepflow.LeakyReluParam)
+  // float coef = 2;
+  void clear_coef();
+  static const int kCoefFieldNumber = 2;
+  float coef() const;
+  void set_coef(float value);
+
+  // @@protoc_insertion_point(class_scope:deepflow.PointwiseStage)
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  float negative_slope_;
+  int op_;
+  float coef_;
   mutable int _cached_size_;
   friend struct protobuf_deepflow_2eproto::TableStruct;
 };
 // -------------------------------------------------------------------
 
-class PReluParam : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:deepflow.PReluParam) */ {
+class EpilogueParam : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:deepflow.EpilogueParam) */ {
  public:
-  PReluParam();
-  virtual ~PReluParam();
+  EpilogueParam();
+  virtual ~EpilogueParam();
 
-  PReluParam(const PReluParam& from);
+  EpilogueParam(const EpilogueParam& from);
 
-  inline PReluParam& operator=(const PReluParam& from) {
+  inline EpilogueParam& operator=(const EpilogueParam& from) {
     CopyFrom(from);
     return *this;
   }
 
   static const ::google::protobuf::Descriptor* descriptor();
-  static const PReluParam& default_instance();
+  static const EpilogueParam& default_instance();
 
-  static inline const PReluParam* internal_default_instance() {
-    return reinterpret_cast<const PReluParam*>(
-               &_PReluParam_default_instance_);
+  static inline const EpilogueParam* internal_default_instance() {
+    return reinterpret_cast<const EpilogueParam*>(
+               &_EpilogueParam_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
     26;
 
-  void Swap(PReluParam* other);
+  void Swap(EpilogueParam* other);
 
   // implements Message ----------------------------------------------
 
-  inline PReluParam* New() const PROTOBUF_FINAL { return New(NULL); }
+  inline EpilogueParam* New() const PROTOBUF_FINAL { return New(NULL); }
 
-  PReluParam* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  EpilogueParam* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
   void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
   void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void CopyFrom(const PReluParam& from);
-  void MergeFrom(const PReluParam& from);
+  void CopyFrom(const EpilogueParam& from);
+  void MergeFrom(const EpilogueParam& from);
   void Clear() PROTOBUF_FINAL;
   bool IsInitialized() const PROTOBUF_FINAL;
 
@@ -3052,7 +3278,7 @@ class PReluParam : public ::google::protobuf::Message /* @@protoc_insertion_poin
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
-  void InternalSwap(PReluParam* other);
+  void InternalSwap(EpilogueParam* other);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
     return NULL;
@@ -3068,48 +3294,65 @@ class PReluParam : public ::google::protobuf::Message /* @@protoc_insertion_poin
 
   // accessors -------------------------------------------------------
 
-  // @@protoc_insertion_point(class_scope:deepflow.PReluParam)
+  // .deepflow.PointwiseStage activation = 2;
+  bool has_activation() const;
+  void clear_activation();
+  static const int kActivationFieldNumber = 2;
+  const ::deepflow::PointwiseStage& activation() const;
+  ::deepflow::PointwiseStage* mutable_activation();
+  ::deepflow::PointwiseStage* release_activation();
+  void set_allocated_activation(::deepflow::PointwiseStage* activation);
+
+  // bool bias = 1;
+  void clear_bias();
+  static const int kBiasFieldNumber = 1;
+  bool bias() const;
+  void set_bias(bool value);
+
+  // @@protoc_insertion_point(class_scope:deepflow.EpilogueParam)
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  ::deepflow::PointwiseStage* activation_;
+  bool bias_;
   mutable int _cached_size_;
   friend struct protobuf_deepflow_2eproto::TableStruct;
 };
 // -------------------------------------------------------------------
 
-class DPReluParam : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:deepflow.DPReluParam) */ {
+class FusedElementwiseParam : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:deepflow.FusedElementwiseParam) */ {
  public:
-  DPReluParam();
-  virtual ~DPReluParam();
+  FusedElementwiseParam();
+  virtual ~FusedElementwiseParam();
 
-  DPReluParam(const DPReluParam& from);
+  FusedElementwiseParam(const FusedElementwiseParam& from);
 
-  inline DPReluParam& operator=(const DPReluParam& from) {
+  inline FusedElementwiseParam& operator=(const FusedElementwiseParam& from) {
     CopyFrom(from);
     return *this;
   }
 
   static const ::google::protobuf::Descriptor* descriptor();
-  static const DPReluParam& default_instance();
+  static const FusedElementwiseParam& default_instance();
 
-  static inline const DPReluParam* internal_default_instance() {
-    return reinterpret_cast<const DPReluParam*>(
-               &_DPReluParam_default_instance_);
+  static inline const FusedElementwiseParam* internal_default_instance() {
+    return reinterpret_cast<const FusedElementwiseParam*>(
+               &_FusedElementwiseParam_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
     27;
 
-  void Swap(DPReluParam* other);
+  void Swap(FusedElementwiseParam* other);
 
   // implements Message ----------------------------------------------
 
-  inline DPReluParam* New() const PROTOBUF_FINAL { return New(NULL); }
+  inline FusedElementwiseParam* New() const PROTOBUF_FINAL { return New(NULL); }
 
-  DPReluParam* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  FusedElementwiseParam* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
   void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
   void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void CopyFrom(const DPReluParam& from);
-  void MergeFrom(const DPReluParam& from);
+  void CopyFrom(const FusedElementwiseParam& from);
+  void MergeFrom(const FusedElementwiseParam& from);
   void Clear() PROTOBUF_FINAL;
   bool IsInitialized() const PROTOBUF_FINAL;
 
@@ -3125,7 +3368,7 @@ class DPReluParam : public ::google::protobuf::Message /* @@protoc_insertion_poi
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
-  void InternalSwap(DPReluParam* other);
+  void InternalSwap(FusedElementwiseParam* other);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
     return NULL;
@@ -3141,55 +3384,61 @@ class DPReluParam : public ::google::protobuf::Message /* @@protoc_insertion_poi
 
   // accessors -------------------------------------------------------
 
-  // float negative_slope = 1;
-  void clear_negative_slope();
-  static const int kNegativeSlopeFieldNumber = 1;
-  float negative_slope() const;
-  void set_negative_slope(float value);
-
-  // @@protoc_insertion_point(class_scope:deepflow.DPReluParam)
+  // repeated .deepflow.PointwiseStage stage = 1;
+  int stage_size() const;
+  void clear_stage();
+  static const int kStageFieldNumber = 1;
+  const ::deepflow::PointwiseStage& stage(int index) const;
+  ::deepflow::PointwiseStage* mutable_stage(int index);
+  ::deepflow::PointwiseStage* add_stage();
+  ::google::protobuf::RepeatedPtrField< ::deepflow::PointwiseStage >*
+      mutable_stage();
+  const ::google::protobuf::RepeatedPtrField< ::deepflow::PointwiseStage >&
+      stage() const;
+
+  // @@protoc_insertion_point(class_scope:deepflow.FusedElementwiseParam)
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  float negative_slope_;
+  ::google::protobuf::RepeatedPtrField< ::deepflow::PointwiseStage > stage_;
   mutable int _cached_size_;
   friend struct protobuf_deepflow_2eproto::TableStruct;
 };
 // -------------------------------------------------------------------
 
-class ReduceAllParam : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:deepflow.ReduceAllParam) */ {
+class ReorderParam : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:deepflow.ReorderParam) */ {
  public:
-  ReduceAllParam();
-  virtual ~ReduceAllParam();
+  ReorderParam();
+  virtual ~ReorderParam();
 
-  ReduceAllParam(const ReduceAllParam& from);
+  ReorderParam(const ReorderParam& from);
 
-  inline ReduceAllParam& operator=(const ReduceAllParam& from) {
+  inline ReorderParam& operator=(const ReorderParam& from) {
     CopyFrom(from);
     return *this;
   }
 
   static const ::google::protobuf::Descriptor* descriptor();
-  static const ReduceAllParam& default_instance();
+  static const ReorderParam& default_instance();
 
-  static inline const ReduceAllParam* internal_default_instance() {
-    return reinterpret_cast<const ReduceAllParam*>(
-               &_ReduceAllParam_default_instance_);
+  static inline const ReorderParam* internal_default_instance() {
+    return reinterpret_cast<const ReorderParam*>(
+               &_ReorderParam_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
     28;
 
-  void Swap(ReduceAllParam* other);
+  void Swap(ReorderParam* other);
 
   // implements Message ----------------------------------------------
 
-  inline ReduceAllParam* New() const PROTOBUF_FINAL { return New(NULL); }
+  inline ReorderParam* New() const PROTOBUF_FINAL { return New(NULL); }
 
-  ReduceAllParam* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  ReorderParam* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
   void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
   void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void CopyFrom(const ReduceAllParam& from);
-  void MergeFrom(const ReduceAllParam& from);
+  void CopyFrom(const ReorderParam& from);
+  void MergeFrom(const ReorderParam& from);
   void Clear() PROTOBUF_FINAL;
   bool IsInitialized() const PROTOBUF_FINAL;
 
@@ -3205,7 +3454,7 @@ class ReduceAllParam : public ::google::protobuf::Message /* @@protoc_insertion_
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
-  void InternalSwap(ReduceAllParam* other);
+  void InternalSwap(ReorderParam* other);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
     return NULL;
@@ -3219,83 +3468,50 @@ class ReduceAllParam : public ::google::protobuf::Message /* @@protoc_insertion_
 
   // nested types ----------------------------------------------------
 
-  typedef ReduceAllParam_ReduceAllOp ReduceAllOp;
-  static const ReduceAllOp SUM =
-    ReduceAllParam_ReduceAllOp_SUM;
-  static const ReduceAllOp AVG =
-    ReduceAllParam_ReduceAllOp_AVG;
-  static inline bool ReduceAllOp_IsValid(int value) {
-    return ReduceAllParam_ReduceAllOp_IsValid(value);
-  }
-  static const ReduceAllOp ReduceAllOp_MIN =
-    ReduceAllParam_ReduceAllOp_ReduceAllOp_MIN;
-  static const ReduceAllOp ReduceAllOp_MAX =
-    ReduceAllParam_ReduceAllOp_ReduceAllOp_MAX;
-  static const int ReduceAllOp_ARRAYSIZE =
-    ReduceAllParam_ReduceAllOp_ReduceAllOp_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor*
-  ReduceAllOp_descriptor() {
-    return ReduceAllParam_ReduceAllOp_descriptor();
-  }
-  static inline const ::std::string& ReduceAllOp_Name(ReduceAllOp value) {
-    return ReduceAllParam_ReduceAllOp_Name(value);
-  }
-  static inline bool ReduceAllOp_Parse(const ::std::string& name,
-      ReduceAllOp* value) {
-    return ReduceAllParam_ReduceAllOp_Parse(name, value);
-  }
-
   // accessors -------------------------------------------------------
 
-  // .deepflow.ReduceAllParam.ReduceAllOp reduce_op = 1;
-  void clear_reduce_op();
-  static const int kReduceOpFieldNumber = 1;
-  ::deepflow::ReduceAllParam_ReduceAllOp reduce_op() const;
-  void set_reduce_op(::deepflow::ReduceAllParam_ReduceAllOp value);
-
-  // @@protoc_insertion_point(class_scope:deepflow.ReduceAllParam)
+  // @@protoc_insertion_point(class_scope:deepflow.ReorderParam)
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  int reduce_op_;
   mutable int _cached_size_;
   friend struct protobuf_deepflow_2eproto::TableStruct;
 };
 // -------------------------------------------------------------------
 
-class ReduceParam : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:deepflow.ReduceParam) */ {
+class SliceParam : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:deepflow.SliceParam) */ {
  public:
-  ReduceParam();
-  virtual ~ReduceParam();
+  SliceParam();
+  virtual ~SliceParam();
 
-  ReduceParam(const ReduceParam& from);
+  SliceParam(const SliceParam& from);
 
-  inline ReduceParam& operator=(const ReduceParam& from) {
+  inline SliceParam& operator=(const SliceParam& from) {
     CopyFrom(from);
     return *this;
   }
 
   static const ::google::protobuf::Descriptor* descriptor();
-  static const ReduceParam& default_instance();
+  static const SliceParam& default_instance();
 
-  static inline const ReduceParam* internal_default_instance() {
-    return reinterpret_cast<const ReduceParam*>(
-               &_ReduceParam_default_instance_);
+  static inline const SliceParam* internal_default_instance() {
+    return reinterpret_cast<const SliceParam*>(
+               &_SliceParam_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
     29;
 
-  void Swap(ReduceParam* other);
+  void Swap(SliceParam* other);
 
   // implements Message ----------------------------------------------
 
-  inline ReduceParam* New() const PROTOBUF_FINAL { return New(NULL); }
+  inline SliceParam* New() const PROTOBUF_FINAL { return New(NULL); }
 
-  ReduceParam* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  SliceParam* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
   void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
   void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void CopyFrom(const ReduceParam& from);
-  void MergeFrom(const ReduceParam& from);
+  void CopyFrom(const SliceParam& from);
+  void MergeFrom(const SliceParam& from);
   void Clear() PROTOBUF_FINAL;
   bool IsInitialized() const PROTOBUF_FINAL;
 
@@ -3311,7 +3527,7 @@ class ReduceParam : public ::google::protobuf::Message /* @@protoc_insertion_poi
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
-  void InternalSwap(ReduceParam* other);
+  void InternalSwap(SliceParam* other);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
     return NULL;
@@ -3325,86 +3541,531 @@ class ReduceParam : public ::google::protobuf::Message /* @@protoc_insertion_poi
 
   // nested types ----------------------------------------------------
 
-  typedef ReduceParam_ReduceOp ReduceOp;
-  static const ReduceOp ADD =
-    ReduceParam_ReduceOp_ADD;
-  static const ReduceOp MUL =
-    ReduceParam_ReduceOp_MUL;
-  static const ReduceOp MIN =
-    ReduceParam_ReduceOp_MIN;
-  static const ReduceOp MAX =
-    ReduceParam_ReduceOp_MAX;
-  static const ReduceOp AMAX =
-    ReduceParam_ReduceOp_AMAX;
-  static const ReduceOp AVG =
-    ReduceParam_ReduceOp_AVG;
-  static const ReduceOp NORM1 =
-    ReduceParam_ReduceOp_NORM1;
-  static const ReduceOp NORM2 =
-    ReduceParam_ReduceOp_NORM2;
-  static inline bool ReduceOp_IsValid(int value) {
-    return ReduceParam_ReduceOp_IsValid(value);
-  }
-  static const ReduceOp ReduceOp_MIN =
-    ReduceParam_ReduceOp_ReduceOp_MIN;
-  static const ReduceOp ReduceOp_MAX =
-    ReduceParam_ReduceOp_ReduceOp_MAX;
-  static const int ReduceOp_ARRAYSIZE =
-    ReduceParam_ReduceOp_ReduceOp_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor*
-  ReduceOp_descriptor() {
-    return ReduceParam_ReduceOp_descriptor();
-  }
-  static inline const ::std::string& ReduceOp_Name(ReduceOp value) {
-    return ReduceParam_ReduceOp_Name(value);
-  }
-  static inline bool ReduceOp_Parse(const ::std::string& name,
-      ReduceOp* value) {
-    return ReduceParam_ReduceOp_Parse(name, value);
-  }
-
-  typedef ReduceParam_OutputType OutputType;
-  static const OutputType VALUES =
-    ReduceParam_OutputType_VALUES;
-  static const OutputType INDICES =
-    ReduceParam_OutputType_INDICES;
-  static inline bool OutputType_IsValid(int value) {
-    return ReduceParam_OutputType_IsValid(value);
-  }
-  static const OutputType OutputType_MIN =
-    ReduceParam_OutputType_OutputType_MIN;
-  static const OutputType OutputType_MAX =
-    ReduceParam_OutputType_OutputType_MAX;
-  static const int OutputType_ARRAYSIZE =
-    ReduceParam_OutputType_OutputType_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor*
-  OutputType_descriptor() {
-    return ReduceParam_OutputType_descriptor();
-  }
-  static inline const ::std::string& OutputType_Name(OutputType value) {
-    return ReduceParam_OutputType_Name(value);
-  }
-  static inline bool OutputType_Parse(const ::std::string& name,
-      OutputType* value) {
-    return ReduceParam_OutputType_Parse(name, value);
-  }
-
   // accessors -------------------------------------------------------
 
-  // .deepflow.ReduceParam.ReduceOp reduce_op = 1;
-  void clear_reduce_op();
-  static const int kReduceOpFieldNumber = 1;
-  ::deepflow::ReduceParam_ReduceOp reduce_op() const;
-  void set_reduce_op(::deepflow::ReduceParam_ReduceOp value);
+  // int32 dim = 1;
+  void clear_dim();
+  static const int kDimFieldNumber = 1;
+  ::google::protobuf::int32 dim() const;
+  void set_dim(::google::protobuf::int32 value);
+
+  // int32 begin = 2;
+  void clear_begin();
+  static const int kBeginFieldNumber = 2;
+  ::google::protobuf::int32 begin() const;
+  void set_begin(::google::protobuf::int32 value);
+
+  // int32 size = 3;
+  void clear_size();
+  static const int kSizeFieldNumber = 3;
+  ::google::protobuf::int32 size() const;
+  void set_size(::google::protobuf::int32 value);
+
+  // @@protoc_insertion_point(class_scope:deepflow.SliceParam)
+ private:
 
-  // int32 reduce_dim = 2;
-  void clear_reduce_dim();
-  static const int kReduceDimFieldNumber = 2;
-  ::google::protobuf::int32 reduce_dim() const;
-  void set_reduce_dim(::google::protobuf::int32 value);
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  ::google::protobuf::int32 dim_;
+  ::google::protobuf::int32 begin_;
+  ::google::protobuf::int32 size_;
+  mutable int _cached_size_;
+  friend struct protobuf_deepflow_2eproto::TableStruct;
+};
+// -------------------------------------------------------------------
 
-  // .deepflow.ReduceParam.OutputType output_type = 3;
-  void clear_output_type();
+class LeakyReluParam : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:deepflow.LeakyReluParam) */ {
+ public:
+  LeakyReluParam();
+  virtual ~LeakyReluParam();
+
+  LeakyReluParam(const LeakyReluParam& from);
+
+  inline LeakyReluParam& operator=(const LeakyReluParam& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const LeakyReluParam& default_instance();
+
+  static inline const LeakyReluParam* internal_default_instance() {
+    return reinterpret_cast<const LeakyReluParam*>(
+               &_LeakyReluParam_default_instance_);
+  }
+  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+    30;
+
+  void Swap(LeakyReluParam* other);
+
+  // implements Message ----------------------------------------------
+
+  inline LeakyReluParam* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  LeakyReluParam* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void CopyFrom(const LeakyReluParam& from);
+  void MergeFrom(const LeakyReluParam& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void InternalSwap(LeakyReluParam* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // float negative_slope = 1;
+  void clear_negative_slope();
+  static const int kNegativeSlopeFieldNumber = 1;
+  float negative_slope() const;
+  void set_negative_slope(float value);
+
+  // @@protoc_insertion_point(class_scope:deepflow.LeakyReluParam)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  float negative_slope_;
+  mutable int _cached_size_;
+  friend struct protobuf_deepflow_2eproto::TableStruct;
+};
+// -------------------------------------------------------------------
+
+class PReluParam : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:deepflow.PReluParam) */ {
+ public:
+  PReluParam();
+  virtual ~PReluParam();
+
+  PReluParam(const PReluParam& from);
+
+  inline PReluParam& operator=(const PReluParam& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const PReluParam& default_instance();
+
+  static inline const PReluParam* internal_default_instance() {
+    return reinterpret_cast<const PReluParam*>(
+               &_PReluParam_default_instance_);
+  }
+  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+    31;
+
+  void Swap(PReluParam* other);
+
+  // implements Message ----------------------------------------------
+
+  inline PReluParam* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  PReluParam* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void CopyFrom(const PReluParam& from);
+  void MergeFrom(const PReluParam& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void InternalSwap(PReluParam* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:deepflow.PReluParam)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  mutable int _cached_size_;
+  friend struct protobuf_deepflow_2eproto::TableStruct;
+};
+// -------------------------------------------------------------------
+
+class DPReluParam : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:deepflow.DPReluParam) */ {
+ public:
+  DPReluParam();
+  virtual ~DPReluParam();
+
+  DPReluParam(const DPReluParam& from);
+
+  inline DPReluParam& operator=(const DPReluParam& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const DPReluParam& default_instance();
+
+  static inline const DPReluParam* internal_default_instance() {
+    return reinterpret_cast<const DPReluParam*>(
+               &_DPReluParam_default_instance_);
+  }
+  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+    32;
+
+  void Swap(DPReluParam* other);
+
+  // implements Message ----------------------------------------------
+
+  inline DPReluParam* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  DPReluParam* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void CopyFrom(const DPReluParam& from);
+  void MergeFrom(const DPReluParam& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void InternalSwap(DPReluParam* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // float negative_slope = 1;
+  void clear_negative_slope();
+  static const int kNegativeSlopeFieldNumber = 1;
+  float negative_slope() const;
+  void set_negative_slope(float value);
+
+  // @@protoc_insertion_point(class_scope:deepflow.DPReluParam)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  float negative_slope_;
+  mutable int _cached_size_;
+  friend struct protobuf_deepflow_2eproto::TableStruct;
+};
+// -------------------------------------------------------------------
+
+class ReduceAllParam : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:deepflow.ReduceAllParam) */ {
+ public:
+  ReduceAllParam();
+  virtual ~ReduceAllParam();
+
+  ReduceAllParam(const ReduceAllParam& from);
+
+  inline ReduceAllParam& operator=(const ReduceAllParam& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const ReduceAllParam& default_instance();
+
+  static inline const ReduceAllParam* internal_default_instance() {
+    return reinterpret_cast<const ReduceAllParam*>(
+               &_ReduceAllParam_default_instance_);
+  }
+  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+    33;
+
+  void Swap(ReduceAllParam* other);
+
+  // implements Message ----------------------------------------------
+
+  inline ReduceAllParam* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  ReduceAllParam* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void CopyFrom(const ReduceAllParam& from);
+  void MergeFrom(const ReduceAllParam& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void InternalSwap(ReduceAllParam* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  typedef ReduceAllParam_ReduceAllOp ReduceAllOp;
+  static const ReduceAllOp SUM =
+    ReduceAllParam_ReduceAllOp_SUM;
+  static const ReduceAllOp AVG =
+    ReduceAllParam_ReduceAllOp_AVG;
+  static inline bool ReduceAllOp_IsValid(int value) {
+    return ReduceAllParam_ReduceAllOp_IsValid(value);
+  }
+  static const ReduceAllOp ReduceAllOp_MIN =
+    ReduceAllParam_ReduceAllOp_ReduceAllOp_MIN;
+  static const ReduceAllOp ReduceAllOp_MAX =
+    ReduceAllParam_ReduceAllOp_ReduceAllOp_MAX;
+  static const int ReduceAllOp_ARRAYSIZE =
+    ReduceAllParam_ReduceAllOp_ReduceAllOp_ARRAYSIZE;
+  static inline const ::google::protobuf::EnumDescriptor*
+  ReduceAllOp_descriptor() {
+    return ReduceAllParam_ReduceAllOp_descriptor();
+  }
+  static inline const ::std::string& ReduceAllOp_Name(ReduceAllOp value) {
+    return ReduceAllParam_ReduceAllOp_Name(value);
+  }
+  static inline bool ReduceAllOp_Parse(const ::std::string& name,
+      ReduceAllOp* value) {
+    return ReduceAllParam_ReduceAllOp_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  // .deepflow.ReduceAllParam.ReduceAllOp reduce_op = 1;
+  void clear_reduce_op();
+  static const int kReduceOpFieldNumber = 1;
+  ::deepflow::ReduceAllParam_ReduceAllOp reduce_op() const;
+  void set_reduce_op(::deepflow::ReduceAllParam_ReduceAllOp value);
+
+  // @@protoc_insertion_point(class_scope:deepflow.ReduceAllParam)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  int reduce_op_;
+  mutable int _cached_size_;
+  friend struct protobuf_deepflow_2eproto::TableStruct;
+};
+// -------------------------------------------------------------------
+
+class ReduceParam : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:deepflow.ReduceParam) */ {
+ public:
+  ReduceParam();
+  virtual ~ReduceParam();
+
+  ReduceParam(const ReduceParam& from);
+
+  inline ReduceParam& operator=(const ReduceParam& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const ReduceParam& default_instance();
+
+  static inline const ReduceParam* internal_default_instance() {
+    return reinterpret_cast<const ReduceParam*>(
+               &_ReduceParam_default_instance_);
+  }
+  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+    34;
+
+  void Swap(ReduceParam* other);
+
+  // implements Message ----------------------------------------------
+
+  inline ReduceParam* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  ReduceParam* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void CopyFrom(const ReduceParam& from);
+  void MergeFrom(const ReduceParam& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void InternalSwap(ReduceParam* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  typedef ReduceParam_ReduceOp ReduceOp;
+  static const ReduceOp ADD =
+    ReduceParam_ReduceOp_ADD;
+  static const ReduceOp MUL =
+    ReduceParam_ReduceOp_MUL;
+  static const ReduceOp MIN =
+    ReduceParam_ReduceOp_MIN;
+  static const ReduceOp MAX =
+    ReduceParam_ReduceOp_MAX;
+  static const ReduceOp AMAX =
+    ReduceParam_ReduceOp_AMAX;
+  static const ReduceOp AVG =
+    ReduceParam_ReduceOp_AVG;
+  static const ReduceOp NORM1 =
+    ReduceParam_ReduceOp_NORM1;
+  static const ReduceOp NORM2 =
+    ReduceParam_ReduceOp_NORM2;
+  static inline bool ReduceOp_IsValid(int value) {
+    return ReduceParam_ReduceOp_IsValid(value);
+  }
+  static const ReduceOp ReduceOp_MIN =
+    ReduceParam_ReduceOp_ReduceOp_MIN;
+  static const ReduceOp ReduceOp_MAX =
+    ReduceParam_ReduceOp_ReduceOp_MAX;
+  static const int ReduceOp_ARRAYSIZE =
+    ReduceParam_ReduceOp_ReduceOp_ARRAYSIZE;
+  static inline const ::google::protobuf::EnumDescriptor*
+  ReduceOp_descriptor() {
+    return ReduceParam_ReduceOp_descriptor();
+  }
+  static inline const ::std::string& ReduceOp_Name(ReduceOp value) {
+    return ReduceParam_ReduceOp_Name(value);
+  }
+  static inline bool ReduceOp_Parse(const ::std::string& name,
+      ReduceOp* value) {
+    return ReduceParam_ReduceOp_Parse(name, value);
+  }
+
+  typedef ReduceParam_OutputType OutputType;
+  static const OutputType VALUES =
+    ReduceParam_OutputType_VALUES;
+  static const OutputType INDICES =
+    ReduceParam_OutputType_INDICES;
+  static inline bool OutputType_IsValid(int value) {
+    return ReduceParam_OutputType_IsValid(value);
+  }
+  static const OutputType OutputType_MIN =
+    ReduceParam_OutputType_OutputType_MIN;
+  static const OutputType OutputType_MAX =
+    ReduceParam_OutputType_OutputType_MAX;
+  static const int OutputType_ARRAYSIZE =
+    ReduceParam_OutputType_OutputType_ARRAYSIZE;
+  static inline const ::google::protobuf::EnumDescriptor*
+  OutputType_descriptor() {
+    return ReduceParam_OutputType_descriptor();
+  }
+  static inline const ::std::string& OutputType_Name(OutputType value) {
+    return ReduceParam_OutputType_Name(value);
+  }
+  static inline bool OutputType_Parse(const ::std::string& name,
+      OutputType* value) {
+    return ReduceParam_OutputType_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  // repeated int32 reduce_dims = 4;
+  int reduce_dims_size() const;
+  void clear_reduce_dims();
+  static const int kReduceDimsFieldNumber = 4;
+  ::google::protobuf::int32 reduce_dims(int index) const;
+  void set_reduce_dims(int index, ::google::protobuf::int32 value);
+  void add_reduce_dims(::google::protobuf::int32 value);
+  const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+      reduce_dims() const;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+      mutable_reduce_dims();
+
+  // .deepflow.ReduceParam.ReduceOp reduce_op = 1;
+  void clear_reduce_op();
+  static const int kReduceOpFieldNumber = 1;
+  ::deepflow::ReduceParam_ReduceOp reduce_op() const;
+  void set_reduce_op(::deepflow::ReduceParam_ReduceOp value);
+
+  // int32 reduce_dim = 2;
+  void clear_reduce_dim();
+  static const int kReduceDimFieldNumber = 2;
+  ::google::protobuf::int32 reduce_dim() const;
+  void set_reduce_dim(::google::protobuf::int32 value);
+
+  // .deepflow.ReduceParam.OutputType output_type = 3;
+  void clear_output_type();
   static const int kOutputTypeFieldNumber = 3;
   ::deepflow::ReduceParam_OutputType output_type() const;
   void set_output_type(::deepflow::ReduceParam_OutputType value);
@@ -3413,6 +4074,8 @@ class ReduceParam : public ::google::protobuf::Message /* @@protoc_insertion_poi
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int32 > reduce_dims_;
+  mutable int _reduce_dims_cached_byte_size_;
   int reduce_op_;
   ::google::protobuf::int32 reduce_dim_;
   int output_type_;
@@ -3441,7 +4104,7 @@ class SnapshotParam : public ::google::protobuf::Message /* @@protoc_insertion_p
                &_SnapshotParam_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    30;
+    35;
 
   void Swap(SnapshotParam* other);
 
@@ -3550,7 +4213,7 @@ class PlaceHolderParam : public ::google::protobuf::Message /* @@protoc_insertio
                &_PlaceHolderParam_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    31;
+    36;
 
   void Swap(PlaceHolderParam* other);
 
@@ -3633,7 +4296,7 @@ class RestructureParam : public ::google::protobuf::Message /* @@protoc_insertio
                &_RestructureParam_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    32;
+    37;
 
   void Swap(RestructureParam* other);
 
@@ -3720,7 +4383,7 @@ class VariableParam : public ::google::protobuf::Message /* @@protoc_insertion_p
                &_VariableParam_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    33;
+    38;
 
   void Swap(VariableParam* other);
 
@@ -3828,7 +4491,7 @@ class DataGeneratorParam : public ::google::protobuf::Message /* @@protoc_insert
                &_DataGeneratorParam_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    34;
+    39;
 
   void Swap(DataGeneratorParam* other);
 
@@ -3908,7 +4571,7 @@ class ActivationParam : public ::google::protobuf::Message /* @@protoc_insertion
                &_ActivationParam_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    35;
+    40;
 
   void Swap(ActivationParam* other);
 
@@ -4027,7 +4690,7 @@ class ImageBatchReaderParam : public ::google::protobuf::Message /* @@protoc_ins
                &_ImageBatchReaderParam_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    36;
+    41;
 
   void Swap(ImageBatchReaderParam* other);
 
@@ -4139,7 +4802,7 @@ class ImageReaderParam : public ::google::protobuf::Message /* @@protoc_insertio
                &_ImageReaderParam_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    37;
+    42;
 
   void Swap(ImageReaderParam* other);
 
@@ -4260,7 +4923,7 @@ class MnistParam : public ::google::protobuf::Message /* @@protoc_insertion_poin
                &_MnistParam_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    38;
+    43;
 
   void Swap(MnistParam* other);
 
@@ -4421,7 +5084,7 @@ class InstanceNormalizationParam : public ::google::protobuf::Message /* @@proto
                &_InstanceNormalizationParam_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    39;
+    44;
 
   void Swap(InstanceNormalizationParam* other);
 
@@ -4501,7 +5164,7 @@ class BatchNormalizationParam : public ::google::protobuf::Message /* @@protoc_i
                &_BatchNormalizationParam_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    40;
+    45;
 
   void Swap(BatchNormalizationParam* other);
 
@@ -4648,7 +5311,7 @@ class ReplayMemoryParam : public ::google::protobuf::Message /* @@protoc_inserti
                &_ReplayMemoryParam_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    41;
+    46;
 
   void Swap(ReplayMemoryParam* other);
 
@@ -4698,11 +5361,25 @@ class ReplayMemoryParam : public ::google::protobuf::Message /* @@protoc_inserti
   ::google::protobuf::int32 capacity() const;
   void set_capacity(::google::protobuf::int32 value);
 
+  // bool prioritized = 2;
+  void clear_prioritized();
+  static const int kPrioritizedFieldNumber = 2;
+  bool prioritized() const;
+  void set_prioritized(bool value);
+
+  // float alpha = 3;
+  void clear_alpha();
+  static const int kAlphaFieldNumber = 3;
+  float alpha() const;
+  void set_alpha(float value);
+
   // @@protoc_insertion_point(class_scope:deepflow.ReplayMemoryParam)
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
   ::google::protobuf::int32 capacity_;
+  bool prioritized_;
+  float alpha_;
   mutable int _cached_size_;
   friend struct protobuf_deepflow_2eproto::TableStruct;
 };
@@ -4728,7 +5405,7 @@ class LrnParam : public ::google::protobuf::Message /* @@protoc_insertion_point(
                &_LrnParam_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    42;
+    47;
 
   void Swap(LrnParam* other);
 
@@ -4829,7 +5506,7 @@ class ResizeParam : public ::google::protobuf::Message /* @@protoc_insertion_poi
                &_ResizeParam_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    43;
+    48;
 
   void Swap(ResizeParam* other);
 
@@ -4871,6 +5548,32 @@ class ResizeParam : public ::google::protobuf::Message /* @@protoc_insertion_poi
 
   // nested types ----------------------------------------------------
 
+  typedef ResizeParam_Mode Mode;
+  static const Mode NEAREST =
+    ResizeParam_Mode_NEAREST;
+  static const Mode BILINEAR =
+    ResizeParam_Mode_BILINEAR;
+  static inline bool Mode_IsValid(int value) {
+    return ResizeParam_Mode_IsValid(value);
+  }
+  static const Mode Mode_MIN =
+    ResizeParam_Mode_Mode_MIN;
+  static const Mode Mode_MAX =
+    ResizeParam_Mode_Mode_MAX;
+  static const int Mode_ARRAYSIZE =
+    ResizeParam_Mode_Mode_ARRAYSIZE;
+  static inline const ::google::protobuf::EnumDescriptor*
+  Mode_descriptor() {
+    return ResizeParam_Mode_descriptor();
+  }
+  static inline const ::std::string& Mode_Name(Mode value) {
+    return ResizeParam_Mode_Name(value);
+  }
+  static inline bool Mode_Parse(const ::std::string& name,
+      Mode* value) {
+    return ResizeParam_Mode_Parse(name, value);
+  }
+
   // accessors -------------------------------------------------------
 
   // float height_scale = 1;
@@ -4885,12 +5588,40 @@ class ResizeParam : public ::google::protobuf::Message /* @@protoc_insertion_poi
   float width_scale() const;
   void set_width_scale(float value);
 
+  // .deepflow.ResizeParam.Mode mode = 3;
+  void clear_mode();
+  static const int kModeFieldNumber = 3;
+  ::deepflow::ResizeParam_Mode mode() const;
+  void set_mode(::deepflow::ResizeParam_Mode value);
+
+  // bool add = 4;
+  void clear_add();
+  static const int kAddFieldNumber = 4;
+  bool add() const;
+  void set_add(bool value);
+
+  // float alpha = 5;
+  void clear_alpha();
+  static const int kAlphaFieldNumber = 5;
+  float alpha() const;
+  void set_alpha(float value);
+
+  // float beta = 6;
+  void clear_beta();
+  static const int kBetaFieldNumber = 6;
+  float beta() const;
+  void set_beta(float value);
+
   // @@protoc_insertion_point(class_scope:deepflow.ResizeParam)
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
   float height_scale_;
   float width_scale_;
+  int mode_;
+  bool add_;
+  float alpha_;
+  float beta_;
   mutable int _cached_size_;
   friend struct protobuf_deepflow_2eproto::TableStruct;
 };
@@ -4916,7 +5647,7 @@ class SquareParam : public ::google::protobuf::Message /* @@protoc_insertion_poi
                &_SquareParam_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    44;
+    49;
 
   void Swap(SquareParam* other);
 
@@ -4989,7 +5720,7 @@ class AbsParam : public ::google::protobuf::Message /* @@protoc_insertion_point(
                &_AbsParam_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    45;
+    50;
 
   void Swap(AbsParam* other);
 
@@ -5062,7 +5793,7 @@ class SquareErrorParam : public ::google::protobuf::Message /* @@protoc_insertio
                &_SquareErrorParam_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    46;
+    51;
 
   void Swap(SquareErrorParam* other);
 
@@ -5106,48 +5837,154 @@ class SquareErrorParam : public ::google::protobuf::Message /* @@protoc_insertio
 
   // accessors -------------------------------------------------------
 
-  // @@protoc_insertion_point(class_scope:deepflow.SquareErrorParam)
+  // @@protoc_insertion_point(class_scope:deepflow.SquareErrorParam)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  mutable int _cached_size_;
+  friend struct protobuf_deepflow_2eproto::TableStruct;
+};
+// -------------------------------------------------------------------
+
+class SoftmaxParam : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:deepflow.SoftmaxParam) */ {
+ public:
+  SoftmaxParam();
+  virtual ~SoftmaxParam();
+
+  SoftmaxParam(const SoftmaxParam& from);
+
+  inline SoftmaxParam& operator=(const SoftmaxParam& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const SoftmaxParam& default_instance();
+
+  static inline const SoftmaxParam* internal_default_instance() {
+    return reinterpret_cast<const SoftmaxParam*>(
+               &_SoftmaxParam_default_instance_);
+  }
+  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+    52;
+
+  void Swap(SoftmaxParam* other);
+
+  // implements Message ----------------------------------------------
+
+  inline SoftmaxParam* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  SoftmaxParam* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void CopyFrom(const SoftmaxParam& from);
+  void MergeFrom(const SoftmaxParam& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void InternalSwap(SoftmaxParam* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  typedef SoftmaxParam_Mode Mode;
+  static const Mode INSTANCE =
+    SoftmaxParam_Mode_INSTANCE;
+  static const Mode CHANNEL =
+    SoftmaxParam_Mode_CHANNEL;
+  static inline bool Mode_IsValid(int value) {
+    return SoftmaxParam_Mode_IsValid(value);
+  }
+  static const Mode Mode_MIN =
+    SoftmaxParam_Mode_Mode_MIN;
+  static const Mode Mode_MAX =
+    SoftmaxParam_Mode_Mode_MAX;
+  static const int Mode_ARRAYSIZE =
+    SoftmaxParam_Mode_Mode_ARRAYSIZE;
+  static inline const ::google::protobuf::EnumDescriptor*
+  Mode_descriptor() {
+    return SoftmaxParam_Mode_descriptor();
+  }
+  static inline const ::std::string& Mode_Name(Mode value) {
+    return SoftmaxParam_Mode_Name(value);
+  }
+  static inline bool Mode_Parse(const ::std::string& name,
+      Mode* value) {
+    return SoftmaxParam_Mode_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  // .deepflow.SoftmaxParam.Mode mode = 1;
+  void clear_mode();
+  static const int kModeFieldNumber = 1;
+  ::deepflow::SoftmaxParam_Mode mode() const;
+  void set_mode(::deepflow::SoftmaxParam_Mode value);
+
+  // @@protoc_insertion_point(class_scope:deepflow.SoftmaxParam)
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  int mode_;
   mutable int _cached_size_;
   friend struct protobuf_deepflow_2eproto::TableStruct;
 };
 // -------------------------------------------------------------------
 
-class SoftmaxParam : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:deepflow.SoftmaxParam) */ {
+class SoftmaxCrossEntropyParam : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:deepflow.SoftmaxCrossEntropyParam) */ {
  public:
-  SoftmaxParam();
-  virtual ~SoftmaxParam();
+  SoftmaxCrossEntropyParam();
+  virtual ~SoftmaxCrossEntropyParam();
 
-  SoftmaxParam(const SoftmaxParam& from);
+  SoftmaxCrossEntropyParam(const SoftmaxCrossEntropyParam& from);
 
-  inline SoftmaxParam& operator=(const SoftmaxParam& from) {
+  inline SoftmaxCrossEntropyParam& operator=(const SoftmaxCrossEntropyParam& from) {
     CopyFrom(from);
     return *this;
   }
 
   static const ::google::protobuf::Descriptor* descriptor();
-  static const SoftmaxParam& default_instance();
+  static const SoftmaxCrossEntropyParam& default_instance();
 
-  static inline const SoftmaxParam* internal_default_instance() {
-    return reinterpret_cast<const SoftmaxParam*>(
-               &_SoftmaxParam_default_instance_);
+  static inline const SoftmaxCrossEntropyParam* internal_default_instance() {
+    return reinterpret_cast<const SoftmaxCrossEntropyParam*>(
+               &_SoftmaxCrossEntropyParam_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    47;
+    53;
 
-  void Swap(SoftmaxParam* other);
+  void Swap(SoftmaxCrossEntropyParam* other);
 
   // implements Message ----------------------------------------------
 
-  inline SoftmaxParam* New() const PROTOBUF_FINAL { return New(NULL); }
+  inline SoftmaxCrossEntropyParam* New() const PROTOBUF_FINAL { return New(NULL); }
 
-  SoftmaxParam* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  SoftmaxCrossEntropyParam* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
   void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
   void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void CopyFrom(const SoftmaxParam& from);
-  void MergeFrom(const SoftmaxParam& from);
+  void CopyFrom(const SoftmaxCrossEntropyParam& from);
+  void MergeFrom(const SoftmaxCrossEntropyParam& from);
   void Clear() PROTOBUF_FINAL;
   bool IsInitialized() const PROTOBUF_FINAL;
 
@@ -5163,7 +6000,7 @@ class SoftmaxParam : public ::google::protobuf::Message /* @@protoc_insertion_po
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
-  void InternalSwap(SoftmaxParam* other);
+  void InternalSwap(SoftmaxCrossEntropyParam* other);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
     return NULL;
@@ -5177,32 +6014,6 @@ class SoftmaxParam : public ::google::protobuf::Message /* @@protoc_insertion_po
 
   // nested types ----------------------------------------------------
 
-  typedef SoftmaxParam_Mode Mode;
-  static const Mode INSTANCE =
-    SoftmaxParam_Mode_INSTANCE;
-  static const Mode CHANNEL =
-    SoftmaxParam_Mode_CHANNEL;
-  static inline bool Mode_IsValid(int value) {
-    return SoftmaxParam_Mode_IsValid(value);
-  }
-  static const Mode Mode_MIN =
-    SoftmaxParam_Mode_Mode_MIN;
-  static const Mode Mode_MAX =
-    SoftmaxParam_Mode_Mode_MAX;
-  static const int Mode_ARRAYSIZE =
-    SoftmaxParam_Mode_Mode_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor*
-  Mode_descriptor() {
-    return SoftmaxParam_Mode_descriptor();
-  }
-  static inline const ::std::string& Mode_Name(Mode value) {
-    return SoftmaxParam_Mode_Name(value);
-  }
-  static inline bool Mode_Parse(const ::std::string& name,
-      Mode* value) {
-    return SoftmaxParam_Mode_Parse(name, value);
-  }
-
   // accessors -------------------------------------------------------
 
   // .deepflow.SoftmaxParam.Mode mode = 1;
@@ -5211,11 +6022,18 @@ class SoftmaxParam : public ::google::protobuf::Message /* @@protoc_insertion_po
   ::deepflow::SoftmaxParam_Mode mode() const;
   void set_mode(::deepflow::SoftmaxParam_Mode value);
 
-  // @@protoc_insertion_point(class_scope:deepflow.SoftmaxParam)
+  // float alpha = 2;
+  void clear_alpha();
+  static const int kAlphaFieldNumber = 2;
+  float alpha() const;
+  void set_alpha(float value);
+
+  // @@protoc_insertion_point(class_scope:deepflow.SoftmaxCrossEntropyParam)
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
   int mode_;
+  float alpha_;
   mutable int _cached_size_;
   friend struct protobuf_deepflow_2eproto::TableStruct;
 };
@@ -5241,7 +6059,7 @@ class PatchingParam : public ::google::protobuf::Message /* @@protoc_insertion_p
                &_PatchingParam_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    48;
+    54;
 
   void Swap(PatchingParam* other);
 
@@ -5365,7 +6183,7 @@ class LiftingParam : public ::google::protobuf::Message /* @@protoc_insertion_po
                &_LiftingParam_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    49;
+    55;
 
   void Swap(LiftingParam* other);
 
@@ -5475,7 +6293,7 @@ class InitFillParam : public ::google::protobuf::Message /* @@protoc_insertion_p
                &_InitFillParam_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    50;
+    56;
 
   void Swap(InitFillParam* other);
 
@@ -5555,7 +6373,7 @@ class InitIndexFillParam : public ::google::protobuf::Message /* @@protoc_insert
                &_InitIndexFillParam_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    51;
+    57;
 
   void Swap(InitIndexFillParam* other);
 
@@ -5635,7 +6453,7 @@ class InitGradientFillParam : public ::google::protobuf::Message /* @@protoc_ins
                &_InitGradientFillParam_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    52;
+    58;
 
   void Swap(InitGradientFillParam* other);
 
@@ -5708,7 +6526,7 @@ class InitRandomUniformParam : public ::google::protobuf::Message /* @@protoc_in
                &_InitRandomUniformParam_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    53;
+    59;
 
   void Swap(InitRandomUniformParam* other);
 
@@ -5795,7 +6613,7 @@ class InitRandomNormalParam : public ::google::protobuf::Message /* @@protoc_ins
                &_InitRandomNormalParam_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    54;
+    60;
 
   void Swap(InitRandomNormalParam* other);
 
@@ -5882,7 +6700,7 @@ class InitTruncatedNormalParam : public ::google::protobuf::Message /* @@protoc_
                &_InitTruncatedNormalParam_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    55;
+    61;
 
   void Swap(InitTruncatedNormalParam* other);
 
@@ -5969,7 +6787,7 @@ class InitStepParam : public ::google::protobuf::Message /* @@protoc_insertion_p
                &_InitStepParam_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    56;
+    62;
 
   void Swap(InitStepParam* other);
 
@@ -6056,7 +6874,7 @@ class InitThreeStateParam : public ::google::protobuf::Message /* @@protoc_inser
                &_InitThreeStateParam_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    57;
+    63;
 
   void Swap(InitThreeStateParam* other);
 
@@ -6129,7 +6947,7 @@ class InitConstantParam : public ::google::protobuf::Message /* @@protoc_inserti
                &_InitConstantParam_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    58;
+    64;
 
   void Swap(InitConstantParam* other);
 
@@ -6216,7 +7034,7 @@ class InitParam : public ::google::protobuf::Message /* @@protoc_insertion_point
                &_InitParam_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    59;
+    65;
 
   void Swap(InitParam* other);
 
@@ -6414,7 +7232,7 @@ class SGDSolverParam : public ::google::protobuf::Message /* @@protoc_insertion_
                &_SGDSolverParam_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    60;
+    66;
 
   void Swap(SGDSolverParam* other);
 
@@ -6494,7 +7312,7 @@ class AdaDeltaSolverParam : public ::google::protobuf::Message /* @@protoc_inser
                &_AdaDeltaSolverParam_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    61;
+    67;
 
   void Swap(AdaDeltaSolverParam* other);
 
@@ -6581,7 +7399,7 @@ class AdamSolverParam : public ::google::protobuf::Message /* @@protoc_insertion
                &_AdamSolverParam_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    62;
+    68;
 
   void Swap(AdamSolverParam* other);
 
@@ -6675,7 +7493,7 @@ class RMSPropSolverParam : public ::google::protobuf::Message /* @@protoc_insert
                &_RMSPropSolverParam_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    63;
+    69;
 
   void Swap(RMSPropSolverParam* other);
 
@@ -6762,7 +7580,7 @@ class SolverParam : public ::google::protobuf::Message /* @@protoc_insertion_poi
                &_SolverParam_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    64;
+    70;
 
   void Swap(SolverParam* other);
 
@@ -6852,41 +7670,290 @@ class SolverParam : public ::google::protobuf::Message /* @@protoc_insertion_poi
   ::deepflow::AdamSolverParam* release_adam_solver();
   void set_allocated_adam_solver(::deepflow::AdamSolverParam* adam_solver);
 
-  // .deepflow.AdaDeltaSolverParam adadelta_solver = 6;
-  bool has_adadelta_solver() const;
-  void clear_adadelta_solver();
-  static const int kAdadeltaSolverFieldNumber = 6;
-  const ::deepflow::AdaDeltaSolverParam& adadelta_solver() const;
-  ::deepflow::AdaDeltaSolverParam* mutable_adadelta_solver();
-  ::deepflow::AdaDeltaSolverParam* release_adadelta_solver();
-  void set_allocated_adadelta_solver(::deepflow::AdaDeltaSolverParam* adadelta_solver);
+  // .deepflow.AdaDeltaSolverParam adadelta_solver = 6;
+  bool has_adadelta_solver() const;
+  void clear_adadelta_solver();
+  static const int kAdadeltaSolverFieldNumber = 6;
+  const ::deepflow::AdaDeltaSolverParam& adadelta_solver() const;
+  ::deepflow::AdaDeltaSolverParam* mutable_adadelta_solver();
+  ::deepflow::AdaDeltaSolverParam* release_adadelta_solver();
+  void set_allocated_adadelta_solver(::deepflow::AdaDeltaSolverParam* adadelta_solver);
+
+  // .deepflow.RMSPropSolverParam rmsprop_solver = 7;
+  bool has_rmsprop_solver() const;
+  void clear_rmsprop_solver();
+  static const int kRmspropSolverFieldNumber = 7;
+  const ::deepflow::RMSPropSolverParam& rmsprop_solver() const;
+  ::deepflow::RMSPropSolverParam* mutable_rmsprop_solver();
+  ::deepflow::RMSPropSolverParam* release_rmsprop_solver();
+  void set_allocated_rmsprop_solver(::deepflow::RMSPropSolverParam* rmsprop_solver);
+
+  // float learning_rate = 2;
+  void clear_learning_rate();
+  static const int kLearningRateFieldNumber = 2;
+  float learning_rate() const;
+  void set_learning_rate(float value);
+
+  // @@protoc_insertion_point(class_scope:deepflow.SolverParam)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  ::google::protobuf::internal::ArenaStringPtr name_;
+  ::google::protobuf::internal::ArenaStringPtr scope_;
+  ::deepflow::SGDSolverParam* sgd_solver_;
+  ::deepflow::AdamSolverParam* adam_solver_;
+  ::deepflow::AdaDeltaSolverParam* adadelta_solver_;
+  ::deepflow::RMSPropSolverParam* rmsprop_solver_;
+  float learning_rate_;
+  mutable int _cached_size_;
+  friend struct protobuf_deepflow_2eproto::TableStruct;
+};
+// -------------------------------------------------------------------
+
+class FrozenParam_Output : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:deepflow.FrozenParam.Output) */ {
+ public:
+  FrozenParam_Output();
+  virtual ~FrozenParam_Output();
+
+  FrozenParam_Output(const FrozenParam_Output& from);
+
+  inline FrozenParam_Output& operator=(const FrozenParam_Output& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const FrozenParam_Output& default_instance();
+
+  static inline const FrozenParam_Output* internal_default_instance() {
+    return reinterpret_cast<const FrozenParam_Output*>(
+               &_FrozenParam_Output_default_instance_);
+  }
+  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+    71;
+
+  void Swap(FrozenParam_Output* other);
+
+  // implements Message ----------------------------------------------
+
+  inline FrozenParam_Output* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  FrozenParam_Output* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void CopyFrom(const FrozenParam_Output& from);
+  void MergeFrom(const FrozenParam_Output& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void InternalSwap(FrozenParam_Output* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // repeated int32 dims = 2;
+  int dims_size() const;
+  void clear_dims();
+  static const int kDimsFieldNumber = 2;
+  ::google::protobuf::int32 dims(int index) const;
+  void set_dims(int index, ::google::protobuf::int32 value);
+  void add_dims(::google::protobuf::int32 value);
+  const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+      dims() const;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+      mutable_dims();
+
+  // string name = 1;
+  void clear_name();
+  static const int kNameFieldNumber = 1;
+  const ::std::string& name() const;
+  void set_name(const ::std::string& value);
+  #if LANG_CXX11
+  void set_name(::std::string&& value);
+  #endif
+  void set_name(const char* value);
+  void set_name(const char* value, size_t size);
+  ::std::string* mutable_name();
+  ::std::string* release_name();
+  void set_allocated_name(::std::string* name);
+
+  // int64 offset = 3;
+  void clear_offset();
+  static const int kOffsetFieldNumber = 3;
+  ::google::protobuf::int64 offset() const;
+  void set_offset(::google::protobuf::int64 value);
+
+  // @@protoc_insertion_point(class_scope:deepflow.FrozenParam.Output)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int32 > dims_;
+  mutable int _dims_cached_byte_size_;
+  ::google::protobuf::internal::ArenaStringPtr name_;
+  ::google::protobuf::int64 offset_;
+  mutable int _cached_size_;
+  friend struct protobuf_deepflow_2eproto::TableStruct;
+};
+// -------------------------------------------------------------------
+
+class FrozenParam : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:deepflow.FrozenParam) */ {
+ public:
+  FrozenParam();
+  virtual ~FrozenParam();
+
+  FrozenParam(const FrozenParam& from);
+
+  inline FrozenParam& operator=(const FrozenParam& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const FrozenParam& default_instance();
+
+  static inline const FrozenParam* internal_default_instance() {
+    return reinterpret_cast<const FrozenParam*>(
+               &_FrozenParam_default_instance_);
+  }
+  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+    72;
+
+  void Swap(FrozenParam* other);
+
+  // implements Message ----------------------------------------------
+
+  inline FrozenParam* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  FrozenParam* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void CopyFrom(const FrozenParam& from);
+  void MergeFrom(const FrozenParam& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void InternalSwap(FrozenParam* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
 
-  // .deepflow.RMSPropSolverParam rmsprop_solver = 7;
-  bool has_rmsprop_solver() const;
-  void clear_rmsprop_solver();
-  static const int kRmspropSolverFieldNumber = 7;
-  const ::deepflow::RMSPropSolverParam& rmsprop_solver() const;
-  ::deepflow::RMSPropSolverParam* mutable_rmsprop_solver();
-  ::deepflow::RMSPropSolverParam* release_rmsprop_solver();
-  void set_allocated_rmsprop_solver(::deepflow::RMSPropSolverParam* rmsprop_solver);
+  // nested types ----------------------------------------------------
 
-  // float learning_rate = 2;
-  void clear_learning_rate();
-  static const int kLearningRateFieldNumber = 2;
-  float learning_rate() const;
-  void set_learning_rate(float value);
+  typedef FrozenParam_Output Output;
 
-  // @@protoc_insertion_point(class_scope:deepflow.SolverParam)
+  // accessors -------------------------------------------------------
+
+  // repeated .deepflow.FrozenParam.Output output = 1;
+  int output_size() const;
+  void clear_output();
+  static const int kOutputFieldNumber = 1;
+  const ::deepflow::FrozenParam_Output& output(int index) const;
+  ::deepflow::FrozenParam_Output* mutable_output(int index);
+  ::deepflow::FrozenParam_Output* add_output();
+  ::google::protobuf::RepeatedPtrField< ::deepflow::FrozenParam_Output >*
+      mutable_output();
+  const ::google::protobuf::RepeatedPtrField< ::deepflow::FrozenParam_Output >&
+      output() const;
+
+  // repeated string fetch = 2;
+  int fetch_size() const;
+  void clear_fetch();
+  static const int kFetchFieldNumber = 2;
+  const ::std::string& fetch(int index) const;
+  ::std::string* mutable_fetch(int index);
+  void set_fetch(int index, const ::std::string& value);
+  #if LANG_CXX11
+  void set_fetch(int index, ::std::string&& value);
+  #endif
+  void set_fetch(int index, const char* value);
+  void set_fetch(int index, const char* value, size_t size);
+  ::std::string* add_fetch();
+  void add_fetch(const ::std::string& value);
+  #if LANG_CXX11
+  void add_fetch(::std::string&& value);
+  #endif
+  void add_fetch(const char* value);
+  void add_fetch(const char* value, size_t size);
+  const ::google::protobuf::RepeatedPtrField< ::std::string>& fetch() const;
+  ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_fetch();
+
+  // string shared_weights = 5;
+  void clear_shared_weights();
+  static const int kSharedWeightsFieldNumber = 5;
+  const ::std::string& shared_weights() const;
+  void set_shared_weights(const ::std::string& value);
+  #if LANG_CXX11
+  void set_shared_weights(::std::string&& value);
+  #endif
+  void set_shared_weights(const char* value);
+  void set_shared_weights(const char* value, size_t size);
+  ::std::string* mutable_shared_weights();
+  ::std::string* release_shared_weights();
+  void set_allocated_shared_weights(::std::string* shared_weights);
+
+  // int64 arena_size = 3;
+  void clear_arena_size();
+  static const int kArenaSizeFieldNumber = 3;
+  ::google::protobuf::int64 arena_size() const;
+  void set_arena_size(::google::protobuf::int64 value);
+
+  // .deepflow.NodeParam.DataPolicy arena_policy = 4;
+  void clear_arena_policy();
+  static const int kArenaPolicyFieldNumber = 4;
+  ::deepflow::NodeParam_DataPolicy arena_policy() const;
+  void set_arena_policy(::deepflow::NodeParam_DataPolicy value);
+
+  // @@protoc_insertion_point(class_scope:deepflow.FrozenParam)
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr name_;
-  ::google::protobuf::internal::ArenaStringPtr scope_;
-  ::deepflow::SGDSolverParam* sgd_solver_;
-  ::deepflow::AdamSolverParam* adam_solver_;
-  ::deepflow::AdaDeltaSolverParam* adadelta_solver_;
-  ::deepflow::RMSPropSolverParam* rmsprop_solver_;
-  float learning_rate_;
+  ::google::protobuf::RepeatedPtrField< ::deepflow::FrozenParam_Output > output_;
+  ::google::protobuf::RepeatedPtrField< ::std::string> fetch_;
+  ::google::protobuf::internal::ArenaStringPtr shared_weights_;
+  ::google::protobuf::int64 arena_size_;
+  int arena_policy_;
   mutable int _cached_size_;
   friend struct protobuf_deepflow_2eproto::TableStruct;
 };
@@ -6912,7 +7979,7 @@ class BlockParam : public ::google::protobuf::Message /* @@protoc_insertion_poin
                &_BlockParam_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    65;
+    73;
 
   void Swap(BlockParam* other);
 
@@ -6992,6 +8059,15 @@ class BlockParam : public ::google::protobuf::Message /* @@protoc_insertion_poin
   const ::google::protobuf::RepeatedPtrField< ::deepflow::InitParam >&
       initializer() const;
 
+  // .deepflow.FrozenParam frozen_param = 5;
+  bool has_frozen_param() const;
+  void clear_frozen_param();
+  static const int kFrozenParamFieldNumber = 5;
+  const ::deepflow::FrozenParam& frozen_param() const;
+  ::deepflow::FrozenParam* mutable_frozen_param();
+  ::deepflow::FrozenParam* release_frozen_param();
+  void set_allocated_frozen_param(::deepflow::FrozenParam* frozen_param);
+
   // @@protoc_insertion_point(class_scope:deepflow.BlockParam)
  private:
 
@@ -6999,6 +8075,7 @@ class BlockParam : public ::google::protobuf::Message /* @@protoc_insertion_poin
   ::google::protobuf::RepeatedPtrField< ::deepflow::NodeParam > node_;
   ::google::protobuf::RepeatedPtrField< ::deepflow::SolverParam > solver_;
   ::google::protobuf::RepeatedPtrField< ::deepflow::InitParam > initializer_;
+  ::deepflow::FrozenParam* frozen_param_;
   mutable int _cached_size_;
   friend struct protobuf_deepflow_2eproto::TableStruct;
 };
@@ -7024,7 +8101,7 @@ class ConcateParam : public ::google::protobuf::Message /* @@protoc_insertion_po
                &_ConcateParam_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    66;
+    74;
 
   void Swap(ConcateParam* other);
 
@@ -7104,7 +8181,7 @@ class ReshapeParam : public ::google::protobuf::Message /* @@protoc_insertion_po
                &_ReshapeParam_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    67;
+    75;
 
   void Swap(ReshapeParam* other);
 
@@ -7191,7 +8268,7 @@ class BatchStdDevParam : public ::google::protobuf::Message /* @@protoc_insertio
                &_BatchStdDevParam_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    68;
+    76;
 
   void Swap(BatchStdDevParam* other);
 
@@ -7264,7 +8341,7 @@ class PassThroughParam : public ::google::protobuf::Message /* @@protoc_insertio
                &_PassThroughParam_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    69;
+    77;
 
   void Swap(PassThroughParam* other);
 
@@ -7344,7 +8421,7 @@ class GaussianParam : public ::google::protobuf::Message /* @@protoc_insertion_p
                &_GaussianParam_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    70;
+    78;
 
   void Swap(GaussianParam* other);
 
@@ -7417,7 +8494,7 @@ class GaussianKernelParam : public ::google::protobuf::Message /* @@protoc_inser
                &_GaussianKernelParam_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    71;
+    79;
 
   void Swap(GaussianKernelParam* other);
 
@@ -7511,7 +8588,7 @@ class GaborKernelParam : public ::google::protobuf::Message /* @@protoc_insertio
                &_GaborKernelParam_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    72;
+    80;
 
   void Swap(GaborKernelParam* other);
 
@@ -7626,7 +8703,7 @@ class PatchSamplingParam : public ::google::protobuf::Message /* @@protoc_insert
                &_PatchSamplingParam_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    73;
+    81;
 
   void Swap(PatchSamplingParam* other);
 
@@ -7713,7 +8790,7 @@ class TextImageGeneratorParam : public ::google::protobuf::Message /* @@protoc_i
                &_TextImageGeneratorParam_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    74;
+    82;
 
   void Swap(TextImageGeneratorParam* other);
 
@@ -7834,7 +8911,7 @@ class MaxParam : public ::google::protobuf::Message /* @@protoc_insertion_point(
                &_MaxParam_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    75;
+    83;
 
   void Swap(MaxParam* other);
 
@@ -7907,7 +8984,7 @@ class SpatialTransformerParam : public ::google::protobuf::Message /* @@protoc_i
                &_SpatialTransformerParam_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    76;
+    84;
 
   void Swap(SpatialTransformerParam* other);
 
@@ -7980,7 +9057,7 @@ class NandParam : public ::google::protobuf::Message /* @@protoc_insertion_point
                &_NandParam_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    77;
+    85;
 
   void Swap(NandParam* other);
 
@@ -8053,7 +9130,7 @@ class NodeParam : public ::google::protobuf::Message /* @@protoc_insertion_point
                &_NodeParam_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    78;
+    86;
 
   void Swap(NodeParam* other);
 
@@ -8102,6 +9179,8 @@ class NodeParam : public ::google::protobuf::Message /* @@protoc_insertion_point
     NodeParam_DataPolicy_GPU_WITH_CPU_OFFLOAD_POLICY;
   static const DataPolicy CUDA_MANAGED_POLICY =
     NodeParam_DataPolicy_CUDA_MANAGED_POLICY;
+  static const DataPolicy CPU_ONLY_POLICY =
+    NodeParam_DataPolicy_CPU_ONLY_POLICY;
   static inline bool DataPolicy_IsValid(int value) {
     return NodeParam_DataPolicy_IsValid(value);
   }
@@ -8123,6 +9202,34 @@ class NodeParam : public ::google::protobuf::Message /* @@protoc_insertion_point
     return NodeParam_DataPolicy_Parse(name, value);
   }
 
+  typedef NodeParam_Layout Layout;
+  static const Layout NCHW =
+    NodeParam_Layout_NCHW;
+  static const Layout NHWC =
+    NodeParam_Layout_NHWC;
+  static const Layout NCHW16C =
+    NodeParam_Layout_NCHW16C;
+  static inline bool Layout_IsValid(int value) {
+    return NodeParam_Layout_IsValid(value);
+  }
+  static const Layout Layout_MIN =
+    NodeParam_Layout_Layout_MIN;
+  static const Layout Layout_MAX =
+    NodeParam_Layout_Layout_MAX;
+  static const int Layout_ARRAYSIZE =
+    NodeParam_Layout_Layout_ARRAYSIZE;
+  static inline const ::google::protobuf::EnumDescriptor*
+  Layout_descriptor() {
+    return NodeParam_Layout_descriptor();
+  }
+  static inline const ::std::string& Layout_Name(Layout value) {
+    return NodeParam_Layout_Name(value);
+  }
+  static inline bool Layout_Parse(const ::std::string& name,
+      Layout* value) {
+    return NodeParam_Layout_Parse(name, value);
+  }
+
   // accessors -------------------------------------------------------
 
   // repeated string input = 3;
@@ -8737,12 +9844,54 @@ class NodeParam : public ::google::protobuf::Message /* @@protoc_insertion_point
   ::deepflow::GaborKernelParam* release_gabor_kernel_param();
   void set_allocated_gabor_kernel_param(::deepflow::GaborKernelParam* gabor_kernel_param);
 
+  // .deepflow.SoftmaxCrossEntropyParam softmax_cross_entropy_param = 164;
+  bool has_softmax_cross_entropy_param() const;
+  void clear_softmax_cross_entropy_param();
+  static const int kSoftmaxCrossEntropyParamFieldNumber = 164;
+  const ::deepflow::SoftmaxCrossEntropyParam& softmax_cross_entropy_param() const;
+  ::deepflow::SoftmaxCrossEntropyParam* mutable_softmax_cross_entropy_param();
+  ::deepflow::SoftmaxCrossEntropyParam* release_softmax_cross_entropy_param();
+  void set_allocated_softmax_cross_entropy_param(::deepflow::SoftmaxCrossEntropyParam* softmax_cross_entropy_param);
+
+  // .deepflow.FusedElementwiseParam fused_elementwise_param = 165;
+  bool has_fused_elementwise_param() const;
+  void clear_fused_elementwise_param();
+  static const int kFusedElementwiseParamFieldNumber = 165;
+  const ::deepflow::FusedElementwiseParam& fused_elementwise_param() const;
+  ::deepflow::FusedElementwiseParam* mutable_fused_elementwise_param();
+  ::deepflow::FusedElementwiseParam* release_fused_elementwise_param();
+  void set_allocated_fused_elementwise_param(::deepflow::FusedElementwiseParam* fused_elementwise_param);
+
+  // .deepflow.ReorderParam reorder_param = 166;
+  bool has_reorder_param() const;
+  void clear_reorder_param();
+  static const int kReorderParamFieldNumber = 166;
+  const ::deepflow::ReorderParam& reorder_param() const;
+  ::deepflow::ReorderParam* mutable_reorder_param();
+  ::deepflow::ReorderParam* release_reorder_param();
+  void set_allocated_reorder_param(::deepflow::ReorderParam* reorder_param);
+
+  // .deepflow.SliceParam slice_param = 167;
+  bool has_slice_param() const;
+  void clear_slice_param();
+  static const int kSliceParamFieldNumber = 167;
+  const ::deepflow::SliceParam& slice_param() const;
+  ::deepflow::SliceParam* mutable_slice_param();
+  ::deepflow::SliceParam* release_slice_param();
+  void set_allocated_slice_param(::deepflow::SliceParam* slice_param);
+
   // .deepflow.NodeParam.DataPolicy data_policy = 6;
   void clear_data_policy();
   static const int kDataPolicyFieldNumber = 6;
   ::deepflow::NodeParam_DataPolicy data_policy() const;
   void set_data_policy(::deepflow::NodeParam_DataPolicy value);
 
+  // .deepflow.NodeParam.Layout layout = 7;
+  void clear_layout();
+  static const int kLayoutFieldNumber = 7;
+  ::deepflow::NodeParam_Layout layout() const;
+  void set_layout(::deepflow::NodeParam_Layout value);
+
   // @@protoc_insertion_point(class_scope:deepflow.NodeParam)
  private:
 
@@ -8811,7 +9960,12 @@ class NodeParam : public ::google::protobuf::Message /* @@protoc_insertion_point
   ::deepflow::SpatialTransformerParam* spatial_transformer_param_;
   ::deepflow::NandParam* nand_param_;
   ::deepflow::GaborKernelParam* gabor_kernel_param_;
+  ::deepflow::SoftmaxCrossEntropyParam* softmax_cross_entropy_param_;
+  ::deepflow::FusedElementwiseParam* fused_elementwise_param_;
+  ::deepflow::ReorderParam* reorder_param_;
+  ::deepflow::SliceParam* slice_param_;
   int data_policy_;
+  int layout_;
   mutable int _cached_size_;
   friend struct protobuf_deepflow_2eproto::TableStruct;
 };
@@ -9659,6 +10813,20 @@ inline void PoolingParam::set_v_stride(::google::protobuf::int32 value) {
   // @@protoc_insertion_point(field_set:deepflow.PoolingParam.v_stride)
 }
 
+// .deepflow.PoolingParam.Mode mode = 7;
+inline void PoolingParam::clear_mode() {
+  mode_ = 0;
+}
+inline ::deepflow::PoolingParam_Mode PoolingParam::mode() const {
+  // @@protoc_insertion_point(field_get:deepflow.PoolingParam.mode)
+  return static_cast< ::deepflow::PoolingParam_Mode >(mode_);
+}
+inline void PoolingParam::set_mode(::deepflow::PoolingParam_Mode value) {
+  
+  mode_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.PoolingParam.mode)
+}
+
 // -------------------------------------------------------------------
 
 // TransposedConv2dParam
@@ -9835,6 +11003,45 @@ inline void Conv2dParam::set_dilation_w(::google::protobuf::int32 value) {
   // @@protoc_insertion_point(field_set:deepflow.Conv2dParam.dilation_w)
 }
 
+// .deepflow.EpilogueParam epilogue = 7;
+inline bool Conv2dParam::has_epilogue() const {
+  return this != internal_default_instance() && epilogue_ != NULL;
+}
+inline void Conv2dParam::clear_epilogue() {
+  if (GetArenaNoVirtual() == NULL && epilogue_ != NULL) delete epilogue_;
+  epilogue_ = NULL;
+}
+inline const ::deepflow::EpilogueParam& Conv2dParam::epilogue() const {
+  // @@protoc_insertion_point(field_get:deepflow.Conv2dParam.epilogue)
+  return epilogue_ != NULL ? *epilogue_
+                         : *::deepflow::EpilogueParam::internal_default_instance();
+}
+inline ::deepflow::EpilogueParam* Conv2dParam::mutable_epilogue() {
+  
+  if (epilogue_ == NULL) {
+    epilogue_ = new ::deepflow::EpilogueParam;
+  }
+  // @@protoc_insertion_point(field_mutable:deepflow.Conv2dParam.epilogue)
+  return epilogue_;
+}
+inline ::deepflow::EpilogueParam* Conv2dParam::release_epilogue() {
+  // @@protoc_insertion_point(field_release:deepflow.Conv2dParam.epilogue)
+  
+  ::deepflow::EpilogueParam* temp = epilogue_;
+  epilogue_ = NULL;
+  return temp;
+}
+inline void Conv2dParam::set_allocated_epilogue(::deepflow::EpilogueParam* epilogue) {
+  delete epilogue_;
+  epilogue_ = epilogue;
+  if (epilogue) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:deepflow.Conv2dParam.epilogue)
+}
+
 // -------------------------------------------------------------------
 
 // DropoutParam
@@ -9857,6 +11064,218 @@ inline void DropoutParam::set_dropout(float value) {
 
 // MatMulParam
 
+// .deepflow.EpilogueParam epilogue = 1;
+inline bool MatMulParam::has_epilogue() const {
+  return this != internal_default_instance() && epilogue_ != NULL;
+}
+inline void MatMulParam::clear_epilogue() {
+  if (GetArenaNoVirtual() == NULL && epilogue_ != NULL) delete epilogue_;
+  epilogue_ = NULL;
+}
+inline const ::deepflow::EpilogueParam& MatMulParam::epilogue() const {
+  // @@protoc_insertion_point(field_get:deepflow.MatMulParam.epilogue)
+  return epilogue_ != NULL ? *epilogue_
+                         : *::deepflow::EpilogueParam::internal_default_instance();
+}
+inline ::deepflow::EpilogueParam* MatMulParam::mutable_epilogue() {
+  
+  if (epilogue_ == NULL) {
+    epilogue_ = new ::deepflow::EpilogueParam;
+  }
+  // @@protoc_insertion_point(field_mutable:deepflow.MatMulParam.epilogue)
+  return epilogue_;
+}
+inline ::deepflow::EpilogueParam* MatMulParam::release_epilogue() {
+  // @@protoc_insertion_point(field_release:deepflow.MatMulParam.epilogue)
+  
+  ::deepflow::EpilogueParam* temp = epilogue_;
+  epilogue_ = NULL;
+  return temp;
+}
+inline void MatMulParam::set_allocated_epilogue(::deepflow::EpilogueParam* epilogue) {
+  delete epilogue_;
+  epilogue_ = epilogue;
+  if (epilogue) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:deepflow.MatMulParam.epilogue)
+}
+
+// -------------------------------------------------------------------
+
+// PointwiseStage
+
+// .deepflow.PointwiseStage.Op op = 1;
+inline void PointwiseStage::clear_op() {
+  op_ = 0;
+}
+inline ::deepflow::PointwiseStage_Op PointwiseStage::op() const {
+  // @@protoc_insertion_point(field_get:deepflow.PointwiseStage.op)
+  return static_cast< ::deepflow::PointwiseStage_Op >(op_);
+}
+inline void PointwiseStage::set_op(::deepflow::PointwiseStage_Op value) {
+  
+  op_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.PointwiseStage.op)
+}
+
+// float coef = 2;
+inline void PointwiseStage::clear_coef() {
+  coef_ = 0;
+}
+inline float PointwiseStage::coef() const {
+  // @@protoc_insertion_point(field_get:deepflow.PointwiseStage.coef)
+  return coef_;
+}
+inline void PointwiseStage::set_coef(float value) {
+  
+  coef_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.PointwiseStage.coef)
+}
+
+// -------------------------------------------------------------------
+
+// EpilogueParam
+
+// bool bias = 1;
+inline void EpilogueParam::clear_bias() {
+  bias_ = false;
+}
+inline bool EpilogueParam::bias() const {
+  // @@protoc_insertion_point(field_get:deepflow.EpilogueParam.bias)
+  return bias_;
+}
+inline void EpilogueParam::set_bias(bool value) {
+  
+  bias_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.EpilogueParam.bias)
+}
+
+// .deepflow.PointwiseStage activation = 2;
+inline bool EpilogueParam::has_activation() const {
+  return this != internal_default_instance() && activation_ != NULL;
+}
+inline void EpilogueParam::clear_activation() {
+  if (GetArenaNoVirtual() == NULL && activation_ != NULL) delete activation_;
+  activation_ = NULL;
+}
+inline const ::deepflow::PointwiseStage& EpilogueParam::activation() const {
+  // @@protoc_insertion_point(field_get:deepflow.EpilogueParam.activation)
+  return activation_ != NULL ? *activation_
+                         : *::deepflow::PointwiseStage::internal_default_instance();
+}
+inline ::deepflow::PointwiseStage* EpilogueParam::mutable_activation() {
+  
+  if (activation_ == NULL) {
+    activation_ = new ::deepflow::PointwiseStage;
+  }
+  // @@protoc_insertion_point(field_mutable:deepflow.EpilogueParam.activation)
+  return activation_;
+}
+inline ::deepflow::PointwiseStage* EpilogueParam::release_activation() {
+  // @@protoc_insertion_point(field_release:deepflow.EpilogueParam.activation)
+  
+  ::deepflow::PointwiseStage* temp = activation_;
+  activation_ = NULL;
+  return temp;
+}
+inline void EpilogueParam::set_allocated_activation(::deepflow::PointwiseStage* activation) {
+  delete activation_;
+  activation_ = activation;
+  if (activation) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:deepflow.EpilogueParam.activation)
+}
+
+// -------------------------------------------------------------------
+
+// FusedElementwiseParam
+
+// repeated .deepflow.PointwiseStage stage = 1;
+inline int FusedElementwiseParam::stage_size() const {
+  return stage_.size();
+}
+inline void FusedElementwiseParam::clear_stage() {
+  stage_.Clear();
+}
+inline const ::deepflow::PointwiseStage& FusedElementwiseParam::stage(int index) const {
+  // @@protoc_insertion_point(field_get:deepflow.FusedElementwiseParam.stage)
+  return stage_.Get(index);
+}
+inline ::deepflow::PointwiseStage* FusedElementwiseParam::mutable_stage(int index) {
+  // @@protoc_insertion_point(field_mutable:deepflow.FusedElementwiseParam.stage)
+  return stage_.Mutable(index);
+}
+inline ::deepflow::PointwiseStage* FusedElementwiseParam::add_stage() {
+  // @@protoc_insertion_point(field_add:deepflow.FusedElementwiseParam.stage)
+  return stage_.Add();
+}
+inline ::google::protobuf::RepeatedPtrField< ::deepflow::PointwiseStage >*
+FusedElementwiseParam::mutable_stage() {
+  // @@protoc_insertion_point(field_mutable_list:deepflow.FusedElementwiseParam.stage)
+  return &stage_;
+}
+inline const ::google::protobuf::RepeatedPtrField< ::deepflow::PointwiseStage >&
+FusedElementwiseParam::stage() const {
+  // @@protoc_insertion_point(field_list:deepflow.FusedElementwiseParam.stage)
+  return stage_;
+}
+
+// -------------------------------------------------------------------
+
+// ReorderParam
+
+// -------------------------------------------------------------------
+
+// SliceParam
+
+// int32 dim = 1;
+inline void SliceParam::clear_dim() {
+  dim_ = 0;
+}
+inline ::google::protobuf::int32 SliceParam::dim() const {
+  // @@protoc_insertion_point(field_get:deepflow.SliceParam.dim)
+  return dim_;
+}
+inline void SliceParam::set_dim(::google::protobuf::int32 value) {
+  
+  dim_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.SliceParam.dim)
+}
+
+// int32 begin = 2;
+inline void SliceParam::clear_begin() {
+  begin_ = 0;
+}
+inline ::google::protobuf::int32 SliceParam::begin() const {
+  // @@protoc_insertion_point(field_get:deepflow.SliceParam.begin)
+  return begin_;
+}
+inline void SliceParam::set_begin(::google::protobuf::int32 value) {
+  
+  begin_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.SliceParam.begin)
+}
+
+// int32 size = 3;
+inline void SliceParam::clear_size() {
+  size_ = 0;
+}
+inline ::google::protobuf::int32 SliceParam::size() const {
+  // @@protoc_insertion_point(field_get:deepflow.SliceParam.size)
+  return size_;
+}
+inline void SliceParam::set_size(::google::protobuf::int32 value) {
+  
+  size_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.SliceParam.size)
+}
+
 // -------------------------------------------------------------------
 
 // LeakyReluParam
@@ -9961,6 +11380,36 @@ inline void ReduceParam::set_output_type(::deepflow::ReduceParam_OutputType valu
   // @@protoc_insertion_point(field_set:deepflow.ReduceParam.output_type)
 }
 
+// repeated int32 reduce_dims = 4;
+inline int ReduceParam::reduce_dims_size() const {
+  return reduce_dims_.size();
+}
+inline void ReduceParam::clear_reduce_dims() {
+  reduce_dims_.Clear();
+}
+inline ::google::protobuf::int32 ReduceParam::reduce_dims(int index) const {
+  // @@protoc_insertion_point(field_get:deepflow.ReduceParam.reduce_dims)
+  return reduce_dims_.Get(index);
+}
+inline void ReduceParam::set_reduce_dims(int index, ::google::protobuf::int32 value) {
+  reduce_dims_.Set(index, value);
+  // @@protoc_insertion_point(field_set:deepflow.ReduceParam.reduce_dims)
+}
+inline void ReduceParam::add_reduce_dims(::google::protobuf::int32 value) {
+  reduce_dims_.Add(value);
+  // @@protoc_insertion_point(field_add:deepflow.ReduceParam.reduce_dims)
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+ReduceParam::reduce_dims() const {
+  // @@protoc_insertion_point(field_list:deepflow.ReduceParam.reduce_dims)
+  return reduce_dims_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+ReduceParam::mutable_reduce_dims() {
+  // @@protoc_insertion_point(field_mutable_list:deepflow.ReduceParam.reduce_dims)
+  return &reduce_dims_;
+}
+
 // -------------------------------------------------------------------
 
 // SnapshotParam
@@ -10788,6 +12237,34 @@ inline void ReplayMemoryParam::set_capacity(::google::protobuf::int32 value) {
   // @@protoc_insertion_point(field_set:deepflow.ReplayMemoryParam.capacity)
 }
 
+// bool prioritized = 2;
+inline void ReplayMemoryParam::clear_prioritized() {
+  prioritized_ = false;
+}
+inline bool ReplayMemoryParam::prioritized() const {
+  // @@protoc_insertion_point(field_get:deepflow.ReplayMemoryParam.prioritized)
+  return prioritized_;
+}
+inline void ReplayMemoryParam::set_prioritized(bool value) {
+  
+  prioritized_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.ReplayMemoryParam.prioritized)
+}
+
+// float alpha = 3;
+inline void ReplayMemoryParam::clear_alpha() {
+  alpha_ = 0;
+}
+inline float ReplayMemoryParam::alpha() const {
+  // @@protoc_insertion_point(field_get:deepflow.ReplayMemoryParam.alpha)
+  return alpha_;
+}
+inline void ReplayMemoryParam::set_alpha(float value) {
+  
+  alpha_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.ReplayMemoryParam.alpha)
+}
+
 // -------------------------------------------------------------------
 
 // LrnParam
@@ -10880,6 +12357,62 @@ inline void ResizeParam::set_width_scale(float value) {
   // @@protoc_insertion_point(field_set:deepflow.ResizeParam.width_scale)
 }
 
+// .deepflow.ResizeParam.Mode mode = 3;
+inline void ResizeParam::clear_mode() {
+  mode_ = 0;
+}
+inline ::deepflow::ResizeParam_Mode ResizeParam::mode() const {
+  // @@protoc_insertion_point(field_get:deepflow.ResizeParam.mode)
+  return static_cast< ::deepflow::ResizeParam_Mode >(mode_);
+}
+inline void ResizeParam::set_mode(::deepflow::ResizeParam_Mode value) {
+  
+  mode_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.ResizeParam.mode)
+}
+
+// bool add = 4;
+inline void ResizeParam::clear_add() {
+  add_ = false;
+}
+inline bool ResizeParam::add() const {
+  // @@protoc_insertion_point(field_get:deepflow.ResizeParam.add)
+  return add_;
+}
+inline void ResizeParam::set_add(bool value) {
+  
+  add_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.ResizeParam.add)
+}
+
+// float alpha = 5;
+inline void ResizeParam::clear_alpha() {
+  alpha_ = 0;
+}
+inline float ResizeParam::alpha() const {
+  // @@protoc_insertion_point(field_get:deepflow.ResizeParam.alpha)
+  return alpha_;
+}
+inline void ResizeParam::set_alpha(float value) {
+  
+  alpha_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.ResizeParam.alpha)
+}
+
+// float beta = 6;
+inline void ResizeParam::clear_beta() {
+  beta_ = 0;
+}
+inline float ResizeParam::beta() const {
+  // @@protoc_insertion_point(field_get:deepflow.ResizeParam.beta)
+  return beta_;
+}
+inline void ResizeParam::set_beta(float value) {
+  
+  beta_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.ResizeParam.beta)
+}
+
 // -------------------------------------------------------------------
 
 // SquareParam
@@ -10900,14 +12433,46 @@ inline void ResizeParam::set_width_scale(float value) {
 inline void SoftmaxParam::clear_mode() {
   mode_ = 0;
 }
-inline ::deepflow::SoftmaxParam_Mode SoftmaxParam::mode() const {
-  // @@protoc_insertion_point(field_get:deepflow.SoftmaxParam.mode)
-  return static_cast< ::deepflow::SoftmaxParam_Mode >(mode_);
+inline ::deepflow::SoftmaxParam_Mode SoftmaxParam::mode() const {
+  // @@protoc_insertion_point(field_get:deepflow.SoftmaxParam.mode)
+  return static_cast< ::deepflow::SoftmaxParam_Mode >(mode_);
+}
+inline void SoftmaxParam::set_mode(::deepflow::SoftmaxParam_Mode value) {
+  
+  mode_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.SoftmaxParam.mode)
+}
+
+// -------------------------------------------------------------------
+
+// SoftmaxCrossEntropyParam
+
+// .deepflow.SoftmaxParam.Mode mode = 1;
+inline void SoftmaxCrossEntropyParam::clear_mode() {
+  mode_ = 0;
+}
+inline ::deepflow::SoftmaxParam_Mode SoftmaxCrossEntropyParam::mode() const {
+  // @@protoc_insertion_point(field_get:deepflow.SoftmaxCrossEntropyParam.mode)
+  return static_cast< ::deepflow::SoftmaxParam_Mode >(mode_);
+}
+inline void SoftmaxCrossEntropyParam::set_mode(::deepflow::SoftmaxParam_Mode value) {
+  
+  mode_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.SoftmaxCrossEntropyParam.mode)
+}
+
+// float alpha = 2;
+inline void SoftmaxCrossEntropyParam::clear_alpha() {
+  alpha_ = 0;
+}
+inline float SoftmaxCrossEntropyParam::alpha() const {
+  // @@protoc_insertion_point(field_get:deepflow.SoftmaxCrossEntropyParam.alpha)
+  return alpha_;
 }
-inline void SoftmaxParam::set_mode(::deepflow::SoftmaxParam_Mode value) {
+inline void SoftmaxCrossEntropyParam::set_alpha(float value) {
   
-  mode_ = value;
-  // @@protoc_insertion_point(field_set:deepflow.SoftmaxParam.mode)
+  alpha_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.SoftmaxCrossEntropyParam.alpha)
 }
 
 // -------------------------------------------------------------------
@@ -12076,6 +13641,291 @@ inline void SolverParam::set_allocated_scope(::std::string* scope) {
 
 // -------------------------------------------------------------------
 
+// FrozenParam_Output
+
+// string name = 1;
+inline void FrozenParam_Output::clear_name() {
+  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& FrozenParam_Output::name() const {
+  // @@protoc_insertion_point(field_get:deepflow.FrozenParam.Output.name)
+  return name_.GetNoArena();
+}
+inline void FrozenParam_Output::set_name(const ::std::string& value) {
+  
+  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:deepflow.FrozenParam.Output.name)
+}
+#if LANG_CXX11
+inline void FrozenParam_Output::set_name(::std::string&& value) {
+  
+  name_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:deepflow.FrozenParam.Output.name)
+}
+#endif
+inline void FrozenParam_Output::set_name(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:deepflow.FrozenParam.Output.name)
+}
+inline void FrozenParam_Output::set_name(const char* value, size_t size) {
+  
+  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:deepflow.FrozenParam.Output.name)
+}
+inline ::std::string* FrozenParam_Output::mutable_name() {
+  
+  // @@protoc_insertion_point(field_mutable:deepflow.FrozenParam.Output.name)
+  return name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* FrozenParam_Output::release_name() {
+  // @@protoc_insertion_point(field_release:deepflow.FrozenParam.Output.name)
+  
+  return name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void FrozenParam_Output::set_allocated_name(::std::string* name) {
+  if (name != NULL) {
+    
+  } else {
+    
+  }
+  name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name);
+  // @@protoc_insertion_point(field_set_allocated:deepflow.FrozenParam.Output.name)
+}
+
+// repeated int32 dims = 2;
+inline int FrozenParam_Output::dims_size() const {
+  return dims_.size();
+}
+inline void FrozenParam_Output::clear_dims() {
+  dims_.Clear();
+}
+inline ::google::protobuf::int32 FrozenParam_Output::dims(int index) const {
+  // @@protoc_insertion_point(field_get:deepflow.FrozenParam.Output.dims)
+  return dims_.Get(index);
+}
+inline void FrozenParam_Output::set_dims(int index, ::google::protobuf::int32 value) {
+  dims_.Set(index, value);
+  // @@protoc_insertion_point(field_set:deepflow.FrozenParam.Output.dims)
+}
+inline void FrozenParam_Output::add_dims(::google::protobuf::int32 value) {
+  dims_.Add(value);
+  // @@protoc_insertion_point(field_add:deepflow.FrozenParam.Output.dims)
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+FrozenParam_Output::dims() const {
+  // @@protoc_insertion_point(field_list:deepflow.FrozenParam.Output.dims)
+  return dims_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+FrozenParam_Output::mutable_dims() {
+  // @@protoc_insertion_point(field_mutable_list:deepflow.FrozenParam.Output.dims)
+  return &dims_;
+}
+
+// int64 offset = 3;
+inline void FrozenParam_Output::clear_offset() {
+  offset_ = GOOGLE_LONGLONG(0);
+}
+inline ::google::protobuf::int64 FrozenParam_Output::offset() const {
+  // @@protoc_insertion_point(field_get:deepflow.FrozenParam.Output.offset)
+  return offset_;
+}
+inline void FrozenParam_Output::set_offset(::google::protobuf::int64 value) {
+  
+  offset_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.FrozenParam.Output.offset)
+}
+
+// -------------------------------------------------------------------
+
+// FrozenParam
+
+// repeated .deepflow.FrozenParam.Output output = 1;
+inline int FrozenParam::output_size() const {
+  return output_.size();
+}
+inline void FrozenParam::clear_output() {
+  output_.Clear();
+}
+inline const ::deepflow::FrozenParam_Output& FrozenParam::output(int index) const {
+  // @@protoc_insertion_point(field_get:deepflow.FrozenParam.output)
+  return output_.Get(index);
+}
+inline ::deepflow::FrozenParam_Output* FrozenParam::mutable_output(int index) {
+  // @@protoc_insertion_point(field_mutable:deepflow.FrozenParam.output)
+  return output_.Mutable(index);
+}
+inline ::deepflow::FrozenParam_Output* FrozenParam::add_output() {
+  // @@protoc_insertion_point(field_add:deepflow.FrozenParam.output)
+  return output_.Add();
+}
+inline ::google::protobuf::RepeatedPtrField< ::deepflow::FrozenParam_Output >*
+FrozenParam::mutable_output() {
+  // @@protoc_insertion_point(field_mutable_list:deepflow.FrozenParam.output)
+  return &output_;
+}
+inline const ::google::protobuf::RepeatedPtrField< ::deepflow::FrozenParam_Output >&
+FrozenParam::output() const {
+  // @@protoc_insertion_point(field_list:deepflow.FrozenParam.output)
+  return output_;
+}
+
+// repeated string fetch = 2;
+inline int FrozenParam::fetch_size() const {
+  return fetch_.size();
+}
+inline void FrozenParam::clear_fetch() {
+  fetch_.Clear();
+}
+inline const ::std::string& FrozenParam::fetch(int index) const {
+  // @@protoc_insertion_point(field_get:deepflow.FrozenParam.fetch)
+  return fetch_.Get(index);
+}
+inline ::std::string* FrozenParam::mutable_fetch(int index) {
+  // @@protoc_insertion_point(field_mutable:deepflow.FrozenParam.fetch)
+  return fetch_.Mutable(index);
+}
+inline void FrozenParam::set_fetch(int index, const ::std::string& value) {
+  // @@protoc_insertion_point(field_set:deepflow.FrozenParam.fetch)
+  fetch_.Mutable(index)->assign(value);
+}
+#if LANG_CXX11
+inline void FrozenParam::set_fetch(int index, ::std::string&& value) {
+  // @@protoc_insertion_point(field_set:deepflow.FrozenParam.fetch)
+  fetch_.Mutable(index)->assign(std::move(value));
+}
+#endif
+inline void FrozenParam::set_fetch(int index, const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  fetch_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:deepflow.FrozenParam.fetch)
+}
+inline void FrozenParam::set_fetch(int index, const char* value, size_t size) {
+  fetch_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:deepflow.FrozenParam.fetch)
+}
+inline ::std::string* FrozenParam::add_fetch() {
+  // @@protoc_insertion_point(field_add_mutable:deepflow.FrozenParam.fetch)
+  return fetch_.Add();
+}
+inline void FrozenParam::add_fetch(const ::std::string& value) {
+  fetch_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:deepflow.FrozenParam.fetch)
+}
+#if LANG_CXX11
+inline void FrozenParam::add_fetch(::std::string&& value) {
+  fetch_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:deepflow.FrozenParam.fetch)
+}
+#endif
+inline void FrozenParam::add_fetch(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  fetch_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:deepflow.FrozenParam.fetch)
+}
+inline void FrozenParam::add_fetch(const char* value, size_t size) {
+  fetch_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:deepflow.FrozenParam.fetch)
+}
+inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
+FrozenParam::fetch() const {
+  // @@protoc_insertion_point(field_list:deepflow.FrozenParam.fetch)
+  return fetch_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::std::string>*
+FrozenParam::mutable_fetch() {
+  // @@protoc_insertion_point(field_mutable_list:deepflow.FrozenParam.fetch)
+  return &fetch_;
+}
+
+// int64 arena_size = 3;
+inline void FrozenParam::clear_arena_size() {
+  arena_size_ = GOOGLE_LONGLONG(0);
+}
+inline ::google::protobuf::int64 FrozenParam::arena_size() const {
+  // @@protoc_insertion_point(field_get:deepflow.FrozenParam.arena_size)
+  return arena_size_;
+}
+inline void FrozenParam::set_arena_size(::google::protobuf::int64 value) {
+  
+  arena_size_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.FrozenParam.arena_size)
+}
+
+// .deepflow.NodeParam.DataPolicy arena_policy = 4;
+inline void FrozenParam::clear_arena_policy() {
+  arena_policy_ = 0;
+}
+inline ::deepflow::NodeParam_DataPolicy FrozenParam::arena_policy() const {
+  // @@protoc_insertion_point(field_get:deepflow.FrozenParam.arena_policy)
+  return static_cast< ::deepflow::NodeParam_DataPolicy >(arena_policy_);
+}
+inline void FrozenParam::set_arena_policy(::deepflow::NodeParam_DataPolicy value) {
+  
+  arena_policy_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.FrozenParam.arena_policy)
+}
+
+// string shared_weights = 5;
+inline void FrozenParam::clear_shared_weights() {
+  shared_weights_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& FrozenParam::shared_weights() const {
+  // @@protoc_insertion_point(field_get:deepflow.FrozenParam.shared_weights)
+  return shared_weights_.GetNoArena();
+}
+inline void FrozenParam::set_shared_weights(const ::std::string& value) {
+  
+  shared_weights_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:deepflow.FrozenParam.shared_weights)
+}
+#if LANG_CXX11
+inline void FrozenParam::set_shared_weights(::std::string&& value) {
+  
+  shared_weights_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:deepflow.FrozenParam.shared_weights)
+}
+#endif
+inline void FrozenParam::set_shared_weights(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  shared_weights_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:deepflow.FrozenParam.shared_weights)
+}
+inline void FrozenParam::set_shared_weights(const char* value, size_t size) {
+  
+  shared_weights_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:deepflow.FrozenParam.shared_weights)
+}
+inline ::std::string* FrozenParam::mutable_shared_weights() {
+  
+  // @@protoc_insertion_point(field_mutable:deepflow.FrozenParam.shared_weights)
+  return shared_weights_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* FrozenParam::release_shared_weights() {
+  // @@protoc_insertion_point(field_release:deepflow.FrozenParam.shared_weights)
+  
+  return shared_weights_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void FrozenParam::set_allocated_shared_weights(::std::string* shared_weights) {
+  if (shared_weights != NULL) {
+    
+  } else {
+    
+  }
+  shared_weights_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), shared_weights);
+  // @@protoc_insertion_point(field_set_allocated:deepflow.FrozenParam.shared_weights)
+}
+
+// -------------------------------------------------------------------
+
 // BlockParam
 
 // repeated .deepflow.NodeParam node = 1;
@@ -12168,6 +14018,45 @@ BlockParam::initializer() const {
   return initializer_;
 }
 
+// .deepflow.FrozenParam frozen_param = 5;
+inline bool BlockParam::has_frozen_param() const {
+  return this != internal_default_instance() && frozen_param_ != NULL;
+}
+inline void BlockParam::clear_frozen_param() {
+  if (GetArenaNoVirtual() == NULL && frozen_param_ != NULL) delete frozen_param_;
+  frozen_param_ = NULL;
+}
+inline const ::deepflow::FrozenParam& BlockParam::frozen_param() const {
+  // @@protoc_insertion_point(field_get:deepflow.BlockParam.frozen_param)
+  return frozen_param_ != NULL ? *frozen_param_
+                         : *::deepflow::FrozenParam::internal_default_instance();
+}
+inline ::deepflow::FrozenParam* BlockParam::mutable_frozen_param() {
+  
+  if (frozen_param_ == NULL) {
+    frozen_param_ = new ::deepflow::FrozenParam;
+  }
+  // @@protoc_insertion_point(field_mutable:deepflow.BlockParam.frozen_param)
+  return frozen_param_;
+}
+inline ::deepflow::FrozenParam* BlockParam::release_frozen_param() {
+  // @@protoc_insertion_point(field_release:deepflow.BlockParam.frozen_param)
+  
+  ::deepflow::FrozenParam* temp = frozen_param_;
+  frozen_param_ = NULL;
+  return temp;
+}
+inline void BlockParam::set_allocated_frozen_param(::deepflow::FrozenParam* frozen_param) {
+  delete frozen_param_;
+  frozen_param_ = frozen_param;
+  if (frozen_param) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:deepflow.BlockParam.frozen_param)
+}
+
 // -------------------------------------------------------------------
 
 // ConcateParam
@@ -12894,6 +14783,20 @@ inline void NodeParam::set_data_policy(::deepflow::NodeParam_DataPolicy value) {
   // @@protoc_insertion_point(field_set:deepflow.NodeParam.data_policy)
 }
 
+// .deepflow.NodeParam.Layout layout = 7;
+inline void NodeParam::clear_layout() {
+  layout_ = 0;
+}
+inline ::deepflow::NodeParam_Layout NodeParam::layout() const {
+  // @@protoc_insertion_point(field_get:deepflow.NodeParam.layout)
+  return static_cast< ::deepflow::NodeParam_Layout >(layout_);
+}
+inline void NodeParam::set_layout(::deepflow::NodeParam_Layout value) {
+  
+  layout_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.NodeParam.layout)
+}
+
 // .deepflow.VariableParam variable_param = 100;
 inline bool NodeParam::has_variable_param() const {
   return this != internal_default_instance() && variable_param_ != NULL;
@@ -15195,6 +17098,162 @@ inline void NodeParam::set_allocated_gabor_kernel_param(::deepflow::GaborKernelP
   // @@protoc_insertion_point(field_set_allocated:deepflow.NodeParam.gabor_kernel_param)
 }
 
+// .deepflow.SoftmaxCrossEntropyParam softmax_cross_entropy_param = 164;
+inline bool NodeParam::has_softmax_cross_entropy_param() const {
+  return this != internal_default_instance() && softmax_cross_entropy_param_ != NULL;
+}
+inline void NodeParam::clear_softmax_cross_entropy_param() {
+  if (GetArenaNoVirtual() == NULL && softmax_cross_entropy_param_ != NULL) delete softmax_cross_entropy_param_;
+  softmax_cross_entropy_param_ = NULL;
+}
+inline const ::deepflow::SoftmaxCrossEntropyParam& NodeParam::softmax_cross_entropy_param() const {
+  // @@protoc_insertion_point(field_get:deepflow.NodeParam.softmax_cross_entropy_param)
+  return softmax_cross_entropy_param_ != NULL ? *softmax_cross_entropy_param_
+                         : *::deepflow::SoftmaxCrossEntropyParam::internal_default_instance();
+}
+inline ::deepflow::SoftmaxCrossEntropyParam* NodeParam::mutable_softmax_cross_entropy_param() {
+  
+  if (softmax_cross_entropy_param_ == NULL) {
+    softmax_cross_entropy_param_ = new ::deepflow::SoftmaxCrossEntropyParam;
+  }
+  // @@protoc_insertion_point(field_mutable:deepflow.NodeParam.softmax_cross_entropy_param)
+  return softmax_cross_entropy_param_;
+}
+inline ::deepflow::SoftmaxCrossEntropyParam* NodeParam::release_softmax_cross_entropy_param() {
+  // @@protoc_insertion_point(field_release:deepflow.NodeParam.softmax_cross_entropy_param)
+  
+  ::deepflow::SoftmaxCrossEntropyParam* temp = softmax_cross_entropy_param_;
+  softmax_cross_entropy_param_ = NULL;
+  return temp;
+}
+inline void NodeParam::set_allocated_softmax_cross_entropy_param(::deepflow::SoftmaxCrossEntropyParam* softmax_cross_entropy_param) {
+  delete softmax_cross_entropy_param_;
+  softmax_cross_entropy_param_ = softmax_cross_entropy_param;
+  if (softmax_cross_entropy_param) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:deepflow.NodeParam.softmax_cross_entropy_param)
+}
+
+// .deepflow.FusedElementwiseParam fused_elementwise_param = 165;
+inline bool NodeParam::has_fused_elementwise_param() const {
+  return this != internal_default_instance() && fused_elementwise_param_ != NULL;
+}
+inline void NodeParam::clear_fused_elementwise_param() {
+  if (GetArenaNoVirtual() == NULL && fused_elementwise_param_ != NULL) delete fused_elementwise_param_;
+  fused_elementwise_param_ = NULL;
+}
+inline const ::deepflow::FusedElementwiseParam& NodeParam::fused_elementwise_param() const {
+  // @@protoc_insertion_point(field_get:deepflow.NodeParam.fused_elementwise_param)
+  return fused_elementwise_param_ != NULL ? *fused_elementwise_param_
+                         : *::deepflow::FusedElementwiseParam::internal_default_instance();
+}
+inline ::deepflow::FusedElementwiseParam* NodeParam::mutable_fused_elementwise_param() {
+  
+  if (fused_elementwise_param_ == NULL) {
+    fused_elementwise_param_ = new ::deepflow::FusedElementwiseParam;
+  }
+  // @@protoc_insertion_point(field_mutable:deepflow.NodeParam.fused_elementwise_param)
+  return fused_elementwise_param_;
+}
+inline ::deepflow::FusedElementwiseParam* NodeParam::release_fused_elementwise_param() {
+  // @@protoc_insertion_point(field_release:deepflow.NodeParam.fused_elementwise_param)
+  
+  ::deepflow::FusedElementwiseParam* temp = fused_elementwise_param_;
+  fused_elementwise_param_ = NULL;
+  return temp;
+}
+inline void NodeParam::set_allocated_fused_elementwise_param(::deepflow::FusedElementwiseParam* fused_elementwise_param) {
+  delete fused_elementwise_param_;
+  fused_elementwise_param_ = fused_elementwise_param;
+  if (fused_elementwise_param) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:deepflow.NodeParam.fused_elementwise_param)
+}
+
+// .deepflow.ReorderParam reorder_param = 166;
+inline bool NodeParam::has_reorder_param() const {
+  return this != internal_default_instance() && reorder_param_ != NULL;
+}
+inline void NodeParam::clear_reorder_param() {
+  if (GetArenaNoVirtual() == NULL && reorder_param_ != NULL) delete reorder_param_;
+  reorder_param_ = NULL;
+}
+inline const ::deepflow::ReorderParam& NodeParam::reorder_param() const {
+  // @@protoc_insertion_point(field_get:deepflow.NodeParam.reorder_param)
+  return reorder_param_ != NULL ? *reorder_param_
+                         : *::deepflow::ReorderParam::internal_default_instance();
+}
+inline ::deepflow::ReorderParam* NodeParam::mutable_reorder_param() {
+  
+  if (reorder_param_ == NULL) {
+    reorder_param_ = new ::deepflow::ReorderParam;
+  }
+  // @@protoc_insertion_point(field_mutable:deepflow.NodeParam.reorder_param)
+  return reorder_param_;
+}
+inline ::deepflow::ReorderParam* NodeParam::release_reorder_param() {
+  // @@protoc_insertion_point(field_release:deepflow.NodeParam.reorder_param)
+  
+  ::deepflow::ReorderParam* temp = reorder_param_;
+  reorder_param_ = NULL;
+  return temp;
+}
+inline void NodeParam::set_allocated_reorder_param(::deepflow::ReorderParam* reorder_param) {
+  delete reorder_param_;
+  reorder_param_ = reorder_param;
+  if (reorder_param) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:deepflow.NodeParam.reorder_param)
+}
+
+// .deepflow.SliceParam slice_param = 167;
+inline bool NodeParam::has_slice_param() const {
+  return this != internal_default_instance() && slice_param_ != NULL;
+}
+inline void NodeParam::clear_slice_param() {
+  if (GetArenaNoVirtual() == NULL && slice_param_ != NULL) delete slice_param_;
+  slice_param_ = NULL;
+}
+inline const ::deepflow::SliceParam& NodeParam::slice_param() const {
+  // @@protoc_insertion_point(field_get:deepflow.NodeParam.slice_param)
+  return slice_param_ != NULL ? *slice_param_
+                         : *::deepflow::SliceParam::internal_default_instance();
+}
+inline ::deepflow::SliceParam* NodeParam::mutable_slice_param() {
+  
+  if (slice_param_ == NULL) {
+    slice_param_ = new ::deepflow::SliceParam;
+  }
+  // @@protoc_insertion_point(field_mutable:deepflow.NodeParam.slice_param)
+  return slice_param_;
+}
+inline ::deepflow::SliceParam* NodeParam::release_slice_param() {
+  // @@protoc_insertion_point(field_release:deepflow.NodeParam.slice_param)
+  
+  ::deepflow::SliceParam* temp = slice_param_;
+  slice_param_ = NULL;
+  return temp;
+}
+inline void NodeParam::set_allocated_slice_param(::deepflow::SliceParam* slice_param) {
+  delete slice_param_;
+  slice_param_ = slice_param;
+  if (slice_param) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:deepflow.NodeParam.slice_param)
+}
+
 #endif  // !PROTOBUF_INLINE_NOT_IN_HEADERS
 // -------------------------------------------------------------------
 
@@ -15352,6 +17411,22 @@ inline void NodeParam::set_allocated_gabor_kernel_param(::deepflow::GaborKernelP
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -15372,6 +17447,16 @@ template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::deepflow::LossParam_ReduceOp>() {
   return ::deepflow::LossParam_ReduceOp_descriptor();
 }
+template <> struct is_proto_enum< ::deepflow::PoolingParam_Mode> : ::google::protobuf::internal::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::deepflow::PoolingParam_Mode>() {
+  return ::deepflow::PoolingParam_Mode_descriptor();
+}
+template <> struct is_proto_enum< ::deepflow::PointwiseStage_Op> : ::google::protobuf::internal::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::deepflow::PointwiseStage_Op>() {
+  return ::deepflow::PointwiseStage_Op_descriptor();
+}
 template <> struct is_proto_enum< ::deepflow::ReduceAllParam_ReduceAllOp> : ::google::protobuf::internal::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::deepflow::ReduceAllParam_ReduceAllOp>() {
@@ -15412,6 +17497,11 @@ template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::deepflow::BatchNormalizationParam_Mode>() {
   return ::deepflow::BatchNormalizationParam_Mode_descriptor();
 }
+template <> struct is_proto_enum< ::deepflow::ResizeParam_Mode> : ::google::protobuf::internal::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::deepflow::ResizeParam_Mode>() {
+  return ::deepflow::ResizeParam_Mode_descriptor();
+}
 template <> struct is_proto_enum< ::deepflow::SoftmaxParam_Mode> : ::google::protobuf::internal::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::deepflow::SoftmaxParam_Mode>() {
@@ -15432,6 +17522,11 @@ template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::deepflow::NodeParam_DataPolicy>() {
   return ::deepflow::NodeParam_DataPolicy_descriptor();
 }
+template <> struct is_proto_enum< ::deepflow::NodeParam_Layout> : ::google::protobuf::internal::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::deepflow::NodeParam_Layout>() {
+  return ::deepflow::NodeParam_Layout_descriptor();
+}
 template <> struct is_proto_enum< ::deepflow::ActionType> : ::google::protobuf::internal::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::deepflow::ActionType>() {
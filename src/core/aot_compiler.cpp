@@ -0,0 +1,694 @@
+#include "core/aot_compiler.h"
+
+#include "core/session.h"
+#include "nodes/variable.h"
+#include "nodes/batch_normalization.h"
+
+#include <sstream>
+#include <cstdio>
+#include <cmath>
+#include <limits>
+
+AotCompiler::AotCompiler(Session * session, bool verbose)
+{
+	_session = session;
+	_verbose = verbose;
+}
+
+std::string AotCompiler::compile(std::list<std::string> fetches, const std::string & name)
+{
+	LOG_IF(FATAL, !_session->_initialized) << "Session must be initialized before AOT compilation.";
+	LOG_IF(FATAL, fetches.empty()) << "At least one fetch node is required for AOT compilation.";
+	std::list<std::shared_ptr<Node>> fetch_nodes;
+	for (auto fetch : fetches) {
+		auto node = _session->_find_node_by_name(fetch, "");
+		LOG_IF(FATAL, node == nullptr) << "Node " << fetch << " does not exist.";
+		fetch_nodes.push_back(node);
+		_fetched_outputs.insert(node->output(0)->name());
+	}
+	std::set<Node*> visited;
+	std::list<std::shared_ptr<Node>> order;
+	for (auto node : fetch_nodes)
+		_collect(node, visited, order);
+	_compiled = visited;
+
+	for (auto node : order) {
+		LOG_IF(INFO, _verbose) << "AOT " << node->op_name() << " " << node->name();
+		_compile_node(node);
+		++_step;
+	}
+	_flush();
+
+	std::list<std::pair<std::string, int>> outputs;
+	for (auto node : fetch_nodes) {
+		int buffer = _output_buffers[node->output(0)->name()];
+		_buffers[buffer].last_step = std::numeric_limits<int>::max();
+		auto symbol = _symbol(node->name());
+		outputs.push_back({ symbol, buffer });
+		_body += "\tstd::memcpy(" + symbol + ", " + _ptr(buffer) + ", sizeof(float) * " + std::to_string(_buffers[buffer].size) + ");\n";
+	}
+	_plan_arena();
+
+	std::string code = "// Generated by Session::to_aot_cpp - do not edit.\n\n";
+	code += "#include <cmath>\n#include <cstring>\n#include <algorithm>\n#include <limits>\n\n";
+	code += "namespace " + _symbol(name) + " {\n\n";
+	code += "namespace kernels {\n\n";
+	for (auto kernel : _kernels)
+		code += _kernel_source(kernel) + "\n";
+	code += "} // namespace kernels\n\n";
+
+	std::ostringstream constants;
+	for (auto &item : _constant_values) {
+		auto &values = item.second;
+		constants << "alignas(64) static const float " << _buffers[item.first].symbol << "[" << values.size() << "] = {";
+		for (size_t i = 0; i < values.size(); ++i) {
+			if (i % 8 == 0)
+				constants << "\n\t";
+			constants << _float(values[i]) << (i + 1 < values.size() ? ", " : "");
+		}
+		constants << "\n};\n\n";
+	}
+	code += constants.str();
+
+	std::string signature;
+	for (auto &buffer : _buffers) {
+		if (buffer.kind == Buffer::INPUT) {
+			code += "constexpr int " + buffer.symbol + "_size = " + std::to_string(buffer.size) + ";\n";
+			signature += (signature.empty() ? "" : ", ") + std::string("const float * __restrict ") + buffer.symbol;
+		}
+	}
+	for (auto &output : outputs) {
+		code += "constexpr int " + output.first + "_size = " + std::to_string(_buffers[output.second].size) + ";\n";
+		signature += (signature.empty() ? "" : ", ") + std::string("float * __restrict ") + output.first;
+	}
+	code += "constexpr int arena_size = " + std::to_string(std::max(_arena_size, 1)) + ";\n\n";
+	code += "alignas(64) static float arena[arena_size];\n\n";
+	code += "void run(" + signature + ")\n{\n" + _body + "}\n\n";
+	code += "} // namespace " + _symbol(name) + "\n";
+
+	for (size_t i = 0; i < _buffers.size(); ++i) {
+		auto &buffer = _buffers[i];
+		std::string ptr = (buffer.kind == Buffer::ARENA) ? "(arena + " + std::to_string(buffer.offset) + ")" : buffer.symbol;
+		std::string tag = _ptr((int)i);
+		for (size_t pos = code.find(tag); pos != std::string::npos; pos = code.find(tag, pos + ptr.size()))
+			code.replace(pos, tag.size(), ptr);
+	}
+
+	if (_verbose) {
+		size_t activations = 0;
+		for (auto &buffer : _buffers)
+			if (buffer.kind == Buffer::ARENA)
+				activations += buffer.size;
+		LOG(INFO) << "AOT " << name << ": " << order.size() << " nodes, arena " << _arena_size * sizeof(float) << " bytes (" << activations * sizeof(float) << " bytes unplanned)";
+	}
+	return code;
+}
+
+void AotCompiler::_collect(std::shared_ptr<Node> node, std::set<Node*>& visited, std::list<std::shared_ptr<Node>>& order)
+{
+	if (visited.find(node.get()) != visited.end())
+		return;
+	visited.insert(node.get());
+	for (auto input : node->inputs()) {
+		auto input_node = input->connectedNode();
+		LOG_IF(FATAL, input_node == nullptr) << node->name() << " has an unconnected input.";
+		_collect(input_node, visited, order);
+	}
+	order.push_back(node);
+}
+
+std::string AotCompiler::_symbol(const std::string & name) const
+{
+	std::string symbol = name;
+	for (auto &c : symbol)
+		if (!isalnum((unsigned char)c))
+			c = '_';
+	if (symbol.empty() || isdigit((unsigned char)symbol[0]))
+		symbol = "_" + symbol;
+	return symbol;
+}
+
+std::string AotCompiler::_float(float value)
+{
+	if (std::isinf(value))
+		return value > 0 ? "std::numeric_limits<float>::infinity()" : "-std::numeric_limits<float>::infinity()";
+	if (std::isnan(value))
+		return "std::numeric_limits<float>::quiet_NaN()";
+	char text[32];
+	snprintf(text, sizeof(text), "%.9g", value);
+	std::string literal = text;
+	if (literal.find_first_of(".e") == std::string::npos)
+		literal += ".0";
+	return literal + "f";
+}
+
+std::string AotCompiler::_ptr(int buffer) const
+{
+	return "@B" + std::to_string(buffer) + "@";
+}
+
+int AotCompiler::_new_buffer(Buffer::Kind kind, int size, const std::string & symbol)
+{
+	Buffer buffer;
+	buffer.kind = kind;
+	buffer.size = size;
+	buffer.symbol = symbol;
+	buffer.first_step = _step;
+	buffer.last_step = _step;
+	_buffers.push_back(buffer);
+	return (int)_buffers.size() - 1;
+}
+
+int AotCompiler::_constant(const std::string & name, const std::vector<float>& values)
+{
+	std::string symbol = "w_" + _symbol(name);
+	while (_symbols.find(symbol) != _symbols.end())
+		symbol += "_";
+	_symbols.insert(symbol);
+	int buffer = _new_buffer(Buffer::CONSTANT, (int)values.size(), symbol);
+	_constant_values[buffer] = values;
+	return buffer;
+}
+
+void AotCompiler::_set_output(std::shared_ptr<Node> node, int index, int buffer)
+{
+	auto output = node->output(index);
+	int readers = 0;
+	for (auto terminal : output->connectedTerminals())
+		if (_compiled.find(terminal->parentNode().get()) != _compiled.end())
+			++readers;
+	_buffers[buffer].pending_reads += readers;
+	if (_fetched_outputs.find(output->name()) != _fetched_outputs.end())
+		_buffers[buffer].fetched = true;
+	_output_buffers[output->name()] = buffer;
+}
+
+int AotCompiler::_input(std::shared_ptr<Node> node, int index)
+{
+	auto terminal = node->input(index)->connectedTerminal();
+	auto it = _output_buffers.find(terminal->name());
+	LOG_IF(FATAL, it == _output_buffers.end()) << node->name() << " - input " << terminal->name() << " is not compiled.";
+	return it->second;
+}
+
+void AotCompiler::_read(int buffer)
+{
+	_buffers[buffer].pending_reads--;
+	_buffers[buffer].last_step = std::max(_buffers[buffer].last_step, _step);
+}
+
+bool AotCompiler::_can_overwrite(int buffer) const
+{
+	auto &b = _buffers[buffer];
+	return b.kind == Buffer::ARENA && b.pending_reads == 0 && !b.fetched;
+}
+
+void AotCompiler::_pointwise(std::shared_ptr<Node> node, int num_inputs, const std::string & head, const std::string & statement, std::initializer_list<int> param_buffers)
+{
+	auto dims = node->output(0)->dims();
+	std::vector<int> inputs;
+	for (int i = 0; i < num_inputs; ++i) {
+		inputs.push_back(_input(node, i));
+		_read(inputs.back());
+	}
+	for (auto buffer : param_buffers)
+		_read(buffer);
+	if (num_inputs == 1 && _group.open && _group.output == inputs[0] && _group.dims == dims && _can_overwrite(inputs[0])) {
+		// Extend the open loop, the previous result is only consumed here.
+		if (!statement.empty())
+			_group.statements.push_back(statement);
+	}
+	else {
+		_flush();
+		_group.open = true;
+		_group.dims = dims;
+		_group.statements.clear();
+		if (!statement.empty())
+			_group.statements.push_back(statement);
+		_group.reads.assign(inputs.begin(), inputs.end());
+		std::string a = _ptr(inputs[0]) + "[i]";
+		std::string b = num_inputs > 1 ? _ptr(inputs[1]) + "[i]" : "";
+		std::string expr = head;
+		for (size_t pos = expr.find("$a"); pos != std::string::npos; pos = expr.find("$a"))
+			expr.replace(pos, 2, a);
+		for (size_t pos = expr.find("$b"); pos != std::string::npos; pos = expr.find("$b"))
+			expr.replace(pos, 2, b);
+		_group.head = expr;
+		_group.output = -1;
+		for (auto input : inputs) {
+			if (_can_overwrite(input) && _buffers[input].size == _buffers[inputs[0]].size) {
+				_group.output = input;
+				break;
+			}
+		}
+		if (_group.output == -1)
+			_group.output = _new_buffer(Buffer::ARENA, dims[0] * dims[1] * dims[2] * dims[3], "");
+	}
+	for (auto buffer : param_buffers)
+		_group.reads.push_back(buffer);
+	_group.uses_channel |= statement.find("[c]") != std::string::npos;
+	_group.uses_feature |= statement.find("[f]") != std::string::npos;
+	_set_output(node, 0, _group.output);
+}
+
+void AotCompiler::_flush()
+{
+	if (!_group.open)
+		return;
+	for (auto buffer : _group.reads)
+		_buffers[buffer].last_step = std::max(_buffers[buffer].last_step, _step);
+	_buffers[_group.output].last_step = std::max(_buffers[_group.output].last_step, _step);
+	auto &d = _group.dims;
+	std::string hw = std::to_string(d[2] * d[3]);
+	std::string loop = "\tfor (int n = 0; n < " + std::to_string(d[0]) + "; ++n)\n";
+	loop += "\t\tfor (int c = 0; c < " + std::to_string(d[1]) + "; ++c)\n";
+	loop += "\t\t\tfor (int s = 0; s < " + hw + "; ++s) {\n";
+	loop += "\t\t\t\tconst int i = (n * " + std::to_string(d[1]) + " + c) * " + hw + " + s;\n";
+	if (_group.uses_feature)
+		loop += "\t\t\t\tconst int f = c * " + hw + " + s;\n";
+	loop += "\t\t\t\tfloat v = " + _group.head + ";\n";
+	for (auto statement : _group.statements)
+		loop += "\t\t\t\t" + statement + "\n";
+	loop += "\t\t\t\t" + _ptr(_group.output) + "[i] = v;\n";
+	loop += "\t\t\t}\n";
+	_body += loop;
+	_group = Group();
+}
+
+void AotCompiler::_compile_node(std::shared_ptr<Node> node)
+{
+	auto param = node->param();
+	auto op = node->op_name();
+	auto dims = node->output(0)->dims();
+	auto dims_str = [](std::array<int, 4> d) {
+		return std::to_string(d[0]) + ", " + std::to_string(d[1]) + ", " + std::to_string(d[2]) + ", " + std::to_string(d[3]);
+	};
+	int size = dims[0] * dims[1] * dims[2] * dims[3];
+
+	if (op == "place_holder") {
+		std::string symbol = _symbol(node->name());
+		_symbols.insert(symbol);
+		_set_output(node, 0, _new_buffer(Buffer::INPUT, size, symbol));
+	}
+	else if (op == "variable") {
+		node->prep_for_saving();
+		auto &weights = param->variable_param().weights().data();
+		_set_output(node, 0, _constant(node->name(), std::vector<float>(weights.begin(), weights.end())));
+	}
+	else if (op == "split" || op == "pass_through" || op == "reshape" || op == "dropout") {
+		// Pure forwarding nodes (dropout is the identity at inference) alias their input.
+		int input = _input(node, 0);
+		_read(input);
+		for (int i = 0; i < (int)node->outputs().size(); ++i)
+			_set_output(node, i, input);
+	}
+	else if (op == "conv2d" || op == "transposed_conv2d") {
+		_flush();
+		int x = _input(node, 0), w = _input(node, 1);
+		_read(x);
+		_read(w);
+		auto xd = node->input(0)->dims();
+		auto wd = node->input(1)->dims();
+		bool transposed = (op == "transposed_conv2d");
+		int pad_h, pad_w, u, v, dilation_h, dilation_w;
+		if (transposed) {
+			auto &p = param->transposed_conv_2d_param();
+			pad_h = p.pad_h(), pad_w = p.pad_w(), u = p.u(), v = p.v(), dilation_h = p.dilation_h(), dilation_w = p.dilation_w();
+		}
+		else {
+			auto &p = param->conv_2d_param();
+			pad_h = p.pad_h(), pad_w = p.pad_w(), u = p.u(), v = p.v(), dilation_h = p.dilation_h(), dilation_w = p.dilation_w();
+		}
+		int y = _new_buffer(Buffer::ARENA, size, "");
+		std::string kernel = transposed ? "transposed_conv2d" : "conv2d";
+		_kernels.insert(kernel);
+		_body += "\tkernels::" + kernel + "<" + dims_str(xd) + ", " + std::to_string(transposed ? wd[1] : wd[0]) + ", " + std::to_string(wd[2]) + ", " + std::to_string(wd[3]) + ", " +
+			std::to_string(pad_h) + ", " + std::to_string(pad_w) + ", " + std::to_string(u) + ", " + std::to_string(v) + ", " +
+			std::to_string(dilation_h) + ", " + std::to_string(dilation_w) + ", " + std::to_string(dims[2]) + ", " + std::to_string(dims[3]) + ">(" +
+			_ptr(x) + ", " + _ptr(w) + ", " + _ptr(y) + ");\n";
+		_set_output(node, 0, y);
+		if (!transposed)
+			_epilogue(node, y, param->conv_2d_param().epilogue());
+	}
+	else if (op == "matmul") {
+		_flush();
+		int a = _input(node, 0), b = _input(node, 1);
+		_read(a);
+		_read(b);
+		auto ad = node->input(0)->dims();
+		int y = _new_buffer(Buffer::ARENA, size, "");
+		_kernels.insert("matmul");
+		_body += "\tkernels::matmul<" + std::to_string(ad[0]) + ", " + std::to_string(ad[1] * ad[2] * ad[3]) + ", " + std::to_string(dims[1] * dims[2] * dims[3]) + ">(" + _ptr(a) + ", " + _ptr(b) + ", " + _ptr(y) + ");\n";
+		_set_output(node, 0, y);
+		_epilogue(node, y, param->matmul_param().epilogue());
+	}
+	else if (op == "pooling") {
+		_flush();
+		int x = _input(node, 0);
+		_read(x);
+		auto p = param->pooling_param();
+		int y = _new_buffer(Buffer::ARENA, size, "");
+		std::string args = dims_str(node->input(0)->dims()) + ", " + std::to_string(p.window_h()) + ", " + std::to_string(p.window_w()) + ", " +
+			std::to_string(p.v_pad()) + ", " + std::to_string(p.h_pad()) + ", " + std::to_string(p.v_stride()) + ", " + std::to_string(p.h_stride()) + ", " +
+			std::to_string(dims[2]) + ", " + std::to_string(dims[3]);
+		if (p.mode() == deepflow::PoolingParam_Mode_MAX) {
+			_kernels.insert("max_pool");
+			_body += "\tkernels::max_pool<" + args + ">(" + _ptr(x) + ", " + _ptr(y) + ");\n";
+		}
+		else {
+			_kernels.insert("avg_pool");
+			std::string count_padding = p.mode() == deepflow::PoolingParam_Mode_AVERAGE_COUNT_INCLUDE_PADDING ? "true" : "false";
+			_body += "\tkernels::avg_pool<" + args + ", " + count_padding + ">(" + _ptr(x) + ", " + _ptr(y) + ");\n";
+		}
+		_set_output(node, 0, y);
+	}
+	else if (op == "softmax") {
+		_flush();
+		int x = _input(node, 0);
+		_read(x);
+		int y = _can_overwrite(x) ? x : _new_buffer(Buffer::ARENA, size, "");
+		_kernels.insert("softmax");
+		bool by_channel = param->softmax_param().mode() == deepflow::SoftmaxParam_Mode_CHANNEL;
+		int channels = by_channel ? dims[1] : dims[1] * dims[2] * dims[3];
+		int stride = by_channel ? dims[2] * dims[3] : 1;
+		_body += "\tkernels::softmax<" + std::to_string(dims[0]) + ", " + std::to_string(channels) + ", " + std::to_string(stride) + ">(" + _ptr(x) + ", " + _ptr(y) + ");\n";
+		_set_output(node, 0, y);
+	}
+	else if (op == "concate") {
+		_flush();
+		int y = _new_buffer(Buffer::ARENA, size, "");
+		_kernels.insert("concat");
+		int offset = 0;
+		for (int i = 0; i < (int)node->inputs().size(); ++i) {
+			int x = _input(node, i);
+			_read(x);
+			auto xd = node->input(i)->dims();
+			_body += "\tkernels::concat<" + std::to_string(dims[0]) + ", " + std::to_string(xd[1]) + ", " + std::to_string(dims[1]) + ", " + std::to_string(offset) + ", " + std::to_string(dims[2] * dims[3]) + ">(" + _ptr(x) + ", " + _ptr(y) + ");\n";
+			offset += xd[1];
+		}
+		_set_output(node, 0, y);
+	}
+	else if (op == "bias_add") {
+		int b = _input(node, 1);
+		int bias_size = _buffers[b].size;
+		LOG_IF(FATAL, bias_size != dims[1] && bias_size != dims[1] * dims[2] * dims[3]) << node->name() << " - Unsupported bias shape for AOT compilation.";
+		_pointwise(node, 1, "$a", "v += " + _ptr(b) + (bias_size == dims[1] ? "[c];" : "[f];"), { b });
+	}
+	else if (op == "batch_normalization") {
+		int s = _input(node, 1), b = _input(node, 2);
+		LOG_IF(FATAL, _buffers[s].kind != Buffer::CONSTANT || _buffers[b].kind != Buffer::CONSTANT) << node->name() << " - Scale and bias must be variables for AOT compilation.";
+		node->prep_for_saving();
+		auto &bn = param->batch_normalization_param();
+		float eps = std::max(bn.eps(), (float)CUDNN_BN_MIN_EPSILON);
+		auto &scale = _constant_values[s], &bias = _constant_values[b];
+		// Inference batch normalization folds into a single multiply-add.
+		std::vector<float> a(scale.size()), c(scale.size());
+		for (size_t i = 0; i < scale.size(); ++i) {
+			a[i] = scale[i] / sqrtf(bn.var().data(i) + eps);
+			c[i] = bias[i] - bn.mean().data(i) * a[i];
+		}
+		int ab = _constant(node->name() + "_a", a), cb = _constant(node->name() + "_b", c);
+		_read(s);
+		_read(b);
+		std::string index = (bn.mode() == deepflow::BatchNormalizationParam_Mode_CUDNN_BATCHNORM_SPATIAL) ? "[c]" : "[f]";
+		_pointwise(node, 1, "$a", "v = v * " + _ptr(ab) + index + " + " + _ptr(cb) + index + ";", { ab, cb });
+	}
+	else if (param->has_activation_param()) {
+		float coef = param->activation_param().coef();
+		std::string statement;
+		switch (param->activation_param().type()) {
+		case deepflow::ActivationParam_Type_CUDNN_ACTIVATION_SIGMOID:
+			statement = "v = 1.0f / (1.0f + std::exp(-v));";
+			break;
+		case deepflow::ActivationParam_Type_CUDNN_ACTIVATION_RELU:
+			statement = "v = v > 0.0f ? v : 0.0f;";
+			break;
+		case deepflow::ActivationParam_Type_CUDNN_ACTIVATION_TANH:
+			statement = "v = std::tanh(v);";
+			break;
+		case deepflow::ActivationParam_Type_CUDNN_ACTIVATION_CLIPPED_RELU:
+			statement = "v = std::min(std::max(v, 0.0f), " + _float(coef) + ");";
+			break;
+		case deepflow::ActivationParam_Type_CUDNN_ACTIVATION_ELU:
+			statement = "v = v > 0.0f ? v : " + _float(coef) + " * (std::exp(v) - 1.0f);";
+			break;
+		default:
+			LOG(FATAL) << node->name() << " - Unsupported activation.";
+		}
+		_pointwise(node, 1, "$a", statement);
+	}
+	else if (op == "leaky_relu") {
+		_pointwise(node, 1, "$a", "v = v > 0.0f ? v : v * " + _float(param->leaky_relu_param().negative_slope()) + ";");
+	}
+	else if (op == "prelu") {
+		int w = _input(node, 1);
+		_pointwise(node, 1, "$a", "v = v > 0.0f ? v : v * " + _ptr(w) + "[c];", { w });
+	}
+	else if (op == "exp") {
+		_pointwise(node, 1, "$a", "v = std::exp(v);");
+	}
+	else if (op == "log") {
+		_pointwise(node, 1, "$a", "v = " + _float(param->log_param().coef()) + " * std::log(v);");
+	}
+	else if (op == "abs") {
+		_pointwise(node, 1, "$a", "v = std::fabs(v);");
+	}
+	else if (op == "square") {
+		_pointwise(node, 1, "$a", "v = v * v;");
+	}
+	else if (op == "add" || op == "subtract") {
+		auto &p = param->add_param();
+		_pointwise(node, 2, _float(p.alpha()) + " * $a + " + _float(p.beta()) + " * $b", "");
+	}
+	else if (op == "fused_elementwise") {
+		std::string statements;
+		for (auto &stage : param->fused_elementwise_param().stage()) {
+			auto statement = _stage(stage);
+			if (!statement.empty())
+				statements += (statements.empty() ? "" : " ") + statement;
+		}
+		_pointwise(node, 1, "$a", statements);
+	}
+	else if (op == "dot") {
+		_pointwise(node, 2, "$a * $b", "");
+	}
+	else if (op == "max") {
+		_pointwise(node, 2, "std::max($a, $b)", "");
+	}
+	else {
+		LOG(FATAL) << node->name() << " - " << op << " is not supported by the AOT compiler.";
+	}
+}
+
+std::string AotCompiler::_stage(const deepflow::PointwiseStage &stage)
+{
+	std::string coef = _float(stage.coef());
+	switch (stage.op()) {
+	case deepflow::PointwiseStage_Op_IDENTITY: return "";
+	case deepflow::PointwiseStage_Op_SIGMOID: return "v = 1.0f / (1.0f + std::exp(-v));";
+	case deepflow::PointwiseStage_Op_RELU: return "v = v > 0.0f ? v : 0.0f;";
+	case deepflow::PointwiseStage_Op_TANH: return "v = std::tanh(v);";
+	case deepflow::PointwiseStage_Op_CLIPPED_RELU: return "v = std::min(std::max(v, 0.0f), " + coef + ");";
+	case deepflow::PointwiseStage_Op_ELU: return "v = v > 0.0f ? v : " + coef + " * (std::exp(v) - 1.0f);";
+	case deepflow::PointwiseStage_Op_LEAKY_RELU: return "v = v > 0.0f ? v : v * " + coef + ";";
+	case deepflow::PointwiseStage_Op_EXP: return "v = std::exp(v);";
+	case deepflow::PointwiseStage_Op_LOG: return "v = " + coef + " * std::log(v);";
+	case deepflow::PointwiseStage_Op_ABS: return "v = std::fabs(v);";
+	case deepflow::PointwiseStage_Op_SQUARE: return "v = v * v;";
+	default:
+		LOG(FATAL) << "Unsupported pointwise stage " << stage.op() << " for AOT compilation.";
+		return "";
+	}
+}
+
+void AotCompiler::_epilogue(std::shared_ptr<Node> node, int y, const deepflow::EpilogueParam &epilogue)
+{
+	if (!epilogue.bias() && epilogue.activation().op() == deepflow::PointwiseStage_Op_IDENTITY)
+		return;
+	// Bias (per channel, per column of a matmul) and activation of a fused node open a loop over its
+	// output, later pointwise nodes extend it.
+	_group.open = true;
+	_group.dims = node->output(0)->dims();
+	_group.output = y;
+	_group.head = _ptr(y) + "[i]";
+	if (epilogue.bias()) {
+		int b = _input(node, 2);
+		_read(b);
+		_group.reads.push_back(b);
+		_group.statements.push_back("v += " + _ptr(b) + "[c];");
+		_group.uses_channel = true;
+	}
+	if (!_stage(epilogue.activation()).empty())
+		_group.statements.push_back(_stage(epilogue.activation()));
+}
+
+void AotCompiler::_plan_arena()
+{
+	// Greedy first fit in definition order, buffers whose lifetimes do not overlap share memory.
+	std::list<int> placed;
+	for (int i = 0; i < (int)_buffers.size(); ++i) {
+		auto &buffer = _buffers[i];
+		if (buffer.kind != Buffer::ARENA)
+			continue;
+		int size = (buffer.size + 15) / 16 * 16;
+		std::list<std::pair<int, int>> busy;
+		for (auto j : placed) {
+			auto &other = _buffers[j];
+			if (other.first_step <= buffer.last_step && buffer.first_step <= other.last_step)
+				busy.push_back({ other.offset, other.offset + (other.size + 15) / 16 * 16 });
+		}
+		busy.sort();
+		int offset = 0;
+		for (auto range : busy) {
+			if (offset + size <= range.first)
+				break;
+			offset = std::max(offset, range.second);
+		}
+		buffer.offset = offset;
+		_arena_size = std::max(_arena_size, offset + size);
+		placed.push_back(i);
+	}
+}
+
+std::string AotCompiler::_kernel_source(const std::string & kernel)
+{
+	if (kernel == "conv2d") return R"(template <int N, int C, int H, int W, int K, int KH, int KW, int PH, int PW, int SH, int SW, int DH, int DW, int OH, int OW>
+inline void conv2d(const float * __restrict x, const float * __restrict w, float * __restrict y)
+{
+	for (int n = 0; n < N; ++n)
+		for (int k = 0; k < K; ++k) {
+			float *yk = y + (n * K + k) * OH * OW;
+			std::fill(yk, yk + OH * OW, 0.0f);
+			for (int c = 0; c < C; ++c) {
+				const float *xc = x + (n * C + c) * H * W;
+				for (int kh = 0; kh < KH; ++kh)
+					for (int kw = 0; kw < KW; ++kw) {
+						const float wv = w[((k * C + c) * KH + kh) * KW + kw];
+						const int hi = W - 1 + PW - kw * DW;
+						const int ow_begin = std::max(0, (PW - kw * DW + SW - 1) / SW);
+						const int ow_end = hi < 0 ? 0 : std::min(OW, hi / SW + 1);
+						for (int oh = 0; oh < OH; ++oh) {
+							const int ih = oh * SH - PH + kh * DH;
+							if (ih < 0 || ih >= H)
+								continue;
+							const float *xr = xc + ih * W - PW + kw * DW;
+							float *yr = yk + oh * OW;
+							for (int ow = ow_begin; ow < ow_end; ++ow)
+								yr[ow] += wv * xr[ow * SW];
+						}
+					}
+			}
+		}
+}
+)";
+	if (kernel == "transposed_conv2d") return R"(template <int N, int C, int H, int W, int K, int KH, int KW, int PH, int PW, int SH, int SW, int DH, int DW, int OH, int OW>
+inline void transposed_conv2d(const float * __restrict x, const float * __restrict w, float * __restrict y)
+{
+	std::fill(y, y + N * K * OH * OW, 0.0f);
+	for (int n = 0; n < N; ++n)
+		for (int c = 0; c < C; ++c) {
+			const float *xc = x + (n * C + c) * H * W;
+			for (int k = 0; k < K; ++k) {
+				float *yk = y + (n * K + k) * OH * OW;
+				for (int kh = 0; kh < KH; ++kh)
+					for (int kw = 0; kw < KW; ++kw) {
+						const float wv = w[((c * K + k) * KH + kh) * KW + kw];
+						for (int ih = 0; ih < H; ++ih) {
+							const int oh = ih * SH - PH + kh * DH;
+							if (oh < 0 || oh >= OH)
+								continue;
+							for (int iw = 0; iw < W; ++iw) {
+								const int ow = iw * SW - PW + kw * DW;
+								if (ow >= 0 && ow < OW)
+									yk[oh * OW + ow] += wv * xc[ih * W + iw];
+							}
+						}
+					}
+			}
+		}
+}
+)";
+	if (kernel == "matmul") return R"(template <int M, int K, int N>
+inline void matmul(const float * __restrict a, const float * __restrict b, float * __restrict c)
+{
+	for (int m = 0; m < M; ++m) {
+		float *cm = c + m * N;
+		std::fill(cm, cm + N, 0.0f);
+		for (int k = 0; k < K; ++k) {
+			const float av = a[m * K + k];
+			const float *bk = b + k * N;
+			for (int n = 0; n < N; ++n)
+				cm[n] += av * bk[n];
+		}
+	}
+}
+)";
+	if (kernel == "max_pool") return R"(template <int N, int C, int H, int W, int KH, int KW, int PH, int PW, int SH, int SW, int OH, int OW>
+inline void max_pool(const float * __restrict x, float * __restrict y)
+{
+	for (int nc = 0; nc < N * C; ++nc) {
+		const float *xc = x + nc * H * W;
+		float *yc = y + nc * OH * OW;
+		for (int oh = 0; oh < OH; ++oh) {
+			const int h0 = std::max(oh * SH - PH, 0), h1 = std::min(oh * SH - PH + KH, H);
+			for (int ow = 0; ow < OW; ++ow) {
+				const int w0 = std::max(ow * SW - PW, 0), w1 = std::min(ow * SW - PW + KW, W);
+				float m = -std::numeric_limits<float>::max();
+				for (int h = h0; h < h1; ++h)
+					for (int w = w0; w < w1; ++w)
+						m = std::max(m, xc[h * W + w]);
+				yc[oh * OW + ow] = m;
+			}
+		}
+	}
+}
+)";
+	if (kernel == "avg_pool") return R"(template <int N, int C, int H, int W, int KH, int KW, int PH, int PW, int SH, int SW, int OH, int OW, bool COUNT_PADDING>
+inline void avg_pool(const float * __restrict x, float * __restrict y)
+{
+	for (int nc = 0; nc < N * C; ++nc) {
+		const float *xc = x + nc * H * W;
+		float *yc = y + nc * OH * OW;
+		for (int oh = 0; oh < OH; ++oh) {
+			const int h0 = std::max(oh * SH - PH, 0), h1 = std::min(oh * SH - PH + KH, H);
+			for (int ow = 0; ow < OW; ++ow) {
+				const int w0 = std::max(ow * SW - PW, 0), w1 = std::min(ow * SW - PW + KW, W);
+				float sum = 0;
+				for (int h = h0; h < h1; ++h)
+					for (int w = w0; w < w1; ++w)
+						sum += xc[h * W + w];
+				yc[oh * OW + ow] = sum / (COUNT_PADDING ? KH * KW : std::max((h1 - h0) * (w1 - w0), 1));
+			}
+		}
+	}
+}
+)";
+	if (kernel == "softmax") return R"(template <int N, int C, int S>
+inline void softmax(const float *x, float *y)
+{
+	for (int n = 0; n < N; ++n)
+		for (int s = 0; s < S; ++s) {
+			const float *xs = x + n * C * S + s;
+			float *ys = y + n * C * S + s;
+			float m = xs[0];
+			for (int c = 1; c < C; ++c)
+				m = std::max(m, xs[c * S]);
+			float sum = 0;
+			for (int c = 0; c < C; ++c)
+				sum += (ys[c * S] = std::exp(xs[c * S] - m));
+			const float inv = 1.0f / sum;
+			for (int c = 0; c < C; ++c)
+				ys[c * S] *= inv;
+		}
+}
+)";
+	if (kernel == "concat") return R"(template <int N, int CI, int CO, int OFFSET, int HW>
+inline void concat(const float * __restrict x, float * __restrict y)
+{
+	for (int n = 0; n < N; ++n)
+		std::memcpy(y + (n * CO + OFFSET) * HW, x + n * CI * HW, sizeof(float) * CI * HW);
+}
+)";
+	LOG(FATAL) << "Unknown AOT kernel " << kernel;
+	return "";
+}
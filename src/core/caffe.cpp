@@ -1,6 +1,22 @@
 #include "core/caffe.h"
 
 #include <fstream>
+#include <climits>
+#include <cmath>
+
+#include <boost/filesystem.hpp>
+
+#include <google/protobuf/io/zero_copy_stream_impl.h>
+#include <google/protobuf/io/coded_stream.h>
+
+static void _raise_bytes_limit(google::protobuf::io::CodedInputStream *coded_input)
+{
+#if GOOGLE_PROTOBUF_VERSION >= 3006000
+	coded_input->SetTotalBytesLimit(INT_MAX);
+#else
+	coded_input->SetTotalBytesLimit(INT_MAX, 512 << 20);
+#endif
+}
 
 Caffe::Caffe(DeepFlow * df, bool verbose)
 {
@@ -8,18 +24,86 @@ Caffe::Caffe(DeepFlow * df, bool verbose)
 	_verbose = verbose;
 }
 
-void Caffe::load(std::string file_path, std::initializer_list<std::pair<std::string, std::array<int, 4>>> inputs)
+void Caffe::load(std::string file_path, std::initializer_list<std::pair<std::string, std::array<int, 4>>> inputs, std::string cache_file_path)
 {
+	if (!cache_file_path.empty() && _load_cache(file_path, cache_file_path, inputs))
+		return;
+	auto block_param = df->block()->block_param();
+	int first_node = block_param->node_size();
+	int first_initializer = block_param->initializer_size();
 	auto net = std::make_shared<caffe::NetParameter>();
-	std::fstream input(file_path, std::ios::in | std::ios::binary);
-	LOG_IF(FATAL, !net->ParseFromIstream(&input)) << "Failed to read caffe model " << file_path;
-	input.close();
+	{
+		std::fstream input(file_path, std::ios::in | std::ios::binary);
+		LOG_IF(FATAL, !input.is_open()) << "Failed to open caffe model " << file_path;
+		google::protobuf::io::IstreamInputStream zero_copy_input(&input);
+		google::protobuf::io::CodedInputStream coded_input(&zero_copy_input);
+		// Pre-trained models are routinely larger than the 64MB default limit of protobuf.
+		_raise_bytes_limit(&coded_input);
+		LOG_IF(FATAL, !net->ParseFromCodedStream(&coded_input) || !coded_input.ConsumedEntireMessage()) << "Failed to read caffe model " << file_path;
+	}
 	if (net->layer_size() > 0) {
-		LOG(INFO) << "Loading Caffe model from LayerParameter (NOT IMPLEMENTED)";
+		_parse_net(net, inputs);
 	}
 	else if (net->layers_size() > 0) {
 		_parse_net_deprecated(net, inputs);
 	}
+	if (!cache_file_path.empty())
+		_save_cache(cache_file_path, first_node, first_initializer);
+}
+
+bool Caffe::_load_cache(const std::string & file_path, const std::string & cache_file_path, std::initializer_list<std::pair<std::string, std::array<int, 4>>> inputs)
+{
+	namespace fs = boost::filesystem;
+	if (!fs::exists(cache_file_path))
+		return false;
+	if (fs::exists(file_path) && fs::last_write_time(cache_file_path) < fs::last_write_time(file_path)) {
+		LOG_IF(INFO, _verbose) << "Ignoring " << cache_file_path << " - older than " << file_path;
+		return false;
+	}
+	deepflow::BlockParam cache;
+	{
+		std::fstream input(cache_file_path, std::ios::in | std::ios::binary);
+		google::protobuf::io::IstreamInputStream zero_copy_input(&input);
+		google::protobuf::io::CodedInputStream coded_input(&zero_copy_input);
+		_raise_bytes_limit(&coded_input);
+		if (!cache.ParseFromCodedStream(&coded_input)) {
+			LOG(WARNING) << "Failed to read cached model " << cache_file_path << " - loading " << file_path << " instead.";
+			return false;
+		}
+	}
+	for (auto &node : cache.node()) {
+		if (!node.has_place_holder_param())
+			continue;
+		for (auto place_holder : inputs) {
+			if (place_holder.first != node.name())
+				continue;
+			auto &cached_dims = node.place_holder_param().tensor_param().dims();
+			if (!std::equal(cached_dims.begin(), cached_dims.end(), place_holder.second.begin())) {
+				LOG_IF(INFO, _verbose) << "Ignoring " << cache_file_path << " - " << node.name() << " was cached with different dimensions.";
+				return false;
+			}
+		}
+	}
+	LOG_IF(INFO, _verbose) << "Loading cached model from " << cache_file_path;
+	auto block_param = df->block()->block_param();
+	for (int i = 0; i < cache.node_size(); ++i)
+		block_param->add_node()->Swap(cache.mutable_node(i));
+	for (int i = 0; i < cache.initializer_size(); ++i)
+		block_param->add_initializer()->Swap(cache.mutable_initializer(i));
+	return true;
+}
+
+void Caffe::_save_cache(const std::string & cache_file_path, int first_node, int first_initializer)
+{
+	auto block_param = df->block()->block_param();
+	deepflow::BlockParam cache;
+	for (int i = first_node; i < block_param->node_size(); ++i)
+		cache.add_node()->CopyFrom(block_param->node(i));
+	for (int i = first_initializer; i < block_param->initializer_size(); ++i)
+		cache.add_initializer()->CopyFrom(block_param->initializer(i));
+	std::fstream output(cache_file_path, std::ios::out | std::ios::trunc | std::ios::binary);
+	LOG_IF(FATAL, !cache.SerializeToOstream(&output)) << "Failed to write cached model to " << cache_file_path;
+	LOG_IF(INFO, _verbose) << "Cached model written to " << cache_file_path;
 }
 
 void Caffe::_parse_net_deprecated(std::shared_ptr<caffe::NetParameter> net, std::initializer_list<std::pair<std::string, std::array<int, 4>>> inputs)
@@ -48,7 +132,7 @@ void Caffe::_parse_net_deprecated(std::shared_ptr<caffe::NetParameter> net, std:
 		LOG_IF(FATAL, resolved == false) << net_input_name << " input is not provided for the loading function.";
 	}	
 	
-	for (auto layer : net->layers())
+	for (auto &layer : net->layers())
 		_parse_layer_deprecated(layer);
 
 	if (_inplace_nodes.size() > 0) {
@@ -201,9 +285,8 @@ std::string Caffe::_parse_inner_product_param(const caffe::InnerProductParameter
 	//LOG_IF(FATAL, param.has_weight_filler() == false) << "param.has_weight_filler() == false - " << layer.name() ;
 	std::string weight = df->variable( _parse_filler_param({ num_inputs, num_output, 1, 1 }, param.weight_filler(), "weight filler"), "", VariableOp(layer.name() + "_w"));
 	auto weights_node = df->block()->find_node_param_by_output_name(weight);
-	auto weight_mutable_weights = weights_node->mutable_variable_param()->mutable_weights();
-	for (auto d : layer.blobs(0).data())
-		weight_mutable_weights->add_data(d);
+	// Caffe keeps inner product weights as num_output x num_inputs, matmul expects num_inputs x num_output.
+	_copy_blob(layer.blobs(0), weights_node->mutable_variable_param()->mutable_weights(), param.transpose() ? 0 : num_output);
 	if (param.bias_term() == false) {
 		return df->matmul(layer.bottom(0) + "_output_0", weight, MatmulOp(layer.name()));
 	}
@@ -211,9 +294,7 @@ std::string Caffe::_parse_inner_product_param(const caffe::InnerProductParameter
 		//LOG_IF(FATAL, param.has_bias_filler() == false) << "param.has_bias_filler() == false - " << layer.name();
 		std::string bias = df->variable(_parse_filler_param({ 1, num_output, 1, 1 }, param.bias_filler(), "bias filler"), "", VariableOp(layer.name() + "_b"));
 		auto bias_node = df->block()->find_node_param_by_output_name(bias);		
-		auto bias_mutable_weights = bias_node->mutable_variable_param()->mutable_weights();
-		for (auto d : layer.blobs(1).data())
-			bias_mutable_weights->add_data(d);		
+		_copy_blob(layer.blobs(1), bias_node->mutable_variable_param()->mutable_weights());
 		std::string m = df->matmul(layer.bottom(0) + "_output_0", weight, MatmulOp(layer.name() + "_ip"));
 		return df->bias_add(m, bias, BiasAddOp(layer.name()));
 	}
@@ -310,9 +391,7 @@ std::string Caffe::_parse_conv_param(const caffe::ConvolutionParameter & param,
 	int filter_second_dimension = layer.blobs(0).data_size() / num_output / kernel_h / kernel_w;
 	std::string filter = df->variable(_parse_filler_param({ num_output, filter_second_dimension, kernel_h, kernel_w }, param.weight_filler(), "weight filler"), "", VariableOp(layer.name() + "_w"));
 	auto filter_node = df->block()->find_node_param_by_output_name(filter);
-	auto filter_mutable_weights = filter_node->mutable_variable_param()->mutable_weights();
-	for (auto d : layer.blobs(0).data())
-		filter_mutable_weights->add_data(d);
+	_copy_blob(layer.blobs(0), filter_node->mutable_variable_param()->mutable_weights());
 	std::string bias;
 	LOG_IF(INFO, _verbose) << "     .bias_term = " << param.bias_term();
 	if (param.bias_term() == true) {
@@ -323,9 +402,7 @@ std::string Caffe::_parse_conv_param(const caffe::ConvolutionParameter & param,
 		//LOG_IF(FATAL, param.has_bias_filler() == false) << "param.has_bias_filler() == false - " << layer.name();
 		bias = df->variable(_parse_filler_param({ 1, num_output, 1, 1 }, param.bias_filler(), "bias filler"), "", VariableOp(layer.name() + "_b"));
 		auto bias_node = df->block()->find_node_param_by_output_name(bias);
-		auto bias_mutable_weights = bias_node->mutable_variable_param()->mutable_weights();
-		for (auto d : layer.blobs(1).data())
-			bias_mutable_weights->add_data(d);
+		_copy_blob(layer.blobs(1), bias_node->mutable_variable_param()->mutable_weights());
 	}	
 	if (bias.empty()) {
 		return df->conv2d(layer.bottom(0) + "_output_0", filter, ConvolutionOp(layer.name()).pad_h(pad_h).pad_w(pad_w).stride_u(stride_h).stride_v(stride_w).dilation_h(dilation_h).dilation_w(dilation_w));
@@ -385,13 +462,566 @@ std::string Caffe::_parse_pooling_param(const caffe::PoolingParameter & param, c
 		horizontalStride = param.stride_h();
 	}
 
-	return df->pooling(layer.bottom(0) + "_output_0",
-		PoolingOp(layer.name())
-		.window_w(windowWidth)
+	LOG_IF(FATAL, param.pool() == caffe::PoolingParameter_PoolMethod_STOCHASTIC) << "Unsupported pooling method " << caffe::PoolingParameter_PoolMethod_Name(param.pool());
+	PoolingOp op(layer.name());
+	op.window_w(windowWidth)
 		.window_h(windowHeight)
 		.v_pad(verticalPadding)
 		.h_pad(horizontalPadding)
 		.h_stride(horizontalStride)
-		.v_stride(verticalStride));
+		.v_stride(verticalStride);
+	if (param.pool() == caffe::PoolingParameter_PoolMethod_AVE)
+		op.average(true);
+	return df->pooling(layer.bottom(0) + "_output_0", op);
+}
+
+
+
+void Caffe::_parse_net(std::shared_ptr<caffe::NetParameter> net, std::initializer_list<std::pair<std::string, std::array<int, 4>>> inputs)
+{
+	LOG_IF(INFO, _verbose) << "Loading Caffe model from LayerParameter ...";
+	LOG_IF(INFO, _verbose) << "net.name = " << net->name();
+	LOG_IF(INFO, _verbose) << "net.layer_size = " << net->layer_size();
+	LOG_IF(INFO, _verbose) << "net.input_size = " << net->input_size();
+	auto find_input = [&](const std::string &name, std::array<int, 4> &dims) {
+		for (auto place_holder : inputs) {
+			if (place_holder.first == name) {
+				dims = place_holder.second;
+				return true;
+			}
+		}
+		return false;
+	};
+	for (int i = 0; i < net->input_size(); ++i) {
+		auto net_input_name = net->input(i);
+		LOG_IF(INFO, _verbose) << "    input = " << net_input_name;
+		std::array<int, 4> dims;
+		bool resolved = find_input(net_input_name, dims);
+		if (!resolved && net->input_shape_size() > i && net->input_shape(i).dim_size() == 4) {
+			for (int d = 0; d < 4; ++d)
+				dims[d] = net->input_shape(i).dim(d);
+			resolved = true;
+		}
+		else if (!resolved && net->input_dim_size() >= 4 * (i + 1)) {
+			for (int d = 0; d < 4; ++d)
+				dims[d] = net->input_dim(4 * i + d);
+			resolved = true;
+		}
+		LOG_IF(FATAL, resolved == false) << net_input_name << " input is not provided for the loading function.";
+		_parse_input(net_input_name, dims);
+	}
+
+	for (int i = 0; i < net->layer_size(); ++i) {
+		auto layer = net->mutable_layer(i);
+		const std::string &type = layer->type();
+		LOG_IF(INFO, _verbose) << "Type = " << type;
+		LOG_IF(INFO, _verbose) << " .name = " << layer->name();
+		LOG_IF(FATAL, layer->name().empty()) << "layer.name().empty()";
+		for (auto b : layer->bottom())
+			LOG_IF(INFO, _verbose) << "    .bottom = " << b;
+		if (_skip_layer(*layer)) {
+			LOG_IF(INFO, _verbose) << "  -> Skipped (TRAIN phase only)";
+			continue;
+		}
+		if (type == "Input") {
+			auto &param = layer->input_param();
+			for (int t = 0; t < layer->top_size(); ++t) {
+				std::array<int, 4> dims;
+				bool resolved = find_input(layer->top(t), dims);
+				if (!resolved && param.shape_size() > 0) {
+					auto &shape = param.shape(std::min(t, param.shape_size() - 1));
+					LOG_IF(FATAL, shape.dim_size() != 4) << layer->name() << " - Only 4D inputs are supported.";
+					for (int d = 0; d < 4; ++d)
+						dims[d] = shape.dim(d);
+					resolved = true;
+				}
+				LOG_IF(FATAL, resolved == false) << layer->top(t) << " input is not provided for the loading function.";
+				_parse_input(layer->top(t), dims);
+			}
+		}
+		else if (type.size() > 4 && type.compare(type.size() - 4, 4, "Data") == 0) {
+			// Data layers of a train/test net - tops that are not provided (e.g. labels) are only consumed by losses.
+			for (int t = 0; t < layer->top_size(); ++t) {
+				std::array<int, 4> dims;
+				if (find_input(layer->top(t), dims))
+					_parse_input(layer->top(t), dims);
+			}
+		}
+		else if (type == "Convolution") {
+			_parse_conv_layer(layer, false);
+		}
+		else if (type == "Deconvolution") {
+			_parse_conv_layer(layer, true);
+		}
+		else if (type == "BatchNorm") {
+			caffe::LayerParameter *scale_layer = nullptr;
+			if (i + 1 < net->layer_size()) {
+				auto next = net->mutable_layer(i + 1);
+				if (next->type() == "Scale" && next->bottom_size() == 1 && next->bottom(0) == layer->top(0) && !_skip_layer(*next)) {
+					scale_layer = next;
+					++i;
+				}
+			}
+			_parse_batch_norm_layer(layer, scale_layer);
+		}
+		else if (type == "Scale") {
+			_parse_scale_layer(layer);
+		}
+		else if (type == "ReLU") {
+			_parse_relu_layer(*layer);
+		}
+		else if (type == "PReLU") {
+			_parse_prelu_layer(layer);
+		}
+		else if (type == "Pooling") {
+			_parse_pooling_layer(*layer);
+		}
+		else if (type == "InnerProduct") {
+			_parse_inner_product_layer(layer);
+		}
+		else if (type == "Softmax") {
+			_parse_softmax_layer(*layer);
+		}
+		else if (type == "Concat") {
+			_parse_concat_layer(*layer);
+		}
+		else if (type == "Eltwise") {
+			_parse_eltwise_layer(*layer);
+		}
+		else if (type == "Dropout") {
+			_parse_dropout_layer(*layer);
+		}
+		else if (type == "Flatten") {
+			_parse_flatten_layer(*layer);
+		}
+		else if (type == "Split") {
+			for (int t = 0; t < layer->top_size(); ++t)
+				_set_top(*layer, t, _bottom(*layer, 0), _bottom_dims(*layer, 0));
+		}
+		else if (type == "Silence" || type == "Accuracy" || type.find("Loss") != std::string::npos) {
+			LOG_IF(INFO, _verbose) << "  -> Skipped (training only)";
+		}
+		else {
+			LOG(FATAL) << "Unsupported Caffe layer type " << type << " (" << layer->name() << ")";
+		}
+		layer->clear_blobs();
+	}
+}
+
+bool Caffe::_skip_layer(const caffe::LayerParameter & layer)
+{
+	for (auto &rule : layer.include())
+		if (rule.has_phase() && rule.phase() == caffe::TRAIN)
+			return true;
+	for (auto &rule : layer.exclude())
+		if (rule.has_phase() && rule.phase() == caffe::TEST)
+			return true;
+	return false;
+}
+
+void Caffe::_parse_input(const std::string & name, std::array<int, 4> dims)
+{
+	auto place_holder = df->place_holder(dims, PlaceholderOp(name));
+	_blob_outputs[name] = place_holder;
+	_blob_dims[name] = dims;
+	LOG_IF(INFO, _verbose) << "  -> Input " << name << " " << dims[0] << "x" << dims[1] << "x" << dims[2] << "x" << dims[3];
+}
+
+std::string Caffe::_bottom(const caffe::LayerParameter & layer, int index) const
+{
+	LOG_IF(FATAL, index >= layer.bottom_size()) << layer.name() << " - Expected at least " << index + 1 << " bottom blobs.";
+	auto it = _blob_outputs.find(layer.bottom(index));
+	LOG_IF(FATAL, it == _blob_outputs.end()) << layer.name() << " - Bottom blob " << layer.bottom(index) << " is not produced by any previous layer.";
+	return it->second;
+}
+
+std::array<int, 4> Caffe::_bottom_dims(const caffe::LayerParameter & layer, int index) const
+{
+	_bottom(layer, index);
+	return _blob_dims.find(layer.bottom(index))->second;
+}
+
+void Caffe::_set_top(const caffe::LayerParameter & layer, int index, const std::string & df_output, std::array<int, 4> dims)
+{
+	LOG_IF(FATAL, index >= layer.top_size()) << layer.name() << " - Expected at least " << index + 1 << " top blobs.";
+	_blob_outputs[layer.top(index)] = df_output;
+	_blob_dims[layer.top(index)] = dims;
+	LOG_IF(INFO, _verbose) << "    .top = " << layer.top(index) << " -> " << df_output << " " << dims[0] << "x" << dims[1] << "x" << dims[2] << "x" << dims[3];
+}
+
+int Caffe::_blob_count(const caffe::BlobProto & blob)
+{
+	return blob.data_size() > 0 ? blob.data_size() : blob.double_data_size();
+}
+
+void Caffe::_move_blob(caffe::BlobProto * blob, deepflow::TensorData * weights)
+{
+	if (blob->data_size() > 0) {
+		weights->mutable_data()->Swap(blob->mutable_data());
+	}
+	else {
+		_copy_blob(*blob, weights);
+		blob->clear_double_data();
+	}
+}
+
+void Caffe::_copy_blob(const caffe::BlobProto & blob, deepflow::TensorData * weights, int transpose_rows)
+{
+	int count = _blob_count(blob);
+	auto data = weights->mutable_data();
+	data->Resize(count, 0.0f);
+	float *dst = data->mutable_data();
+	if (transpose_rows > 0) {
+		// blob is transpose_rows x cols, weights becomes cols x transpose_rows
+		int rows = transpose_rows;
+		int cols = count / rows;
+		LOG_IF(FATAL, rows * cols != count) << "Blob of size " << count << " can not be transposed into " << cols << "x" << rows;
+		if (blob.data_size() > 0) {
+			const float *src = blob.data().data();
+			for (int r = 0; r < rows; ++r)
+				for (int c = 0; c < cols; ++c)
+					dst[c * rows + r] = src[r * cols + c];
+		}
+		else {
+			const double *src = blob.double_data().data();
+			for (int r = 0; r < rows; ++r)
+				for (int c = 0; c < cols; ++c)
+					dst[c * rows + r] = (float)src[r * cols + c];
+		}
+	}
+	else if (blob.data_size() > 0) {
+		memcpy(dst, blob.data().data(), count * sizeof(float));
+	}
+	else {
+		const double *src = blob.double_data().data();
+		for (int i = 0; i < count; ++i)
+			dst[i] = (float)src[i];
+	}
+}
+
+std::string Caffe::_blob_variable(caffe::BlobProto * blob, std::array<int, 4> dims, std::string name, int transpose_rows)
+{
+	int count = dims[0] * dims[1] * dims[2] * dims[3];
+	LOG_IF(FATAL, _blob_count(*blob) != count) << name << " - Blob has " << _blob_count(*blob) << " values but " << dims[0] << "x" << dims[1] << "x" << dims[2] << "x" << dims[3] << " is expected.";
+	auto variable = df->variable(df->fill({ dims[0], dims[1], dims[2], dims[3] }, 0), "", VariableOp(name));
+	auto block_param = df->block()->block_param();
+	auto weights = block_param->mutable_node(block_param->node_size() - 1)->mutable_variable_param()->mutable_weights();
+	if (transpose_rows > 0) {
+		_copy_blob(*blob, weights, transpose_rows);
+		blob->clear_data();
+		blob->clear_double_data();
+	}
+	else {
+		_move_blob(blob, weights);
+	}
+	return variable;
+}
+
+std::string Caffe::_constant_variable(std::array<int, 4> dims, float value, std::string name)
+{
+	return df->variable(df->fill({ dims[0], dims[1], dims[2], dims[3] }, value), "", VariableOp(name));
+}
+
+static void _conv_spatial_param(const google::protobuf::RepeatedField<google::protobuf::uint32> &values, bool has_hw, int h, int w, int default_value, int &out_h, int &out_w)
+{
+	if (has_hw) {
+		out_h = h;
+		out_w = w;
+	}
+	else if (values.size() == 0) {
+		out_h = out_w = default_value;
+	}
+	else if (values.size() == 1) {
+		out_h = out_w = values.Get(0);
+	}
+	else {
+		out_h = values.Get(0);
+		out_w = values.Get(1);
+	}
+}
+
+void Caffe::_parse_conv_layer(caffe::LayerParameter * layer, bool transposed)
+{
+	auto &param = layer->convolution_param();
+	LOG_IF(INFO, _verbose) << "  -> ConvolutionParameter";
+	LOG_IF(INFO, _verbose) << "     .num_output = " << param.num_output();
+	LOG_IF(INFO, _verbose) << "     .group = " << param.group() << " [default: 1]";
+	LOG_IF(FATAL, param.axis() != 1) << layer->name() << " - Unsupported axis " << param.axis();
+	LOG_IF(FATAL, param.group() != 1) << layer->name() << " - Grouped convolution (group = " << param.group() << ") is not supported.";
+	LOG_IF(FATAL, layer->blobs_size() == 0) << layer->name() << " - No weights found. Load a .caffemodel rather than a .prototxt.";
+	int kernel_h, kernel_w, stride_h, stride_w, pad_h, pad_w, dilation_h, dilation_w;
+	_conv_spatial_param(param.kernel_size(), param.has_kernel_h() || param.has_kernel_w(), param.kernel_h(), param.kernel_w(), 0, kernel_h, kernel_w);
+	_conv_spatial_param(param.stride(), param.has_stride_h() || param.has_stride_w(), param.stride_h(), param.stride_w(), 1, stride_h, stride_w);
+	_conv_spatial_param(param.pad(), param.has_pad_h() || param.has_pad_w(), param.pad_h(), param.pad_w(), 0, pad_h, pad_w);
+	_conv_spatial_param(param.dilation(), false, 0, 0, 1, dilation_h, dilation_w);
+	LOG_IF(FATAL, kernel_h < 1 || kernel_w < 1) << layer->name() << " - No kernel_size or kernel_h/kernel_w is defined.";
+	LOG_IF(INFO, _verbose) << "     .kernel = " << kernel_h << "x" << kernel_w << " .stride = " << stride_h << "x" << stride_w << " .pad = " << pad_h << "x" << pad_w << " .dilation = " << dilation_h << "x" << dilation_w;
+	auto input_dims = _bottom_dims(*layer, 0);
+	int num_output = param.num_output();
+	LOG_IF(FATAL, num_output < 1) << "num_output < 1";
+	std::array<int, 4> filter_dims, output_dims;
+	output_dims[0] = input_dims[0];
+	output_dims[1] = num_output;
+	if (transposed) {
+		filter_dims = { input_dims[1], num_output, kernel_h, kernel_w };
+		output_dims[2] = (input_dims[2] - 0.5) * stride_h - 2 * pad_h + ((kernel_h - 1) * dilation_h) + 1;
+		output_dims[3] = (input_dims[3] - 0.5) * stride_w - 2 * pad_w + ((kernel_w - 1) * dilation_w) + 1;
+		int caffe_h = stride_h * (input_dims[2] - 1) + dilation_h * (kernel_h - 1) + 1 - 2 * pad_h;
+		int caffe_w = stride_w * (input_dims[3] - 1) + dilation_w * (kernel_w - 1) + 1 - 2 * pad_w;
+		LOG_IF(WARNING, caffe_h != output_dims[2] || caffe_w != output_dims[3]) << layer->name() << " - Caffe output is " << caffe_h << "x" << caffe_w << " but transposed_conv2d produces " << output_dims[2] << "x" << output_dims[3];
+	}
+	else {
+		filter_dims = { num_output, input_dims[1], kernel_h, kernel_w };
+		output_dims[2] = (input_dims[2] + 2 * pad_h - (dilation_h * (kernel_h - 1) + 1)) / stride_h + 1;
+		output_dims[3] = (input_dims[3] + 2 * pad_w - (dilation_w * (kernel_w - 1) + 1)) / stride_w + 1;
+	}
+	auto filter = _blob_variable(layer->mutable_blobs(0), filter_dims, layer->name() + "_w");
+	bool with_bias = param.bias_term() && layer->blobs_size() > 1;
+	auto conv_op = ConvolutionOp(with_bias ? layer->name() + "_conv" : layer->name()).pad_h(pad_h).pad_w(pad_w).stride_u(stride_h).stride_v(stride_w).dilation_h(dilation_h).dilation_w(dilation_w);
+	auto output = transposed ? df->transposed_conv2d(_bottom(*layer, 0), filter, conv_op) : df->conv2d(_bottom(*layer, 0), filter, conv_op);
+	if (with_bias) {
+		auto bias = _blob_variable(layer->mutable_blobs(1), { 1, num_output, 1, 1 }, layer->name() + "_b");
+		output = df->bias_add(output, bias, BiasAddOp(layer->name()));
+	}
+	_set_top(*layer, 0, output, output_dims);
+}
+
+void Caffe::_parse_batch_norm_layer(caffe::LayerParameter * layer, caffe::LayerParameter * scale_layer)
+{
+	auto &param = layer->batch_norm_param();
+	LOG_IF(INFO, _verbose) << "  -> BatchNormParameter";
+	LOG_IF(INFO, _verbose) << "     .use_global_stats = " << param.use_global_stats();
+	LOG_IF(INFO, _verbose) << "     .moving_average_fraction = " << param.moving_average_fraction() << " [default: 0.999]";
+	LOG_IF(INFO, _verbose) << "     .eps = " << param.eps() << " [default: 1e-5]";
+	LOG_IF(FATAL, layer->blobs_size() < 3) << layer->name() << " - Expected mean, variance and scale factor blobs.";
+	auto dims = _bottom_dims(*layer, 0);
+	std::array<int, 4> scale_bias_dims = { 1, dims[1], 1, 1 };
+	auto &scale_factor_blob = layer->blobs(2);
+	float scale_factor = scale_factor_blob.data_size() > 0 ? scale_factor_blob.data(0) : (float)scale_factor_blob.double_data(0);
+	// Caffe accumulates unnormalized running statistics, scale_factor is the normalizer.
+	float factor = scale_factor == 0 ? 0 : 1.0f / scale_factor;
+	std::string scale, bias;
+	if (scale_layer) {
+		LOG_IF(INFO, _verbose) << "  -> Fused with Scale " << scale_layer->name();
+		LOG_IF(FATAL, scale_layer->blobs_size() < 1) << scale_layer->name() << " - No weights found.";
+		scale = _blob_variable(scale_layer->mutable_blobs(0), scale_bias_dims, scale_layer->name() + "_s");
+		if (scale_layer->scale_param().bias_term() && scale_layer->blobs_size() > 1)
+			bias = _blob_variable(scale_layer->mutable_blobs(1), scale_bias_dims, scale_layer->name() + "_b");
+		else
+			bias = _constant_variable(scale_bias_dims, 0, scale_layer->name() + "_b");
+		scale_layer->clear_blobs();
+	}
+	else {
+		scale = _constant_variable(scale_bias_dims, 1, layer->name() + "_s");
+		bias = _constant_variable(scale_bias_dims, 0, layer->name() + "_b");
+	}
+	auto output = df->batch_normalization(_bottom(*layer, 0), scale, bias, BatchNormalizationOp(layer->name()).spatial().exponent_factor(1.0f - param.moving_average_fraction()).eps(std::max(param.eps(), (float)CUDNN_BN_MIN_EPSILON)));
+	auto block_param = df->block()->block_param();
+	auto bn_param = block_param->mutable_node(block_param->node_size() - 1)->mutable_batch_normalization_param();
+	_move_blob(layer->mutable_blobs(0), bn_param->mutable_mean());
+	_move_blob(layer->mutable_blobs(1), bn_param->mutable_var());
+	LOG_IF(FATAL, bn_param->mean().data_size() != dims[1] || bn_param->var().data_size() != dims[1]) << layer->name() << " - Expected " << dims[1] << " mean and variance values.";
+	for (auto &m : *bn_param->mutable_mean()->mutable_data())
+		m *= factor;
+	for (auto &v : *bn_param->mutable_var()->mutable_data())
+		v *= factor;
+	_set_top(scale_layer ? *scale_layer : *layer, 0, output, dims);
+}
+
+void Caffe::_parse_scale_layer(caffe::LayerParameter * layer)
+{
+	auto &param = layer->scale_param();
+	LOG_IF(INFO, _verbose) << "  -> ScaleParameter";
+	LOG_IF(INFO, _verbose) << "     .bias_term = " << param.bias_term() << " [default: false]";
+	LOG_IF(FATAL, layer->bottom_size() != 1) << layer->name() << " - Scale with a second bottom is not supported.";
+	LOG_IF(FATAL, param.axis() != 1 || param.num_axes() != 1) << layer->name() << " - Only per channel Scale is supported.";
+	LOG_IF(FATAL, layer->blobs_size() < 1) << layer->name() << " - No weights found.";
+	// A stand-alone Scale is a batch normalization with zero mean and unit (after eps) variance.
+	auto dims = _bottom_dims(*layer, 0);
+	std::array<int, 4> scale_bias_dims = { 1, dims[1], 1, 1 };
+	auto scale = _blob_variable(layer->mutable_blobs(0), scale_bias_dims, layer->name() + "_s");
+	std::string bias;
+	if (param.bias_term() && layer->blobs_size() > 1)
+		bias = _blob_variable(layer->mutable_blobs(1), scale_bias_dims, layer->name() + "_b");
+	else
+		bias = _constant_variable(scale_bias_dims, 0, layer->name() + "_b");
+	float eps = CUDNN_BN_MIN_EPSILON;
+	auto output = df->batch_normalization(_bottom(*layer, 0), scale, bias, BatchNormalizationOp(layer->name()).spatial().eps(eps));
+	auto block_param = df->block()->block_param();
+	auto bn_param = block_param->mutable_node(block_param->node_size() - 1)->mutable_batch_normalization_param();
+	bn_param->mutable_mean()->mutable_data()->Resize(dims[1], 0.0f);
+	bn_param->mutable_var()->mutable_data()->Resize(dims[1], 1.0f - eps);
+	LOG_IF(INFO, _verbose) << "  -> Stand-alone Scale is only exact in TEST execution mode.";
+	_set_top(*layer, 0, output, dims);
+}
+
+void Caffe::_parse_relu_layer(const caffe::LayerParameter & layer)
+{
+	float negative_slope = layer.relu_param().negative_slope();
+	LOG_IF(INFO, _verbose) << "  -> ReLUParameter";
+	LOG_IF(INFO, _verbose) << "     .negative_slope = " << negative_slope << " [default: 0]";
+	std::string output;
+	if (negative_slope == 0)
+		output = df->relu(_bottom(layer, 0), ReluOp(layer.name()));
+	else
+		output = df->leaky_relu(_bottom(layer, 0), LeakyReluOp(layer.name()).negative_slope(negative_slope));
+	_set_top(layer, 0, output, _bottom_dims(layer, 0));
+}
+
+void Caffe::_parse_prelu_layer(caffe::LayerParameter * layer)
+{
+	LOG_IF(INFO, _verbose) << "  -> PReLUParameter";
+	LOG_IF(INFO, _verbose) << "     .channel_shared = " << layer->prelu_param().channel_shared() << " [default: false]";
+	LOG_IF(FATAL, layer->blobs_size() < 1) << layer->name() << " - No weights found.";
+	auto dims = _bottom_dims(*layer, 0);
+	std::string output;
+	if (layer->prelu_param().channel_shared()) {
+		// A single shared slope is imported as a (non-trainable) leaky relu.
+		auto &blob = layer->blobs(0);
+		float slope = blob.data_size() > 0 ? blob.data(0) : (float)blob.double_data(0);
+		output = df->leaky_relu(_bottom(*layer, 0), LeakyReluOp(layer->name()).negative_slope(slope));
+	}
+	else {
+		auto w = _blob_variable(layer->mutable_blobs(0), { 1, dims[1], 1, 1 }, layer->name() + "_w");
+		output = df->prelu(_bottom(*layer, 0), w, PReluOp(layer->name()));
+	}
+	_set_top(*layer, 0, output, dims);
+}
+
+void Caffe::_parse_pooling_layer(const caffe::LayerParameter & layer)
+{
+	auto &param = layer.pooling_param();
+	LOG_IF(INFO, _verbose) << "  -> PoolingParameter";
+	LOG_IF(INFO, _verbose) << "     .pool_method = " << caffe::PoolingParameter_PoolMethod_Name(param.pool()) << " [default: MAX]";
+	LOG_IF(INFO, _verbose) << "     .global_pooling = " << param.global_pooling() << " [default: false]";
+	LOG_IF(FATAL, param.pool() == caffe::PoolingParameter_PoolMethod_STOCHASTIC) << layer.name() << " - Unsupported pooling method " << caffe::PoolingParameter_PoolMethod_Name(param.pool());
+	auto dims = _bottom_dims(layer, 0);
+	int window_h, window_w, pad_h = 0, pad_w = 0, stride_h = 1, stride_w = 1;
+	if (param.global_pooling()) {
+		window_h = dims[2];
+		window_w = dims[3];
+	}
+	else {
+		window_h = param.has_kernel_h() ? param.kernel_h() : param.kernel_size();
+		window_w = param.has_kernel_w() ? param.kernel_w() : param.kernel_size();
+		pad_h = param.has_pad_h() ? param.pad_h() : param.pad();
+		pad_w = param.has_pad_w() ? param.pad_w() : param.pad();
+		stride_h = param.has_stride_h() ? param.stride_h() : param.stride();
+		stride_w = param.has_stride_w() ? param.stride_w() : param.stride();
+	}
+	LOG_IF(INFO, _verbose) << "     .kernel = " << window_h << "x" << window_w << " .stride = " << stride_h << "x" << stride_w << " .pad = " << pad_h << "x" << pad_w;
+	std::array<int, 4> output_dims = { dims[0], dims[1], (dims[2] + 2 * pad_h - window_h) / stride_h + 1, (dims[3] + 2 * pad_w - window_w) / stride_w + 1 };
+	// Caffe rounds the pooled size up, cuDNN rounds it down.
+	int caffe_h = (int)ceil((float)(dims[2] + 2 * pad_h - window_h) / stride_h) + 1;
+	int caffe_w = (int)ceil((float)(dims[3] + 2 * pad_w - window_w) / stride_w) + 1;
+	if (pad_h > 0 && (caffe_h - 1) * stride_h >= dims[2] + pad_h)
+		--caffe_h;
+	if (pad_w > 0 && (caffe_w - 1) * stride_w >= dims[3] + pad_w)
+		--caffe_w;
+	LOG_IF(WARNING, caffe_h != output_dims[2] || caffe_w != output_dims[3]) << layer.name() << " - Caffe output is " << caffe_h << "x" << caffe_w << " but pooling produces " << output_dims[2] << "x" << output_dims[3];
+	PoolingOp op(layer.name());
+	op.window_h(window_h).window_w(window_w).v_pad(pad_h).h_pad(pad_w).v_stride(stride_h).h_stride(stride_w);
+	// Caffe divides AVE windows by their size including the padding.
+	if (param.pool() == caffe::PoolingParameter_PoolMethod_AVE)
+		op.average(true);
+	auto output = df->pooling(_bottom(layer, 0), op);
+	_set_top(layer, 0, output, output_dims);
+}
+
+void Caffe::_parse_inner_product_layer(caffe::LayerParameter * layer)
+{
+	auto &param = layer->inner_product_param();
+	LOG_IF(INFO, _verbose) << "  -> InnerProductParameter";
+	LOG_IF(INFO, _verbose) << "     .num_output = " << param.num_output();
+	LOG_IF(INFO, _verbose) << "     .bias_term = " << param.bias_term() << " [default: true]";
+	LOG_IF(INFO, _verbose) << "     .transpose = " << param.transpose() << " [default: false]";
+	LOG_IF(FATAL, param.axis() != 1) << layer->name() << " - Unsupported axis " << param.axis();
+	LOG_IF(FATAL, layer->blobs_size() == 0) << layer->name() << " - No weights found. Load a .caffemodel rather than a .prototxt.";
+	auto dims = _bottom_dims(*layer, 0);
+	int num_output = param.num_output();
+	LOG_IF(FATAL, num_output < 1) << "num_output < 1";
+	int num_inputs = dims[1] * dims[2] * dims[3];
+	// Caffe keeps the weights as num_output x num_inputs unless transpose is set, matmul expects num_inputs x num_output.
+	auto w = _blob_variable(layer->mutable_blobs(0), { num_inputs, num_output, 1, 1 }, layer->name() + "_w", param.transpose() ? 0 : num_output);
+	std::string output;
+	if (param.bias_term() && layer->blobs_size() > 1) {
+		auto b = _blob_variable(layer->mutable_blobs(1), { 1, num_output, 1, 1 }, layer->name() + "_b");
+		output = df->bias_add(df->matmul(_bottom(*layer, 0), w, MatmulOp(layer->name() + "_ip")), b, BiasAddOp(layer->name()));
+	}
+	else {
+		output = df->matmul(_bottom(*layer, 0), w, MatmulOp(layer->name()));
+	}
+	_set_top(*layer, 0, output, { dims[0], num_output, 1, 1 });
+}
+
+void Caffe::_parse_softmax_layer(const caffe::LayerParameter & layer)
+{
+	LOG_IF(INFO, _verbose) << "  -> SoftmaxParameter";
+	LOG_IF(FATAL, layer.softmax_param().axis() != 1) << layer.name() << " - Unsupported axis " << layer.softmax_param().axis();
+	auto output = df->softmax(_bottom(layer, 0), SoftmaxOp(layer.name()).by_channel());
+	_set_top(layer, 0, output, _bottom_dims(layer, 0));
+}
+
+void Caffe::_parse_concat_layer(const caffe::LayerParameter & layer)
+{
+	auto &param = layer.concat_param();
+	int axis = param.has_axis() ? param.axis() : param.concat_dim();
+	LOG_IF(INFO, _verbose) << "  -> ConcatParameter";
+	LOG_IF(INFO, _verbose) << "     .axis = " << axis << " [default: 1]";
+	LOG_IF(FATAL, axis != 1) << layer.name() << " - Only channel concatenation is supported.";
+	std::list<std::string> inputs;
+	auto dims = _bottom_dims(layer, 0);
+	dims[1] = 0;
+	for (int i = 0; i < layer.bottom_size(); ++i) {
+		auto bottom_dims = _bottom_dims(layer, i);
+		LOG_IF(FATAL, bottom_dims[0] != dims[0] || bottom_dims[2] != dims[2] || bottom_dims[3] != dims[3]) << layer.name() << " - Bottom " << layer.bottom(i) << " has incompatible dimensions.";
+		dims[1] += bottom_dims[1];
+		inputs.push_back(_bottom(layer, i));
+	}
+	auto output = df->concate(inputs, ConcateOp(layer.name()));
+	_set_top(layer, 0, output, dims);
 }
 
+void Caffe::_parse_eltwise_layer(const caffe::LayerParameter & layer)
+{
+	auto &param = layer.eltwise_param();
+	LOG_IF(INFO, _verbose) << "  -> EltwiseParameter";
+	LOG_IF(INFO, _verbose) << "     .operation = " << caffe::EltwiseParameter_EltwiseOp_Name(param.operation()) << " [default: SUM]";
+	LOG_IF(FATAL, param.coeff_size() > 0 && param.coeff_size() != layer.bottom_size()) << layer.name() << " - Expected one coefficient per bottom.";
+	LOG_IF(FATAL, param.coeff_size() > 0 && param.operation() != caffe::EltwiseParameter_EltwiseOp_SUM) << layer.name() << " - Coefficients are only supported for SUM.";
+	auto coeff = [&](int i) { return param.coeff_size() > 0 ? param.coeff(i) : 1.0f; };
+	auto output = _bottom(layer, 0);
+	for (int i = 1; i < layer.bottom_size(); ++i) {
+		auto name = (i == layer.bottom_size() - 1) ? layer.name() : layer.name() + "_" + std::to_string(i);
+		switch (param.operation()) {
+		case caffe::EltwiseParameter_EltwiseOp_SUM:
+			output = df->add(output, _bottom(layer, i), AddOp(name).alpha(i == 1 ? coeff(0) : 1.0f).beta(coeff(i)));
+			break;
+		case caffe::EltwiseParameter_EltwiseOp_PROD:
+			output = df->dot(output, _bottom(layer, i), DotOp(name));
+			break;
+		case caffe::EltwiseParameter_EltwiseOp_MAX:
+			output = df->max(output, _bottom(layer, i), MaxOp(name));
+			break;
+		default:
+			LOG(FATAL) << layer.name() << " - Unsupported operation.";
+		}
+	}
+	_set_top(layer, 0, output, _bottom_dims(layer, 0));
+}
+
+void Caffe::_parse_dropout_layer(const caffe::LayerParameter & layer)
+{
+	LOG_IF(INFO, _verbose) << "  -> DropoutParameter";
+	LOG_IF(INFO, _verbose) << "     .dropout_ratio = " << layer.dropout_param().dropout_ratio() << " [default: 0.5]";
+	auto output = df->dropout(_bottom(layer, 0), DropoutOp(layer.name()).ratio(layer.dropout_param().dropout_ratio()));
+	_set_top(layer, 0, output, _bottom_dims(layer, 0));
+}
+
+void Caffe::_parse_flatten_layer(const caffe::LayerParameter & layer)
+{
+	auto dims = _bottom_dims(layer, 0);
+	std::array<int, 4> output_dims = { dims[0], dims[1] * dims[2] * dims[3], 1, 1 };
+	auto output = df->reshape(_bottom(layer, 0), output_dims, ReshapeOp(layer.name()));
+	_set_top(layer, 0, output, output_dims);
+}
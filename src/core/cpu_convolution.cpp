@@ -0,0 +1,716 @@
+#include "core/cpu_convolution.h"
+#include "core/cpu_fft.h"
+#include "core/cpu_gemm.h"
+#include "core/cpu_layout.h"
+#include "core/cpu_parallel.h"
+#include "core/cpu_transpose.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <glog/logging.h>
+
+static const size_t kConvGrain = 1 << 14;
+// A filter slice is rank-1 when its outer product fit is off by at most this fraction of its largest tap.
+static const float kRankTolerance = 1e-5f;
+// Throughputs of the cost model, fitted to AVX2 timings: flops per ns of packed GEMM, the separable
+// row and column passes, the FFT butterflies and the spectral multiply-accumulate, and column buffer
+// elements per ns of the GEMM gather, which dominates when the filter has few outputs.
+static const double kGemmRate = 24.0;
+static const double kGatherRate = 0.5;
+static const double kSeparableRate = 4.0;
+static const double kFftRate = 3.3;
+static const double kSpectralRate = 3.0;
+// Largest filter spectrum the FFT path keeps, in complex values, and the largest tile it picks
+// unless the filter needs more.
+static const size_t kFftSpectrumLimit = (size_t)1 << 24;
+static const int kFftMaxTile = 128;
+// Column buffer elements the channel blocked paths gather at a time, in whole samples.
+static const size_t kBlockedColumns = (size_t)1 << 21;
+
+static int floor_div(int a, int b)
+{
+	return a >= 0 ? a / b : -((-a + b - 1) / b);
+}
+
+// One axis of a column gather: column i, tap j reads source index step * i + tap_step * j + base,
+// zero outside [0, extent).
+struct ConvAxis {
+	int size;
+	int taps;
+	int step;
+	int tap_step;
+	int base;
+	int extent;
+};
+
+// Filter taps tap0 + tap_stride * j, j < taps, of one axis.
+struct ConvTaps {
+	int tap0;
+	int tap_stride;
+	int taps;
+};
+
+// col[(ch, j, l)][(n, i, t)] = src[n, ch, y(i, j), x(t, l)] for a [samples, channels, y.extent, x.extent] source.
+static void conv_gather(const float *src, int samples, int channels, const ConvAxis &y, const ConvAxis &x, float *col)
+{
+	const int taps = y.taps * x.taps;
+	const size_t columns = (size_t)samples * y.size * x.size;
+	const size_t plane = (size_t)y.extent * x.extent;
+	CpuParallel::for_range((size_t)channels * taps, std::max<size_t>(1, kConvGrain / columns), [&](size_t begin, size_t end) {
+		for (size_t row = begin; row < end; ++row) {
+			const int ch = (int)(row / taps), j = (int)(row % taps) / x.taps, l = (int)(row % taps) % x.taps;
+			// Columns t with 0 <= x.step * t + offset < x.extent.
+			const int offset = x.tap_step * l + x.base;
+			const int t0 = std::min(x.size, std::max(0, floor_div(-offset + x.step - 1, x.step)));
+			const int t1 = std::max(t0, std::min(x.size, floor_div(x.extent - 1 - offset, x.step) + 1));
+			float *out = col + row * columns;
+			for (int n = 0; n < samples; ++n) {
+				const float *channel = src + ((size_t)n * channels + ch) * plane;
+				for (int i = 0; i < y.size; ++i, out += x.size) {
+					const int sy = y.step * i + y.tap_step * j + y.base;
+					if (sy < 0 || sy >= y.extent) {
+						std::fill(out, out + x.size, 0.0f);
+						continue;
+					}
+					const float *line = channel + (size_t)sy * x.extent + offset;
+					std::fill(out, out + t0, 0.0f);
+					if (x.step == 1)
+						std::copy(line + t0, line + t1, out + t0);
+					else
+						for (int t = t0; t < t1; ++t)
+							out[t] = line[(ptrdiff_t)x.step * t];
+					std::fill(out + t1, out + x.size, 0.0f);
+				}
+			}
+		}
+	});
+}
+
+// dst[n, ch, y(i, j), x(t, l)] += col[(ch, j, l)][(n, i, t)], the adjoint of conv_gather. Channels are
+// split across the pool, the taps of one channel overlap and are added in turn.
+static void conv_scatter_add(const float *col, int samples, int channels, const ConvAxis &y, const ConvAxis &x, float *dst)
+{
+	const int taps = y.taps * x.taps;
+	const size_t columns = (size_t)samples * y.size * x.size;
+	const size_t plane = (size_t)y.extent * x.extent;
+	CpuParallel::for_range(channels, std::max<size_t>(1, kConvGrain / (columns * taps)), [&](size_t begin, size_t end) {
+		for (size_t ch = begin; ch < end; ++ch) {
+			for (int tap = 0; tap < taps; ++tap) {
+				const int j = tap / x.taps, l = tap % x.taps;
+				const int offset = x.tap_step * l + x.base;
+				const int t0 = std::min(x.size, std::max(0, floor_div(-offset + x.step - 1, x.step)));
+				const int t1 = std::max(t0, std::min(x.size, floor_div(x.extent - 1 - offset, x.step) + 1));
+				const float *in = col + (ch * taps + tap) * columns;
+				for (int n = 0; n < samples; ++n) {
+					float *channel = dst + ((size_t)n * channels + ch) * plane;
+					for (int i = 0; i < y.size; ++i, in += x.size) {
+						const int sy = y.step * i + y.tap_step * j + y.base;
+						if (sy < 0 || sy >= y.extent)
+							continue;
+						float *line = channel + (size_t)sy * x.extent + offset;
+						for (int t = t0; t < t1; ++t)
+							line[(ptrdiff_t)x.step * t] += in[t];
+					}
+				}
+			}
+		}
+	});
+}
+
+// The filter slices of one pass: the u * v stride phases without dilation, the whole filter otherwise.
+static std::vector<std::pair<ConvTaps, ConvTaps>> conv_slices(const CpuConvolution::Shape &shape)
+{
+	std::vector<std::pair<ConvTaps, ConvTaps>> slices;
+	if (shape.dilation_h != 1 || shape.dilation_w != 1) {
+		slices.push_back({ { 0, 1, shape.r }, { 0, 1, shape.s } });
+		return slices;
+	}
+	for (int ph = 0; ph < std::min(shape.u, shape.r); ++ph)
+		for (int pw = 0; pw < std::min(shape.v, shape.s); ++pw)
+			slices.push_back({ { ph, shape.u, (shape.r - ph + shape.u - 1) / shape.u }, { pw, shape.v, (shape.s - pw + shape.v - 1) / shape.v } });
+	return slices;
+}
+
+// Columns of x for the taps of a slice, rows (c, j, l) and columns (n, p, q).
+static ConvAxis conv_x_axis(int size, int stride, int dilation, int pad, int extent, const ConvTaps &taps)
+{
+	return { size, taps.taps, stride, taps.tap_stride * dilation, taps.tap0 * dilation - pad, extent };
+}
+
+// packed[k][(c, j, l)] = w[k, c, taps_h(j), taps_w(l)], transposed to packed[(k, j, l)][c] when by_output is false.
+static void conv_pack_filter(const CpuConvolution::Shape &shape, const float *w, const ConvTaps &th, const ConvTaps &tw, bool by_output, float *packed)
+{
+	const int taps = th.taps * tw.taps;
+	for (int k = 0; k < shape.k; ++k)
+		for (int c = 0; c < shape.c; ++c)
+			for (int j = 0; j < th.taps; ++j)
+				for (int l = 0; l < tw.taps; ++l) {
+					const float value = w[(((size_t)k * shape.c + c) * shape.r + th.tap0 + th.tap_stride * j) * shape.s + tw.tap0 + tw.tap_stride * l];
+					if (by_output)
+						packed[((size_t)k * shape.c + c) * taps + j * tw.taps + l] = value;
+					else
+						packed[((size_t)k * taps + j * tw.taps + l) * shape.c + c] = value;
+				}
+}
+
+// [rows, samples, plane] <-> [samples, rows, plane] for GEMM operands that are batched along columns.
+static void conv_swap_batch(const float *src, int samples, int rows, int plane, bool to_batch_major, float *dst)
+{
+	const int sizes[3] = { samples, rows, plane };
+	const ptrdiff_t batch_major[3] = { (ptrdiff_t)rows * plane, plane, 1 };
+	const ptrdiff_t row_major[3] = { plane, (ptrdiff_t)samples * plane, 1 };
+	CpuTranspose::copy(3, sizes, src, to_batch_major ? row_major : batch_major, dst, to_batch_major ? batch_major : row_major);
+}
+
+static void conv_forward_gemm(const CpuConvolution::Shape &shape, const float *x, const float *w, float *y)
+{
+	const int columns = shape.n * shape.p * shape.q;
+	std::vector<float> result((size_t)shape.k * columns);
+	std::vector<float> col, packed;
+	auto slices = conv_slices(shape);
+	for (size_t i = 0; i < slices.size(); ++i) {
+		const ConvTaps &th = slices[i].first, &tw = slices[i].second;
+		const int depth = shape.c * th.taps * tw.taps;
+		col.resize((size_t)depth * columns);
+		packed.resize((size_t)shape.k * depth);
+		conv_gather(x, shape.n, shape.c, conv_x_axis(shape.p, shape.u, shape.dilation_h, shape.pad_h, shape.h, th), conv_x_axis(shape.q, shape.v, shape.dilation_w, shape.pad_w, shape.w, tw), col.data());
+		conv_pack_filter(shape, w, th, tw, true, packed.data());
+		CpuGemm::sgemm(false, false, shape.k, columns, depth, 1.0f, packed.data(), depth, col.data(), columns, i == 0 ? 0.0f : 1.0f, result.data(), columns);
+	}
+	conv_swap_batch(result.data(), shape.n, shape.k, shape.p * shape.q, true, y);
+}
+
+static void conv_backward_data_gemm(const CpuConvolution::Shape &shape, const float *w, const float *dy, float *dx)
+{
+	const int columns = shape.n * shape.p * shape.q;
+	std::vector<float> dy_rows((size_t)shape.k * columns);
+	conv_swap_batch(dy, shape.n, shape.k, shape.p * shape.q, false, dy_rows.data());
+	if (shape.dilation_h != 1 || shape.dilation_w != 1) {
+		// col[(c, r, s)][(n, p, q)] = sum_k w[k, (c, r, s)] * dy[k, (n, p, q)], then col2im.
+		const int depth = shape.c * shape.r * shape.s;
+		std::vector<float> col((size_t)depth * columns);
+		CpuGemm::sgemm(true, false, depth, columns, shape.k, 1.0f, w, depth, dy_rows.data(), columns, 0.0f, col.data(), columns);
+		std::fill(dx, dx + (size_t)shape.n * shape.c * shape.h * shape.w, 0.0f);
+		const ConvTaps th = { 0, 1, shape.r }, tw = { 0, 1, shape.s };
+		conv_scatter_add(col.data(), shape.n, shape.c, conv_x_axis(shape.p, shape.u, shape.dilation_h, shape.pad_h, shape.h, th), conv_x_axis(shape.q, shape.v, shape.dilation_w, shape.pad_w, shape.w, tw), dx);
+		return;
+	}
+	// x rows of phase ph are h = u * a + ph - pad_h, they see taps r = ph + u * j through dy row a - j.
+	std::vector<float> col, packed, result;
+	for (int ph = 0; ph < shape.u; ++ph) {
+		const int a0 = floor_div(shape.pad_h - ph + shape.u - 1, shape.u);
+		const int rows = std::max(0, floor_div(shape.h - 1 + shape.pad_h - ph, shape.u) - a0 + 1);
+		const ConvTaps th = { ph, shape.u, std::max(0, (shape.r - ph + shape.u - 1) / shape.u) };
+		for (int pw = 0; pw < shape.v; ++pw) {
+			const int b0 = floor_div(shape.pad_w - pw + shape.v - 1, shape.v);
+			const int cols = std::max(0, floor_div(shape.w - 1 + shape.pad_w - pw, shape.v) - b0 + 1);
+			const ConvTaps tw = { pw, shape.v, std::max(0, (shape.s - pw + shape.v - 1) / shape.v) };
+			const int phase_columns = shape.n * rows * cols;
+			if (phase_columns == 0)
+				continue;
+			const int depth = shape.k * th.taps * tw.taps;
+			result.resize((size_t)shape.c * phase_columns);
+			if (depth == 0)
+				std::fill(result.begin(), result.end(), 0.0f);
+			else {
+				col.resize((size_t)depth * phase_columns);
+				packed.resize((size_t)depth * shape.c);
+				conv_gather(dy, shape.n, shape.k, { rows, th.taps, 1, -1, a0, shape.p }, { cols, tw.taps, 1, -1, b0, shape.q }, col.data());
+				conv_pack_filter(shape, w, th, tw, false, packed.data());
+				CpuGemm::sgemm(true, false, shape.c, phase_columns, depth, 1.0f, packed.data(), shape.c, col.data(), phase_columns, 0.0f, result.data(), phase_columns);
+			}
+			// Interleaved write of the phase, result is [c][n][a][b].
+			const int sizes[4] = { shape.c, shape.n, rows, cols };
+			const ptrdiff_t src_strides[4] = { phase_columns, (ptrdiff_t)rows * cols, cols, 1 };
+			const ptrdiff_t dst_strides[4] = { (ptrdiff_t)shape.h * shape.w, (ptrdiff_t)shape.c * shape.h * shape.w, (ptrdiff_t)shape.u * shape.w, shape.v };
+			CpuTranspose::copy(4, sizes, result.data(), src_strides, dx + (ptrdiff_t)(shape.u * a0 + ph - shape.pad_h) * shape.w + shape.v * b0 + pw - shape.pad_w, dst_strides);
+		}
+	}
+}
+
+// The (k, c) slices of a filter: which are nonzero, and, when every nonzero slice is rank-1,
+// w[k, c, r, s] = column[(k, c), r] * row[(k, c), s]. Gaussian kernels are rank-1 and diagonal over channels.
+struct ConvFilterPlan {
+	std::vector<std::vector<int>> channels;
+	int nonzero;
+	bool separable;
+	std::vector<float> column, row;
+};
+
+static ConvFilterPlan conv_plan_filter(const CpuConvolution::Shape &shape, const float *w)
+{
+	ConvFilterPlan plan;
+	plan.channels.resize(shape.k);
+	plan.nonzero = 0;
+	plan.separable = true;
+	plan.column.assign((size_t)shape.k * shape.c * shape.r, 0.0f);
+	plan.row.assign((size_t)shape.k * shape.c * shape.s, 0.0f);
+	const int taps = shape.r * shape.s;
+	for (int k = 0; k < shape.k; ++k)
+		for (int c = 0; c < shape.c; ++c) {
+			const size_t slice = (size_t)k * shape.c + c;
+			const float *f = w + slice * taps;
+			int pivot = 0;
+			for (int t = 1; t < taps; ++t)
+				if (std::abs(f[t]) > std::abs(f[pivot]))
+					pivot = t;
+			const float peak = std::abs(f[pivot]);
+			if (peak == 0.0f)
+				continue;
+			plan.channels[k].push_back(c);
+			++plan.nonzero;
+			if (!plan.separable)
+				continue;
+			// Fit through the pivot's row and column, then check every tap.
+			const int pr = pivot / shape.s, ps = pivot % shape.s;
+			float *column = &plan.column[slice * shape.r], *row = &plan.row[slice * shape.s];
+			for (int r = 0; r < shape.r; ++r)
+				column[r] = f[r * shape.s + ps];
+			for (int s = 0; s < shape.s; ++s)
+				row[s] = f[pr * shape.s + s] / f[pivot];
+			for (int t = 0; t < taps && plan.separable; ++t)
+				plan.separable = std::abs(f[t] - column[t / shape.s] * row[t % shape.s]) <= kRankTolerance * peak;
+		}
+	return plan;
+}
+
+// Overlap-save tiling of the FFT path: each fh x fw transform yields (fh - r + 1) x (fw - s + 1) outputs.
+struct ConvFftTiles {
+	int fh, fw;
+	int tile_p, tile_q;
+	int tiles_p, tiles_q;
+	double cost;
+};
+
+// Tile sizes of least estimated ns, among powers of two from the filter size up to a cache-sized tile
+// or one tile covering the whole output.
+static ConvFftTiles conv_fft_tiles(const CpuConvolution::Shape &shape, const ConvFilterPlan &plan)
+{
+	ConvFftTiles best = { 0, 0, 0, 0, 0, 0, -1.0 };
+	const int min_h = CpuFft::next_power_of_two(shape.r), min_w = CpuFft::next_power_of_two(shape.s);
+	const int max_h = std::min(CpuFft::next_power_of_two(shape.p + shape.r - 1), std::max(kFftMaxTile, 2 * min_h));
+	const int max_w = std::min(CpuFft::next_power_of_two(shape.q + shape.s - 1), std::max(kFftMaxTile, 2 * min_w));
+	for (int fh = min_h; fh <= max_h; fh *= 2)
+		for (int fw = min_w; fw <= max_w; fw *= 2) {
+			const int tile_p = std::min(shape.p, fh - shape.r + 1), tile_q = std::min(shape.q, fw - shape.s + 1);
+			const int tiles_p = (shape.p + tile_p - 1) / tile_p, tiles_q = (shape.q + tile_q - 1) / tile_q;
+			const double grid = (double)fh * fw, tiles = (double)shape.n * tiles_p * tiles_q;
+			if ((size_t)plan.nonzero * fh * fw > kFftSpectrumLimit)
+				continue;
+			const double transforms = (plan.nonzero + 1) / 2 + tiles * ((shape.c + 1) / 2 + (shape.k + 1) / 2);
+			const double cost = 5.0 * transforms * grid * std::log2(grid) / kFftRate + 8.0 * tiles * plan.nonzero * grid / kSpectralRate;
+			if (best.cost < 0.0 || cost < best.cost)
+				best = { fh, fw, tile_p, tile_q, tiles_p, tiles_q, cost };
+		}
+	return best;
+}
+
+// Estimated ns of each algorithm, negative when it does not apply.
+static double conv_cost(const CpuConvolution::Shape &shape, const ConvFilterPlan &plan, CpuConvolution::Algorithm algorithm)
+{
+	const double n = shape.n, planes_y = (double)shape.p * shape.q;
+	switch (algorithm) {
+	case CpuConvolution::ALGO_GEMM: {
+		const double depth = (double)shape.c * shape.r * shape.s;
+		return 2.0 * n * shape.k * depth * planes_y / kGemmRate + n * depth * planes_y / kGatherRate;
+	}
+	case CpuConvolution::ALGO_SEPARABLE:
+		if (!plan.separable)
+			return -1.0;
+		return 2.0 * n * plan.nonzero * ((double)shape.h * shape.q * shape.s + planes_y * shape.r) / kSeparableRate;
+	case CpuConvolution::ALGO_FFT: {
+		if (shape.u != 1 || shape.v != 1 || shape.dilation_h != 1 || shape.dilation_w != 1)
+			return -1.0;
+		return conv_fft_tiles(shape, plan).cost;
+	}
+	default:
+		return -1.0;
+	}
+}
+
+static CpuConvolution::Algorithm conv_choose(const CpuConvolution::Shape &shape, const ConvFilterPlan &plan)
+{
+	CpuConvolution::Algorithm best = CpuConvolution::ALGO_GEMM;
+	double best_cost = conv_cost(shape, plan, best);
+	for (auto algorithm : { CpuConvolution::ALGO_SEPARABLE, CpuConvolution::ALGO_FFT }) {
+		const double cost = conv_cost(shape, plan, algorithm);
+		if (cost >= 0.0 && cost < best_cost) {
+			best = algorithm;
+			best_cost = cost;
+		}
+	}
+	return best;
+}
+
+// Per (n, k): a row pass of each nonzero slice into tmp[h][q], then its column pass accumulated into y.
+static void conv_forward_separable(const CpuConvolution::Shape &shape, const ConvFilterPlan &plan, const float *x, float *y)
+{
+	const size_t plane_x = (size_t)shape.h * shape.w, plane_y = (size_t)shape.p * shape.q;
+	CpuParallel::for_range((size_t)shape.n * shape.k, 1, [&](size_t begin, size_t end) {
+		std::vector<float> tmp((size_t)shape.h * shape.q);
+		for (size_t task = begin; task < end; ++task) {
+			const int n = (int)(task / shape.k), k = (int)(task % shape.k);
+			float *dst = y + task * plane_y;
+			std::fill(dst, dst + plane_y, 0.0f);
+			for (int c : plan.channels[k]) {
+				const size_t slice = (size_t)k * shape.c + c;
+				const float *src = x + ((size_t)n * shape.c + c) * plane_x;
+				const float *column = &plan.column[slice * shape.r], *row = &plan.row[slice * shape.s];
+				std::fill(tmp.begin(), tmp.end(), 0.0f);
+				for (int s = 0; s < shape.s; ++s) {
+					// Output columns whose tap s reads inside the row.
+					const int offset = s * shape.dilation_w - shape.pad_w;
+					const int q0 = std::max(0, floor_div(-offset + shape.v - 1, shape.v));
+					const int q1 = std::min(shape.q - 1, floor_div(shape.w - 1 - offset, shape.v));
+					const float tap = row[s];
+					for (int h = 0; h < shape.h; ++h) {
+						const float * __restrict in = src + (size_t)h * shape.w + offset;
+						float * __restrict out = &tmp[(size_t)h * shape.q];
+						if (shape.v == 1)
+							for (int q = q0; q <= q1; ++q)
+								out[q] += tap * in[q];
+						else
+							for (int q = q0; q <= q1; ++q)
+								out[q] += tap * in[q * shape.v];
+					}
+				}
+				for (int p = 0; p < shape.p; ++p) {
+					float * __restrict out = dst + (size_t)p * shape.q;
+					for (int r = 0; r < shape.r; ++r) {
+						const int h = p * shape.u + r * shape.dilation_h - shape.pad_h;
+						if (h < 0 || h >= shape.h)
+							continue;
+						const float tap = column[r];
+						const float * __restrict in = &tmp[(size_t)h * shape.q];
+						for (int q = 0; q < shape.q; ++q)
+							out[q] += tap * in[q];
+					}
+				}
+			}
+		}
+	});
+}
+
+// Spectra of count real planes, two per complex transform: z = a + i b gives A = (Z[f] + conj(Z[-f])) / 2
+// and B = (Z[f] - conj(Z[-f])) / 2i. load(j, dst) writes plane j into the top left of a zeroed
+// fh x fw grid, its spectrum goes to re / im + j * fh * fw. z holds two grids of scratch.
+template <typename Load>
+static void conv_real_spectra(int count, int fh, int fw, Load load, float *re, float *im, float *z)
+{
+	const size_t grid = (size_t)fh * fw;
+	float *zr = z, *zi = z + grid;
+	for (int a = 0; a < count; a += 2) {
+		const int b = a + 1;
+		std::fill(z, z + 2 * grid, 0.0f);
+		load(a, zr);
+		if (b < count)
+			load(b, zi);
+		CpuFft::transform_2d(fh, fw, zr, zi, false);
+		float *ar = re + a * grid, *ai = im + a * grid;
+		if (b >= count) {
+			std::copy(zr, zr + grid, ar);
+			std::copy(zi, zi + grid, ai);
+			continue;
+		}
+		float *br = re + b * grid, *bi = im + b * grid;
+		for (int i = 0; i < fh; ++i) {
+			const size_t mirror_row = (size_t)((fh - i) & (fh - 1)) * fw;
+			for (int j = 0; j < fw; ++j) {
+				const size_t f = (size_t)i * fw + j, m = mirror_row + ((fw - j) & (fw - 1));
+				ar[f] = 0.5f * (zr[f] + zr[m]);
+				ai[f] = 0.5f * (zi[f] - zi[m]);
+				br[f] = 0.5f * (zi[f] + zi[m]);
+				bi[f] = 0.5f * (zr[m] - zr[f]);
+			}
+		}
+	}
+}
+
+// Cross-correlation by the convolution theorem, stride 1 and no dilation, by overlap-save: a tile of
+// outputs p0..p0 + tile_p - 1 reads input rows p0 - pad_h + t for t < tile_p + r - 1 <= fh, copied to
+// the top left of the grid. Then IFFT(X conj(W))[t] = sum_r x[t + r] w[r] for t < tile_p, no tap wraps.
+static void conv_forward_fft(const CpuConvolution::Shape &shape, const ConvFilterPlan &plan, const float *x, const float *w, float *y)
+{
+	const ConvFftTiles tiles = conv_fft_tiles(shape, plan);
+	const int fh = tiles.fh, fw = tiles.fw;
+	const size_t grid = (size_t)fh * fw, taps = (size_t)shape.r * shape.s;
+	// Spectra of the nonzero slices, in (k, c) order.
+	std::vector<const float *> slices;
+	std::vector<size_t> first(shape.k + 1, 0);
+	for (int k = 0; k < shape.k; ++k) {
+		for (int c : plan.channels[k])
+			slices.push_back(w + ((size_t)k * shape.c + c) * taps);
+		first[k + 1] = slices.size();
+	}
+	std::vector<float> wr(slices.size() * grid), wi(slices.size() * grid);
+	CpuParallel::for_range((slices.size() + 1) / 2, 1, [&](size_t begin, size_t end) {
+		std::vector<float> z(2 * grid);
+		auto load = [&](int j, float *dst) {
+			const float *slice = slices[2 * begin + j];
+			for (int r = 0; r < shape.r; ++r)
+				std::copy(slice + (size_t)r * shape.s, slice + (size_t)(r + 1) * shape.s, dst + (size_t)r * fw);
+		};
+		const int count = (int)std::min(slices.size(), 2 * end) - (int)(2 * begin);
+		conv_real_spectra(count, fh, fw, load, &wr[2 * begin * grid], &wi[2 * begin * grid], z.data());
+	});
+	const size_t tiles_per_sample = (size_t)tiles.tiles_p * tiles.tiles_q;
+	const float scale = 1.0f / grid;
+	CpuParallel::for_range((size_t)shape.n * tiles_per_sample, 1, [&](size_t begin, size_t end) {
+		std::vector<float> xr((size_t)shape.c * grid), xi((size_t)shape.c * grid), z(2 * grid);
+		for (size_t task = begin; task < end; ++task) {
+			const int n = (int)(task / tiles_per_sample), tile = (int)(task % tiles_per_sample);
+			const int p0 = tile / tiles.tiles_q * tiles.tile_p, q0 = tile % tiles.tiles_q * tiles.tile_q;
+			const int rows = std::min(tiles.tile_p, shape.p - p0), cols = std::min(tiles.tile_q, shape.q - q0);
+			const float *sample = x + (size_t)n * shape.c * shape.h * shape.w;
+			// Input window of the tile, zero outside the image.
+			const int h0 = p0 - shape.pad_h, w0 = q0 - shape.pad_w;
+			const int t0 = std::max(0, -h0), t1 = std::min(rows + shape.r - 1, shape.h - h0);
+			const int l0 = std::max(0, -w0), l1 = std::min(cols + shape.s - 1, shape.w - w0);
+			auto load = [&](int c, float *dst) {
+				for (int t = t0; t < t1; ++t) {
+					const float *src = sample + ((size_t)c * shape.h + h0 + t) * shape.w + w0;
+					std::copy(src + l0, src + l1, dst + (size_t)t * fw + l0);
+				}
+			};
+			conv_real_spectra(shape.c, fh, fw, load, xr.data(), xi.data(), z.data());
+			// Outputs k and k + 1 share an inverse transform as Y_k + i Y_k+1.
+			float *zr = z.data(), *zi = z.data() + grid;
+			for (int k0 = 0; k0 < shape.k; k0 += 2) {
+				std::fill(z.begin(), z.end(), 0.0f);
+				for (int k = k0; k < std::min(shape.k, k0 + 2); ++k) {
+					// X conj(W), times i for the second output.
+					float * __restrict dr = k == k0 ? zr : zi;
+					float * __restrict di = k == k0 ? zi : zr;
+					const float sign = k == k0 ? 1.0f : -1.0f;
+					for (size_t j = first[k]; j < first[k + 1]; ++j) {
+						const int c = plan.channels[k][j - first[k]];
+						const float * __restrict ar = &xr[c * grid], * __restrict ai = &xi[c * grid];
+						const float * __restrict br = &wr[j * grid], * __restrict bi = &wi[j * grid];
+						for (size_t f = 0; f < grid; ++f) {
+							dr[f] += ar[f] * br[f] + ai[f] * bi[f];
+							di[f] += sign * (ai[f] * br[f] - ar[f] * bi[f]);
+						}
+					}
+				}
+				CpuFft::transform_2d(fh, fw, zr, zi, true);
+				for (int k = k0; k < std::min(shape.k, k0 + 2); ++k) {
+					const float *src = k == k0 ? zr : zi;
+					float *dst = y + ((size_t)n * shape.k + k) * shape.p * shape.q + (size_t)p0 * shape.q + q0;
+					for (int t = 0; t < rows; ++t)
+						for (int l = 0; l < cols; ++l)
+							dst[(size_t)t * shape.q + l] = scale * src[(size_t)t * fw + l];
+				}
+			}
+		}
+	});
+}
+
+int CpuConvolution::output_size(int input, int filter, int pad, int stride, int dilation)
+{
+	return (input + 2 * pad - ((filter - 1) * dilation + 1)) / stride + 1;
+}
+
+CpuConvolution::Algorithm CpuConvolution::choose_forward(const Shape &shape, const float *w)
+{
+	return conv_choose(shape, conv_plan_filter(shape, w));
+}
+
+void CpuConvolution::forward(const Shape &shape, const float *x, const float *w, float *y, Algorithm algorithm)
+{
+	if (algorithm == ALGO_GEMM) {
+		conv_forward_gemm(shape, x, w, y);
+		return;
+	}
+	const ConvFilterPlan plan = conv_plan_filter(shape, w);
+	if (algorithm == ALGO_AUTO)
+		algorithm = conv_choose(shape, plan);
+	LOG_IF(FATAL, algorithm != ALGO_GEMM && conv_cost(shape, plan, algorithm) < 0.0) << "CpuConvolution - algorithm " << algorithm << " does not apply to this filter and shape";
+	switch (algorithm) {
+	case ALGO_SEPARABLE:
+		conv_forward_separable(shape, plan, x, y);
+		break;
+	case ALGO_FFT:
+		conv_forward_fft(shape, plan, x, w, y);
+		break;
+	default:
+		conv_forward_gemm(shape, x, w, y);
+	}
+}
+
+void CpuConvolution::backward_filter(const Shape &shape, const float *x, const float *dy, float *dw)
+{
+	const int columns = shape.n * shape.p * shape.q;
+	std::vector<float> dy_rows((size_t)shape.k * columns);
+	conv_swap_batch(dy, shape.n, shape.k, shape.p * shape.q, false, dy_rows.data());
+	std::vector<float> col, result;
+	for (auto &slice : conv_slices(shape)) {
+		const ConvTaps &th = slice.first, &tw = slice.second;
+		const int depth = shape.c * th.taps * tw.taps;
+		col.resize((size_t)depth * columns);
+		result.resize((size_t)shape.k * depth);
+		conv_gather(x, shape.n, shape.c, conv_x_axis(shape.p, shape.u, shape.dilation_h, shape.pad_h, shape.h, th), conv_x_axis(shape.q, shape.v, shape.dilation_w, shape.pad_w, shape.w, tw), col.data());
+		CpuGemm::sgemm(false, true, shape.k, depth, columns, 1.0f, dy_rows.data(), columns, col.data(), columns, 0.0f, result.data(), depth);
+		// Interleave the slice back into the filter.
+		const int sizes[4] = { shape.k * shape.c, th.taps, tw.taps, 1 };
+		const ptrdiff_t src_strides[4] = { th.taps * tw.taps, tw.taps, 1, 1 };
+		const ptrdiff_t dst_strides[4] = { (ptrdiff_t)shape.r * shape.s, (ptrdiff_t)th.tap_stride * shape.s, tw.tap_stride, 1 };
+		CpuTranspose::copy(4, sizes, result.data(), src_strides, dw + th.tap0 * shape.s + tw.tap0, dst_strides);
+	}
+}
+
+void CpuConvolution::backward_data(const Shape &shape, const float *w, const float *dy, float *dx)
+{
+	// With stride 1 and no dilation this is the forward correlation of dy with the flipped filter
+	// wt[c, k, r, s] = w[k, c, R - 1 - r, S - 1 - s] padded by R - 1 - pad_h, so it can take the
+	// separable and FFT paths when the cost model prefers them.
+	if (shape.u == 1 && shape.v == 1 && shape.dilation_h == 1 && shape.dilation_w == 1 && shape.pad_h < shape.r && shape.pad_w < shape.s) {
+		const Shape flipped = { shape.n, shape.k, shape.p, shape.q, shape.c, shape.r, shape.s, shape.h, shape.w, shape.r - 1 - shape.pad_h, shape.s - 1 - shape.pad_w, 1, 1, 1, 1 };
+		const size_t taps = (size_t)shape.r * shape.s;
+		std::vector<float> wt((size_t)shape.k * shape.c * taps);
+		for (int k = 0; k < shape.k; ++k)
+			for (int c = 0; c < shape.c; ++c) {
+				const float *src = w + ((size_t)k * shape.c + c) * taps;
+				std::reverse_copy(src, src + taps, &wt[((size_t)c * shape.k + k) * taps]);
+			}
+		const ConvFilterPlan plan = conv_plan_filter(flipped, wt.data());
+		const Algorithm algorithm = conv_choose(flipped, plan);
+		if (algorithm == ALGO_SEPARABLE) {
+			conv_forward_separable(flipped, plan, dy, dx);
+			return;
+		}
+		if (algorithm == ALGO_FFT) {
+			conv_forward_fft(flipped, plan, dy, wt.data(), dx);
+			return;
+		}
+	}
+	conv_backward_data_gemm(shape, w, dy, dx);
+}
+
+// Samples per chunk of the channel blocked paths.
+static int conv_blocked_samples(const CpuConvolution::Shape &shape)
+{
+	const size_t per_sample = (size_t)shape.p * shape.q * shape.c * shape.r * shape.s;
+	return (int)std::max<size_t>(1, std::min<size_t>(shape.n, kBlockedColumns / std::max<size_t>(1, per_sample)));
+}
+
+// Calls tap(n, row, offset, dst) for every (cb, r, s) tap of every output (n, p, q) of samples n0..n1,
+// offset is the first of the block channels it reads in x, -1 outside the image, and dst its run in the
+// row of col[(n, p, q)][(cb, r, s, l)]. Samples are split across the pool.
+template <class Tap>
+static void conv_blocked_taps(const CpuConvolution::Shape &shape, int block, int n0, int n1, float *col, const Tap &tap)
+{
+	const int blocks = shape.c / block;
+	const size_t plane = (size_t)shape.p * shape.q, depth = (size_t)shape.c * shape.r * shape.s;
+	CpuParallel::for_range(n1 - n0, 1, [&](size_t begin, size_t end) {
+		for (size_t i = begin; i < end; ++i) {
+			const int n = n0 + (int)i;
+			for (size_t pq = 0; pq < plane; ++pq) {
+				const int p = (int)(pq / shape.q), q = (int)(pq % shape.q);
+				float *dst = col + (i * plane + pq) * depth;
+				for (int cb = 0; cb < blocks; ++cb) {
+					const ptrdiff_t channel = ((ptrdiff_t)n * blocks + cb) * shape.h * shape.w;
+					for (int r = 0; r < shape.r; ++r) {
+						const int h = p * shape.u - shape.pad_h + r * shape.dilation_h;
+						for (int s = 0; s < shape.s; ++s, dst += block) {
+							const int w = q * shape.v - shape.pad_w + s * shape.dilation_w;
+							const bool inside = h >= 0 && h < shape.h && w >= 0 && w < shape.w;
+							tap(inside ? (channel + (ptrdiff_t)h * shape.w + w) * block : -1, dst);
+						}
+					}
+				}
+			}
+		}
+	});
+}
+
+// packed[(cb, r, s, l)][k] = w[k, cb * block + l, r, s], or its inverse.
+static void conv_pack_blocked(const CpuConvolution::Shape &shape, int block, bool pack, const float *src, float *dst)
+{
+	const int sizes[5] = { shape.k, shape.c / block, block, shape.r, shape.s };
+	const ptrdiff_t filter[5] = { (ptrdiff_t)shape.c * shape.r * shape.s, (ptrdiff_t)block * shape.r * shape.s, (ptrdiff_t)shape.r * shape.s, shape.s, 1 };
+	const ptrdiff_t packed[5] = { 1, (ptrdiff_t)shape.r * shape.s * block * shape.k, shape.k, (ptrdiff_t)shape.s * block * shape.k, (ptrdiff_t)block * shape.k };
+	if (pack)
+		CpuTranspose::copy(5, sizes, src, filter, dst, packed);
+	else
+		CpuTranspose::copy(5, sizes, src, packed, dst, filter);
+}
+
+// dy as GEMM rows [(n, p, q)][k], reordered into buffer unless it is NHWC already.
+static const float *conv_blocked_rows(const CpuConvolution::Shape &shape, int y_block, const float *dy, std::vector<float> &buffer)
+{
+	if (y_block == shape.k)
+		return dy;
+	buffer.resize((size_t)shape.n * shape.k * shape.p * shape.q);
+	CpuLayout::reorder({ shape.n, shape.k, shape.p, shape.q }, y_block, dy, shape.k, buffer.data());
+	return buffer.data();
+}
+
+void CpuConvolution::forward_blocked(const Shape &shape, int x_block, int y_block, const float *x, const float *w, float *y)
+{
+	const size_t depth = (size_t)shape.c * shape.r * shape.s, plane = (size_t)shape.p * shape.q;
+	std::vector<float> packed(depth * shape.k), rows, col;
+	conv_pack_blocked(shape, x_block, true, w, packed.data());
+	// The GEMM writes [(n, p, q)][k], which is y itself when y is NHWC.
+	float *out = y;
+	if (y_block != shape.k) {
+		rows.resize((size_t)shape.n * plane * shape.k);
+		out = rows.data();
+	}
+	const int samples = conv_blocked_samples(shape);
+	for (int n0 = 0; n0 < shape.n; n0 += samples) {
+		const int n1 = std::min(shape.n, n0 + samples);
+		col.resize((size_t)(n1 - n0) * plane * depth);
+		conv_blocked_taps(shape, x_block, n0, n1, col.data(), [&](ptrdiff_t offset, float *dst) {
+			if (offset < 0)
+				std::fill(dst, dst + x_block, 0.0f);
+			else
+				std::copy(x + offset, x + offset + x_block, dst);
+		});
+		CpuGemm::sgemm(false, false, (n1 - n0) * (int)plane, shape.k, (int)depth, 1.0f, col.data(), (int)depth, packed.data(), shape.k, 0.0f, out + (size_t)n0 * plane * shape.k, shape.k);
+	}
+	if (out != y)
+		CpuLayout::reorder({ shape.n, shape.k, shape.p, shape.q }, shape.k, out, y_block, y);
+}
+
+void CpuConvolution::backward_data_blocked(const Shape &shape, int x_block, int y_block, const float *w, const float *dy, float *dx)
+{
+	const size_t depth = (size_t)shape.c * shape.r * shape.s, plane = (size_t)shape.p * shape.q;
+	std::vector<float> packed(depth * shape.k), buffer, col;
+	conv_pack_blocked(shape, x_block, true, w, packed.data());
+	const float *rows = conv_blocked_rows(shape, y_block, dy, buffer);
+	std::fill(dx, dx + (size_t)shape.n * shape.c * shape.h * shape.w, 0.0f);
+	const int samples = conv_blocked_samples(shape);
+	for (int n0 = 0; n0 < shape.n; n0 += samples) {
+		const int n1 = std::min(shape.n, n0 + samples);
+		col.resize((size_t)(n1 - n0) * plane * depth);
+		CpuGemm::sgemm(false, true, (n1 - n0) * (int)plane, (int)depth, shape.k, 1.0f, rows + (size_t)n0 * plane * shape.k, shape.k, packed.data(), shape.k, 0.0f, col.data(), (int)depth);
+		// Taps of one sample overlap, samples do not.
+		conv_blocked_taps(shape, x_block, n0, n1, col.data(), [&](ptrdiff_t offset, float *src) {
+			if (offset >= 0)
+				for (int l = 0; l < x_block; ++l)
+					dx[offset + l] += src[l];
+		});
+	}
+}
+
+void CpuConvolution::backward_filter_blocked(const Shape &shape, int x_block, int y_block, const float *x, const float *dy, float *dw)
+{
+	const size_t depth = (size_t)shape.c * shape.r * shape.s, plane = (size_t)shape.p * shape.q;
+	std::vector<float> packed(depth * shape.k), buffer, col;
+	const float *rows = conv_blocked_rows(shape, y_block, dy, buffer);
+	const int samples = conv_blocked_samples(shape);
+	for (int n0 = 0; n0 < shape.n; n0 += samples) {
+		const int n1 = std::min(shape.n, n0 + samples);
+		col.resize((size_t)(n1 - n0) * plane * depth);
+		conv_blocked_taps(shape, x_block, n0, n1, col.data(), [&](ptrdiff_t offset, float *dst) {
+			if (offset < 0)
+				std::fill(dst, dst + x_block, 0.0f);
+			else
+				std::copy(x + offset, x + offset + x_block, dst);
+		});
+		CpuGemm::sgemm(true, false, (int)depth, shape.k, (n1 - n0) * (int)plane, 1.0f, col.data(), (int)depth, rows + (size_t)n0 * plane * shape.k, shape.k, n0 == 0 ? 0.0f : 1.0f, packed.data(), shape.k);
+	}
+	conv_pack_blocked(shape, x_block, false, packed.data(), dw);
+}
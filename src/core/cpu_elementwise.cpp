@@ -0,0 +1,585 @@
+#include "core/cpu_elementwise.h"
+#include "core/cpu_parallel.h"
+#include "core/cpu_philox.h"
+#include "core/cpu_vec.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// Below this many elements a loop stays on the calling thread.
+static const size_t kElementwiseGrain = 16384;
+// Dropout mask words drawn per Philox call, 8 blocks of 4 words each.
+static const size_t kDropoutWords = 16;
+// Elements per tile of a fused chain, every stage of a tile runs before the next tile is loaded.
+static const size_t kChainTile = 1024;
+// Partial sums of the channel blocked reductions, fixed so the result does not depend on the pool.
+static const size_t kBlockedPartials = 64;
+
+template <class F>
+static inline void elementwise_chunks(size_t n, size_t grain, const F &fn)
+{
+	if (n <= grain)
+		fn(0, n);
+	else
+		CpuParallel::for_range(n, grain, fn);
+}
+
+// Calls fn with the tag of the requested math tier, so one generic body covers both.
+template <class F>
+static inline void with_accuracy(ExecutionContext::MathAccuracy accuracy, const F &fn)
+{
+	if (accuracy == ExecutionContext::MATH_FAST)
+		fn(FastMath());
+	else
+		fn(AccurateMath());
+}
+
+template <class Op>
+static inline void span1(size_t begin, size_t end, const float *x, float *y, const Op &op)
+{
+	size_t i = begin;
+	for (; i + kVecWidth <= end; i += kVecWidth)
+		store(y + i, op(load(x + i)));
+	for (; i < end; ++i)
+		y[i] = op(x[i]);
+}
+
+template <class Op>
+static inline void span2(size_t begin, size_t end, const float *a, const float *b, float *y, const Op &op)
+{
+	size_t i = begin;
+	for (; i + kVecWidth <= end; i += kVecWidth)
+		store(y + i, op(load(a + i), load(b + i)));
+	for (; i < end; ++i)
+		y[i] = op(a[i], b[i]);
+}
+
+template <class Op>
+static inline void span3(size_t begin, size_t end, const float *a, const float *b, const float *c, float *y, const Op &op)
+{
+	size_t i = begin;
+	for (; i + kVecWidth <= end; i += kVecWidth)
+		store(y + i, op(load(a + i), load(b + i), load(c + i)));
+	for (; i < end; ++i)
+		y[i] = op(a[i], b[i], c[i]);
+}
+
+template <class Op>
+static void map1(size_t n, const float *x, float *y, const Op &op)
+{
+	elementwise_chunks(n, kElementwiseGrain, [&](size_t begin, size_t end) { span1(begin, end, x, y, op); });
+}
+
+template <class Op>
+static void map2(size_t n, const float *a, const float *b, float *y, const Op &op)
+{
+	elementwise_chunks(n, kElementwiseGrain, [&](size_t begin, size_t end) { span2(begin, end, a, b, y, op); });
+}
+
+template <class Op>
+static void map3(size_t n, const float *a, const float *b, const float *c, float *y, const Op &op)
+{
+	elementwise_chunks(n, kElementwiseGrain, [&](size_t begin, size_t end) { span3(begin, end, a, b, c, y, op); });
+}
+
+// y = op(a, b, s) over the planes of [outer, channels, inner] where s = w[o * w_outer + c] is splatted
+// once per plane. b may be null for ops that only read a.
+template <class Op>
+static void map_channel(int outer, int channels, int inner, const float *a, const float *b, const float *w, size_t w_outer, float *y, const Op &op)
+{
+	const size_t planes = (size_t)outer * channels;
+	elementwise_chunks(planes, std::max<size_t>(1, kElementwiseGrain / inner), [&](size_t begin, size_t end) {
+		for (size_t p = begin; p < end; ++p) {
+			const float s = w[(p / channels) * w_outer + p % channels];
+			const Vec sv = splat<Vec>(s);
+			const float *ap = a + p * inner;
+			const float *bp = b ? b + p * inner : ap;
+			float *yp = y + p * inner;
+			size_t i = 0;
+			for (; i + kVecWidth <= (size_t)inner; i += kVecWidth)
+				store(yp + i, op(load(ap + i), load(bp + i), sv));
+			for (; i < (size_t)inner; ++i)
+				yp[i] = op(ap[i], bp[i], s);
+		}
+	});
+}
+
+// First channel of row r of a [outer, channels / block, inner, block] tensor.
+static inline size_t block_row_channel(size_t r, int channels, int inner, int block)
+{
+	return (r / inner) % (channels / block) * block;
+}
+
+// w[c] = scale * sum of op(a, b) over the outer and inner dims of channel c.
+template <class Op>
+static void reduce_channel(int outer, int channels, int inner, const float *a, const float *b, float scale, float *w, const Op &op)
+{
+	CpuParallel::for_range(channels, 1, [&](size_t begin, size_t end) {
+		for (size_t c = begin; c < end; ++c) {
+			Vec acc = splat<Vec>(0);
+			float tail = 0;
+			for (int o = 0; o < outer; ++o) {
+				const size_t base = ((size_t)o * channels + c) * inner;
+				const float *ap = a + base;
+				const float *bp = b + base;
+				size_t i = 0;
+				for (; i + kVecWidth <= (size_t)inner; i += kVecWidth)
+					acc = acc + op(load(ap + i), load(bp + i));
+				for (; i < (size_t)inner; ++i)
+					tail += op(ap[i], bp[i]);
+			}
+			w[c] = scale * (vsum(acc) + tail);
+		}
+	});
+}
+
+void CpuElementwise::add(size_t n, float alpha, const float *a, float beta, const float *b, float *y)
+{
+	if (beta == 0)
+		map1(n, a, y, [=](auto x) { return splat<decltype(x)>(alpha) * x; });
+	else if (alpha == 1 && beta == 1)
+		map2(n, a, b, y, [](auto x1, auto x2) { return x1 + x2; });
+	else
+		map2(n, a, b, y, [=](auto x1, auto x2) { typedef decltype(x1) V; return splat<V>(alpha) * x1 + splat<V>(beta) * x2; });
+}
+
+void CpuElementwise::axpby(size_t n, float alpha, const float *x, float beta, float *y)
+{
+	if (beta == 0)
+		map1(n, x, y, [=](auto v) { return splat<decltype(v)>(alpha) * v; });
+	else
+		map2(n, x, y, y, [=](auto v, auto u) { typedef decltype(v) V; return splat<V>(alpha) * v + splat<V>(beta) * u; });
+}
+
+void CpuElementwise::dot(size_t n, float alpha, const float *a, const float *b, float beta, float *y)
+{
+	if (beta == 0)
+		map2(n, a, b, y, [=](auto x1, auto x2) { return splat<decltype(x1)>(alpha) * x1 * x2; });
+	else
+		map3(n, a, b, y, y, [=](auto x1, auto x2, auto u) { typedef decltype(x1) V; return splat<V>(alpha) * x1 * x2 + splat<V>(beta) * u; });
+}
+
+void CpuElementwise::activation_forward(ExecutionContext::MathAccuracy accuracy, cudnnActivationMode_t mode, float coef, size_t n, const float *x, float *y)
+{
+	switch (mode) {
+	case CUDNN_ACTIVATION_SIGMOID:
+		with_accuracy(accuracy, [&](auto tier) { map1(n, x, y, [=](auto v) { return vsigmoid(v, tier); }); });
+		break;
+	case CUDNN_ACTIVATION_RELU:
+		map1(n, x, y, [](auto v) { return vmax(v, splat<decltype(v)>(0)); });
+		break;
+	case CUDNN_ACTIVATION_TANH:
+		with_accuracy(accuracy, [&](auto tier) { map1(n, x, y, [=](auto v) { return vtanh(v, tier); }); });
+		break;
+	case CUDNN_ACTIVATION_CLIPPED_RELU:
+		map1(n, x, y, [=](auto v) { typedef decltype(v) V; return vmin(vmax(v, splat<V>(0)), splat<V>(coef)); });
+		break;
+	case CUDNN_ACTIVATION_ELU:
+		with_accuracy(accuracy, [&](auto tier) {
+			map1(n, x, y, [=](auto v) { typedef decltype(v) V; return vselect(vgt(v, splat<V>(0)), v, splat<V>(coef) * (vexp(v, tier) - splat<V>(1))); });
+		});
+		break;
+	default:
+		map1(n, x, y, [](auto v) { return v; });
+	}
+}
+
+void CpuElementwise::activation_backward(cudnnActivationMode_t mode, float coef, size_t n, const float *x, const float *y, const float *dy, float *dx)
+{
+	switch (mode) {
+	case CUDNN_ACTIVATION_SIGMOID:
+		map2(n, y, dy, dx, [](auto v, auto d) { return d * v * (splat<decltype(v)>(1) - v); });
+		break;
+	case CUDNN_ACTIVATION_RELU:
+		map2(n, x, dy, dx, [](auto v, auto d) { typedef decltype(v) V; return vselect(vgt(v, splat<V>(0)), d, splat<V>(0)); });
+		break;
+	case CUDNN_ACTIVATION_TANH:
+		map2(n, y, dy, dx, [](auto v, auto d) { return d * (splat<decltype(v)>(1) - v * v); });
+		break;
+	case CUDNN_ACTIVATION_CLIPPED_RELU:
+		map2(n, x, dy, dx, [=](auto v, auto d) { typedef decltype(v) V; return vselect(vand(vgt(v, splat<V>(0)), vlt(v, splat<V>(coef))), d, splat<V>(0)); });
+		break;
+	case CUDNN_ACTIVATION_ELU:
+		map3(n, x, y, dy, dx, [=](auto v, auto u, auto d) { typedef decltype(v) V; return vselect(vgt(v, splat<V>(0)), d, d * (u + splat<V>(coef))); });
+		break;
+	default:
+		map1(n, dy, dx, [](auto d) { return d; });
+	}
+}
+
+void CpuElementwise::leaky_relu(size_t n, float slope, const float *x, const float *x_dy, float *y_dx)
+{
+	map2(n, x, x_dy, y_dx, [=](auto v, auto d) { typedef decltype(v) V; return vselect(vgt(v, splat<V>(0)), d, d * splat<V>(slope)); });
+}
+
+void CpuElementwise::exp_forward(ExecutionContext::MathAccuracy accuracy, size_t n, const float *x, float *y)
+{
+	with_accuracy(accuracy, [&](auto tier) { map1(n, x, y, [=](auto v) { return vexp(v, tier); }); });
+}
+
+void CpuElementwise::exp_backward(ExecutionContext::MathAccuracy accuracy, size_t n, const float *x, const float *dy, float *dx)
+{
+	with_accuracy(accuracy, [&](auto tier) { map2(n, x, dy, dx, [=](auto v, auto d) { return vexp(v, tier) * d; }); });
+}
+
+void CpuElementwise::log_forward(ExecutionContext::MathAccuracy accuracy, size_t n, float coef, const float *x, float *y)
+{
+	with_accuracy(accuracy, [&](auto tier) { map1(n, x, y, [=](auto v) { return splat<decltype(v)>(coef) * vlog(v, tier); }); });
+}
+
+void CpuElementwise::log_backward(size_t n, float coef, const float *x, const float *dy, float *dx)
+{
+	map2(n, x, dy, dx, [=](auto v, auto d) { return splat<decltype(v)>(coef) * d / v; });
+}
+
+void CpuElementwise::abs_forward(size_t n, const float *x, float *y)
+{
+	map1(n, x, y, [](auto v) { return vabs(v); });
+}
+
+void CpuElementwise::abs_backward(size_t n, const float *x, const float *dy, float *dx)
+{
+	map2(n, x, dy, dx, [](auto v, auto d) {
+		typedef decltype(v) V;
+		const V zero = splat<V>(0);
+		return vselect(vgt(v, zero), d, vselect(vlt(v, zero), zero - d, zero));
+	});
+}
+
+void CpuElementwise::square_forward(size_t n, const float *x, float *y)
+{
+	map1(n, x, y, [](auto v) { return v * v; });
+}
+
+void CpuElementwise::square_backward(size_t n, const float *x, const float *dy, float *dx)
+{
+	map2(n, x, dy, dx, [](auto v, auto d) { return splat<decltype(v)>(2) * v * d; });
+}
+
+void CpuElementwise::max_forward(size_t n, const float *a, const float *b, float *y)
+{
+	map2(n, a, b, y, [](auto x1, auto x2) { return vselect(vgt(x1, x2), x1, x2); });
+}
+
+void CpuElementwise::max_backward(size_t n, const float *a, const float *b, const float *dy, float *dx)
+{
+	map3(n, a, b, dy, dx, [](auto x1, auto x2, auto d) { return vselect(vge(x1, x2), d, splat<decltype(d)>(0)); });
+}
+
+void CpuElementwise::nand_forward(size_t n, const float *a, const float *b, float *y)
+{
+	map2(n, a, b, y, [](auto x1, auto x2) { return splat<decltype(x1)>(0) - vmin(x1, x2); });
+}
+
+void CpuElementwise::nand_backward(size_t n, const float *a, const float *b, const float *dy, float *dx)
+{
+	map3(n, a, b, dy, dx, [](auto x1, auto x2, auto d) { typedef decltype(d) V; return vselect(vle(x1, x2), splat<V>(0) - d, splat<V>(0)); });
+}
+
+void CpuElementwise::equal(size_t n, const float *a, const float *b, float *y)
+{
+	map2(n, a, b, y, [](auto x1, auto x2) { typedef decltype(x1) V; return vselect(vlt(vabs(x1 - x2), splat<V>(1e-16f)), splat<V>(1), splat<V>(0)); });
+}
+
+// Keep bits of 32 elements from their random words: kept when the word is at most last.
+static inline uint32_t dropout_bits(const uint32_t *random, uint32_t last)
+{
+	uint32_t bits = 0;
+	for (size_t j = 0; j < 32; j += kVecWidth)
+		bits |= vbits_le(random + j, last) << j;
+	return bits;
+}
+
+// y = x * scale where the bit is set, 0 elsewhere, over count <= 32 elements.
+static inline void dropout_apply(uint32_t bits, float scale, size_t count, const float *x, float *y)
+{
+	const auto s = splat<Vec>(scale), zero = splat<Vec>(0.0f);
+	size_t j = 0;
+	for (; j + kVecWidth <= count; j += kVecWidth)
+		store(y + j, vselect(vbits(bits >> j), load(x + j) * s, zero));
+	for (; j < count; ++j)
+		y[j] = (bits >> j) & 1 ? x[j] * scale : 0.0f;
+}
+
+void CpuElementwise::dropout_forward(size_t n, float dropout, uint64_t seed, uint64_t step, const float *x, float *y, uint32_t *mask)
+{
+	// A word r is kept when r < (1 - dropout) * 2^32, that is r <= last. Full dropout keeps nothing
+	// through a zero scale.
+	const double limit = std::ceil((1.0 - dropout) * 4294967296.0);
+	const uint32_t last = limit >= 4294967296.0 ? 0xFFFFFFFFu : limit >= 1.0 ? (uint32_t)(limit - 1.0) : 0u;
+	const float scale = dropout < 1.0f ? 1.0f / (1.0f - dropout) : 0.0f;
+	const size_t words = (n + 31) / 32;
+	elementwise_chunks(words, kElementwiseGrain / 32, [&](size_t begin, size_t end) {
+		uint32_t random[32 * kDropoutWords];
+		for (size_t w0 = begin; w0 < end; w0 += kDropoutWords) {
+			const size_t count = std::min(kDropoutWords, end - w0);
+			CpuPhilox::generate(seed, step, w0 * 8, count * 8, random);
+			for (size_t w = 0; w < count; ++w) {
+				const uint32_t bits = dropout_bits(random + 32 * w, last);
+				const size_t i0 = (w0 + w) * 32;
+				mask[w0 + w] = bits;
+				dropout_apply(bits, scale, std::min<size_t>(32, n - i0), x + i0, y + i0);
+			}
+		}
+	});
+}
+
+void CpuElementwise::dropout_backward(size_t n, float dropout, const uint32_t *mask, const float *dy, float *dx)
+{
+	const float scale = dropout < 1.0f ? 1.0f / (1.0f - dropout) : 0.0f;
+	elementwise_chunks((n + 31) / 32, kElementwiseGrain / 32, [&](size_t begin, size_t end) {
+		for (size_t w = begin; w < end; ++w)
+			dropout_apply(mask[w], scale, std::min<size_t>(32, n - w * 32), dy + w * 32, dx + w * 32);
+	});
+}
+
+void CpuElementwise::bias_add_forward(int outer, int channels, int inner, const float *x, const float *bias, float *y, int block)
+{
+	if (block == 1) {
+		map_channel(outer, channels, inner, x, nullptr, bias, 0, y, [](auto v, auto, auto s) { return v + s; });
+		return;
+	}
+	const size_t rows = (size_t)outer * (channels / block) * inner;
+	elementwise_chunks(rows, std::max<size_t>(1, kElementwiseGrain / block), [&](size_t begin, size_t end) {
+		for (size_t r = begin; r < end; ++r)
+			span2(0, block, x + r * block, bias + block_row_channel(r, channels, inner, block), y + r * block, [](auto v, auto b) { return v + b; });
+	});
+}
+
+void CpuElementwise::bias_add_backward(int outer, int channels, int inner, const float *dy, float *dbias, int block)
+{
+	if (block == 1) {
+		reduce_channel(outer, channels, inner, dy, dy, 1.0f, dbias, [](auto d, auto) { return d; });
+		return;
+	}
+	// Rows of one channel block are strided across the tensor, each chunk of rows sums into its own
+	// partial and the partials are added in order.
+	const size_t rows = (size_t)outer * (channels / block) * inner;
+	const size_t chunks = std::max<size_t>(1, std::min(kBlockedPartials, rows));
+	std::vector<float> partial(chunks * channels, 0.0f);
+	CpuParallel::for_range(chunks, 1, [&](size_t begin, size_t end) {
+		for (size_t chunk = begin; chunk < end; ++chunk)
+			for (size_t r = chunk * rows / chunks; r < (chunk + 1) * rows / chunks; ++r) {
+				float *acc = &partial[chunk * channels + block_row_channel(r, channels, inner, block)];
+				span2(0, block, acc, dy + r * block, acc, [](auto a, auto d) { return a + d; });
+			}
+	});
+	for (int c = 0; c < channels; ++c) {
+		float sum = 0;
+		for (size_t chunk = 0; chunk < chunks; ++chunk)
+			sum += partial[chunk * channels + c];
+		dbias[c] = sum;
+	}
+}
+
+void CpuElementwise::prelu_forward(int outer, int channels, int inner, const float *x, const float *w, float *y)
+{
+	map_channel(outer, channels, inner, x, nullptr, w, 0, y, [](auto v, auto, auto s) { return vselect(vgt(v, splat<decltype(v)>(0)), v, v * s); });
+}
+
+void CpuElementwise::prelu_backward(int outer, int channels, int inner, const float *x, const float *w, const float *dy, float *dx)
+{
+	map_channel(outer, channels, inner, x, dy, w, 0, dx, [](auto v, auto d, auto s) { return vselect(vgt(v, splat<decltype(v)>(0)), d, d * s); });
+}
+
+void CpuElementwise::prelu_backward_weight(int outer, int channels, int inner, const float *x, const float *dy, float *dw)
+{
+	const float scale = (float)channels / ((float)outer * channels * inner);
+	reduce_channel(outer, channels, inner, x, dy, scale, dw, [](auto v, auto d) { typedef decltype(v) V; return vselect(vlt(v, splat<V>(0)), d * v, splat<V>(0)); });
+}
+
+void CpuElementwise::dprelu_forward(int outer, int channels, int inner, int a_channels, const float *x, const float *a, float *y)
+{
+	map_channel(outer, channels, inner, x, nullptr, a, a_channels, y, [](auto v, auto, auto s) {
+		typedef decltype(v) V;
+		const V zero = splat<V>(0);
+		return vselect(vgt(s, zero), vselect(vgt(v, zero), v, splat<V>(0.2f) * v), zero);
+	});
+}
+
+void CpuElementwise::dprelu_backward(int outer, int channels, int inner, int a_channels, const float *x, const float *a, const float *dy, float *dx)
+{
+	map_channel(outer, channels, inner, x, dy, a, a_channels, dx, [](auto v, auto d, auto s) {
+		typedef decltype(v) V;
+		const V zero = splat<V>(0);
+		return vselect(vgt(s, zero), vselect(vgt(v, zero), d, splat<V>(0.2f) * d), zero);
+	});
+}
+
+// y = op(x) over [begin, end) on the calling thread, x and y may alias.
+template <class Tier>
+static void stage_forward(Tier tier, CpuElementwise::PointwiseOp op, float coef, size_t begin, size_t end, const float *x, float *y)
+{
+	switch (op) {
+	case CpuElementwise::POINTWISE_SIGMOID:
+		span1(begin, end, x, y, [=](auto v) { return vsigmoid(v, tier); });
+		break;
+	case CpuElementwise::POINTWISE_RELU:
+		span1(begin, end, x, y, [](auto v) { return vmax(v, splat<decltype(v)>(0)); });
+		break;
+	case CpuElementwise::POINTWISE_TANH:
+		span1(begin, end, x, y, [=](auto v) { return vtanh(v, tier); });
+		break;
+	case CpuElementwise::POINTWISE_CLIPPED_RELU:
+		span1(begin, end, x, y, [=](auto v) { typedef decltype(v) V; return vmin(vmax(v, splat<V>(0)), splat<V>(coef)); });
+		break;
+	case CpuElementwise::POINTWISE_ELU:
+		span1(begin, end, x, y, [=](auto v) { typedef decltype(v) V; return vselect(vgt(v, splat<V>(0)), v, splat<V>(coef) * (vexp(v, tier) - splat<V>(1))); });
+		break;
+	case CpuElementwise::POINTWISE_LEAKY_RELU:
+		span1(begin, end, x, y, [=](auto v) { typedef decltype(v) V; return vselect(vgt(v, splat<V>(0)), v, v * splat<V>(coef)); });
+		break;
+	case CpuElementwise::POINTWISE_EXP:
+		span1(begin, end, x, y, [=](auto v) { return vexp(v, tier); });
+		break;
+	case CpuElementwise::POINTWISE_LOG:
+		span1(begin, end, x, y, [=](auto v) { return splat<decltype(v)>(coef) * vlog(v, tier); });
+		break;
+	case CpuElementwise::POINTWISE_ABS:
+		span1(begin, end, x, y, [](auto v) { return vabs(v); });
+		break;
+	case CpuElementwise::POINTWISE_SQUARE:
+		span1(begin, end, x, y, [](auto v) { return v * v; });
+		break;
+	default:
+		if (x != y)
+			span1(begin, end, x, y, [](auto v) { return v; });
+	}
+}
+
+// dx = op'(x, y) * dy over [begin, end), where y = op(x). Same arithmetic as the backward of the
+// unfused node, exp reads y in place of recomputing it.
+static void stage_backward(CpuElementwise::PointwiseOp op, float coef, size_t begin, size_t end, const float *x, const float *y, const float *dy, float *dx)
+{
+	switch (op) {
+	case CpuElementwise::POINTWISE_SIGMOID:
+		span2(begin, end, y, dy, dx, [](auto v, auto d) { return d * v * (splat<decltype(v)>(1) - v); });
+		break;
+	case CpuElementwise::POINTWISE_RELU:
+		span2(begin, end, x, dy, dx, [](auto v, auto d) { typedef decltype(v) V; return vselect(vgt(v, splat<V>(0)), d, splat<V>(0)); });
+		break;
+	case CpuElementwise::POINTWISE_TANH:
+		span2(begin, end, y, dy, dx, [](auto v, auto d) { return d * (splat<decltype(v)>(1) - v * v); });
+		break;
+	case CpuElementwise::POINTWISE_CLIPPED_RELU:
+		span2(begin, end, x, dy, dx, [=](auto v, auto d) { typedef decltype(v) V; return vselect(vand(vgt(v, splat<V>(0)), vlt(v, splat<V>(coef))), d, splat<V>(0)); });
+		break;
+	case CpuElementwise::POINTWISE_ELU:
+		span3(begin, end, x, y, dy, dx, [=](auto v, auto u, auto d) { typedef decltype(v) V; return vselect(vgt(v, splat<V>(0)), d, d * (u + splat<V>(coef))); });
+		break;
+	case CpuElementwise::POINTWISE_LEAKY_RELU:
+		span2(begin, end, x, dy, dx, [=](auto v, auto d) { typedef decltype(v) V; return vselect(vgt(v, splat<V>(0)), d, d * splat<V>(coef)); });
+		break;
+	case CpuElementwise::POINTWISE_EXP:
+		span2(begin, end, y, dy, dx, [](auto u, auto d) { return u * d; });
+		break;
+	case CpuElementwise::POINTWISE_LOG:
+		span2(begin, end, x, dy, dx, [=](auto v, auto d) { return splat<decltype(v)>(coef) * d / v; });
+		break;
+	case CpuElementwise::POINTWISE_ABS:
+		span2(begin, end, x, dy, dx, [](auto v, auto d) {
+			typedef decltype(v) V;
+			const V zero = splat<V>(0);
+			return vselect(vgt(v, zero), d, vselect(vlt(v, zero), zero - d, zero));
+		});
+		break;
+	case CpuElementwise::POINTWISE_SQUARE:
+		span2(begin, end, x, dy, dx, [](auto v, auto d) { return splat<decltype(v)>(2) * v * d; });
+		break;
+	default:
+		if (dy != dx)
+			span1(begin, end, dy, dx, [](auto d) { return d; });
+	}
+}
+
+void CpuElementwise::chain_forward(ExecutionContext::MathAccuracy accuracy, int count, const PointwiseStage *stages, size_t n, const float *x, float *y)
+{
+	with_accuracy(accuracy, [&](auto tier) {
+		elementwise_chunks(n, kElementwiseGrain, [&](size_t begin, size_t end) {
+			for (size_t t0 = begin; t0 < end; t0 += kChainTile) {
+				const size_t t1 = std::min(end, t0 + kChainTile);
+				for (int k = 0; k < count; ++k)
+					stage_forward(tier, stages[k].op, stages[k].coef, t0, t1, k == 0 ? x : y, y);
+			}
+		});
+	});
+}
+
+void CpuElementwise::chain_backward(ExecutionContext::MathAccuracy accuracy, int count, const PointwiseStage *stages, size_t n, const float *x, const float *dy, float *dx)
+{
+	with_accuracy(accuracy, [&](auto tier) {
+		elementwise_chunks(n, kElementwiseGrain, [&](size_t begin, size_t end) {
+			// Tile k holds the output of stage k.
+			std::vector<float> buffer((size_t)count * kChainTile);
+			for (size_t t0 = begin; t0 < end; t0 += kChainTile) {
+				const size_t len = std::min(end - t0, kChainTile);
+				auto out = [&](int k) { return buffer.data() + (size_t)k * kChainTile; };
+				for (int k = 0; k < count; ++k)
+					stage_forward(tier, stages[k].op, stages[k].coef, 0, len, k == 0 ? x + t0 : out(k - 1), out(k));
+				for (int k = count - 1; k >= 0; --k)
+					stage_backward(stages[k].op, stages[k].coef, 0, len, k == 0 ? x + t0 : out(k - 1), out(k), k == count - 1 ? dy + t0 : dx + t0, dx + t0);
+			}
+		});
+	});
+}
+
+void CpuElementwise::epilogue_forward(ExecutionContext::MathAccuracy accuracy, PointwiseOp op, float coef, int outer, int channels, int inner, const float *bias, float *y, int block)
+{
+	with_accuracy(accuracy, [&](auto tier) {
+		if (inner == 1 || block != 1) {
+			// Matmul outputs and channel blocked convolutions: rows of the width of a block (of every
+			// channel for matmul), each adding a slice of the bias.
+			const int width = inner == 1 ? channels : block;
+			const size_t rows = (size_t)outer * channels * inner / width;
+			elementwise_chunks(rows, std::max<size_t>(1, kElementwiseGrain / width), [&](size_t begin, size_t end) {
+				for (size_t r = begin; r < end; ++r) {
+					float *yr = y + r * width;
+					if (bias)
+						span2(0, width, yr, bias + (inner == 1 ? 0 : block_row_channel(r, channels, inner, block)), yr, [](auto v, auto b) { return v + b; });
+					stage_forward(tier, op, coef, 0, width, yr, yr);
+				}
+			});
+			return;
+		}
+		const size_t planes = (size_t)outer * channels;
+		elementwise_chunks(planes, std::max<size_t>(1, kElementwiseGrain / inner), [&](size_t begin, size_t end) {
+			for (size_t p = begin; p < end; ++p) {
+				float *yp = y + p * inner;
+				if (bias) {
+					const float s = bias[p % channels];
+					span1(0, inner, yp, yp, [=](auto v) { return v + splat<decltype(v)>(s); });
+				}
+				stage_forward(tier, op, coef, 0, inner, yp, yp);
+			}
+		});
+	});
+}
+
+void CpuElementwise::epilogue_backward(PointwiseOp op, float coef, size_t n, const float *y, float *dy)
+{
+	// Every supported activation keeps the sign of x in y, so the x tests of the unfused backward
+	// read y here.
+	switch (op) {
+	case POINTWISE_SIGMOID:
+		map2(n, y, dy, dy, [](auto v, auto d) { return d * v * (splat<decltype(v)>(1) - v); });
+		break;
+	case POINTWISE_RELU:
+		map2(n, y, dy, dy, [](auto v, auto d) { typedef decltype(v) V; return vselect(vgt(v, splat<V>(0)), d, splat<V>(0)); });
+		break;
+	case POINTWISE_TANH:
+		map2(n, y, dy, dy, [](auto v, auto d) { return d * (splat<decltype(v)>(1) - v * v); });
+		break;
+	case POINTWISE_CLIPPED_RELU:
+		map2(n, y, dy, dy, [=](auto v, auto d) { typedef decltype(v) V; return vselect(vand(vgt(v, splat<V>(0)), vlt(v, splat<V>(coef))), d, splat<V>(0)); });
+		break;
+	case POINTWISE_ELU:
+		map2(n, y, dy, dy, [=](auto v, auto d) { typedef decltype(v) V; return vselect(vgt(v, splat<V>(0)), d, d * (v + splat<V>(coef))); });
+		break;
+	case POINTWISE_LEAKY_RELU:
+		map2(n, y, dy, dy, [=](auto v, auto d) { typedef decltype(v) V; return vselect(vgt(v, splat<V>(0)), d, d * splat<V>(coef)); });
+		break;
+	default:
+		break;
+	}
+}
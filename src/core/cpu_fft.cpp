@@ -0,0 +1,112 @@
+#include "core/cpu_fft.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+#include <glog/logging.h>
+
+// Working set of one strip of a column pass.
+static const size_t kFftStripBytes = 128 << 10;
+
+// twiddle[j] = exp(-2 pi i j / n) for j < n / 2, conjugated for the inverse.
+static void fft_twiddles(int n, bool inverse, std::vector<float> &re, std::vector<float> &im)
+{
+	re.resize(n / 2);
+	im.resize(n / 2);
+	for (int j = 0; j < n / 2; ++j) {
+		const double angle = -2.0 * 3.14159265358979323846 * j / n;
+		re[j] = (float)cos(angle);
+		im[j] = (float)(inverse ? -sin(angle) : sin(angle));
+	}
+}
+
+static int fft_bit_reverse(int i, int bits)
+{
+	int r = 0;
+	for (int b = 0; b < bits; ++b, i >>= 1)
+		r = (r << 1) | (i & 1);
+	return r;
+}
+
+// Radix-2 decimation in time over n operands of width elements each: operand i lives at offset
+// i * stride, its elements are contiguous. width is 1 for a row transform, the row length for columns.
+static void fft_pass(int n, int stride, int width, float *re, float *im, const std::vector<float> &wr, const std::vector<float> &wi)
+{
+	int bits = 0;
+	while ((1 << bits) < n)
+		++bits;
+	for (int i = 0; i < n; ++i) {
+		const int j = fft_bit_reverse(i, bits);
+		if (j > i) {
+			std::swap_ranges(re + (size_t)i * stride, re + (size_t)i * stride + width, re + (size_t)j * stride);
+			std::swap_ranges(im + (size_t)i * stride, im + (size_t)i * stride + width, im + (size_t)j * stride);
+		}
+	}
+	// All stages on one strip of the operands at a time, so the strip stays in cache.
+	const int strip = std::max(8, std::min(width, (int)(kFftStripBytes / (2 * sizeof(float) * n))));
+	for (int e0 = 0; e0 < width; e0 += strip) {
+		const int e1 = std::min(width, e0 + strip);
+		for (int len = 2; len <= n; len <<= 1) {
+			const int half = len / 2, step = n / len;
+			for (int block = 0; block < n; block += len) {
+				for (int j = 0; j < half; ++j) {
+					const float tr = wr[j * step], ti = wi[j * step];
+					float * __restrict ar = re + (size_t)(block + j) * stride;
+					float * __restrict ai = im + (size_t)(block + j) * stride;
+					float * __restrict br = re + (size_t)(block + j + half) * stride;
+					float * __restrict bi = im + (size_t)(block + j + half) * stride;
+					for (int e = e0; e < e1; ++e) {
+						const float xr = br[e] * tr - bi[e] * ti;
+						const float xi = br[e] * ti + bi[e] * tr;
+						br[e] = ar[e] - xr;
+						bi[e] = ai[e] - xi;
+						ar[e] += xr;
+						ai[e] += xi;
+					}
+				}
+			}
+		}
+	}
+}
+
+// dst[j][i] = src[i][j] over [rows, columns], in cache blocks.
+static void fft_transpose(int rows, int columns, const float *src, float *dst)
+{
+	const int block = 32;
+	for (int i0 = 0; i0 < rows; i0 += block)
+		for (int j0 = 0; j0 < columns; j0 += block)
+			for (int i = i0; i < std::min(rows, i0 + block); ++i)
+				for (int j = j0; j < std::min(columns, j0 + block); ++j)
+					dst[(size_t)j * rows + i] = src[(size_t)i * columns + j];
+}
+
+bool CpuFft::is_power_of_two(int n)
+{
+	return n > 0 && (n & (n - 1)) == 0;
+}
+
+int CpuFft::next_power_of_two(int n)
+{
+	int p = 1;
+	while (p < n)
+		p <<= 1;
+	return p;
+}
+
+void CpuFft::transform_2d(int rows, int columns, float *re, float *im, bool inverse)
+{
+	LOG_IF(FATAL, !is_power_of_two(rows) || !is_power_of_two(columns)) << "CpuFft - sizes must be powers of two but got " << rows << "x" << columns;
+	std::vector<float> wr, wi;
+	fft_twiddles(rows, inverse, wr, wi);
+	fft_pass(rows, columns, columns, re, im, wr, wi);
+	// The row transforms as a column pass over the transpose, so they vectorize too.
+	std::vector<float> tr((size_t)rows * columns), ti((size_t)rows * columns);
+	fft_transpose(rows, columns, re, tr.data());
+	fft_transpose(rows, columns, im, ti.data());
+	fft_twiddles(columns, inverse, wr, wi);
+	fft_pass(columns, rows, rows, tr.data(), ti.data(), wr, wi);
+	fft_transpose(columns, rows, tr.data(), re);
+	fft_transpose(columns, rows, ti.data(), im);
+}
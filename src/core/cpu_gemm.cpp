@@ -0,0 +1,132 @@
+#include "core/cpu_gemm.h"
+#include "core/cpu_parallel.h"
+#include "core/cpu_vec.h"
+
+#include <algorithm>
+#include <vector>
+
+// Micro tile of C held in registers: kGemmMR rows by two vectors.
+static const int kGemmMR = 6;
+static const int kGemmNR = 2 * (int)kVecWidth;
+// Cache blocks: a KC x NC panel of B and an MC x KC panel of A are packed per task.
+static const int kGemmMC = 72;
+static const int kGemmNC = 256;
+static const int kGemmKC = 256;
+
+// Rows [i0, i0 + mc) and depths [k0, k0 + kc) of op(A), as kGemmMR-row slivers stored depth-major,
+// zero-padded to whole slivers.
+static void gemm_pack_a(bool trans, const float *A, int lda, int i0, int mc, int k0, int kc, float *packed)
+{
+	for (int i = 0; i < mc; i += kGemmMR) {
+		const int rows = std::min(kGemmMR, mc - i);
+		for (int k = 0; k < kc; ++k) {
+			for (int r = 0; r < rows; ++r)
+				packed[r] = trans ? A[(size_t)(k0 + k) * lda + i0 + i + r] : A[(size_t)(i0 + i + r) * lda + k0 + k];
+			for (int r = rows; r < kGemmMR; ++r)
+				packed[r] = 0;
+			packed += kGemmMR;
+		}
+	}
+}
+
+// Depths [k0, k0 + kc) and columns [j0, j0 + nc) of op(B), as kGemmNR-column slivers stored depth-major.
+static void gemm_pack_b(bool trans, const float *B, int ldb, int k0, int kc, int j0, int nc, float *packed)
+{
+	for (int j = 0; j < nc; j += kGemmNR) {
+		const int columns = std::min(kGemmNR, nc - j);
+		for (int k = 0; k < kc; ++k) {
+			if (!trans && columns == kGemmNR)
+				std::copy(B + (size_t)(k0 + k) * ldb + j0 + j, B + (size_t)(k0 + k) * ldb + j0 + j + kGemmNR, packed);
+			else {
+				for (int c = 0; c < columns; ++c)
+					packed[c] = trans ? B[(size_t)(j0 + j + c) * ldb + k0 + k] : B[(size_t)(k0 + k) * ldb + j0 + j + c];
+				for (int c = columns; c < kGemmNR; ++c)
+					packed[c] = 0;
+			}
+			packed += kGemmNR;
+		}
+	}
+}
+
+// tile = a * b over kc depths, both operands packed. The accumulators are spelled out so they stay
+// in registers whatever the compiler's unrolling heuristics.
+static void gemm_micro_kernel(int kc, const float *a, const float *b, float *tile)
+{
+	Vec c00 = splat<Vec>(0), c01 = c00, c10 = c00, c11 = c00, c20 = c00, c21 = c00;
+	Vec c30 = c00, c31 = c00, c40 = c00, c41 = c00, c50 = c00, c51 = c00;
+	for (int k = 0; k < kc; ++k, a += kGemmMR, b += kGemmNR) {
+		const Vec b0 = load(b), b1 = load(b + kVecWidth);
+		Vec av = splat<Vec>(a[0]);
+		c00 = vfma(av, b0, c00);
+		c01 = vfma(av, b1, c01);
+		av = splat<Vec>(a[1]);
+		c10 = vfma(av, b0, c10);
+		c11 = vfma(av, b1, c11);
+		av = splat<Vec>(a[2]);
+		c20 = vfma(av, b0, c20);
+		c21 = vfma(av, b1, c21);
+		av = splat<Vec>(a[3]);
+		c30 = vfma(av, b0, c30);
+		c31 = vfma(av, b1, c31);
+		av = splat<Vec>(a[4]);
+		c40 = vfma(av, b0, c40);
+		c41 = vfma(av, b1, c41);
+		av = splat<Vec>(a[5]);
+		c50 = vfma(av, b0, c50);
+		c51 = vfma(av, b1, c51);
+	}
+	const Vec rows[kGemmMR][2] = { { c00, c01 }, { c10, c11 }, { c20, c21 }, { c30, c31 }, { c40, c41 }, { c50, c51 } };
+	for (int r = 0; r < kGemmMR; ++r) {
+		store(tile + r * kGemmNR, rows[r][0]);
+		store(tile + r * kGemmNR + kVecWidth, rows[r][1]);
+	}
+}
+
+void CpuGemm::sgemm(bool trans_a, bool trans_b, int M, int N, int K, float alpha, const float *A, int lda, const float *B, int ldb, float beta, float *C, int ldc)
+{
+	if (M <= 0 || N <= 0)
+		return;
+	if (K <= 0 || alpha == 0) {
+		for (int i = 0; i < M; ++i)
+			for (int j = 0; j < N; ++j)
+				C[(size_t)i * ldc + j] = beta == 0 ? 0 : beta * C[(size_t)i * ldc + j];
+		return;
+	}
+	const int row_blocks = (M + kGemmMC - 1) / kGemmMC;
+	const int column_blocks = (N + kGemmNC - 1) / kGemmNC;
+	// Small products stay on the calling thread.
+	const size_t flops = (size_t)M * N * K;
+	const size_t grain = flops < (1 << 18) ? (size_t)row_blocks * column_blocks : 1;
+	CpuParallel::for_range((size_t)row_blocks * column_blocks, grain, [&](size_t begin, size_t end) {
+		std::vector<float> packed_a((size_t)kGemmMC * kGemmKC + kGemmMR * kGemmKC);
+		std::vector<float> packed_b((size_t)kGemmKC * kGemmNC + kGemmNR * kGemmKC);
+		alignas(64) float tile[kGemmMR * kGemmNR];
+		for (size_t task = begin; task < end; ++task) {
+			const int i0 = (int)(task / column_blocks) * kGemmMC, j0 = (int)(task % column_blocks) * kGemmNC;
+			const int mc = std::min(kGemmMC, M - i0), nc = std::min(kGemmNC, N - j0);
+			for (int k0 = 0; k0 < K; k0 += kGemmKC) {
+				const int kc = std::min(kGemmKC, K - k0);
+				const float b_scale = k0 == 0 ? beta : 1.0f;
+				gemm_pack_a(trans_a, A, lda, i0, mc, k0, kc, packed_a.data());
+				gemm_pack_b(trans_b, B, ldb, k0, kc, j0, nc, packed_b.data());
+				for (int j = 0; j < nc; j += kGemmNR) {
+					const int columns = std::min(kGemmNR, nc - j);
+					for (int i = 0; i < mc; i += kGemmMR) {
+						const int rows = std::min(kGemmMR, mc - i);
+						gemm_micro_kernel(kc, packed_a.data() + (size_t)i * kc, packed_b.data() + (size_t)j * kc, tile);
+						for (int r = 0; r < rows; ++r) {
+							float *c = C + (size_t)(i0 + i + r) * ldc + j0 + j;
+							const float *t = tile + r * kGemmNR;
+							if (b_scale == 0)
+								for (int x = 0; x < columns; ++x)
+									c[x] = alpha * t[x];
+							else
+								for (int x = 0; x < columns; ++x)
+									c[x] = alpha * t[x] + b_scale * c[x];
+						}
+					}
+				}
+			}
+		}
+	});
+}
@@ -0,0 +1,33 @@
+#include "core/cpu_layout.h"
+#include "core/cpu_transpose.h"
+
+#include <glog/logging.h>
+
+std::array<ptrdiff_t, 5> CpuLayout::strides(std::array<int, 4> dims, int block, int split)
+{
+	const ptrdiff_t c = dims[1], hw = (ptrdiff_t)dims[2] * dims[3], w = dims[3];
+	if (block == 1)
+		return { c * hw, split * hw, w, 1, hw };
+	if (block == c)
+		return { c * hw, split, w * c, c, 1 };
+	LOG_IF(FATAL, block != split || c % block != 0) << "CpuLayout - channel block " << block << " of " << c << " channels cannot be viewed in blocks of " << split;
+	return { c * hw, hw * block, w * block, block, 1 };
+}
+
+int CpuLayout::split(int channels, int block_a, int block_b)
+{
+	if (block_a != 1 && block_a != channels)
+		return block_a;
+	if (block_b != 1 && block_b != channels)
+		return block_b;
+	return 1;
+}
+
+void CpuLayout::reorder(std::array<int, 4> dims, int src_block, const float *src, int dst_block, float *dst, float beta)
+{
+	const int s = split(dims[1], src_block, dst_block);
+	const int sizes[5] = { dims[0], dims[1] / s, dims[2], dims[3], s };
+	auto src_strides = strides(dims, src_block, s);
+	auto dst_strides = strides(dims, dst_block, s);
+	CpuTranspose::copy(5, sizes, src, src_strides.data(), dst, dst_strides.data(), beta);
+}
@@ -0,0 +1,40 @@
+#include "core/cpu_math.h"
+#include "core/cpu_vec.h"
+
+template <class Op>
+static void math_map(ExecutionContext::MathAccuracy accuracy, size_t n, const float *x, float *y, const Op &op)
+{
+	size_t i = 0;
+	if (accuracy == ExecutionContext::MATH_FAST) {
+		for (; i + kVecWidth <= n; i += kVecWidth)
+			store(y + i, op(load(x + i), FastMath()));
+		for (; i < n; ++i)
+			y[i] = op(x[i], FastMath());
+	}
+	else {
+		for (; i + kVecWidth <= n; i += kVecWidth)
+			store(y + i, op(load(x + i), AccurateMath()));
+		for (; i < n; ++i)
+			y[i] = op(x[i], AccurateMath());
+	}
+}
+
+void CpuMath::exp(ExecutionContext::MathAccuracy accuracy, size_t n, const float *x, float *y)
+{
+	math_map(accuracy, n, x, y, [](auto v, auto tier) { return vexp(v, tier); });
+}
+
+void CpuMath::log(ExecutionContext::MathAccuracy accuracy, size_t n, const float *x, float *y)
+{
+	math_map(accuracy, n, x, y, [](auto v, auto tier) { return vlog(v, tier); });
+}
+
+void CpuMath::tanh(ExecutionContext::MathAccuracy accuracy, size_t n, const float *x, float *y)
+{
+	math_map(accuracy, n, x, y, [](auto v, auto tier) { return vtanh(v, tier); });
+}
+
+void CpuMath::sigmoid(ExecutionContext::MathAccuracy accuracy, size_t n, const float *x, float *y)
+{
+	math_map(accuracy, n, x, y, [](auto v, auto tier) { return vsigmoid(v, tier); });
+}
@@ -0,0 +1,126 @@
+#include "core/cpu_parallel.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+	thread_local bool inside_parallel_range = false;
+
+	class ThreadPool {
+	public:
+		ThreadPool() {
+			int num_workers = std::max(1, (int) std::thread::hardware_concurrency()) - 1;
+			for (int i = 0; i < num_workers; ++i)
+				_workers.push_back(std::thread(&ThreadPool::_work, this));
+		}
+		~ThreadPool() {
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+				_quit = true;
+			}
+			_wake.notify_all();
+			for (auto &worker : _workers)
+				worker.join();
+		}
+		int size() const {
+			return _workers.size() + 1;
+		}
+		void run(size_t num_chunks, const std::function<void(size_t)> &chunk) {
+			// One range at a time, the caller takes part in the work.
+			std::lock_guard<std::mutex> range_lock(_range_mutex);
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+				_chunk = &chunk;
+				_num_chunks = num_chunks;
+				_done_chunks = 0;
+				_next_chunk = 0;
+				++_generation;
+			}
+			_wake.notify_all();
+			_process();
+			std::unique_lock<std::mutex> lock(_mutex);
+			_finished.wait(lock, [this]() { return _done_chunks == _num_chunks; });
+			// Workers that wake up late must not find any chunk left.
+			_next_chunk = idle;
+		}
+	private:
+		void _work() {
+			size_t generation = 0;
+			while (true) {
+				{
+					std::unique_lock<std::mutex> lock(_mutex);
+					_wake.wait(lock, [&]() { return _quit || _generation != generation; });
+					if (_quit)
+						return;
+					generation = _generation;
+				}
+				_process();
+			}
+		}
+		void _process() {
+			inside_parallel_range = true;
+			size_t processed = 0;
+			while (true) {
+				size_t index = _next_chunk++;
+				if (index >= _num_chunks)
+					break;
+				(*_chunk)(index);
+				++processed;
+			}
+			inside_parallel_range = false;
+			if (processed > 0) {
+				std::lock_guard<std::mutex> lock(_mutex);
+				_done_chunks += processed;
+				if (_done_chunks == _num_chunks)
+					_finished.notify_all();
+			}
+		}
+	private:
+		std::vector<std::thread> _workers;
+		std::mutex _range_mutex;
+		std::mutex _mutex;
+		std::condition_variable _wake;
+		std::condition_variable _finished;
+		const std::function<void(size_t)> *_chunk = nullptr;
+		size_t _num_chunks = 0;
+		static const size_t idle = ~(size_t) 0 >> 1;
+		std::atomic<size_t> _next_chunk { idle };
+		size_t _done_chunks = 0;
+		size_t _generation = 0;
+		bool _quit = false;
+	};
+
+	ThreadPool &pool() {
+		static ThreadPool instance;
+		return instance;
+	}
+
+}
+
+int CpuParallel::num_threads()
+{
+	return pool().size();
+}
+
+void CpuParallel::for_range(size_t n, size_t grain, const std::function<void(size_t, size_t)>& fn)
+{
+	if (n == 0)
+		return;
+	grain = std::max<size_t>(grain, 1);
+	size_t num_chunks = std::min<size_t>((n + grain - 1) / grain, 4 * num_threads());
+	if (num_chunks <= 1 || inside_parallel_range) {
+		fn(0, n);
+		return;
+	}
+	size_t chunk_size = (n + num_chunks - 1) / num_chunks;
+	num_chunks = (n + chunk_size - 1) / chunk_size;
+	pool().run(num_chunks, [&](size_t chunk) {
+		size_t begin = chunk * chunk_size;
+		fn(begin, std::min(n, begin + chunk_size));
+	});
+}
@@ -0,0 +1,101 @@
+#include "core/cpu_philox.h"
+
+#include <algorithm>
+
+#if defined(__AVX512F__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+static const uint32_t kPhiloxM0 = 0xD2511F53;
+static const uint32_t kPhiloxM1 = 0xCD9E8D57;
+static const uint32_t kPhiloxW0 = 0x9E3779B9;
+static const uint32_t kPhiloxW1 = 0xBB67AE85;
+static const int kPhiloxLanes = 32;
+
+// Lanes of 32-bit words and the Philox multiply: hi and lo halves of the 64-bit products a * m.
+// The vector multiply only covers even lanes, the odd ones go through a 64-bit shift.
+#if defined(__AVX512F__)
+typedef __m512i PhiloxVec;
+static const int kPhiloxWidth = 16;
+static inline PhiloxVec philox_load(const uint32_t *p) { return _mm512_loadu_si512(p); }
+static inline void philox_store(uint32_t *p, PhiloxVec v) { _mm512_storeu_si512(p, v); }
+static inline PhiloxVec philox_splat(uint32_t v) { return _mm512_set1_epi32((int)v); }
+static inline PhiloxVec philox_xor(PhiloxVec a, PhiloxVec b) { return _mm512_xor_si512(a, b); }
+static inline void philox_mulhilo(PhiloxVec a, PhiloxVec m, PhiloxVec &hi, PhiloxVec &lo)
+{
+	const __m512i even = _mm512_mul_epu32(a, m), odd = _mm512_mul_epu32(_mm512_srli_epi64(a, 32), m);
+	lo = _mm512_mask_blend_epi32(0xAAAA, even, _mm512_slli_epi64(odd, 32));
+	hi = _mm512_mask_blend_epi32(0xAAAA, _mm512_srli_epi64(even, 32), odd);
+}
+#elif defined(__AVX2__)
+typedef __m256i PhiloxVec;
+static const int kPhiloxWidth = 8;
+static inline PhiloxVec philox_load(const uint32_t *p) { return _mm256_loadu_si256((const __m256i *)p); }
+static inline void philox_store(uint32_t *p, PhiloxVec v) { _mm256_storeu_si256((__m256i *)p, v); }
+static inline PhiloxVec philox_splat(uint32_t v) { return _mm256_set1_epi32((int)v); }
+static inline PhiloxVec philox_xor(PhiloxVec a, PhiloxVec b) { return _mm256_xor_si256(a, b); }
+static inline void philox_mulhilo(PhiloxVec a, PhiloxVec m, PhiloxVec &hi, PhiloxVec &lo)
+{
+	const __m256i even = _mm256_mul_epu32(a, m), odd = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), m);
+	lo = _mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32), 0xAA);
+	hi = _mm256_blend_epi32(_mm256_srli_epi64(even, 32), odd, 0xAA);
+}
+#else
+typedef uint32_t PhiloxVec;
+static const int kPhiloxWidth = 1;
+static inline PhiloxVec philox_load(const uint32_t *p) { return *p; }
+static inline void philox_store(uint32_t *p, PhiloxVec v) { *p = v; }
+static inline PhiloxVec philox_splat(uint32_t v) { return v; }
+static inline PhiloxVec philox_xor(PhiloxVec a, PhiloxVec b) { return a ^ b; }
+static inline void philox_mulhilo(PhiloxVec a, PhiloxVec m, PhiloxVec &hi, PhiloxVec &lo)
+{
+	const uint64_t product = (uint64_t)a * m;
+	hi = (uint32_t)(product >> 32);
+	lo = (uint32_t)product;
+}
+#endif
+
+void CpuPhilox::generate(uint64_t seed, uint64_t stream, uint64_t first_block, size_t blocks, uint32_t *out)
+{
+	const PhiloxVec m0 = philox_splat(kPhiloxM0), m1 = philox_splat(kPhiloxM1);
+	for (size_t done = 0; done < blocks; done += kPhiloxLanes) {
+		// Counter (block low, block high, stream low, stream high), one block per lane.
+		uint32_t words[4][kPhiloxLanes];
+		for (int l = 0; l < kPhiloxLanes; ++l) {
+			const uint64_t block = first_block + done + l;
+			words[0][l] = (uint32_t)block;
+			words[1][l] = (uint32_t)(block >> 32);
+			words[2][l] = (uint32_t)stream;
+			words[3][l] = (uint32_t)(stream >> 32);
+		}
+		// The vectors of a batch are independent, interleaving them hides the multiply latency.
+		const int vectors = kPhiloxLanes / kPhiloxWidth;
+		PhiloxVec c[4][vectors];
+		for (int j = 0; j < 4; ++j)
+			for (int v = 0; v < vectors; ++v)
+				c[j][v] = philox_load(&words[j][v * kPhiloxWidth]);
+		uint32_t k0 = (uint32_t)seed, k1 = (uint32_t)(seed >> 32);
+		for (int round = 0; round < 10; ++round) {
+			const PhiloxVec key0 = philox_splat(k0), key1 = philox_splat(k1);
+			for (int v = 0; v < vectors; ++v) {
+				PhiloxVec hi0, lo0, hi1, lo1;
+				philox_mulhilo(c[0][v], m0, hi0, lo0);
+				philox_mulhilo(c[2][v], m1, hi1, lo1);
+				c[0][v] = philox_xor(philox_xor(hi1, c[1][v]), key0);
+				c[2][v] = philox_xor(philox_xor(hi0, c[3][v]), key1);
+				c[1][v] = lo1;
+				c[3][v] = lo0;
+			}
+			k0 += kPhiloxW0;
+			k1 += kPhiloxW1;
+		}
+		for (int j = 0; j < 4; ++j)
+			for (int v = 0; v < vectors; ++v)
+				philox_store(&words[j][v * kPhiloxWidth], c[j][v]);
+		const int lanes = (int)std::min<size_t>(kPhiloxLanes, blocks - done);
+		uint32_t *dst = out + 4 * done;
+		for (int l = 0; l < lanes; ++l)
+			for (int j = 0; j < 4; ++j)
+				dst[4 * l + j] = words[j][l];
+	}
+}
@@ -0,0 +1,306 @@
+#include "core/cpu_reduction.h"
+#include "core/cpu_parallel.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include <glog/logging.h>
+
+struct ReductionSegment {
+	size_t size;
+	size_t stride;
+	bool reduced;
+};
+
+struct ReductionState {
+	float value;
+	float compensation;
+	unsigned int index;
+};
+
+static const size_t kReductionBlock = 256;
+static const size_t kReductionLanes = 256;
+
+template <int OP>
+static inline bool reduction_is_sum()
+{
+	return OP == deepflow::ReduceParam_ReduceOp_ADD || OP == deepflow::ReduceParam_ReduceOp_AVG || OP == deepflow::ReduceParam_ReduceOp_NORM1 || OP == deepflow::ReduceParam_ReduceOp_NORM2;
+}
+
+template <int OP>
+static inline float reduction_transform(float v)
+{
+	if (OP == deepflow::ReduceParam_ReduceOp_NORM1 || OP == deepflow::ReduceParam_ReduceOp_AMAX)
+		return fabsf(v);
+	if (OP == deepflow::ReduceParam_ReduceOp_NORM2)
+		return v * v;
+	return v;
+}
+
+// Strict comparison, so ties keep the first element like cuDNN.
+template <int OP>
+static inline bool reduction_better(float a, float b)
+{
+	return OP == deepflow::ReduceParam_ReduceOp_MIN ? a < b : a > b;
+}
+
+template <int OP>
+static inline float reduction_identity()
+{
+	if (OP == deepflow::ReduceParam_ReduceOp_MUL)
+		return 1.0f;
+	if (OP == deepflow::ReduceParam_ReduceOp_MIN)
+		return std::numeric_limits<float>::infinity();
+	if (OP == deepflow::ReduceParam_ReduceOp_MAX)
+		return -std::numeric_limits<float>::infinity();
+	return 0.0f;
+}
+
+template <int OP>
+static inline float reduction_result(float value, size_t count)
+{
+	if (OP == deepflow::ReduceParam_ReduceOp_AVG)
+		return value / count;
+	if (OP == deepflow::ReduceParam_ReduceOp_NORM2)
+		return sqrtf(value);
+	return value;
+}
+
+static inline void kahan_add(float &sum, float &compensation, float v)
+{
+	const float y = v - compensation;
+	const float t = sum + y;
+	compensation = (t - sum) - y;
+	sum = t;
+}
+
+template <int OP>
+static inline void reduction_merge(ReductionState &a, const ReductionState &b)
+{
+	if (reduction_is_sum<OP>()) {
+		kahan_add(a.value, a.compensation, b.value);
+		kahan_add(a.value, a.compensation, -b.compensation);
+	}
+	else if (OP == deepflow::ReduceParam_ReduceOp_MUL)
+		a.value *= b.value;
+	else if (reduction_better<OP>(b.value, a.value)) {
+		a.value = b.value;
+		a.index = b.index;
+	}
+}
+
+// Folds a contiguous run of n elements whose first one sits at position of the reduced region.
+// Sums and products use eight independent lanes per block so the loop vectorizes.
+template <int OP>
+static void reduce_run(const float *x, size_t n, size_t position, ReductionState &s)
+{
+	if (reduction_is_sum<OP>() || OP == deepflow::ReduceParam_ReduceOp_MUL) {
+		const bool sum = reduction_is_sum<OP>();
+		for (size_t b = 0; b < n; b += kReductionBlock) {
+			const size_t e = std::min(n, b + kReductionBlock);
+			const float identity = sum ? 0.0f : 1.0f;
+			float lanes[8] = { identity, identity, identity, identity, identity, identity, identity, identity };
+			size_t i = b;
+			for (; i + 8 <= e; i += 8)
+				for (int l = 0; l < 8; ++l)
+					lanes[l] = sum ? lanes[l] + reduction_transform<OP>(x[i + l]) : lanes[l] * x[i + l];
+			float partial;
+			if (sum) {
+				partial = ((lanes[0] + lanes[1]) + (lanes[2] + lanes[3])) + ((lanes[4] + lanes[5]) + (lanes[6] + lanes[7]));
+				for (; i < e; ++i)
+					partial += reduction_transform<OP>(x[i]);
+				kahan_add(s.value, s.compensation, partial);
+			}
+			else {
+				partial = ((lanes[0] * lanes[1]) * (lanes[2] * lanes[3])) * ((lanes[4] * lanes[5]) * (lanes[6] * lanes[7]));
+				for (; i < e; ++i)
+					partial *= x[i];
+				s.value *= partial;
+			}
+		}
+	}
+	else {
+		for (size_t i = 0; i < n; ++i) {
+			const float v = reduction_transform<OP>(x[i]);
+			if (reduction_better<OP>(v, s.value)) {
+				s.value = v;
+				s.index = (unsigned int)(position + i);
+			}
+		}
+	}
+}
+
+// Folds one row of n neighbouring outputs, all at the same position of their reduced regions.
+template <int OP>
+static void reduce_lanes(const float *x, size_t n, unsigned int position, float *value, float *compensation, unsigned int *index)
+{
+	if (reduction_is_sum<OP>()) {
+		for (size_t j = 0; j < n; ++j) {
+			const float y = reduction_transform<OP>(x[j]) - compensation[j];
+			const float t = value[j] + y;
+			compensation[j] = (t - value[j]) - y;
+			value[j] = t;
+		}
+	}
+	else if (OP == deepflow::ReduceParam_ReduceOp_MUL) {
+		for (size_t j = 0; j < n; ++j)
+			value[j] *= x[j];
+	}
+	else {
+		for (size_t j = 0; j < n; ++j) {
+			const float v = reduction_transform<OP>(x[j]);
+			if (reduction_better<OP>(v, value[j])) {
+				value[j] = v;
+				index[j] = position;
+			}
+		}
+	}
+}
+
+// Input offset of the index-th element of the (row major) product of segments.
+static size_t reduction_offset(size_t index, const std::vector<ReductionSegment> &segments)
+{
+	size_t offset = 0;
+	for (int i = (int)segments.size() - 1; i >= 0; --i) {
+		offset += (index % segments[i].size) * segments[i].stride;
+		index /= segments[i].size;
+	}
+	return offset;
+}
+
+template <int OP>
+static void reduce_cpu(const float *x, std::array<int, 4> dims, int axes, float *y, float alpha, float beta, unsigned int *indices)
+{
+	std::vector<ReductionSegment> segments;
+	size_t stride = 1;
+	for (int d = 3; d >= 0; --d) {
+		const size_t size = dims[d];
+		const bool reduced = (axes >> d) & 1;
+		if (size == 1)
+			continue;
+		if (!segments.empty() && segments.back().reduced == reduced)
+			segments.back().size *= size;
+		else
+			segments.push_back({ size, stride, reduced });
+		stride *= size;
+	}
+	if (segments.empty())
+		segments.push_back({ 1, 1, false });
+	std::reverse(segments.begin(), segments.end());
+
+	std::vector<ReductionSegment> kept, reduced;
+	size_t num_outputs = 1, count = 1;
+	for (auto &segment : segments) {
+		if (segment.reduced) {
+			reduced.push_back(segment);
+			count *= segment.size;
+		}
+		else {
+			kept.push_back(segment);
+			num_outputs *= segment.size;
+		}
+	}
+
+	const ReductionState identity = { reduction_identity<OP>(), 0.0f, 0 };
+	auto store = [&](size_t o, float value, unsigned int index) {
+		const float result = alpha * reduction_result<OP>(value, count);
+		y[o] = beta == 0 ? result : result + beta * y[o];
+		if (indices)
+			indices[o] = index;
+	};
+
+	if (segments.back().reduced) {
+		const size_t run = reduced.back().size;
+		reduced.pop_back();
+		const size_t runs = count / run;
+		if (num_outputs == 1) {
+			// Full reduction of one contiguous run, split across the pool and merged in order.
+			const size_t parts = std::max<size_t>(1, std::min<size_t>(CpuParallel::num_threads(), run / 16384));
+			std::vector<ReductionState> partials(parts, identity);
+			CpuParallel::for_range(parts, 1, [&](size_t begin, size_t end) {
+				for (size_t p = begin; p < end; ++p) {
+					const size_t first = run * p / parts, last = run * (p + 1) / parts;
+					reduce_run<OP>(x + first, last - first, first, partials[p]);
+				}
+			});
+			for (size_t p = 1; p < parts; ++p)
+				reduction_merge<OP>(partials[0], partials[p]);
+			store(0, partials[0].value, partials[0].index);
+			return;
+		}
+		const size_t grain = std::max<size_t>(1, 32768 / count);
+		CpuParallel::for_range(num_outputs, grain, [&](size_t begin, size_t end) {
+			for (size_t o = begin; o < end; ++o) {
+				const float *base = x + reduction_offset(o, kept);
+				ReductionState s = identity;
+				for (size_t r = 0; r < runs; ++r)
+					reduce_run<OP>(base + reduction_offset(r, reduced), run, r * run, s);
+				store(o, s.value, s.index);
+			}
+		});
+	}
+	else {
+		const size_t lanes = kept.back().size;
+		kept.pop_back();
+		const size_t chunks = (lanes + kReductionLanes - 1) / kReductionLanes;
+		const size_t tasks = num_outputs / lanes * chunks;
+		CpuParallel::for_range(tasks, 1, [&](size_t begin, size_t end) {
+			float value[kReductionLanes], compensation[kReductionLanes];
+			unsigned int index[kReductionLanes];
+			for (size_t t = begin; t < end; ++t) {
+				const size_t outer = t / chunks, first = (t % chunks) * kReductionLanes;
+				const size_t n = std::min(kReductionLanes, lanes - first);
+				const float *base = x + reduction_offset(outer, kept) + first;
+				std::fill_n(value, n, identity.value);
+				std::fill_n(compensation, n, 0.0f);
+				std::fill_n(index, n, 0u);
+				for (size_t r = 0; r < count; ++r)
+					reduce_lanes<OP>(base + (reduced.empty() ? 0 : reduction_offset(r, reduced)), n, (unsigned int)r, value, compensation, index);
+				for (size_t j = 0; j < n; ++j)
+					store(outer * lanes + first + j, value[j], index[j]);
+			}
+		});
+	}
+}
+
+std::array<int, 4> CpuReduction::output_dims(std::array<int, 4> dims, int axes)
+{
+	for (int d = 0; d < 4; ++d)
+		if ((axes >> d) & 1)
+			dims[d] = 1;
+	return dims;
+}
+
+void CpuReduction::reduce(deepflow::ReduceParam_ReduceOp op, const float *x, std::array<int, 4> dims, int axes, float *y, float alpha, float beta, unsigned int *indices)
+{
+	switch (op) {
+	case deepflow::ReduceParam_ReduceOp_ADD:
+		reduce_cpu<deepflow::ReduceParam_ReduceOp_ADD>(x, dims, axes, y, alpha, beta, indices);
+		break;
+	case deepflow::ReduceParam_ReduceOp_MUL:
+		reduce_cpu<deepflow::ReduceParam_ReduceOp_MUL>(x, dims, axes, y, alpha, beta, indices);
+		break;
+	case deepflow::ReduceParam_ReduceOp_MIN:
+		reduce_cpu<deepflow::ReduceParam_ReduceOp_MIN>(x, dims, axes, y, alpha, beta, indices);
+		break;
+	case deepflow::ReduceParam_ReduceOp_MAX:
+		reduce_cpu<deepflow::ReduceParam_ReduceOp_MAX>(x, dims, axes, y, alpha, beta, indices);
+		break;
+	case deepflow::ReduceParam_ReduceOp_AMAX:
+		reduce_cpu<deepflow::ReduceParam_ReduceOp_AMAX>(x, dims, axes, y, alpha, beta, indices);
+		break;
+	case deepflow::ReduceParam_ReduceOp_AVG:
+		reduce_cpu<deepflow::ReduceParam_ReduceOp_AVG>(x, dims, axes, y, alpha, beta, indices);
+		break;
+	case deepflow::ReduceParam_ReduceOp_NORM1:
+		reduce_cpu<deepflow::ReduceParam_ReduceOp_NORM1>(x, dims, axes, y, alpha, beta, indices);
+		break;
+	case deepflow::ReduceParam_ReduceOp_NORM2:
+		reduce_cpu<deepflow::ReduceParam_ReduceOp_NORM2>(x, dims, axes, y, alpha, beta, indices);
+		break;
+	default:
+		LOG(FATAL) << "Unsupported reduce op " << op;
+	}
+}
@@ -0,0 +1,143 @@
+#include "core/cpu_softmax.h"
+#include "core/cpu_parallel.h"
+#include "core/cpu_vec.h"
+
+#include <algorithm>
+#include <cmath>
+
+// Softmaxes along contiguous rows run max, exp-and-sum and scale back to back on the same row,
+// so past the first pass the row is served from L1. Strided (CHANNEL) softmaxes are processed as
+// lanes of neighbouring positions, every pass then walks contiguous memory too.
+
+static const int kSoftmaxLanes = 256;
+
+template <class Tier>
+static void softmax_rows_cpu(const float *x, float *y, int rows, int channels, float *log_sum, Tier tier)
+{
+	CpuParallel::for_range(rows, std::max(1, 16384 / channels), [&](size_t begin, size_t end) {
+		for (size_t row = begin; row < end; ++row) {
+			const float *xr = x + row * channels;
+			float *yr = y + row * channels;
+			float m = xr[0];
+			for (int c = 1; c < channels; ++c)
+				m = std::max(m, xr[c]);
+			const Vec mv = splat<Vec>(m);
+			Vec acc = splat<Vec>(0);
+			float sum = 0;
+			int c = 0;
+			for (; c + (int)kVecWidth <= channels; c += kVecWidth) {
+				const Vec e = vexp(load(xr + c) - mv, tier);
+				store(yr + c, e);
+				acc = acc + e;
+			}
+			for (; c < channels; ++c) {
+				yr[c] = vexp(xr[c] - m, tier);
+				sum += yr[c];
+			}
+			sum += vsum(acc);
+			const float inv = 1.0f / sum;
+			for (c = 0; c < channels; ++c)
+				yr[c] *= inv;
+			if (log_sum)
+				log_sum[row] = m + logf(sum);
+		}
+	});
+}
+
+template <class Tier>
+static void softmax_lanes_cpu(const float *x, float *y, int outer, int channels, int inner, float *log_sum, Tier tier)
+{
+	const int chunks = (inner + kSoftmaxLanes - 1) / kSoftmaxLanes;
+	CpuParallel::for_range((size_t)outer * chunks, 1, [&](size_t begin, size_t end) {
+		float m[kSoftmaxLanes], sum[kSoftmaxLanes];
+		for (size_t task = begin; task < end; ++task) {
+			const int o = (int)(task / chunks), first = (int)(task % chunks) * kSoftmaxLanes;
+			const int n = std::min(kSoftmaxLanes, inner - first);
+			const size_t base = (size_t)o * channels * inner + first;
+			std::copy(x + base, x + base + n, m);
+			for (int c = 1; c < channels; ++c) {
+				const float *xc = x + base + (size_t)c * inner;
+				for (int j = 0; j < n; ++j)
+					m[j] = std::max(m[j], xc[j]);
+			}
+			std::fill_n(sum, n, 0.0f);
+			for (int c = 0; c < channels; ++c) {
+				const float *xc = x + base + (size_t)c * inner;
+				float *yc = y + base + (size_t)c * inner;
+				int j = 0;
+				for (; j + (int)kVecWidth <= n; j += kVecWidth) {
+					const Vec e = vexp(load(xc + j) - load(m + j), tier);
+					store(yc + j, e);
+					store(sum + j, load(sum + j) + e);
+				}
+				for (; j < n; ++j) {
+					yc[j] = vexp(xc[j] - m[j], tier);
+					sum[j] += yc[j];
+				}
+			}
+			for (int j = 0; j < n; ++j)
+				sum[j] = 1.0f / sum[j];
+			for (int c = 0; c < channels; ++c) {
+				float *yc = y + base + (size_t)c * inner;
+				for (int j = 0; j < n; ++j)
+					yc[j] *= sum[j];
+			}
+			if (log_sum)
+				for (int j = 0; j < n; ++j)
+					log_sum[(size_t)o * inner + first + j] = m[j] - logf(sum[j]);
+		}
+	});
+}
+
+void CpuSoftmax::forward(const float *x, float *y, int outer, int channels, int inner, float *log_sum, ExecutionContext::MathAccuracy accuracy)
+{
+	if (accuracy == ExecutionContext::MATH_FAST) {
+		if (inner == 1)
+			softmax_rows_cpu(x, y, outer, channels, log_sum, FastMath());
+		else
+			softmax_lanes_cpu(x, y, outer, channels, inner, log_sum, FastMath());
+	}
+	else if (inner == 1)
+		softmax_rows_cpu(x, y, outer, channels, log_sum, AccurateMath());
+	else
+		softmax_lanes_cpu(x, y, outer, channels, inner, log_sum, AccurateMath());
+}
+
+void CpuSoftmax::backward(const float *y, const float *dy, float *dx, int outer, int channels, int inner)
+{
+	if (inner == 1) {
+		CpuParallel::for_range(outer, std::max(1, 16384 / channels), [&](size_t begin, size_t end) {
+			for (size_t row = begin; row < end; ++row) {
+				const size_t base = row * channels;
+				float dot = 0;
+				for (int c = 0; c < channels; ++c)
+					dot += dy[base + c] * y[base + c];
+				for (int c = 0; c < channels; ++c)
+					dx[base + c] = y[base + c] * (dy[base + c] - dot);
+			}
+		});
+		return;
+	}
+	const int lanes = std::min(inner, kSoftmaxLanes);
+	const int chunks = (inner + lanes - 1) / lanes;
+	const size_t grain = std::max(1, 16384 / (channels * lanes));
+	CpuParallel::for_range((size_t)outer * chunks, grain, [&](size_t begin, size_t end) {
+		float dot[kSoftmaxLanes];
+		for (size_t task = begin; task < end; ++task) {
+			const int o = (int)(task / chunks), first = (int)(task % chunks) * lanes;
+			const int n = std::min(lanes, inner - first);
+			const size_t base = (size_t)o * channels * inner + first;
+			std::fill_n(dot, n, 0.0f);
+			for (int c = 0; c < channels; ++c) {
+				const size_t offset = base + (size_t)c * inner;
+				for (int j = 0; j < n; ++j)
+					dot[j] += dy[offset + j] * y[offset + j];
+			}
+			for (int c = 0; c < channels; ++c) {
+				const size_t offset = base + (size_t)c * inner;
+				for (int j = 0; j < n; ++j)
+					dx[offset + j] = y[offset + j] * (dy[offset + j] - dot[j]);
+			}
+		}
+	});
+}
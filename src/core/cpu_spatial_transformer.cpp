@@ -0,0 +1,233 @@
+#include "core/cpu_spatial_transformer.h"
+#include "core/cpu_parallel.h"
+#include "core/cpu_transpose.h"
+#include "core/cpu_vec.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+// Output locations per tile of a sampler row.
+static const int kSamplerTile = 64;
+
+// linspace(-1, 1, size)[i].
+static inline float st_coordinate(int i, int size)
+{
+	return size > 1 ? -1.0f + 2.0f * i / (size - 1) : -1.0f;
+}
+
+// Taps (y0, x0), (y0, x1), (y1, x0), (y1, x1) of one location, offsets into a channels-last sample.
+// Taps outside the image get offset 0 and zero weights, gx and gy are the derivatives of the
+// weights along the source x and y axes.
+struct SamplerTaps {
+	int offset[4];
+	float weight[4];
+	float gx[4];
+	float gy[4];
+};
+
+static inline void st_taps(float gx, float gy, int in_h, int in_w, int c, SamplerTaps &t)
+{
+	// Clamped a pixel beyond either border, which keeps floor in int range and maps NaN outside.
+	const float xs = fminf(fmaxf((gx + 1.0f) * 0.5f * (in_w - 1), -2.0f), (float)in_w + 1.0f);
+	const float ys = fminf(fmaxf((gy + 1.0f) * 0.5f * (in_h - 1), -2.0f), (float)in_h + 1.0f);
+	const float xf = floorf(xs), yf = floorf(ys);
+	const int x0 = (int)xf, y0 = (int)yf;
+	const float fx = xs - xf, fy = ys - yf;
+	const float wx[2] = { 1.0f - fx, fx }, wy[2] = { 1.0f - fy, fy };
+	const float dwx[2] = { -1.0f, 1.0f };
+	for (int k = 0; k < 4; ++k) {
+		const int dy = k >> 1, dx = k & 1;
+		const int yy = y0 + dy, xx = x0 + dx;
+		const bool inside = yy >= 0 && yy < in_h && xx >= 0 && xx < in_w;
+		t.offset[k] = inside ? (yy * in_w + xx) * c : 0;
+		t.weight[k] = inside ? wy[dy] * wx[dx] : 0.0f;
+		t.gx[k] = inside ? wy[dy] * dwx[dx] : 0.0f;
+		t.gy[k] = inside ? dwx[dy] * wx[dx] : 0.0f;
+	}
+}
+
+// [n, c, hw] -> [n, hw, c], or back when to_channels_last is false. last_sample is the sample stride
+// of the channels-last side.
+static void st_channels_last(int n, int c, int hw, const float *src, float *dst, bool to_channels_last, size_t last_sample)
+{
+	const int sizes[3] = { n, hw, c };
+	const ptrdiff_t first[3] = { (ptrdiff_t)c * hw, 1, hw };
+	const ptrdiff_t last[3] = { (ptrdiff_t)last_sample, c, 1 };
+	if (to_channels_last)
+		CpuTranspose::copy(3, sizes, src, first, dst, last);
+	else
+		CpuTranspose::copy(3, sizes, src, last, dst, first);
+}
+
+void CpuSpatialTransformer::grid_forward(int n, int out_h, int out_w, const float *theta, float *grid)
+{
+	CpuParallel::for_range((size_t)n * out_h, std::max(1, 4096 / std::max(1, out_w)), [&](size_t begin, size_t end) {
+		for (size_t row = begin; row < end; ++row) {
+			const float *t = theta + row / out_h * 6;
+			const float y = st_coordinate((int)(row % out_h), out_h);
+			float *g = grid + row * out_w * 2;
+			for (int w = 0; w < out_w; ++w) {
+				const float x = st_coordinate(w, out_w);
+				g[2 * w] = t[0] * x + t[1] * y + t[2];
+				g[2 * w + 1] = t[3] * x + t[4] * y + t[5];
+			}
+		}
+	});
+}
+
+void CpuSpatialTransformer::grid_backward(int n, int out_h, int out_w, const float *dgrid, float *dtheta)
+{
+	CpuParallel::for_range(n, 1, [&](size_t begin, size_t end) {
+		for (size_t i = begin; i < end; ++i) {
+			double sum[6] = { 0, 0, 0, 0, 0, 0 };
+			for (int h = 0; h < out_h; ++h) {
+				const float y = st_coordinate(h, out_h);
+				const float *g = dgrid + (i * out_h + h) * out_w * 2;
+				// Row sums first: x varies along the row, y is constant.
+				float gx = 0, gy = 0, gxx = 0, gyx = 0;
+				for (int w = 0; w < out_w; ++w) {
+					const float x = st_coordinate(w, out_w);
+					gx += g[2 * w];
+					gy += g[2 * w + 1];
+					gxx += g[2 * w] * x;
+					gyx += g[2 * w + 1] * x;
+				}
+				sum[0] += gxx;
+				sum[1] += (double)gx * y;
+				sum[2] += gx;
+				sum[3] += gyx;
+				sum[4] += (double)gy * y;
+				sum[5] += gy;
+			}
+			for (int k = 0; k < 6; ++k)
+				dtheta[i * 6 + k] = (float)sum[k];
+		}
+	});
+}
+
+void CpuSpatialTransformer::sampler_forward(int n, int c, int in_h, int in_w, int out_h, int out_w, const float *x, const float *grid, float *y)
+{
+	const size_t in_hw = (size_t)in_h * in_w, out_hw = (size_t)out_h * out_w;
+	std::vector<float> xt((size_t)n * in_hw * c);
+	st_channels_last(n, c, (int)in_hw, x, xt.data(), true, in_hw * c);
+	const int tiles = (out_w + kSamplerTile - 1) / kSamplerTile;
+	CpuParallel::for_range((size_t)n * out_h * tiles, std::max(1, 4096 / (kSamplerTile * c)), [&](size_t begin, size_t end) {
+		SamplerTaps taps[kSamplerTile];
+		std::vector<float> tile((size_t)kSamplerTile * c);
+		for (size_t task = begin; task < end; ++task) {
+			const size_t row = task / tiles;
+			const int i = (int)(row / out_h), h = (int)(row % out_h);
+			const int w0 = (int)(task % tiles) * kSamplerTile, w1 = std::min(out_w, w0 + kSamplerTile);
+			const float *g = grid + (row * out_w + w0) * 2;
+			for (int w = 0; w < w1 - w0; ++w)
+				st_taps(g[2 * w], g[2 * w + 1], in_h, in_w, c, taps[w]);
+			const float *xs = xt.data() + i * in_hw * c;
+			for (int w = 0; w < w1 - w0; ++w) {
+				const SamplerTaps &t = taps[w];
+				const float *p0 = xs + t.offset[0], *p1 = xs + t.offset[1], *p2 = xs + t.offset[2], *p3 = xs + t.offset[3];
+				float *out = tile.data() + (size_t)w * c;
+				size_t j = 0;
+				const Vec a0 = splat<Vec>(t.weight[0]), a1 = splat<Vec>(t.weight[1]), a2 = splat<Vec>(t.weight[2]), a3 = splat<Vec>(t.weight[3]);
+				for (; j + kVecWidth <= (size_t)c; j += kVecWidth)
+					store(out + j, vfma(a3, load(p3 + j), vfma(a2, load(p2 + j), vfma(a1, load(p1 + j), a0 * load(p0 + j)))));
+				for (; j < (size_t)c; ++j)
+					out[j] = t.weight[3] * p3[j] + t.weight[2] * p2[j] + t.weight[1] * p1[j] + t.weight[0] * p0[j];
+			}
+			for (int ch = 0; ch < c; ++ch) {
+				float *dst = y + ((size_t)i * c + ch) * out_hw + (size_t)h * out_w + w0;
+				for (int w = 0; w < w1 - w0; ++w)
+					dst[w] = tile[(size_t)w * c + ch];
+			}
+		}
+	});
+}
+
+void CpuSpatialTransformer::sampler_backward(int n, int c, int in_h, int in_w, int out_h, int out_w, const float *x, const float *grid, const float *dy, float *dx, float *dgrid)
+{
+	const size_t in_hw = (size_t)in_h * in_w, out_hw = (size_t)out_h * out_w, sample = in_hw * c;
+	std::vector<float> xt((size_t)n * sample);
+	st_channels_last(n, c, (int)in_hw, x, xt.data(), true, sample);
+	// Samples split into row blocks until every thread has one, each block owns a dx buffer.
+	const int blocks = std::max(1, std::min(out_h, (CpuParallel::num_threads() + n - 1) / n));
+	std::vector<float> acc(dx ? (size_t)n * blocks * sample : 0);
+	const float scale_x = 0.5f * (in_w - 1), scale_y = 0.5f * (in_h - 1);
+	CpuParallel::for_range((size_t)n * blocks, 1, [&](size_t begin, size_t end) {
+		SamplerTaps taps[kSamplerTile];
+		std::vector<float> tile((size_t)kSamplerTile * c);
+		for (size_t task = begin; task < end; ++task) {
+			const int i = (int)(task / blocks), b = (int)(task % blocks);
+			const int h0 = (int)((long long)out_h * b / blocks), h1 = (int)((long long)out_h * (b + 1) / blocks);
+			const float *xs = xt.data() + i * sample;
+			float *da = dx ? acc.data() + task * sample : nullptr;
+			if (da)
+				memset(da, 0, sample * sizeof(float));
+			for (int h = h0; h < h1; ++h) {
+				const size_t row = (size_t)i * out_h + h;
+				for (int w0 = 0; w0 < out_w; w0 += kSamplerTile) {
+					const int w1 = std::min(out_w, w0 + kSamplerTile);
+					const float *g = grid + (row * out_w + w0) * 2;
+					float *dg = dgrid + (row * out_w + w0) * 2;
+					for (int w = 0; w < w1 - w0; ++w)
+						st_taps(g[2 * w], g[2 * w + 1], in_h, in_w, c, taps[w]);
+					for (int ch = 0; ch < c; ++ch) {
+						const float *src = dy + ((size_t)i * c + ch) * out_hw + (size_t)h * out_w + w0;
+						for (int w = 0; w < w1 - w0; ++w)
+							tile[(size_t)w * c + ch] = src[w];
+					}
+					for (int w = 0; w < w1 - w0; ++w) {
+						const SamplerTaps &t = taps[w];
+						const float *d = tile.data() + (size_t)w * c;
+						// s[k] = dy . x at tap k, the grid gradient is the weight derivatives times s.
+						float s[4];
+						for (int k = 0; k < 4; ++k) {
+							const float *p = xs + t.offset[k];
+							size_t j = 0;
+							Vec v = splat<Vec>(0);
+							for (; j + kVecWidth <= (size_t)c; j += kVecWidth)
+								v = vfma(load(d + j), load(p + j), v);
+							float sum = vsum(v);
+							for (; j < (size_t)c; ++j)
+								sum += d[j] * p[j];
+							s[k] = sum;
+						}
+						dg[2 * w] = scale_x * (t.gx[0] * s[0] + t.gx[1] * s[1] + t.gx[2] * s[2] + t.gx[3] * s[3]);
+						dg[2 * w + 1] = scale_y * (t.gy[0] * s[0] + t.gy[1] * s[1] + t.gy[2] * s[2] + t.gy[3] * s[3]);
+						if (!da)
+							continue;
+						for (int k = 0; k < 4; ++k) {
+							if (t.weight[k] == 0.0f)
+								continue;
+							float *q = da + t.offset[k];
+							const Vec a = splat<Vec>(t.weight[k]);
+							size_t j = 0;
+							for (; j + kVecWidth <= (size_t)c; j += kVecWidth)
+								store(q + j, vfma(a, load(d + j), load(q + j)));
+							for (; j < (size_t)c; ++j)
+								q[j] += t.weight[k] * d[j];
+						}
+					}
+				}
+			}
+		}
+	});
+	if (!dx)
+		return;
+	// Blocks of a sample summed into its first one in block order, then back to channels first.
+	if (blocks > 1) {
+		CpuParallel::for_range((size_t)n * sample, 4096, [&](size_t begin, size_t end) {
+			while (begin < end) {
+				const size_t i = begin / sample, j0 = begin % sample, j1 = std::min(sample, j0 + (end - begin));
+				float *first = acc.data() + i * blocks * sample;
+				for (int b = 1; b < blocks; ++b) {
+					const float *other = first + (size_t)b * sample;
+					for (size_t j = j0; j < j1; ++j)
+						first[j] += other[j];
+				}
+				begin += j1 - j0;
+			}
+		});
+	}
+	st_channels_last(n, c, (int)in_hw, acc.data(), dx, false, (size_t)blocks * sample);
+}
@@ -0,0 +1,149 @@
+#include "core/cpu_transpose.h"
+#include "core/cpu_parallel.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include <glog/logging.h>
+
+struct TransposeDim {
+	size_t size;
+	ptrdiff_t src;
+	ptrdiff_t dst;
+};
+
+static const size_t kTransposeTile = 32;
+static const size_t kTransposeGrain = 1 << 14;
+
+// Odometer over the outer dims of a copy, a chunk pays the divisions once at its first position.
+struct TransposeCursor {
+	const TransposeDim *dims;
+	int num_dims;
+	size_t index[CpuTranspose::kMaxDims];
+	ptrdiff_t src = 0;
+	ptrdiff_t dst = 0;
+	TransposeCursor(const TransposeDim *dims, int num_dims, size_t position) : dims(dims), num_dims(num_dims) {
+		for (int d = num_dims - 1; d >= 0; --d) {
+			index[d] = position % dims[d].size;
+			position /= dims[d].size;
+			src += (ptrdiff_t)index[d] * dims[d].src;
+			dst += (ptrdiff_t)index[d] * dims[d].dst;
+		}
+	}
+	void next() {
+		for (int d = num_dims - 1; d >= 0; --d) {
+			src += dims[d].src;
+			dst += dims[d].dst;
+			if (++index[d] < dims[d].size)
+				return;
+			src -= (ptrdiff_t)dims[d].size * dims[d].src;
+			dst -= (ptrdiff_t)dims[d].size * dims[d].dst;
+			index[d] = 0;
+		}
+	}
+};
+
+static void transpose_row(const float * __restrict x, ptrdiff_t xs, float * __restrict y, ptrdiff_t ys, size_t n, float beta)
+{
+	if (xs == 1 && ys == 1) {
+		if (beta == 0)
+			memcpy(y, x, n * sizeof(float));
+		else
+			for (size_t i = 0; i < n; ++i)
+				y[i] = x[i] + beta * y[i];
+	}
+	else if (beta == 0) {
+		for (ptrdiff_t i = 0; i < (ptrdiff_t)n; ++i)
+			y[i * ys] = x[i * xs];
+	}
+	else {
+		for (ptrdiff_t i = 0; i < (ptrdiff_t)n; ++i)
+			y[i * ys] = x[i * xs] + beta * y[i * ys];
+	}
+}
+
+// Rows walk the dim that is contiguous on one side, columns the dim that is contiguous on the other,
+// so every column block touches at most kTransposeTile lines of the strided side.
+static void transpose_tile(const float * __restrict x, ptrdiff_t xr, ptrdiff_t xc, float * __restrict y, ptrdiff_t yr, ptrdiff_t yc, size_t rows, size_t columns, float beta)
+{
+	for (ptrdiff_t c0 = 0; c0 < (ptrdiff_t)columns; c0 += kTransposeTile) {
+		const ptrdiff_t c1 = std::min((ptrdiff_t)columns, c0 + (ptrdiff_t)kTransposeTile);
+		for (size_t r = 0; r < rows; ++r) {
+			const float *xp = x + (ptrdiff_t)r * xr;
+			float *yp = y + (ptrdiff_t)r * yr;
+			if (beta == 0) {
+				for (ptrdiff_t c = c0; c < c1; ++c)
+					yp[c * yc] = xp[c * xc];
+			}
+			else {
+				for (ptrdiff_t c = c0; c < c1; ++c)
+					yp[c * yc] = xp[c * xc] + beta * yp[c * yc];
+			}
+		}
+	}
+}
+
+void CpuTranspose::copy(int num_dims, const int *sizes, const float *src, const ptrdiff_t *src_strides, float *dst, const ptrdiff_t *dst_strides, float beta)
+{
+	LOG_IF(FATAL, num_dims < 1 || num_dims > kMaxDims) << "CpuTranspose supports 1 to " << kMaxDims << " dims but got " << num_dims;
+	TransposeDim dims[kMaxDims];
+	int count = 0;
+	for (int d = 0; d < num_dims; ++d) {
+		LOG_IF(FATAL, sizes[d] < 0) << "CpuTranspose - negative size " << sizes[d] << " at dim " << d;
+		if (sizes[d] == 0)
+			return;
+		if (sizes[d] == 1)
+			continue;
+		TransposeDim dim = { (size_t)sizes[d], src_strides[d], dst_strides[d] };
+		if (count > 0) {
+			TransposeDim &last = dims[count - 1];
+			if (last.src == dim.src * (ptrdiff_t)dim.size && last.dst == dim.dst * (ptrdiff_t)dim.size) {
+				last.size *= dim.size;
+				last.src = dim.src;
+				last.dst = dim.dst;
+				continue;
+			}
+		}
+		dims[count++] = dim;
+	}
+	if (count == 0) {
+		transpose_row(src, 1, dst, 1, 1, beta);
+		return;
+	}
+	const TransposeDim inner = dims[count - 1];
+	int tile = -1;
+	if (inner.src != 1 || inner.dst != 1) {
+		for (int d = count - 2; d >= 0 && tile < 0; --d)
+			if ((inner.dst == 1 && dims[d].src == 1) || (inner.src == 1 && dims[d].dst == 1))
+				tile = d;
+	}
+	if (tile < 0) {
+		size_t rows = 1;
+		for (int d = 0; d < count - 1; ++d)
+			rows *= dims[d].size;
+		CpuParallel::for_range(rows, std::max<size_t>(1, kTransposeGrain / inner.size), [&](size_t begin, size_t end) {
+			TransposeCursor cursor(dims, count - 1, begin);
+			for (size_t r = begin; r < end; ++r, cursor.next())
+				transpose_row(src + cursor.src, inner.src, dst + cursor.dst, inner.dst, inner.size, beta);
+		});
+		return;
+	}
+	// The tiled dim is split into blocks that become the innermost outer dim, one task copies one block.
+	const TransposeDim rows = dims[tile];
+	TransposeDim outer[kMaxDims];
+	int num_outer = 0;
+	for (int d = 0; d < count - 1; ++d)
+		if (d != tile)
+			outer[num_outer++] = dims[d];
+	outer[num_outer++] = { (rows.size + kTransposeTile - 1) / kTransposeTile, rows.src * (ptrdiff_t)kTransposeTile, rows.dst * (ptrdiff_t)kTransposeTile };
+	size_t tasks = 1;
+	for (int d = 0; d < num_outer; ++d)
+		tasks *= outer[d].size;
+	CpuParallel::for_range(tasks, std::max<size_t>(1, kTransposeGrain / (kTransposeTile * inner.size)), [&](size_t begin, size_t end) {
+		TransposeCursor cursor(outer, num_outer, begin);
+		for (size_t t = begin; t < end; ++t, cursor.next()) {
+			const size_t first = cursor.index[num_outer - 1] * kTransposeTile;
+			transpose_tile(src + cursor.src, rows.src, inner.src, dst + cursor.dst, rows.dst, inner.dst, std::min(kTransposeTile, rows.size - first), inner.size, beta);
+		}
+	});
+}
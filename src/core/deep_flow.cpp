@@ -406,6 +406,21 @@ std::string DeepFlow::restructure(std::string input, int first_dim, int second_d
 	return node_param->output(0);
 }
 
+std::string DeepFlow::slice(std::string input, int dim, int begin, int size, SliceOp &params)
+{
+	auto node_param = _block->add_node_param();
+	node_param->set_data_policy((deepflow::NodeParam_DataPolicy)_policy);
+	add_scope(node_param, _scope, params._scope);
+	node_param->set_name(_block->get_unique_node_param_name(params._name));
+	add_outputs(node_param, 1);
+	node_param->add_input(input);
+	auto slice_param = node_param->mutable_slice_param();
+	slice_param->set_dim(dim);
+	slice_param->set_begin(begin);
+	slice_param->set_size(size);
+	return node_param->output(0);
+}
+
 std::string DeepFlow::variable(std::string initializer, std::string solver, VariableOp &params) {
 	auto node_param = _block->add_node_param();
 	node_param->set_data_policy((deepflow::NodeParam_DataPolicy)_policy);
@@ -586,6 +601,8 @@ std::string DeepFlow::replay_memory(std::string input, int capacity, ReplayMemor
 	node_param->add_input(input);
 	auto replay_memory_param = node_param->mutable_replay_memory_param();
 	replay_memory_param->set_capacity(capacity);
+	replay_memory_param->set_prioritized(params._prioritized);
+	replay_memory_param->set_alpha(params._alpha);
 	return node_param->output(0);
 }
 
@@ -917,6 +934,7 @@ std::string DeepFlow::pooling(std::string input, PoolingOp &params) {
 	pooling_param->set_v_stride(params._v_stride);
 	pooling_param->set_window_h(params._window_h);
 	pooling_param->set_window_w(params._window_w);	
+	pooling_param->set_mode(params._mode);
 	return node_param->output(0);
 }
 
@@ -1071,6 +1089,26 @@ std::string DeepFlow::resize(std::string input, float height_scale, float width_
 	auto resize_param = node_param->mutable_resize_param();
 	resize_param->set_height_scale(height_scale);
 	resize_param->set_width_scale(width_scale);
+	resize_param->set_mode(params._mode);
+	return node_param->output(0);
+}
+
+std::string DeepFlow::resize_add(std::string input, std::string other, float height_scale, float width_scale, ResizeOp &params)
+{
+	auto node_param = _block->add_node_param();
+	node_param->set_data_policy((deepflow::NodeParam_DataPolicy)_policy);
+	add_scope(node_param, _scope, params._scope);
+	node_param->set_name(_block->get_unique_node_param_name(params._name));
+	add_outputs(node_param, 1);
+	node_param->add_input(input);
+	node_param->add_input(other);
+	auto resize_param = node_param->mutable_resize_param();
+	resize_param->set_height_scale(height_scale);
+	resize_param->set_width_scale(width_scale);
+	resize_param->set_mode(params._mode);
+	resize_param->set_add(true);
+	resize_param->set_alpha(params._alpha);
+	resize_param->set_beta(params._beta);
 	return node_param->output(0);
 }
 
@@ -1131,11 +1169,17 @@ std::string DeepFlow::_reduce(std::string input, ReduceOp &params) {
 	node_param->add_input(input);
 	auto reduce_param = node_param->mutable_reduce_param();
 	reduce_param->set_reduce_dim(params._reduce_dimention);
+	for (auto dim : params._reduce_dimentions)
+		reduce_param->add_reduce_dims(dim);
 	reduce_param->set_output_type(params._output_type);
 	reduce_param->set_reduce_op(params._op);	
 	return node_param->output(params._terminal);
 }
 
+std::string DeepFlow::reduce(std::string input, ReduceOp &params) {
+	return _reduce(input, params);
+}
+
 std::string DeepFlow::reduce_all(std::string input, ReduceAllOp &params)
 {
 	auto node_param = _block->add_node_param();
@@ -1242,6 +1286,24 @@ std::string DeepFlow::loss(std::string input, LossOp &params)
 	return node_param->output(0);
 }
 
+std::array<std::string, 2> DeepFlow::softmax_cross_entropy(std::string logits, std::string labels, SoftmaxCrossEntropyOp &params)
+{
+	auto node_param = _block->add_node_param();
+	node_param->set_data_policy((deepflow::NodeParam_DataPolicy)_policy);
+	add_scope(node_param, _scope, params._scope);
+	node_param->set_name(_block->get_unique_node_param_name(params._name));
+	add_outputs(node_param, 2);
+	node_param->add_input(logits);
+	node_param->add_input(labels);
+	auto softmax_cross_entropy_param = node_param->mutable_softmax_cross_entropy_param();
+	softmax_cross_entropy_param->set_mode(params._mode);
+	softmax_cross_entropy_param->set_alpha(params._alpha);
+	std::array<std::string, 2> outputs;
+	outputs[0] = node_param->output(0);
+	outputs[1] = node_param->output(1);
+	return outputs;
+}
+
 std::string DeepFlow::equal(std::string a, std::string b, EqualOp &params) {
 	auto node_param = _block->add_node_param();
 	node_param->set_data_policy((deepflow::NodeParam_DataPolicy)_policy);
@@ -1264,10 +1326,10 @@ std::shared_ptr<Session> DeepFlow::session()
 	return session;
 }
 
-void DeepFlow::load_from_caffe_model(std::string file_path, std::initializer_list<std::pair<std::string, std::array<int, 4>>> inputs, bool verbose)
+void DeepFlow::load_from_caffe_model(std::string file_path, std::initializer_list<std::pair<std::string, std::array<int, 4>>> inputs, bool verbose, std::string cache_file_path)
 {
 	Caffe caffe(this, verbose);
-	caffe.load(file_path, inputs);
+	caffe.load(file_path, inputs, cache_file_path);
 }
 
 void DeepFlow::with(std::string scope)
@@ -0,0 +1,388 @@
+#include "core/graph_fusion.h"
+#include "nodes/fused_elementwise.h"
+
+#include "cudnn.h"
+
+#include <glog/logging.h>
+
+#include <algorithm>
+#include <cmath>
+#include <set>
+#include <vector>
+
+typedef deepflow::NodeParam NodeParam;
+typedef google::protobuf::RepeatedField<float> Weights;
+
+namespace {
+
+// Producers and consumer counts of every output, kept current while nodes are merged.
+class FusionGraph {
+public:
+	FusionGraph(deepflow::BlockParam *block) : _block(block)
+	{
+		for (auto &node : *block->mutable_node()) {
+			for (auto &output : node.output())
+				_producer[output] = &node;
+			for (auto &input : node.input())
+				if (!input.empty())
+					++_consumers[input];
+		}
+	}
+	// The only node reading the only output of node, null otherwise.
+	NodeParam *sole_consumer(NodeParam *node)
+	{
+		if (node->output_size() != 1 || _consumers[node->output(0)] != 1)
+			return nullptr;
+		for (auto &other : *_block->mutable_node())
+			if (!_removed.count(&other) && other.input_size() > 0 && std::find(other.input().begin(), other.input().end(), node->output(0)) != other.input().end())
+				return &other;
+		return nullptr;
+	}
+	// The variable producing output, null for other nodes.
+	NodeParam *variable(const std::string &output)
+	{
+		auto producer = _producer.find(output);
+		return producer != _producer.end() && producer->second->has_variable_param() ? producer->second : nullptr;
+	}
+	// The variable producing output if nothing else reads it, so it can be rewritten.
+	NodeParam *own_variable(const std::string &output)
+	{
+		return _consumers[output] == 1 ? variable(output) : nullptr;
+	}
+	void add_input(NodeParam *node, const std::string &output)
+	{
+		node->add_input(output);
+		++_consumers[output];
+	}
+	// head takes over the name and output of tail, which is removed with the nodes in between.
+	void merge(NodeParam *head, NodeParam *tail, std::initializer_list<NodeParam*> removed)
+	{
+		_producer.erase(head->output(0));
+		_producer[tail->output(0)] = head;
+		head->set_name(tail->name());
+		head->set_scope(tail->scope());
+		head->set_output(0, tail->output(0));
+		for (auto node : removed)
+			remove(node);
+	}
+	void remove(NodeParam *node)
+	{
+		_removed.insert(node);
+		for (auto &input : node->input())
+			if (!input.empty())
+				--_consumers[input];
+	}
+	bool removed(NodeParam *node) const { return _removed.count(node) > 0; }
+	// Drops the removed nodes from the block.
+	int compact()
+	{
+		google::protobuf::RepeatedPtrField<NodeParam> kept;
+		for (auto &node : *_block->mutable_node())
+			if (!_removed.count(&node))
+				kept.Add()->Swap(&node);
+		int count = _block->node_size() - kept.size();
+		_block->mutable_node()->Swap(&kept);
+		_removed.clear();
+		return count;
+	}
+private:
+	deepflow::BlockParam *_block;
+	std::map<std::string, NodeParam*> _producer;
+	std::map<std::string, int> _consumers;
+	std::set<NodeParam*> _removed;
+};
+
+bool same_policy(const NodeParam *a, const NodeParam *b)
+{
+	return a && b && a->data_policy() == b->data_policy();
+}
+
+// Stored values of a variable, null when it is still to be drawn by its initializer.
+const Weights *stored_weights(const NodeParam *var)
+{
+	if (var->variable_param().has_weights())
+		return &var->variable_param().weights().data();
+	if (var->variable_param().init_param().has_init_data())
+		return &var->variable_param().init_param().init_data().data();
+	return nullptr;
+}
+
+void store_weights(NodeParam *var, const std::vector<float> &values)
+{
+	auto weights = var->mutable_variable_param()->mutable_weights()->mutable_data();
+	weights->Clear();
+	weights->Add(values.begin(), values.end());
+}
+
+std::vector<int> variable_dims(const NodeParam *var)
+{
+	auto &dims = var->variable_param().init_param().tensor_param().dims();
+	return std::vector<int>(dims.begin(), dims.end());
+}
+
+deepflow::EpilogueParam *mutable_epilogue(NodeParam *node)
+{
+	if (node->has_conv_2d_param())
+		return node->mutable_conv_2d_param()->mutable_epilogue();
+	if (node->has_matmul_param())
+		return node->mutable_matmul_param()->mutable_epilogue();
+	return nullptr;
+}
+
+// Filter variable of a conv2d or matmul with the output channel count, null when the filter is computed.
+// Matmul outputs must be [rows, columns, 1, 1] so that channels and columns coincide.
+NodeParam *filter_variable(FusionGraph &graph, NodeParam *node, int *channels)
+{
+	if (node->input_size() < 2 || node->output_size() != 1)
+		return nullptr;
+	auto filter = graph.variable(node->input(1));
+	if (!filter)
+		return nullptr;
+	auto dims = variable_dims(filter);
+	if (dims.size() != 4)
+		return nullptr;
+	if (node->has_conv_2d_param()) {
+		*channels = dims[0];
+		return filter;
+	}
+	if (dims[2] * dims[3] != 1)
+		return nullptr;
+	*channels = dims[1];
+	return filter;
+}
+
+// The bias_add reading node, with its bias variable, when it can move into node's epilogue. own asks
+// for a bias variable read by nothing else.
+NodeParam *fusible_bias_add(FusionGraph &graph, NodeParam *node, int channels, bool own, NodeParam **bias)
+{
+	auto bias_add = graph.sole_consumer(node);
+	if (!bias_add || !bias_add->has_bias_add_param() || !same_policy(node, bias_add) || bias_add->input(0) != node->output(0) || bias_add->input_size() != 2)
+		return nullptr;
+	auto var = own ? graph.own_variable(bias_add->input(1)) : graph.variable(bias_add->input(1));
+	if (!var)
+		return nullptr;
+	auto dims = variable_dims(var);
+	int size = 1;
+	for (auto d : dims)
+		size *= d;
+	if (size != channels)
+		return nullptr;
+	*bias = var;
+	return bias_add;
+}
+
+// Epilogue stage of an activation or leaky_relu node. Only activations that keep the sign of x in y
+// qualify, the epilogue backward reads y alone.
+bool epilogue_stage(const NodeParam *node, deepflow::PointwiseStage *stage)
+{
+	if (node->has_leaky_relu_param()) {
+		stage->set_op(deepflow::PointwiseStage_Op_LEAKY_RELU);
+		stage->set_coef(node->leaky_relu_param().negative_slope());
+		return node->leaky_relu_param().negative_slope() >= 0;
+	}
+	if (node->has_activation_param()) {
+		auto &param = node->activation_param();
+		stage->set_op((deepflow::PointwiseStage_Op) (param.type() + 1));
+		stage->set_coef(param.coef());
+		return param.type() != deepflow::ActivationParam_Type_CUDNN_ACTIVATION_ELU || param.coef() > 0;
+	}
+	return false;
+}
+
+// Stage of a unary pointwise node for a fused chain.
+bool chain_stage(const NodeParam *node, deepflow::PointwiseStage *stage)
+{
+	if (node->input_size() != 1 || node->output_size() != 1)
+		return false;
+	if (node->has_exp_param())
+		stage->set_op(deepflow::PointwiseStage_Op_EXP);
+	else if (node->has_log_param()) {
+		stage->set_op(deepflow::PointwiseStage_Op_LOG);
+		stage->set_coef(node->log_param().coef());
+	}
+	else if (node->has_abs_param())
+		stage->set_op(deepflow::PointwiseStage_Op_ABS);
+	else if (node->has_square_param())
+		stage->set_op(deepflow::PointwiseStage_Op_SQUARE);
+	else if (node->has_leaky_relu_param()) {
+		stage->set_op(deepflow::PointwiseStage_Op_LEAKY_RELU);
+		stage->set_coef(node->leaky_relu_param().negative_slope());
+	}
+	else if (node->has_activation_param()) {
+		stage->set_op((deepflow::PointwiseStage_Op) (node->activation_param().type() + 1));
+		stage->set_coef(node->activation_param().coef());
+	}
+	else
+		return false;
+	return true;
+}
+
+// conv2d / matmul [-> bias_add] -> batch_normalization with the normalization running on stored statistics.
+void fold_batch_norms(FusionGraph &graph, deepflow::BlockParam *block, GraphFusion::Report &report)
+{
+	for (auto &node : *block->mutable_node()) {
+		auto epilogue = mutable_epilogue(&node);
+		if (!epilogue || graph.removed(&node) || epilogue->bias() || epilogue->activation().op() != deepflow::PointwiseStage_Op_IDENTITY)
+			continue;
+		int channels = 0;
+		auto filter = filter_variable(graph, &node, &channels);
+		if (!filter || !graph.own_variable(node.input(1)) || !stored_weights(filter))
+			continue;
+		NodeParam *bias = nullptr;
+		auto bias_add = fusible_bias_add(graph, &node, channels, true, &bias);
+		if (bias_add && !stored_weights(bias))
+			continue;
+		auto bn = graph.sole_consumer(bias_add ? bias_add : &node);
+		if (!bn || !bn->has_batch_normalization_param() || !same_policy(&node, bn) || bn->input_size() != 3 || bn->input(0) != (bias_add ? bias_add : &node)->output(0))
+			continue;
+		auto &param = bn->batch_normalization_param();
+		if (param.mode() != deepflow::BatchNormalizationParam_Mode_CUDNN_BATCHNORM_SPATIAL)
+			continue;
+		auto scale = graph.own_variable(bn->input(1));
+		auto shift = graph.own_variable(bn->input(2));
+		if (!scale || !shift || !stored_weights(scale) || !stored_weights(shift) || stored_weights(scale)->size() != channels || stored_weights(shift)->size() != channels)
+			continue;
+		if ((param.has_mean() && param.mean().data_size() != channels) || (param.has_var() && param.var().data_size() != channels))
+			continue;
+
+		// y = (x + b0 - mean) * scale / sqrt(var + eps) + shift = x * a + (b0 - mean) * a + shift, with the
+		// same rounding as the inference path of the node.
+		const double eps = std::max((double) param.eps(), CUDNN_BN_MIN_EPSILON);
+		std::vector<float> a(channels), b(channels);
+		for (int c = 0; c < channels; ++c) {
+			const float mean = param.has_mean() ? param.mean().data(c) : 0.0f;
+			const float var = param.has_var() ? param.var().data(c) : 1.0f;
+			a[c] = (float) (stored_weights(scale)->Get(c) / sqrt(var + eps));
+			b[c] = stored_weights(shift)->Get(c) - mean * a[c];
+			if (bias_add)
+				b[c] += stored_weights(bias)->Get(c) * a[c];
+		}
+		std::vector<float> w(stored_weights(filter)->begin(), stored_weights(filter)->end());
+		if (node.has_conv_2d_param()) {
+			const size_t per_channel = w.size() / channels;
+			for (size_t i = 0; i < w.size(); ++i)
+				w[i] *= a[i / per_channel];
+		}
+		else {
+			for (size_t i = 0; i < w.size(); ++i)
+				w[i] *= a[i % channels];
+		}
+		store_weights(filter, w);
+
+		// The bias lands in the bias_add variable if there is one, else in the shift variable.
+		auto folded_bias = bias_add ? bias : shift;
+		store_weights(folded_bias, b);
+		if (bias_add)
+			graph.merge(&node, bn, { bias_add, bn });
+		else
+			graph.merge(&node, bn, { bn });
+		epilogue->set_bias(true);
+		graph.add_input(&node, folded_bias->output(0));
+		std::vector<NodeParam*> dead = { scale };
+		if (bias_add)
+			dead.push_back(shift);
+		for (auto var : dead) {
+			graph.remove(var);
+			report.variable_bytes += 2 * channels * sizeof(float);
+		}
+		report.folded_batch_norms++;
+		report.absorbed_outputs[node.name()] += bias_add ? 2 : 1;
+	}
+}
+
+// conv2d / matmul [-> bias_add] [-> activation] into the conv2d / matmul epilogue.
+void fuse_epilogues(FusionGraph &graph, deepflow::BlockParam *block, GraphFusion::Report &report)
+{
+	for (auto &node : *block->mutable_node()) {
+		auto epilogue = mutable_epilogue(&node);
+		if (!epilogue || graph.removed(&node) || node.output_size() != 1 || epilogue->activation().op() != deepflow::PointwiseStage_Op_IDENTITY)
+			continue;
+		std::vector<NodeParam*> absorbed;
+		NodeParam *tail = &node;
+		int channels = 0;
+		NodeParam *bias = nullptr;
+		NodeParam *bias_add = nullptr;
+		if (!epilogue->bias() && filter_variable(graph, &node, &channels))
+			bias_add = fusible_bias_add(graph, &node, channels, false, &bias);
+		if (bias_add) {
+			absorbed.push_back(bias_add);
+			tail = bias_add;
+		}
+		deepflow::PointwiseStage stage;
+		auto activation = graph.sole_consumer(tail);
+		bool fuse_activation = activation && same_policy(&node, activation) && activation->input_size() == 1 && activation->input(0) == tail->output(0) && epilogue_stage(activation, &stage);
+		if (fuse_activation) {
+			absorbed.push_back(activation);
+			tail = activation;
+		}
+		if (absorbed.empty())
+			continue;
+		if (bias_add) {
+			epilogue->set_bias(true);
+			graph.add_input(&node, bias->output(0));
+		}
+		if (fuse_activation)
+			*epilogue->mutable_activation() = stage;
+		for (auto n : absorbed)
+			graph.remove(n);
+		graph.merge(&node, tail, {});
+		report.epilogues++;
+		report.absorbed_outputs[node.name()] += absorbed.size();
+	}
+}
+
+// Runs of unary pointwise nodes into fused_elementwise nodes of at most FusedElementwise::kMaxStages stages.
+void fuse_chains(FusionGraph &graph, deepflow::BlockParam *block, GraphFusion::Report &report)
+{
+	deepflow::PointwiseStage stage;
+	// Chains start at a pointwise node that does not continue another one.
+	auto next = [&](NodeParam *node) -> NodeParam* {
+		auto consumer = graph.sole_consumer(node);
+		deepflow::PointwiseStage s;
+		return consumer && same_policy(node, consumer) && chain_stage(consumer, &s) ? consumer : nullptr;
+	};
+	std::set<NodeParam*> continuations;
+	for (auto &node : *block->mutable_node())
+		if (!graph.removed(&node) && chain_stage(&node, &stage) && next(&node))
+			continuations.insert(next(&node));
+	for (auto &node : *block->mutable_node()) {
+		if (graph.removed(&node) || continuations.count(&node) || !chain_stage(&node, &stage))
+			continue;
+		std::vector<NodeParam*> chain = { &node };
+		while (auto consumer = next(chain.back()))
+			chain.push_back(consumer);
+		for (size_t begin = 0; begin + 1 < chain.size(); begin += FusedElementwise::kMaxStages) {
+			const size_t end = std::min(chain.size(), begin + FusedElementwise::kMaxStages);
+			if (end - begin < 2)
+				break;
+			NodeParam *head = chain[begin];
+			NodeParam fused;
+			fused.set_data_policy(head->data_policy());
+			fused.add_input(head->input(0));
+			fused.add_output(head->output(0));
+			auto param = fused.mutable_fused_elementwise_param();
+			for (size_t i = begin; i < end; ++i)
+				chain_stage(chain[i], param->add_stage());
+			for (size_t i = begin + 1; i < end; ++i)
+				graph.remove(chain[i]);
+			head->Swap(&fused);
+			graph.merge(head, chain[end - 1], {});
+			report.chains++;
+			report.absorbed_outputs[head->name()] += end - begin - 1;
+		}
+	}
+}
+
+}
+
+GraphFusion::Report GraphFusion::run(deepflow::BlockParam *block, bool inference)
+{
+	Report report;
+	FusionGraph graph(block);
+	if (inference)
+		fold_batch_norms(graph, block, report);
+	fuse_epilogues(graph, block, report);
+	fuse_chains(graph, block, report);
+	report.nodes_removed = graph.compact();
+	return report;
+}
@@ -0,0 +1,189 @@
+#include "core/graph_layout.h"
+#include "core/cpu_layout.h"
+
+#include <glog/logging.h>
+
+#include <map>
+#include <set>
+#include <vector>
+
+typedef deepflow::NodeParam NodeParam;
+
+namespace {
+
+const NodeParam::Layout NCHW = NodeParam::NCHW;
+const NodeParam::Layout NHWC = NodeParam::NHWC;
+const NodeParam::Layout NCHW16C = NodeParam::NCHW16C;
+
+bool unary_pointwise(const NodeParam &node)
+{
+	return node.has_activation_param() || node.has_leaky_relu_param() || node.has_exp_param() || node.has_log_param() || node.has_abs_param() || node.has_square_param() || node.has_fused_elementwise_param() || node.has_pass_through_param();
+}
+
+// Inputs read as data, which must be in the layout of the node. The rest are parameters such as
+// filters and per channel vectors, read as they are.
+std::vector<int> data_inputs(const NodeParam &node)
+{
+	if (node.has_conv_2d_param() || node.has_bias_add_param() || node.has_batch_normalization_param())
+		return { 0 };
+	std::vector<int> inputs;
+	for (int i = 0; i < node.input_size(); ++i)
+		inputs.push_back(i);
+	return inputs;
+}
+
+// Kahn order, nodes on a cycle are left out.
+std::vector<NodeParam*> topological_order(deepflow::BlockParam *block, const std::map<std::string, NodeParam*> &producer)
+{
+	std::map<NodeParam*, int> pending;
+	std::map<NodeParam*, std::vector<NodeParam*>> dependents;
+	std::vector<NodeParam*> order;
+	for (auto &node : *block->mutable_node()) {
+		std::set<NodeParam*> inputs;
+		for (auto &input : node.input()) {
+			auto it = producer.find(input);
+			if (it != producer.end() && inputs.insert(it->second).second)
+				dependents[it->second].push_back(&node);
+		}
+		pending[&node] = inputs.size();
+		if (inputs.empty())
+			order.push_back(&node);
+	}
+	for (size_t i = 0; i < order.size(); ++i)
+		for (auto dependent : dependents[order[i]])
+			if (--pending[dependent] == 0)
+				order.push_back(dependent);
+	return order;
+}
+
+// NCHW16C for a convolution whose filter variable has a multiple of 16 filters, NHWC otherwise.
+NodeParam::Layout conv_layout(const NodeParam &node, NodeParam::Layout preferred, const std::map<std::string, NodeParam*> &producer)
+{
+	if (preferred != NCHW16C)
+		return preferred;
+	auto filter = node.input_size() > 1 ? producer.find(node.input(1)) : producer.end();
+	if (filter == producer.end() || !filter->second->has_variable_param())
+		return NHWC;
+	auto &dims = filter->second->variable_param().init_param().tensor_param().dims();
+	return dims.size() == 4 && dims.Get(0) % CpuLayout::kBlock == 0 ? NCHW16C : NHWC;
+}
+
+// The layout a follower takes given the layouts of its data inputs, NCHW when it cannot follow them.
+NodeParam::Layout follower_layout(const NodeParam &node, const std::vector<NodeParam::Layout> &inputs)
+{
+	if (inputs.empty() || inputs[0] == NCHW)
+		return NCHW;
+	const NodeParam::Layout first = inputs[0];
+	bool same = true;
+	for (auto layout : inputs)
+		same = same && layout == first;
+	if (unary_pointwise(node) || node.has_bias_add_param())
+		return first;
+	if (node.has_batch_normalization_param())
+		return node.batch_normalization_param().mode() == deepflow::BatchNormalizationParam_Mode_CUDNN_BATCHNORM_SPATIAL ? first : NCHW;
+	// Elementwise with inputs that may only agree in size, so only when they agree in layout too.
+	if (node.has_add_param())
+		return same ? first : NCHW;
+	// Blocked channels need every input to be blocked, any channel count concatenates in NHWC.
+	if (node.has_concate_param())
+		return same ? first : NHWC;
+	if (node.has_patching_param()) {
+		auto mode = node.patching_param().mode();
+		bool samples = mode == deepflow::PatchingParam_Mode_DOWNSAMPLES || mode == deepflow::PatchingParam_Mode_UPSAMPLES;
+		return samples ? first : NHWC;
+	}
+	if (node.has_restructure_param()) {
+		bool channels = node.restructure_param().first_dim() == 1 || node.restructure_param().second_dim() == 1;
+		return channels ? NHWC : first;
+	}
+	return NCHW;
+}
+
+const char *layout_suffix(NodeParam::Layout layout)
+{
+	switch (layout) {
+	case NHWC:
+		return "nhwc";
+	case NCHW16C:
+		return "nchw16c";
+	default:
+		return "nchw";
+	}
+}
+
+}
+
+GraphLayout::Report GraphLayout::run(deepflow::BlockParam *block, NodeParam::Layout preferred)
+{
+	Report report;
+	if (preferred == NCHW)
+		return report;
+	std::map<std::string, NodeParam*> producer;
+	std::map<std::string, int> consumers;
+	for (auto &node : *block->mutable_node()) {
+		for (auto &output : node.output())
+			producer[output] = &node;
+		for (auto &input : node.input())
+			if (!input.empty())
+				++consumers[input];
+	}
+
+	auto layout_of = [&](const std::string &output) {
+		auto it = producer.find(output);
+		return it == producer.end() ? NCHW : it->second->layout();
+	};
+	for (auto node : topological_order(block, producer)) {
+		NodeParam::Layout layout = NCHW;
+		bool read = false;
+		for (auto &output : node->output())
+			read = read || consumers[output] > 0;
+		if (node->data_policy() == NodeParam::CPU_ONLY_POLICY && read && node->output_size() == 1) {
+			if (node->has_conv_2d_param())
+				layout = conv_layout(*node, preferred, producer);
+			else {
+				std::vector<NodeParam::Layout> inputs;
+				for (int i : data_inputs(*node))
+					inputs.push_back(layout_of(node->input(i)));
+				layout = follower_layout(*node, inputs);
+			}
+		}
+		node->set_layout(layout);
+		if (layout == NHWC)
+			report.nhwc++;
+		else if (layout == NCHW16C)
+			report.nchw16c++;
+	}
+
+	// Reorders go where a data input disagrees with its reader, convolutions read any layout.
+	std::map<std::pair<std::string, int>, std::string> reorders;
+	std::vector<NodeParam> added;
+	for (auto &node : *block->mutable_node()) {
+		if (node.has_conv_2d_param())
+			continue;
+		for (int i : data_inputs(node)) {
+			const std::string input = node.input(i);
+			const NodeParam::Layout from = layout_of(input);
+			if (input.empty() || from == node.layout())
+				continue;
+			auto key = std::make_pair(input, (int)node.layout());
+			auto it = reorders.find(key);
+			if (it == reorders.end()) {
+				NodeParam reorder;
+				reorder.set_name(input + "_to_" + layout_suffix(node.layout()));
+				reorder.set_scope(node.scope());
+				reorder.add_input(input);
+				reorder.add_output(reorder.name() + "_output_0");
+				reorder.set_data_policy(NodeParam::CPU_ONLY_POLICY);
+				reorder.set_layout(node.layout());
+				reorder.mutable_reorder_param();
+				it = reorders.insert({ key, reorder.output(0) }).first;
+				added.push_back(reorder);
+				report.reorders++;
+			}
+			node.set_input(i, it->second);
+		}
+	}
+	for (auto &reorder : added)
+		block->add_node()->Swap(&reorder);
+	return report;
+}
@@ -0,0 +1,277 @@
+#include "core/graph_simplifier.h"
+
+#include <glog/logging.h>
+
+#include <map>
+#include <set>
+
+typedef deepflow::NodeParam NodeParam;
+
+namespace {
+
+// Ops whose outputs depend on nothing but their parameters and inputs, whatever the execution mode.
+const std::set<std::string> kPureOps = {
+	"add_param", "bias_add_param", "conv_2d_param", "transposed_conv_2d_param", "leaky_relu_param", "softmax_param",
+	"square_param", "matmul_param", "pooling_param", "reduce_param", "equal_param", "activation_param",
+	"restructure_param", "dot_param", "square_error_param", "log_param", "exp_param", "lifting_param",
+	"patching_param", "abs_param", "reduce_all_param", "resize_param", "lrn_param", "prelu_param", "concate_param",
+	"reshape_param", "dprelu_param", "batch_stddev_param", "pass_through_param", "max_param",
+	"spatial_transformer_param", "nand_param", "gaussian_kernel_param", "gabor_kernel_param", "softmax_cross_entropy_param",
+	"fused_elementwise_param", "slice_param"
+};
+
+// The op parameter of node, the highest numbered one for nodes that extend another op.
+std::string op_field(const NodeParam &node)
+{
+	std::vector<const google::protobuf::FieldDescriptor*> fields;
+	node.GetReflection()->ListFields(node, &fields);
+	std::string op;
+	for (auto field : fields)
+		if (field->number() >= NodeParam::kVariableParamFieldNumber)
+			op = field->name();
+	return op;
+}
+
+bool pure(const NodeParam &node)
+{
+	return kPureOps.count(op_field(node)) > 0;
+}
+
+// A solver-less variable whose values are stored or drawn by a deterministic initializer.
+bool constant_variable(const NodeParam &node)
+{
+	if (op_field(node) != "variable_param" || !node.variable_param().solver_name().empty())
+		return false;
+	auto &param = node.variable_param();
+	auto &init = param.init_param();
+	return param.has_weights() || init.has_init_data() || init.has_fill_param() || init.has_index_fill_param() || init.has_step_param() || init.has_gradient_fill_param() || init.has_constant_param();
+}
+
+// Kahn order of the nodes not yet removed, nodes on a cycle are left out.
+std::vector<NodeParam*> topological_order(deepflow::BlockParam *block, const std::set<NodeParam*> &removed)
+{
+	std::map<std::string, NodeParam*> producer;
+	for (auto &node : *block->mutable_node())
+		if (!removed.count(&node))
+			for (auto &output : node.output())
+				producer[output] = &node;
+	std::map<NodeParam*, int> pending;
+	std::map<NodeParam*, std::vector<NodeParam*>> dependents;
+	std::vector<NodeParam*> order;
+	for (auto &node : *block->mutable_node()) {
+		if (removed.count(&node))
+			continue;
+		std::set<NodeParam*> inputs;
+		for (auto &input : node.input()) {
+			auto it = producer.find(input);
+			if (it != producer.end() && inputs.insert(it->second).second)
+				dependents[it->second].push_back(&node);
+		}
+		pending[&node] = inputs.size();
+		if (inputs.empty())
+			order.push_back(&node);
+	}
+	for (size_t i = 0; i < order.size(); ++i)
+		for (auto dependent : dependents[order[i]])
+			if (--pending[dependent] == 0)
+				order.push_back(dependent);
+	return order;
+}
+
+// Readers of every output among the nodes not yet removed.
+std::map<std::string, int> consumer_counts(deepflow::BlockParam *block, const std::set<NodeParam*> &removed)
+{
+	std::map<std::string, int> counts;
+	for (auto &node : *block->mutable_node())
+		if (!removed.count(&node))
+			for (auto &input : node.input())
+				if (!input.empty())
+					++counts[input];
+	return counts;
+}
+
+void deduplicate(deepflow::BlockParam *block, const std::set<std::string> &fetches, std::set<NodeParam*> &removed, GraphSimplifier::Report &report)
+{
+	std::map<std::string, NodeParam*> first;
+	for (auto node : topological_order(block, removed)) {
+		if (!pure(*node) && !constant_variable(*node))
+			continue;
+		// Inputs of later nodes are rewired as duplicates go, so their keys see the kept producers.
+		NodeParam key(*node);
+		key.clear_name();
+		key.clear_scope();
+		key.clear_output();
+		if (key.has_variable_param())
+			key.mutable_variable_param()->mutable_init_param()->clear_name();
+		auto kept = first.insert({ key.SerializeAsString(), node });
+		if (kept.second || fetches.count(node->name()))
+			continue;
+		for (auto &other : *block->mutable_node())
+			for (auto &input : *other.mutable_input())
+				for (int i = 0; i < node->output_size(); ++i)
+					if (input == node->output(i))
+						input = kept.first->second->output(i);
+		removed.insert(node);
+		report.deduplicated++;
+	}
+}
+
+void fold_constants(deepflow::BlockParam *block, const std::set<std::string> &fetches, std::set<NodeParam*> &removed, const GraphSimplifier::Evaluator &evaluate, GraphSimplifier::Report &report)
+{
+	auto order = topological_order(block, removed);
+	std::map<std::string, NodeParam*> producer;
+	std::set<NodeParam*> constant;
+	for (auto node : order) {
+		bool is_constant = constant_variable(*node);
+		// Pure generators without inputs, such as the gaussian and gabor kernels, are constant as they are.
+		if (!is_constant && pure(*node) && node->output_size() == 1) {
+			is_constant = true;
+			for (auto &input : node->input()) {
+				auto it = producer.find(input);
+				is_constant = is_constant && it != producer.end() && constant.count(it->second);
+			}
+		}
+		if (is_constant)
+			constant.insert(node);
+		for (auto &output : node->output())
+			producer[output] = node;
+	}
+
+	// A computed constant is folded where the constant subgraph ends: read by nothing, or by a node
+	// that is not constant.
+	std::map<std::string, bool> read_by_constant_only;
+	for (auto node : order)
+		for (auto &input : node->input())
+			read_by_constant_only.insert({ input, true }).first->second &= constant.count(node) > 0;
+	std::vector<NodeParam*> targets;
+	std::vector<std::string> names;
+	for (auto node : order) {
+		if (!constant.count(node) || node->has_variable_param())
+			continue;
+		auto read = read_by_constant_only.find(node->output(0));
+		if (read == read_by_constant_only.end() || !read->second || fetches.count(node->name())) {
+			targets.push_back(node);
+			names.push_back(node->name());
+		}
+	}
+	if (targets.empty())
+		return;
+
+	deepflow::BlockParam constants;
+	for (auto node : order)
+		if (constant.count(node))
+			constants.add_node()->CopyFrom(*node);
+	std::vector<GraphSimplifier::Constant> values;
+	evaluate(constants, names, &values);
+	LOG_IF(FATAL, values.size() != targets.size()) << "Evaluated " << values.size() << " constants of " << targets.size();
+	auto counts_before = consumer_counts(block, removed);
+
+	for (size_t i = 0; i < targets.size(); ++i) {
+		auto target = targets[i];
+		NodeParam var;
+		var.set_name(target->name());
+		var.set_scope(target->scope());
+		var.add_output(target->output(0));
+		var.set_data_policy(target->data_policy());
+		auto init_param = var.mutable_variable_param()->mutable_init_param();
+		init_param->set_name(target->name());
+		auto tensor_param = init_param->mutable_tensor_param();
+		for (auto dim : values[i].dims)
+			tensor_param->add_dims(dim);
+		tensor_param->set_type(deepflow::TensorParam_TensorType_FLOAT);
+		init_param->mutable_fill_param();
+		auto weights = var.mutable_variable_param()->mutable_weights()->mutable_data();
+		weights->Add(values[i].data.begin(), values[i].data.end());
+		target->Swap(&var);
+		report.folded++;
+		report.constant_bytes += values[i].data.size() * sizeof(float);
+	}
+
+	// Constants that fed only folded nodes are read by nothing now, readers go before what they read.
+	auto counts = consumer_counts(block, removed);
+	std::set<NodeParam*> folded(targets.begin(), targets.end());
+	for (auto node = order.rbegin(); node != order.rend(); ++node) {
+		if (!constant.count(*node) || folded.count(*node) || fetches.count((*node)->name()))
+			continue;
+		bool read = false, was_read = false;
+		for (auto &output : (*node)->output()) {
+			read = read || counts[output] > 0;
+			was_read = was_read || counts_before[output] > 0;
+		}
+		if (read || !was_read)
+			continue;
+		removed.insert(*node);
+		for (auto &input : (*node)->input())
+			--counts[input];
+	}
+}
+
+void eliminate_dead_nodes(deepflow::BlockParam *block, const std::set<std::string> &fetches, std::set<NodeParam*> &removed, GraphSimplifier::Report &report)
+{
+	std::map<std::string, NodeParam*> producer;
+	for (auto &node : *block->mutable_node())
+		if (!removed.count(&node))
+			for (auto &output : node.output())
+				producer[output] = &node;
+	auto counts = consumer_counts(block, removed);
+	std::vector<NodeParam*> stack;
+	for (auto &node : *block->mutable_node()) {
+		if (removed.count(&node))
+			continue;
+		// Trained variables and the losses their solvers minimise stay whatever is fetched.
+		bool root = node.has_loss_param() || node.has_softmax_cross_entropy_param() || (node.has_variable_param() && !node.variable_param().solver_name().empty());
+		if (fetches.empty()) {
+			// Without fetches every sink is wanted, which keeps every node that is not on a cycle.
+			bool read = false;
+			for (auto &output : node.output())
+				read = read || counts[output] > 0;
+			root = root || node.output_size() == 0 || !read;
+		}
+		else
+			root = root || fetches.count(node.name());
+		if (root)
+			stack.push_back(&node);
+	}
+	std::set<NodeParam*> live;
+	while (!stack.empty()) {
+		auto node = stack.back();
+		stack.pop_back();
+		if (!live.insert(node).second)
+			continue;
+		for (auto &input : node->input()) {
+			auto it = producer.find(input);
+			if (it != producer.end())
+				stack.push_back(it->second);
+		}
+	}
+	for (auto &node : *block->mutable_node()) {
+		if (removed.count(&node) || live.count(&node))
+			continue;
+		removed.insert(&node);
+		report.dead++;
+	}
+}
+
+}
+
+GraphSimplifier::Report GraphSimplifier::run(deepflow::BlockParam *block, const std::list<std::string> &fetches, const Evaluator &evaluate)
+{
+	std::set<std::string> fetch_names(fetches.begin(), fetches.end());
+	for (auto &fetch : fetch_names) {
+		bool found = false;
+		for (auto &node : block->node())
+			found = found || node.name() == fetch;
+		LOG_IF(FATAL, !found) << "Node " << fetch << " does not exist.";
+	}
+	Report report;
+	std::set<NodeParam*> removed;
+	deduplicate(block, fetch_names, removed, report);
+	fold_constants(block, fetch_names, removed, evaluate, report);
+	eliminate_dead_nodes(block, fetch_names, removed, report);
+	google::protobuf::RepeatedPtrField<NodeParam> kept;
+	for (auto &node : *block->mutable_node())
+		if (!removed.count(&node))
+			kept.Add()->Swap(&node);
+	block->mutable_node()->Swap(&kept);
+	return report;
+}
@@ -40,12 +40,18 @@ void Node::write_values(std::shared_ptr<Tensor> tensor, float alpha, float beta)
 	auto feed_dim = tensor->dims();
 	auto my_dim = _outputs[0]->value()->dims();
 	LOG_IF(FATAL, feed_dim != my_dim) << _name << " Forward feed dimension mismatch between dst (" << _outputs[0]->value()->name()  << " - " << _outputs[0]->value()->shape() << ") and src (" << tensor->name()  << " - " << tensor->shape() << ")";
+	_outputs[0]->bump_version();
+	if (is_cpu()) {
+		cpy(_outputs[0]->value()->size(), alpha, tensor->to_vec()->data(), beta, _outputs[0]->value()->cpu_data());
+		return;
+	}
 	cpy(_outputs[0]->value()->size(), alpha, tensor->gpu_data(), beta, _outputs[0]->value()->gpu_data());
 }
 
 void Node::write_values(std::initializer_list<float> values)
 {
 	_outputs[0]->value()->set(values);
+	_outputs[0]->bump_version();
 }
 
 void Node::write_diffs(std::shared_ptr<Tensor> tensor, float alpha, float beta)
@@ -54,6 +60,10 @@ void Node::write_diffs(std::shared_ptr<Tensor> tensor, float alpha, float beta)
 	auto feed_dim = tensor->dims();
 	auto my_dim = _outputs[0]->diff()->dims();
 	LOG_IF(FATAL, feed_dim != my_dim) << _name << " Backward feed dimension mismatch between dst (" << _outputs[0]->diff()->name() << " - " << _outputs[0]->diff()->shape() << ") and src (" << tensor->name() << " - " << tensor->shape() << ")";
+	if (is_cpu()) {
+		cpy(_outputs[0]->diff()->size(), alpha, tensor->to_vec()->data(), beta, _outputs[0]->diff()->cpu_data());
+		return;
+	}
 	cpy(_outputs[0]->diff()->size(), alpha, tensor->gpu_data(), beta, _outputs[0]->diff()->gpu_data());
 }
 
@@ -91,6 +101,48 @@ std::string Node::_input_name_for_cpp(int i) const
 	return name;
 }
 
+std::string Node::_pointwise_cpp(const std::vector<deepflow::PointwiseStage> &stages, std::string input) const
+{
+	std::vector<deepflow::PointwiseStage> ops;
+	for (auto &stage : stages)
+		if (stage.op() != deepflow::PointwiseStage_Op_IDENTITY)
+			ops.push_back(stage);
+	if (ops.empty())
+		return "auto " + _name + " = " + input + ";";
+	std::string cpp;
+	for (size_t i = 0; i < ops.size(); ++i) {
+		std::string name = i + 1 == ops.size() ? _name : _name + "_" + std::to_string(i);
+		std::string coef = std::to_string(ops[i].coef()) + ", ";
+		std::string call;
+		switch (ops[i].op()) {
+		case deepflow::PointwiseStage_Op_SIGMOID: call = "sigmoid(" + input + ", "; break;
+		case deepflow::PointwiseStage_Op_RELU: call = "relu(" + input + ", "; break;
+		case deepflow::PointwiseStage_Op_TANH: call = "tanh(" + input + ", "; break;
+		case deepflow::PointwiseStage_Op_CLIPPED_RELU: call = "clipped_relu(" + input + ", " + coef; break;
+		case deepflow::PointwiseStage_Op_ELU: call = "elu(" + input + ", " + coef; break;
+		case deepflow::PointwiseStage_Op_LEAKY_RELU: call = "leaky_relu(" + input + ", " + coef; break;
+		case deepflow::PointwiseStage_Op_EXP: call = "exp(" + input + ", "; break;
+		case deepflow::PointwiseStage_Op_LOG: call = "log(" + input + ", " + coef; break;
+		case deepflow::PointwiseStage_Op_ABS: call = "abs(" + input + ", "; break;
+		case deepflow::PointwiseStage_Op_SQUARE: call = "square(" + input + ", "; break;
+		default: LOG(FATAL) << _name << " - unsupported pointwise stage " << ops[i].op();
+		}
+		cpp += (i > 0 ? "\n" : "") + std::string("auto ") + name + " = df." + call + "\"" + name + "\");";
+		input = name;
+	}
+	return cpp;
+}
+
+std::string Node::_epilogue_cpp(const deepflow::EpilogueParam &epilogue, const std::string &input) const
+{
+	std::string cpp, output = input;
+	if (epilogue.bias()) {
+		output = _name + "_bias";
+		cpp += "auto " + output + " = df.bias_add(" + input + ", " + _input_name_for_cpp(2) + ", \"" + output + "\");\n";
+	}
+	return cpp + _pointwise_cpp({ epilogue.activation() }, output);
+}
+
 std::vector<NodeInputPtr> & Node::inputs() {
 	return _inputs;
 }
@@ -115,6 +167,22 @@ void Node::setInitialized(bool status) {
 	_initialized = status;
 }
 
+bool Node::isFrozen() const {
+	return _frozen;
+}
+
+void Node::setFrozen(bool status) {
+	_frozen = status;
+}
+
+bool Node::needsBackward() const {
+	return _needs_backward;
+}
+
+void Node::setNeedsBackward(bool status) {
+	_needs_backward = status;
+}
+
 deepflow::NodeParam *Node::param() {
 	return _param;
 }
@@ -159,16 +227,45 @@ Tensor::DataPolicy Node::policy() const
 	return (Tensor::DataPolicy) _param->data_policy();	
 }
 
+bool Node::is_cpu() const
+{
+	return policy() == Tensor::CPU_ONLY_POLICY;
+}
+
+ExecutionContext::MathAccuracy Node::math_accuracy() const
+{
+	return _context ? _context->math_accuracy : ExecutionContext::MATH_ACCURATE;
+}
+
 void Node::_forward()
 {
+	// Frozen graphs share one arena between outputs, memoized values would be overwritten.
+	bool memoize = _context && _context->step != 0 && !_frozen && is_memoizable();
+	std::vector<uint64_t> versions;
+	if (memoize) {
+		for (auto input : _inputs)
+			versions.push_back(input->version());
+		if (_memo_step == _context->step && versions == _memo_versions) {
+			LOG_IF(INFO, _verbose > 2) << "MEMO -> " << _name;
+			return;
+		}
+	}
 	forward();
 	for (auto input : _inputs) {		
 		input->value()->offload_data();
 	}
+	for (auto output : _outputs)
+		output->bump_version();
+	_memo_step = memoize ? _context->step : 0;
+	_memo_versions.swap(versions);
 }
 
 void Node::_backward()
 {
+	if (!_needs_backward) {
+		LOG_IF(INFO, _verbose > 2) << "SKIP -> " << _name;
+		return;
+	}
 	backward();
 	for (auto output : _outputs) {
 		output->value()->offload_data();
@@ -1,5 +1,7 @@
 #include "core/node.h"
 #include "core/common_cu.h"
+#include "core/cpu_elementwise.h"
+#include "core/pointwise_cu.h"
 
 __global__
 void CpyAddKernelWithBeta(const int n, const float alpha, const float *src, const float beta, float *dst)
@@ -27,7 +29,13 @@ void DotKernel(const int n, const float alpha, const float *a, const float *b, c
 
 void Node::cpy(int n, const float alpha, const void * src, const float beta, void * dst)
 {
-	if (alpha == 1 && beta == 0) {
+	if (is_cpu()) {
+		if (alpha == 1 && beta == 0)
+			memcpy(dst, src, n * sizeof(float));
+		else
+			CpuElementwise::axpby(n, alpha, (const float*)src, beta, (float*)dst);
+	}
+	else if (alpha == 1 && beta == 0) {
 		DF_NODE_CUDA_CHECK(cudaMemcpy(dst, src, n * sizeof(float), cudaMemcpyDeviceToDevice));
 	}
 	else if (beta == 0) {
@@ -42,6 +50,10 @@ void Node::cpy(int n, const float alpha, const void * src, const float beta, voi
 
 void Node::dot(const int n, const float alpha, const void *a, const void *b, const float beta, void *dst)
 {
+	if (is_cpu()) {
+		CpuElementwise::dot(n, alpha, (const float*)a, (const float*)b, beta, (float*)dst);
+		return;
+	}
 	DotKernel << < numOfBlocks(n), maxThreadsPerBlock >> > (n, alpha, (float*)a, (float*)b, beta, (float*)dst);
 	DF_KERNEL_CHECK();
 }
@@ -55,13 +67,98 @@ void NodeFillKernel(const int n, const float value, const float beta, float *dst
 }
 void Node::fill(int n, const float value, void * dst, const float beta)
 {
+	if (is_cpu()) {
+		float *y = (float*)dst;
+		for (int i = 0; i < n; ++i)
+			y[i] = beta * y[i] + value;
+		return;
+	}
 	NodeFillKernel << < numOfBlocks(n), maxThreadsPerBlock, 0>> > (n, value, beta, (float*) dst);
 	DF_KERNEL_CHECK();
 }
 
 void Node::fill(const float value)
 {
-	fill(_outputs[0]->value()->size(), value, _outputs[0]->value()->gpu_data(), 0.0f);	
+	auto output = _outputs[0]->value();
+	fill(output->size(), value, is_cpu() ? output->cpu_data() : output->gpu_data(), 0.0f);	
+}
+
+__global__
+void EpilogueForwardKernel(const int n, const int channels, const int inner, const int op, const float coef, const float *bias, float *y)
+{
+	int i = blockIdx.x*blockDim.x + threadIdx.x;
+	if (i < n) {
+		float v = y[i];
+		if (bias)
+			v += bias[(i / inner) % channels];
+		y[i] = pointwise_forward(op, coef, v);
+	}
+}
+
+// The epilogue activations keep the sign of x in y, so y stands in for x.
+__global__
+void EpilogueBackwardKernel(const int n, const int op, const float coef, const float *y, float *dy)
+{
+	int i = blockIdx.x*blockDim.x + threadIdx.x;
+	if (i < n)
+		dy[i] = pointwise_backward(op, coef, y[i], y[i], dy[i]);
+}
+
+#define DF_EPILOGUE_BIAS_THREADS 256
+
+// One block per channel, every thread strides over the outer and inner dims then the block reduces in shared memory.
+__global__
+void EpilogueBiasKernel(const int outer, const int channels, const int inner, const float *dy, float *dbias)
+{
+	__shared__ float partial[DF_EPILOGUE_BIAS_THREADS];
+	const int c = blockIdx.x;
+	const int count = outer * inner;
+	float sum = 0;
+	for (int j = threadIdx.x; j < count; j += blockDim.x)
+		sum += dy[((j / inner) * channels + c) * inner + j % inner];
+	partial[threadIdx.x] = sum;
+	__syncthreads();
+	for (int s = blockDim.x / 2; s > 0; s >>= 1) {
+		if (threadIdx.x < s)
+			partial[threadIdx.x] += partial[threadIdx.x + s];
+		__syncthreads();
+	}
+	if (threadIdx.x == 0)
+		dbias[c] = partial[0];
+}
+
+void Node::epilogue_forward(const deepflow::EpilogueParam &epilogue, int outer, int channels, int inner, const float *bias, float *y, int block)
+{
+	const int op = epilogue.activation().op();
+	const float coef = epilogue.activation().coef();
+	if (is_cpu()) {
+		CpuElementwise::epilogue_forward(math_accuracy(), (CpuElementwise::PointwiseOp) op, coef, outer, channels, inner, bias, y, block);
+		return;
+	}
+	const int n = outer * channels * inner;
+	EpilogueForwardKernel << < numOfBlocks(n), maxThreadsPerBlock >> > (n, channels, inner, op, coef, bias, y);
+	DF_KERNEL_CHECK();
+}
+
+void Node::epilogue_backward(const deepflow::EpilogueParam &epilogue, int outer, int channels, int inner, const float *y, float *dy, float *dbias, int block)
+{
+	const int op = epilogue.activation().op();
+	const float coef = epilogue.activation().coef();
+	const int n = outer * channels * inner;
+	if (is_cpu()) {
+		CpuElementwise::epilogue_backward((CpuElementwise::PointwiseOp) op, coef, n, y, dy);
+		if (dbias)
+			CpuElementwise::bias_add_backward(outer, channels, inner, dy, dbias, block);
+		return;
+	}
+	if (op != deepflow::PointwiseStage_Op_IDENTITY) {
+		EpilogueBackwardKernel << < numOfBlocks(n), maxThreadsPerBlock >> > (n, op, coef, y, dy);
+		DF_KERNEL_CHECK();
+	}
+	if (dbias) {
+		EpilogueBiasKernel << < channels, DF_EPILOGUE_BIAS_THREADS >> > (outer, channels, inner, dy, dbias);
+		DF_KERNEL_CHECK();
+	}
 }
 
 
@@ -1,4 +1,6 @@
 #include "core/session.h"
+#include "core/aot_compiler.h"
+#include "core/shared_weights.h"
 
 #include "nodes/variable.h"
 #include "nodes/place_holder.h"
@@ -24,6 +26,7 @@
 #include "nodes/matmul.h"
 #include "nodes/leaky_relu.h"
 #include "nodes/softmax.h"
+#include "nodes/softmax_cross_entropy.h"
 #include "nodes/exp.h"
 #include "nodes/abs.h"
 #include "nodes/square.h"
@@ -70,6 +73,9 @@
 #include "nodes/gaussian.h"
 #include "nodes/gaussian_kernel.h"
 #include "nodes/patch_sampling.h"
+#include "nodes/fused_elementwise.h"
+#include "nodes/reorder.h"
+#include "nodes/slice.h"
 #include "nodes/max.h"
 #include "nodes/nand.h"
 #include "nodes/spatial_transformer.h"
@@ -82,6 +88,7 @@
 
 #include <unordered_map>
 #include <map>
+#include <set>
 
 #include<memory>
 
@@ -93,6 +100,18 @@
 
 #include <ctime>
 
+#include <functional>
+
+#include <climits>
+
+#include <thread>
+
+#include <mutex>
+
+#include <condition_variable>
+
+#include <algorithm>
+
 std::shared_ptr<Initializer> _create_initializer(deepflow::InitParam *init_param) {
 	
 	if (init_param->has_fill_param()) {
@@ -192,6 +211,8 @@ std::shared_ptr<Node> Session::_create_node(deepflow::NodeParam *node_param) {
 		return std::make_shared<PRelu>(node_param);
 	else if (node_param->has_softmax_param())
 		return std::make_shared<Softmax>(node_param);
+	else if (node_param->has_softmax_cross_entropy_param())
+		return std::make_shared<SoftmaxCrossEntropy>(node_param);
 	else if (node_param->has_dropout_param())
 		return std::make_shared<Dropout>(node_param);
 	else if (node_param->has_image_writer_param())
@@ -220,6 +241,8 @@ std::shared_ptr<Node> Session::_create_node(deepflow::NodeParam *node_param) {
 		return std::make_shared<Square>(node_param);
 	else if (node_param->has_restructure_param())
 		return std::make_shared<Restructure>(node_param);
+	else if (node_param->has_slice_param())
+		return std::make_shared<Slice>(node_param);
 	else if (node_param->has_psnr_param())
 		return std::make_shared<Psnr>(node_param);
 	else if (node_param->has_random_selector_param())
@@ -256,6 +279,10 @@ std::shared_ptr<Node> Session::_create_node(deepflow::NodeParam *node_param) {
 		return std::make_shared<SpatialTransformer>(node_param);
 	else if (node_param->has_gabor_kernel_param())
 		return std::make_shared<GaborKernel>(node_param);
+	else if (node_param->has_fused_elementwise_param())
+		return std::make_shared<FusedElementwise>(node_param);
+	else if (node_param->has_reorder_param())
+		return std::make_shared<Reorder>(node_param);
 	else {
 		LOG(FATAL) << "Unsupported Node";
 	}
@@ -343,10 +370,52 @@ void Session::create_nodes()
 	_created = true;
 }
 
-void Session::initialize(std::shared_ptr<ExecutionContext> execution_context) {
+void Session::simplify(std::list<std::string> fetches, std::shared_ptr<ExecutionContext> execution_context)
+{
+	LOG_IF(FATAL, _created) << "The graph must be simplified before its nodes are created.";
+	// Constants are computed by a session of their own, created, run once and dropped.
+	auto evaluate = [&](const deepflow::BlockParam &constants, const std::vector<std::string> &names, std::vector<GraphSimplifier::Constant> *values) {
+		auto block = std::make_shared<Block>();
+		block->block_param()->CopyFrom(constants);
+		Session session(block);
+		auto context = std::make_shared<ExecutionContext>();
+		if (execution_context) {
+			context->execution_mode = execution_context->execution_mode;
+			context->math_accuracy = execution_context->math_accuracy;
+			context->debug_level = execution_context->debug_level;
+		}
+		session.initialize(context);
+		std::list<std::shared_ptr<Node>> nodes;
+		for (auto &name : names)
+			nodes.push_back(session.get_node(name));
+		session.forward(nodes);
+		for (auto node : nodes)
+			values->push_back({ node->output(0)->value()->dims(), *node->output(0)->value()->to_vec() });
+	};
+	_simplifier_report = GraphSimplifier::run(_block->block_param(), fetches, evaluate);
+	LOG(INFO) << "graph simplification | " << _simplifier_report.deduplicated << " deduplicated | " << _simplifier_report.folded << " folded | " << _simplifier_report.dead << " dead | " << _simplifier_report.constant_bytes / 1048576.0f << " MB of constants";
+}
+
+void Session::initialize(std::shared_ptr<ExecutionContext> execution_context, bool init_report) {
 	if (_initialized == true)
 		return;
 	
+	if (_created == false && execution_context && execution_context->simplify_graph)
+		simplify({}, execution_context);
+
+	bool fused = false;
+	if (_created == false && execution_context && execution_context->fuse_graph) {
+		// Mapped variables keep their stored values, so only weights this session owns are rewritten.
+		bool inference = execution_context->execution_mode == ExecutionContext::TEST && !_shared_weights;
+		_fusion_report = GraphFusion::run(_block->block_param(), inference);
+		fused = true;
+	}
+
+	if (_created == false && execution_context && execution_context->cpu_layout != ExecutionContext::NCHW) {
+		_layout_report = GraphLayout::run(_block->block_param(), (deepflow::NodeParam::Layout) execution_context->cpu_layout);
+		LOG(INFO) << "graph layout | " << _layout_report.nhwc << " NHWC | " << _layout_report.nchw16c << " NCHW16C | " << _layout_report.reorders << " reorders";
+	}
+
 	if (_created == false)
 		create_nodes();
 
@@ -359,30 +428,58 @@ void Session::initialize(std::shared_ptr<ExecutionContext> execution_context) {
 
 	_initialized = true;	
 
-	size_t free_byte_before, free_byte_after;
-	size_t total_byte;	
+	_map_variables();
+
 	std::srand(std::time(0));
-	std::list<std::shared_ptr<Node>> queue = _nodes;
-	while (!queue.empty()) {
-		auto node = queue.front();
-		queue.pop_front();
-		if (node->isInitialized())
-			continue;
-		bool resolved = true;
+
+	// Topological initialization: a node becomes ready once every node feeding it is initialized,
+	// ready nodes are initialized concurrently by a pool of workers.
+	std::map<Node*, int> pending_inputs;
+	std::map<Node*, std::list<std::shared_ptr<Node>>> dependents;
+	std::list<std::shared_ptr<Node>> ready;
+	for (auto node : _nodes) {
+		std::set<Node*> input_nodes;
 		for (auto input : node->inputs()) {
 			auto connectedNode = input->connectedNode();
-			if (connectedNode) {
-				if (connectedNode->isInitialized() == false) {
-					resolved = false;
-					break;
-				}
-			}
+			if (connectedNode && input_nodes.insert(connectedNode.get()).second)
+				dependents[connectedNode.get()].push_back(node);
 		}
-		if (resolved) {
-			mem_usage(&free_byte_before, &total_byte, 0);
-			node->init();						
+		pending_inputs[node.get()] = input_nodes.size();
+		if (input_nodes.empty())
+			ready.push_back(node);
+	}
+
+	struct InitRecord {
+		std::shared_ptr<Node> node;
+		double ms;
+		size_t bytes;
+	};
+	std::vector<InitRecord> records;
+	std::mutex mutex;
+	std::condition_variable condition;
+	int remaining = _nodes.size();
+	int running = 0;
+	int device = 0;
+	cudaGetDevice(&device);
+	auto worker = [&]() {
+		cudaSetDevice(device);
+		std::unique_lock<std::mutex> lock(mutex);
+		while (true) {
+			// Nothing ready and nothing running means either done or a cycle.
+			condition.wait(lock, [&]() { return !ready.empty() || remaining == 0 || running == 0; });
+			if (ready.empty())
+				return;
+			auto node = ready.front();
+			ready.pop_front();
+			++running;
+			lock.unlock();
+
+			size_t bytes_before = Tensor::allocated_by_thread();
+			auto start = std::chrono::high_resolution_clock::now();
+			node->init();
 			LOG_IF(FATAL, cudaPeekAtLastError() != 0) << "[FAILED] " << node->name() << " | " << cudaGetErrorString(cudaPeekAtLastError());
-			mem_usage(&free_byte_after, &total_byte, 0);
+			double ms = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+			size_t bytes = Tensor::allocated_by_thread() - bytes_before;
 			std::string shape;
 			int n_outputs = node->outputs().size();
 			if (n_outputs > 0) {
@@ -391,13 +488,54 @@ void Session::initialize(std::shared_ptr<ExecutionContext> execution_context) {
 					shape += "," + node->output(i)->value()->shape();
 				}
 			}
-			float used_memory = (10e-6f * (free_byte_before - free_byte_after)); // MB
 			LOG(INFO) << node->op_name() << " " << node->name() << " | " << shape;
+
+			lock.lock();
+			--running;
 			node->setInitialized(true);
+			records.push_back({ node, ms, bytes });
+			for (auto dependent : dependents[node.get()])
+				if (--pending_inputs[dependent.get()] == 0)
+					ready.push_back(dependent);
+			--remaining;
+			condition.notify_all();
 		}
-		else {
-			queue.push_back(node);
+	};
+	auto start = std::chrono::high_resolution_clock::now();
+	int num_workers = std::max(1, std::min((int) std::thread::hardware_concurrency(), (int) _nodes.size()));
+	std::list<std::thread> workers;
+	for (int i = 0; i < num_workers; ++i)
+		workers.push_back(std::thread(worker));
+	for (auto &t : workers)
+		t.join();
+	double total_ms = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+	LOG_IF(FATAL, records.size() != _nodes.size()) << "Failed to initialize " << _nodes.size() - records.size() << " nodes, the graph has a cycle.";
+
+	if (init_report) {
+		std::sort(records.begin(), records.end(), [](const InitRecord &a, const InitRecord &b) { return a.ms > b.ms; });
+		size_t total_bytes = 0;
+		for (auto &record : records) {
+			LOG(INFO) << "init " << record.node->op_name() << " " << record.node->name() << " | " << record.ms << " ms | " << record.bytes / 1048576.0f << " MB";
+			total_bytes += record.bytes;
+		}
+		LOG(INFO) << "init " << records.size() << " nodes on " << num_workers << " threads | " << total_ms << " ms | " << total_bytes / 1048576.0f << " MB";
+		// Gradient accumulators of trained variables are allocated by the first backward, not by init.
+		size_t grad_bytes = 0;
+		if (!execution_context || !execution_context->fused_update)
+			for (auto &var : _variables)
+				if (_solvers.find(var) != _solvers.end())
+					grad_bytes += var->output(0)->value()->bytes();
+		LOG(INFO) << "init gradient accumulators | " << grad_bytes / 1048576.0f << " MB on the first backward";
+	}
+
+	if (fused) {
+		_fusion_report.bytes = _fusion_report.variable_bytes;
+		for (auto node : _nodes) {
+			auto absorbed = _fusion_report.absorbed_outputs.find(node->name());
+			if (absorbed != _fusion_report.absorbed_outputs.end())
+				_fusion_report.bytes += absorbed->second * (node->output(0)->value()->bytes() + (node->output(0)->diff() ? node->output(0)->diff()->bytes() : 0));
 		}
+		LOG(INFO) << "graph fusion | " << _fusion_report.nodes_removed << " nodes removed | " << _fusion_report.folded_batch_norms << " batch norms folded | " << _fusion_report.epilogues << " epilogues | " << _fusion_report.chains << " chains | " << _fusion_report.bytes / 1048576.0f << " MB";
 	}
 
 	if (execution_context) {
@@ -420,6 +558,8 @@ void Session::_insert_splits()
 
 				auto node_param = _block->add_node_param();				
 				node_param->set_name("split_" + output->name());
+				node_param->set_data_policy(node->param()->data_policy());
+				node_param->set_layout(node->param()->layout());
 				node_param->add_input(node_param->name());
 				for (int i = 0; i < connected_terminals.size(); ++i) {
 					node_param->add_output(node_param->name() + "_" + std::to_string(i));
@@ -648,6 +788,26 @@ void Session::forward(std::list<std::shared_ptr<Node>> end_nodes, std::list<std:
 	for (auto pair : feed_list) {
 		pair.first->write_values(pair.second);
 	}
+	if (_frozen) {
+		// Frozen graphs run in their stored order, the planned memory relies on it.
+		std::set<Node*> active;
+		std::list<std::shared_ptr<Node>> stack = end_nodes;
+		while (!stack.empty()) {
+			auto node = stack.front();
+			stack.pop_front();
+			if (active.insert(node.get()).second == false)
+				continue;
+			for (auto input_node : node->inputNodes())
+				stack.push_back(input_node);
+		}
+		for (auto node : _nodes) {
+			if (active.find(node.get()) == active.end())
+				continue;
+			node->_forward();
+			LOG_IF(FATAL, cudaPeekAtLastError() != 0) << "[FAILED] " << node->name() << " | " << cudaGetErrorString(cudaPeekAtLastError());
+		}
+		return;
+	}
 	auto path = forward_path(end_nodes);
 	while (path.size() > 0) {
 		auto node = path.front();
@@ -680,8 +840,64 @@ void Session::clamp(float min, float max, const std::string &scope)
 	}
 }
 
+// Updated variables get a new version, so memoized nodes that read them run again within the step.
+static void apply_solver(std::shared_ptr<Solver> solver, std::shared_ptr<Variable> var)
+{
+	solver->apply(var);
+	if (solver->enabled())
+		var->output(0)->bump_version();
+}
+
+// An output needs a gradient when it is computed from a variable with an enabled solver, the way
+// through a generator or a pass_through that stops gradients does not count.
+void Session::_prune_backward()
+{
+	bool prune = _execution_context && _execution_context->prune_backward;
+	std::vector<bool> enabled;
+	std::set<Node*> trainable;
+	if (prune) {
+		for (auto item : _solvers) {
+			enabled.push_back(item.second->enabled());
+			if (item.second->enabled())
+				trainable.insert(item.first.get());
+		}
+	}
+	if (prune == _pruned && enabled == _pruned_solvers)
+		return;
+	_pruned = prune;
+	_pruned_solvers = enabled;
+	std::map<Node*, bool> needs_gradient;
+	std::function<bool(Node*)> visit = [&](Node *node) {
+		auto it = needs_gradient.find(node);
+		if (it != needs_gradient.end())
+			return it->second;
+		needs_gradient[node] = false;
+		bool result = trainable.count(node) > 0;
+		auto param = node->param();
+		bool stops = node->is_generator() || (param && param->has_pass_through_param() && param->pass_through_param().stop_gradients());
+		for (auto input : node->inputs())
+			if (!stops && input->connectedNode() && visit(input->connectedNode().get()))
+				result = true;
+		needs_gradient[node] = result;
+		return result;
+	};
+	int skipped = 0;
+	for (auto node : _nodes) {
+		bool needed = !prune || trainable.count(node.get()) > 0;
+		for (auto input : node->inputs()) {
+			bool required = !prune || (input->connectedNode() && visit(input->connectedNode().get()));
+			input->set_requires_grad(required);
+			needed = needed || required;
+		}
+		node->setNeedsBackward(needed);
+		skipped += needed ? 0 : 1;
+	}
+	LOG_IF(INFO, _execution_context && _execution_context->debug_level > 0) << "Backward skips " << skipped << " of " << _nodes.size() << " nodes";
+}
+
 void Session::backward(std::list<std::shared_ptr<Node>> end_nodes, std::list <std::pair<std::shared_ptr<Node>, std::shared_ptr<Tensor>>> feed_list)
 {
+	LOG_IF(FATAL, _frozen) << "Frozen sessions are inference only.";
 	for (auto node : _nodes) {
 		for (auto t : node->outputs())
 			t->setEnabled(false);
@@ -689,6 +905,8 @@ void Session::backward(std::list<std::shared_ptr<Node>> end_nodes, std::list <st
 	for (auto pair : feed_list) {
 		pair.first->write_diffs(pair.second);
 	}
+	_prune_backward();
+	bool fused_update = _execution_context && _execution_context->fused_update;
 	auto path = forward_path(end_nodes);
 	while (path.size() > 0) {
 		auto node = path.back();
@@ -697,6 +915,11 @@ void Session::backward(std::list<std::shared_ptr<Node>> end_nodes, std::list <st
 		LOG_IF(INFO, _verbose > 2) << "BWRD -> " << node->name();
 		node->_backward();
 		LOG_IF(FATAL, cudaPeekAtLastError() != 0) << "[FAILED] " << node->name() << " | " << cudaGetErrorString(cudaPeekAtLastError());
+		// Variables come after all their consumers on the way back, the gradient is complete here.
+		auto var = fused_update && node->needsBackward() ? std::dynamic_pointer_cast<Variable>(node) : nullptr;
+		auto solver = var ? _solvers.find(var) : _solvers.end();
+		if (solver != _solvers.end())
+			apply_solver(solver->second, var);
 	}
 }
 
@@ -707,32 +930,48 @@ void Session::backward(const std::string & scope, std::list<std::pair<std::share
 
 void Session::apply_solvers(std::list<std::string> solver_names)
 {
+	if (_execution_context && _execution_context->fused_update)
+		return;
 	if (solver_names.size() > 0) {		
 		for (auto item : _solvers) {
 			for (auto name : solver_names) {
 				if (item.second->name() == name) {										
-					item.second->apply(item.first);
+					apply_solver(item.second, item.first);
 				}
 			}
 		}
 	}
 	else {
 		for (auto item : _solvers) {
-			item.second->apply(item.first);
+			apply_solver(item.second, item.first);
 		}
 	}
 }
 
 void Session::apply_solvers(const std::string & scope)
 {	
+	if (_execution_context && _execution_context->fused_update)
+		return;
 	for (auto item : _solvers) {
 		if (!scope.empty() && item.first->scope() != scope) {			
 			continue;
 		}
-		item.second->apply(item.first);
+		apply_solver(item.second, item.first);
 	}
 }
 
+void Session::begin_step()
+{
+	LOG_IF(FATAL, !_execution_context) << "The session must be initialized before a step begins.";
+	_execution_context->step = ++_steps;
+}
+
+void Session::end_step()
+{
+	if (_execution_context)
+		_execution_context->step = 0;
+}
+
 void Session::set_enabled_solvers(bool state, std::list<std::string> solver_names)
 {
 	if (solver_names.size() > 0) {
@@ -808,6 +1047,276 @@ void Session::save(std::string file_path, bool as_text)
 		_block->save_as_binary(file_path);
 }
 
+void Session::save_frozen(std::string file_path, std::list<std::string> fetches, bool plan_memory, std::string shared_weights)
+{
+	LOG_IF(FATAL, _initialized == false) << "The session must be initialized before it can be frozen.";
+
+	std::list<std::shared_ptr<Node>> fetch_nodes;
+	if (fetches.empty()) {
+		for (auto node : end_nodes(""))
+			if (node->outputs().size() > 0)
+				fetch_nodes.push_back(node);
+	}
+	else {
+		for (auto fetch : fetches) {
+			auto node = _find_node_by_name(fetch, "");
+			LOG_IF(FATAL, node == nullptr) << "Node " << fetch << " does not exist.";
+			LOG_IF(FATAL, node->outputs().size() == 0) << "Node " << fetch << " has no output to fetch.";
+			fetch_nodes.push_back(node);
+		}
+	}
+	LOG_IF(FATAL, fetch_nodes.empty()) << "There is nothing to freeze.";
+
+	// Depth first from the fetches, the stored node order is a topological order. Displays, writers
+	// and loggers have no outputs so they are never reached, solvers are not written at all.
+	std::set<Node*> visited;
+	std::list<std::shared_ptr<Node>> order;
+	std::function<void(std::shared_ptr<Node>)> collect = [&](std::shared_ptr<Node> node) {
+		if (visited.insert(node.get()).second == false)
+			return;
+		for (auto input : node->inputs()) {
+			auto input_node = input->connectedNode();
+			LOG_IF(FATAL, input_node == nullptr) << node->name() << " has an unconnected input.";
+			collect(input_node);
+		}
+		order.push_back(node);
+	};
+	for (auto node : fetch_nodes)
+		collect(node);
+
+	deepflow::BlockParam frozen;
+	auto frozen_param = frozen.mutable_frozen_param();
+	for (auto node : fetch_nodes)
+		frozen_param->add_fetch(node->name());
+	std::list<std::shared_ptr<Variable>> variables;
+	for (auto node : order) {
+		node->prep_for_saving();
+		auto node_param = frozen.add_node();
+		node_param->CopyFrom(*node->param());
+		if (node_param->has_variable_param()) {
+			auto var_param = node_param->mutable_variable_param();
+			var_param->clear_solver_name();
+			var_param->mutable_init_param()->clear_init_data();
+			if (!shared_weights.empty())
+				var_param->clear_weights();
+			variables.push_back(std::dynamic_pointer_cast<Variable>(node));
+		}
+	}
+	if (!shared_weights.empty()) {
+		SharedWeights::write(shared_weights, variables);
+		frozen_param->set_shared_weights(shared_weights);
+	}
+
+	// Lifetimes of the tensors that own their memory, a shadow extends the lifetime of what it shadows.
+	// One arena serves either the device or the host nodes, whichever the first fetch runs on.
+	auto arena_policy = fetch_nodes.front()->policy();
+	plan_memory = plan_memory && (arena_policy == Tensor::GPU_ONLY_POLICY || arena_policy == Tensor::CPU_ONLY_POLICY);
+	struct Lifetime {
+		int first_step;
+		int last_step;
+		int64_t size;
+		int64_t offset;
+	};
+	std::vector<Lifetime> lifetimes;
+	std::map<Tensor*, int> lifetime_index;
+	auto owner = [&](std::shared_ptr<Tensor> tensor) {
+		while (tensor->shadow_tensor())
+			tensor = tensor->shadow_tensor();
+		auto it = lifetime_index.find(tensor.get());
+		return it == lifetime_index.end() ? -1 : it->second;
+	};
+	// Outputs that may serve any of their node's inputs at run time keep all of those inputs alive.
+	const std::set<std::string> routing_ops = { "switcher", "multiplexer", "random_selector", "dropout" };
+	std::map<Tensor*, std::list<std::shared_ptr<Tensor>>> routed;
+	std::function<void(std::shared_ptr<Tensor>, int)> use = [&](std::shared_ptr<Tensor> tensor, int last_step) {
+		int index = owner(tensor);
+		if (index != -1)
+			lifetimes[index].last_step = last_step;
+		for (; tensor; tensor = tensor->shadow_tensor()) {
+			auto it = routed.find(tensor.get());
+			if (it != routed.end())
+				for (auto input : it->second)
+					use(input, last_step);
+		}
+	};
+	int step = 0;
+	for (auto node : order) {
+		for (auto input : node->inputs())
+			use(input->value(), step);
+		if (routing_ops.count(node->op_name())) {
+			for (auto output : node->outputs())
+				for (auto input : node->inputs())
+					routed[output->value().get()].push_back(input->value());
+		}
+		bool plannable = plan_memory && node->inputs().size() > 0 && !node->is_generator() && node->policy() == arena_policy && node->op_name() != "accumulator" && node->op_name() != "replay_memory";
+		if (plannable) {
+			for (auto output : node->outputs()) {
+				auto value = output->value();
+				if (value->shadow_tensor() == nullptr) {
+					lifetime_index[value.get()] = lifetimes.size();
+					lifetimes.push_back({ step, step, value->size(), -1 });
+				}
+			}
+		}
+		++step;
+	}
+	for (auto node : fetch_nodes) {
+		for (auto output : node->outputs())
+			use(output->value(), INT_MAX);
+	}
+
+	// Greedy first fit in definition order, offsets are 256 byte aligned for cudnn.
+	auto aligned = [](int64_t size) { return (size + 63) / 64 * 64; };
+	int64_t arena_size = 0;
+	for (int i = 0; i < lifetimes.size(); ++i) {
+		auto &lifetime = lifetimes[i];
+		int64_t size = aligned(lifetime.size);
+		std::list<std::pair<int64_t, int64_t>> busy;
+		for (int j = 0; j < i; ++j) {
+			auto &other = lifetimes[j];
+			if (other.first_step <= lifetime.last_step && lifetime.first_step <= other.last_step)
+				busy.push_back({ other.offset, other.offset + aligned(other.size) });
+		}
+		busy.sort();
+		int64_t offset = 0;
+		for (auto range : busy) {
+			if (offset + size <= range.first)
+				break;
+			offset = std::max(offset, range.second);
+		}
+		lifetime.offset = offset;
+		arena_size = std::max(arena_size, offset + size);
+	}
+	frozen_param->set_arena_size(arena_size);
+	frozen_param->set_arena_policy((deepflow::NodeParam::DataPolicy) arena_policy);
+
+	size_t planned_bytes = 0;
+	for (auto node : order) {
+		for (auto output : node->outputs()) {
+			auto output_param = frozen_param->add_output();
+			output_param->set_name(output->name());
+			for (auto dim : output->value()->dims())
+				output_param->add_dims(dim);
+			auto it = lifetime_index.find(output->value().get());
+			if (it != lifetime_index.end()) {
+				output_param->set_offset(lifetimes[it->second].offset);
+				planned_bytes += output->value()->bytes();
+			}
+			else {
+				output_param->set_offset(-1);
+			}
+		}
+	}
+	LOG(INFO) << "freezing " << order.size() << " nodes | activations " << planned_bytes / 1048576.0f << " MB -> arena " << arena_size * sizeof(float) / 1048576.0f << " MB";
+
+	std::fstream output(file_path, std::ios::out | std::ios::trunc | std::ios::binary);
+	LOG_IF(FATAL, !frozen.SerializeToOstream(&output)) << "Failed to write frozen graph to " << file_path;
+	output.close();
+}
+
+std::shared_ptr<Session> Session::load_frozen(std::string file_path, std::shared_ptr<ExecutionContext> execution_context, std::string shared_weights)
+{
+	auto block = std::make_shared<Block>();
+	block->load_from_binary(file_path);
+	LOG_IF(FATAL, block->block_param()->has_frozen_param() == false) << file_path << " is not a frozen graph.";
+	auto session = std::make_shared<Session>(block);
+	session->_create_frozen_nodes(shared_weights);
+	if (!execution_context) {
+		execution_context = std::make_shared<ExecutionContext>();
+		execution_context->execution_mode = ExecutionContext::TEST;
+	}
+	session->set_execution_context(execution_context);
+	return session;
+}
+
+void Session::_create_frozen_nodes(std::string shared_weights)
+{
+	auto block_param = _block->block_param();
+	const auto &frozen_param = block_param->frozen_param();
+	if (shared_weights.empty())
+		shared_weights = frozen_param.shared_weights();
+
+	std::shared_ptr<Tensor> arena;
+	if (frozen_param.arena_size() > 0)
+		arena = std::make_shared<Tensor>(std::array<int, 4>{ 1, 1, 1, (int) frozen_param.arena_size() }, "frozen_arena", (Tensor::DataPolicy) frozen_param.arena_policy());
+
+	// Nodes are stored in topological order, the producer of every input is already created.
+	std::map<std::string, std::shared_ptr<NodeOutput>> outputs;
+	for (int i = 0; i < block_param->node_size(); ++i) {
+		auto node = _create_node(block_param->mutable_node(i));
+		node->createIO();
+		node->setFrozen(true);
+		for (int j = 0; j < node->param()->input_size(); ++j) {
+			const std::string terminal_name = node->param()->input(j);
+			if (terminal_name.empty())
+				continue;
+			auto terminal = outputs.find(terminal_name);
+			LOG_IF(FATAL, terminal == outputs.end()) << "Failed to find " << terminal_name << " for node " << node->name();
+			node->input(j)->connect(terminal->second);
+		}
+		for (auto output : node->outputs())
+			outputs[output->name()] = output;
+		_nodes.push_back(node);
+	}
+
+	for (const auto &output_param : frozen_param.output()) {
+		if (output_param.offset() < 0)
+			continue;
+		auto output = outputs.find(output_param.name());
+		LOG_IF(FATAL, output == outputs.end()) << "Failed to find " << output_param.name() << " in the frozen graph.";
+		output->second->planValue(arena, output_param.offset());
+	}
+
+	_variables = _get_nodes<Variable>("");
+	if (!shared_weights.empty()) {
+		map_shared_weights(shared_weights);
+		for (auto var : _variables)
+			LOG_IF(FATAL, !_shared_weights->contains(var->name())) << "Variable " << var->name() << " is missing from " << shared_weights;
+		_map_variables();
+	}
+
+	for (auto node : _nodes) {
+		node->init();
+		LOG_IF(FATAL, cudaPeekAtLastError() != 0) << "[FAILED] " << node->name() << " | " << cudaGetErrorString(cudaPeekAtLastError());
+		node->setInitialized(true);
+	}
+
+	for (const auto &output_param : frozen_param.output()) {
+		auto dims = outputs[output_param.name()]->value()->dims();
+		bool match = output_param.dims_size() == 4;
+		for (int i = 0; match && i < 4; ++i)
+			match = output_param.dims(i) == dims[i];
+		LOG_IF(FATAL, !match) << "Shape of " << output_param.name() << " does not match the frozen graph.";
+	}
+
+	_created = true;
+	_initialized = true;
+	_frozen = true;
+}
+
+void Session::save_shared_weights(std::string source, const std::string &scope)
+{
+	LOG_IF(FATAL, _initialized == false) << "The session must be initialized before its weights can be shared.";
+	SharedWeights::write(source, _get_nodes<Variable>(scope));
+}
+
+void Session::map_shared_weights(std::string source)
+{
+	LOG_IF(FATAL, _initialized && !_frozen) << "Shared weights must be mapped before the session is initialized.";
+	_shared_weights = std::make_shared<SharedWeights>(source);
+}
+
+void Session::_map_variables()
+{
+	if (!_shared_weights)
+		return;
+	for (auto var : _variables) {
+		auto weights = _shared_weights->tensor(var->name());
+		if (weights)
+			var->map_weights(weights);
+	}
+}
+
 void Session::print_variables_info(const std::string &scope)
 {
 	std::list<std::shared_ptr<Variable>> variable_nodes = _get_nodes<Variable>(scope);	
@@ -953,6 +1462,12 @@ std::string Session::to_cpp(const std::string &scope) const
 	return code;
 }
 
+std::string Session::to_aot_cpp(std::list<std::string> fetches, const std::string & name, bool verbose)
+{
+	AotCompiler compiler(this, verbose);
+	return compiler.compile(fetches, name);
+}
+
 std::shared_ptr<PlaceHolder> Session::get_placeholder(const std::string &name, const std::string &scope)
 {
 	auto node = _find_node_by_name(name, scope);
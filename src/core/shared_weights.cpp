@@ -0,0 +1,184 @@
+#include "core/shared_weights.h"
+#include "core/tensor.h"
+
+#include "nodes/variable.h"
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/shared_memory_object.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <glog/logging.h>
+
+#include <cstring>
+#include <cstdint>
+#include <fstream>
+#include <vector>
+
+namespace {
+	const char shared_weights_magic[8] = { 'D', 'F', 'W', 'E', 'I', 'G', 'H', 'T' };
+	const size_t shared_weights_page = 4096;
+	const size_t shared_weights_alignment = 64;
+
+	struct SharedWeightsHeader {
+		char magic[8];
+		uint32_t count;
+		uint32_t reserved;
+		uint64_t size;
+	};
+
+	size_t align_up(size_t value, size_t alignment) {
+		return (value + alignment - 1) / alignment * alignment;
+	}
+}
+
+SharedWeights::SharedWeights(const std::string & source)
+{
+	using namespace boost::interprocess;
+	_source = source;
+	std::string shm_name;
+	try {
+		std::shared_ptr<mapped_region> region;
+		if (_is_shm(source, &shm_name)) {
+			shared_memory_object shm(open_only, shm_name.c_str(), read_only);
+			region = std::make_shared<mapped_region>(shm, read_only);
+		}
+		else {
+			file_mapping file(source.c_str(), read_only);
+			region = std::make_shared<mapped_region>(file, read_only);
+		}
+		_region = region;
+		_data = (const char *) region->get_address();
+		_size = region->get_size();
+	}
+	catch (interprocess_exception &e) {
+		LOG(FATAL) << "Failed to map shared weights " << source << " - " << e.what();
+	}
+
+	LOG_IF(FATAL, _size < sizeof(SharedWeightsHeader)) << source << " is not a shared weights file.";
+	SharedWeightsHeader header;
+	memcpy(&header, _data, sizeof(header));
+	LOG_IF(FATAL, memcmp(header.magic, shared_weights_magic, sizeof(shared_weights_magic)) != 0) << source << " is not a shared weights file.";
+	LOG_IF(FATAL, header.size > _size) << source << " is truncated.";
+
+	// Every index entry is checked against the mapping before it is used, a corrupt entry is reported
+	// by its position in the index.
+	const char *cursor = _data + sizeof(header);
+	const char *end = _data + header.size;
+	for (uint32_t i = 0; i < header.count; ++i) {
+		uint32_t name_size;
+		LOG_IF(FATAL, end - cursor < (ptrdiff_t)sizeof(name_size)) << "Index entry " << i << " of " << source << " is truncated.";
+		memcpy(&name_size, cursor, sizeof(name_size));
+		cursor += sizeof(name_size);
+		LOG_IF(FATAL, (size_t)(end - cursor) < name_size + 4 * sizeof(int32_t) + sizeof(uint64_t)) << "Index entry " << i << " of " << source << " is truncated.";
+		std::string name(cursor, name_size);
+		cursor += name_size;
+		int32_t dims[4];
+		memcpy(dims, cursor, sizeof(dims));
+		cursor += sizeof(dims);
+		uint64_t offset;
+		memcpy(&offset, cursor, sizeof(offset));
+		cursor += sizeof(offset);
+		LOG_IF(FATAL, name.empty()) << "Index entry " << i << " of " << source << " has no variable name.";
+		LOG_IF(FATAL, _entries.find(name) != _entries.end()) << "Index entry " << i << " of " << source << " repeats variable " << name;
+		uint64_t count = 1;
+		for (int d = 0; d < 4; ++d) {
+			LOG_IF(FATAL, dims[d] <= 0) << "Index entry " << i << " (" << name << ") of " << source << " has dimension " << d << " = " << dims[d];
+			count *= (uint64_t)dims[d];
+		}
+		LOG_IF(FATAL, offset % sizeof(float) != 0 || offset < (uint64_t)(cursor - _data) || offset > header.size || count > (header.size - offset) / sizeof(float)) << "Index entry " << i << " (" << name << ") of " << source << " is out of bounds at offset " << offset;
+		Entry entry;
+		entry.dims = { dims[0], dims[1], dims[2], dims[3] };
+		entry.offset = offset;
+		_entries[name] = entry;
+	}
+	LOG(INFO) << "mapped " << _entries.size() << " shared weights from " << source << " (" << _size / 1048576.0f << " MB)";
+}
+
+void SharedWeights::write(const std::string & source, std::list<std::shared_ptr<Variable>> variables)
+{
+	using namespace boost::interprocess;
+
+	// Header and index first, then the data of each variable at an aligned offset.
+	size_t index_size = sizeof(SharedWeightsHeader);
+	for (auto var : variables)
+		index_size += sizeof(uint32_t) + var->name().size() + 4 * sizeof(int32_t) + sizeof(uint64_t);
+	std::vector<size_t> offsets;
+	size_t size = align_up(index_size, shared_weights_page);
+	for (auto var : variables) {
+		offsets.push_back(size);
+		size = align_up(size + var->output(0)->value()->bytes(), shared_weights_alignment);
+	}
+
+	std::vector<char> buffer(size, 0);
+	SharedWeightsHeader header;
+	memcpy(header.magic, shared_weights_magic, sizeof(shared_weights_magic));
+	header.count = variables.size();
+	header.reserved = 0;
+	header.size = size;
+	memcpy(buffer.data(), &header, sizeof(header));
+	char *cursor = buffer.data() + sizeof(header);
+	int i = 0;
+	for (auto var : variables) {
+		auto value = var->output(0)->value();
+		uint32_t name_size = var->name().size();
+		memcpy(cursor, &name_size, sizeof(name_size));
+		cursor += sizeof(name_size);
+		memcpy(cursor, var->name().data(), name_size);
+		cursor += name_size;
+		int32_t dims[4] = { value->dim(0), value->dim(1), value->dim(2), value->dim(3) };
+		memcpy(cursor, dims, sizeof(dims));
+		cursor += sizeof(dims);
+		uint64_t offset = offsets[i++];
+		memcpy(cursor, &offset, sizeof(offset));
+		cursor += sizeof(offset);
+		auto data = value->to_vec();
+		memcpy(buffer.data() + offset, data->data(), value->bytes());
+	}
+
+	std::string shm_name;
+	if (_is_shm(source, &shm_name)) {
+		try {
+			shared_memory_object::remove(shm_name.c_str());
+			shared_memory_object shm(create_only, shm_name.c_str(), read_write);
+			shm.truncate(size);
+			mapped_region region(shm, read_write);
+			memcpy(region.get_address(), buffer.data(), size);
+		}
+		catch (interprocess_exception &e) {
+			LOG(FATAL) << "Failed to write shared weights " << source << " - " << e.what();
+		}
+	}
+	else {
+		std::fstream output(source, std::ios::out | std::ios::trunc | std::ios::binary);
+		LOG_IF(FATAL, !output.write(buffer.data(), size)) << "Failed to write shared weights to " << source;
+		output.close();
+	}
+	LOG(INFO) << "wrote " << variables.size() << " shared weights to " << source << " (" << size / 1048576.0f << " MB)";
+}
+
+std::shared_ptr<Tensor> SharedWeights::tensor(const std::string & name)
+{
+	auto it = _entries.find(name);
+	if (it == _entries.end())
+		return nullptr;
+	return std::make_shared<Tensor>(it->second.dims, (const float *)(_data + it->second.offset), shared_from_this(), name + "_shared");
+}
+
+bool SharedWeights::contains(const std::string & name) const
+{
+	return _entries.find(name) != _entries.end();
+}
+
+const std::string & SharedWeights::source() const
+{
+	return _source;
+}
+
+bool SharedWeights::_is_shm(const std::string & source, std::string * name)
+{
+	const std::string prefix = "shm://";
+	if (source.compare(0, prefix.size(), prefix) != 0)
+		return false;
+	*name = source.substr(prefix.size());
+	return true;
+}
@@ -36,3 +36,21 @@ void Solver::set_enabled(bool state)
 {	
 	_enabled = state;
 }
+
+bool Solver::enabled() const
+{
+	return _enabled;
+}
+
+float * Solver::_state(std::shared_ptr<Variable> var, float value)
+{
+	auto size = var->output(0)->value()->size();
+	_host_state.emplace_back(size, value);
+	if (var->is_cpu())
+		return _host_state.back().data();
+	float *state = nullptr;
+	DF_CUDA_CHECK(cudaMalloc(&state, size * sizeof(float)));
+	DF_CUDA_CHECK(cudaMemcpy(state, _host_state.back().data(), size * sizeof(float), cudaMemcpyHostToDevice));
+	_host_state.pop_back();
+	return state;
+}
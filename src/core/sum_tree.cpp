@@ -0,0 +1,60 @@
+#include "core/sum_tree.h"
+
+#include <glog/logging.h>
+
+SumTree::SumTree(int capacity)
+{
+	resize(capacity);
+}
+
+void SumTree::resize(int capacity)
+{
+	_capacity = capacity;
+	_leaves = 1;
+	while (_leaves < capacity)
+		_leaves <<= 1;
+	// Node 1 is the root, the children of node i are 2i and 2i + 1, leaves start at _leaves.
+	_tree.assign(2 * _leaves, 0.0f);
+}
+
+int SumTree::capacity() const
+{
+	return _capacity;
+}
+
+void SumTree::set(int slot, float priority)
+{
+	LOG_IF(FATAL, slot < 0 || slot >= _capacity) << "SumTree slot " << slot << " out of range [0, " << _capacity << ")";
+	LOG_IF(FATAL, !(priority >= 0)) << "SumTree priority must be non-negative but was " << priority;
+	int node = _leaves + slot;
+	_tree[node] = priority;
+	for (node >>= 1; node > 0; node >>= 1)
+		_tree[node] = _tree[2 * node] + _tree[2 * node + 1];
+}
+
+float SumTree::get(int slot) const
+{
+	return _tree[_leaves + slot];
+}
+
+float SumTree::total() const
+{
+	return _tree[1];
+}
+
+int SumTree::find(float u) const
+{
+	int node = 1;
+	while (node < _leaves) {
+		const int left = 2 * node;
+		// Only subtrees with a positive sum are entered, so a leaf reached has a priority.
+		if (u < _tree[left] || _tree[left + 1] <= 0.0f) {
+			node = left;
+		}
+		else {
+			u -= _tree[left];
+			node = left + 1;
+		}
+	}
+	return node - _leaves;
+}
@@ -1,10 +1,15 @@
 #include "core/tensor.h"
+#include "core/cpu_layout.h"
+#include "core/cpu_transpose.h"
 
 #include <vector>
 
 #include <mutex>
 
-size_t Tensor::_used_gpu_mem_size = 0;
+std::atomic<size_t> Tensor::_used_gpu_mem_size(0);
+
+// Bytes allocated by the calling thread, lets concurrent initialization attribute memory to nodes.
+static thread_local size_t _thread_allocated_bytes = 0;
 
 Tensor::Tensor() {}
 
@@ -31,6 +36,71 @@ Tensor::Tensor(std::array<int, 4> dims, std::shared_ptr<Tensor> shadow_tensor, s
 	cudaStreamCreate(&_stream);	
 }
 
+Tensor::Tensor(std::array<int, 4> dims, std::shared_ptr<Tensor> arena, size_t offset, std::string name)
+{
+	_dims = dims;
+	_name = name;
+	_size = _dims[0] * _dims[1] * _dims[2] * _dims[3];
+	_shapeString = std::to_string(_dims[0]);
+	for (int i = 1; i < 4; ++i)
+		_shapeString += "x" + std::to_string(_dims[i]);
+	LOG_IF(FATAL, arena->_location != GPU && arena->_policy != CPU_ONLY_POLICY) << "The arena of " << _name << " must be a GPU or a host only tensor.";
+	LOG_IF(FATAL, offset + _size > arena->size()) << "The arena is too small for " << _name << " at offset " << offset;
+	DF_CUDNN_CHECK(cudnnCreateTensorDescriptor(&_desc));
+	DF_CUDNN_CHECK(cudnnSetTensor4dDescriptor(_desc, CUDNN_TENSOR_NCHW, CUDNN_DATA_FLOAT, _dims[0], _dims[1], _dims[2], _dims[3]));
+	DF_CUDNN_CHECK(cudnnGetTensorSizeInBytes(_desc, &_bytes));
+	// The memory belongs to the arena, this tensor only keeps it alive.
+	_arena = arena;
+	if (arena->_policy == CPU_ONLY_POLICY) {
+		_cpu_data = arena->cpu_data() + offset;
+		_policy = CPU_ONLY_POLICY;
+		_location = CPU;
+	}
+	else {
+		_gpu_data = arena->gpu_data() + offset;
+		_policy = GPU_ONLY_POLICY;
+		_location = GPU;
+	}
+	cudaStreamCreate(&_stream);
+}
+
+Tensor::Tensor(std::array<int, 4> dims, const float * mapped_data, std::shared_ptr<void> mapping, std::string name)
+{
+	_dims = dims;
+	_name = name;
+	_size = _dims[0] * _dims[1] * _dims[2] * _dims[3];
+	_shapeString = std::to_string(_dims[0]);
+	for (int i = 1; i < 4; ++i)
+		_shapeString += "x" + std::to_string(_dims[i]);
+	DF_CUDNN_CHECK(cudnnCreateTensorDescriptor(&_desc));
+	DF_CUDNN_CHECK(cudnnSetTensor4dDescriptor(_desc, CUDNN_TENSOR_NCHW, CUDNN_DATA_FLOAT, _dims[0], _dims[1], _dims[2], _dims[3]));
+	DF_CUDNN_CHECK(cudnnGetTensorSizeInBytes(_desc, &_bytes));
+	// Host memory mapped read only, the mapping is kept alive as long as the tensor.
+	_mapping = mapping;
+	_cpu_data = const_cast<float *>(mapped_data);
+	_read_only = true;
+	_policy = CPU_ONLY_POLICY;
+	_location = CPU;
+}
+
+Tensor::Tensor(std::array<int, 4> dims, std::shared_ptr<Tensor> tensor, size_t offset, std::array<ptrdiff_t, 4> strides, std::string name)
+{
+	_dims = dims;
+	_name = name;
+	_size = _dims[0] * _dims[1] * _dims[2] * _dims[3];
+	_shapeString = std::to_string(_dims[0]);
+	for (int i = 1; i < 4; ++i)
+		_shapeString += "x" + std::to_string(_dims[i]);
+	DF_CUDNN_CHECK(cudnnCreateTensorDescriptor(&_desc));
+	DF_CUDNN_CHECK(cudnnSetTensor4dDescriptor(_desc, CUDNN_TENSOR_NCHW, CUDNN_DATA_FLOAT, _dims[0], _dims[1], _dims[2], _dims[3]));
+	DF_CUDNN_CHECK(cudnnGetTensorSizeInBytes(_desc, &_bytes));
+	// A view has no data of its own, there is nothing to fall back to when it is unshadowed.
+	_location = SHADOW;
+	_policy = tensor->_policy;
+	view(tensor, offset, strides);
+	cudaStreamCreate(&_stream);
+}
+
 void Tensor::init(DataPolicy policy) {
 	_size = _dims[0] * _dims[1] * _dims[2] * _dims[3];	
 	_shapeString = std::to_string(_dims[0]);
@@ -68,6 +138,20 @@ void Tensor::init(DataPolicy policy) {
 		DF_CUDA_CHECK(cudaMemset(_gpu_data, 0, _bytes));
 		_location = CUDA_MANAGED;
 	}
+	else if (_policy == CPU_ONLY_POLICY) {
+		_gpu_data = nullptr;
+		try
+		{
+			_cpu_data = new float[_size];
+		}
+		catch (std::bad_alloc&)
+		{
+			LOG(FATAL) << "[FAILED] - host memory alocation failed for " << _name;
+		}
+		memset(_cpu_data, 0, _bytes);
+		_location = CPU;
+	}
+	_thread_allocated_bytes += _bytes;
 	cudaStreamCreate(&_stream);	
 }
 
@@ -128,7 +212,11 @@ float * Tensor::cpu_data() {
 	}
 	if (_location == SHADOW) {
 		//LOG(INFO) << "Tensor " << _name << " CPU shahdow access from " << caller;
-		return _shadow_tensor->cpu_data();
+		if (!_window)
+			return _shadow_tensor->cpu_data();
+		if (is_contiguous())
+			return _shadow_tensor->cpu_data() + _view_offset;
+		return _gather(false);
 	}
 	else if (_location == CUDA_MANAGED) {
 		return _gpu_data;
@@ -160,7 +248,11 @@ float * Tensor::gpu_data() {
 	}
 	if (_location == SHADOW) {		
 		//LOG(INFO) << "Tensor " << _name << " GPU shahdow access from " << caller;
-		return _shadow_tensor->gpu_data();
+		if (!_window)
+			return _shadow_tensor->gpu_data();
+		if (is_contiguous())
+			return _shadow_tensor->gpu_data() + _view_offset;
+		return _gather(true);
 	}
 	else if (_location == GPU || _location == CUDA_MANAGED) {
 		LOG_IF(FATAL, _gpu_data == nullptr);
@@ -170,6 +262,7 @@ float * Tensor::gpu_data() {
 	else if (_location == CPU) {
 		//LOG(INFO) << "Tensor " << _name << " switched to GPU from " << caller;
 		LOG_IF(FATAL, _policy == GPU_ONLY_POLICY);
+		LOG_IF(FATAL, _policy == CPU_ONLY_POLICY) << "Tensor " << _name << " is host only.";
 		LOG_IF(FATAL, _cpu_data == nullptr);
 		LOG_IF(FATAL, _gpu_data != nullptr);
 		DF_CUDA_CHECK(cudaMalloc(&_gpu_data, _bytes));
@@ -240,9 +333,18 @@ void Tensor::print()
 
 
 void Tensor::release() {		
+	_gathered = nullptr;
+	if (_location == SHADOW && _unshadowed_location != SHADOW)
+		shadow(nullptr);
 	if (_location == SHADOW) {
 		_shadow_tensor->release();
 	}
+	else if (_arena || _mapping) {
+		_gpu_data = nullptr;
+		_cpu_data = nullptr;
+		_arena = nullptr;
+		_mapping = nullptr;
+	}
 	else if (_location == CPU) {
 		LOG_IF(FATAL, _gpu_data != nullptr);
 		LOG_IF(FATAL, _cpu_data == nullptr);
@@ -264,11 +366,22 @@ void Tensor::release() {
 }
 
 void Tensor::reset() {	
-	if (_location == SHADOW) {
+	if (_window) {
+		LOG_IF(FATAL, !is_contiguous()) << "Tensor " << _name << " is a strided view.";
+		if (_is_device()) {
+			DF_CUDA_CHECK(cudaMemset(gpu_data(), 0, _bytes));
+		}
+		else {
+			LOG_IF(FATAL, is_read_only()) << "Tensor " << _name << " is read only.";
+			memset(cpu_data(), 0, _bytes);
+		}
+	}
+	else if (_location == SHADOW) {
 		_shadow_tensor->reset();
 	}
 	else if (_location == CPU) {
 		LOG_IF(FATAL, _cpu_data == nullptr);
+		LOG_IF(FATAL, _read_only) << "Tensor " << _name << " is read only.";
 		memset(_cpu_data, 0, _bytes);
 	}
 	else if (_location == GPU || _location == CUDA_MANAGED) {
@@ -280,12 +393,26 @@ void Tensor::reset() {
 void Tensor::set(const std::vector<float> &values)
 {	
 	LOG_IF(FATAL, values.size() != size()) << "values.size() != size()";
-	if (_location == SHADOW) {
+	if (_window) {
+		LOG_IF(FATAL, !is_contiguous()) << "Tensor " << _name << " is a strided view.";
+		if (_is_device()) {
+			DF_CUDA_CHECK(cudaMemcpy(gpu_data(), values.data(), _bytes, cudaMemcpyHostToDevice));
+		}
+		else {
+			LOG_IF(FATAL, is_read_only()) << "Tensor " << _name << " is read only.";
+			memcpy(cpu_data(), values.data(), _bytes);
+		}
+	}
+	else if (_location == SHADOW) {
 		_shadow_tensor->set(values);
 	}
 	else if (_location == CPU) {
 		LOG_IF(FATAL, _cpu_data == nullptr);
-		memcpy(_cpu_data, values.data(), _bytes);
+		LOG_IF(FATAL, _read_only) << "Tensor " << _name << " is read only.";
+		if (_layout != NCHW)
+			CpuLayout::reorder(_dims, 1, values.data(), channel_block(), _cpu_data);
+		else
+			memcpy(_cpu_data, values.data(), _bytes);
 	}
 	else if (_location == GPU || _location == CUDA_MANAGED) {
 		LOG_IF(FATAL, _gpu_data == nullptr);
@@ -322,14 +449,24 @@ std::shared_ptr<std::vector<float>> Tensor::to_vec()
 	if (_offload_event) {
 		cudaEventSynchronize(_offload_event);
 	}
-	if (_location == SHADOW)
+	if (_location == SHADOW && !_window)
 		return _shadow_tensor->to_vec();
 	auto vec = std::make_shared<std::vector<float>>(_size);
-	if (_location == GPU || _location == CUDA_MANAGED) {
+	if (_window && _is_device()) {
+		DF_CUDA_CHECK(cudaMemcpy(vec->data(), gpu_data(), _bytes, cudaMemcpyDeviceToHost));
+	}
+	else if (_window) {
+		auto dense = contiguous_strides(_dims);
+		CpuTranspose::copy(4, _dims.data(), cpu_strided_data(), _strides.data(), vec->data(), dense.data());
+	}
+	else if (_location == GPU || _location == CUDA_MANAGED) {
 		DF_CUDA_CHECK(
 			cudaMemcpy(vec->data(), _gpu_data, _bytes, cudaMemcpyDeviceToHost)
 		);
 	}
+	else if (_layout != NCHW) {
+		CpuLayout::reorder(_dims, channel_block(), _cpu_data, 1, vec->data());
+	}
 	else {
 		memcpy(vec->data(), _cpu_data, _bytes);
 	}
@@ -349,7 +486,160 @@ std::string Tensor::name() const
 	return _name;
 }
 
+Tensor::Layout Tensor::layout() const
+{
+	return _layout;
+}
+
+void Tensor::set_layout(Layout layout)
+{
+	LOG_IF(FATAL, layout != NCHW && (_location == GPU || _location == CUDA_MANAGED)) << "Tensor " << _name << " - only host tensors have layouts.";
+	LOG_IF(FATAL, layout != NCHW && _window) << "Tensor " << _name << " - views are NCHW only.";
+	LOG_IF(FATAL, layout == NCHW16C && _dims[1] % CpuLayout::kBlock != 0) << "Tensor " << _name << " - " << _dims[1] << " channels are not a multiple of " << CpuLayout::kBlock;
+	if (layout == _layout)
+		return;
+	_layout = layout;
+	if (_desc)
+		DF_CUDNN_CHECK(cudnnSetTensor4dDescriptor(_desc, layout == NHWC ? CUDNN_TENSOR_NHWC : CUDNN_TENSOR_NCHW, CUDNN_DATA_FLOAT, _dims[0], _dims[1], _dims[2], _dims[3]));
+}
+
+int Tensor::channel_block() const
+{
+	switch (_layout) {
+	case NHWC:
+		return _dims[1];
+	case NCHW16C:
+		return CpuLayout::kBlock;
+	default:
+		return 1;
+	}
+}
+
+std::shared_ptr<Tensor> Tensor::shadow_tensor() const
+{
+	return _shadow_tensor;
+}
+
+void Tensor::shadow(std::shared_ptr<Tensor> tensor)
+{
+	if (tensor) {
+		LOG_IF(FATAL, tensor->size() != _size) << "The tensor that you are shadowing must have the same size.";
+		if (_location != SHADOW)
+			_unshadowed_location = _location;
+		_shadow_tensor = tensor;
+		_location = SHADOW;
+		_window = false;
+		_gathered = nullptr;
+	}
+	else if (_location == SHADOW) {
+		LOG_IF(FATAL, _unshadowed_location == SHADOW) << "Tensor " << _name << " has no data of its own.";
+		_location = _unshadowed_location;
+		_shadow_tensor = nullptr;
+		_window = false;
+		_gathered = nullptr;
+	}
+}
+
+void Tensor::view(std::shared_ptr<Tensor> tensor, size_t offset, std::array<ptrdiff_t, 4> strides)
+{
+	LOG_IF(FATAL, _layout != NCHW || tensor->layout() != NCHW) << "Tensor " << _name << " - views are NCHW only.";
+	// Windows of a window address the tensor it views.
+	if (tensor->_window)
+		tensor = tensor->_shadow_tensor;
+	ptrdiff_t last = offset;
+	for (int i = 0; i < 4; ++i) {
+		LOG_IF(FATAL, strides[i] < 0) << "Tensor " << _name << " - negative strides are not supported.";
+		last += (ptrdiff_t)(_dims[i] - 1) * strides[i];
+	}
+	LOG_IF(FATAL, last >= tensor->size()) << "Tensor " << _name << " does not fit in " << tensor->name() << " at offset " << offset;
+	if (_location != SHADOW)
+		_unshadowed_location = _location;
+	_shadow_tensor = tensor;
+	_location = SHADOW;
+	_window = true;
+	_view_offset = offset;
+	_strides = strides;
+	_gathered_stale = true;
+}
+
+size_t Tensor::view_offset() const
+{
+	return _window ? _view_offset : 0;
+}
+
+std::array<ptrdiff_t, 4> Tensor::strides() const
+{
+	return _window ? _strides : contiguous_strides(_dims);
+}
+
+bool Tensor::is_contiguous() const
+{
+	if (!_window)
+		return true;
+	ptrdiff_t expected = 1;
+	for (int i = 3; i >= 0; --i) {
+		if (_dims[i] == 1)
+			continue;
+		if (_strides[i] != expected)
+			return false;
+		expected *= _dims[i];
+	}
+	return true;
+}
+
+float * Tensor::cpu_strided_data()
+{
+	return _window ? _shadow_tensor->cpu_data() + _view_offset : cpu_data();
+}
+
+std::array<ptrdiff_t, 4> Tensor::contiguous_strides(std::array<int, 4> dims)
+{
+	return { (ptrdiff_t)dims[1] * dims[2] * dims[3], (ptrdiff_t)dims[2] * dims[3], dims[3], 1 };
+}
+
+bool Tensor::_is_device() const
+{
+	const Tensor *tensor = this;
+	while (tensor->_location == SHADOW)
+		tensor = tensor->_shadow_tensor.get();
+	return tensor->_location == GPU || tensor->_location == CUDA_MANAGED;
+}
+
+float * Tensor::_gather(bool device)
+{
+	if (!_gathered || (_gathered->_policy == GPU_ONLY_POLICY) != device) {
+		_gathered = std::make_shared<Tensor>(_dims, _name + "_gathered", device ? GPU_ONLY_POLICY : CPU_ONLY_POLICY);
+		_gathered_stale = true;
+	}
+	if (_gathered_stale) {
+		if (device) {
+			_gather_gpu(_shadow_tensor->gpu_data() + _view_offset, _gathered->gpu_data());
+		}
+		else {
+			auto dense = contiguous_strides(_dims);
+			CpuTranspose::copy(4, _dims.data(), _shadow_tensor->cpu_data() + _view_offset, _strides.data(), _gathered->cpu_data(), dense.data());
+		}
+		_gathered_stale = false;
+	}
+	return device ? _gathered->gpu_data() : _gathered->cpu_data();
+}
+
+bool Tensor::is_read_only() const
+{
+	return _location == SHADOW ? _shadow_tensor->is_read_only() : _read_only;
+}
+
 size_t Tensor::used_gpu()
 {
 	return _used_gpu_mem_size;	
 }
+
+size_t Tensor::allocated_by_thread()
+{
+	return _thread_allocated_bytes;
+}
+
+void Tensor::add_allocated_by_thread(size_t bytes)
+{
+	_thread_allocated_bytes += bytes;
+}
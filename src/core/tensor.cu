@@ -0,0 +1,23 @@
+#include "core/tensor.h"
+
+__global__
+void StridedGatherKernel(const int n, const int C, const int H, const int W, const float *src, const ptrdiff_t sn, const ptrdiff_t sc, const ptrdiff_t sh, const ptrdiff_t sw, float *dst)
+{
+	int i = blockIdx.x*blockDim.x + threadIdx.x;
+	if (i < n) {
+		int temp = i;
+		const int w = temp % W;
+		temp /= W;
+		const int h = temp % H;
+		temp /= H;
+		const int c = temp % C;
+		const int s = temp / C;
+		dst[i] = src[s * sn + c * sc + h * sh + w * sw];
+	}
+}
+
+void Tensor::_gather_gpu(const float *src, float *dst) const
+{
+	StridedGatherKernel << < numOfBlocks(_size), maxThreadsPerBlock >> > (_size, _dims[1], _dims[2], _dims[3], src, _strides[0], _strides[1], _strides[2], _strides[3], dst);
+	DF_KERNEL_CHECK();
+}
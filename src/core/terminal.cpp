@@ -39,6 +39,21 @@ std::shared_ptr<Terminal> NodeInput::connectedTerminal() const
 	return _connected_terminal;
 }
 
+uint64_t NodeInput::version() const
+{
+	return std::static_pointer_cast<NodeOutput>(_connected_terminal)->version();
+}
+
+void NodeInput::set_requires_grad(bool status)
+{
+	_requires_grad = status;
+}
+
+bool NodeInput::requires_grad() const
+{
+	return _requires_grad;
+}
+
 const std::string& NodeOutput::name() const {
 	return _name;
 }
@@ -76,6 +91,16 @@ bool NodeOutput::enabled() const
 	return _enabled;
 }
 
+uint64_t NodeOutput::version() const
+{
+	return _version;
+}
+
+void NodeOutput::bump_version()
+{
+	_version = ++_last_version;
+}
+
 const int& Terminal::index() const {
 	return _index;
 }
@@ -97,8 +122,11 @@ std::shared_ptr<Node> Terminal::parentNode() const {
 NodeInput::NodeInput(std::shared_ptr<Node> parentNode, int index) : Terminal(parentNode, index, TerminalType::Input) {
 }
 
+std::atomic<uint64_t> NodeOutput::_last_version(0);
+
 NodeOutput::NodeOutput(std::shared_ptr<Node> parentNode, int index, const std::string &name) : Terminal(parentNode, index, TerminalType::Output) {
 	_name = name;
+	bump_version();
 }
 
 std::shared_ptr<Tensor> NodeInput::value() {	
@@ -106,7 +134,7 @@ std::shared_ptr<Tensor> NodeInput::value() {
 }
 
 std::shared_ptr<Tensor> NodeInput::diff() {
-	if (_connected_terminal)
+	if (_connected_terminal && _requires_grad)
 		return _connected_terminal->diff();
 	else
 		return nullptr;
@@ -122,20 +150,44 @@ std::shared_ptr<Tensor> NodeOutput::diff() {
 
 void NodeOutput::initValue(std::array<int, 4> dims) {
 	LOG_IF(FATAL, _value != nullptr) << "_value != nullptr";
-	_value = std::make_shared<Tensor>(dims, _name + "_v", _parentNode->policy());
+	if (_arena)
+		_value = std::make_shared<Tensor>(dims, _arena, _arena_offset, _name + "_v");
+	else
+		_value = std::make_shared<Tensor>(dims, _name + "_v", _parentNode->policy());
+	_value->set_layout((Tensor::Layout) _parentNode->param()->layout());
 }
 
 void NodeOutput::initValue(std::array<int, 4> dims, std::shared_ptr<Tensor> tensor)
 {
 	LOG_IF(FATAL, _value != nullptr) << "_value != nullptr";
 	_value = std::make_shared<Tensor>(dims, tensor, _name + "_v");
+	_value->set_layout((Tensor::Layout) _parentNode->param()->layout());
+}
+
+void NodeOutput::initValue(std::array<int, 4> dims, std::shared_ptr<Tensor> tensor, size_t offset, std::array<ptrdiff_t, 4> strides)
+{
+	LOG_IF(FATAL, _value != nullptr) << "_value != nullptr";
+	_value = std::make_shared<Tensor>(dims, tensor, offset, strides, _name + "_v");
+	_value->set_layout((Tensor::Layout) _parentNode->param()->layout());
+}
+
+void NodeOutput::planValue(std::shared_ptr<Tensor> arena, size_t offset)
+{
+	LOG_IF(FATAL, _value != nullptr) << "_value != nullptr";
+	_arena = arena;
+	_arena_offset = offset;
 }
 
 void NodeOutput::initDiff()
 {
 	LOG_IF(FATAL, _value == nullptr) << "_value == nullptr";
 	LOG_IF(FATAL, _diff != nullptr) << "_diff != nullptr";
-	_diff = std::make_shared<Tensor>(_value->dims(), _name + "_d", _parentNode->policy());
+	// Frozen graphs never run backward, the diff only carries the descriptor and aliases the value.
+	if (_parentNode->isFrozen())
+		_diff = std::make_shared<Tensor>(_value->dims(), _value, _name + "_d");
+	else
+		_diff = std::make_shared<Tensor>(_value->dims(), _name + "_d", _parentNode->policy());
+	_diff->set_layout(_value->layout());
 }
 
 void NodeOutput::initDiff(std::array<int, 4> dims, std::shared_ptr<Tensor> tensor)
@@ -143,7 +195,10 @@ void NodeOutput::initDiff(std::array<int, 4> dims, std::shared_ptr<Tensor> tenso
 	LOG_IF(FATAL, _value == nullptr) << "_value == nullptr";
 	LOG_IF(FATAL, _diff != nullptr) << "_diff != nullptr";
 	LOG_IF(FATAL, dims != _value->dims()) << "dims != _value->dims()";
+	if (tensor == nullptr && _parentNode->isFrozen())
+		tensor = _value;
 	_diff = std::make_shared<Tensor>(dims, tensor, _name + "_d");
+	_diff->set_layout(_value->layout());
 }
 
 void NodeOutput::resetDiff()
@@ -156,6 +211,7 @@ void NodeOutput::resetDiff()
 void NodeOutput::resetValue()
 {
 	_value->reset();	
+	bump_version();
 }
 
 std::array<int, 4> NodeInput::dims() {
@@ -169,4 +225,5 @@ std::array<int, 4> NodeOutput::dims() {
 void NodeOutput::feed(std::shared_ptr<NodeOutput> t) {
 	LOG_IF(FATAL, t->value()->bytes() != value()->bytes()) << "Size mismatch between terminals: " << _name << " and " << t->name();
 	DF_NODE_CUDA_CHECK(cudaMemcpy(value()->gpu_data(), t->value()->gpu_data(), value()->bytes(), cudaMemcpyDeviceToDevice));	
+	bump_version();
 }
\ No newline at end of file
@@ -10,9 +10,12 @@ Constant::Constant(deepflow::InitParam * param) : Initializer(param)
 void Constant::apply(Node * node)
 {
 	LOG_IF(FATAL, _param->constant_param().values().size() != node->output(0)->value()->size());
-	DF_CUDA_CHECK(
-		cudaMemcpy(node->output(0)->value()->gpu_data(), _param->constant_param().values().data(), node->output(0)->value()->bytes(), cudaMemcpyHostToDevice)
-	);
+	if (node->is_cpu())
+		memcpy(node->output(0)->value()->cpu_data(), _param->constant_param().values().data(), node->output(0)->value()->bytes());
+	else
+		DF_CUDA_CHECK(
+			cudaMemcpy(node->output(0)->value()->gpu_data(), _param->constant_param().values().data(), node->output(0)->value()->bytes(), cudaMemcpyHostToDevice)
+		);
 }
 
 std::string Constant::to_cpp() const
@@ -18,6 +18,10 @@ void Fill::apply(Node *node) {
 	auto size = node->output(0)->value()->size();
 	float value = _param->fill_param().value();
 	for (auto output : node->outputs()) {		
+		if (node->is_cpu()) {
+			std::fill_n(output->value()->cpu_data(), size, value);
+			continue;
+		}
 		FillKernel << < numOfBlocks(size), maxThreadsPerBlock >> > (size, (float*)output->value()->gpu_data(), value);
 		DF_KERNEL_CHECK();
 	}
@@ -16,7 +16,10 @@ void RandomNormal::apply(Node *node) {
 	for (auto output : node->outputs()) {		
 		for (int i = 0; i < size; ++i)
 			h_rand[i] = distribution(generator);
-		DF_CUDA_CHECK(cudaMemcpy((float*)output->value()->gpu_data(), h_rand, output->value()->bytes(), cudaMemcpyHostToDevice));
+		if (node->is_cpu())
+			memcpy(output->value()->cpu_data(), h_rand, output->value()->bytes());
+		else
+			DF_CUDA_CHECK(cudaMemcpy((float*)output->value()->gpu_data(), h_rand, output->value()->bytes(), cudaMemcpyHostToDevice));
 	}
 	delete [] h_rand;
 }
@@ -22,7 +22,10 @@ void ThreeState::apply(Node *node)
 			else
 				h_rand[i] = 1;
 		}
-		DF_CUDA_CHECK(cudaMemcpy((float*)output->value()->gpu_data(), h_rand, output->value()->bytes(), cudaMemcpyHostToDevice));
+		if (node->is_cpu())
+			memcpy(output->value()->cpu_data(), h_rand, output->value()->bytes());
+		else
+			DF_CUDA_CHECK(cudaMemcpy((float*)output->value()->gpu_data(), h_rand, output->value()->bytes(), cudaMemcpyHostToDevice));
 	}
 	delete[] h_rand;
 }
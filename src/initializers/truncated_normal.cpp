@@ -20,7 +20,10 @@ void TruncatedNormal::apply(Node *node) {
 				value = distribution(generator);
 			h_rand[i] = value;
 		}
-		DF_CUDA_CHECK(cudaMemcpy((float*)output->value()->gpu_data(), h_rand, output->value()->bytes(), cudaMemcpyHostToDevice));
+		if (node->is_cpu())
+			memcpy(output->value()->cpu_data(), h_rand, output->value()->bytes());
+		else
+			DF_CUDA_CHECK(cudaMemcpy((float*)output->value()->gpu_data(), h_rand, output->value()->bytes(), cudaMemcpyHostToDevice));
 	}
 	delete[] h_rand;
 }
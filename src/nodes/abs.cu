@@ -1,5 +1,6 @@
 #include "nodes/abs.h"
 #include "core/common_cu.h"
+#include "core/cpu_elementwise.h"
 
 __global__
 void AbsKernelForward(const int n, const float * __restrict__ x, float * __restrict__ y)
@@ -28,12 +29,19 @@ void Abs::init() {
 
 void Abs::forward() {
 	auto size = _inputs[0]->value()->size();
+	if (is_cpu()) {
+		CpuElementwise::abs_forward(size, _inputs[0]->value()->cpu_data(), _outputs[0]->value()->cpu_data());
+		return;
+	}
 	AbsKernelForward << < numOfBlocks(size), maxThreadsPerBlock >> > (size, _inputs[0]->value()->gpu_data(), (float*)_outputs[0]->value()->gpu_data());
 	DF_KERNEL_CHECK();
 }
 
 void Abs::backward() {
-	if (_inputs[0]->diff()) {
+	if (_inputs[0]->diff() && is_cpu()) {
+		CpuElementwise::abs_backward(_inputs[0]->value()->size(), _inputs[0]->value()->cpu_data(), _outputs[0]->diff()->cpu_data(), _inputs[0]->diff()->cpu_data());
+	}
+	else if (_inputs[0]->diff()) {
 		auto size = _inputs[0]->value()->size();
 		AbsKernelBackward << < numOfBlocks(size), maxThreadsPerBlock >> > (size, _inputs[0]->value()->gpu_data(), _outputs[0]->diff()->gpu_data(), (float*)_inputs[0]->diff()->gpu_data());
 		DF_KERNEL_CHECK();
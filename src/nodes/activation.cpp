@@ -1,5 +1,6 @@
 #include "core/common_cu.h"
 #include "nodes/activation.h"
+#include "core/cpu_elementwise.h"
 
 Activation::Activation(deepflow::NodeParam *param) : Node(param)
 {
@@ -33,10 +34,15 @@ std::string Activation::op_name() const
 void Activation::init()
 {	
 	auto activation_param = _param->activation_param();
-	cudnnActivationMode_t _activation_mode =  (cudnnActivationMode_t) activation_param.type();
-	float coef = activation_param.coef();
+	_activation_mode = (cudnnActivationMode_t) activation_param.type();
+	_coef = activation_param.coef();
+	if (is_cpu()) {
+		_outputs[0]->initValue(_inputs[0]->value()->dims());
+		_outputs[0]->initDiff();
+		return;
+	}
 	DF_NODE_CUDNN_CHECK(cudnnCreateActivationDescriptor(&_activation_desc));
-	DF_NODE_CUDNN_CHECK(cudnnSetActivationDescriptor(_activation_desc, _activation_mode, CUDNN_PROPAGATE_NAN, coef));
+	DF_NODE_CUDNN_CHECK(cudnnSetActivationDescriptor(_activation_desc, _activation_mode, CUDNN_PROPAGATE_NAN, _coef));
 	DF_NODE_CUDNN_CHECK(cudnnCreate(&_cudnnHandle));
 	_outputs[0]->initValue(_inputs[0]->value()->dims());
 	_outputs[0]->initDiff();
@@ -44,12 +50,19 @@ void Activation::init()
 
 void Activation::forward()
 {
+	if (is_cpu()) {
+		CpuElementwise::activation_forward(math_accuracy(), _activation_mode, _coef, _inputs[0]->value()->size(), _inputs[0]->value()->cpu_data(), _outputs[0]->value()->cpu_data());
+		return;
+	}
 	DF_NODE_CUDNN_CHECK(cudnnActivationForward(_cudnnHandle, _activation_desc, &one, _inputs[0]->value()->descriptor(), _inputs[0]->value()->gpu_data(), &zero, _outputs[0]->value()->descriptor(), _outputs[0]->value()->gpu_data()));	
 }
 
 void Activation::backward()
 {
-	if (_inputs[0]->diff()) {
+	if (_inputs[0]->diff() && is_cpu()) {
+		CpuElementwise::activation_backward(_activation_mode, _coef, _inputs[0]->value()->size(), _inputs[0]->value()->cpu_data(), _outputs[0]->value()->cpu_data(), _outputs[0]->diff()->cpu_data(), _inputs[0]->diff()->cpu_data());
+	}
+	else if (_inputs[0]->diff()) {
 		DF_NODE_CUDNN_CHECK(cudnnActivationBackward(_cudnnHandle, _activation_desc, &one, _outputs[0]->value()->descriptor(), _outputs[0]->value()->gpu_data(), _outputs[0]->diff()->descriptor(), _outputs[0]->diff()->gpu_data(), _inputs[0]->value()->descriptor(), _inputs[0]->value()->gpu_data(), &zero, _inputs[0]->diff()->descriptor(), _inputs[0]->diff()->gpu_data()));		
 	}
 }
@@ -1,6 +1,7 @@
 #include "core/common_cu.h"
 
 #include "nodes/add.h"
+#include "core/cpu_elementwise.h"
 
 Add::Add(deepflow::NodeParam *param) : Node(param) {
 	LOG_IF(FATAL, param->has_add_param() == false) << "param.has_add_param() == false";	
@@ -32,6 +33,11 @@ void Add::init() {
 
 	LOG_IF(FATAL, a->value()->size() != b->value()->size()) << _name << " - Different input sizes: " << a->value()->shape() << " vs " << b->value()->shape() ;		
 
+	if (is_cpu()) {
+		_outputs[0]->initValue(_inputs[0]->value()->dims());
+		_outputs[0]->initDiff();
+		return;
+	}
 	DF_NODE_CUDNN_CHECK(cudnnCreate(&_cudnnHandle));
 	cudnnCreateOpTensorDescriptor(&_opTensorDesc);
 	cudnnSetOpTensorDescriptor(_opTensorDesc, CUDNN_OP_TENSOR_ADD, CUDNN_DATA_FLOAT, CUDNN_PROPAGATE_NAN);
@@ -40,12 +46,24 @@ void Add::init() {
 }
 
 void Add::forward() {	
+	if (is_cpu()) {
+		CpuElementwise::add(_outputs[0]->value()->size(), _alpha, _inputs[0]->value()->cpu_data(), _beta, _inputs[1]->value()->cpu_data(), _outputs[0]->value()->cpu_data());
+		return;
+	}
 	DF_NODE_CUDNN_CHECK(
 	cudnnOpTensor(_cudnnHandle, _opTensorDesc, &_alpha, _inputs[0]->value()->descriptor(), _inputs[0]->value()->gpu_data(), &_beta, _inputs[1]->value()->descriptor(), _inputs[1]->value()->gpu_data(), &zero, _outputs[0]->value()->descriptor(), _outputs[0]->value()->gpu_data())
 	);
 }
 
 void Add::backward() {
+	if (is_cpu()) {
+		auto size = _outputs[0]->diff()->size();
+		if (_inputs[0]->diff())
+			CpuElementwise::axpby(size, _alpha, _outputs[0]->diff()->cpu_data(), 0, _inputs[0]->diff()->cpu_data());
+		if (_inputs[1]->diff())
+			CpuElementwise::axpby(size, _beta, _outputs[0]->diff()->cpu_data(), 0, _inputs[1]->diff()->cpu_data());
+		return;
+	}
 	if (_inputs[0]->diff()) {
 		cudaMemcpy(_inputs[0]->diff()->gpu_data(), _outputs[0]->diff()->gpu_data(), _outputs[0]->diff()->bytes(), cudaMemcpyDeviceToDevice);
 		cudnnScaleTensor(_cudnnHandle, _inputs[0]->diff()->descriptor(), _inputs[0]->diff()->gpu_data(), &_alpha);
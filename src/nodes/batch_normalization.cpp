@@ -1,4 +1,317 @@
 #include "nodes/batch_normalization.h"
+#include "core/cpu_parallel.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// Host kernels. Statistics are accumulated in double: SPATIAL takes two passes over each row (mean,
+// then squared deviations) and merges the rows with Chan's formula, PER_ACTIVATION runs Welford
+// updates down the batch. The normalization is one fused multiply-add per element.
+
+static void bn_spatial_forward_training_cpu(const float *x, float *y, const float *scale, const float *bias, int N, int C, int HW, double eps, double factor, float *running_mean, float *running_var, float *saved_mean, float *saved_inv_std)
+{
+	CpuParallel::for_range(C, 1, [&](size_t begin, size_t end) {
+		for (size_t c = begin; c < end; ++c) {
+			double mean = 0, m2 = 0;
+			size_t count = 0;
+			for (int n = 0; n < N; ++n) {
+				const float *row = x + ((size_t)n * C + c) * HW;
+				double sum = 0;
+				for (int i = 0; i < HW; ++i)
+					sum += row[i];
+				const double row_mean = sum / HW;
+				double row_m2 = 0;
+				for (int i = 0; i < HW; ++i) {
+					const double d = row[i] - row_mean;
+					row_m2 += d * d;
+				}
+				const double delta = row_mean - mean;
+				const size_t total = count + HW;
+				mean += delta * HW / total;
+				m2 += row_m2 + delta * delta * ((double)count * HW / total);
+				count = total;
+			}
+			const double variance = m2 / count;
+			const double unbiased_variance = count > 1 ? m2 / (count - 1) : variance;
+			const float inv_std = (float)(1.0 / sqrt(variance + eps));
+			running_mean[c] = (float)((1.0 - factor) * running_mean[c] + factor * mean);
+			running_var[c] = (float)((1.0 - factor) * running_var[c] + factor * unbiased_variance);
+			saved_mean[c] = (float)mean;
+			saved_inv_std[c] = inv_std;
+			const float a = scale[c] * inv_std;
+			const float b = bias[c] - (float)mean * a;
+			for (int n = 0; n < N; ++n) {
+				const size_t offset = ((size_t)n * C + c) * HW;
+				const float *xr = x + offset;
+				float *yr = y + offset;
+				for (int i = 0; i < HW; ++i)
+					yr[i] = xr[i] * a + b;
+			}
+		}
+	});
+}
+
+static void bn_spatial_forward_inference_cpu(const float *x, float *y, const float *scale, const float *bias, int N, int C, int HW, double eps, const float *running_mean, const float *running_var)
+{
+	CpuParallel::for_range((size_t)N * C, 1, [&](size_t begin, size_t end) {
+		for (size_t row = begin; row < end; ++row) {
+			const int c = row % C;
+			const float a = (float)(scale[c] / sqrt(running_var[c] + eps));
+			const float b = bias[c] - running_mean[c] * a;
+			const float *xr = x + row * HW;
+			float *yr = y + row * HW;
+			for (int i = 0; i < HW; ++i)
+				yr[i] = xr[i] * a + b;
+		}
+	});
+}
+
+static void bn_spatial_backward_cpu(const float *x, const float *dy, float *dx, const float *scale, float *dscale, float *dbias, int N, int C, int HW, const float *saved_mean, const float *saved_inv_std)
+{
+	CpuParallel::for_range(C, 1, [&](size_t begin, size_t end) {
+		for (size_t c = begin; c < end; ++c) {
+			const float mean = saved_mean[c];
+			const float inv_std = saved_inv_std[c];
+			double sum_dy = 0, sum_dy_xc = 0;
+			for (int n = 0; n < N; ++n) {
+				const size_t offset = ((size_t)n * C + c) * HW;
+				const float *xr = x + offset;
+				const float *dyr = dy + offset;
+				for (int i = 0; i < HW; ++i) {
+					sum_dy += dyr[i];
+					sum_dy_xc += dyr[i] * (xr[i] - mean);
+				}
+			}
+			const double m = (double)N * HW;
+			dbias[c] = (float)sum_dy;
+			dscale[c] = (float)(sum_dy_xc * inv_std);
+			// dx = scale * inv_std / m * (m * dy - dbias - xhat * dscale) = a * dy + b * (x - mean) + d
+			const float a = scale[c] * inv_std;
+			const float b = (float)(-a * inv_std * inv_std * sum_dy_xc / m);
+			const float d = (float)(-a * sum_dy / m);
+			for (int n = 0; n < N; ++n) {
+				const size_t offset = ((size_t)n * C + c) * HW;
+				const float *xr = x + offset;
+				const float *dyr = dy + offset;
+				float *dxr = dx + offset;
+				for (int i = 0; i < HW; ++i)
+					dxr[i] = a * dyr[i] + b * (xr[i] - mean) + d;
+			}
+		}
+	});
+}
+
+// Channel blocked [N, C / block, HW, block] SPATIAL kernels (see CpuLayout). Each (n, channel block)
+// segment reduces its block of channels at once into per sample partials, which are merged in sample
+// order, so the statistics do not depend on the pool.
+static void bn_blocked_moments(const float *x, int N, int C, int HW, int block, double *mean, double *m2)
+{
+	const int blocks = C / block;
+	CpuParallel::for_range((size_t)N * blocks, 1, [&](size_t begin, size_t end) {
+		for (size_t segment = begin; segment < end; ++segment) {
+			const float *xs = x + segment * HW * block;
+			double *sm = mean + segment * block, *sq = m2 + segment * block;
+			std::fill(sm, sm + block, 0.0);
+			std::fill(sq, sq + block, 0.0);
+			for (int i = 0; i < HW; ++i)
+				for (int l = 0; l < block; ++l)
+					sm[l] += xs[(size_t)i * block + l];
+			for (int l = 0; l < block; ++l)
+				sm[l] /= HW;
+			for (int i = 0; i < HW; ++i)
+				for (int l = 0; l < block; ++l) {
+					const double d = xs[(size_t)i * block + l] - sm[l];
+					sq[l] += d * d;
+				}
+		}
+	});
+}
+
+// y = x * a[c] + b[c].
+static void bn_blocked_apply(const float *x, float *y, const float *a, const float *b, int N, int C, int HW, int block)
+{
+	const int blocks = C / block;
+	CpuParallel::for_range((size_t)N * blocks, 1, [&](size_t begin, size_t end) {
+		for (size_t segment = begin; segment < end; ++segment) {
+			const size_t offset = segment * HW * block;
+			const float *as = a + segment % blocks * block, *bs = b + segment % blocks * block;
+			for (int i = 0; i < HW; ++i)
+				for (int l = 0; l < block; ++l)
+					y[offset + (size_t)i * block + l] = x[offset + (size_t)i * block + l] * as[l] + bs[l];
+		}
+	});
+}
+
+static void bn_spatial_forward_training_blocked_cpu(const float *x, float *y, const float *scale, const float *bias, int N, int C, int HW, int block, double eps, double factor, float *running_mean, float *running_var, float *saved_mean, float *saved_inv_std)
+{
+	std::vector<double> means((size_t)N * C), m2s((size_t)N * C);
+	bn_blocked_moments(x, N, C, HW, block, means.data(), m2s.data());
+	std::vector<float> a(C), b(C);
+	const int blocks = C / block;
+	for (int c = 0; c < C; ++c) {
+		double mean = 0, m2 = 0;
+		size_t count = 0;
+		for (int n = 0; n < N; ++n) {
+			const size_t partial = ((size_t)n * blocks + c / block) * block + c % block;
+			const double delta = means[partial] - mean;
+			const size_t total = count + HW;
+			mean += delta * HW / total;
+			m2 += m2s[partial] + delta * delta * ((double)count * HW / total);
+			count = total;
+		}
+		const double variance = m2 / count;
+		const double unbiased_variance = count > 1 ? m2 / (count - 1) : variance;
+		const float inv_std = (float)(1.0 / sqrt(variance + eps));
+		running_mean[c] = (float)((1.0 - factor) * running_mean[c] + factor * mean);
+		running_var[c] = (float)((1.0 - factor) * running_var[c] + factor * unbiased_variance);
+		saved_mean[c] = (float)mean;
+		saved_inv_std[c] = inv_std;
+		a[c] = scale[c] * inv_std;
+		b[c] = bias[c] - (float)mean * a[c];
+	}
+	bn_blocked_apply(x, y, a.data(), b.data(), N, C, HW, block);
+}
+
+static void bn_spatial_forward_inference_blocked_cpu(const float *x, float *y, const float *scale, const float *bias, int N, int C, int HW, int block, double eps, const float *running_mean, const float *running_var)
+{
+	std::vector<float> a(C), b(C);
+	for (int c = 0; c < C; ++c) {
+		a[c] = (float)(scale[c] / sqrt(running_var[c] + eps));
+		b[c] = bias[c] - running_mean[c] * a[c];
+	}
+	bn_blocked_apply(x, y, a.data(), b.data(), N, C, HW, block);
+}
+
+static void bn_spatial_backward_blocked_cpu(const float *x, const float *dy, float *dx, const float *scale, float *dscale, float *dbias, int N, int C, int HW, int block, const float *saved_mean, const float *saved_inv_std)
+{
+	const int blocks = C / block;
+	std::vector<double> sums_dy((size_t)N * C), sums_dy_xc((size_t)N * C);
+	CpuParallel::for_range((size_t)N * blocks, 1, [&](size_t begin, size_t end) {
+		for (size_t segment = begin; segment < end; ++segment) {
+			const size_t offset = segment * HW * block;
+			const float *mean = saved_mean + segment % blocks * block;
+			double *sd = &sums_dy[segment * block], *sx = &sums_dy_xc[segment * block];
+			std::fill(sd, sd + block, 0.0);
+			std::fill(sx, sx + block, 0.0);
+			for (int i = 0; i < HW; ++i)
+				for (int l = 0; l < block; ++l) {
+					const size_t j = offset + (size_t)i * block + l;
+					sd[l] += dy[j];
+					sx[l] += dy[j] * (x[j] - mean[l]);
+				}
+		}
+	});
+	// dx = a * dy + b * (x - mean) + d as in bn_spatial_backward_cpu.
+	std::vector<float> a(C), b(C), d(C);
+	const double m = (double)N * HW;
+	for (int c = 0; c < C; ++c) {
+		double sum_dy = 0, sum_dy_xc = 0;
+		for (int n = 0; n < N; ++n) {
+			const size_t partial = ((size_t)n * blocks + c / block) * block + c % block;
+			sum_dy += sums_dy[partial];
+			sum_dy_xc += sums_dy_xc[partial];
+		}
+		const float inv_std = saved_inv_std[c];
+		dbias[c] = (float)sum_dy;
+		dscale[c] = (float)(sum_dy_xc * inv_std);
+		a[c] = scale[c] * inv_std;
+		b[c] = (float)(-a[c] * inv_std * inv_std * sum_dy_xc / m);
+		d[c] = (float)(-a[c] * sum_dy / m);
+	}
+	CpuParallel::for_range((size_t)N * blocks, 1, [&](size_t begin, size_t end) {
+		for (size_t segment = begin; segment < end; ++segment) {
+			const size_t offset = segment * HW * block, first = segment % blocks * block;
+			for (int i = 0; i < HW; ++i)
+				for (int l = 0; l < block; ++l) {
+					const size_t j = offset + (size_t)i * block + l, c = first + l;
+					dx[j] = a[c] * dy[j] + b[c] * (x[j] - saved_mean[c]) + d[c];
+				}
+		}
+	});
+}
+
+static void bn_per_activation_forward_training_cpu(const float *x, float *y, const float *scale, const float *bias, int N, int F, double eps, double factor, float *running_mean, float *running_var, float *saved_mean, float *saved_inv_std)
+{
+	CpuParallel::for_range(F, 256, [&](size_t begin, size_t end) {
+		const int len = end - begin;
+		std::vector<double> mean(len, 0.0), m2(len, 0.0);
+		for (int n = 0; n < N; ++n) {
+			const float *xr = x + (size_t)n * F + begin;
+			const double inv_count = 1.0 / (n + 1);
+			for (int f = 0; f < len; ++f) {
+				const double d = xr[f] - mean[f];
+				mean[f] += d * inv_count;
+				m2[f] += d * (xr[f] - mean[f]);
+			}
+		}
+		for (int f = 0; f < len; ++f) {
+			const size_t i = begin + f;
+			const double variance = m2[f] / N;
+			const double unbiased_variance = N > 1 ? m2[f] / (N - 1) : variance;
+			running_mean[i] = (float)((1.0 - factor) * running_mean[i] + factor * mean[f]);
+			running_var[i] = (float)((1.0 - factor) * running_var[i] + factor * unbiased_variance);
+			saved_mean[i] = (float)mean[f];
+			saved_inv_std[i] = (float)(1.0 / sqrt(variance + eps));
+		}
+		for (int n = 0; n < N; ++n) {
+			const size_t offset = (size_t)n * F + begin;
+			for (int f = 0; f < len; ++f) {
+				const float a = scale[begin + f] * saved_inv_std[begin + f];
+				y[offset + f] = (x[offset + f] - saved_mean[begin + f]) * a + bias[begin + f];
+			}
+		}
+	});
+}
+
+static void bn_per_activation_forward_inference_cpu(const float *x, float *y, const float *scale, const float *bias, int N, int F, double eps, const float *running_mean, const float *running_var)
+{
+	CpuParallel::for_range(F, 256, [&](size_t begin, size_t end) {
+		const int len = end - begin;
+		std::vector<float> a(len), b(len);
+		for (int f = 0; f < len; ++f) {
+			const size_t i = begin + f;
+			a[f] = (float)(scale[i] / sqrt(running_var[i] + eps));
+			b[f] = bias[i] - running_mean[i] * a[f];
+		}
+		for (int n = 0; n < N; ++n) {
+			const size_t offset = (size_t)n * F + begin;
+			for (int f = 0; f < len; ++f)
+				y[offset + f] = x[offset + f] * a[f] + b[f];
+		}
+	});
+}
+
+static void bn_per_activation_backward_cpu(const float *x, const float *dy, float *dx, const float *scale, float *dscale, float *dbias, int N, int F, const float *saved_mean, const float *saved_inv_std)
+{
+	CpuParallel::for_range(F, 256, [&](size_t begin, size_t end) {
+		const int len = end - begin;
+		std::vector<float> sum_dy(len, 0), sum_dy_xc(len, 0);
+		for (int n = 0; n < N; ++n) {
+			const size_t offset = (size_t)n * F + begin;
+			for (int f = 0; f < len; ++f) {
+				sum_dy[f] += dy[offset + f];
+				sum_dy_xc[f] += dy[offset + f] * (x[offset + f] - saved_mean[begin + f]);
+			}
+		}
+		for (int f = 0; f < len; ++f) {
+			const size_t i = begin + f;
+			dbias[i] = sum_dy[f];
+			dscale[i] = sum_dy_xc[f] * saved_inv_std[i];
+			const float a = scale[i] * saved_inv_std[i];
+			sum_dy_xc[f] = -a * saved_inv_std[i] * saved_inv_std[i] * sum_dy_xc[f] / N;
+			sum_dy[f] = -a * sum_dy[f] / N;
+		}
+		for (int n = 0; n < N; ++n) {
+			const size_t offset = (size_t)n * F + begin;
+			for (int f = 0; f < len; ++f) {
+				const size_t i = begin + f;
+				dx[offset + f] = scale[i] * saved_inv_std[i] * dy[offset + f] + sum_dy_xc[f] * (x[offset + f] - saved_mean[i]) + sum_dy[f];
+			}
+		}
+	});
+}
+
 
 BatchNormalization::BatchNormalization(deepflow::NodeParam *param) : Node(param)
 {
@@ -37,11 +350,39 @@ void BatchNormalization::init()
 		LOG(FATAL) << "Unsupported batch normalization mode.";
 	}		
 	_bnScaleBiasMeanVarSizeInBytes = _bnScaleBiasMeanVarSize * sizeof(float);
-	DF_NODE_CUDNN_CHECK(cudnnCreate(&_cudnnHandle));	
 	
 	LOG_IF(FATAL, _inputs[1]->value()->dims() != scaleBiasExpectedDims || _inputs[2]->value()->dims() != scaleBiasExpectedDims) << _name << ": Expected dimention of scale and bias vector are " <<
 		scaleBiasExpectedDims[0] << "x" << scaleBiasExpectedDims[1] << "x" << scaleBiasExpectedDims[2] << "x" << scaleBiasExpectedDims[3];
 
+	_exp_avg_factor = param.exp_avg_factor();
+	_eps = param.eps();
+	if (_eps < CUDNN_BN_MIN_EPSILON)
+		_eps = CUDNN_BN_MIN_EPSILON;
+	LOG_IF(FATAL, _exp_avg_factor == 0) << "Average factor cannot be zero.";
+
+	if (is_cpu()) {
+		// The host backward always uses the saved batch statistics.
+		LOG_IF(FATAL, param.has_mean() && param.mean().data_size() != _bnScaleBiasMeanVarSize);
+		LOG_IF(FATAL, param.has_var() && param.var().data_size() != _bnScaleBiasMeanVarSize);
+		if (param.has_mean())
+			_hostRunningMean.assign(param.mean().data().begin(), param.mean().data().end());
+		else
+			_hostRunningMean.assign(_bnScaleBiasMeanVarSize, 0.0f);
+		if (param.has_var())
+			_hostRunningVariance.assign(param.var().data().begin(), param.var().data().end());
+		else
+			_hostRunningVariance.assign(_bnScaleBiasMeanVarSize, 1.0f);
+		_hostCachedMean.resize(_bnScaleBiasMeanVarSize);
+		_hostCachedVariance.resize(_bnScaleBiasMeanVarSize);
+		Tensor::add_allocated_by_thread(4 * _bnScaleBiasMeanVarSizeInBytes);
+		LOG_IF(FATAL, input->value()->layout() != output->value()->layout()) << _name << " - Input and output layouts differ.";
+		LOG_IF(FATAL, output->value()->channel_block() != 1 && _bnMode != CUDNN_BATCHNORM_SPATIAL) << _name << " - Per activation batch normalization is NCHW only.";
+		_outputs[0]->initDiff();
+		return;
+	}
+
+	DF_NODE_CUDNN_CHECK(cudnnCreate(&_cudnnHandle));	
+
 	DF_NODE_CUDA_CHECK(cudaMalloc(&_runningMean, _bnScaleBiasMeanVarSizeInBytes));
 	DF_NODE_CUDA_CHECK(cudaMalloc(&_runningVariance, _bnScaleBiasMeanVarSizeInBytes));
 	if (param.has_mean()) {
@@ -64,18 +405,41 @@ void BatchNormalization::init()
 		DF_NODE_CUDA_CHECK(cudaMalloc(&_cachedMean, _bnScaleBiasMeanVarSizeInBytes));
 		DF_NODE_CUDA_CHECK(cudaMalloc(&_cachedVariance, _bnScaleBiasMeanVarSizeInBytes));
 	}	
-
-	_exp_avg_factor = param.exp_avg_factor();
-	_eps = param.eps();
-	if (_eps < CUDNN_BN_MIN_EPSILON)
-		_eps = CUDNN_BN_MIN_EPSILON;
-	LOG_IF(FATAL, _exp_avg_factor == 0) << "Average factor cannot be zero.";
+	Tensor::add_allocated_by_thread((cache ? 4 : 2) * _bnScaleBiasMeanVarSizeInBytes);
 
 	_outputs[0]->initDiff();		
 }
 
 void BatchNormalization::forward()
 {
+	if (is_cpu()) {
+		auto dims = _inputs[0]->value()->dims();
+		const float *x = _inputs[0]->value()->cpu_data();
+		float *y = _outputs[0]->value()->cpu_data();
+		const float *scale = _inputs[1]->value()->cpu_data();
+		const float *bias = _inputs[2]->value()->cpu_data();
+		bool spatial = _bnMode == CUDNN_BATCHNORM_SPATIAL;
+		const int block = _inputs[0]->value()->channel_block();
+		if (block != 1) {
+			if (_context->execution_mode == ExecutionContext::TRAIN)
+				bn_spatial_forward_training_blocked_cpu(x, y, scale, bias, dims[0], dims[1], dims[2] * dims[3], block, _eps, _exp_avg_factor, _hostRunningMean.data(), _hostRunningVariance.data(), _hostCachedMean.data(), _hostCachedVariance.data());
+			else
+				bn_spatial_forward_inference_blocked_cpu(x, y, scale, bias, dims[0], dims[1], dims[2] * dims[3], block, _eps, _hostRunningMean.data(), _hostRunningVariance.data());
+		}
+		else if (_context->execution_mode == ExecutionContext::TRAIN) {
+			if (spatial)
+				bn_spatial_forward_training_cpu(x, y, scale, bias, dims[0], dims[1], dims[2] * dims[3], _eps, _exp_avg_factor, _hostRunningMean.data(), _hostRunningVariance.data(), _hostCachedMean.data(), _hostCachedVariance.data());
+			else
+				bn_per_activation_forward_training_cpu(x, y, scale, bias, dims[0], dims[1] * dims[2] * dims[3], _eps, _exp_avg_factor, _hostRunningMean.data(), _hostRunningVariance.data(), _hostCachedMean.data(), _hostCachedVariance.data());
+		}
+		else {
+			if (spatial)
+				bn_spatial_forward_inference_cpu(x, y, scale, bias, dims[0], dims[1], dims[2] * dims[3], _eps, _hostRunningMean.data(), _hostRunningVariance.data());
+			else
+				bn_per_activation_forward_inference_cpu(x, y, scale, bias, dims[0], dims[1] * dims[2] * dims[3], _eps, _hostRunningMean.data(), _hostRunningVariance.data());
+		}
+		return;
+	}
 	float * _x = _inputs[0]->value()->gpu_data();
 	float * _y = _outputs[0]->value()->gpu_data();
 	float *_bnScale = _inputs[1]->value()->gpu_data();
@@ -125,13 +489,37 @@ void BatchNormalization::forward()
 
 void BatchNormalization::backward()
 {		
-	if (_inputs[0]->diff()) {
+	if (!_inputs[0]->diff() && !_inputs[1]->diff() && !_inputs[2]->diff())
+		return;
+	// The three gradients come together, those nobody needs go to the unread diffs of their producers.
+	auto x_diff = _inputs[0]->connectedTerminal()->diff();
+	auto scale_diff = _inputs[1]->connectedTerminal()->diff();
+	auto bias_diff = _inputs[2]->connectedTerminal()->diff();
+	if (!x_diff)
+		return;
+	if (is_cpu()) {
+		auto dims = _inputs[0]->value()->dims();
+		const float *x = _inputs[0]->value()->cpu_data();
+		const float *dy = _outputs[0]->diff()->cpu_data();
+		float *dx = x_diff->cpu_data();
+		const float *scale = _inputs[1]->value()->cpu_data();
+		float *dscale = scale_diff->cpu_data();
+		float *dbias = bias_diff->cpu_data();
+		const int block = _inputs[0]->value()->channel_block();
+		if (block != 1)
+			bn_spatial_backward_blocked_cpu(x, dy, dx, scale, dscale, dbias, dims[0], dims[1], dims[2] * dims[3], block, _hostCachedMean.data(), _hostCachedVariance.data());
+		else if (_bnMode == CUDNN_BATCHNORM_SPATIAL)
+			bn_spatial_backward_cpu(x, dy, dx, scale, dscale, dbias, dims[0], dims[1], dims[2] * dims[3], _hostCachedMean.data(), _hostCachedVariance.data());
+		else
+			bn_per_activation_backward_cpu(x, dy, dx, scale, dscale, dbias, dims[0], dims[1] * dims[2] * dims[3], _hostCachedMean.data(), _hostCachedVariance.data());
+	}
+	else {
 		float *_dy = _outputs[0]->diff()->gpu_data();
-		float *_dx = _inputs[0]->diff()->gpu_data();
+		float *_dx = x_diff->gpu_data();
 		float * _x = _inputs[0]->value()->gpu_data();
 		float *_bnScale = _inputs[1]->value()->gpu_data();		
-		float * _resultBnScaleDiff = (float*)_inputs[1]->diff()->gpu_data();
-		float * _resultBnBiasDiff = (float*)_inputs[2]->diff()->gpu_data();
+		float * _resultBnScaleDiff = (float*)scale_diff->gpu_data();
+		float * _resultBnBiasDiff = (float*)bias_diff->gpu_data();
 		DF_NODE_CUDNN_CHECK(
 			cudnnBatchNormalizationBackward(
 				_cudnnHandle,
@@ -165,13 +553,19 @@ void BatchNormalization::prep_for_saving()
 	auto mutable_mean_data = mutable_mean->mutable_data();
 	mutable_mean_data->Resize(_bnScaleBiasMeanVarSize, 0);
 	LOG_IF(FATAL, mutable_mean_data->size() != _bnScaleBiasMeanVarSize);
-	DF_NODE_CUDA_CHECK(cudaMemcpy(mutable_mean_data->mutable_data(), _runningMean, _bnScaleBiasMeanVarSizeInBytes, cudaMemcpyDeviceToHost));
+	if (is_cpu())
+		memcpy(mutable_mean_data->mutable_data(), _hostRunningMean.data(), _bnScaleBiasMeanVarSizeInBytes);
+	else
+		DF_NODE_CUDA_CHECK(cudaMemcpy(mutable_mean_data->mutable_data(), _runningMean, _bnScaleBiasMeanVarSizeInBytes, cudaMemcpyDeviceToHost));
 
 	auto mutable_var = bn_param->mutable_var();
 	auto mutable_var_data = mutable_var->mutable_data();
 	mutable_var_data->Resize(_bnScaleBiasMeanVarSize, 0);
 	LOG_IF(FATAL, mutable_var_data->size() != _bnScaleBiasMeanVarSize);
-	DF_NODE_CUDA_CHECK(cudaMemcpy(mutable_var_data->mutable_data(), _runningVariance, _bnScaleBiasMeanVarSizeInBytes, cudaMemcpyDeviceToHost));
+	if (is_cpu())
+		memcpy(mutable_var_data->mutable_data(), _hostRunningVariance.data(), _bnScaleBiasMeanVarSizeInBytes);
+	else
+		DF_NODE_CUDA_CHECK(cudaMemcpy(mutable_var_data->mutable_data(), _runningVariance, _bnScaleBiasMeanVarSizeInBytes, cudaMemcpyDeviceToHost));
 	
 }
 
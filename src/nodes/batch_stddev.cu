@@ -1,4 +1,5 @@
 #include "nodes\batch_stddev.h"
+#include "core/cpu_reduction.h"
 
 __global__
 void StdDevKernel(const int n, const int inner_dim, const float *in, const float *avg, float *out)
@@ -17,10 +18,16 @@ BatchStdDev::BatchStdDev(deepflow::NodeParam * param) : Node(param)
 void BatchStdDev::init()
 {	
 	auto inputDims = _inputs[0]->value()->dims();
+	_inner_dim = inputDims[1] * inputDims[2] * inputDims[3];
+	if (is_cpu()) {
+		_avg.resize(_inner_dim);
+		_std.resize(_inner_dim);
+		_outputs[0]->initValue({ 1,1,1,1 });
+		return;
+	}
 	DF_NODE_CUDNN_CHECK(cudnnCreate(&_cudnnHandle));	
 	DF_NODE_CUDNN_CHECK(cudnnCreateTensorDescriptor(&_avgDesc1));
 	DF_NODE_CUDNN_CHECK(cudnnSetTensor4dDescriptor(_avgDesc1, CUDNN_TENSOR_NCHW, CUDNN_DATA_FLOAT, 1, inputDims[1], inputDims[2], inputDims[3]));
-	_inner_dim = inputDims[1] * inputDims[2] * inputDims[3];
 	DF_NODE_CUDA_CHECK(cudaMalloc(&_d_avg, _inner_dim * sizeof(float)));
 	DF_NODE_CUDA_CHECK(cudaMalloc(&_d_std, _inner_dim * sizeof(float)));
 	DF_NODE_CUDNN_CHECK(cudnnCreateReduceTensorDescriptor(&_avgReduceTensorDesc1));
@@ -36,12 +43,21 @@ void BatchStdDev::init()
 	DF_NODE_CUDNN_CHECK(cudnnGetReductionWorkspaceSize(_cudnnHandle, _avgReduceTensorDesc2, _avgDesc1, _avgDesc2, &workspace2));
 	_workspaceSizeInBytes = std::max(workspace1, workspace2);
 	DF_NODE_CUDA_CHECK(cudaMalloc(&_d_workspace, _workspaceSizeInBytes));
+	Tensor::add_allocated_by_thread(_workspaceSizeInBytes);
 	
 	_outputs[0]->initValue({ 1,1,1,1 });
 }
 
 void BatchStdDev::forward()
 {
+	if (is_cpu()) {
+		const float *x = _inputs[0]->value()->cpu_data();
+		CpuReduction::reduce(deepflow::ReduceParam_ReduceOp_AVG, x, _inputs[0]->value()->dims(), 1, _avg.data());
+		for (int i = 0; i < _inner_dim; ++i)
+			_std[i] = x[i] - _avg[i];
+		CpuReduction::reduce(deepflow::ReduceParam_ReduceOp_NORM2, _std.data(), { 1, 1, 1, _inner_dim }, 0xF, _outputs[0]->value()->cpu_data(), 1.0f / sqrt(_inner_dim - 1));
+		return;
+	}
 	DF_NODE_CUDNN_CHECK(
 		cudnnReduceTensor(
 			_cudnnHandle,
@@ -79,7 +95,10 @@ void BatchStdDev::forward()
 
 void BatchStdDev::backward()
 {
-	if (_inputs[0]->diff()) {
+	if (_inputs[0]->diff() && is_cpu()) {
+		memset(_inputs[0]->diff()->cpu_data(), 0, _inputs[0]->diff()->bytes());
+	}
+	else if (_inputs[0]->diff()) {
 		cudaMemset(_inputs[0]->diff()->gpu_data(), 0, _inputs[0]->diff()->bytes());
 	}
 }
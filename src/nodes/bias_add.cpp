@@ -1,6 +1,7 @@
 #include "core/common_cu.h"
 
 #include "nodes/bias_add.h"
+#include "core/cpu_elementwise.h"
 
 BiasAdd::BiasAdd(deepflow::NodeParam *param) : Node(param) {
 	LOG_IF(FATAL, param->has_bias_add_param() == false) << "param.has_bias_add_param() == false";
@@ -15,15 +16,29 @@ void BiasAdd::init() {
 	_bias_dim = weightDim[1];	
 	_outputs[0]->initValue(inputDim);
 	_outputs[0]->initDiff();
+	LOG_IF(FATAL, _inputs[0]->value()->layout() != _outputs[0]->value()->layout()) << _name << " - Input and output layouts differ.";
+	if (is_cpu())
+		return;
 	DF_NODE_CUDNN_CHECK(cudnnCreate(&_cudnnHandle));
 }
 
 void BiasAdd::forward() {
+	if (is_cpu()) {
+		CpuElementwise::bias_add_forward(_inputs[0]->dims()[0], _bias_dim, _inner_dim, _inputs[0]->value()->cpu_data(), _inputs[1]->value()->cpu_data(), _outputs[0]->value()->cpu_data(), _outputs[0]->value()->channel_block());
+		return;
+	}
 	cudaMemcpy(_outputs[0]->value()->gpu_data(), _inputs[0]->value()->gpu_data(), _inputs[0]->value()->bytes(), cudaMemcpyDeviceToDevice);
 	cudnnAddTensor(_cudnnHandle, &one, _inputs[1]->value()->descriptor(), _inputs[1]->value()->gpu_data(), &one, _outputs[0]->value()->descriptor(), _outputs[0]->value()->gpu_data());
 }
 
 void BiasAdd::backward() {
+	if (is_cpu()) {
+		if (_inputs[0]->diff())
+			memcpy(_inputs[0]->diff()->cpu_data(), _outputs[0]->diff()->cpu_data(), _outputs[0]->diff()->bytes());
+		if (_inputs[1]->diff())
+			CpuElementwise::bias_add_backward(_inputs[0]->dims()[0], _bias_dim, _inner_dim, _outputs[0]->diff()->cpu_data(), _inputs[1]->diff()->cpu_data(), _outputs[0]->value()->channel_block());
+		return;
+	}
 	if (_inputs[0]->diff()) {
 		cudaMemcpy(_inputs[0]->diff()->gpu_data(), _outputs[0]->diff()->gpu_data(), _outputs[0]->diff()->bytes(), cudaMemcpyDeviceToDevice);
 	}
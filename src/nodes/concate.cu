@@ -1,4 +1,6 @@
 #include "nodes/concate.h"
+#include "core/cpu_layout.h"
+#include "core/cpu_transpose.h"
 
 __global__ void ConcateKernel(
 	const int size,
@@ -28,6 +30,30 @@ __global__ void ConcateKernel(
 	}
 }
 
+// Copies one input into its channel slice of the output or back. Each (n, c) plane is contiguous on
+// both sides, so the planes of one sample coalesce and the copy is a single memcpy per sample.
+// Input and output are viewed as (n, c / split, h, w, c % split) in their own layouts, the output
+// from the channel offset on.
+static void concate_cpu(bool forward, std::array<int, 4> input_dims, int input_block, int output_channels, int output_block, int channel_offset, const float *x_dy, float *y_dx)
+{
+	auto output_dims = input_dims;
+	output_dims[1] = output_channels;
+	int split = 1;
+	if (input_block != 1 && input_block != input_dims[1])
+		split = input_block;
+	else if (output_block != 1 && output_block != output_channels)
+		split = output_block;
+	LOG_IF(FATAL, channel_offset % split != 0) << "Concate - channel offset " << channel_offset << " is not a multiple of the channel block " << split;
+	const int sizes[5] = { input_dims[0], input_dims[1] / split, input_dims[2], input_dims[3], split };
+	auto input = CpuLayout::strides(input_dims, input_block, split);
+	auto output = CpuLayout::strides(output_dims, output_block, split);
+	const ptrdiff_t offset = channel_offset / split * output[1];
+	if (forward)
+		CpuTranspose::copy(5, sizes, x_dy, input.data(), y_dx + offset, output.data());
+	else
+		CpuTranspose::copy(5, sizes, x_dy + offset, output.data(), y_dx, input.data());
+}
+
 Concate::Concate(deepflow::NodeParam * param) : Node(param)
 {
 	LOG_IF(FATAL, param->has_concate_param() == false) << "param.has_concate_param() == false";
@@ -65,8 +91,23 @@ void Concate::forward()
 		auto input = _inputs[i];
 		int size = input->value()->size();
 		int channels = input->value()->dim(1);
-		ConcateKernel << < numOfBlocks(size), maxThreadsPerBlock >> > (size, true, _width, _height, channels, _output_channels, channel_offset, input->value()->gpu_data(), _outputs[0]->value()->gpu_data());
-		DF_KERNEL_CHECK();
+		if (is_cpu()) {
+			auto x = input->value();
+			auto y = _outputs[0]->value();
+			if (!x->is_contiguous() && y->channel_block() == 1) {
+				// Strided views are read in place instead of being gathered first.
+				auto x_strides = x->strides();
+				auto y_strides = Tensor::contiguous_strides(y->dims());
+				CpuTranspose::copy(4, x->dims().data(), x->cpu_strided_data(), x_strides.data(), y->cpu_data() + channel_offset * y_strides[1], y_strides.data());
+			}
+			else {
+				concate_cpu(true, x->dims(), x->channel_block(), _output_channels, y->channel_block(), channel_offset, x->cpu_data(), y->cpu_data());
+			}
+		}
+		else {
+			ConcateKernel << < numOfBlocks(size), maxThreadsPerBlock >> > (size, true, _width, _height, channels, _output_channels, channel_offset, input->value()->gpu_data(), _outputs[0]->value()->gpu_data());
+			DF_KERNEL_CHECK();
+		}
 		channel_offset += channels;
 	}	
 }
@@ -78,7 +119,10 @@ void Concate::backward()
 		auto input = _inputs[i];
 		int size = input->value()->size();
 		int channels = input->value()->dim(1);
-		if (input->diff()) {
+		if (input->diff() && is_cpu()) {
+			concate_cpu(false, input->value()->dims(), input->value()->channel_block(), _output_channels, _outputs[0]->value()->channel_block(), channel_offset, _outputs[0]->diff()->cpu_data(), input->diff()->cpu_data());
+		}
+		else if (input->diff()) {
 			ConcateKernel << < numOfBlocks(size), maxThreadsPerBlock >> > (size, false, _width, _height, channels, _output_channels, channel_offset, _outputs[0]->diff()->gpu_data(), input->diff()->gpu_data());
 			DF_KERNEL_CHECK();
 		}
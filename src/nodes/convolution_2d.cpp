@@ -6,9 +6,23 @@ Convolution2D::Convolution2D(deepflow::NodeParam *param) : Node(param) {
 }
 
 void Convolution2D::init() {
+	auto inputDims = _inputs[0]->dims();	
+	const deepflow::EpilogueParam &epilogue = _param->conv_2d_param().epilogue();
+	LOG_IF(FATAL, epilogue.bias() && _inputs[2]->value()->size() != _inputs[1]->dims()[0]) << _name << " - Epilogue bias must hold " << _inputs[1]->dims()[0] << " values";
+	if (is_cpu()) {
+		auto filterDims = _inputs[1]->dims();
+		LOG_IF(FATAL, filterDims[1] != inputDims[1]) << _name << " Input channels " << inputDims[1] << " != Filter channels " << filterDims[1];
+		const deepflow::Conv2dParam &param = _param->conv_2d_param();
+		LOG_IF(FATAL, param.pad_h() < 0 || param.pad_w() < 0 || param.u() <= 0 || param.v() <= 0 || param.dilation_h() <= 0 || param.dilation_w() <= 0) << _name << " - Invalid padding, stride or dilation";
+		int h = CpuConvolution::output_size(inputDims[2], filterDims[2], param.pad_h(), param.u(), param.dilation_h());
+		int w = CpuConvolution::output_size(inputDims[3], filterDims[3], param.pad_w(), param.v(), param.dilation_w());
+		_cpu_shape = { inputDims[0], inputDims[1], inputDims[2], inputDims[3], filterDims[0], filterDims[2], filterDims[3], h, w, param.pad_h(), param.pad_w(), param.u(), param.v(), param.dilation_h(), param.dilation_w() };
+		_outputs[0]->initValue({ inputDims[0], filterDims[0], h, w });
+		_outputs[0]->initDiff();
+		return;
+	}
 	_xDesc = _inputs[0]->value()->descriptor();
 	
-	auto inputDims = _inputs[0]->dims();	
 	DF_NODE_CUDNN_CHECK(cudnnCreate(&_cudnnHandle));
 	DF_NODE_CUDNN_CHECK(cudnnCreateFilterDescriptor(&_wDesc));	
 	auto filterDims = _inputs[1]->dims();	
@@ -44,18 +58,60 @@ void Convolution2D::init() {
 	DF_NODE_CUDNN_CHECK(cudnnGetConvolutionBackwardFilterWorkspaceSize(_cudnnHandle, _xDesc, _dyDesc, _convDesc, _wDesc, _bwdFilterAlgo, &_bwdFilterWorkspaceSize));
 	_maxWorkspaceSize = std::max({ _maxWorkspaceSize, _bwdFilterWorkspaceSize });
 
-	if (d_workspace == 0 && _maxWorkspaceSize != 0)
+	if (d_workspace == 0 && _maxWorkspaceSize != 0) {
 		DF_NODE_CUDA_CHECK(cudaMallocManaged(&d_workspace, _maxWorkspaceSize));
+		Tensor::add_allocated_by_thread(_maxWorkspaceSize);
+	}
 }
 
 void Convolution2D::forward() {
-	float *_x = _inputs[0]->value()->gpu_data();
-	float *_w = _inputs[1]->value()->gpu_data();	
-	float *_y = _outputs[0]->value()->gpu_data();
-	DF_NODE_CUDNN_CHECK(cudnnConvolutionForward(_cudnnHandle, &one, _xDesc, _x, _wDesc, _w, _convDesc, _fwdAlgo, d_workspace, _fwdWorkspaceSize, &zero, _yDesc, _y));
+	if (is_cpu()) {
+		auto x = _inputs[0]->value(), y = _outputs[0]->value();
+		if (x->channel_block() != 1 || y->channel_block() != 1)
+			CpuConvolution::forward_blocked(_cpu_shape, x->channel_block(), y->channel_block(), x->cpu_data(), _inputs[1]->value()->cpu_data(), y->cpu_data());
+		else
+			// Rank-1 filters such as Gaussian blurs run as two 1D passes, large dense ones through the FFT.
+			CpuConvolution::forward(_cpu_shape, x->cpu_data(), _inputs[1]->value()->cpu_data(), y->cpu_data());
+	}
+	else {
+		float *_x = _inputs[0]->value()->gpu_data();
+		float *_w = _inputs[1]->value()->gpu_data();
+		float *_y = _outputs[0]->value()->gpu_data();
+		DF_NODE_CUDNN_CHECK(cudnnConvolutionForward(_cudnnHandle, &one, _xDesc, _x, _wDesc, _w, _convDesc, _fwdAlgo, d_workspace, _fwdWorkspaceSize, &zero, _yDesc, _y));
+	}
+	if (has_epilogue()) {
+		// Bias and activation moved here by GraphFusion.
+		auto dims = _outputs[0]->value()->dims();
+		const float *bias = _param->conv_2d_param().epilogue().bias() ? (is_cpu() ? _inputs[2]->value()->cpu_data() : _inputs[2]->value()->gpu_data()) : nullptr;
+		epilogue_forward(_param->conv_2d_param().epilogue(), dims[0], dims[1], dims[2] * dims[3], bias, is_cpu() ? _outputs[0]->value()->cpu_data() : _outputs[0]->value()->gpu_data(), _outputs[0]->value()->channel_block());
+	}
 }
 
 void Convolution2D::backward() {	
+	if (has_epilogue()) {
+		// The output diff becomes the diff before the activation, the convolution backward reads it from there.
+		auto dims = _outputs[0]->value()->dims();
+		auto bias_diff = _param->conv_2d_param().epilogue().bias() ? _inputs[2]->diff() : nullptr;
+		if (is_cpu())
+			epilogue_backward(_param->conv_2d_param().epilogue(), dims[0], dims[1], dims[2] * dims[3], _outputs[0]->value()->cpu_data(), _outputs[0]->diff()->cpu_data(), bias_diff ? bias_diff->cpu_data() : nullptr, _outputs[0]->value()->channel_block());
+		else
+			epilogue_backward(_param->conv_2d_param().epilogue(), dims[0], dims[1], dims[2] * dims[3], _outputs[0]->value()->gpu_data(), _outputs[0]->diff()->gpu_data(), bias_diff ? bias_diff->gpu_data() : nullptr);
+	}
+	if (is_cpu()) {
+		const int x_block = _inputs[0]->value()->channel_block(), y_block = _outputs[0]->value()->channel_block();
+		if (x_block != 1 || y_block != 1) {
+			if (_inputs[0]->diff())
+				CpuConvolution::backward_data_blocked(_cpu_shape, x_block, y_block, _inputs[1]->value()->cpu_data(), _outputs[0]->diff()->cpu_data(), _inputs[0]->diff()->cpu_data());
+			if (_inputs[1]->diff())
+				CpuConvolution::backward_filter_blocked(_cpu_shape, x_block, y_block, _inputs[0]->value()->cpu_data(), _outputs[0]->diff()->cpu_data(), _inputs[1]->diff()->cpu_data());
+			return;
+		}
+		if (_inputs[0]->diff())
+			CpuConvolution::backward_data(_cpu_shape, _inputs[1]->value()->cpu_data(), _outputs[0]->diff()->cpu_data(), _inputs[0]->diff()->cpu_data());
+		if (_inputs[1]->diff())
+			CpuConvolution::backward_filter(_cpu_shape, _inputs[0]->value()->cpu_data(), _outputs[0]->diff()->cpu_data(), _inputs[1]->diff()->cpu_data());
+		return;
+	}
 	float *_dy = _outputs[0]->diff()->gpu_data();	
 	if (_inputs[0]->diff()) {
 		float *_w = _inputs[1]->value()->gpu_data();
@@ -69,16 +125,25 @@ void Convolution2D::backward() {
 	}
 }
 
+bool Convolution2D::has_epilogue() const
+{
+	const deepflow::EpilogueParam &epilogue = _param->conv_2d_param().epilogue();
+	return epilogue.bias() || epilogue.activation().op() != deepflow::PointwiseStage_Op_IDENTITY;
+}
+
 std::string Convolution2D::to_cpp() const
 {	
 	const deepflow::Conv2dParam &param = _param->conv_2d_param();
-	std::string cpp = "auto " + _name + " = df.conv2d(" + _input_name_for_cpp(0) + ", " + _input_name_for_cpp(1) + ", ";
+	std::string name = has_epilogue() ? _name + "_conv" : _name;
+	std::string cpp = "auto " + name + " = df.conv2d(" + _input_name_for_cpp(0) + ", " + _input_name_for_cpp(1) + ", ";
 	cpp += std::to_string(param.pad_h()) + ", ";
 	cpp += std::to_string(param.pad_w()) + ", ";
 	cpp += std::to_string(param.u()) + ", ";
 	cpp += std::to_string(param.v()) + ", ";
 	cpp += std::to_string(param.dilation_h()) + ", ";
 	cpp += std::to_string(param.dilation_w()) + ", ";
-	cpp += "\"" + _name + "\");";	
+	cpp += "\"" + name + "\");";	
+	if (has_epilogue())
+		cpp += "\n" + _epilogue_cpp(param.epilogue(), name);
 	return cpp;
 }
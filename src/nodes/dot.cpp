@@ -21,12 +21,23 @@ void Dot::init() {
 
 void Dot::forward() {	
 	auto size = _outputs[0]->value()->size();
+	if (is_cpu()) {
+		dot(size, 1.0, _inputs[0]->value()->cpu_data(), _inputs[1]->value()->cpu_data(), 0.0, _outputs[0]->value()->cpu_data());
+		return;
+	}
 	dot(size, 1.0, _inputs[0]->value()->gpu_data(), _inputs[1]->value()->gpu_data(), 0.0, _outputs[0]->value()->gpu_data());	
 	DF_KERNEL_CHECK();
 }
 
 void Dot::backward() {
 	auto size = _outputs[0]->diff()->size();
+	if (is_cpu()) {
+		if (_inputs[0]->diff())
+			dot(size, 1.0, _outputs[0]->diff()->cpu_data(), _inputs[1]->value()->cpu_data(), 0.0, _inputs[0]->diff()->cpu_data());
+		if (_inputs[1]->diff())
+			dot(size, 1.0, _outputs[0]->diff()->cpu_data(), _inputs[0]->value()->cpu_data(), 0.0, _inputs[1]->diff()->cpu_data());
+		return;
+	}
 	if (_inputs[0]->diff()) {
 		dot(size, 1.0, _outputs[0]->diff()->gpu_data(), _inputs[1]->value()->gpu_data(), 0.0, _inputs[0]->diff()->gpu_data());
 		DF_KERNEL_CHECK();
@@ -1,6 +1,7 @@
 #include "nodes/dprelu.h"
 
 #include "core/common_cu.h"
+#include "core/cpu_elementwise.h"
 
 __global__
 void DPReluForwardKernel(int size, int input_channels, int input_width, int input_height, int a_channels, const float *x, const float *a,  float *y)
@@ -73,6 +74,10 @@ void DPRelu::forward()
 	auto input_dims = _inputs[0]->dims();
 	auto a_channels = _inputs[1]->value()->dim(1);
 	auto size = _inputs[0]->value()->size();
+	if (is_cpu()) {
+		CpuElementwise::dprelu_forward(input_dims[0], input_dims[1], input_dims[2] * input_dims[3], a_channels, _inputs[0]->value()->cpu_data(), _inputs[1]->value()->cpu_data(), _outputs[0]->value()->cpu_data());
+		return;
+	}
 	DPReluForwardKernel << < numOfBlocks(size), maxThreadsPerBlock >> >
 		(size, input_dims[1], input_dims[2], input_dims[3], a_channels, _inputs[0]->value()->gpu_data(), _inputs[1]->value()->gpu_data(), (float*)_outputs[0]->value()->gpu_data());
 	DF_NODE_KERNEL_CHECK();
@@ -84,6 +89,10 @@ void DPRelu::backward()
 		auto input_dims = _inputs[0]->dims();
 		auto a_channels = _inputs[1]->value()->dim(1);
 		auto size = _inputs[0]->value()->size();
+		if (is_cpu()) {
+			CpuElementwise::dprelu_backward(input_dims[0], input_dims[1], input_dims[2] * input_dims[3], a_channels, _inputs[0]->value()->cpu_data(), _inputs[1]->value()->cpu_data(), _outputs[0]->diff()->cpu_data(), _inputs[0]->diff()->cpu_data());
+			return;
+		}
 		DPReluBackwardKernel << < numOfBlocks(size), maxThreadsPerBlock >> >
 			(size, input_dims[1], input_dims[2], input_dims[3], a_channels, _inputs[0]->value()->gpu_data(), _inputs[1]->value()->gpu_data(), _outputs[0]->diff()->gpu_data(), (float*)_inputs[0]->diff()->gpu_data());
 		DF_NODE_KERNEL_CHECK();
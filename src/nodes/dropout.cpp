@@ -1,6 +1,10 @@
 #include "core/common_cu.h"
 
 #include "nodes/dropout.h"
+#include "core/cpu_elementwise.h"
+
+#include <algorithm>
+#include <random>
 
 Dropout::Dropout(deepflow::NodeParam *param) : Node(param) {
 	LOG_IF(FATAL, param->has_dropout_param() == false) << "param.has_dropout_param() == false";
@@ -9,6 +13,14 @@ Dropout::Dropout(deepflow::NodeParam *param) : Node(param) {
 void Dropout::init() {	
 	_outputs[0]->initValue(_inputs[0]->value()->dims());	
 	_dropout = _param->dropout_param().dropout();	
+	if (is_cpu()) {
+		// 1 bit of mask per element for backward instead of cuDNN's reserve space.
+		_mask.resize((_outputs[0]->value()->size() + 31) / 32);
+		std::random_device random_device;
+		_seed = ((uint64_t)random_device() << 32) | random_device();
+		_outputs[0]->initDiff();
+		return;
+	}
 	DF_NODE_CUDNN_CHECK(cudnnCreate(&_cudnnHandle));
 	DF_NODE_CUDNN_CHECK(cudnnCreateDropoutDescriptor(&_dropoutDesc));
 	DF_NODE_CUDNN_CHECK(cudnnDropoutGetStatesSize(_cudnnHandle, &_state_sizes_in_bytes));
@@ -16,10 +28,23 @@ void Dropout::init() {
 	DF_NODE_CUDNN_CHECK(cudnnSetDropoutDescriptor(_dropoutDesc, _cudnnHandle, _dropout, d_states, _state_sizes_in_bytes, clock()));
 	DF_NODE_CUDNN_CHECK(cudnnDropoutGetReserveSpaceSize(_inputs[0]->value()->descriptor(), &_reserve_sizes_in_bytes));
 	DF_NODE_CUDA_CHECK(cudaMalloc(&d_reserve, _reserve_sizes_in_bytes));	
+	Tensor::add_allocated_by_thread(_state_sizes_in_bytes + _reserve_sizes_in_bytes);
 	_outputs[0]->initDiff();	
 }
 
 void Dropout::forward() {
+	if (is_cpu()) {
+		auto y = _outputs[0]->value();
+		if (_context->execution_mode == ExecutionContext::TRAIN) {
+			y->shadow(nullptr);
+			CpuElementwise::dropout_forward(y->size(), _dropout, _seed, _step++, _inputs[0]->value()->cpu_data(), y->cpu_data(), _mask.data());
+		}
+		else {
+			// The output is the input, served without a copy.
+			y->shadow(_inputs[0]->value());
+		}
+		return;
+	}
 	if (_context->execution_mode == ExecutionContext::TRAIN) {
 		DF_NODE_CUDNN_CHECK(cudnnDropoutForward(_cudnnHandle, _dropoutDesc, _inputs[0]->value()->descriptor(), _inputs[0]->value()->gpu_data(), _outputs[0]->value()->descriptor(), _outputs[0]->value()->gpu_data(), d_reserve, _reserve_sizes_in_bytes));
 	}
@@ -29,6 +54,15 @@ void Dropout::forward() {
 }
 
 void Dropout::backward() {
+	if (_inputs[0]->diff() && is_cpu()) {
+		auto dx = _inputs[0]->diff();
+		const float *dy = _outputs[0]->diff()->cpu_data();
+		if (_context->execution_mode == ExecutionContext::TRAIN)
+			CpuElementwise::dropout_backward(dx->size(), _dropout, _mask.data(), dy, dx->cpu_data());
+		else
+			std::copy(dy, dy + dx->size(), dx->cpu_data());
+		return;
+	}
 	if (_inputs[0]->diff()) {
 		if (_context->execution_mode == ExecutionContext::TRAIN) {
 			DF_NODE_CUDNN_CHECK(cudnnDropoutBackward(_cudnnHandle, _dropoutDesc, _outputs[0]->diff()->descriptor(), _outputs[0]->diff()->gpu_data(), _inputs[0]->diff()->descriptor(), _inputs[0]->diff()->gpu_data(), d_reserve, _reserve_sizes_in_bytes));
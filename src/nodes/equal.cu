@@ -1,4 +1,5 @@
 #include "nodes/equal.h"
+#include "core/cpu_elementwise.h"
 
 __global__
 void EqualKernel(int n, const float *  a,  const float *  b, float *  c)
@@ -23,6 +24,10 @@ void Equal::init() {
 
 void Equal::forward() {
 	auto size = _inputs[0]->value()->size();
+	if (is_cpu()) {
+		CpuElementwise::equal(size, _inputs[0]->value()->cpu_data(), _inputs[1]->value()->cpu_data(), _outputs[0]->value()->cpu_data());
+		return;
+	}
 	EqualKernel << < numOfBlocks(size), maxThreadsPerBlock >> >(size, _inputs[0]->value()->gpu_data(), _inputs[1]->value()->gpu_data(), _outputs[0]->value()->gpu_data());
 	DF_KERNEL_CHECK();
 }
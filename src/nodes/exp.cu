@@ -1,5 +1,6 @@
 #include "nodes/exp.h"
 #include "core/common_cu.h"
+#include "core/cpu_elementwise.h"
 
 __global__
 void ExpKernelForward(const int n, const float * __restrict__ x, float * __restrict__ x2)
@@ -28,12 +29,19 @@ void Exp::init() {
 
 void Exp::forward() {
 	auto size = _inputs[0]->value()->size();
+	if (is_cpu()) {
+		CpuElementwise::exp_forward(math_accuracy(), size, _inputs[0]->value()->cpu_data(), _outputs[0]->value()->cpu_data());
+		return;
+	}
 	ExpKernelForward << < numOfBlocks(size), maxThreadsPerBlock >> > (size, _inputs[0]->value()->gpu_data(), (float*)_outputs[0]->value()->gpu_data());
 	DF_KERNEL_CHECK();
 }
 
 void Exp::backward() {
-	if (_inputs[0]->diff()) {
+	if (_inputs[0]->diff() && is_cpu()) {
+		CpuElementwise::exp_backward(math_accuracy(), _inputs[0]->value()->size(), _inputs[0]->value()->cpu_data(), _outputs[0]->diff()->cpu_data(), _inputs[0]->diff()->cpu_data());
+	}
+	else if (_inputs[0]->diff()) {
 		auto size = _inputs[0]->value()->size();
 		ExpKernelBackward << < numOfBlocks(size), maxThreadsPerBlock >> > (size, _inputs[0]->value()->gpu_data(), _outputs[0]->diff()->gpu_data(), (float*)_inputs[0]->diff()->gpu_data());
 		DF_KERNEL_CHECK();
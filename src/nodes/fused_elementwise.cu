@@ -0,0 +1,90 @@
+#include "nodes/fused_elementwise.h"
+#include "core/common_cu.h"
+#include "core/pointwise_cu.h"
+
+struct FusedStages {
+	int count;
+	int op[FusedElementwise::kMaxStages];
+	float coef[FusedElementwise::kMaxStages];
+};
+
+__global__
+void FusedElementwiseForwardKernel(const int n, const FusedStages stages, const float * __restrict__ x, float * __restrict__ y)
+{
+	int i = blockIdx.x*blockDim.x + threadIdx.x;
+	if (i < n) {
+		float v = x[i];
+		for (int k = 0; k < stages.count; ++k)
+			v = pointwise_forward(stages.op[k], stages.coef[k], v);
+		y[i] = v;
+	}
+}
+
+__global__
+void FusedElementwiseBackwardKernel(const int n, const FusedStages stages, const float * __restrict__ x, const float * __restrict__ dy, float * __restrict__ dx)
+{
+	int i = blockIdx.x*blockDim.x + threadIdx.x;
+	if (i < n) {
+		// Inputs of every stage kept in registers, then the chain rule runs back through them.
+		float v[FusedElementwise::kMaxStages + 1];
+		v[0] = x[i];
+		for (int k = 0; k < stages.count; ++k)
+			v[k + 1] = pointwise_forward(stages.op[k], stages.coef[k], v[k]);
+		float d = dy[i];
+		for (int k = stages.count - 1; k >= 0; --k)
+			d = pointwise_backward(stages.op[k], stages.coef[k], v[k], v[k + 1], d);
+		dx[i] = d;
+	}
+}
+
+FusedElementwise::FusedElementwise(deepflow::NodeParam *param) : Node(param) {
+	LOG_IF(FATAL, param->has_fused_elementwise_param() == false) << "param.has_fused_elementwise_param() == false";
+}
+
+void FusedElementwise::init() {
+	auto param = _param->fused_elementwise_param();
+	LOG_IF(FATAL, param.stage_size() == 0 || param.stage_size() > kMaxStages) << _name << " - A fused chain takes 1 to " << kMaxStages << " stages, got " << param.stage_size();
+	_stages.clear();
+	for (auto stage : param.stage())
+		_stages.push_back({ (CpuElementwise::PointwiseOp) stage.op(), stage.coef() });
+	_outputs[0]->initValue(_inputs[0]->value()->dims());
+	_outputs[0]->initDiff();
+}
+
+static FusedStages fused_stages(const std::vector<CpuElementwise::PointwiseStage> &stages)
+{
+	FusedStages s;
+	s.count = stages.size();
+	for (int k = 0; k < s.count; ++k) {
+		s.op[k] = stages[k].op;
+		s.coef[k] = stages[k].coef;
+	}
+	return s;
+}
+
+void FusedElementwise::forward() {
+	auto size = _inputs[0]->value()->size();
+	if (is_cpu()) {
+		CpuElementwise::chain_forward(math_accuracy(), _stages.size(), _stages.data(), size, _inputs[0]->value()->cpu_data(), _outputs[0]->value()->cpu_data());
+		return;
+	}
+	FusedElementwiseForwardKernel << < numOfBlocks(size), maxThreadsPerBlock >> > (size, fused_stages(_stages), _inputs[0]->value()->gpu_data(), (float*)_outputs[0]->value()->gpu_data());
+	DF_KERNEL_CHECK();
+}
+
+void FusedElementwise::backward() {
+	if (_inputs[0]->diff() && is_cpu()) {
+		CpuElementwise::chain_backward(math_accuracy(), _stages.size(), _stages.data(), _inputs[0]->value()->size(), _inputs[0]->value()->cpu_data(), _outputs[0]->diff()->cpu_data(), _inputs[0]->diff()->cpu_data());
+	}
+	else if (_inputs[0]->diff()) {
+		auto size = _inputs[0]->value()->size();
+		FusedElementwiseBackwardKernel << < numOfBlocks(size), maxThreadsPerBlock >> > (size, fused_stages(_stages), _inputs[0]->value()->gpu_data(), _outputs[0]->diff()->gpu_data(), (float*)_inputs[0]->diff()->gpu_data());
+		DF_KERNEL_CHECK();
+	}
+}
+
+std::string FusedElementwise::to_cpp() const
+{
+	auto &stages = _param->fused_elementwise_param().stage();
+	return _pointwise_cpp(std::vector<deepflow::PointwiseStage>(stages.begin(), stages.end()), _input_name_for_cpp(0));
+}
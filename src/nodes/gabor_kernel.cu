@@ -45,10 +45,12 @@ void GaborKernel::init()
 	_phi = gparam.phi();
 	_num_orientations = gparam.orientations_size();
 	_num_scales = gparam.scales_size();
-	DF_NODE_CUDA_CHECK(cudaMalloc(&_d_orientations, _num_orientations * sizeof(float)));	
-	DF_NODE_CUDA_CHECK(cudaMemcpy(_d_orientations, gparam.orientations().data(), _num_orientations * sizeof(float), cudaMemcpyHostToDevice));
-	DF_NODE_CUDA_CHECK(cudaMalloc(&_d_scales, _num_scales * sizeof(float)));
-	DF_NODE_CUDA_CHECK(cudaMemcpy(_d_scales, gparam.scales().data(), _num_scales * sizeof(float), cudaMemcpyHostToDevice));
+	if (!is_cpu()) {
+		DF_NODE_CUDA_CHECK(cudaMalloc(&_d_orientations, _num_orientations * sizeof(float)));	
+		DF_NODE_CUDA_CHECK(cudaMemcpy(_d_orientations, gparam.orientations().data(), _num_orientations * sizeof(float), cudaMemcpyHostToDevice));
+		DF_NODE_CUDA_CHECK(cudaMalloc(&_d_scales, _num_scales * sizeof(float)));
+		DF_NODE_CUDA_CHECK(cudaMemcpy(_d_scales, gparam.scales().data(), _num_scales * sizeof(float), cudaMemcpyHostToDevice));
+	}
 	float max_scale = -FLT_MAX;
 	for (int i = 0; i < _num_scales; ++i) {
 		float v = gparam.scales(i);		
@@ -79,6 +81,28 @@ std::string GaborKernel::to_cpp() const
 void GaborKernel::generate()
 {
 	auto size = _outputs[0]->value()->size();
+	if (is_cpu()) {
+		// Same taps as GaborWeightsKernel. Oriented filters are not rank-1, large banks go through the host FFT convolution.
+		auto gparam = _param->gabor_kernel_param();
+		float *w = _outputs[0]->value()->cpu_data();
+		float half_window_size = (float)_window_size / 2.0f;
+		for (int i = 0; i < size; ++i) {
+			const int x = i % _window_size;
+			const int y = (i / _window_size) % _window_size;
+			const int filter = i / (_window_size * _window_size);
+			int cx = x - half_window_size;
+			int cy = y - half_window_size;
+			float theta = gparam.orientations(filter % _num_orientations);
+			float sigma = gparam.scales(filter / _num_orientations);
+			float lambda = sigma / 0.35f;
+			float xprime = cx * cos(theta) + cy * sin(theta);
+			float yprime = -cx * sin(theta) + cy * cos(theta);
+			float sigma2 = sigma * sigma;
+			float alpha = _apply_scale ? 0.15915494309 / sigma2 : 1;
+			w[i] = alpha * exp(-0.5 * (xprime * xprime + yprime * yprime) / sigma2) * cos(2 * 3.14159265358979323846f * xprime / lambda + _phi);
+		}
+		return;
+	}
 	GaborWeightsKernel << < numOfBlocks(size), maxThreadsPerBlock >> > (size, _apply_scale, _phi, _window_size, _num_orientations, _num_scales, _d_orientations, _d_scales, (float*)_outputs[0]->value()->gpu_data());
 	DF_KERNEL_CHECK();
 }
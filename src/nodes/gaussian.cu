@@ -1,4 +1,8 @@
 #include "nodes/gaussian.h"
+#include "core/cpu_elementwise.h"
+#include "core/cpu_math.h"
+
+#include <algorithm>
 
 __global__
 void GaussianKernelForward(const int n, const float *mean, const float *sigma, const float *normal, float * out)
@@ -27,6 +31,36 @@ void GaussianKernelSigmaBackward(const int n, const float *normal, const float *
 	}
 }
 
+// Marsaglia's polar method: uniform pairs inside the unit disc become pairs of normals scaled by
+// sqrt(-2 log(s) / s), the logs of a batch of accepted pairs are taken in one vector call.
+static void gaussian_normal_cpu(std::mt19937 &generator, ExecutionContext::MathAccuracy accuracy, size_t n, float *normal)
+{
+	const size_t kBatch = 256;
+	std::uniform_real_distribution<float> uniform(-1.0f, 1.0f);
+	float u[kBatch], v[kBatch], s[kBatch], log_s[kBatch];
+	size_t filled = 0;
+	while (filled < n) {
+		const size_t wanted = std::min(kBatch, (n - filled + 1) / 2);
+		size_t count = 0;
+		while (count < wanted) {
+			const float a = uniform(generator), b = uniform(generator);
+			const float r = a * a + b * b;
+			if (r > 0 && r < 1) {
+				u[count] = a;
+				v[count] = b;
+				s[count++] = r;
+			}
+		}
+		CpuMath::log(accuracy, count, s, log_s);
+		for (size_t i = 0; i < count; ++i) {
+			const float f = sqrtf(-2.0f * log_s[i] / s[i]);
+			normal[filled++] = u[i] * f;
+			if (filled < n)
+				normal[filled++] = v[i] * f;
+		}
+	}
+}
+
 Gaussian::Gaussian(deepflow::NodeParam * param) : Node(param)
 {
 	LOG_IF(FATAL, param->has_gaussian_param() == false) << "param.has_gaussian_param() == false";
@@ -36,7 +70,10 @@ void Gaussian::init()
 {	
 	LOG_IF(FATAL, _inputs[0]->value()->dims() != _inputs[1]->value()->dims()) << "mean and sigma must have the same shape.";
 	_size = _inputs[0]->value()->size();
-	cudaMalloc(&_normal, _inputs[0]->value()->bytes());
+	if (is_cpu())
+		_host_normal.resize(_size);
+	else
+		cudaMalloc(&_normal, _inputs[0]->value()->bytes());
 	_outputs[0]->initValue(_inputs[0]->value()->dims());
 	_outputs[0]->initDiff();
 }
@@ -45,6 +82,13 @@ void Gaussian::forward()
 {
 	// sample a distribution with mean 0.0 and sigma 1.0
 	_mt19937.seed(_random_device());
+	if (is_cpu()) {
+		auto out = _outputs[0]->value()->cpu_data();
+		gaussian_normal_cpu(_mt19937, math_accuracy(), _size, _host_normal.data());
+		CpuElementwise::dot(_size, 1.0f, _host_normal.data(), _inputs[1]->value()->cpu_data(), 0.0f, out);
+		CpuElementwise::add(_size, 1.0f, out, 1.0f, _inputs[0]->value()->cpu_data(), out);
+		return;
+	}
 	std::normal_distribution<float> dist(0.0f, 1.0f);
 	float *h_rand = new float[_size];
 	for (int i = 0; i < _size; ++i)
@@ -56,6 +100,13 @@ void Gaussian::forward()
 
 void Gaussian::backward()
 {
+	if (is_cpu()) {
+		if (_inputs[0]->diff())
+			CpuElementwise::axpby(_size, 1.0f, _outputs[0]->diff()->cpu_data(), 0.0f, _inputs[0]->diff()->cpu_data());
+		if (_inputs[1]->diff())
+			CpuElementwise::dot(_size, 1.0f, _host_normal.data(), _outputs[0]->diff()->cpu_data(), 0.0f, _inputs[1]->diff()->cpu_data());
+		return;
+	}
 	if (_inputs[0]->diff()) {
 		GaussianKernelMeanBackward << < numOfBlocks(_size), maxThreadsPerBlock >> > (_size, _outputs[0]->diff()->gpu_data(), _inputs[0]->diff()->gpu_data());
 		DF_NODE_KERNEL_CHECK();
@@ -70,6 +70,26 @@ std::string ConvGaussianKernel::to_cpp() const
 void ConvGaussianKernel::generate()
 {
 	auto size = _outputs[0]->value()->size();
+	if (is_cpu()) {
+		// Same taps as GaussianWeightsKernel. Each diagonal slice is an outer product, which the host convolution runs as two 1D passes.
+		float *w = _outputs[0]->value()->cpu_data();
+		float half_window_size = (float)_window_size / 2.0f;
+		float ss = _current_sigma * _current_sigma;
+		for (int i = 0; i < size; ++i) {
+			const int x = i % _window_size;
+			const int y = (i / _window_size) % _window_size;
+			const int input_channel = (i / (_window_size * _window_size)) % _num_channels;
+			const int output_channel = i / (_window_size * _window_size * _num_channels);
+			if (output_channel != input_channel)
+				w[i] = 0;
+			else if (_current_sigma != 0) {
+				float xx = (x - half_window_size) * (x - half_window_size);
+				float yy = (y - half_window_size) * (y - half_window_size);
+				w[i] = 1.0f / (2.0f * 3.141592f * ss) * exp(-0.5f * (xx + yy) / ss);
+			}
+		}
+		return;
+	}
 	GaussianWeightsKernel << < numOfBlocks(size), maxThreadsPerBlock >> > (size, _current_sigma, _window_size, _num_channels, (float*)_outputs[0]->value()->gpu_data());
 	DF_KERNEL_CHECK();
 }
@@ -1,6 +1,7 @@
 #include "core/common_cu.h"
 
 #include "nodes/leaky_relu.h"
+#include "core/cpu_elementwise.h"
 
 __global__
 void ReluKernel(int n, const float *x, const float *x_dy, float *y_dx, const float slope)
@@ -29,12 +30,19 @@ void LeakyRelu::init() {
 
 void LeakyRelu::forward() {	
 	auto size = _inputs[0]->value()->size();
+	if (is_cpu()) {
+		CpuElementwise::leaky_relu(size, _negative_slope, _inputs[0]->value()->cpu_data(), _inputs[0]->value()->cpu_data(), _outputs[0]->value()->cpu_data());
+		return;
+	}
 	ReluKernel << < numOfBlocks(size), maxThreadsPerBlock >> >(size, _inputs[0]->value()->gpu_data(), _inputs[0]->value()->gpu_data(), (float*)_outputs[0]->value()->gpu_data(), _negative_slope);
 	DF_KERNEL_CHECK();	
 }
 
 void LeakyRelu::backward() {
-	if (_inputs[0]->diff()) {
+	if (_inputs[0]->diff() && is_cpu()) {
+		CpuElementwise::leaky_relu(_inputs[0]->value()->size(), _negative_slope, _inputs[0]->value()->cpu_data(), _outputs[0]->diff()->cpu_data(), _inputs[0]->diff()->cpu_data());
+	}
+	else if (_inputs[0]->diff()) {
 		auto size = _inputs[0]->value()->size();
 		ReluKernel << < numOfBlocks(size), maxThreadsPerBlock >> > (size, _inputs[0]->value()->gpu_data(), _outputs[0]->diff()->gpu_data(), (float*)_inputs[0]->diff()->gpu_data(), _negative_slope);
 		DF_KERNEL_CHECK();
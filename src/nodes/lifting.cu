@@ -1,4 +1,5 @@
 #include "nodes/lifting.h"
+#include "core/cpu_transpose.h"
 
 
 __global__
@@ -153,6 +154,39 @@ void LiftUpFlipKernel(const int n, const float * __restrict__ x, float * __restr
 	}
 }
 
+// Copies between an NCHW image and its four NC4(H/2)(W/2) polyphase components, one strided copy per
+// (row, column) parity. Flipped components walk the lifted plane with negative strides.
+static void lifting_cpu(bool to_lifted, bool flip, std::array<int, 4> image_dims, const float *src, float *dst, float beta)
+{
+	// Lifted channel of the (row parity, column parity) component and which axes it flips (1 = h, 2 = w).
+	static const int channel[2][2] = { { 2, 3 }, { 1, 0 } };
+	static const int flips[4] = { 0, 2, 1, 3 };
+	const ptrdiff_t C = image_dims[1], H = image_dims[2], W = image_dims[3];
+	const ptrdiff_t OH = H / 2, OW = W / 2;
+	const int sizes[4] = { image_dims[0], image_dims[1], (int)OH, (int)OW };
+	const ptrdiff_t image[4] = { C * H * W, H * W, 2 * W, 2 };
+	for (int dy = 0; dy < 2; ++dy) {
+		for (int dx = 0; dx < 2; ++dx) {
+			const int ch4 = channel[dy][dx];
+			ptrdiff_t lifted[4] = { 4 * C * OH * OW, 4 * OH * OW, OW, 1 };
+			ptrdiff_t image_offset = dy * W + dx;
+			ptrdiff_t lifted_offset = ch4 * OH * OW;
+			if (flip && (flips[ch4] & 1)) {
+				lifted_offset += (OH - 1) * OW;
+				lifted[2] = -OW;
+			}
+			if (flip && (flips[ch4] & 2)) {
+				lifted_offset += OW - 1;
+				lifted[3] = -1;
+			}
+			if (to_lifted)
+				CpuTranspose::copy(4, sizes, src + image_offset, image, dst + lifted_offset, lifted, beta);
+			else
+				CpuTranspose::copy(4, sizes, src + lifted_offset, lifted, dst + image_offset, image, beta);
+		}
+	}
+}
+
 Lifting::Lifting(deepflow::NodeParam * param) : Node(param) {
 	LOG_IF(FATAL, param->has_lifting_param() == false) << "param.lifting_param() == false";
 }
@@ -181,6 +215,14 @@ void Lifting::init()
 
 void Lifting::forward()
 {
+	if (is_cpu()) {
+		const bool flip = _mode == deepflow::LiftingParam_Mode_DOWN_FLIP || _mode == deepflow::LiftingParam_Mode_UP_FLIP;
+		if (_mode == deepflow::LiftingParam_Mode_DOWN_REGULAR || _mode == deepflow::LiftingParam_Mode_DOWN_FLIP)
+			lifting_cpu(true, flip, _inputs[0]->dims(), _inputs[0]->value()->cpu_data(), _outputs[0]->value()->cpu_data(), 0);
+		else
+			lifting_cpu(false, flip, _outputs[0]->dims(), _inputs[0]->value()->cpu_data(), _outputs[0]->value()->cpu_data(), 0);
+		return;
+	}
 	auto size = _inputs[0]->value()->size();
 	auto dims = _inputs[0]->dims();
 	if (_mode == deepflow::LiftingParam_Mode_DOWN_REGULAR)
@@ -198,7 +240,14 @@ void Lifting::forward()
 
 void Lifting::backward()
 {
-	if (_inputs[0]->diff()) {
+	if (_inputs[0]->diff() && is_cpu()) {
+		const bool flip = _mode == deepflow::LiftingParam_Mode_DOWN_FLIP || _mode == deepflow::LiftingParam_Mode_UP_FLIP;
+		if (_mode == deepflow::LiftingParam_Mode_DOWN_REGULAR || _mode == deepflow::LiftingParam_Mode_DOWN_FLIP)
+			lifting_cpu(false, flip, _inputs[0]->dims(), _outputs[0]->diff()->cpu_data(), _inputs[0]->diff()->cpu_data(), 0);
+		else
+			lifting_cpu(true, flip, _outputs[0]->dims(), _outputs[0]->diff()->cpu_data(), _inputs[0]->diff()->cpu_data(), 0);
+	}
+	else if (_inputs[0]->diff()) {
 		auto size = _outputs[0]->diff()->size();
 		auto dims = _outputs[0]->dims();
 		if (_mode == deepflow::LiftingParam_Mode_DOWN_REGULAR)
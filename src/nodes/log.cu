@@ -1,5 +1,6 @@
 #include "nodes/log.h"
 #include "core/common_cu.h"
+#include "core/cpu_elementwise.h"
 
 __global__
 void LogKernelForward(const int n, const float coef, const float * __restrict__ x, float * __restrict__ x2)
@@ -29,12 +30,19 @@ void Log::init() {
 void Log::forward() {
 	auto size = _inputs[0]->value()->size();
 	auto coef = _param->log_param().coef();
+	if (is_cpu()) {
+		CpuElementwise::log_forward(math_accuracy(), size, coef, _inputs[0]->value()->cpu_data(), _outputs[0]->value()->cpu_data());
+		return;
+	}
 	LogKernelForward << < numOfBlocks(size), maxThreadsPerBlock >> > (size, coef, _inputs[0]->value()->gpu_data(), (float*)_outputs[0]->value()->gpu_data());
 	DF_KERNEL_CHECK();
 }
 
 void Log::backward() {
-	if (_inputs[0]->diff()) {
+	if (_inputs[0]->diff() && is_cpu()) {
+		CpuElementwise::log_backward(_inputs[0]->value()->size(), _param->log_param().coef(), _inputs[0]->value()->cpu_data(), _outputs[0]->diff()->cpu_data(), _inputs[0]->diff()->cpu_data());
+	}
+	else if (_inputs[0]->diff()) {
 		auto size = _inputs[0]->value()->size();
 		auto coef = _param->log_param().coef();
 		LogKernelBackward << < numOfBlocks(size), maxThreadsPerBlock >> > (size, coef, _inputs[0]->value()->gpu_data(), _outputs[0]->diff()->gpu_data(), (float*)_inputs[0]->diff()->gpu_data());
@@ -1,5 +1,6 @@
 #include "nodes/loss.h"
 #include "core/common_cu.h"
+#include "core/cpu_reduction.h"
 
 Loss::Loss(deepflow::NodeParam *param) : Node(param) {
 	LOG_IF(FATAL, param->has_loss_param() == false) << "param.has_loss_param() == false";
@@ -8,19 +9,28 @@ Loss::Loss(deepflow::NodeParam *param) : Node(param) {
 void Loss::init() {
 	auto lossParam = _param->loss_param();
 	_reduceTensorOp = (cudnnReduceTensorOp_t)lossParam.reduce_op();
-	DF_NODE_CUDNN_CHECK(cudnnCreate(&_cudnnHandle));	
 	_outputs[0]->initValue({ 1,1,1,1 });
 	_alpha = _param->loss_param().alpha();
 	_beta = _param->loss_param().beta();	
+	if (is_cpu()) {
+		memset(_inputs[0]->diff()->cpu_data(), 0, _inputs[0]->diff()->bytes());
+		return;
+	}
+	DF_NODE_CUDNN_CHECK(cudnnCreate(&_cudnnHandle));	
 	cudaMemset(_inputs[0]->diff()->gpu_data(), 0, _inputs[0]->diff()->bytes());
 	DF_NODE_CUDNN_CHECK(cudnnCreateReduceTensorDescriptor(&_reduceTensorDesciptor));
 	DF_NODE_CUDNN_CHECK(cudnnSetReduceTensorDescriptor(_reduceTensorDesciptor, _reduceTensorOp, CUDNN_DATA_FLOAT, CUDNN_PROPAGATE_NAN, CUDNN_REDUCE_TENSOR_NO_INDICES, CUDNN_32BIT_INDICES));
 	DF_NODE_CUDNN_CHECK(cudnnGetReductionWorkspaceSize(_cudnnHandle, _reduceTensorDesciptor, _inputs[0]->value()->descriptor(), _outputs[0]->value()->descriptor(), &_workspaceSizeInBytes));
 	DF_NODE_CUDA_CHECK(cudaMalloc(&_d_workspace, _workspaceSizeInBytes));	
+	Tensor::add_allocated_by_thread(_workspaceSizeInBytes);
 }
 
 void Loss::forward() {
-	if (_inputs[0]->value()->size() == 1) {		
+	if (is_cpu()) {
+		// LossParam and ReduceParam share the op numbering.
+		CpuReduction::reduce((deepflow::ReduceParam_ReduceOp) _reduceTensorOp, _inputs[0]->value()->cpu_data(), _inputs[0]->value()->dims(), 0xF, _outputs[0]->value()->cpu_data());
+	}
+	else if (_inputs[0]->value()->size() == 1) {		
 		cpy(1, one, _inputs[0]->value()->gpu_data(), zero, _outputs[0]->value()->gpu_data());
 	}
 	else {		
@@ -43,7 +53,9 @@ void Loss::forward() {
 }
 
 void Loss::backward() {	
-	if (_inputs[0]->diff())
+	if (_inputs[0]->diff() && is_cpu())
+		cpy(_inputs[0]->value()->size(), _alpha, _inputs[0]->value()->cpu_data(), _beta, _inputs[0]->diff()->cpu_data());
+	else if (_inputs[0]->diff())
 		cpy(_inputs[0]->value()->size(), _alpha, _inputs[0]->value()->gpu_data(), _beta, _inputs[0]->diff()->gpu_data());	
 }
 
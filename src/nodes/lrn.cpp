@@ -1,4 +1,92 @@
 #include "nodes\lrn.h"
+#include "core/cpu_parallel.h"
+
+#include <algorithm>
+#include <cmath>
+
+// Host kernels. The window sum across channels is kept as a running sum: moving from channel c
+// to c + 1 adds the square entering the window and subtracts the one leaving it, so the cost per
+// element does not depend on n. Every task owns one sample and a block of spatial positions,
+// the running sums are kept in double to stop drift on long channel runs.
+
+static const int kLrnBlock = 256;
+
+static void lrn_forward_cpu(const float *x, float *y, float *scale, int N, int C, int HW, int size, float alpha, float beta, float k)
+{
+	const int pre = (size - 1) / 2, post = size - 1 - pre;
+	const int blocks = (HW + kLrnBlock - 1) / kLrnBlock;
+	const double alpha_over_n = (double)alpha / size;
+	CpuParallel::for_range((size_t)N * blocks, 1, [&](size_t begin, size_t end) {
+		double sum[kLrnBlock];
+		for (size_t task = begin; task < end; ++task) {
+			const int n = (int)(task / blocks);
+			const int s0 = (int)(task % blocks) * kLrnBlock, len = std::min(kLrnBlock, HW - s0);
+			const size_t base = (size_t)n * C * HW + s0;
+			std::fill_n(sum, len, 0.0);
+			for (int c = 0; c < std::min(post, C); ++c) {
+				const float *xc = x + base + (size_t)c * HW;
+				for (int i = 0; i < len; ++i)
+					sum[i] += (double)xc[i] * xc[i];
+			}
+			for (int c = 0; c < C; ++c) {
+				if (c + post < C) {
+					const float *xin = x + base + (size_t)(c + post) * HW;
+					for (int i = 0; i < len; ++i)
+						sum[i] += (double)xin[i] * xin[i];
+				}
+				if (c - pre - 1 >= 0) {
+					const float *xout = x + base + (size_t)(c - pre - 1) * HW;
+					for (int i = 0; i < len; ++i)
+						sum[i] -= (double)xout[i] * xout[i];
+				}
+				const size_t offset = base + (size_t)c * HW;
+				for (int i = 0; i < len; ++i) {
+					const float sc = (float)(k + alpha_over_n * std::max(sum[i], 0.0));
+					y[offset + i] = x[offset + i] * powf(sc, -beta);
+					if (scale)
+						scale[offset + i] = sc;
+				}
+			}
+		}
+	});
+}
+
+// dx_c = dy_c * scale_c^-beta - 2 * alpha * beta / n * x_c * sum_j(dy_j * y_j / scale_j), where j runs
+// over the channels whose window contains c, i.e. the mirrored window [c - post, c + pre].
+static void lrn_backward_cpu(const float *x, const float *y, const float *dy, const float *scale, float *dx, int N, int C, int HW, int size, float alpha, float beta)
+{
+	const int pre = (size - 1) / 2, post = size - 1 - pre;
+	const int blocks = (HW + kLrnBlock - 1) / kLrnBlock;
+	const float ratio_factor = 2.0f * alpha * beta / size;
+	CpuParallel::for_range((size_t)N * blocks, 1, [&](size_t begin, size_t end) {
+		double sum[kLrnBlock];
+		for (size_t task = begin; task < end; ++task) {
+			const int n = (int)(task / blocks);
+			const int s0 = (int)(task % blocks) * kLrnBlock, len = std::min(kLrnBlock, HW - s0);
+			const size_t base = (size_t)n * C * HW + s0;
+			auto ratio = [&](int c, int i) {
+				const size_t o = base + (size_t)c * HW + i;
+				return (double)dy[o] * y[o] / scale[o];
+			};
+			std::fill_n(sum, len, 0.0);
+			for (int c = 0; c < std::min(pre, C); ++c)
+				for (int i = 0; i < len; ++i)
+					sum[i] += ratio(c, i);
+			for (int c = 0; c < C; ++c) {
+				if (c + pre < C)
+					for (int i = 0; i < len; ++i)
+						sum[i] += ratio(c + pre, i);
+				if (c - post - 1 >= 0)
+					for (int i = 0; i < len; ++i)
+						sum[i] -= ratio(c - post - 1, i);
+				const size_t offset = base + (size_t)c * HW;
+				for (int i = 0; i < len; ++i)
+					dx[offset + i] = dy[offset + i] * powf(scale[offset + i], -beta) - ratio_factor * x[offset + i] * (float)sum[i];
+			}
+		}
+	});
+}
+
 
 LRN::LRN(deepflow::NodeParam * param) : Node(param)
 {
@@ -8,6 +96,12 @@ LRN::LRN(deepflow::NodeParam * param) : Node(param)
 void LRN::init()
 {
 	auto param = _param->lrn_param();
+	if (is_cpu()) {
+		LOG_IF(FATAL, param.n() < 1) << "LRN " << _name << " - Window size must be positive.";
+		_outputs[0]->initValue(_inputs[0]->value()->dims());
+		_outputs[0]->initDiff();
+		return;
+	}
 	DF_NODE_CUDNN_CHECK(cudnnCreateLRNDescriptor(&_normDesc));
 	DF_NODE_CUDNN_CHECK(cudnnSetLRNDescriptor(_normDesc, param.n(), param.alpha(), param.beta(), param.k()));
 	DF_NODE_CUDNN_CHECK(cudnnCreate(&_cudnnHandle));
@@ -17,6 +111,17 @@ void LRN::init()
 
 void LRN::forward()
 {
+	if (is_cpu()) {
+		auto param = _param->lrn_param();
+		auto dims = _inputs[0]->value()->dims();
+		float *scale = nullptr;
+		if (_inputs[0]->diff()) {
+			_scale.resize((size_t)_inputs[0]->value()->size());
+			scale = _scale.data();
+		}
+		lrn_forward_cpu(_inputs[0]->value()->cpu_data(), _outputs[0]->value()->cpu_data(), scale, dims[0], dims[1], dims[2] * dims[3], param.n(), param.alpha(), param.beta(), param.k());
+		return;
+	}
 	DF_NODE_CUDNN_CHECK(
 		cudnnLRNCrossChannelForward(_cudnnHandle, _normDesc, CUDNN_LRN_CROSS_CHANNEL_DIM1,
 			&one, _inputs[0]->value()->descriptor(), _inputs[0]->value()->gpu_data(),
@@ -25,7 +130,13 @@ void LRN::forward()
 
 void LRN::backward()
 {
-	if (_inputs[0]->diff()) {
+	if (_inputs[0]->diff() && is_cpu()) {
+		auto param = _param->lrn_param();
+		auto dims = _inputs[0]->value()->dims();
+		LOG_IF(FATAL, (int)_scale.size() != _inputs[0]->value()->size()) << "LRN " << _name << " - backward called before forward.";
+		lrn_backward_cpu(_inputs[0]->value()->cpu_data(), _outputs[0]->value()->cpu_data(), _outputs[0]->diff()->cpu_data(), _scale.data(), _inputs[0]->diff()->cpu_data(), dims[0], dims[1], dims[2] * dims[3], param.n(), param.alpha(), param.beta());
+	}
+	else if (_inputs[0]->diff()) {
 		/*
 		DF_NODE_CUDNN_CHECK(
 			cudnnLRNCrossChannelForward(_cudnnHandle, _normDesc, CUDNN_LRN_CROSS_CHANNEL_DIM1,
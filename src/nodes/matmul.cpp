@@ -20,12 +20,16 @@ void MatMul::init() {
 	
 	LOG_IF(FATAL, _col_A != _row_B) << "[FAILED] " << _name << " | _col_A != _row_B - " << a->value()->shape() << " * " << b->value()->shape();
 	
-	_outputs[0]->initValue({ _row_A, bd[1], bd[2], bd[3] });	
-	
-	cublasCreate(&_handle);	
+	const deepflow::EpilogueParam &epilogue = _param->matmul_param().epilogue();
+	LOG_IF(FATAL, epilogue.bias() && _inputs[2]->value()->size() != _col_B) << "[FAILED] " << _name << " | Epilogue bias must hold " << _col_B << " values";
 
+	_outputs[0]->initValue({ _row_A, bd[1], bd[2], bd[3] });	
 	_outputs[0]->initDiff();
 
+	if (is_cpu())
+		return;
+
+	cublasCreate(&_handle);	
 }
 
 void MatMul::forward() {	
@@ -34,7 +38,16 @@ void MatMul::forward() {
 	auto c = _outputs[0];
 
 	// C(row_A,col_B) = A(row_A,col_A) * B(row_B,col_B)
-	LOG_IF(FATAL, cublasSgemm(_handle, CUBLAS_OP_N, CUBLAS_OP_N, _col_B, _row_A, _row_B, &one, (float *) b->value()->gpu_data(), _col_B, (float *) a->value()->gpu_data(), _col_A, &zero, (float*) c->value()->gpu_data(), _col_B) != 0) << "cublasSgemm [FAILED]";	
+	if (is_cpu())
+		CpuGemm::sgemm(false, false, _row_A, _col_B, _col_A, 1.0f, a->value()->cpu_data(), _col_A, b->value()->cpu_data(), _col_B, 0.0f, c->value()->cpu_data(), _col_B);
+	else
+		LOG_IF(FATAL, cublasSgemm(_handle, CUBLAS_OP_N, CUBLAS_OP_N, _col_B, _row_A, _row_B, &one, (float *) b->value()->gpu_data(), _col_B, (float *) a->value()->gpu_data(), _col_A, &zero, (float*) c->value()->gpu_data(), _col_B) != 0) << "cublasSgemm [FAILED]";	
+
+	if (has_epilogue()) {
+		// Bias and activation folded in by GraphFusion, the bias is per output column.
+		const float *bias = _param->matmul_param().epilogue().bias() ? (is_cpu() ? _inputs[2]->value()->cpu_data() : _inputs[2]->value()->gpu_data()) : nullptr;
+		epilogue_forward(_param->matmul_param().epilogue(), _row_A, _col_B, 1, bias, is_cpu() ? c->value()->cpu_data() : c->value()->gpu_data());
+	}
 }
 
 void MatMul::backward() {			
@@ -42,6 +55,23 @@ void MatMul::backward() {
 	auto b = _inputs[1];
 	auto c = _outputs[0];
 
+	if (has_epilogue()) {
+		auto bias_diff = _param->matmul_param().epilogue().bias() ? _inputs[2]->diff() : nullptr;
+		if (is_cpu())
+			epilogue_backward(_param->matmul_param().epilogue(), _row_A, _col_B, 1, c->value()->cpu_data(), c->diff()->cpu_data(), bias_diff ? bias_diff->cpu_data() : nullptr);
+		else
+			epilogue_backward(_param->matmul_param().epilogue(), _row_A, _col_B, 1, c->value()->gpu_data(), c->diff()->gpu_data(), bias_diff ? bias_diff->gpu_data() : nullptr);
+	}
+
+	if (is_cpu()) {
+		// A(row_A,col_A) = diff(row_A,col_B) * B(row_B,col_B).T, B(row_B,col_B) = A(row_A,col_A).T * diff(row_A,col_B)
+		if (a->diff())
+			CpuGemm::sgemm(false, true, _row_A, _col_A, _col_B, 1.0f, c->diff()->cpu_data(), _col_B, b->value()->cpu_data(), _col_B, 0.0f, a->diff()->cpu_data(), _col_A);
+		if (b->diff())
+			CpuGemm::sgemm(true, false, _row_B, _col_B, _row_A, 1.0f, a->value()->cpu_data(), _col_A, c->diff()->cpu_data(), _col_B, 0.0f, b->diff()->cpu_data(), _col_B);
+		return;
+	}
+
 	if (_inputs[0]->diff()) {
 		// col_A = row_B
 		//A(row_A,col_A) = diff(row_A,col_B) * B(row_B,col_B).T		
@@ -55,9 +85,18 @@ void MatMul::backward() {
 	
 }
 
+bool MatMul::has_epilogue() const
+{
+	const deepflow::EpilogueParam &epilogue = _param->matmul_param().epilogue();
+	return epilogue.bias() || epilogue.activation().op() != deepflow::PointwiseStage_Op_IDENTITY;
+}
+
 std::string MatMul::to_cpp() const
 {
-	std::string cpp = "auto " + _name + " = df.matmul(" + _input_name_for_cpp(0) + ", " + _input_name_for_cpp(1) + ", ";
-	cpp += "\"" + _name + "\");";	
+	std::string name = has_epilogue() ? _name + "_matmul" : _name;
+	std::string cpp = "auto " + name + " = df.matmul(" + _input_name_for_cpp(0) + ", " + _input_name_for_cpp(1) + ", ";
+	cpp += "\"" + name + "\");";	
+	if (has_epilogue())
+		cpp += "\n" + _epilogue_cpp(_param->matmul_param().epilogue(), name);
 	return cpp;
 }
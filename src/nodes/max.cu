@@ -1,4 +1,5 @@
 #include "nodes/max.h"
+#include "core/cpu_elementwise.h"
 
 __global__
 void MaxForwardKernel(const int n, const float * x1, const float * x2, float *y)
@@ -37,6 +38,10 @@ void Max::init()
 void Max::forward()
 {
 	auto size = _inputs[0]->value()->size();
+	if (is_cpu()) {
+		CpuElementwise::max_forward(size, _inputs[0]->value()->cpu_data(), _inputs[1]->value()->cpu_data(), _outputs[0]->value()->cpu_data());
+		return;
+	}
 	MaxForwardKernel << < numOfBlocks(size), maxThreadsPerBlock >> > (size, _inputs[0]->value()->gpu_data(), _inputs[1]->value()->gpu_data(), (float*)_outputs[0]->value()->gpu_data());
 	DF_KERNEL_CHECK();
 }
@@ -44,6 +49,13 @@ void Max::forward()
 void Max::backward()
 {
 	auto size = _inputs[0]->value()->size();
+	if (is_cpu()) {
+		if (_inputs[0]->diff())
+			CpuElementwise::max_backward(size, _inputs[0]->value()->cpu_data(), _inputs[1]->value()->cpu_data(), _outputs[0]->diff()->cpu_data(), _inputs[0]->diff()->cpu_data());
+		if (_inputs[1]->diff())
+			CpuElementwise::max_backward(size, _inputs[1]->value()->cpu_data(), _inputs[0]->value()->cpu_data(), _outputs[0]->diff()->cpu_data(), _inputs[1]->diff()->cpu_data());
+		return;
+	}
 	if (_inputs[0]->diff()) {
 		MaxBackwardKernel << < numOfBlocks(size), maxThreadsPerBlock >> > (size, _inputs[0]->value()->gpu_data(), _inputs[1]->value()->gpu_data(), _outputs[0]->diff()->gpu_data(), (float*)_inputs[0]->diff()->gpu_data());
 		DF_KERNEL_CHECK();
@@ -20,8 +20,8 @@ void Multiplexer::init()
 		auto dims = _inputs[i]->value()->dims();
 		LOG_IF(FATAL, dims != firstInputDim) << _name << " Mismatch size for input " << i << " " << _inputs[0]->value()->shape() << " != " << _inputs[i]->value()->shape();
 	}
-	_outputs[0]->initValue(firstInputDim);
-	_output_size_in_bytes = _outputs[0]->value()->bytes();
+	// The output serves the selected input without a copy.
+	_outputs[0]->initValue(firstInputDim, _inputs[0]->value());
 	_outputs[0]->initDiff();	
 }
 
@@ -33,7 +33,7 @@ void Multiplexer::forward()
 	}
 	LOG_IF(FATAL, _selected_input >= _num_inputs) << _name << " INPUT TO SELECTOR MUST BE LESS THAN " << (_num_inputs - 1);
 	LOG_IF(INFO, _verbose > 2) << "MULTIPLEXER FORWARD " << _name << " - SELECTED INPUT " << _inputs[_selected_input]->connectedNode()->name();
-	DF_NODE_CUDA_CHECK(cudaMemcpy(_outputs[0]->value()->gpu_data(), _inputs[_selected_input]->value()->gpu_data(), _output_size_in_bytes, cudaMemcpyDeviceToDevice))
+	_outputs[0]->value()->shadow(_inputs[_selected_input]->value());
 }
 
 void Multiplexer::backward()
@@ -1,4 +1,5 @@
 #include "nodes/nand.h"
+#include "core/cpu_elementwise.h"
 
 __global__
 void NandForwardKernel(const int n, const float * x1, const float * x2, float *y)
@@ -35,6 +36,10 @@ void Nand::init()
 void Nand::forward()
 {
 	auto size = _inputs[0]->value()->size();
+	if (is_cpu()) {
+		CpuElementwise::nand_forward(size, _inputs[0]->value()->cpu_data(), _inputs[1]->value()->cpu_data(), _outputs[0]->value()->cpu_data());
+		return;
+	}
 	NandForwardKernel << < numOfBlocks(size), maxThreadsPerBlock >> > (size, _inputs[0]->value()->gpu_data(), _inputs[1]->value()->gpu_data(), (float*)_outputs[0]->value()->gpu_data());
 	DF_KERNEL_CHECK();
 }
@@ -42,6 +47,13 @@ void Nand::forward()
 void Nand::backward()
 {
 	auto size = _inputs[0]->value()->size();
+	if (is_cpu()) {
+		if (_inputs[0]->diff())
+			CpuElementwise::nand_backward(size, _inputs[0]->value()->cpu_data(), _inputs[1]->value()->cpu_data(), _outputs[0]->diff()->cpu_data(), _inputs[0]->diff()->cpu_data());
+		if (_inputs[1]->diff())
+			CpuElementwise::nand_backward(size, _inputs[1]->value()->cpu_data(), _inputs[0]->value()->cpu_data(), _outputs[0]->diff()->cpu_data(), _inputs[1]->diff()->cpu_data());
+		return;
+	}
 	if (_inputs[0]->diff()) {
 		NandBackwardKernel << < numOfBlocks(size), maxThreadsPerBlock >> > (size, _inputs[0]->value()->gpu_data(), _inputs[1]->value()->gpu_data(), _outputs[0]->diff()->gpu_data(), (float*)_inputs[0]->diff()->gpu_data());
 		DF_KERNEL_CHECK();
@@ -20,7 +20,7 @@ void PassThrough::forward()
 void PassThrough::backward()
 {
 	if (_stop_gradients && _inputs[0]->diff())
-		cudaMemset(_inputs[0]->diff()->gpu_data(), 0, _inputs[0]->diff()->bytes());
+		_inputs[0]->diff()->reset();
 }
 
 std::string PassThrough::to_cpp() const
@@ -1,4 +1,8 @@
 #include "nodes/patch_sampling.h"
+#include "core/cpu_parallel.h"
+
+#include <algorithm>
+#include <cstring>
 
 #include <random>
 
@@ -38,7 +42,8 @@ void PatchSamplingBackward(const int out_size, const int num_channels, const int
 		const int ix = sampled_x[n] + ox;
 		const int iy = sampled_y[n] + oy;
 		const int input_index = n * (num_channels * in_height * in_width) + c * (in_height * in_width) + iy * in_width + ix;
-		atomicAdd(&dx[input_index], dy[i]);
+		// Every output element maps to its own input element, no two threads write the same dx.
+		dx[input_index] = dy[i];
 	}
 }
 
@@ -66,6 +71,8 @@ void PatchSampling::init()
 	_patch_max_x = inputDim[3] - _patch_width;	
 	_h_x_pos = new int[_num_samples];
 	_h_y_pos = new int[_num_samples];
+	if (is_cpu())
+		return;
 	DF_NODE_CUDA_CHECK(cudaMalloc(&_d_x_pos, _num_samples * sizeof(int)));
 	DF_NODE_CUDA_CHECK(cudaMalloc(&_d_y_pos, _num_samples * sizeof(int)));
 }
@@ -78,6 +85,21 @@ void PatchSampling::forward()
 		_h_x_pos[i] = _x_dist(_generator);
 		_h_y_pos[i] = _y_dist(_generator);		
 	}	
+	if (is_cpu()) {
+		// One row copy per (sample, channel, patch row) at the sample's offset.
+		const float *x = _inputs[0]->value()->cpu_data();
+		float *y = _outputs[0]->value()->cpu_data();
+		const size_t rows = (size_t)_num_samples * _num_channels * _patch_height;
+		CpuParallel::for_range(rows, std::max(1, 4096 / _patch_width), [&](size_t begin, size_t end) {
+			for (size_t row = begin; row < end; ++row) {
+				const int n = (int)(row / ((size_t)_num_channels * _patch_height));
+				const size_t plane = row / _patch_height;
+				const int iy = _h_y_pos[n] + (int)(row % _patch_height);
+				memcpy(y + row * _patch_width, x + (plane * _input_height + iy) * _input_width + _h_x_pos[n], _patch_width * sizeof(float));
+			}
+		});
+		return;
+	}
 	DF_NODE_CUDA_CHECK(cudaMemcpy(_d_x_pos, _h_x_pos, _num_samples * sizeof(int), cudaMemcpyHostToDevice));
 	DF_NODE_CUDA_CHECK(cudaMemcpy(_d_y_pos, _h_y_pos, _num_samples * sizeof(int), cudaMemcpyHostToDevice));
 	auto size = _outputs[0]->value()->size();
@@ -97,7 +119,23 @@ void PatchSampling::forward()
 
 void PatchSampling::backward()
 {
-	if (_inputs[0]->diff()) {
+	if (_inputs[0]->diff() && is_cpu()) {
+		// A patch covers distinct input pixels, so dx is written without accumulation: each plane is
+		// cleared and its patch rows are copied in.
+		const float *dy = _outputs[0]->diff()->cpu_data();
+		float *dx = _inputs[0]->diff()->cpu_data();
+		const size_t in_plane = (size_t)_input_height * _input_width, out_plane = (size_t)_patch_height * _patch_width;
+		CpuParallel::for_range((size_t)_num_samples * _num_channels, std::max<size_t>(1, 4096 / in_plane), [&](size_t begin, size_t end) {
+			for (size_t plane = begin; plane < end; ++plane) {
+				const int n = (int)(plane / _num_channels);
+				float *dst = dx + plane * in_plane;
+				memset(dst, 0, in_plane * sizeof(float));
+				for (int oy = 0; oy < _patch_height; ++oy)
+					memcpy(dst + (size_t)(_h_y_pos[n] + oy) * _input_width + _h_x_pos[n], dy + plane * out_plane + (size_t)oy * _patch_width, _patch_width * sizeof(float));
+			}
+		});
+	}
+	else if (_inputs[0]->diff()) {
 		cudaMemset(_inputs[0]->diff()->gpu_data(), 0, _inputs[0]->diff()->bytes());
 		auto size = _outputs[0]->value()->size();
 		PatchSamplingBackward << < numOfBlocks(size), maxThreadsPerBlock >> > (
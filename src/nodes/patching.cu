@@ -1,4 +1,6 @@
 #include "nodes/patching.h"
+#include "core/cpu_layout.h"
+#include "core/cpu_transpose.h"
 
 __global__
 void PatchingDownKernel(const int n, bool down_samples, const float * __restrict__ x, float * __restrict__ y, int IN, int IC, int IH, int IW, int PH, int PW, float beta)
@@ -79,6 +81,37 @@ void PatchingUpKernel(const int n, bool up_samples, const float * __restrict__ x
 	}
 }
 
+// Copies between an image and its patches, the image is viewed as N x C / split x THP x PH x TWP x PW x split
+// in its layout. Channel modes interleave the patches with the channels, so they take split 1 and
+// NCHW or NHWC on both sides.
+static void patching_cpu(bool to_patches, bool samples, std::array<int, 4> image_dims, int image_block, int patches_block, int THP, int TWP, const float *src, float *dst, float beta)
+{
+	const int C = image_dims[1], PH = image_dims[2] / THP, PW = image_dims[3] / TWP;
+	std::array<int, 4> patches_dims = { image_dims[0] * THP * TWP, C, PH, PW };
+	if (!samples)
+		patches_dims = { image_dims[0], C * THP * TWP, PH, PW };
+	int split = 1;
+	if (samples)
+		split = CpuLayout::split(C, image_block, patches_block);
+	else
+		LOG_IF(FATAL, (image_block != 1 && image_block != C) || (patches_block != 1 && patches_block != patches_dims[1])) << "Patching - channel modes need NCHW or NHWC.";
+	const int sizes[7] = { image_dims[0], C / split, THP, PH, TWP, PW, split };
+	auto i = CpuLayout::strides(image_dims, image_block, split);
+	auto p = CpuLayout::strides(patches_dims, patches_block, split);
+	const ptrdiff_t image[7] = { i[0], i[1], PH * i[2], i[2], PW * i[3], i[3], i[4] };
+	ptrdiff_t patches[7] = { THP * TWP * p[0], p[1], TWP * p[0], p[2], p[0], p[3], p[4] };
+	if (!samples) {
+		patches[0] = p[0];
+		patches[1] = THP * TWP * p[1];
+		patches[2] = TWP * p[1];
+		patches[4] = p[1];
+	}
+	if (to_patches)
+		CpuTranspose::copy(7, sizes, src, image, dst, patches, beta);
+	else
+		CpuTranspose::copy(7, sizes, src, patches, dst, image, beta);
+}
+
 Patching::Patching(deepflow::NodeParam * param) : Node(param) {
 	LOG_IF(FATAL, param->has_patching_param() == false) << "param.patching_param() == false";
 }
@@ -126,6 +159,13 @@ void Patching::init()
 
 void Patching::forward()
 {
+	if (is_cpu()) {
+		if (_mode == deepflow::PatchingParam_Mode_DOWNSAMPLES || _mode == deepflow::PatchingParam_Mode_DOWNCHANNELS)
+			patching_cpu(true, _mode == deepflow::PatchingParam_Mode_DOWNSAMPLES, _inputs[0]->dims(), _inputs[0]->value()->channel_block(), _outputs[0]->value()->channel_block(), _num_vertical_patches, _num_horizontal_patches, _inputs[0]->value()->cpu_data(), _outputs[0]->value()->cpu_data(), 0);
+		else
+			patching_cpu(false, _mode == deepflow::PatchingParam_Mode_UPSAMPLES, _outputs[0]->dims(), _outputs[0]->value()->channel_block(), _inputs[0]->value()->channel_block(), _num_vertical_patches, _num_horizontal_patches, _inputs[0]->value()->cpu_data(), _outputs[0]->value()->cpu_data(), 0);
+		return;
+	}
 	auto size = _inputs[0]->value()->size();
 	auto dims = _inputs[0]->dims();
 	if (_mode == deepflow::PatchingParam_Mode_DOWNSAMPLES || _mode == deepflow::PatchingParam_Mode_DOWNCHANNELS) {
@@ -144,7 +184,13 @@ void Patching::forward()
 
 void Patching::backward()
 {
-	if (_inputs[0]->diff()) {
+	if (_inputs[0]->diff() && is_cpu()) {
+		if (_mode == deepflow::PatchingParam_Mode_DOWNSAMPLES || _mode == deepflow::PatchingParam_Mode_DOWNCHANNELS)
+			patching_cpu(false, _mode == deepflow::PatchingParam_Mode_DOWNSAMPLES, _inputs[0]->dims(), _inputs[0]->value()->channel_block(), _outputs[0]->value()->channel_block(), _num_vertical_patches, _num_horizontal_patches, _outputs[0]->diff()->cpu_data(), _inputs[0]->diff()->cpu_data(), 0);
+		else
+			patching_cpu(true, _mode == deepflow::PatchingParam_Mode_UPSAMPLES, _outputs[0]->dims(), _outputs[0]->value()->channel_block(), _inputs[0]->value()->channel_block(), _num_vertical_patches, _num_horizontal_patches, _outputs[0]->diff()->cpu_data(), _inputs[0]->diff()->cpu_data(), 0);
+	}
+	else if (_inputs[0]->diff()) {
 		auto size = _outputs[0]->diff()->size();
 		auto dims = _outputs[0]->dims();
 		if (_mode == deepflow::PatchingParam_Mode_DOWNSAMPLES || _mode == deepflow::PatchingParam_Mode_DOWNCHANNELS)
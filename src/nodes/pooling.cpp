@@ -1,18 +1,162 @@
 #include "nodes/pooling.h"
+#include "core/cpu_parallel.h"
+
+#include <algorithm>
+#include <cfloat>
+
+// Host kernels. Planes (n, c) are independent, so they are split across the pool and every
+// plane is handled by one thread, which also makes the backward scatter race free.
+
+struct PoolingShape {
+	int H, W, OH, OW, KH, KW, PH, PW, SH, SW;
+};
+
+// Offset of the first maximum of a KxK window that lies completely inside the plane.
+template <int K>
+static inline int max_window_cpu(const float *x, int W)
+{
+	int best = 0;
+	float m = x[0];
+	for (int i = 0; i < K; ++i)
+		for (int j = 0; j < K; ++j) {
+			const float v = x[i * W + j];
+			if (v > m) {
+				m = v;
+				best = i * W + j;
+			}
+		}
+	return best;
+}
+
+static void max_pooling_forward_cpu(const float *x, float *y, int *argmax, int planes, const PoolingShape &s)
+{
+	const bool fast2 = s.KH == 2 && s.KW == 2 && s.SH == 2 && s.SW == 2;
+	const bool fast3 = s.KH == 3 && s.KW == 3 && s.SH == 2 && s.SW == 2;
+	CpuParallel::for_range(planes, 1, [&](size_t begin, size_t end) {
+		for (size_t p = begin; p < end; ++p) {
+			const float *xp = x + p * s.H * s.W;
+			float *yp = y + p * s.OH * s.OW;
+			int *ap = argmax ? argmax + p * s.OH * s.OW : nullptr;
+			for (int oh = 0; oh < s.OH; ++oh) {
+				const int h0 = oh * s.SH - s.PH;
+				const bool rows_inside = h0 >= 0 && h0 + s.KH <= s.H;
+				for (int ow = 0; ow < s.OW; ++ow) {
+					const int w0 = ow * s.SW - s.PW;
+					int best = -1;
+					if (rows_inside && w0 >= 0 && w0 + s.KW <= s.W && (fast2 || fast3)) {
+						const int corner = h0 * s.W + w0;
+						best = corner + (fast2 ? max_window_cpu<2>(xp + corner, s.W) : max_window_cpu<3>(xp + corner, s.W));
+					}
+					else {
+						float m = -FLT_MAX;
+						for (int h = std::max(h0, 0); h < std::min(h0 + s.KH, s.H); ++h)
+							for (int w = std::max(w0, 0); w < std::min(w0 + s.KW, s.W); ++w)
+								if (best < 0 || xp[h * s.W + w] > m) {
+									m = xp[h * s.W + w];
+									best = h * s.W + w;
+								}
+					}
+					yp[oh * s.OW + ow] = best < 0 ? -FLT_MAX : xp[best];
+					if (ap)
+						ap[oh * s.OW + ow] = best;
+				}
+			}
+		}
+	});
+}
+
+static void max_pooling_backward_cpu(const int *argmax, const float *dy, float *dx, int planes, const PoolingShape &s)
+{
+	CpuParallel::for_range(planes, 1, [&](size_t begin, size_t end) {
+		for (size_t p = begin; p < end; ++p) {
+			const int *ap = argmax + p * s.OH * s.OW;
+			const float *dyp = dy + p * s.OH * s.OW;
+			float *dxp = dx + p * s.H * s.W;
+			std::fill_n(dxp, s.H * s.W, 0.0f);
+			for (int i = 0; i < s.OH * s.OW; ++i)
+				if (ap[i] >= 0)
+					dxp[ap[i]] += dyp[i];
+		}
+	});
+}
+
+static void average_pooling_forward_cpu(const float *x, float *y, int planes, const PoolingShape &s, bool count_padding)
+{
+	CpuParallel::for_range(planes, 1, [&](size_t begin, size_t end) {
+		for (size_t p = begin; p < end; ++p) {
+			const float *xp = x + p * s.H * s.W;
+			float *yp = y + p * s.OH * s.OW;
+			for (int oh = 0; oh < s.OH; ++oh) {
+				const int h0 = std::max(oh * s.SH - s.PH, 0), h1 = std::min(oh * s.SH - s.PH + s.KH, s.H);
+				for (int ow = 0; ow < s.OW; ++ow) {
+					const int w0 = std::max(ow * s.SW - s.PW, 0), w1 = std::min(ow * s.SW - s.PW + s.KW, s.W);
+					float sum = 0;
+					for (int h = h0; h < h1; ++h)
+						for (int w = w0; w < w1; ++w)
+							sum += xp[h * s.W + w];
+					const int count = count_padding ? s.KH * s.KW : std::max((h1 - h0) * (w1 - w0), 1);
+					yp[oh * s.OW + ow] = sum / count;
+				}
+			}
+		}
+	});
+}
+
+static void average_pooling_backward_cpu(const float *dy, float *dx, int planes, const PoolingShape &s, bool count_padding)
+{
+	CpuParallel::for_range(planes, 1, [&](size_t begin, size_t end) {
+		for (size_t p = begin; p < end; ++p) {
+			const float *dyp = dy + p * s.OH * s.OW;
+			float *dxp = dx + p * s.H * s.W;
+			std::fill_n(dxp, s.H * s.W, 0.0f);
+			for (int oh = 0; oh < s.OH; ++oh) {
+				const int h0 = std::max(oh * s.SH - s.PH, 0), h1 = std::min(oh * s.SH - s.PH + s.KH, s.H);
+				for (int ow = 0; ow < s.OW; ++ow) {
+					const int w0 = std::max(ow * s.SW - s.PW, 0), w1 = std::min(ow * s.SW - s.PW + s.KW, s.W);
+					const int count = count_padding ? s.KH * s.KW : std::max((h1 - h0) * (w1 - w0), 1);
+					const float g = dyp[oh * s.OW + ow] / count;
+					for (int h = h0; h < h1; ++h)
+						for (int w = w0; w < w1; ++w)
+							dxp[h * s.W + w] += g;
+				}
+			}
+		}
+	});
+}
+
+static PoolingShape pooling_shape(const deepflow::PoolingParam &param, const std::array<int, 4> &input_dims, const std::array<int, 4> &output_dims)
+{
+	return { input_dims[2], input_dims[3], output_dims[2], output_dims[3], param.window_h(), param.window_w(), param.v_pad(), param.h_pad(), param.v_stride(), param.h_stride() };
+}
 
 Pooling::Pooling(deepflow::NodeParam *param) : Node(param) {
 	LOG_IF(FATAL, param->has_pooling_param() == false) << "param.has_pooling_param() == false";
 }
 
 void Pooling::init() {
-	DF_NODE_CUDNN_CHECK(cudnnCreate(&_cudnnHandle));
 	auto param = _param->pooling_param();
 	LOG_IF(FATAL, param.window_w() < 1);
 	LOG_IF(FATAL, param.window_h() < 1);
 	LOG_IF(FATAL, param.v_pad() < 0);
 	LOG_IF(FATAL, param.h_pad() < 0);
+	if (is_cpu()) {
+		LOG_IF(FATAL, param.v_stride() < 1 || param.h_stride() < 1) << "Pooling " << _name << " - Strides must be positive.";
+		auto dims = _inputs[0]->value()->dims();
+		int h = (dims[2] + 2 * param.v_pad() - param.window_h()) / param.v_stride() + 1;
+		int w = (dims[3] + 2 * param.h_pad() - param.window_w()) / param.h_stride() + 1;
+		LOG_IF(FATAL, h < 1 || w < 1) << "Pooling " << _name << " - Window is larger than the padded input.";
+		_outputs[0]->initValue({ dims[0], dims[1], h, w });
+		_outputs[0]->initDiff();
+		return;
+	}
+	cudnnPoolingMode_t mode = CUDNN_POOLING_MAX;
+	if (param.mode() == deepflow::PoolingParam_Mode_AVERAGE_COUNT_INCLUDE_PADDING)
+		mode = CUDNN_POOLING_AVERAGE_COUNT_INCLUDE_PADDING;
+	else if (param.mode() == deepflow::PoolingParam_Mode_AVERAGE_COUNT_EXCLUDE_PADDING)
+		mode = CUDNN_POOLING_AVERAGE_COUNT_EXCLUDE_PADDING;
+	DF_NODE_CUDNN_CHECK(cudnnCreate(&_cudnnHandle));
 	DF_NODE_CUDNN_CHECK(cudnnCreatePoolingDescriptor(&_poolingDesc));	
-	DF_NODE_CUDNN_CHECK(cudnnSetPooling2dDescriptor(_poolingDesc, CUDNN_POOLING_MAX, CUDNN_PROPAGATE_NAN, param.window_h(), param.window_w(), param.v_pad(), param.h_pad(), param.v_stride(), param.h_stride()));
+	DF_NODE_CUDNN_CHECK(cudnnSetPooling2dDescriptor(_poolingDesc, mode, CUDNN_PROPAGATE_NAN, param.window_h(), param.window_w(), param.v_pad(), param.h_pad(), param.v_stride(), param.h_stride()));
 	int n, c, h, w;
 	DF_NODE_CUDNN_CHECK(cudnnGetPooling2dForwardOutputDim(_poolingDesc, _inputs[0]->value()->descriptor(), &n, &c, &h, &w));
 	_outputs[0]->initValue({ n, c, h, w });	
@@ -20,11 +164,45 @@ void Pooling::init() {
 }
 
 void Pooling::forward() {
+	if (is_cpu()) {
+		auto param = _param->pooling_param();
+		auto dims = _inputs[0]->value()->dims();
+		auto shape = pooling_shape(param, dims, _outputs[0]->value()->dims());
+		const float *x = _inputs[0]->value()->cpu_data();
+		float *y = _outputs[0]->value()->cpu_data();
+		if (param.mode() == deepflow::PoolingParam_Mode_MAX) {
+			// Indices are only worth keeping when a gradient will flow back.
+			int *argmax = nullptr;
+			if (_inputs[0]->diff()) {
+				_argmax.resize((size_t)_outputs[0]->value()->size());
+				argmax = _argmax.data();
+			}
+			max_pooling_forward_cpu(x, y, argmax, dims[0] * dims[1], shape);
+		}
+		else {
+			average_pooling_forward_cpu(x, y, dims[0] * dims[1], shape, param.mode() == deepflow::PoolingParam_Mode_AVERAGE_COUNT_INCLUDE_PADDING);
+		}
+		return;
+	}
 	DF_NODE_CUDNN_CHECK(cudnnPoolingForward(_cudnnHandle, _poolingDesc, &one, _inputs[0]->value()->descriptor(), _inputs[0]->value()->gpu_data(), &zero, _outputs[0]->value()->descriptor(), _outputs[0]->value()->gpu_data()));
 }
 
 void Pooling::backward() {
-	if (_inputs[0]->diff())
+	if (_inputs[0]->diff() && is_cpu()) {
+		auto param = _param->pooling_param();
+		auto dims = _inputs[0]->value()->dims();
+		auto shape = pooling_shape(param, dims, _outputs[0]->value()->dims());
+		const float *dy = _outputs[0]->diff()->cpu_data();
+		float *dx = _inputs[0]->diff()->cpu_data();
+		if (param.mode() == deepflow::PoolingParam_Mode_MAX) {
+			LOG_IF(FATAL, (int)_argmax.size() != _outputs[0]->value()->size()) << "Pooling " << _name << " - backward called before forward.";
+			max_pooling_backward_cpu(_argmax.data(), dy, dx, dims[0] * dims[1], shape);
+		}
+		else {
+			average_pooling_backward_cpu(dy, dx, dims[0] * dims[1], shape, param.mode() == deepflow::PoolingParam_Mode_AVERAGE_COUNT_INCLUDE_PADDING);
+		}
+	}
+	else if (_inputs[0]->diff())
 		DF_NODE_CUDNN_CHECK(cudnnPoolingBackward(_cudnnHandle, _poolingDesc, &one, _outputs[0]->value()->descriptor(), _outputs[0]->value()->gpu_data(), _outputs[0]->diff()->descriptor(), _outputs[0]->diff()->gpu_data(), _inputs[0]->value()->descriptor(), _inputs[0]->value()->gpu_data(), &zero, _inputs[0]->diff()->descriptor(), _inputs[0]->diff()->gpu_data()));
 }
 
@@ -1,6 +1,7 @@
 #include "core/common_cu.h"
 
 #include "nodes/prelu.h"
+#include "core/cpu_elementwise.h"
 
 __global__
 void PReluForwardKernel(int n, int channels, int inner_dims, const float * __restrict__ x, const float * __restrict__ w, float * __restrict__ y)
@@ -64,6 +65,10 @@ void PRelu::forward()
 	auto size = _inputs[0]->value()->size();
 	auto channels = _inputs[0]->dims()[1];
 	auto inner_dims = _inputs[0]->dims()[2] * _inputs[0]->dims()[3];
+	if (is_cpu()) {
+		CpuElementwise::prelu_forward(_inputs[0]->dims()[0], channels, inner_dims, _inputs[0]->value()->cpu_data(), _inputs[1]->value()->cpu_data(), _outputs[0]->value()->cpu_data());
+		return;
+	}
 	PReluForwardKernel << < numOfBlocks(size), maxThreadsPerBlock>> >(size, channels, inner_dims, _inputs[0]->value()->gpu_data(), _inputs[1]->value()->gpu_data(), (float*)_outputs[0]->value()->gpu_data());
 	DF_NODE_KERNEL_CHECK();
 }
@@ -73,6 +78,14 @@ void PRelu::backward()
 	auto size = _inputs[0]->value()->size();
 	auto channels = _inputs[0]->dims()[1];
 	auto inner_dims = _inputs[0]->dims()[2] * _inputs[0]->dims()[3];
+	if (is_cpu()) {
+		auto outer = _inputs[0]->dims()[0];
+		if (_inputs[0]->diff())
+			CpuElementwise::prelu_backward(outer, channels, inner_dims, _inputs[0]->value()->cpu_data(), _inputs[1]->value()->cpu_data(), _outputs[0]->diff()->cpu_data(), _inputs[0]->diff()->cpu_data());
+		if (_inputs[1]->diff())
+			CpuElementwise::prelu_backward_weight(outer, channels, inner_dims, _inputs[0]->value()->cpu_data(), _outputs[0]->diff()->cpu_data(), _inputs[1]->diff()->cpu_data());
+		return;
+	}
 	if (_inputs[0]->diff()) {
 		PReluBackwardKernel << < numOfBlocks(size), maxThreadsPerBlock >> > (size, channels, inner_dims, _inputs[0]->value()->gpu_data(), _inputs[1]->value()->gpu_data(), _outputs[0]->diff()->gpu_data(), (float*)_inputs[0]->diff()->gpu_data());
 		DF_NODE_KERNEL_CHECK();
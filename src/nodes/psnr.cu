@@ -1,5 +1,6 @@
 #include "nodes/psnr.h"
 #include "core/common_cu.h"
+#include "core/cpu_reduction.h"
 
 __global__
 void SquareErrorKernel(const int n, const float * __restrict__ a, const float * __restrict__ b, float * __restrict__ c)
@@ -18,6 +19,10 @@ Psnr::Psnr(deepflow::NodeParam *param) : Node(param) {
 
 void Psnr::init() {	
 	LOG_IF(FATAL, _inputs[0]->value()->size() != _inputs[1]->value()->size()) << "Input " << _inputs[0]->value()->shape() << " != " << " Target " << _inputs[1]->value()->shape();	
+	if (is_cpu()) {
+		_error.resize(_inputs[0]->value()->size());
+		return;
+	}
 	DF_NODE_CUDNN_CHECK(cudnnCreate(&_cudnnHandle));
 	DF_NODE_CUDA_CHECK(cudaMalloc(&d_square_error, _inputs[0]->value()->bytes()));
 	DF_NODE_CUDA_CHECK(cudaMalloc(&d_sum_square_error, sizeof(float)));
@@ -29,10 +34,21 @@ void Psnr::init() {
 	DF_NODE_CUDNN_CHECK(cudnnSetTensor4dDescriptor(_output_desc, CUDNN_TENSOR_NCHW, CUDNN_DATA_FLOAT, 1, 1, 1, 1));
 	DF_NODE_CUDNN_CHECK(cudnnGetReductionWorkspaceSize(_cudnnHandle, _reduce_tensor_desciptor, _inputs[0]->value()->descriptor(), _output_desc, &_workspaceSizeInBytes));
 	DF_NODE_CUDA_CHECK(cudaMalloc(&_d_workspace, _workspaceSizeInBytes));
+	Tensor::add_allocated_by_thread(_workspaceSizeInBytes);
 }
 
 void Psnr::forward() {
 	auto size = _inputs[0]->value()->size();
+	if (is_cpu()) {
+		const float *a = _inputs[0]->value()->cpu_data();
+		const float *b = _inputs[1]->value()->cpu_data();
+		for (int i = 0; i < size; ++i)
+			_error[i] = a[i] - b[i];
+		float norm;
+		CpuReduction::reduce(deepflow::ReduceParam_ReduceOp_NORM2, _error.data(), { 1, 1, 1, size }, 0xF, &norm);
+		_psnr = 20.0f * log10(2.0f) - 10.0f * log10(norm * norm / size);
+		return;
+	}
 	SquareErrorKernel <<< numOfBlocks(size), maxThreadsPerBlock >>> (size, _inputs[0]->value()->gpu_data(), _inputs[1]->value()->gpu_data(), d_square_error);
 	DF_KERNEL_CHECK();	
 	DF_NODE_CUDNN_CHECK(
@@ -7,7 +7,8 @@ RandomSelector::RandomSelector(deepflow::NodeParam *param) : Node(param) {
 void RandomSelector::init()
 {
 	LOG_IF(FATAL, _inputs[0]->value()->size() != _inputs[1]->value()->size()) << "Size mismatch " << _inputs[0]->value()->shape() << " vs " << _inputs[1]->value()->shape();
-	_outputs[0]->initValue(_inputs[0]->dims());
+	// The output serves the selected input without a copy.
+	_outputs[0]->initValue(_inputs[0]->dims(), _inputs[0]->value());
 	auto param = _param->random_selector_param();
 	_probability = param.probability();
 	_outputs[0]->initDiff();	
@@ -17,10 +18,7 @@ void RandomSelector::forward()
 {
 	float rnd = ((float)rand() / RAND_MAX);
 	_selection = (rnd < _probability) ? 0 : 1;
-	if (_selection == 0)
-		DF_NODE_CUDA_CHECK(cudaMemcpy(_outputs[0]->value()->gpu_data(), _inputs[0]->value()->gpu_data(), _inputs[0]->value()->bytes(), cudaMemcpyDeviceToDevice))
-	else
-		DF_NODE_CUDA_CHECK(cudaMemcpy(_outputs[0]->value()->gpu_data(), _inputs[1]->value()->gpu_data(), _inputs[1]->value()->bytes(), cudaMemcpyDeviceToDevice))
+	_outputs[0]->value()->shadow(_inputs[_selection]->value());
 }
 
 void RandomSelector::backward()
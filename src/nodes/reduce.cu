@@ -0,0 +1,206 @@
+#include "nodes/reduce.h"
+#include "core/common_cu.h"
+#include "core/cpu_parallel.h"
+#include "core/cpu_reduction.h"
+
+// Gradients of the reductions that have one: dy is broadcast back over the reduced dims, scaled by
+// 1 / count for the mean, by sign(x) for NORM1 and by x / y for NORM2.
+__host__ __device__
+inline float ReduceGradient(const int op, const float scale, const float x, const float y, const float dy)
+{
+	float g = dy * scale;
+	if (op == deepflow::ReduceParam_ReduceOp_NORM1)
+		g *= (x > 0) - (x < 0);
+	else if (op == deepflow::ReduceParam_ReduceOp_NORM2)
+		g = (y == 0) ? 0 : g * x / y;
+	return g;
+}
+
+__host__ __device__
+inline int ReduceOutputIndex(const int i, const int axes, const int c, const int h, const int w, const int oc, const int oh, const int ow)
+{
+	const int iw = i % w, ih = (i / w) % h, ic = (i / (w * h)) % c, in = i / (w * h * c);
+	return ((((axes & 1) ? 0 : in) * oc + ((axes & 2) ? 0 : ic)) * oh + ((axes & 4) ? 0 : ih)) * ow + ((axes & 8) ? 0 : iw);
+}
+
+__global__
+void ReduceKernelBackward(const int n, const int op, const int axes, const int c, const int h, const int w, const int oc, const int oh, const int ow, const float scale, const float * __restrict__ x, const float * __restrict__ y, const float * __restrict__ dy, float * __restrict__ dx)
+{
+	int i = blockIdx.x*blockDim.x + threadIdx.x;
+	if (i < n) {
+		int o = ReduceOutputIndex(i, axes, c, h, w, oc, oh, ow);
+		dx[i] = ReduceGradient(op, scale, x[i], y[o], dy[o]);
+	}
+}
+
+Reduce::Reduce(deepflow::NodeParam *param) : Node(param) {
+	LOG_IF(FATAL, param->has_reduce_param() == false) << "param.has_reduce_param() == false [FAILED]";
+}
+
+std::string Reduce::op_name() const
+{
+	std::string op;
+	switch (_reduceTensorOp) {
+	case deepflow::ReduceParam_ReduceOp_ADD:
+		op = "reduce_sum";
+		break;
+	case deepflow::ReduceParam_ReduceOp_MUL:
+		op = "reduce_mul";
+		break;
+	case deepflow::ReduceParam_ReduceOp_MIN:
+		if (_type == deepflow::ReduceParam_OutputType_VALUES)
+			op = "reduce_min";
+		else
+			op = "argmin";
+		break;
+	case deepflow::ReduceParam_ReduceOp_MAX:
+		if (_type == deepflow::ReduceParam_OutputType_VALUES)
+			op = "reduce_max";
+		else
+			op = "argmax";
+		break;
+	case deepflow::ReduceParam_ReduceOp_AMAX:
+		op = "reduce_absmax";
+		break;
+	case deepflow::ReduceParam_ReduceOp_AVG:
+		op = "reduce_mean";
+		break;
+	case deepflow::ReduceParam_ReduceOp_NORM1:
+		op = "reduce_norm1";
+		break;
+	case deepflow::ReduceParam_ReduceOp_NORM2:
+		op = "reduce_norm2";
+		break;
+	};
+
+	return op;
+}
+
+void Reduce::init() {
+	
+	auto reduceParam = _param->reduce_param();
+	_axes = 0;
+	if (reduceParam.reduce_dims_size() == 0) {
+		int reduceDim = reduceParam.reduce_dim();
+		LOG_IF(FATAL, reduceDim < 0 || reduceDim > 3) << "reduceDim > 3 [FAILED]";
+		_axes = 1 << reduceDim;
+	}
+	for (auto reduceDim : reduceParam.reduce_dims()) {
+		LOG_IF(FATAL, reduceDim < 0 || reduceDim > 3) << "reduceDim > 3 [FAILED]";
+		_axes |= 1 << reduceDim;
+	}
+	_reduceTensorOp = (cudnnReduceTensorOp_t) reduceParam.reduce_op();
+	_type = reduceParam.output_type();
+
+	auto inputDims = _inputs[0]->value()->dims();
+	auto outputDims = CpuReduction::output_dims(inputDims, _axes);
+
+	_outputs[0]->initValue(outputDims);
+	_outputs[1]->initValue(outputDims);	
+	_outputs[0]->initDiff();
+
+	if (is_cpu())
+		return;
+
+	DF_NODE_CUDNN_CHECK(cudnnCreate(&_cudnnHandle));	
+	
+	if (requiresIndices())
+		_reduceTensorIndices = CUDNN_REDUCE_TENSOR_FLATTENED_INDICES;
+	else
+		_reduceTensorIndices = CUDNN_REDUCE_TENSOR_NO_INDICES;
+	
+	DF_NODE_CUDNN_CHECK(cudnnCreateReduceTensorDescriptor(&_reduceTensorDesciptor));	
+	DF_NODE_CUDNN_CHECK(cudnnSetReduceTensorDescriptor(_reduceTensorDesciptor, _reduceTensorOp, CUDNN_DATA_FLOAT, CUDNN_PROPAGATE_NAN, _reduceTensorIndices, CUDNN_32BIT_INDICES));
+	DF_NODE_CUDNN_CHECK(cudnnGetReductionWorkspaceSize(_cudnnHandle, _reduceTensorDesciptor, _inputs[0]->value()->descriptor(), _outputs[0]->value()->descriptor(), &_workspaceSizeInBytes));
+	DF_NODE_CUDA_CHECK(cudaMalloc(&_d_workspace, _workspaceSizeInBytes));	
+	Tensor::add_allocated_by_thread(_workspaceSizeInBytes);
+}
+
+bool Reduce::requiresIndices() {
+	return (_reduceTensorOp == CUDNN_REDUCE_TENSOR_MAX || _reduceTensorOp == CUDNN_REDUCE_TENSOR_MIN);
+}
+
+std::string Reduce::to_cpp() const
+{
+	auto reduceParam = _param->reduce_param();
+	int reduceDim = reduceParam.reduce_dim();
+	if (reduceParam.reduce_dims_size() > 0) {
+		static const char *ops[] = { "add", "mul", "min", "max", "amax", "avg", "norm1", "norm2" };
+		std::string dims;
+		for (auto dim : reduceParam.reduce_dims())
+			dims += (dims.empty() ? "" : ", ") + std::to_string(dim);
+		std::string cpp = "auto " + _name + " = df.reduce(" + _input_name_for_cpp(0) + ", ReduceOp(\"" + _name + "\").reduce({ " + dims + " })." + ops[reduceParam.reduce_op()] + "()";
+		if (reduceParam.output_type() == deepflow::ReduceParam_OutputType_INDICES)
+			cpp += ".indicies().terminal(1)";
+		cpp += ");";
+		return cpp;
+	}
+
+	std::string cpp = "auto " + _name + " = df." + op_name() + "(" + _input_name_for_cpp(0) + ", " + std::to_string(reduceDim) + ", ";
+	cpp += "\"" + _name + "\");";	
+	return cpp;
+}
+
+void Reduce::forward() {		
+	if (is_cpu()) {
+		CpuReduction::reduce(
+			(deepflow::ReduceParam_ReduceOp) _reduceTensorOp,
+			_inputs[0]->value()->cpu_data(),
+			_inputs[0]->value()->dims(),
+			_axes,
+			_outputs[0]->value()->cpu_data(),
+			1.0f,
+			0.0f,
+			requiresIndices() ? (unsigned int*)_outputs[1]->value()->cpu_data() : nullptr);
+		return;
+	}
+	DF_NODE_CUDNN_CHECK(
+		cudnnReduceTensor(
+			_cudnnHandle,
+			_reduceTensorDesciptor,
+			requiresIndices() ? _outputs[1]->value()->gpu_data() : 0,
+			requiresIndices() ? _outputs[1]->value()->bytes() : 0,
+			_d_workspace,
+			_workspaceSizeInBytes,
+			&one,
+			_inputs[0]->value()->descriptor(),
+			_inputs[0]->value()->gpu_data(),
+			&zero,
+			_outputs[0]->value()->descriptor(),
+			_outputs[0]->value()->gpu_data()));
+}
+
+void Reduce::backward() {
+	if (!_inputs[0]->diff())
+		return;
+	auto op = _param->reduce_param().reduce_op();
+	bool differentiable = op == deepflow::ReduceParam_ReduceOp_ADD || op == deepflow::ReduceParam_ReduceOp_AVG || op == deepflow::ReduceParam_ReduceOp_NORM1 || op == deepflow::ReduceParam_ReduceOp_NORM2;
+	auto size = _inputs[0]->value()->size();
+	if (!differentiable) {
+		// MUL, MIN, MAX and AMAX do not propagate a gradient.
+		if (is_cpu())
+			memset(_inputs[0]->diff()->cpu_data(), 0, _inputs[0]->diff()->bytes());
+		else
+			DF_NODE_CUDA_CHECK(cudaMemset(_inputs[0]->diff()->gpu_data(), 0, _inputs[0]->diff()->bytes()));
+		return;
+	}
+	auto dims = _inputs[0]->value()->dims();
+	auto outputDims = _outputs[0]->value()->dims();
+	float scale = op == deepflow::ReduceParam_ReduceOp_AVG ? (float)outputDims[0] * outputDims[1] * outputDims[2] * outputDims[3] / size : 1.0f;
+	if (is_cpu()) {
+		const float *x = _inputs[0]->value()->cpu_data();
+		const float *y = _outputs[0]->value()->cpu_data();
+		const float *dy = _outputs[0]->diff()->cpu_data();
+		float *dx = _inputs[0]->diff()->cpu_data();
+		int axes = _axes;
+		CpuParallel::for_range(size, 4096, [&](size_t begin, size_t end) {
+			for (size_t i = begin; i < end; ++i) {
+				int o = ReduceOutputIndex((int)i, axes, dims[1], dims[2], dims[3], outputDims[1], outputDims[2], outputDims[3]);
+				dx[i] = ReduceGradient(op, scale, x[i], y[o], dy[o]);
+			}
+		});
+		return;
+	}
+	ReduceKernelBackward << < numOfBlocks(size), maxThreadsPerBlock >> > (size, op, _axes, dims[1], dims[2], dims[3], outputDims[1], outputDims[2], outputDims[3], scale, _inputs[0]->value()->gpu_data(), _outputs[0]->value()->gpu_data(), _outputs[0]->diff()->gpu_data(), _inputs[0]->diff()->gpu_data());
+	DF_NODE_KERNEL_CHECK();
+}
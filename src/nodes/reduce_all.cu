@@ -1,5 +1,6 @@
 #include "nodes/reduce_all.h"
 #include "core/common_cu.h"
+#include "core/cpu_reduction.h"
 
 __global__
 void ReduceAllKernelForward(const int n, bool average, const float *x, float *y)
@@ -37,13 +38,23 @@ void ReduceAll::init() {
 
 void ReduceAll::forward() {
 	auto size = _inputs[0]->value()->size();
+	if (is_cpu()) {
+		auto op = _reduce_op == deepflow::ReduceAllParam_ReduceAllOp_AVG ? deepflow::ReduceParam_ReduceOp_AVG : deepflow::ReduceParam_ReduceOp_ADD;
+		CpuReduction::reduce(op, _inputs[0]->value()->cpu_data(), _inputs[0]->value()->dims(), 0xF, _outputs[0]->value()->cpu_data());
+		return;
+	}
 	DF_CUDA_CHECK(cudaMemset(_outputs[0]->value()->gpu_data(), 0, _outputs[0]->value()->bytes()));	
 	ReduceAllKernelForward << < numOfBlocks(size), maxThreadsPerBlock >> > (size, _reduce_op == deepflow::ReduceAllParam_ReduceAllOp_AVG, _inputs[0]->value()->gpu_data(), (float*)_outputs[0]->value()->gpu_data());
 	DF_KERNEL_CHECK();
 }
 
 void ReduceAll::backward() {
-	if (_inputs[0]->diff()) {
+	if (_inputs[0]->diff() && is_cpu()) {
+		auto size = _inputs[0]->value()->size();
+		float dy = _outputs[0]->diff()->cpu_data()[0];
+		fill(size, _reduce_op == deepflow::ReduceAllParam_ReduceAllOp_AVG ? dy / size : dy, _inputs[0]->diff()->cpu_data());
+	}
+	else if (_inputs[0]->diff()) {
 		auto size = _inputs[0]->value()->size();
 		ReduceAllKernelBackward << < numOfBlocks(size), maxThreadsPerBlock >> > (size, _reduce_op == deepflow::ReduceAllParam_ReduceAllOp_AVG, _outputs[0]->diff()->gpu_data(), (float*)_inputs[0]->diff()->gpu_data());
 		DF_KERNEL_CHECK();
@@ -0,0 +1,36 @@
+#include "nodes/reorder.h"
+#include "core/cpu_layout.h"
+
+Reorder::Reorder(deepflow::NodeParam *param) : Node(param)
+{
+	LOG_IF(FATAL, param->has_reorder_param() == false) << "param.has_reorder_param() == false";
+}
+
+void Reorder::init()
+{
+	LOG_IF(FATAL, !is_cpu()) << _name << " - reorder is host only.";
+	_outputs[0]->initValue(_inputs[0]->value()->dims());
+	_outputs[0]->initDiff();
+}
+
+void Reorder::forward()
+{
+	auto x = _inputs[0]->value();
+	auto y = _outputs[0]->value();
+	CpuLayout::reorder(x->dims(), x->channel_block(), x->cpu_data(), y->channel_block(), y->cpu_data());
+}
+
+void Reorder::backward()
+{
+	if (_inputs[0]->diff()) {
+		auto dy = _outputs[0]->diff();
+		auto dx = _inputs[0]->diff();
+		CpuLayout::reorder(dy->dims(), dy->channel_block(), dy->cpu_data(), dx->channel_block(), dx->cpu_data());
+	}
+}
+
+std::string Reorder::to_cpp() const
+{
+	// Inserted by GraphLayout at initialization, the source graph has no reorders.
+	return std::string();
+}
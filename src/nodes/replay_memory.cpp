@@ -1,4 +1,20 @@
 #include "nodes/replay_memory.h"
+#include "core/cpu_parallel.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <random>
+
+// Keeps priorities of zero from starving a slot forever.
+static const float kPriorityEpsilon = 1e-6f;
+
+// One generator per thread: sessions on different threads never share sampling state.
+static std::mt19937 &replay_generator()
+{
+	static thread_local std::mt19937 generator(std::random_device{}());
+	return generator;
+}
 
 ReplayMemory::ReplayMemory(deepflow::NodeParam *param) : Node(param)
 {
@@ -7,18 +23,65 @@ ReplayMemory::ReplayMemory(deepflow::NodeParam *param) : Node(param)
 
 void ReplayMemory::init()
 {
-	_capacity = _param->replay_memory_param().capacity();
+	auto param = _param->replay_memory_param();
+	_capacity = param.capacity();
 	auto inputDims = _inputs[0]->value()->dims();
 	_num_samples_per_batch = inputDims[0];
-	LOG_IF(FATAL, _capacity % _num_samples_per_batch != 0) << "Memory capacity must be dividable by the batch size.";
 	_size_per_sample = inputDims[1] * inputDims[2] * inputDims[3];
 	_mem_size = _capacity * _size_per_sample;
+	_outputs[0]->initValue(inputDims);
+	if (is_cpu()) {
+		LOG_IF(FATAL, _capacity <= 0) << "[FAILED] " << _name << " - Memory capacity must be positive.";
+		_memory.resize(_mem_size);
+		_sampled_slots.resize(_num_samples_per_batch);
+		_prioritized = param.prioritized();
+		_alpha = param.alpha();
+		if (_prioritized)
+			_priorities.resize(_capacity);
+		return;
+	}
+	LOG_IF(FATAL, param.prioritized()) << "[FAILED] " << _name << " - Prioritized replay is only available on the CPU.";
+	LOG_IF(FATAL, _capacity % _num_samples_per_batch != 0) << "Memory capacity must be dividable by the batch size.";
 	DF_NODE_CUDA_CHECK(cudaMalloc(&dev_memory, _mem_size * sizeof(float)));
-	_outputs[0]->initValue(inputDims);	
 }
 
 void ReplayMemory::forward()
 {	
+	if (is_cpu()) {
+		// Ring buffer of samples: the batch goes in slot by slot, wrapping at capacity.
+		const size_t sample_bytes = _size_per_sample * sizeof(float);
+		const float *x = _inputs[0]->value()->cpu_data();
+		const int written = std::min(_num_samples_per_batch, _capacity);
+		const int skipped = _num_samples_per_batch - written;
+		for (int i = 0; i < written; ++i) {
+			const int slot = (int)((_input_head + i) % _capacity);
+			memcpy(_memory.data() + (size_t)slot * _size_per_sample, x + (size_t)(skipped + i) * _size_per_sample, sample_bytes);
+			if (_prioritized)
+				_priorities.set(slot, _max_priority);
+		}
+		_input_head = (_input_head + written) % _capacity;
+		_available_samples = std::min(_capacity, _available_samples + written);
+		// Every output sample is an independent draw over the filled slots.
+		auto &generator = replay_generator();
+		if (_prioritized) {
+			// Stratified: one draw from each of batch equal parts of the priority mass.
+			const float segment = _priorities.total() / _num_samples_per_batch;
+			std::uniform_real_distribution<float> offset(0.0f, 1.0f);
+			for (int i = 0; i < _num_samples_per_batch; ++i)
+				_sampled_slots[i] = _priorities.find((i + offset(generator)) * segment);
+		}
+		else {
+			std::uniform_int_distribution<int> slot(0, _available_samples - 1);
+			for (int i = 0; i < _num_samples_per_batch; ++i)
+				_sampled_slots[i] = slot(generator);
+		}
+		float *y = _outputs[0]->value()->cpu_data();
+		CpuParallel::for_range(_num_samples_per_batch, std::max<size_t>(1, (64 << 10) / sample_bytes), [&](size_t begin, size_t end) {
+			for (size_t i = begin; i < end; ++i)
+				memcpy(y + i * _size_per_sample, _memory.data() + (size_t)_sampled_slots[i] * _size_per_sample, sample_bytes);
+		});
+		return;
+	}
 	size_t n = _inputs[0]->value()->size();
 	LOG_IF(INFO, _verbose > 3) << " INPUT HEAD: " << _input_head;
 	cpy(n, 1.0f, _inputs[0]->value()->gpu_data(), 0.0f, dev_memory + _input_head);
@@ -45,3 +108,35 @@ std::string ReplayMemory::to_cpp() const
 {
 	return std::string();
 }
+
+const std::vector<int> &ReplayMemory::sampled_slots() const
+{
+	return _sampled_slots;
+}
+
+void ReplayMemory::update_priorities(const std::vector<int> &slots, const std::vector<float> &priorities)
+{
+	LOG_IF(FATAL, !_prioritized) << "[FAILED] " << _name << " - update_priorities needs a prioritized replay memory.";
+	LOG_IF(FATAL, slots.size() != priorities.size()) << "[FAILED] " << _name << " - " << slots.size() << " slots but " << priorities.size() << " priorities.";
+	for (size_t i = 0; i < slots.size(); ++i) {
+		const float priority = powf(fabsf(priorities[i]) + kPriorityEpsilon, _alpha);
+		_priorities.set(slots[i], priority);
+		_max_priority = std::max(_max_priority, priority);
+	}
+}
+
+std::vector<float> ReplayMemory::importance_weights(float beta) const
+{
+	std::vector<float> weights(_sampled_slots.size(), 1.0f);
+	if (!_prioritized || _priorities.total() <= 0)
+		return weights;
+	float largest = 0;
+	for (size_t i = 0; i < weights.size(); ++i) {
+		const float probability = _priorities.get(_sampled_slots[i]) / _priorities.total();
+		weights[i] = powf(_available_samples * probability, -beta);
+		largest = std::max(largest, weights[i]);
+	}
+	for (auto &w : weights)
+		w /= largest;
+	return weights;
+}
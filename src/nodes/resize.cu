@@ -1,5 +1,21 @@
 #include "nodes/resize.h"
 #include "core/common_cu.h"
+#include "core/cpu_parallel.h"
+
+#include <cstring>
+
+// Bilinear source coordinate of output o with half pixel centers (align_corners = false).
+__host__ __device__ inline void bilinear_source(const int o, const float scale, const int size, int &i0, int &i1, float &l)
+{
+	float s = (o + 0.5f) / scale - 0.5f;
+	if (s < 0)
+		s = 0;
+	i0 = (int)s;
+	if (i0 > size - 1)
+		i0 = size - 1;
+	i1 = i0 + 1 < size ? i0 + 1 : size - 1;
+	l = i1 > i0 ? s - i0 : 0;
+}
 
 
 __global__ void NearestNeighborKernel(
@@ -12,6 +28,9 @@ __global__ void NearestNeighborKernel(
 	const float height_scale,
 	const float width_scale,
 	const float* X,
+	const float alpha,
+	const float* add,
+	const float beta,
 	float* Y) {
 	int i = blockIdx.x*blockDim.x + threadIdx.x;
 	if (i < y_size) {
@@ -26,8 +45,8 @@ __global__ void NearestNeighborKernel(
 
 		const int in_y = fminf(h / height_scale, input_height - 1);
 		const int in_x = fminf(w / width_scale, input_width - 1);
-		Y[i] =
-			X[((n * num_channels + c) * input_height + in_y) * input_width + in_x];
+		const float v = X[((n * num_channels + c) * input_height + in_y) * input_width + in_x];
+		Y[i] = add ? alpha * v + beta * add[i] : v;
 	}
 }
 
@@ -41,6 +60,7 @@ __global__ void NearestNeighborGradientKernel(
 	const float height_scale,
 	const float width_scale,
 	const float* dY,
+	const float alpha,
 	float* dX) {
 	int i = blockIdx.x*blockDim.x + threadIdx.x;
 	if (i < dy_size) {
@@ -59,70 +79,417 @@ __global__ void NearestNeighborGradientKernel(
 			((n * num_channels + c) * output_height + out_y) * output_width + out_x;
 		
 #if __CUDA_ARCH__ >= 350
-		atomicAdd(dX + out_index, __ldg(dY + i));
+		atomicAdd(dX + out_index, alpha * __ldg(dY + i));
 #else 
-		atomicAdd(dX + out_index, *(dY + i));
+		atomicAdd(dX + out_index, alpha * *(dY + i));
 #endif
 	
 	}
 }
 
+__global__ void BilinearKernel(
+	const int y_size,
+	const int num_channels,
+	const int input_height,
+	const int input_width,
+	const int output_height,
+	const int output_width,
+	const float height_scale,
+	const float width_scale,
+	const float* X,
+	const float alpha,
+	const float* add,
+	const float beta,
+	float* Y) {
+	int i = blockIdx.x*blockDim.x + threadIdx.x;
+	if (i < y_size) {
+		int indexTemp = i;
+		const int w = indexTemp % output_width;
+		indexTemp /= output_width;
+		const int h = indexTemp % output_height;
+		indexTemp /= output_height;
+		const int nc = indexTemp;
+		int y0, y1, x0, x1;
+		float ly, lx;
+		bilinear_source(h, height_scale, input_height, y0, y1, ly);
+		bilinear_source(w, width_scale, input_width, x0, x1, lx);
+		const float *p = X + nc * input_height * input_width;
+		const float v =
+			(1 - ly) * ((1 - lx) * p[y0 * input_width + x0] + lx * p[y0 * input_width + x1]) +
+			ly * ((1 - lx) * p[y1 * input_width + x0] + lx * p[y1 * input_width + x1]);
+		Y[i] = add ? alpha * v + beta * add[i] : v;
+	}
+}
+
+__global__ void BilinearGradientKernel(
+	const int dy_size,
+	const int input_height,
+	const int input_width,
+	const int output_height,
+	const int output_width,
+	const float height_scale,
+	const float width_scale,
+	const float* dY,
+	const float alpha,
+	float* dX) {
+	int i = blockIdx.x*blockDim.x + threadIdx.x;
+	if (i < dy_size) {
+		int indexTemp = i;
+		const int w = indexTemp % output_width;
+		indexTemp /= output_width;
+		const int h = indexTemp % output_height;
+		indexTemp /= output_height;
+		const int nc = indexTemp;
+		int y0, y1, x0, x1;
+		float ly, lx;
+		bilinear_source(h, height_scale, input_height, y0, y1, ly);
+		bilinear_source(w, width_scale, input_width, x0, x1, lx);
+		float *p = dX + nc * input_height * input_width;
+		const float g = alpha * dY[i];
+		atomicAdd(p + y0 * input_width + x0, (1 - ly) * (1 - lx) * g);
+		atomicAdd(p + y0 * input_width + x1, (1 - ly) * lx * g);
+		atomicAdd(p + y1 * input_width + x0, ly * (1 - lx) * g);
+		atomicAdd(p + y1 * input_width + x1, ly * lx * g);
+	}
+}
+
+// Taps of one axis and their transpose, so backward gathers into each input instead of scattering.
+static void resize_axis_cpu(Resize::Axis &axis, deepflow::ResizeParam_Mode mode, float scale, int input_size, int output_size)
+{
+	axis.tap.resize(2 * output_size);
+	axis.tap_weight.resize(2 * output_size);
+	for (int o = 0; o < output_size; ++o) {
+		if (mode == deepflow::ResizeParam_Mode_BILINEAR) {
+			float l;
+			bilinear_source(o, scale, input_size, axis.tap[2 * o], axis.tap[2 * o + 1], l);
+			axis.tap_weight[2 * o] = 1 - l;
+			axis.tap_weight[2 * o + 1] = l;
+		}
+		else {
+			axis.tap[2 * o] = axis.tap[2 * o + 1] = (int)fminf(o / scale, input_size - 1);
+			axis.tap_weight[2 * o] = 1;
+			axis.tap_weight[2 * o + 1] = 0;
+		}
+	}
+	axis.grad_begin.assign(input_size + 1, 0);
+	for (int k = 0; k < 2 * output_size; ++k)
+		if (axis.tap_weight[k] != 0)
+			axis.grad_begin[axis.tap[k] + 1]++;
+	for (int i = 0; i < input_size; ++i)
+		axis.grad_begin[i + 1] += axis.grad_begin[i];
+	axis.grad_output.resize(axis.grad_begin[input_size]);
+	axis.grad_weight.resize(axis.grad_begin[input_size]);
+	std::vector<int> next(axis.grad_begin.begin(), axis.grad_begin.end() - 1);
+	for (int k = 0; k < 2 * output_size; ++k) {
+		if (axis.tap_weight[k] != 0) {
+			int pos = next[axis.tap[k]]++;
+			axis.grad_output[pos] = k / 2;
+			axis.grad_weight[pos] = axis.tap_weight[k];
+		}
+	}
+}
+
+// y = alpha * resize(x) + beta * add when add is not null, y = resize(x) otherwise.
+static void resize_forward_cpu(const Resize::Axis &rows, const Resize::Axis &columns, bool bilinear, int planes, int IH, int IW, int OH, int OW, const float *x, float alpha, const float *add, float beta, float *y)
+{
+	CpuParallel::for_range(planes, 1, [&](size_t begin, size_t end) {
+		for (size_t p = begin; p < end; ++p) {
+			const float *xp = x + p * IH * IW;
+			float *yp = y + p * OH * OW;
+			for (int oh = 0; oh < OH; ++oh) {
+				const float *r0 = xp + rows.tap[2 * oh] * IW;
+				const float *r1 = xp + rows.tap[2 * oh + 1] * IW;
+				const float wr0 = rows.tap_weight[2 * oh];
+				const float wr1 = rows.tap_weight[2 * oh + 1];
+				float *yr = yp + oh * OW;
+				if (bilinear) {
+					for (int ow = 0; ow < OW; ++ow) {
+						const int c0 = columns.tap[2 * ow], c1 = columns.tap[2 * ow + 1];
+						const float wc0 = columns.tap_weight[2 * ow], wc1 = columns.tap_weight[2 * ow + 1];
+						yr[ow] = wr0 * (wc0 * r0[c0] + wc1 * r0[c1]) + wr1 * (wc0 * r1[c0] + wc1 * r1[c1]);
+					}
+				}
+				else {
+					for (int ow = 0; ow < OW; ++ow)
+						yr[ow] = r0[columns.tap[2 * ow]];
+				}
+				if (add) {
+					const float *ar = add + p * OH * OW + oh * OW;
+					for (int ow = 0; ow < OW; ++ow)
+						yr[ow] = alpha * yr[ow] + beta * ar[ow];
+				}
+			}
+		}
+	});
+}
+
+// dx = alpha * R^T dy C, the column pass gathers each dy row into a OH x IW buffer and the row pass
+// gathers those rows into dx, the summation order is fixed so results are reproducible.
+static void resize_backward_cpu(const Resize::Axis &rows, const Resize::Axis &columns, int planes, int IH, int IW, int OH, int OW, const float *dy, float alpha, float *dx)
+{
+	CpuParallel::for_range(planes, 1, [&](size_t begin, size_t end) {
+		std::vector<float> buffer((size_t)OH * IW);
+		for (size_t p = begin; p < end; ++p) {
+			const float *dyp = dy + p * OH * OW;
+			float *dxp = dx + p * IH * IW;
+			for (int oh = 0; oh < OH; ++oh) {
+				const float *dr = dyp + oh * OW;
+				float *br = buffer.data() + oh * IW;
+				for (int iw = 0; iw < IW; ++iw) {
+					float sum = 0;
+					for (int k = columns.grad_begin[iw]; k < columns.grad_begin[iw + 1]; ++k)
+						sum += columns.grad_weight[k] * dr[columns.grad_output[k]];
+					br[iw] = sum;
+				}
+			}
+			for (int ih = 0; ih < IH; ++ih) {
+				float *xr = dxp + ih * IW;
+				memset(xr, 0, IW * sizeof(float));
+				for (int k = rows.grad_begin[ih]; k < rows.grad_begin[ih + 1]; ++k) {
+					const float w = alpha * rows.grad_weight[k];
+					const float *br = buffer.data() + rows.grad_output[k] * IW;
+					for (int iw = 0; iw < IW; ++iw)
+						xr[iw] += w * br[iw];
+				}
+			}
+		}
+	});
+}
+
+// Nearest neighbour x2, every input pixel fills a 2x2 block.
+static void resize_up2_forward_cpu(int planes, int IH, int IW, const float *x, float alpha, const float *add, float beta, float *y)
+{
+	const int OW = 2 * IW;
+	CpuParallel::for_range((size_t)planes * IH, 16, [&](size_t begin, size_t end) {
+		for (size_t r = begin; r < end; ++r) {
+			const float *xr = x + r * IW;
+			float *y0 = y + 2 * r * OW;
+			float *y1 = y0 + OW;
+			if (add) {
+				const float *a0 = add + 2 * r * OW;
+				const float *a1 = a0 + OW;
+				for (int iw = 0; iw < IW; ++iw) {
+					const float v = alpha * xr[iw];
+					y0[2 * iw] = v + beta * a0[2 * iw];
+					y0[2 * iw + 1] = v + beta * a0[2 * iw + 1];
+					y1[2 * iw] = v + beta * a1[2 * iw];
+					y1[2 * iw + 1] = v + beta * a1[2 * iw + 1];
+				}
+			}
+			else {
+				for (int iw = 0; iw < IW; ++iw)
+					y0[2 * iw] = y0[2 * iw + 1] = xr[iw];
+				memcpy(y1, y0, OW * sizeof(float));
+			}
+		}
+	});
+}
+
+static void resize_up2_backward_cpu(int planes, int IH, int IW, const float *dy, float alpha, float *dx)
+{
+	const int OW = 2 * IW;
+	CpuParallel::for_range((size_t)planes * IH, 16, [&](size_t begin, size_t end) {
+		for (size_t r = begin; r < end; ++r) {
+			const float *d0 = dy + 2 * r * OW;
+			const float *d1 = d0 + OW;
+			float *xr = dx + r * IW;
+			for (int iw = 0; iw < IW; ++iw)
+				xr[iw] = alpha * ((d0[2 * iw] + d0[2 * iw + 1]) + (d1[2 * iw] + d1[2 * iw + 1]));
+		}
+	});
+}
+
+// Nearest neighbour x0.5 reads the top left pixel of every 2x2 block.
+static void resize_down2_forward_cpu(int planes, int IH, int IW, int OH, int OW, const float *x, float alpha, const float *add, float beta, float *y)
+{
+	CpuParallel::for_range((size_t)planes * OH, 16, [&](size_t begin, size_t end) {
+		for (size_t r = begin; r < end; ++r) {
+			const size_t p = r / OH, oh = r % OH;
+			const float *xr = x + (p * IH + 2 * oh) * IW;
+			float *yr = y + r * OW;
+			if (add) {
+				const float *ar = add + r * OW;
+				for (int ow = 0; ow < OW; ++ow)
+					yr[ow] = alpha * xr[2 * ow] + beta * ar[ow];
+			}
+			else {
+				for (int ow = 0; ow < OW; ++ow)
+					yr[ow] = xr[2 * ow];
+			}
+		}
+	});
+}
+
+static void resize_down2_backward_cpu(int planes, int IH, int IW, int OH, int OW, const float *dy, float alpha, float *dx)
+{
+	CpuParallel::for_range((size_t)planes * IH, 16, [&](size_t begin, size_t end) {
+		for (size_t r = begin; r < end; ++r) {
+			const size_t p = r / IH, ih = r % IH;
+			float *xr = dx + r * IW;
+			memset(xr, 0, IW * sizeof(float));
+			if (ih % 2 == 0 && ih / 2 < OH) {
+				const float *dr = dy + (p * OH + ih / 2) * OW;
+				for (int ow = 0; ow < OW; ++ow)
+					xr[2 * ow] = alpha * dr[ow];
+			}
+		}
+	});
+}
+
 Resize::Resize(deepflow::NodeParam *param) : Node(param) {
 	LOG_IF(FATAL, param->has_resize_param() == false) << "param.has_resize_param() == false";
+	_add = param->resize_param().add();
 }
 
 void Resize::init() {
 	auto param = _param->resize_param();
 	m_height_scale = param.height_scale();
 	m_width_scale = param.width_scale();
+	_mode = param.mode();
+	if (_add) {
+		_alpha = param.alpha();
+		_beta = param.beta();
+	}
 	auto input_dims = _inputs[0]->value()->dims();
-	_outputs[0]->initValue({input_dims[0], input_dims[1], (int) (input_dims[2] * m_height_scale), (int) (input_dims[3] * m_width_scale) });
-	_outputs[0]->initDiff();	
+	std::array<int, 4> output_dims = { input_dims[0], input_dims[1], (int)(input_dims[2] * m_height_scale), (int)(input_dims[3] * m_width_scale) };
+	LOG_IF(FATAL, _add && _inputs[1]->value()->dims() != output_dims) << "Resize " << _name << " - input 1 " << _inputs[1]->value()->shape() << " must have the shape of the resized input 0.";
+	_outputs[0]->initValue(output_dims);
+	_outputs[0]->initDiff();
+	if (is_cpu()) {
+		resize_axis_cpu(_rows, _mode, m_height_scale, input_dims[2], output_dims[2]);
+		resize_axis_cpu(_columns, _mode, m_width_scale, input_dims[3], output_dims[3]);
+	}
 }
 
 void Resize::forward() {
 	auto size = _outputs[0]->value()->size();
 	auto dims = _inputs[0]->value()->dims();
-	NearestNeighborKernel << < numOfBlocks(size), maxThreadsPerBlock >> > (
-		size,
-		dims[1],
-		dims[2],
-		dims[3],
-		dims[2] * m_height_scale,
-		dims[3] * m_width_scale,
-		m_height_scale,
-		m_width_scale,
-		_inputs[0]->value()->gpu_data(),
-		(float*)_outputs[0]->value()->gpu_data());
+	auto output_dims = _outputs[0]->value()->dims();
+	if (is_cpu()) {
+		const float *add = _add ? _inputs[1]->value()->cpu_data() : nullptr;
+		const float *x = _inputs[0]->value()->cpu_data();
+		float *y = _outputs[0]->value()->cpu_data();
+		if (_mode == deepflow::ResizeParam_Mode_NEAREST && m_height_scale == 2 && m_width_scale == 2)
+			resize_up2_forward_cpu(dims[0] * dims[1], dims[2], dims[3], x, _alpha, add, _beta, y);
+		else if (_mode == deepflow::ResizeParam_Mode_NEAREST && m_height_scale == 0.5f && m_width_scale == 0.5f)
+			resize_down2_forward_cpu(dims[0] * dims[1], dims[2], dims[3], output_dims[2], output_dims[3], x, _alpha, add, _beta, y);
+		else
+			resize_forward_cpu(_rows, _columns, _mode == deepflow::ResizeParam_Mode_BILINEAR, dims[0] * dims[1], dims[2], dims[3], output_dims[2], output_dims[3], x, _alpha, add, _beta, y);
+		return;
+	}
+	const float *add = _add ? _inputs[1]->value()->gpu_data() : nullptr;
+	if (_mode == deepflow::ResizeParam_Mode_BILINEAR)
+		BilinearKernel << < numOfBlocks(size), maxThreadsPerBlock >> > (
+			size,
+			dims[1],
+			dims[2],
+			dims[3],
+			output_dims[2],
+			output_dims[3],
+			m_height_scale,
+			m_width_scale,
+			_inputs[0]->value()->gpu_data(),
+			_alpha,
+			add,
+			_beta,
+			(float*)_outputs[0]->value()->gpu_data());
+	else
+		NearestNeighborKernel << < numOfBlocks(size), maxThreadsPerBlock >> > (
+			size,
+			dims[1],
+			dims[2],
+			dims[3],
+			output_dims[2],
+			output_dims[3],
+			m_height_scale,
+			m_width_scale,
+			_inputs[0]->value()->gpu_data(),
+			_alpha,
+			add,
+			_beta,
+			(float*)_outputs[0]->value()->gpu_data());
 	DF_KERNEL_CHECK();
 }
 
 void Resize::backward() {
-	if (_inputs[0]->diff()) {
+	if (_add && _inputs[1]->diff()) {
+		auto size = _outputs[0]->diff()->size();
+		if (is_cpu())
+			cpy(size, _beta, _outputs[0]->diff()->cpu_data(), 0, _inputs[1]->diff()->cpu_data());
+		else
+			cpy(size, _beta, _outputs[0]->diff()->gpu_data(), 0, _inputs[1]->diff()->gpu_data());
+	}
+	const float alpha = _add ? _alpha : 1.0f;
+	if (_inputs[0]->diff() && is_cpu()) {
+		auto output_dims = _outputs[0]->value()->dims();
+		auto input_dims = _inputs[0]->value()->dims();
+		const float *dy = _outputs[0]->diff()->cpu_data();
+		float *dx = _inputs[0]->diff()->cpu_data();
+		if (_mode == deepflow::ResizeParam_Mode_NEAREST && m_height_scale == 2 && m_width_scale == 2)
+			resize_up2_backward_cpu(input_dims[0] * input_dims[1], input_dims[2], input_dims[3], dy, alpha, dx);
+		else if (_mode == deepflow::ResizeParam_Mode_NEAREST && m_height_scale == 0.5f && m_width_scale == 0.5f)
+			resize_down2_backward_cpu(input_dims[0] * input_dims[1], input_dims[2], input_dims[3], output_dims[2], output_dims[3], dy, alpha, dx);
+		else
+			resize_backward_cpu(_rows, _columns, input_dims[0] * input_dims[1], input_dims[2], input_dims[3], output_dims[2], output_dims[3], dy, alpha, dx);
+	}
+	else if (_inputs[0]->diff()) {
 		auto size = _outputs[0]->value()->size();
 		auto output_dims = _outputs[0]->value()->dims();
 		auto input_dims = _inputs[0]->value()->dims();
 		DF_CUDA_CHECK(cudaMemset(_inputs[0]->diff()->gpu_data(), 0, _inputs[0]->diff()->bytes()));
-		NearestNeighborGradientKernel << < numOfBlocks(size), maxThreadsPerBlock >> > (
-			size,
-			output_dims[1],
-			output_dims[2],
-			output_dims[3],
-			input_dims[2],
-			input_dims[3],
-			m_height_scale,
-			m_width_scale,
-			_outputs[0]->diff()->gpu_data(),
-			(float*)_inputs[0]->diff()->gpu_data());
+		if (_mode == deepflow::ResizeParam_Mode_BILINEAR)
+			BilinearGradientKernel << < numOfBlocks(size), maxThreadsPerBlock >> > (
+				size,
+				input_dims[2],
+				input_dims[3],
+				output_dims[2],
+				output_dims[3],
+				m_height_scale,
+				m_width_scale,
+				_outputs[0]->diff()->gpu_data(),
+				alpha,
+				(float*)_inputs[0]->diff()->gpu_data());
+		else
+			NearestNeighborGradientKernel << < numOfBlocks(size), maxThreadsPerBlock >> > (
+				size,
+				output_dims[1],
+				output_dims[2],
+				output_dims[3],
+				input_dims[2],
+				input_dims[3],
+				m_height_scale,
+				m_width_scale,
+				_outputs[0]->diff()->gpu_data(),
+				alpha,
+				(float*)_inputs[0]->diff()->gpu_data());
 		DF_KERNEL_CHECK();
 	}
 }
 
+void Resize::setAlpha(float alpha)
+{
+	_alpha = alpha;
+}
+
+void Resize::setBeta(float beta)
+{
+	_beta = beta;
+}
+
 std::string Resize::to_cpp() const
 {
-	std::string cpp = "auto " + _name + " = df.resize(" + _input_name_for_cpp(0) + ", ";
+	std::string op = "ResizeOp(\"" + _name + "\")";
+	if (_mode == deepflow::ResizeParam_Mode_BILINEAR)
+		op += ".bilinear()";
+	std::string cpp = "auto " + _name + " = df.";
+	if (_add) {
+		op += ".alpha(" + std::to_string(_alpha) + ").beta(" + std::to_string(_beta) + ")";
+		cpp += "resize_add(" + _input_name_for_cpp(0) + ", " + _input_name_for_cpp(1) + ", ";
+	}
+	else
+		cpp += "resize(" + _input_name_for_cpp(0) + ", ";
 	cpp += std::to_string(m_height_scale) + ", ";
 	cpp += std::to_string(m_width_scale) + ", ";
-	cpp += "\"" + _name + "\");";	
-	return cpp;	
-}
\ No newline at end of file
+	cpp += op + ");";
+	return cpp;
+}
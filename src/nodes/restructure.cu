@@ -1,6 +1,10 @@
 #include "nodes/restructure.h"
 
 #include "core/common_cu.h"
+#include "core/cpu_layout.h"
+#include "core/cpu_transpose.h"
+
+#include <utility>
 
 __global__
 void RestructureKernel(int n, const float *x, const int N, const int C, const int H, const int W, const int swap_dim_1, const int swap_dim_2, float *y)
@@ -39,6 +43,26 @@ void RestructureKernel(int n, const float *x, const int N, const int C, const in
 
 }
 
+// Swapping two dims is its own inverse, so backward runs the same copy on the output dims. Both sides
+// are viewed as (n, c / split, h, w, c % split) in their layouts, a swap that moves the channels takes
+// split 1 and so NCHW or NHWC.
+static void restructure_cpu(std::array<int, 4> dims, int x_block, int y_block, int first_dim, int second_dim, const float *x, float *y, float beta)
+{
+	auto ou_dims = dims;
+	ou_dims[first_dim] = dims[second_dim];
+	ou_dims[second_dim] = dims[first_dim];
+	int split = 1;
+	if (first_dim != 1 && second_dim != 1)
+		split = CpuLayout::split(dims[1], x_block, y_block);
+	else
+		LOG_IF(FATAL, (x_block != 1 && x_block != dims[1]) || (y_block != 1 && y_block != ou_dims[1])) << "Restructure - swapping the channels needs NCHW or NHWC.";
+	const int sizes[5] = { dims[0], dims[1] / split, dims[2], dims[3], split };
+	auto in_strides = CpuLayout::strides(dims, x_block, split);
+	auto ou_strides = CpuLayout::strides(ou_dims, y_block, split);
+	std::swap(ou_strides[first_dim], ou_strides[second_dim]);
+	CpuTranspose::copy(5, sizes, x, in_strides.data(), y, ou_strides.data(), beta);
+}
+
 Restructure::Restructure(deepflow::NodeParam *param) : Node(param) {
 	LOG_IF(FATAL, param->has_restructure_param() == false) << "param.restructure_param() == false";
 	auto restructure_param = _param->restructure_param();
@@ -48,15 +72,38 @@ Restructure::Restructure(deepflow::NodeParam *param) : Node(param) {
 }
 
 void Restructure::init() {		
-	auto in_dim = _inputs[0]->value()->dims();
+	auto x = _inputs[0]->value();
+	auto in_dim = x->dims();
 	auto ou_dim = in_dim;	
 	ou_dim[_first_dim] = in_dim[_second_dim];
 	ou_dim[_second_dim] = in_dim[_first_dim];
-	_outputs[0]->initValue(ou_dim);
+	// In NCHW the output is the input with two strides swapped, consumers gather it only if they need
+	// contiguous data.
+	_view = x->layout() == Tensor::NCHW && _param->layout() == deepflow::NodeParam::NCHW;
+	if (_view)
+		_outputs[0]->initValue(ou_dim, x, x->view_offset(), _strides());
+	else
+		_outputs[0]->initValue(ou_dim);
 	_outputs[0]->initDiff();	
 }
 
+std::array<ptrdiff_t, 4> Restructure::_strides() const
+{
+	auto strides = _inputs[0]->value()->strides();
+	std::swap(strides[_first_dim], strides[_second_dim]);
+	return strides;
+}
+
 void Restructure::forward() {
+	if (_view) {
+		auto x = _inputs[0]->value();
+		_outputs[0]->value()->view(x, x->view_offset(), _strides());
+		return;
+	}
+	if (is_cpu()) {
+		restructure_cpu(_inputs[0]->value()->dims(), _inputs[0]->value()->channel_block(), _outputs[0]->value()->channel_block(), _first_dim, _second_dim, _inputs[0]->value()->cpu_data(), _outputs[0]->value()->cpu_data(), 0);
+		return;
+	}
 	auto size = _inputs[0]->value()->size();
 	auto dim = _inputs[0]->value()->dims();
 	RestructureKernel << < numOfBlocks(size), maxThreadsPerBlock >> > 
@@ -65,7 +112,10 @@ void Restructure::forward() {
 }
 
 void Restructure::backward() {
-	if (_inputs[0]->diff()) {
+	if (_inputs[0]->diff() && is_cpu()) {
+		restructure_cpu(_outputs[0]->diff()->dims(), _outputs[0]->value()->channel_block(), _inputs[0]->value()->channel_block(), _first_dim, _second_dim, _outputs[0]->diff()->cpu_data(), _inputs[0]->diff()->cpu_data(), 0);
+	}
+	else if (_inputs[0]->diff()) {
 		auto size = _outputs[0]->diff()->size();
 		auto dim = _outputs[0]->diff()->dims();
 		RestructureKernel << < numOfBlocks(size), maxThreadsPerBlock >> > 
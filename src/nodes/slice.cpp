@@ -0,0 +1,71 @@
+#include "nodes/slice.h"
+
+#include <algorithm>
+
+Slice::Slice(deepflow::NodeParam *param) : Node(param)
+{
+	LOG_IF(FATAL, param->has_slice_param() == false) << "param.has_slice_param() == false";
+	auto slice_param = param->slice_param();
+	_dim = slice_param.dim();
+	_begin = slice_param.begin();
+	_size = slice_param.size();
+}
+
+void Slice::init()
+{
+	auto x = _inputs[0]->value();
+	auto dims = x->dims();
+	LOG_IF(FATAL, _dim != 0 && _dim != 1) << _name << " - only the samples (0) and the channels (1) can be sliced.";
+	LOG_IF(FATAL, _begin < 0 || _size < 1 || _begin + _size > dims[_dim]) << _name << " - [" << _begin << ", " << _begin + _size << ") is out of dim " << _dim << " of " << x->shape();
+	dims[_dim] = _size;
+	// The output is a window of the input, contiguous along the samples and strided along the channels
+	// unless there is a single sample.
+	_outputs[0]->initValue(dims, x, _offset(), x->strides());
+	_outputs[0]->initDiff();
+}
+
+size_t Slice::_offset() const
+{
+	auto x = _inputs[0]->value();
+	return x->view_offset() + _begin * x->strides()[_dim];
+}
+
+void Slice::forward()
+{
+	auto x = _inputs[0]->value();
+	_outputs[0]->value()->view(x, _offset(), x->strides());
+}
+
+void Slice::backward()
+{
+	auto dx = _inputs[0]->diff();
+	if (!dx)
+		return;
+	// dx is zero outside the slice, inside it is dy, one row per sample along the channels.
+	auto dims = dx->dims();
+	const size_t plane = (size_t) dims[2] * dims[3] * (_dim == 0 ? dims[1] : 1);
+	const size_t rows = _dim == 0 ? 1 : dims[0];
+	const size_t width = _size * plane;
+	const size_t pitch = _dim == 0 ? width : dims[1] * plane;
+	const size_t offset = _begin * plane;
+	dx->reset();
+	if (is_cpu()) {
+		const float *dy = _outputs[0]->diff()->cpu_data();
+		float *data = dx->cpu_data() + offset;
+		for (size_t row = 0; row < rows; ++row)
+			std::copy(dy + row * width, dy + (row + 1) * width, data + row * pitch);
+	}
+	else {
+		DF_NODE_CUDA_CHECK(cudaMemcpy2D(dx->gpu_data() + offset, pitch * sizeof(float), _outputs[0]->diff()->gpu_data(), width * sizeof(float), width * sizeof(float), rows, cudaMemcpyDeviceToDevice));
+	}
+}
+
+std::string Slice::to_cpp() const
+{
+	std::string cpp = "auto " + _name + " = df.slice(" + _input_name_for_cpp(0) + ", ";
+	cpp += std::to_string(_dim) + ", ";
+	cpp += std::to_string(_begin) + ", ";
+	cpp += std::to_string(_size) + ", ";
+	cpp += "SliceOp(\"" + _name + "\"));";
+	return cpp;
+}
@@ -1,4 +1,5 @@
 #include "nodes/softmax.h"
+#include "core/cpu_softmax.h"
 
 #include <glog/logging.h>
 
@@ -7,21 +8,40 @@ Softmax::Softmax(deepflow::NodeParam *param) : Node(param) {
 }
 
 void Softmax::init() {		
-	DF_NODE_CUDNN_CHECK(cudnnCreate(&_cudnnHandle));	
 	_outputs[0]->initValue(_inputs[0]->value()->dims());
 	_outputs[0]->initDiff();
 	if (_param->softmax_param().mode() == deepflow::SoftmaxParam_Mode_INSTANCE)
 		_mode = CUDNN_SOFTMAX_MODE_INSTANCE;
 	else
 		_mode = CUDNN_SOFTMAX_MODE_CHANNEL;
+	if (!is_cpu())
+		DF_NODE_CUDNN_CHECK(cudnnCreate(&_cudnnHandle));	
+}
+
+void Softmax::_cpu_shape(int *outer, int *channels, int *inner) const {
+	auto dims = _inputs[0]->value()->dims();
+	*outer = dims[0];
+	*channels = _mode == CUDNN_SOFTMAX_MODE_INSTANCE ? dims[1] * dims[2] * dims[3] : dims[1];
+	*inner = _mode == CUDNN_SOFTMAX_MODE_INSTANCE ? 1 : dims[2] * dims[3];
 }
 
 void Softmax::forward() {	
+	if (is_cpu()) {
+		int outer, channels, inner;
+		_cpu_shape(&outer, &channels, &inner);
+		CpuSoftmax::forward(_inputs[0]->value()->cpu_data(), _outputs[0]->value()->cpu_data(), outer, channels, inner, nullptr, math_accuracy());
+		return;
+	}
 	DF_NODE_CUDNN_CHECK(cudnnSoftmaxForward(_cudnnHandle, CUDNN_SOFTMAX_ACCURATE, _mode, &one, _inputs[0]->value()->descriptor(), _inputs[0]->value()->gpu_data(), &zero, _outputs[0]->value()->descriptor(), _outputs[0]->value()->gpu_data()));
 }
 
 void Softmax::backward() {
-	if (_inputs[0]->diff())
+	if (_inputs[0]->diff() && is_cpu()) {
+		int outer, channels, inner;
+		_cpu_shape(&outer, &channels, &inner);
+		CpuSoftmax::backward(_outputs[0]->value()->cpu_data(), _outputs[0]->diff()->cpu_data(), _inputs[0]->diff()->cpu_data(), outer, channels, inner);
+	}
+	else if (_inputs[0]->diff())
 		DF_NODE_CUDNN_CHECK(cudnnSoftmaxBackward(_cudnnHandle, CUDNN_SOFTMAX_ACCURATE, _mode, &one, _outputs[0]->value()->descriptor(), _outputs[0]->value()->gpu_data(), _outputs[0]->diff()->descriptor(), _outputs[0]->diff()->gpu_data(), &zero, _inputs[0]->diff()->descriptor(), _inputs[0]->diff()->gpu_data()));
 }
 
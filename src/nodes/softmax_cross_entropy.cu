@@ -0,0 +1,112 @@
+#include "nodes/softmax_cross_entropy.h"
+#include "core/common_cu.h"
+#include "core/cpu_parallel.h"
+#include "core/cpu_softmax.h"
+
+#include <cfloat>
+
+__global__
+void SoftmaxCrossEntropyKernelForward(const int n, const float scale, const float * __restrict__ p, const float * __restrict__ y, float *loss)
+{
+	int i = blockIdx.x*blockDim.x + threadIdx.x;
+	if (i < n && y[i] != 0)
+		atomicAdd(loss, -scale * y[i] * logf(fmaxf(p[i], FLT_MIN)));
+}
+
+__global__
+void SoftmaxCrossEntropyKernelBackward(const int n, const float alpha, const float * __restrict__ p, const float * __restrict__ y, float * __restrict__ dx)
+{
+	int i = blockIdx.x*blockDim.x + threadIdx.x;
+	if (i < n)
+		dx[i] = alpha * (p[i] - y[i]);
+}
+
+SoftmaxCrossEntropy::SoftmaxCrossEntropy(deepflow::NodeParam *param) : Node(param) {
+	LOG_IF(FATAL, param->has_softmax_cross_entropy_param() == false) << "param.has_softmax_cross_entropy_param() == false";
+}
+
+void SoftmaxCrossEntropy::init() {
+	auto param = _param->softmax_cross_entropy_param();
+	LOG_IF(FATAL, _inputs[0]->value()->size() != _inputs[1]->value()->size()) << "Logits " << _inputs[0]->value()->shape() << " != " << " Labels " << _inputs[1]->value()->shape();
+	auto dims = _inputs[0]->value()->dims();
+	_alpha = param.alpha();
+	_outer = dims[0];
+	if (param.mode() == deepflow::SoftmaxParam_Mode_INSTANCE) {
+		_mode = CUDNN_SOFTMAX_MODE_INSTANCE;
+		_channels = dims[1] * dims[2] * dims[3];
+		_inner = 1;
+	}
+	else {
+		_mode = CUDNN_SOFTMAX_MODE_CHANNEL;
+		_channels = dims[1];
+		_inner = dims[2] * dims[3];
+	}
+	_outputs[0]->initValue({ 1, 1, 1, 1 });
+	_outputs[0]->initDiff();
+	_outputs[1]->initValue(dims);
+	_outputs[1]->initDiff();
+	if (is_cpu())
+		_log_sum.resize(_outer * _inner);
+	else
+		DF_NODE_CUDNN_CHECK(cudnnCreate(&_cudnnHandle));
+}
+
+void SoftmaxCrossEntropy::forward() {
+	const float scale = 1.0f / (_outer * _inner);
+	if (is_cpu()) {
+		const float *x = _inputs[0]->value()->cpu_data();
+		const float *y = _inputs[1]->value()->cpu_data();
+		CpuSoftmax::forward(x, _outputs[1]->value()->cpu_data(), _outer, _channels, _inner, _log_sum.data(), math_accuracy());
+		// log(p) = x - log_sum, no log of a rounded probability.
+		double loss = 0;
+		for (int o = 0; o < _outer; ++o)
+			for (int c = 0; c < _channels; ++c)
+				for (int s = 0; s < _inner; ++s) {
+					const size_t i = ((size_t)o * _channels + c) * _inner + s;
+					if (y[i] != 0)
+						loss -= y[i] * (x[i] - _log_sum[o * _inner + s]);
+				}
+		_outputs[0]->value()->cpu_data()[0] = (float)(loss * scale);
+		return;
+	}
+	auto size = _inputs[0]->value()->size();
+	DF_NODE_CUDNN_CHECK(cudnnSoftmaxForward(_cudnnHandle, CUDNN_SOFTMAX_ACCURATE, _mode, &one, _inputs[0]->value()->descriptor(), _inputs[0]->value()->gpu_data(), &zero, _outputs[1]->value()->descriptor(), _outputs[1]->value()->gpu_data()));
+	DF_NODE_CUDA_CHECK(cudaMemset(_outputs[0]->value()->gpu_data(), 0, _outputs[0]->value()->bytes()));
+	SoftmaxCrossEntropyKernelForward << < numOfBlocks(size), maxThreadsPerBlock >> > (size, scale, _outputs[1]->value()->gpu_data(), _inputs[1]->value()->gpu_data(), _outputs[0]->value()->gpu_data());
+	DF_NODE_KERNEL_CHECK();
+}
+
+void SoftmaxCrossEntropy::backward() {
+	if (!_inputs[0]->diff())
+		return;
+	auto size = _inputs[0]->value()->size();
+	// The loss is averaged over the softmax instances, so is its gradient.
+	const float alpha = _alpha / (_outer * _inner);
+	if (is_cpu()) {
+		const float *p = _outputs[1]->value()->cpu_data();
+		const float *y = _inputs[1]->value()->cpu_data();
+		float *dx = _inputs[0]->diff()->cpu_data();
+		CpuParallel::for_range(size, 16384, [&](size_t begin, size_t end) {
+			for (size_t i = begin; i < end; ++i)
+				dx[i] = alpha * (p[i] - y[i]);
+		});
+		return;
+	}
+	SoftmaxCrossEntropyKernelBackward << < numOfBlocks(size), maxThreadsPerBlock >> > (size, alpha, _outputs[1]->value()->gpu_data(), _inputs[1]->value()->gpu_data(), _inputs[0]->diff()->gpu_data());
+	DF_NODE_KERNEL_CHECK();
+}
+
+std::string SoftmaxCrossEntropy::to_cpp() const
+{
+	auto param = _param->softmax_cross_entropy_param();
+	std::string cpp = "auto " + _name + " = df.softmax_cross_entropy(" + _input_name_for_cpp(0) + ", " + _input_name_for_cpp(1) + ", ";
+	cpp += "SoftmaxCrossEntropyOp(\"" + _name + "\")";
+	cpp += param.mode() == deepflow::SoftmaxParam_Mode_INSTANCE ? ".by_instance()" : ".by_channel()";
+	cpp += ".alpha(" + std::to_string(param.alpha()) + "));";
+	return cpp;
+}
+
+float SoftmaxCrossEntropy::loss() const
+{
+	return _outputs[0]->value()->to_float();
+}
@@ -1,4 +1,5 @@
 #include "nodes/spatial_transformer.h"
+#include "core/cpu_spatial_transformer.h"
 
 SpatialTransformer::SpatialTransformer(deepflow::NodeParam * param) : Node(param)
 {
@@ -14,6 +15,12 @@ void SpatialTransformer::init()
 	LOG_IF(FATAL, thetaDims[0] == 0 || thetaDims[1] != 1 || thetaDims[2] != 2 || thetaDims[3] != 3) << "[FAILED] " << _name << " - theta (second input) dimensions must be Nx1x2x3 but it was " << _inputs[1]->value()->shape();	
 	LOG_IF(FATAL, inputDims[0] != thetaDims[0]) << "[FAILED] " << _name << " - Number of input samples (N) must match for input and theta";
 	LOG_IF(FATAL, gridDims[0] != inputDims[0] || gridDims[3] != 2) << "[FAILED] " << _name << " - Grid (third input) dimension must be NxHxWx2";
+	LOG_IF(FATAL, _inputs[2]->diff() == nullptr) << "[FAILED] " << _name << " - Grid must have a place to store diff memory.";
+	if (is_cpu()) {
+		_outputs[0]->initValue({ outputDims[0], outputDims[1], outputDims[2], outputDims[3] });
+		_outputs[0]->initDiff();
+		return;
+	}
 	DF_NODE_CUDNN_CHECK(
 		cudnnCreate(&_cudnnHandle)
 	);
@@ -23,13 +30,20 @@ void SpatialTransformer::init()
 	DF_NODE_CUDNN_CHECK(
 		cudnnSetSpatialTransformerNdDescriptor(_stDesc, CUDNN_SAMPLER_BILINEAR, CUDNN_DATA_FLOAT, 4, outputDims)
 	);	
-	LOG_IF(FATAL, _inputs[2]->diff() == nullptr) << "[FAILED] " << _name << " - Grid must have a place to store diff memory.";
 	_outputs[0]->initValue({ outputDims[0], outputDims[1], outputDims[2], outputDims[3]});
 	_outputs[0]->initDiff();
 }
 
 void SpatialTransformer::forward()
 {
+	if (is_cpu()) {
+		auto dims = _inputs[0]->dims();
+		auto gridDims = _inputs[2]->dims();
+		float *grid = _inputs[2]->value()->cpu_data();
+		CpuSpatialTransformer::grid_forward(dims[0], gridDims[1], gridDims[2], _inputs[1]->value()->cpu_data(), grid);
+		CpuSpatialTransformer::sampler_forward(dims[0], dims[1], dims[2], dims[3], gridDims[1], gridDims[2], _inputs[0]->value()->cpu_data(), grid, _outputs[0]->value()->cpu_data());
+		return;
+	}
 	DF_NODE_CUDNN_CHECK(
 		cudnnSpatialTfGridGeneratorForward(_cudnnHandle, _stDesc, _inputs[1]->value()->gpu_data(), _inputs[2]->value()->gpu_data())
 	);
@@ -40,18 +54,34 @@ void SpatialTransformer::forward()
 
 void SpatialTransformer::backward()
 {	
-	if (_inputs[0]->diff()) {		
+	// The grid diff is scratch for theta, kept whether or not the grid itself needs a gradient.
+	auto grid_diff = _inputs[2]->connectedTerminal()->diff();
+	if (is_cpu()) {
+		// dgrid is needed by theta too, so the sampler runs whenever either input takes a gradient.
+		if (!_inputs[0]->diff() && !_inputs[1]->diff())
+			return;
+		auto dims = _inputs[0]->dims();
+		auto gridDims = _inputs[2]->dims();
+		float *dgrid = grid_diff->cpu_data();
+		CpuSpatialTransformer::sampler_backward(dims[0], dims[1], dims[2], dims[3], gridDims[1], gridDims[2], _inputs[0]->value()->cpu_data(), _inputs[2]->value()->cpu_data(), _outputs[0]->diff()->cpu_data(), _inputs[0]->diff() ? _inputs[0]->diff()->cpu_data() : nullptr, dgrid);
+		if (_inputs[1]->diff())
+			CpuSpatialTransformer::grid_backward(dims[0], gridDims[1], gridDims[2], dgrid, _inputs[1]->diff()->cpu_data());
+		return;
+	}
+	// cuDNN writes dx with dgrid, to the unread diff of the input's producer when only theta needs it.
+	auto x_diff = _inputs[0]->connectedTerminal()->diff();
+	if ((_inputs[0]->diff() || _inputs[1]->diff()) && x_diff) {
 		DF_NODE_CUDNN_CHECK(
 			cudnnSpatialTfSamplerBackward(_cudnnHandle, _stDesc,
 				&one, _inputs[0]->value()->descriptor(), _inputs[0]->value()->gpu_data(),
-				&zero, _inputs[0]->diff()->descriptor(), _inputs[0]->diff()->gpu_data(),
+				&zero, x_diff->descriptor(), x_diff->gpu_data(),
 				&one, _outputs[0]->diff()->descriptor(), _outputs[0]->diff()->gpu_data(),
-				_inputs[2]->value()->gpu_data(), &zero, _inputs[2]->diff()->gpu_data())
+				_inputs[2]->value()->gpu_data(), &zero, grid_diff->gpu_data())
 		);
 	}
 	if (_inputs[1]->diff()) {
 		DF_NODE_CUDNN_CHECK(
-			cudnnSpatialTfGridGeneratorBackward(_cudnnHandle, _stDesc, _inputs[2]->diff()->gpu_data(), _inputs[1]->diff()->gpu_data())
+			cudnnSpatialTfGridGeneratorBackward(_cudnnHandle, _stDesc, grid_diff->gpu_data(), _inputs[1]->diff()->gpu_data())
 		);
 	}
 }
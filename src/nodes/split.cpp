@@ -35,10 +35,16 @@ void Split::backward()
 {	
 	if (_inputs[0]->diff()) {
 		auto size = _inputs[0]->value()->size();		
+		float alpha = 1.0f / _num_outputs;
+		if (is_cpu()) {
+			memset(_inputs[0]->diff()->cpu_data(), 0, size * sizeof(float));
+			for (int i = 0; i < _num_outputs; ++i)
+				cpy(size, alpha, _outputs[i]->diff()->cpu_data(), 1.0f, _inputs[0]->diff()->cpu_data());
+			return;
+		}
 		DF_NODE_CUDA_CHECK(
 		cudaMemset(_inputs[0]->diff()->gpu_data(), 0, size * sizeof(float))
 		)
-		float alpha = 1.0f / _num_outputs;
 		for (int i = 0; i < _num_outputs; ++i) {
 			cpy(size, alpha, _outputs[i]->diff()->gpu_data(), 1.0f, _inputs[0]->diff()->gpu_data());
 		}
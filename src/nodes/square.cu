@@ -1,5 +1,6 @@
 #include "nodes/square.h"
 #include "core/common_cu.h"
+#include "core/cpu_elementwise.h"
 
 __global__
 void SquareKernelForward(const int n, const float * __restrict__ x, float * __restrict__ x2)
@@ -28,12 +29,19 @@ void Square::init() {
 
 void Square::forward() {	
 	auto size = _inputs[0]->value()->size();
+	if (is_cpu()) {
+		CpuElementwise::square_forward(size, _inputs[0]->value()->cpu_data(), _outputs[0]->value()->cpu_data());
+		return;
+	}
 	SquareKernelForward <<< numOfBlocks(size), maxThreadsPerBlock >>> (size, _inputs[0]->value()->gpu_data(), (float*)_outputs[0]->value()->gpu_data());
 	DF_KERNEL_CHECK();
 }
 
 void Square::backward() {
-	if (_inputs[0]->diff()) {
+	if (_inputs[0]->diff() && is_cpu()) {
+		CpuElementwise::square_backward(_inputs[0]->value()->size(), _inputs[0]->value()->cpu_data(), _outputs[0]->diff()->cpu_data(), _inputs[0]->diff()->cpu_data());
+	}
+	else if (_inputs[0]->diff()) {
 		auto size = _inputs[0]->value()->size();
 		SquareKernelBackward << < numOfBlocks(size), maxThreadsPerBlock >> > (size, _inputs[0]->value()->gpu_data(), _outputs[0]->diff()->gpu_data(), (float*)_inputs[0]->diff()->gpu_data());
 		DF_KERNEL_CHECK();
@@ -37,11 +37,13 @@ void Switch::init()
 
 void Switch::forward()
 {
+	// On, the output is the input served without a copy. Off, it is the own buffer of zeros.
 	if (m_on) {
-		cpy(_inputs[0]->value()->size(), 1.0, _inputs[0]->value()->gpu_data(), 0.0, _outputs[0]->value()->gpu_data());
+		_outputs[0]->value()->shadow(_inputs[0]->value());
 	}
 	else {
-		fill(_outputs[0]->value()->size(), 0.0, _outputs[0]->value()->gpu_data());
+		_outputs[0]->value()->shadow(nullptr);
+		fill(_outputs[0]->value()->size(), 0.0, is_cpu() ? _outputs[0]->value()->cpu_data() : _outputs[0]->value()->gpu_data());
 	}
 }
 
@@ -36,6 +36,13 @@ void TransposedConvolution2D::init() {
 	int output_w = (input_w - 0.5) * v - 2 * pad_w + ((filter_w - 1) * dilation_w) + 1;
 	_outputs[0]->initValue({ output_n, output_c, output_h, output_w });
 	_outputs[0]->initDiff();	
+	if (is_cpu()) {
+		_cpu_shape = { output_n, output_c, output_h, output_w, filter_n, filter_h, filter_w, input_h, input_w, pad_h, pad_w, u, v, dilation_h, dilation_w };
+		int h = CpuConvolution::output_size(output_h, filter_h, pad_h, u, dilation_h);
+		int w = CpuConvolution::output_size(output_w, filter_w, pad_w, v, dilation_w);
+		LOG_IF(FATAL, filter_n != input_c || h != input_h || w != input_w) << _name << " - Input shape must be " << output_n << "*" << filter_n << "*" << h << "*" << w << " but it was " << _inputs[0]->value()->shape();
+		return;
+	}
 	DF_NODE_CUDNN_CHECK(cudnnCreate(&_cudnnHandle));		
 	DF_NODE_CUDNN_CHECK(cudnnCreateFilterDescriptor(&_wDesc));	
 	auto filterValueTensor = _inputs[1]->value();	
@@ -52,15 +59,28 @@ void TransposedConvolution2D::init() {
 	DF_NODE_CUDNN_CHECK(cudnnGetConvolutionBackwardFilterAlgorithm(_cudnnHandle, _outputs[0]->value()->descriptor(), _inputs[0]->value()->descriptor(), _convDesc, _wDesc, CUDNN_CONVOLUTION_BWD_FILTER_PREFER_FASTEST, 0, &_bwdFilterAlgo));
 	DF_NODE_CUDNN_CHECK(cudnnGetConvolutionBackwardFilterWorkspaceSize(_cudnnHandle, _outputs[0]->value()->descriptor(), _inputs[0]->value()->descriptor(), _convDesc, _wDesc, _bwdFilterAlgo, &_bwdFilterWorkspaceSize));
 	_maxWorkspaceSize = std::max({ _fwdWorkspaceSize, _bwdDataWorkspaceSize, _bwdFilterWorkspaceSize });
+	if (d_workspace == 0 && _maxWorkspaceSize != 0) {
+		DF_NODE_CUDA_CHECK(cudaMalloc(&d_workspace, _maxWorkspaceSize));
+		Tensor::add_allocated_by_thread(_maxWorkspaceSize);
+	}
 }
 
 void TransposedConvolution2D::forward() {
-	if (d_workspace == 0 && _maxWorkspaceSize != 0)
-		DF_NODE_CUDA_CHECK(cudaMalloc(&d_workspace, _maxWorkspaceSize));		
+	if (is_cpu()) {
+		CpuConvolution::backward_data(_cpu_shape, _inputs[1]->value()->cpu_data(), _inputs[0]->value()->cpu_data(), _outputs[0]->value()->cpu_data());
+		return;
+	}
 	DF_NODE_CUDNN_CHECK(cudnnConvolutionBackwardData(_cudnnHandle, &one, _wDesc, _inputs[1]->value()->gpu_data(), _inputs[0]->value()->descriptor(), _inputs[0]->value()->gpu_data(), _convDesc, _bwdDataAlgo, d_workspace, _bwdDataWorkspaceSize, &zero, _outputs[0]->value()->descriptor(), _outputs[0]->value()->gpu_data()));
 }
 
 void TransposedConvolution2D::backward() {
+	if (is_cpu()) {
+		if (_inputs[1]->diff())
+			CpuConvolution::backward_filter(_cpu_shape, _outputs[0]->diff()->cpu_data(), _inputs[0]->value()->cpu_data(), _inputs[1]->diff()->cpu_data());
+		if (_inputs[0]->diff())
+			CpuConvolution::forward(_cpu_shape, _outputs[0]->diff()->cpu_data(), _inputs[1]->value()->cpu_data(), _inputs[0]->diff()->cpu_data());
+		return;
+	}
 	if (_inputs[1]->diff())
 		DF_NODE_CUDNN_CHECK(cudnnConvolutionBackwardFilter(_cudnnHandle, &one, _outputs[0]->diff()->descriptor(), _outputs[0]->diff()->gpu_data(), _inputs[0]->value()->descriptor(), _inputs[0]->value()->gpu_data(), _convDesc, _bwdFilterAlgo, d_workspace, _bwdFilterWorkspaceSize, &zero, _wDesc, _inputs[1]->diff()->gpu_data()));
 	if (_inputs[0]->diff())
@@ -2,6 +2,7 @@
 #include "nodes/variable.h"
 #include "core/initializer.h"
 
+#include <algorithm>
 #include <string>
 #include <iostream>
 
@@ -32,52 +33,97 @@ Variable::Variable(std::shared_ptr<Initializer> initializer, deepflow::NodeParam
 void Variable::init() {
 
 	_initializer->init();
+	LOG_IF(FATAL, _mapped_weights && _mapped_weights->dims() != _initializer->dims()) << "Shape of " << _name << " does not match its shared weights.";
+	if (_mapped_weights && is_cpu()) {
+		// Host variables point into the shared mapping, every process reads the same pages.
+		LOG_IF(FATAL, !_param->variable_param().solver_name().empty()) << "Variable " << _name << " is mapped read only and cannot have a solver.";
+		_outputs[0]->initValue(_initializer->dims(), _mapped_weights);
+		_outputs[0]->initDiff();
+		return;
+	}
 	_outputs[0]->initValue(_initializer->dims());	
-	if (_param->variable_param().has_weights()) {		
+	if (_mapped_weights) {
+		LOG_IF(FATAL, _mapped_weights->size() != _outputs[0]->value()->size()) << "Mapped weights of " << _name << " do not match its size.";
+		DF_NODE_CUDA_CHECK(cudaMemcpy(_outputs[0]->value()->gpu_data(), _mapped_weights->cpu_data(), _outputs[0]->value()->bytes(), cudaMemcpyHostToDevice));
+	}
+	else if (_param->variable_param().has_weights()) {		
 		auto weights = _param->variable_param().weights();
 		LOG_IF(FATAL, weights.data_size() != _outputs[0]->value()->size()) << "weights.weight_size() != _outputs[0]->value()->size() in " << _name << " - " << weights.data_size() << " != " << _outputs[0]->value()->size();
-		DF_NODE_CUDA_CHECK(cudaMemcpy(_outputs[0]->value()->gpu_data(), weights.data().data(), _outputs[0]->value()->bytes(), cudaMemcpyHostToDevice));
+		if (is_cpu())
+			memcpy(_outputs[0]->value()->cpu_data(), weights.data().data(), _outputs[0]->value()->bytes());
+		else
+			DF_NODE_CUDA_CHECK(cudaMemcpy(_outputs[0]->value()->gpu_data(), weights.data().data(), _outputs[0]->value()->bytes(), cudaMemcpyHostToDevice));
 	}
 	else if (_initializer->param()->has_init_data()) {		
 		auto weights = _initializer->param()->init_data();
 		LOG_IF(FATAL, weights.data_size() != _outputs[0]->value()->size()) << "weights.weight_size() != _outputs[0]->value()->size() in " << _name << " - " << weights.data_size() << " != " << _outputs[0]->value()->size();
-		DF_NODE_CUDA_CHECK(cudaMemcpy(_outputs[0]->value()->gpu_data(), weights.data().data(), _outputs[0]->value()->bytes(), cudaMemcpyHostToDevice));
+		if (is_cpu())
+			memcpy(_outputs[0]->value()->cpu_data(), weights.data().data(), _outputs[0]->value()->bytes());
+		else
+			DF_NODE_CUDA_CHECK(cudaMemcpy(_outputs[0]->value()->gpu_data(), weights.data().data(), _outputs[0]->value()->bytes(), cudaMemcpyHostToDevice));
 	}
 	else {		
 		_initializer->apply(this);
 		for (int i = 0; i < _outputs[0]->value()->size(); ++i)
 			_param->mutable_variable_param()->mutable_init_param()->mutable_init_data()->add_data(0);
-		DF_NODE_CUDA_CHECK(cudaMemcpy(_param->mutable_variable_param()->mutable_init_param()->mutable_init_data()->mutable_data()->mutable_data(),_outputs[0]->value()->gpu_data(),_outputs[0]->value()->bytes(), cudaMemcpyDeviceToHost));
+		if (is_cpu())
+			memcpy(_param->mutable_variable_param()->mutable_init_param()->mutable_init_data()->mutable_data()->mutable_data(), _outputs[0]->value()->cpu_data(), _outputs[0]->value()->bytes());
+		else
+			DF_NODE_CUDA_CHECK(cudaMemcpy(_param->mutable_variable_param()->mutable_init_param()->mutable_init_data()->mutable_data()->mutable_data(),_outputs[0]->value()->gpu_data(),_outputs[0]->value()->bytes(), cudaMemcpyDeviceToHost));
 	}
 
 	_outputs[0]->initDiff();
-	int size = _outputs[0]->value()->bytes();
-	DF_CUDA_CHECK(cudaMalloc(&_grad, size));
-	DF_CUDA_CHECK(cudaMemset(_grad, 0, size));
-
 }
 
 inline void Variable::forward() {
 	
 }
 
+bool Variable::_accumulates() const
+{
+	return _grad && !(_context && _context->fused_update);
+}
+
 inline void Variable::backward() {
-	if (!_param->variable_param().solver_name().empty()) {
-		LOG_IF(INFO, _verbose > 2) << _name << " + gradients";
-		cpy(_outputs[0]->value()->size(), 1.0, _outputs[0]->diff()->gpu_data(), 1.0, _grad);
+	if (_param->variable_param().solver_name().empty() || (_context && _context->fused_update))
+		return;
+	LOG_IF(INFO, _verbose > 2) << _name << " + gradients";
+	auto size = _outputs[0]->value()->size();
+	if (!_grad && is_cpu()) {
+		_host_grad.assign(size, 0.0f);
+		_grad = _host_grad.data();
 	}
+	else if (!_grad) {
+		DF_CUDA_CHECK(cudaMalloc(&_grad, _outputs[0]->value()->bytes()));
+		DF_CUDA_CHECK(cudaMemset(_grad, 0, _outputs[0]->value()->bytes()));
+	}
+	auto diff = _outputs[0]->diff();
+	cpy(size, 1.0, is_cpu() ? diff->cpu_data() : diff->gpu_data(), 1.0, _grad);
 }
 
 float * Variable::gradients()
 {	
-	return _grad;
+	if (_accumulates())
+		return _grad;
+	auto diff = _outputs[0]->diff();
+	return is_cpu() ? diff->cpu_data() : diff->gpu_data();
 }
 
 void Variable::reset_gradients()
 {	
 	LOG_IF(INFO, _verbose > 3) << _name << " : gradients <- 0";
 	_outputs[0]->resetDiff();
-	DF_CUDA_CHECK(cudaMemset(_grad, 0, _outputs[0]->value()->bytes()));
+	if (_grad && is_cpu())
+		std::fill(_host_grad.begin(), _host_grad.end(), 0.0f);
+	else if (_grad)
+		DF_CUDA_CHECK(cudaMemset(_grad, 0, _outputs[0]->value()->bytes()));
+}
+
+void Variable::gradients_applied()
+{
+	// Without a separate buffer the kernels have zeroed the diff already.
+	if (_accumulates())
+		_outputs[0]->resetDiff();
 }
 
 void Variable::prep_for_saving()
@@ -87,14 +133,31 @@ void Variable::prep_for_saving()
 	auto mutable_weights_data = mutable_weights->mutable_data();
 	mutable_weights_data->Resize(_outputs[0]->value()->size(),0.0f);
 	LOG_IF(FATAL, mutable_weights_data->size() != _outputs[0]->value()->size());
-	DF_NODE_CUDA_CHECK(cudaMemcpy(mutable_weights_data->mutable_data(), _outputs[0]->value()->gpu_data(), _outputs[0]->value()->bytes(), cudaMemcpyDeviceToHost));
+	if (is_cpu())
+		memcpy(mutable_weights_data->mutable_data(), _outputs[0]->value()->cpu_data(), _outputs[0]->value()->bytes());
+	else
+		DF_NODE_CUDA_CHECK(cudaMemcpy(mutable_weights_data->mutable_data(), _outputs[0]->value()->gpu_data(), _outputs[0]->value()->bytes(), cudaMemcpyDeviceToHost));
+}
+
+void Variable::map_weights(std::shared_ptr<Tensor> weights)
+{
+	LOG_IF(FATAL, _initialized) << "Variable " << _name << " is already initialized.";
+	_mapped_weights = weights;
 }
 
 void Variable::clamp(float min, float max)
 {
 	auto size = _outputs[0]->value()->size();
-	VariableClampKernel << < numOfBlocks(size), maxThreadsPerBlock >> > (size, _outputs[0]->value()->gpu_data(), min, max);
-	DF_KERNEL_CHECK();
+	if (is_cpu()) {
+		float *x = _outputs[0]->value()->cpu_data();
+		for (int i = 0; i < size; ++i)
+			x[i] = std::min(std::max(x[i], min), max);
+	}
+	else {
+		VariableClampKernel << < numOfBlocks(size), maxThreadsPerBlock >> > (size, _outputs[0]->value()->gpu_data(), min, max);
+		DF_KERNEL_CHECK();
+	}
+	_outputs[0]->bump_version();
 }
 
 std::string Variable::to_cpp() const
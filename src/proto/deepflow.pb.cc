@@ -68,6 +68,16 @@ class DropoutParamDefaultTypeInternal : public ::google::protobuf::internal::Exp
 } _DropoutParam_default_instance_;
 class MatMulParamDefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<MatMulParam> {
 } _MatMulParam_default_instance_;
+class PointwiseStageDefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<PointwiseStage> {
+} _PointwiseStage_default_instance_;
+class EpilogueParamDefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<EpilogueParam> {
+} _EpilogueParam_default_instance_;
+class FusedElementwiseParamDefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<FusedElementwiseParam> {
+} _FusedElementwiseParam_default_instance_;
+class ReorderParamDefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<ReorderParam> {
+} _ReorderParam_default_instance_;
+class SliceParamDefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<SliceParam> {
+} _SliceParam_default_instance_;
 class LeakyReluParamDefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<LeakyReluParam> {
 } _LeakyReluParam_default_instance_;
 class PReluParamDefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<PReluParam> {
@@ -114,6 +124,8 @@ class SquareErrorParamDefaultTypeInternal : public ::google::protobuf::internal:
 } _SquareErrorParam_default_instance_;
 class SoftmaxParamDefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<SoftmaxParam> {
 } _SoftmaxParam_default_instance_;
+class SoftmaxCrossEntropyParamDefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<SoftmaxCrossEntropyParam> {
+} _SoftmaxCrossEntropyParam_default_instance_;
 class PatchingParamDefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<PatchingParam> {
 } _PatchingParam_default_instance_;
 class LiftingParamDefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<LiftingParam> {
@@ -148,6 +160,10 @@ class RMSPropSolverParamDefaultTypeInternal : public ::google::protobuf::interna
 } _RMSPropSolverParam_default_instance_;
 class SolverParamDefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<SolverParam> {
 } _SolverParam_default_instance_;
+class FrozenParam_OutputDefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<FrozenParam_Output> {
+} _FrozenParam_Output_default_instance_;
+class FrozenParamDefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<FrozenParam> {
+} _FrozenParam_default_instance_;
 class BlockParamDefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<BlockParam> {
 } _BlockParam_default_instance_;
 class ConcateParamDefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<ConcateParam> {
@@ -182,8 +198,8 @@ namespace protobuf_deepflow_2eproto {
 
 namespace {
 
-::google::protobuf::Metadata file_level_metadata[79];
-const ::google::protobuf::EnumDescriptor* file_level_enum_descriptors[15];
+::google::protobuf::Metadata file_level_metadata[87];
+const ::google::protobuf::EnumDescriptor* file_level_enum_descriptors[19];
 
 }  // namespace
 
@@ -277,6 +293,14 @@ PROTOBUF_CONSTEXPR_VAR ::google::protobuf::internal::ParseTable const
   { NULL, NULL, 0, -1, -1, false },
   { NULL, NULL, 0, -1, -1, false },
   { NULL, NULL, 0, -1, -1, false },
+  { NULL, NULL, 0, -1, -1, false },
+  { NULL, NULL, 0, -1, -1, false },
+  { NULL, NULL, 0, -1, -1, false },
+  { NULL, NULL, 0, -1, -1, false },
+  { NULL, NULL, 0, -1, -1, false },
+  { NULL, NULL, 0, -1, -1, false },
+  { NULL, NULL, 0, -1, -1, false },
+  { NULL, NULL, 0, -1, -1, false },
 };
 
 const ::google::protobuf::uint32 TableStruct::offsets[] = {
@@ -420,6 +444,7 @@ const ::google::protobuf::uint32 TableStruct::offsets[] = {
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PoolingParam, v_pad_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PoolingParam, h_stride_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PoolingParam, v_stride_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PoolingParam, mode_),
   ~0u,  // no _has_bits_
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TransposedConv2dParam, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -442,6 +467,7 @@ const ::google::protobuf::uint32 TableStruct::offsets[] = {
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Conv2dParam, v_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Conv2dParam, dilation_h_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Conv2dParam, dilation_w_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Conv2dParam, epilogue_),
   ~0u,  // no _has_bits_
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DropoutParam, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -453,6 +479,40 @@ const ::google::protobuf::uint32 TableStruct::offsets[] = {
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MatMulParam, epilogue_),
+  ~0u,  // no _has_bits_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PointwiseStage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PointwiseStage, op_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PointwiseStage, coef_),
+  ~0u,  // no _has_bits_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(EpilogueParam, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(EpilogueParam, bias_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(EpilogueParam, activation_),
+  ~0u,  // no _has_bits_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FusedElementwiseParam, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FusedElementwiseParam, stage_),
+  ~0u,  // no _has_bits_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReorderParam, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _has_bits_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SliceParam, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SliceParam, dim_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SliceParam, begin_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SliceParam, size_),
   ~0u,  // no _has_bits_
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LeakyReluParam, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -484,6 +544,7 @@ const ::google::protobuf::uint32 TableStruct::offsets[] = {
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReduceParam, reduce_op_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReduceParam, reduce_dim_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReduceParam, output_type_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReduceParam, reduce_dims_),
   ~0u,  // no _has_bits_
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SnapshotParam, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -575,6 +636,8 @@ const ::google::protobuf::uint32 TableStruct::offsets[] = {
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReplayMemoryParam, capacity_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReplayMemoryParam, prioritized_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReplayMemoryParam, alpha_),
   ~0u,  // no _has_bits_
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LrnParam, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -591,6 +654,10 @@ const ::google::protobuf::uint32 TableStruct::offsets[] = {
   ~0u,  // no _weak_field_map_
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ResizeParam, height_scale_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ResizeParam, width_scale_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ResizeParam, mode_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ResizeParam, add_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ResizeParam, alpha_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ResizeParam, beta_),
   ~0u,  // no _has_bits_
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SquareParam, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -613,6 +680,13 @@ const ::google::protobuf::uint32 TableStruct::offsets[] = {
   ~0u,  // no _weak_field_map_
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SoftmaxParam, mode_),
   ~0u,  // no _has_bits_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SoftmaxCrossEntropyParam, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SoftmaxCrossEntropyParam, mode_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SoftmaxCrossEntropyParam, alpha_),
+  ~0u,  // no _has_bits_
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PatchingParam, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
@@ -740,6 +814,24 @@ const ::google::protobuf::uint32 TableStruct::offsets[] = {
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SolverParam, rmsprop_solver_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SolverParam, scope_),
   ~0u,  // no _has_bits_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FrozenParam_Output, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FrozenParam_Output, name_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FrozenParam_Output, dims_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FrozenParam_Output, offset_),
+  ~0u,  // no _has_bits_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FrozenParam, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FrozenParam, output_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FrozenParam, fetch_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FrozenParam, arena_size_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FrozenParam, arena_policy_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FrozenParam, shared_weights_),
+  ~0u,  // no _has_bits_
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BlockParam, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
@@ -747,6 +839,7 @@ const ::google::protobuf::uint32 TableStruct::offsets[] = {
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BlockParam, node_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BlockParam, solver_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BlockParam, initializer_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BlockParam, frozen_param_),
   ~0u,  // no _has_bits_
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ConcateParam, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -833,6 +926,7 @@ const ::google::protobuf::uint32 TableStruct::offsets[] = {
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NodeParam, output_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NodeParam, block_param_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NodeParam, data_policy_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NodeParam, layout_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NodeParam, variable_param_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NodeParam, place_holder_param_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NodeParam, add_param_),
@@ -892,6 +986,10 @@ const ::google::protobuf::uint32 TableStruct::offsets[] = {
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NodeParam, spatial_transformer_param_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NodeParam, nand_param_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NodeParam, gabor_kernel_param_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NodeParam, softmax_cross_entropy_param_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NodeParam, fused_elementwise_param_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NodeParam, reorder_param_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NodeParam, slice_param_),
 };
 
 static const ::google::protobuf::internal::MigrationSchema schemas[] = {
@@ -916,64 +1014,72 @@ static const ::google::protobuf::internal::MigrationSchema schemas[] = {
   { 119, -1, sizeof(BiasAddParam)},
   { 124, -1, sizeof(ExpParam)},
   { 129, -1, sizeof(PoolingParam)},
-  { 140, -1, sizeof(TransposedConv2dParam)},
-  { 151, -1, sizeof(Conv2dParam)},
-  { 162, -1, sizeof(DropoutParam)},
-  { 168, -1, sizeof(MatMulParam)},
-  { 173, -1, sizeof(LeakyReluParam)},
-  { 179, -1, sizeof(PReluParam)},
-  { 184, -1, sizeof(DPReluParam)},
-  { 190, -1, sizeof(ReduceAllParam)},
-  { 196, -1, sizeof(ReduceParam)},
-  { 204, -1, sizeof(SnapshotParam)},
-  { 213, -1, sizeof(PlaceHolderParam)},
-  { 219, -1, sizeof(RestructureParam)},
-  { 226, -1, sizeof(VariableParam)},
-  { 234, -1, sizeof(DataGeneratorParam)},
-  { 240, -1, sizeof(ActivationParam)},
-  { 247, -1, sizeof(ImageBatchReaderParam)},
-  { 256, -1, sizeof(ImageReaderParam)},
-  { 263, -1, sizeof(MnistParam)},
-  { 272, -1, sizeof(InstanceNormalizationParam)},
-  { 278, -1, sizeof(BatchNormalizationParam)},
-  { 289, -1, sizeof(ReplayMemoryParam)},
-  { 295, -1, sizeof(LrnParam)},
-  { 304, -1, sizeof(ResizeParam)},
-  { 311, -1, sizeof(SquareParam)},
-  { 316, -1, sizeof(AbsParam)},
-  { 321, -1, sizeof(SquareErrorParam)},
-  { 326, -1, sizeof(SoftmaxParam)},
-  { 332, -1, sizeof(PatchingParam)},
-  { 340, -1, sizeof(LiftingParam)},
-  { 346, -1, sizeof(InitFillParam)},
-  { 352, -1, sizeof(InitIndexFillParam)},
-  { 358, -1, sizeof(InitGradientFillParam)},
-  { 363, -1, sizeof(InitRandomUniformParam)},
-  { 370, -1, sizeof(InitRandomNormalParam)},
-  { 377, -1, sizeof(InitTruncatedNormalParam)},
-  { 384, -1, sizeof(InitStepParam)},
-  { 391, -1, sizeof(InitThreeStateParam)},
-  { 396, -1, sizeof(InitConstantParam)},
-  { 402, -1, sizeof(InitParam)},
-  { 419, -1, sizeof(SGDSolverParam)},
-  { 425, -1, sizeof(AdaDeltaSolverParam)},
-  { 432, -1, sizeof(AdamSolverParam)},
-  { 440, -1, sizeof(RMSPropSolverParam)},
-  { 447, -1, sizeof(SolverParam)},
-  { 459, -1, sizeof(BlockParam)},
-  { 467, -1, sizeof(ConcateParam)},
-  { 473, -1, sizeof(ReshapeParam)},
-  { 479, -1, sizeof(BatchStdDevParam)},
-  { 484, -1, sizeof(PassThroughParam)},
-  { 490, -1, sizeof(GaussianParam)},
-  { 495, -1, sizeof(GaussianKernelParam)},
-  { 503, -1, sizeof(GaborKernelParam)},
-  { 512, -1, sizeof(PatchSamplingParam)},
-  { 519, -1, sizeof(TextImageGeneratorParam)},
-  { 527, -1, sizeof(MaxParam)},
-  { 532, -1, sizeof(SpatialTransformerParam)},
-  { 537, -1, sizeof(NandParam)},
-  { 542, -1, sizeof(NodeParam)},
+  { 141, -1, sizeof(TransposedConv2dParam)},
+  { 152, -1, sizeof(Conv2dParam)},
+  { 164, -1, sizeof(DropoutParam)},
+  { 170, -1, sizeof(MatMulParam)},
+  { 176, -1, sizeof(PointwiseStage)},
+  { 183, -1, sizeof(EpilogueParam)},
+  { 190, -1, sizeof(FusedElementwiseParam)},
+  { 196, -1, sizeof(ReorderParam)},
+  { 201, -1, sizeof(SliceParam)},
+  { 209, -1, sizeof(LeakyReluParam)},
+  { 215, -1, sizeof(PReluParam)},
+  { 220, -1, sizeof(DPReluParam)},
+  { 226, -1, sizeof(ReduceAllParam)},
+  { 232, -1, sizeof(ReduceParam)},
+  { 241, -1, sizeof(SnapshotParam)},
+  { 250, -1, sizeof(PlaceHolderParam)},
+  { 256, -1, sizeof(RestructureParam)},
+  { 263, -1, sizeof(VariableParam)},
+  { 271, -1, sizeof(DataGeneratorParam)},
+  { 277, -1, sizeof(ActivationParam)},
+  { 284, -1, sizeof(ImageBatchReaderParam)},
+  { 293, -1, sizeof(ImageReaderParam)},
+  { 300, -1, sizeof(MnistParam)},
+  { 309, -1, sizeof(InstanceNormalizationParam)},
+  { 315, -1, sizeof(BatchNormalizationParam)},
+  { 326, -1, sizeof(ReplayMemoryParam)},
+  { 334, -1, sizeof(LrnParam)},
+  { 343, -1, sizeof(ResizeParam)},
+  { 354, -1, sizeof(SquareParam)},
+  { 359, -1, sizeof(AbsParam)},
+  { 364, -1, sizeof(SquareErrorParam)},
+  { 369, -1, sizeof(SoftmaxParam)},
+  { 375, -1, sizeof(SoftmaxCrossEntropyParam)},
+  { 382, -1, sizeof(PatchingParam)},
+  { 390, -1, sizeof(LiftingParam)},
+  { 396, -1, sizeof(InitFillParam)},
+  { 402, -1, sizeof(InitIndexFillParam)},
+  { 408, -1, sizeof(InitGradientFillParam)},
+  { 413, -1, sizeof(InitRandomUniformParam)},
+  { 420, -1, sizeof(InitRandomNormalParam)},
+  { 427, -1, sizeof(InitTruncatedNormalParam)},
+  { 434, -1, sizeof(InitStepParam)},
+  { 441, -1, sizeof(InitThreeStateParam)},
+  { 446, -1, sizeof(InitConstantParam)},
+  { 452, -1, sizeof(InitParam)},
+  { 469, -1, sizeof(SGDSolverParam)},
+  { 475, -1, sizeof(AdaDeltaSolverParam)},
+  { 482, -1, sizeof(AdamSolverParam)},
+  { 490, -1, sizeof(RMSPropSolverParam)},
+  { 497, -1, sizeof(SolverParam)},
+  { 509, -1, sizeof(FrozenParam_Output)},
+  { 517, -1, sizeof(FrozenParam)},
+  { 527, -1, sizeof(BlockParam)},
+  { 536, -1, sizeof(ConcateParam)},
+  { 542, -1, sizeof(ReshapeParam)},
+  { 548, -1, sizeof(BatchStdDevParam)},
+  { 553, -1, sizeof(PassThroughParam)},
+  { 559, -1, sizeof(GaussianParam)},
+  { 564, -1, sizeof(GaussianKernelParam)},
+  { 572, -1, sizeof(GaborKernelParam)},
+  { 581, -1, sizeof(PatchSamplingParam)},
+  { 588, -1, sizeof(TextImageGeneratorParam)},
+  { 596, -1, sizeof(MaxParam)},
+  { 601, -1, sizeof(SpatialTransformerParam)},
+  { 606, -1, sizeof(NandParam)},
+  { 611, -1, sizeof(NodeParam)},
 };
 
 static ::google::protobuf::Message const * const file_default_instances[] = {
@@ -1002,6 +1108,11 @@ static ::google::protobuf::Message const * const file_default_instances[] = {
   reinterpret_cast<const ::google::protobuf::Message*>(&_Conv2dParam_default_instance_),
   reinterpret_cast<const ::google::protobuf::Message*>(&_DropoutParam_default_instance_),
   reinterpret_cast<const ::google::protobuf::Message*>(&_MatMulParam_default_instance_),
+  reinterpret_cast<const ::google::protobuf::Message*>(&_PointwiseStage_default_instance_),
+  reinterpret_cast<const ::google::protobuf::Message*>(&_EpilogueParam_default_instance_),
+  reinterpret_cast<const ::google::protobuf::Message*>(&_FusedElementwiseParam_default_instance_),
+  reinterpret_cast<const ::google::protobuf::Message*>(&_ReorderParam_default_instance_),
+  reinterpret_cast<const ::google::protobuf::Message*>(&_SliceParam_default_instance_),
   reinterpret_cast<const ::google::protobuf::Message*>(&_LeakyReluParam_default_instance_),
   reinterpret_cast<const ::google::protobuf::Message*>(&_PReluParam_default_instance_),
   reinterpret_cast<const ::google::protobuf::Message*>(&_DPReluParam_default_instance_),
@@ -1025,6 +1136,7 @@ static ::google::protobuf::Message const * const file_default_instances[] = {
   reinterpret_cast<const ::google::protobuf::Message*>(&_AbsParam_default_instance_),
   reinterpret_cast<const ::google::protobuf::Message*>(&_SquareErrorParam_default_instance_),
   reinterpret_cast<const ::google::protobuf::Message*>(&_SoftmaxParam_default_instance_),
+  reinterpret_cast<const ::google::protobuf::Message*>(&_SoftmaxCrossEntropyParam_default_instance_),
   reinterpret_cast<const ::google::protobuf::Message*>(&_PatchingParam_default_instance_),
   reinterpret_cast<const ::google::protobuf::Message*>(&_LiftingParam_default_instance_),
   reinterpret_cast<const ::google::protobuf::Message*>(&_InitFillParam_default_instance_),
@@ -1042,6 +1154,8 @@ static ::google::protobuf::Message const * const file_default_instances[] = {
   reinterpret_cast<const ::google::protobuf::Message*>(&_AdamSolverParam_default_instance_),
   reinterpret_cast<const ::google::protobuf::Message*>(&_RMSPropSolverParam_default_instance_),
   reinterpret_cast<const ::google::protobuf::Message*>(&_SolverParam_default_instance_),
+  reinterpret_cast<const ::google::protobuf::Message*>(&_FrozenParam_Output_default_instance_),
+  reinterpret_cast<const ::google::protobuf::Message*>(&_FrozenParam_default_instance_),
   reinterpret_cast<const ::google::protobuf::Message*>(&_BlockParam_default_instance_),
   reinterpret_cast<const ::google::protobuf::Message*>(&_ConcateParam_default_instance_),
   reinterpret_cast<const ::google::protobuf::Message*>(&_ReshapeParam_default_instance_),
@@ -1076,7 +1190,7 @@ void protobuf_AssignDescriptorsOnce() {
 void protobuf_RegisterTypes(const ::std::string&) GOOGLE_ATTRIBUTE_COLD;
 void protobuf_RegisterTypes(const ::std::string&) {
   protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::internal::RegisterAllTypes(file_level_metadata, 79);
+  ::google::protobuf::internal::RegisterAllTypes(file_level_metadata, 87);
 }
 
 }  // namespace
@@ -1132,114 +1246,130 @@ void TableStruct::Shutdown() {
   delete file_level_metadata[23].reflection;
   _MatMulParam_default_instance_.Shutdown();
   delete file_level_metadata[24].reflection;
-  _LeakyReluParam_default_instance_.Shutdown();
+  _PointwiseStage_default_instance_.Shutdown();
   delete file_level_metadata[25].reflection;
-  _PReluParam_default_instance_.Shutdown();
+  _EpilogueParam_default_instance_.Shutdown();
   delete file_level_metadata[26].reflection;
-  _DPReluParam_default_instance_.Shutdown();
+  _FusedElementwiseParam_default_instance_.Shutdown();
   delete file_level_metadata[27].reflection;
-  _ReduceAllParam_default_instance_.Shutdown();
+  _ReorderParam_default_instance_.Shutdown();
   delete file_level_metadata[28].reflection;
-  _ReduceParam_default_instance_.Shutdown();
+  _SliceParam_default_instance_.Shutdown();
   delete file_level_metadata[29].reflection;
-  _SnapshotParam_default_instance_.Shutdown();
+  _LeakyReluParam_default_instance_.Shutdown();
   delete file_level_metadata[30].reflection;
-  _PlaceHolderParam_default_instance_.Shutdown();
+  _PReluParam_default_instance_.Shutdown();
   delete file_level_metadata[31].reflection;
-  _RestructureParam_default_instance_.Shutdown();
+  _DPReluParam_default_instance_.Shutdown();
   delete file_level_metadata[32].reflection;
-  _VariableParam_default_instance_.Shutdown();
+  _ReduceAllParam_default_instance_.Shutdown();
   delete file_level_metadata[33].reflection;
-  _DataGeneratorParam_default_instance_.Shutdown();
+  _ReduceParam_default_instance_.Shutdown();
   delete file_level_metadata[34].reflection;
-  _ActivationParam_default_instance_.Shutdown();
+  _SnapshotParam_default_instance_.Shutdown();
   delete file_level_metadata[35].reflection;
-  _ImageBatchReaderParam_default_instance_.Shutdown();
+  _PlaceHolderParam_default_instance_.Shutdown();
   delete file_level_metadata[36].reflection;
-  _ImageReaderParam_default_instance_.Shutdown();
+  _RestructureParam_default_instance_.Shutdown();
   delete file_level_metadata[37].reflection;
-  _MnistParam_default_instance_.Shutdown();
+  _VariableParam_default_instance_.Shutdown();
   delete file_level_metadata[38].reflection;
-  _InstanceNormalizationParam_default_instance_.Shutdown();
+  _DataGeneratorParam_default_instance_.Shutdown();
   delete file_level_metadata[39].reflection;
-  _BatchNormalizationParam_default_instance_.Shutdown();
+  _ActivationParam_default_instance_.Shutdown();
   delete file_level_metadata[40].reflection;
-  _ReplayMemoryParam_default_instance_.Shutdown();
+  _ImageBatchReaderParam_default_instance_.Shutdown();
   delete file_level_metadata[41].reflection;
-  _LrnParam_default_instance_.Shutdown();
+  _ImageReaderParam_default_instance_.Shutdown();
   delete file_level_metadata[42].reflection;
-  _ResizeParam_default_instance_.Shutdown();
+  _MnistParam_default_instance_.Shutdown();
   delete file_level_metadata[43].reflection;
-  _SquareParam_default_instance_.Shutdown();
+  _InstanceNormalizationParam_default_instance_.Shutdown();
   delete file_level_metadata[44].reflection;
-  _AbsParam_default_instance_.Shutdown();
+  _BatchNormalizationParam_default_instance_.Shutdown();
   delete file_level_metadata[45].reflection;
-  _SquareErrorParam_default_instance_.Shutdown();
+  _ReplayMemoryParam_default_instance_.Shutdown();
   delete file_level_metadata[46].reflection;
-  _SoftmaxParam_default_instance_.Shutdown();
+  _LrnParam_default_instance_.Shutdown();
   delete file_level_metadata[47].reflection;
-  _PatchingParam_default_instance_.Shutdown();
+  _ResizeParam_default_instance_.Shutdown();
   delete file_level_metadata[48].reflection;
-  _LiftingParam_default_instance_.Shutdown();
+  _SquareParam_default_instance_.Shutdown();
   delete file_level_metadata[49].reflection;
-  _InitFillParam_default_instance_.Shutdown();
+  _AbsParam_default_instance_.Shutdown();
   delete file_level_metadata[50].reflection;
-  _InitIndexFillParam_default_instance_.Shutdown();
+  _SquareErrorParam_default_instance_.Shutdown();
   delete file_level_metadata[51].reflection;
-  _InitGradientFillParam_default_instance_.Shutdown();
+  _SoftmaxParam_default_instance_.Shutdown();
   delete file_level_metadata[52].reflection;
-  _InitRandomUniformParam_default_instance_.Shutdown();
+  _SoftmaxCrossEntropyParam_default_instance_.Shutdown();
   delete file_level_metadata[53].reflection;
-  _InitRandomNormalParam_default_instance_.Shutdown();
+  _PatchingParam_default_instance_.Shutdown();
   delete file_level_metadata[54].reflection;
-  _InitTruncatedNormalParam_default_instance_.Shutdown();
+  _LiftingParam_default_instance_.Shutdown();
   delete file_level_metadata[55].reflection;
-  _InitStepParam_default_instance_.Shutdown();
+  _InitFillParam_default_instance_.Shutdown();
   delete file_level_metadata[56].reflection;
-  _InitThreeStateParam_default_instance_.Shutdown();
+  _InitIndexFillParam_default_instance_.Shutdown();
   delete file_level_metadata[57].reflection;
-  _InitConstantParam_default_instance_.Shutdown();
+  _InitGradientFillParam_default_instance_.Shutdown();
   delete file_level_metadata[58].reflection;
-  _InitParam_default_instance_.Shutdown();
+  _InitRandomUniformParam_default_instance_.Shutdown();
   delete file_level_metadata[59].reflection;
-  _SGDSolverParam_default_instance_.Shutdown();
+  _InitRandomNormalParam_default_instance_.Shutdown();
   delete file_level_metadata[60].reflection;
-  _AdaDeltaSolverParam_default_instance_.Shutdown();
+  _InitTruncatedNormalParam_default_instance_.Shutdown();
   delete file_level_metadata[61].reflection;
-  _AdamSolverParam_default_instance_.Shutdown();
+  _InitStepParam_default_instance_.Shutdown();
   delete file_level_metadata[62].reflection;
-  _RMSPropSolverParam_default_instance_.Shutdown();
+  _InitThreeStateParam_default_instance_.Shutdown();
   delete file_level_metadata[63].reflection;
-  _SolverParam_default_instance_.Shutdown();
+  _InitConstantParam_default_instance_.Shutdown();
   delete file_level_metadata[64].reflection;
-  _BlockParam_default_instance_.Shutdown();
+  _InitParam_default_instance_.Shutdown();
   delete file_level_metadata[65].reflection;
-  _ConcateParam_default_instance_.Shutdown();
+  _SGDSolverParam_default_instance_.Shutdown();
   delete file_level_metadata[66].reflection;
-  _ReshapeParam_default_instance_.Shutdown();
+  _AdaDeltaSolverParam_default_instance_.Shutdown();
   delete file_level_metadata[67].reflection;
-  _BatchStdDevParam_default_instance_.Shutdown();
+  _AdamSolverParam_default_instance_.Shutdown();
   delete file_level_metadata[68].reflection;
-  _PassThroughParam_default_instance_.Shutdown();
+  _RMSPropSolverParam_default_instance_.Shutdown();
   delete file_level_metadata[69].reflection;
-  _GaussianParam_default_instance_.Shutdown();
+  _SolverParam_default_instance_.Shutdown();
   delete file_level_metadata[70].reflection;
-  _GaussianKernelParam_default_instance_.Shutdown();
+  _FrozenParam_Output_default_instance_.Shutdown();
   delete file_level_metadata[71].reflection;
-  _GaborKernelParam_default_instance_.Shutdown();
+  _FrozenParam_default_instance_.Shutdown();
   delete file_level_metadata[72].reflection;
-  _PatchSamplingParam_default_instance_.Shutdown();
+  _BlockParam_default_instance_.Shutdown();
   delete file_level_metadata[73].reflection;
-  _TextImageGeneratorParam_default_instance_.Shutdown();
+  _ConcateParam_default_instance_.Shutdown();
   delete file_level_metadata[74].reflection;
-  _MaxParam_default_instance_.Shutdown();
+  _ReshapeParam_default_instance_.Shutdown();
   delete file_level_metadata[75].reflection;
-  _SpatialTransformerParam_default_instance_.Shutdown();
+  _BatchStdDevParam_default_instance_.Shutdown();
   delete file_level_metadata[76].reflection;
-  _NandParam_default_instance_.Shutdown();
+  _PassThroughParam_default_instance_.Shutdown();
   delete file_level_metadata[77].reflection;
-  _NodeParam_default_instance_.Shutdown();
+  _GaussianParam_default_instance_.Shutdown();
   delete file_level_metadata[78].reflection;
+  _GaussianKernelParam_default_instance_.Shutdown();
+  delete file_level_metadata[79].reflection;
+  _GaborKernelParam_default_instance_.Shutdown();
+  delete file_level_metadata[80].reflection;
+  _PatchSamplingParam_default_instance_.Shutdown();
+  delete file_level_metadata[81].reflection;
+  _TextImageGeneratorParam_default_instance_.Shutdown();
+  delete file_level_metadata[82].reflection;
+  _MaxParam_default_instance_.Shutdown();
+  delete file_level_metadata[83].reflection;
+  _SpatialTransformerParam_default_instance_.Shutdown();
+  delete file_level_metadata[84].reflection;
+  _NandParam_default_instance_.Shutdown();
+  delete file_level_metadata[85].reflection;
+  _NodeParam_default_instance_.Shutdown();
+  delete file_level_metadata[86].reflection;
 }
 
 void TableStruct::InitDefaultsImpl() {
@@ -1271,6 +1401,11 @@ void TableStruct::InitDefaultsImpl() {
   _Conv2dParam_default_instance_.DefaultConstruct();
   _DropoutParam_default_instance_.DefaultConstruct();
   _MatMulParam_default_instance_.DefaultConstruct();
+  _PointwiseStage_default_instance_.DefaultConstruct();
+  _EpilogueParam_default_instance_.DefaultConstruct();
+  _FusedElementwiseParam_default_instance_.DefaultConstruct();
+  _ReorderParam_default_instance_.DefaultConstruct();
+  _SliceParam_default_instance_.DefaultConstruct();
   _LeakyReluParam_default_instance_.DefaultConstruct();
   _PReluParam_default_instance_.DefaultConstruct();
   _DPReluParam_default_instance_.DefaultConstruct();
@@ -1294,6 +1429,7 @@ void TableStruct::InitDefaultsImpl() {
   _AbsParam_default_instance_.DefaultConstruct();
   _SquareErrorParam_default_instance_.DefaultConstruct();
   _SoftmaxParam_default_instance_.DefaultConstruct();
+  _SoftmaxCrossEntropyParam_default_instance_.DefaultConstruct();
   _PatchingParam_default_instance_.DefaultConstruct();
   _LiftingParam_default_instance_.DefaultConstruct();
   _InitFillParam_default_instance_.DefaultConstruct();
@@ -1311,6 +1447,8 @@ void TableStruct::InitDefaultsImpl() {
   _AdamSolverParam_default_instance_.DefaultConstruct();
   _RMSPropSolverParam_default_instance_.DefaultConstruct();
   _SolverParam_default_instance_.DefaultConstruct();
+  _FrozenParam_Output_default_instance_.DefaultConstruct();
+  _FrozenParam_default_instance_.DefaultConstruct();
   _BlockParam_default_instance_.DefaultConstruct();
   _ConcateParam_default_instance_.DefaultConstruct();
   _ReshapeParam_default_instance_.DefaultConstruct();
@@ -1325,6 +1463,12 @@ void TableStruct::InitDefaultsImpl() {
   _SpatialTransformerParam_default_instance_.DefaultConstruct();
   _NandParam_default_instance_.DefaultConstruct();
   _NodeParam_default_instance_.DefaultConstruct();
+  _Conv2dParam_default_instance_.get_mutable()->epilogue_ = const_cast< ::deepflow::EpilogueParam*>(
+      ::deepflow::EpilogueParam::internal_default_instance());
+  _MatMulParam_default_instance_.get_mutable()->epilogue_ = const_cast< ::deepflow::EpilogueParam*>(
+      ::deepflow::EpilogueParam::internal_default_instance());
+  _EpilogueParam_default_instance_.get_mutable()->activation_ = const_cast< ::deepflow::PointwiseStage*>(
+      ::deepflow::PointwiseStage::internal_default_instance());
   _PlaceHolderParam_default_instance_.get_mutable()->tensor_param_ = const_cast< ::deepflow::TensorParam*>(
       ::deepflow::TensorParam::internal_default_instance());
   _VariableParam_default_instance_.get_mutable()->init_param_ = const_cast< ::deepflow::InitParam*>(
@@ -1367,6 +1511,8 @@ void TableStruct::InitDefaultsImpl() {
       ::deepflow::AdaDeltaSolverParam::internal_default_instance());
   _SolverParam_default_instance_.get_mutable()->rmsprop_solver_ = const_cast< ::deepflow::RMSPropSolverParam*>(
       ::deepflow::RMSPropSolverParam::internal_default_instance());
+  _BlockParam_default_instance_.get_mutable()->frozen_param_ = const_cast< ::deepflow::FrozenParam*>(
+      ::deepflow::FrozenParam::internal_default_instance());
   _TextImageGeneratorParam_default_instance_.get_mutable()->init_param_ = const_cast< ::deepflow::InitParam*>(
       ::deepflow::InitParam::internal_default_instance());
   _NodeParam_default_instance_.get_mutable()->block_param_ = const_cast< ::deepflow::BlockParam*>(
@@ -1489,6 +1635,14 @@ void TableStruct::InitDefaultsImpl() {
       ::deepflow::NandParam::internal_default_instance());
   _NodeParam_default_instance_.get_mutable()->gabor_kernel_param_ = const_cast< ::deepflow::GaborKernelParam*>(
       ::deepflow::GaborKernelParam::internal_default_instance());
+  _NodeParam_default_instance_.get_mutable()->softmax_cross_entropy_param_ = const_cast< ::deepflow::SoftmaxCrossEntropyParam*>(
+      ::deepflow::SoftmaxCrossEntropyParam::internal_default_instance());
+  _NodeParam_default_instance_.get_mutable()->fused_elementwise_param_ = const_cast< ::deepflow::FusedElementwiseParam*>(
+      ::deepflow::FusedElementwiseParam::internal_default_instance());
+  _NodeParam_default_instance_.get_mutable()->reorder_param_ = const_cast< ::deepflow::ReorderParam*>(
+      ::deepflow::ReorderParam::internal_default_instance());
+  _NodeParam_default_instance_.get_mutable()->slice_param_ = const_cast< ::deepflow::SliceParam*>(
+      ::deepflow::SliceParam::internal_default_instance());
 }
 
 void InitDefaults() {
@@ -1527,221 +1681,259 @@ void AddDescriptorsImpl() {
       "\n\003MAX\020\003\022\010\n\004AMAX\020\004\022\007\n\003AVG\020\005\022\t\n\005NORM1\020\006\022\t\n"
       "\005NORM2\020\007\"!\n\nSplitParam\022\023\n\013num_outputs\030\001 "
       "\001(\005\"\014\n\nEqualParam\"\016\n\014BiasAddParam\"\n\n\010Exp"
-      "Param\"t\n\014PoolingParam\022\020\n\010window_h\030\001 \001(\005\022"
-      "\020\n\010window_w\030\002 \001(\005\022\r\n\005h_pad\030\003 \001(\005\022\r\n\005v_pa"
-      "d\030\004 \001(\005\022\020\n\010h_stride\030\005 \001(\005\022\020\n\010v_stride\030\006 "
-      "\001(\005\"s\n\025TransposedConv2dParam\022\r\n\005pad_h\030\001 "
-      "\001(\005\022\r\n\005pad_w\030\002 \001(\005\022\t\n\001u\030\003 \001(\005\022\t\n\001v\030\004 \001(\005"
-      "\022\022\n\ndilation_h\030\005 \001(\005\022\022\n\ndilation_w\030\006 \001(\005"
-      "\"i\n\013Conv2dParam\022\r\n\005pad_h\030\001 \001(\005\022\r\n\005pad_w\030"
-      "\002 \001(\005\022\t\n\001u\030\003 \001(\005\022\t\n\001v\030\004 \001(\005\022\022\n\ndilation_"
-      "h\030\005 \001(\005\022\022\n\ndilation_w\030\006 \001(\005\"\037\n\014DropoutPa"
-      "ram\022\017\n\007dropout\030\001 \001(\002\"\r\n\013MatMulParam\"(\n\016L"
-      "eakyReluParam\022\026\n\016negative_slope\030\001 \001(\002\"\014\n"
-      "\nPReluParam\"%\n\013DPReluParam\022\026\n\016negative_s"
-      "lope\030\001 \001(\002\"j\n\016ReduceAllParam\0227\n\treduce_o"
-      "p\030\001 \001(\0162$.deepflow.ReduceAllParam.Reduce"
-      "AllOp\"\037\n\013ReduceAllOp\022\007\n\003SUM\020\000\022\007\n\003AVG\020\001\"\213"
-      "\002\n\013ReduceParam\0221\n\treduce_op\030\001 \001(\0162\036.deep"
-      "flow.ReduceParam.ReduceOp\022\022\n\nreduce_dim\030"
-      "\002 \001(\005\0225\n\013output_type\030\003 \001(\0162 .deepflow.Re"
-      "duceParam.OutputType\"W\n\010ReduceOp\022\007\n\003ADD\020"
-      "\000\022\007\n\003MUL\020\001\022\007\n\003MIN\020\002\022\007\n\003MAX\020\003\022\010\n\004AMAX\020\004\022\007"
-      "\n\003AVG\020\005\022\t\n\005NORM1\020\006\022\t\n\005NORM2\020\007\"%\n\nOutputT"
-      "ype\022\n\n\006VALUES\020\000\022\013\n\007INDICES\020\001\"v\n\rSnapshot"
-      "Param\022\031\n\021snapshot_interval\030\001 \001(\005\022\027\n\017snap"
-      "shot_prefix\030\002 \001(\t\022\030\n\020per_image_height\030\003 "
-      "\001(\005\022\027\n\017per_image_width\030\004 \001(\005\"\?\n\020PlaceHol"
-      "derParam\022+\n\014tensor_param\030\001 \001(\0132\025.deepflo"
-      "w.TensorParam\"9\n\020RestructureParam\022\021\n\tfir"
-      "st_dim\030\001 \001(\005\022\022\n\nsecond_dim\030\002 \001(\005\"t\n\rVari"
-      "ableParam\022\'\n\ninit_param\030\001 \001(\0132\023.deepflow"
-      ".InitParam\022\023\n\013solver_name\030\002 \001(\t\022%\n\007weigh"
-      "ts\030\003 \001(\0132\024.deepflow.TensorData\"\"\n\022DataGe"
-      "neratorParam\022\014\n\004freq\030\001 \001(\005\"\347\001\n\017Activatio"
-      "nParam\022,\n\004type\030\001 \001(\0162\036.deepflow.Activati"
-      "onParam.Type\022\014\n\004coef\030\002 \001(\002\"\227\001\n\004Type\022\034\n\030C"
-      "UDNN_ACTIVATION_SIGMOID\020\000\022\031\n\025CUDNN_ACTIV"
-      "ATION_RELU\020\001\022\031\n\025CUDNN_ACTIVATION_TANH\020\002\022"
-      "!\n\035CUDNN_ACTIVATION_CLIPPED_RELU\020\003\022\030\n\024CU"
-      "DNN_ACTIVATION_ELU\020\004\"\205\001\n\025ImageBatchReade"
-      "rParam\022\023\n\013folder_path\030\001 \001(\t\022+\n\014tensor_pa"
-      "ram\030\002 \001(\0132\025.deepflow.TensorParam\022\021\n\trand"
-      "omize\030\003 \001(\010\022\027\n\017between_0_and_1\030\004 \001(\010\"\203\001\n"
-      "\020ImageReaderParam\022\021\n\tfile_name\030\001 \001(\t\022-\n\004"
-      "type\030\002 \001(\0162\037.deepflow.ImageReaderParam.T"
-      "ype\"-\n\004Type\022\r\n\tGRAY_ONLY\020\000\022\026\n\022COLOR_IF_A"
-      "VAILABLE\020\001\"\350\001\n\nMnistParam\022\023\n\013folder_path"
-      "\030\001 \001(\t\0224\n\013reader_type\030\002 \001(\0162\037.deepflow.M"
-      "nistParam.ReaderType\0224\n\013output_type\030\003 \001("
-      "\0162\037.deepflow.MnistParam.OutputType\022\022\n\nba"
-      "tch_size\030\004 \001(\005\"!\n\nReaderType\022\t\n\005TRAIN\020\000\022"
-      "\010\n\004TEST\020\001\"\"\n\nOutputType\022\010\n\004DATA\020\000\022\n\n\006LAB"
-      "ELS\020\001\")\n\032InstanceNormalizationParam\022\013\n\003e"
-      "ps\030\001 \001(\002\"\233\002\n\027BatchNormalizationParam\0224\n\004"
-      "mode\030\001 \001(\0162&.deepflow.BatchNormalization"
-      "Param.Mode\022\025\n\rcache_meanvar\030\002 \001(\010\022\"\n\004mea"
-      "n\030\003 \001(\0132\024.deepflow.TensorData\022!\n\003var\030\004 \001"
-      "(\0132\024.deepflow.TensorData\022\026\n\016exp_avg_fact"
-      "or\030\005 \001(\002\022\013\n\003eps\030\006 \001(\002\"G\n\004Mode\022\"\n\036CUDNN_B"
-      "ATCHNORM_PER_ACTIVATION\020\000\022\033\n\027CUDNN_BATCH"
-      "NORM_SPATIAL\020\001\"%\n\021ReplayMemoryParam\022\020\n\010c"
-      "apacity\030\001 \001(\005\"=\n\010LrnParam\022\t\n\001n\030\001 \001(\005\022\r\n\005"
-      "alpha\030\002 \001(\002\022\014\n\004beta\030\003 \001(\002\022\t\n\001k\030\004 \001(\002\"8\n\013"
-      "ResizeParam\022\024\n\014height_scale\030\001 \001(\002\022\023\n\013wid"
-      "th_scale\030\002 \001(\002\"\r\n\013SquareParam\"\n\n\010AbsPara"
-      "m\"\022\n\020SquareErrorParam\"\\\n\014SoftmaxParam\022)\n"
-      "\004mode\030\001 \001(\0162\033.deepflow.SoftmaxParam.Mode"
-      "\"!\n\004Mode\022\014\n\010INSTANCE\020\000\022\013\n\007CHANNEL\020\001\"\277\001\n\r"
-      "PatchingParam\022*\n\004mode\030\001 \001(\0162\034.deepflow.P"
-      "atchingParam.Mode\022\032\n\022num_vertical_patch\030"
-      "\002 \001(\005\022\034\n\024num_horizontal_patch\030\003 \001(\005\"H\n\004M"
-      "ode\022\r\n\tUPSAMPLES\020\000\022\017\n\013DOWNSAMPLES\020\001\022\016\n\nU"
-      "PCHANNELS\020\002\022\020\n\014DOWNCHANNELS\020\003\"\177\n\014Lifting"
-      "Param\022)\n\004mode\030\001 \001(\0162\033.deepflow.LiftingPa"
-      "ram.Mode\"D\n\004Mode\022\016\n\nUP_REGULAR\020\000\022\020\n\014DOWN"
-      "_REGULAR\020\001\022\013\n\007UP_FLIP\020\002\022\r\n\tDOWN_FLIP\020\003\"\036"
-      "\n\rInitFillParam\022\r\n\005value\030\001 \001(\002\"$\n\022InitIn"
-      "dexFillParam\022\016\n\006offset\030\001 \001(\002\"\027\n\025InitGrad"
-      "ientFillParam\"2\n\026InitRandomUniformParam\022"
-      "\013\n\003min\030\001 \001(\002\022\013\n\003max\030\002 \001(\002\"5\n\025InitRandomN"
-      "ormalParam\022\014\n\004mean\030\001 \001(\002\022\016\n\006stddev\030\002 \001(\002"
-      "\"8\n\030InitTruncatedNormalParam\022\014\n\004mean\030\001 \001"
-      "(\002\022\016\n\006stddev\030\002 \001(\002\")\n\rInitStepParam\022\013\n\003m"
-      "in\030\001 \001(\002\022\013\n\003max\030\002 \001(\002\"\025\n\023InitThreeStateP"
-      "aram\"#\n\021InitConstantParam\022\016\n\006values\030\001 \003("
-      "\002\"\360\004\n\tInitParam\022\014\n\004name\030\001 \001(\t\022+\n\014tensor_"
-      "param\030\002 \001(\0132\025.deepflow.TensorParam\022\'\n\tin"
-      "it_data\030\003 \001(\0132\024.deepflow.TensorData\022+\n\nf"
-      "ill_param\030\004 \001(\0132\027.deepflow.InitFillParam"
-      "\0226\n\020index_fill_param\030\005 \001(\0132\034.deepflow.In"
-      "itIndexFillParam\022>\n\024random_uniform_param"
-      "\030\006 \001(\0132 .deepflow.InitRandomUniformParam"
-      "\022+\n\nstep_param\030\007 \001(\0132\027.deepflow.InitStep"
-      "Param\022<\n\023random_normal_param\030\010 \001(\0132\037.dee"
-      "pflow.InitRandomNormalParam\0228\n\021three_sta"
-      "te_param\030\t \001(\0132\035.deepflow.InitThreeState"
-      "Param\022B\n\026truncated_normal_param\030\n \001(\0132\"."
-      "deepflow.InitTruncatedNormalParam\022<\n\023gra"
-      "dient_fill_param\030\013 \001(\0132\037.deepflow.InitGr"
-      "adientFillParam\0223\n\016constant_param\030\014 \001(\0132"
-      "\033.deepflow.InitConstantParam\"\"\n\016SGDSolve"
-      "rParam\022\020\n\010momentum\030\002 \001(\002\"6\n\023AdaDeltaSolv"
-      "erParam\022\020\n\010momentum\030\002 \001(\002\022\r\n\005delta\030\003 \001(\002"
-      "\"<\n\017AdamSolverParam\022\r\n\005beta1\030\002 \001(\002\022\r\n\005be"
-      "ta2\030\003 \001(\002\022\013\n\003eps\030\004 \001(\002\"4\n\022RMSPropSolverP"
-      "aram\022\021\n\trms_decay\030\001 \001(\002\022\013\n\003eps\030\002 \001(\002\"\215\002\n"
-      "\013SolverParam\022\014\n\004name\030\001 \001(\t\022\025\n\rlearning_r"
-      "ate\030\002 \001(\002\022,\n\nsgd_solver\030\003 \001(\0132\030.deepflow"
-      ".SGDSolverParam\022.\n\013adam_solver\030\005 \001(\0132\031.d"
-      "eepflow.AdamSolverParam\0226\n\017adadelta_solv"
-      "er\030\006 \001(\0132\035.deepflow.AdaDeltaSolverParam\022"
-      "4\n\016rmsprop_solver\030\007 \001(\0132\034.deepflow.RMSPr"
-      "opSolverParam\022\r\n\005scope\030\010 \001(\t\"\200\001\n\nBlockPa"
-      "ram\022!\n\004node\030\001 \003(\0132\023.deepflow.NodeParam\022%"
-      "\n\006solver\030\002 \003(\0132\025.deepflow.SolverParam\022(\n"
-      "\013initializer\030\004 \003(\0132\023.deepflow.InitParam\""
-      "\"\n\014ConcateParam\022\022\n\nnum_inputs\030\001 \001(\005\"#\n\014R"
-      "eshapeParam\022\023\n\013output_dims\030\001 \003(\005\"\022\n\020Batc"
-      "hStdDevParam\"*\n\020PassThroughParam\022\026\n\016stop"
-      "_gradients\030\001 \001(\010\"\017\n\rGaussianParam\"O\n\023Gau"
-      "ssianKernelParam\022\023\n\013window_size\030\001 \001(\005\022\r\n"
-      "\005sigma\030\002 \001(\002\022\024\n\014num_channels\030\003 \001(\005\"Z\n\020Ga"
-      "borKernelParam\022\024\n\014orientations\030\001 \003(\002\022\016\n\006"
-      "scales\030\002 \003(\002\022\013\n\003phi\030\003 \001(\002\022\023\n\013apply_scale"
-      "\030\004 \001(\010\"\?\n\022PatchSamplingParam\022\024\n\014patch_he"
-      "ight\030\001 \001(\005\022\023\n\013patch_width\030\002 \001(\005\"`\n\027TextI"
-      "mageGeneratorParam\022\'\n\ninit_param\030\001 \001(\0132\023"
-      ".deepflow.InitParam\022\r\n\005chars\030\002 \001(\t\022\r\n\005wo"
-      "rds\030\003 \003(\t\"\n\n\010MaxParam\"\031\n\027SpatialTransfor"
-      "merParam\"\013\n\tNandParam\"\311\031\n\tNodeParam\022\014\n\004n"
-      "ame\030\001 \001(\t\022\r\n\005scope\030\002 \001(\t\022\r\n\005input\030\003 \003(\t\022"
-      "\016\n\006output\030\004 \003(\t\022)\n\013block_param\030\005 \001(\0132\024.d"
-      "eepflow.BlockParam\0223\n\013data_policy\030\006 \001(\0162"
-      "\036.deepflow.NodeParam.DataPolicy\022/\n\016varia"
-      "ble_param\030d \001(\0132\027.deepflow.VariableParam"
-      "\0226\n\022place_holder_param\030e \001(\0132\032.deepflow."
-      "PlaceHolderParam\022%\n\tadd_param\030g \001(\0132\022.de"
-      "epflow.AddParam\022.\n\016bias_add_param\030h \001(\0132"
-      "\026.deepflow.BiasAddParam\022,\n\rconv_2d_param"
-      "\030i \001(\0132\025.deepflow.Conv2dParam\022A\n\030transpo"
-      "sed_conv_2d_param\030j \001(\0132\037.deepflow.Trans"
-      "posedConv2dParam\022-\n\rdropout_param\030k \001(\0132"
-      "\026.deepflow.DropoutParam\0222\n\020leaky_relu_pa"
-      "ram\030l \001(\0132\030.deepflow.LeakyReluParam\022-\n\rs"
-      "oftmax_param\030m \001(\0132\026.deepflow.SoftmaxPar"
-      "am\022+\n\014square_param\030n \001(\0132\025.deepflow.Squa"
-      "reParam\022+\n\014matmul_param\030o \001(\0132\025.deepflow"
-      ".MatMulParam\022-\n\rpooling_param\030p \001(\0132\026.de"
-      "epflow.PoolingParam\022+\n\014reduce_param\030q \001("
-      "\0132\025.deepflow.ReduceParam\022)\n\013equal_param\030"
-      "r \001(\0132\024.deepflow.EqualParam\022)\n\013print_par"
-      "am\030s \001(\0132\024.deepflow.PrintParam\0225\n\021accumu"
-      "lator_param\030u \001(\0132\032.deepflow.Accumulator"
-      "Param\022-\n\rdisplay_param\030v \001(\0132\026.deepflow."
-      "DisplayParam\0223\n\020activation_param\030w \001(\0132\031"
-      ".deepflow.ActivationParam\022\'\n\npsnr_param\030"
-      "x \001(\0132\023.deepflow.PsnrParam\022<\n\025random_sel"
-      "ector_param\030y \001(\0132\035.deepflow.RandomSelec"
-      "torParam\022+\n\014logger_param\030z \001(\0132\025.deepflo"
-      "w.LoggerParam\0225\n\021restructure_param\030{ \001(\013"
-      "2\032.deepflow.RestructureParam\0226\n\022image_re"
-      "ader_param\030| \001(\0132\032.deepflow.ImageReaderP"
-      "aram\0225\n\021multiplexer_param\030} \001(\0132\032.deepfl"
-      "ow.MultiplexerParam\022D\n\031batch_normalizati"
-      "on_param\030\177 \001(\0132!.deepflow.BatchNormaliza"
-      "tionParam\022*\n\013mnist_param\030\200\001 \001(\0132\024.deepfl"
-      "ow.MnistParam\022;\n\024data_generator_param\030\201\001"
-      " \001(\0132\034.deepflow.DataGeneratorParam\022B\n\030im"
-      "age_batch_reader_param\030\202\001 \001(\0132\037.deepflow"
-      ".ImageBatchReaderParam\022&\n\tdot_param\030\203\001 \001"
-      "(\0132\022.deepflow.DotParam\0229\n\023replay_memory_"
-      "param\030\204\001 \001(\0132\033.deepflow.ReplayMemoryPara"
-      "m\0227\n\022square_error_param\030\206\001 \001(\0132\032.deepflo"
-      "w.SquareErrorParam\0223\n\020sio_output_param\030\207"
-      "\001 \001(\0132\030.deepflow.SIOOutputParam\022&\n\tlog_p"
-      "aram\030\210\001 \001(\0132\022.deepflow.LogParam\022(\n\nloss_"
-      "param\030\211\001 \001(\0132\023.deepflow.LossParam\022&\n\texp"
-      "_param\030\212\001 \001(\0132\022.deepflow.ExpParam\022.\n\rlif"
-      "ting_param\030\213\001 \001(\0132\026.deepflow.LiftingPara"
-      "m\0220\n\016patching_param\030\214\001 \001(\0132\027.deepflow.Pa"
-      "tchingParam\022&\n\tabs_param\030\215\001 \001(\0132\022.deepfl"
-      "ow.AbsParam\0223\n\020reduce_all_param\030\216\001 \001(\0132\030"
-      ".deepflow.ReduceAllParam\0227\n\022image_writer"
-      "_param\030\220\001 \001(\0132\032.deepflow.ImageWriterPara"
-      "m\022,\n\014resize_param\030\221\001 \001(\0132\025.deepflow.Resi"
-      "zeParam\022*\n\013split_param\030\222\001 \001(\0132\024.deepflow"
-      ".SplitParam\022,\n\014switch_param\030\223\001 \001(\0132\025.dee"
-      "pflow.SwitchParam\022&\n\tlrn_param\030\224\001 \001(\0132\022."
-      "deepflow.LrnParam\022*\n\013prelu_param\030\225\001 \001(\0132"
-      "\024.deepflow.PReluParam\022.\n\rconcate_param\030\226"
-      "\001 \001(\0132\026.deepflow.ConcateParam\022.\n\rreshape"
-      "_param\030\227\001 \001(\0132\026.deepflow.ReshapeParam\022,\n"
-      "\014dprelu_param\030\230\001 \001(\0132\025.deepflow.DPReluPa"
-      "ram\0227\n\022batch_stddev_param\030\231\001 \001(\0132\032.deepf"
-      "low.BatchStdDevParam\0227\n\022pass_through_par"
-      "am\030\232\001 \001(\0132\032.deepflow.PassThroughParam\0220\n"
-      "\016gaussian_param\030\233\001 \001(\0132\027.deepflow.Gaussi"
-      "anParam\022=\n\025gaussian_kernel_param\030\234\001 \001(\0132"
-      "\035.deepflow.GaussianKernelParam\022;\n\024patch_"
-      "sampling_param\030\235\001 \001(\0132\034.deepflow.PatchSa"
-      "mplingParam\022F\n\032text_image_generator_para"
-      "m\030\236\001 \001(\0132!.deepflow.TextImageGeneratorPa"
-      "ram\022&\n\tmax_param\030\237\001 \001(\0132\022.deepflow.MaxPa"
-      "ram\022E\n\026instance_normalization\030\240\001 \001(\0132$.d"
-      "eepflow.InstanceNormalizationParam\022E\n\031sp"
-      "atial_transformer_param\030\241\001 \001(\0132!.deepflo"
-      "w.SpatialTransformerParam\022(\n\nnand_param\030"
-      "\242\001 \001(\0132\023.deepflow.NandParam\0227\n\022gabor_ker"
-      "nel_param\030\243\001 \001(\0132\032.deepflow.GaborKernelP"
-      "aram\"[\n\nDataPolicy\022\023\n\017GPU_ONLY_POLICY\020\000\022"
-      "\037\n\033GPU_WITH_CPU_OFFLOAD_POLICY\020\001\022\027\n\023CUDA"
-      "_MANAGED_POLICY\020\002*9\n\nActionType\022\n\n\006VALUE"
-      "S\020\000\022\t\n\005DIFFS\020\001\022\024\n\020VALUES_AND_DIFFS\020\002b\006pr"
-      "oto3"
+      "Param\"\366\001\n\014PoolingParam\022\020\n\010window_h\030\001 \001(\005"
+      "\022\020\n\010window_w\030\002 \001(\005\022\r\n\005h_pad\030\003 \001(\005\022\r\n\005v_p"
+      "ad\030\004 \001(\005\022\020\n\010h_stride\030\005 \001(\005\022\020\n\010v_stride\030\006"
+      " \001(\005\022)\n\004mode\030\007 \001(\0162\033.deepflow.PoolingPar"
+      "am.Mode\"U\n\004Mode\022\007\n\003MAX\020\000\022!\n\035AVERAGE_COUN"
+      "T_INCLUDE_PADDING\020\001\022!\n\035AVERAGE_COUNT_EXC"
+      "LUDE_PADDING\020\002\"s\n\025TransposedConv2dParam\022"
+      "\r\n\005pad_h\030\001 \001(\005\022\r\n\005pad_w\030\002 \001(\005\022\t\n\001u\030\003 \001(\005"
+      "\022\t\n\001v\030\004 \001(\005\022\022\n\ndilation_h\030\005 \001(\005\022\022\n\ndilat"
+      "ion_w\030\006 \001(\005\"\224\001\n\013Conv2dParam\022\r\n\005pad_h\030\001 \001"
+      "(\005\022\r\n\005pad_w\030\002 \001(\005\022\t\n\001u\030\003 \001(\005\022\t\n\001v\030\004 \001(\005\022"
+      "\022\n\ndilation_h\030\005 \001(\005\022\022\n\ndilation_w\030\006 \001(\005\022"
+      ")\n\010epilogue\030\007 \001(\0132\027.deepflow.EpiloguePar"
+      "am\"\037\n\014DropoutParam\022\017\n\007dropout\030\001 \001(\002\"8\n\013M"
+      "atMulParam\022)\n\010epilogue\030\001 \001(\0132\027.deepflow."
+      "EpilogueParam\"\317\001\n\016PointwiseStage\022\'\n\002op\030\001"
+      " \001(\0162\033.deepflow.PointwiseStage.Op\022\014\n\004coe"
+      "f\030\002 \001(\002\"\205\001\n\002Op\022\014\n\010IDENTITY\020\000\022\013\n\007SIGMOID\020"
+      "\001\022\010\n\004RELU\020\002\022\010\n\004TANH\020\003\022\020\n\014CLIPPED_RELU\020\004\022"
+      "\007\n\003ELU\020\005\022\016\n\nLEAKY_RELU\020\006\022\007\n\003EXP\020\007\022\007\n\003LOG"
+      "\020\010\022\007\n\003ABS\020\t\022\n\n\006SQUARE\020\n\"K\n\rEpilogueParam"
+      "\022\014\n\004bias\030\001 \001(\010\022,\n\nactivation\030\002 \001(\0132\030.dee"
+      "pflow.PointwiseStage\"@\n\025FusedElementwise"
+      "Param\022\'\n\005stage\030\001 \003(\0132\030.deepflow.Pointwis"
+      "eStage\"\016\n\014ReorderParam\"6\n\nSliceParam\022\013\n\003"
+      "dim\030\001 \001(\005\022\r\n\005begin\030\002 \001(\005\022\014\n\004size\030\003 \001(\005\"("
+      "\n\016LeakyReluParam\022\026\n\016negative_slope\030\001 \001(\002"
+      "\"\014\n\nPReluParam\"%\n\013DPReluParam\022\026\n\016negativ"
+      "e_slope\030\001 \001(\002\"j\n\016ReduceAllParam\0227\n\treduc"
+      "e_op\030\001 \001(\0162$.deepflow.ReduceAllParam.Red"
+      "uceAllOp\"\037\n\013ReduceAllOp\022\007\n\003SUM\020\000\022\007\n\003AVG\020"
+      "\001\"\240\002\n\013ReduceParam\0221\n\treduce_op\030\001 \001(\0162\036.d"
+      "eepflow.ReduceParam.ReduceOp\022\022\n\nreduce_d"
+      "im\030\002 \001(\005\0225\n\013output_type\030\003 \001(\0162 .deepflow"
+      ".ReduceParam.OutputType\022\023\n\013reduce_dims\030\004"
+      " \003(\005\"W\n\010ReduceOp\022\007\n\003ADD\020\000\022\007\n\003MUL\020\001\022\007\n\003MI"
+      "N\020\002\022\007\n\003MAX\020\003\022\010\n\004AMAX\020\004\022\007\n\003AVG\020\005\022\t\n\005NORM1"
+      "\020\006\022\t\n\005NORM2\020\007\"%\n\nOutputType\022\n\n\006VALUES\020\000\022"
+      "\013\n\007INDICES\020\001\"v\n\rSnapshotParam\022\031\n\021snapsho"
+      "t_interval\030\001 \001(\005\022\027\n\017snapshot_prefix\030\002 \001("
+      "\t\022\030\n\020per_image_height\030\003 \001(\005\022\027\n\017per_image"
+      "_width\030\004 \001(\005\"\?\n\020PlaceHolderParam\022+\n\014tens"
+      "or_param\030\001 \001(\0132\025.deepflow.TensorParam\"9\n"
+      "\020RestructureParam\022\021\n\tfirst_dim\030\001 \001(\005\022\022\n\n"
+      "second_dim\030\002 \001(\005\"t\n\rVariableParam\022\'\n\nini"
+      "t_param\030\001 \001(\0132\023.deepflow.InitParam\022\023\n\013so"
+      "lver_name\030\002 \001(\t\022%\n\007weights\030\003 \001(\0132\024.deepf"
+      "low.TensorData\"\"\n\022DataGeneratorParam\022\014\n\004"
+      "freq\030\001 \001(\005\"\347\001\n\017ActivationParam\022,\n\004type\030\001"
+      " \001(\0162\036.deepflow.ActivationParam.Type\022\014\n\004"
+      "coef\030\002 \001(\002\"\227\001\n\004Type\022\034\n\030CUDNN_ACTIVATION_"
+      "SIGMOID\020\000\022\031\n\025CUDNN_ACTIVATION_RELU\020\001\022\031\n\025"
+      "CUDNN_ACTIVATION_TANH\020\002\022!\n\035CUDNN_ACTIVAT"
+      "ION_CLIPPED_RELU\020\003\022\030\n\024CUDNN_ACTIVATION_E"
+      "LU\020\004\"\205\001\n\025ImageBatchReaderParam\022\023\n\013folder"
+      "_path\030\001 \001(\t\022+\n\014tensor_param\030\002 \001(\0132\025.deep"
+      "flow.TensorParam\022\021\n\trandomize\030\003 \001(\010\022\027\n\017b"
+      "etween_0_and_1\030\004 \001(\010\"\203\001\n\020ImageReaderPara"
+      "m\022\021\n\tfile_name\030\001 \001(\t\022-\n\004type\030\002 \001(\0162\037.dee"
+      "pflow.ImageReaderParam.Type\"-\n\004Type\022\r\n\tG"
+      "RAY_ONLY\020\000\022\026\n\022COLOR_IF_AVAILABLE\020\001\"\350\001\n\nM"
+      "nistParam\022\023\n\013folder_path\030\001 \001(\t\0224\n\013reader"
+      "_type\030\002 \001(\0162\037.deepflow.MnistParam.Reader"
+      "Type\0224\n\013output_type\030\003 \001(\0162\037.deepflow.Mni"
+      "stParam.OutputType\022\022\n\nbatch_size\030\004 \001(\005\"!"
+      "\n\nReaderType\022\t\n\005TRAIN\020\000\022\010\n\004TEST\020\001\"\"\n\nOut"
+      "putType\022\010\n\004DATA\020\000\022\n\n\006LABELS\020\001\")\n\032Instanc"
+      "eNormalizationParam\022\013\n\003eps\030\001 \001(\002\"\233\002\n\027Bat"
+      "chNormalizationParam\0224\n\004mode\030\001 \001(\0162&.dee"
+      "pflow.BatchNormalizationParam.Mode\022\025\n\rca"
+      "che_meanvar\030\002 \001(\010\022\"\n\004mean\030\003 \001(\0132\024.deepfl"
+      "ow.TensorData\022!\n\003var\030\004 \001(\0132\024.deepflow.Te"
+      "nsorData\022\026\n\016exp_avg_factor\030\005 \001(\002\022\013\n\003eps\030"
+      "\006 \001(\002\"G\n\004Mode\022\"\n\036CUDNN_BATCHNORM_PER_ACT"
+      "IVATION\020\000\022\033\n\027CUDNN_BATCHNORM_SPATIAL\020\001\"I"
+      "\n\021ReplayMemoryParam\022\020\n\010capacity\030\001 \001(\005\022\023\n"
+      "\013prioritized\030\002 \001(\010\022\r\n\005alpha\030\003 \001(\002\"=\n\010Lrn"
+      "Param\022\t\n\001n\030\001 \001(\005\022\r\n\005alpha\030\002 \001(\002\022\014\n\004beta\030"
+      "\003 \001(\002\022\t\n\001k\030\004 \001(\002\"\257\001\n\013ResizeParam\022\024\n\014heig"
+      "ht_scale\030\001 \001(\002\022\023\n\013width_scale\030\002 \001(\002\022(\n\004m"
+      "ode\030\003 \001(\0162\032.deepflow.ResizeParam.Mode\022\013\n"
+      "\003add\030\004 \001(\010\022\r\n\005alpha\030\005 \001(\002\022\014\n\004beta\030\006 \001(\002\""
+      "!\n\004Mode\022\013\n\007NEAREST\020\000\022\014\n\010BILINEAR\020\001\"\r\n\013Sq"
+      "uareParam\"\n\n\010AbsParam\"\022\n\020SquareErrorPara"
+      "m\"\\\n\014SoftmaxParam\022)\n\004mode\030\001 \001(\0162\033.deepfl"
+      "ow.SoftmaxParam.Mode\"!\n\004Mode\022\014\n\010INSTANCE"
+      "\020\000\022\013\n\007CHANNEL\020\001\"T\n\030SoftmaxCrossEntropyPa"
+      "ram\022)\n\004mode\030\001 \001(\0162\033.deepflow.SoftmaxPara"
+      "m.Mode\022\r\n\005alpha\030\002 \001(\002\"\277\001\n\rPatchingParam\022"
+      "*\n\004mode\030\001 \001(\0162\034.deepflow.PatchingParam.M"
+      "ode\022\032\n\022num_vertical_patch\030\002 \001(\005\022\034\n\024num_h"
+      "orizontal_patch\030\003 \001(\005\"H\n\004Mode\022\r\n\tUPSAMPL"
+      "ES\020\000\022\017\n\013DOWNSAMPLES\020\001\022\016\n\nUPCHANNELS\020\002\022\020\n"
+      "\014DOWNCHANNELS\020\003\"\177\n\014LiftingParam\022)\n\004mode\030"
+      "\001 \001(\0162\033.deepflow.LiftingParam.Mode\"D\n\004Mo"
+      "de\022\016\n\nUP_REGULAR\020\000\022\020\n\014DOWN_REGULAR\020\001\022\013\n\007"
+      "UP_FLIP\020\002\022\r\n\tDOWN_FLIP\020\003\"\036\n\rInitFillPara"
+      "m\022\r\n\005value\030\001 \001(\002\"$\n\022InitIndexFillParam\022\016"
+      "\n\006offset\030\001 \001(\002\"\027\n\025InitGradientFillParam\""
+      "2\n\026InitRandomUniformParam\022\013\n\003min\030\001 \001(\002\022\013"
+      "\n\003max\030\002 \001(\002\"5\n\025InitRandomNormalParam\022\014\n\004"
+      "mean\030\001 \001(\002\022\016\n\006stddev\030\002 \001(\002\"8\n\030InitTrunca"
+      "tedNormalParam\022\014\n\004mean\030\001 \001(\002\022\016\n\006stddev\030\002"
+      " \001(\002\")\n\rInitStepParam\022\013\n\003min\030\001 \001(\002\022\013\n\003ma"
+      "x\030\002 \001(\002\"\025\n\023InitThreeStateParam\"#\n\021InitCo"
+      "nstantParam\022\016\n\006values\030\001 \003(\002\"\360\004\n\tInitPara"
+      "m\022\014\n\004name\030\001 \001(\t\022+\n\014tensor_param\030\002 \001(\0132\025."
+      "deepflow.TensorParam\022\'\n\tinit_data\030\003 \001(\0132"
+      "\024.deepflow.TensorData\022+\n\nfill_param\030\004 \001("
+      "\0132\027.deepflow.InitFillParam\0226\n\020index_fill"
+      "_param\030\005 \001(\0132\034.deepflow.InitIndexFillPar"
+      "am\022>\n\024random_uniform_param\030\006 \001(\0132 .deepf"
+      "low.InitRandomUniformParam\022+\n\nstep_param"
+      "\030\007 \001(\0132\027.deepflow.InitStepParam\022<\n\023rando"
+      "m_normal_param\030\010 \001(\0132\037.deepflow.InitRand"
+      "omNormalParam\0228\n\021three_state_param\030\t \001(\013"
+      "2\035.deepflow.InitThreeStateParam\022B\n\026trunc"
+      "ated_normal_param\030\n \001(\0132\".deepflow.InitT"
+      "runcatedNormalParam\022<\n\023gradient_fill_par"
+      "am\030\013 \001(\0132\037.deepflow.InitGradientFillPara"
+      "m\0223\n\016constant_param\030\014 \001(\0132\033.deepflow.Ini"
+      "tConstantParam\"\"\n\016SGDSolverParam\022\020\n\010mome"
+      "ntum\030\002 \001(\002\"6\n\023AdaDeltaSolverParam\022\020\n\010mom"
+      "entum\030\002 \001(\002\022\r\n\005delta\030\003 \001(\002\"<\n\017AdamSolver"
+      "Param\022\r\n\005beta1\030\002 \001(\002\022\r\n\005beta2\030\003 \001(\002\022\013\n\003e"
+      "ps\030\004 \001(\002\"4\n\022RMSPropSolverParam\022\021\n\trms_de"
+      "cay\030\001 \001(\002\022\013\n\003eps\030\002 \001(\002\"\215\002\n\013SolverParam\022\014"
+      "\n\004name\030\001 \001(\t\022\025\n\rlearning_rate\030\002 \001(\002\022,\n\ns"
+      "gd_solver\030\003 \001(\0132\030.deepflow.SGDSolverPara"
+      "m\022.\n\013adam_solver\030\005 \001(\0132\031.deepflow.AdamSo"
+      "lverParam\0226\n\017adadelta_solver\030\006 \001(\0132\035.dee"
+      "pflow.AdaDeltaSolverParam\0224\n\016rmsprop_sol"
+      "ver\030\007 \001(\0132\034.deepflow.RMSPropSolverParam\022"
+      "\r\n\005scope\030\010 \001(\t\"\342\001\n\013FrozenParam\022,\n\006output"
+      "\030\001 \003(\0132\034.deepflow.FrozenParam.Output\022\r\n\005"
+      "fetch\030\002 \003(\t\022\022\n\narena_size\030\003 \001(\003\0224\n\014arena"
+      "_policy\030\004 \001(\0162\036.deepflow.NodeParam.DataP"
+      "olicy\022\026\n\016shared_weights\030\005 \001(\t\0324\n\006Output\022"
+      "\014\n\004name\030\001 \001(\t\022\014\n\004dims\030\002 \003(\005\022\016\n\006offset\030\003 "
+      "\001(\003\"\255\001\n\nBlockParam\022!\n\004node\030\001 \003(\0132\023.deepf"
+      "low.NodeParam\022%\n\006solver\030\002 \003(\0132\025.deepflow"
+      ".SolverParam\022(\n\013initializer\030\004 \003(\0132\023.deep"
+      "flow.InitParam\022+\n\014frozen_param\030\005 \001(\0132\025.d"
+      "eepflow.FrozenParam\"\"\n\014ConcateParam\022\022\n\nn"
+      "um_inputs\030\001 \001(\005\"#\n\014ReshapeParam\022\023\n\013outpu"
+      "t_dims\030\001 \003(\005\"\022\n\020BatchStdDevParam\"*\n\020Pass"
+      "ThroughParam\022\026\n\016stop_gradients\030\001 \001(\010\"\017\n\r"
+      "GaussianParam\"O\n\023GaussianKernelParam\022\023\n\013"
+      "window_size\030\001 \001(\005\022\r\n\005sigma\030\002 \001(\002\022\024\n\014num_"
+      "channels\030\003 \001(\005\"Z\n\020GaborKernelParam\022\024\n\014or"
+      "ientations\030\001 \003(\002\022\016\n\006scales\030\002 \003(\002\022\013\n\003phi\030"
+      "\003 \001(\002\022\023\n\013apply_scale\030\004 \001(\010\"\?\n\022PatchSampl"
+      "ingParam\022\024\n\014patch_height\030\001 \001(\005\022\023\n\013patch_"
+      "width\030\002 \001(\005\"`\n\027TextImageGeneratorParam\022\'"
+      "\n\ninit_param\030\001 \001(\0132\023.deepflow.InitParam\022"
+      "\r\n\005chars\030\002 \001(\t\022\r\n\005words\030\003 \003(\t\"\n\n\010MaxPara"
+      "m\"\031\n\027SpatialTransformerParam\"\013\n\tNandPara"
+      "m\"\236\034\n\tNodeParam\022\014\n\004name\030\001 \001(\t\022\r\n\005scope\030\002"
+      " \001(\t\022\r\n\005input\030\003 \003(\t\022\016\n\006output\030\004 \003(\t\022)\n\013b"
+      "lock_param\030\005 \001(\0132\024.deepflow.BlockParam\0223"
+      "\n\013data_policy\030\006 \001(\0162\036.deepflow.NodeParam"
+      ".DataPolicy\022*\n\006layout\030\007 \001(\0162\032.deepflow.N"
+      "odeParam.Layout\022/\n\016variable_param\030d \001(\0132"
+      "\027.deepflow.VariableParam\0226\n\022place_holder"
+      "_param\030e \001(\0132\032.deepflow.PlaceHolderParam"
+      "\022%\n\tadd_param\030g \001(\0132\022.deepflow.AddParam\022"
+      ".\n\016bias_add_param\030h \001(\0132\026.deepflow.BiasA"
+      "ddParam\022,\n\rconv_2d_param\030i \001(\0132\025.deepflo"
+      "w.Conv2dParam\022A\n\030transposed_conv_2d_para"
+      "m\030j \001(\0132\037.deepflow.TransposedConv2dParam"
+      "\022-\n\rdropout_param\030k \001(\0132\026.deepflow.Dropo"
+      "utParam\0222\n\020leaky_relu_param\030l \001(\0132\030.deep"
+      "flow.LeakyReluParam\022-\n\rsoftmax_param\030m \001"
+      "(\0132\026.deepflow.SoftmaxParam\022+\n\014square_par"
+      "am\030n \001(\0132\025.deepflow.SquareParam\022+\n\014matmu"
+      "l_param\030o \001(\0132\025.deepflow.MatMulParam\022-\n\r"
+      "pooling_param\030p \001(\0132\026.deepflow.PoolingPa"
+      "ram\022+\n\014reduce_param\030q \001(\0132\025.deepflow.Red"
+      "uceParam\022)\n\013equal_param\030r \001(\0132\024.deepflow"
+      ".EqualParam\022)\n\013print_param\030s \001(\0132\024.deepf"
+      "low.PrintParam\0225\n\021accumulator_param\030u \001("
+      "\0132\032.deepflow.AccumulatorParam\022-\n\rdisplay"
+      "_param\030v \001(\0132\026.deepflow.DisplayParam\0223\n\020"
+      "activation_param\030w \001(\0132\031.deepflow.Activa"
+      "tionParam\022\'\n\npsnr_param\030x \001(\0132\023.deepflow"
+      ".PsnrParam\022<\n\025random_selector_param\030y \001("
+      "\0132\035.deepflow.RandomSelectorParam\022+\n\014logg"
+      "er_param\030z \001(\0132\025.deepflow.LoggerParam\0225\n"
+      "\021restructure_param\030{ \001(\0132\032.deepflow.Rest"
+      "ructureParam\0226\n\022image_reader_param\030| \001(\013"
+      "2\032.deepflow.ImageReaderParam\0225\n\021multiple"
+      "xer_param\030} \001(\0132\032.deepflow.MultiplexerPa"
+      "ram\022D\n\031batch_normalization_param\030\177 \001(\0132!"
+      ".deepflow.BatchNormalizationParam\022*\n\013mni"
+      "st_param\030\200\001 \001(\0132\024.deepflow.MnistParam\022;\n"
+      "\024data_generator_param\030\201\001 \001(\0132\034.deepflow."
+      "DataGeneratorParam\022B\n\030image_batch_reader"
+      "_param\030\202\001 \001(\0132\037.deepflow.ImageBatchReade"
+      "rParam\022&\n\tdot_param\030\203\001 \001(\0132\022.deepflow.Do"
+      "tParam\0229\n\023replay_memory_param\030\204\001 \001(\0132\033.d"
+      "eepflow.ReplayMemoryParam\0227\n\022square_erro"
+      "r_param\030\206\001 \001(\0132\032.deepflow.SquareErrorPar"
+      "am\0223\n\020sio_output_param\030\207\001 \001(\0132\030.deepflow"
+      ".SIOOutputParam\022&\n\tlog_param\030\210\001 \001(\0132\022.de"
+      "epflow.LogParam\022(\n\nloss_param\030\211\001 \001(\0132\023.d"
+      "eepflow.LossParam\022&\n\texp_param\030\212\001 \001(\0132\022."
+      "deepflow.ExpParam\022.\n\rlifting_param\030\213\001 \001("
+      "\0132\026.deepflow.LiftingParam\0220\n\016patching_pa"
+      "ram\030\214\001 \001(\0132\027.deepflow.PatchingParam\022&\n\ta"
+      "bs_param\030\215\001 \001(\0132\022.deepflow.AbsParam\0223\n\020r"
+      "educe_all_param\030\216\001 \001(\0132\030.deepflow.Reduce"
+      "AllParam\0227\n\022image_writer_param\030\220\001 \001(\0132\032."
+      "deepflow.ImageWriterParam\022,\n\014resize_para"
+      "m\030\221\001 \001(\0132\025.deepflow.ResizeParam\022*\n\013split"
+      "_param\030\222\001 \001(\0132\024.deepflow.SplitParam\022,\n\014s"
+      "witch_param\030\223\001 \001(\0132\025.deepflow.SwitchPara"
+      "m\022&\n\tlrn_param\030\224\001 \001(\0132\022.deepflow.LrnPara"
+      "m\022*\n\013prelu_param\030\225\001 \001(\0132\024.deepflow.PRelu"
+      "Param\022.\n\rconcate_param\030\226\001 \001(\0132\026.deepflow"
+      ".ConcateParam\022.\n\rreshape_param\030\227\001 \001(\0132\026."
+      "deepflow.ReshapeParam\022,\n\014dprelu_param\030\230\001"
+      " \001(\0132\025.deepflow.DPReluParam\0227\n\022batch_std"
+      "dev_param\030\231\001 \001(\0132\032.deepflow.BatchStdDevP"
+      "aram\0227\n\022pass_through_param\030\232\001 \001(\0132\032.deep"
+      "flow.PassThroughParam\0220\n\016gaussian_param\030"
+      "\233\001 \001(\0132\027.deepflow.GaussianParam\022=\n\025gauss"
+      "ian_kernel_param\030\234\001 \001(\0132\035.deepflow.Gauss"
+      "ianKernelParam\022;\n\024patch_sampling_param\030\235"
+      "\001 \001(\0132\034.deepflow.PatchSamplingParam\022F\n\032t"
+      "ext_image_generator_param\030\236\001 \001(\0132!.deepf"
+      "low.TextImageGeneratorParam\022&\n\tmax_param"
+      "\030\237\001 \001(\0132\022.deepflow.MaxParam\022E\n\026instance_"
+      "normalization\030\240\001 \001(\0132$.deepflow.Instance"
+      "NormalizationParam\022E\n\031spatial_transforme"
+      "r_param\030\241\001 \001(\0132!.deepflow.SpatialTransfo"
+      "rmerParam\022(\n\nnand_param\030\242\001 \001(\0132\023.deepflo"
+      "w.NandParam\0227\n\022gabor_kernel_param\030\243\001 \001(\013"
+      "2\032.deepflow.GaborKernelParam\022H\n\033softmax_"
+      "cross_entropy_param\030\244\001 \001(\0132\".deepflow.So"
+      "ftmaxCrossEntropyParam\022A\n\027fused_elementw"
+      "ise_param\030\245\001 \001(\0132\037.deepflow.FusedElement"
+      "wiseParam\022.\n\rreorder_param\030\246\001 \001(\0132\026.deep"
+      "flow.ReorderParam\022*\n\013slice_param\030\247\001 \001(\0132"
+      "\024.deepflow.SliceParam\"p\n\nDataPolicy\022\023\n\017G"
+      "PU_ONLY_POLICY\020\000\022\037\n\033GPU_WITH_CPU_OFFLOAD"
+      "_POLICY\020\001\022\027\n\023CUDA_MANAGED_POLICY\020\002\022\023\n\017CP"
+      "U_ONLY_POLICY\020\003\")\n\006Layout\022\010\n\004NCHW\020\000\022\010\n\004N"
+      "HWC\020\001\022\013\n\007NCHW16C\020\002*9\n\nActionType\022\n\n\006VALU"
+      "ES\020\000\022\t\n\005DIFFS\020\001\022\024\n\020VALUES_AND_DIFFS\020\002b\006p"
+      "roto3"
   };
   ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-      descriptor, 9604);
+      descriptor, 11125);
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
     "deepflow.proto", &protobuf_RegisterTypes);
   ::google::protobuf::internal::OnShutdown(&TableStruct::Shutdown);
@@ -1822,10 +2014,72 @@ const LossParam_ReduceOp LossParam::ReduceOp_MIN;
 const LossParam_ReduceOp LossParam::ReduceOp_MAX;
 const int LossParam::ReduceOp_ARRAYSIZE;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-const ::google::protobuf::EnumDescriptor* ReduceAllParam_ReduceAllOp_descriptor() {
+const ::google::protobuf::EnumDescriptor* PoolingParam_Mode_descriptor() {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_enum_descriptors[2];
 }
+bool PoolingParam_Mode_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const PoolingParam_Mode PoolingParam::MAX;
+const PoolingParam_Mode PoolingParam::AVERAGE_COUNT_INCLUDE_PADDING;
+const PoolingParam_Mode PoolingParam::AVERAGE_COUNT_EXCLUDE_PADDING;
+const PoolingParam_Mode PoolingParam::Mode_MIN;
+const PoolingParam_Mode PoolingParam::Mode_MAX;
+const int PoolingParam::Mode_ARRAYSIZE;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+const ::google::protobuf::EnumDescriptor* PointwiseStage_Op_descriptor() {
+  protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_deepflow_2eproto::file_level_enum_descriptors[3];
+}
+bool PointwiseStage_Op_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+    case 7:
+    case 8:
+    case 9:
+    case 10:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const PointwiseStage_Op PointwiseStage::IDENTITY;
+const PointwiseStage_Op PointwiseStage::SIGMOID;
+const PointwiseStage_Op PointwiseStage::RELU;
+const PointwiseStage_Op PointwiseStage::TANH;
+const PointwiseStage_Op PointwiseStage::CLIPPED_RELU;
+const PointwiseStage_Op PointwiseStage::ELU;
+const PointwiseStage_Op PointwiseStage::LEAKY_RELU;
+const PointwiseStage_Op PointwiseStage::EXP;
+const PointwiseStage_Op PointwiseStage::LOG;
+const PointwiseStage_Op PointwiseStage::ABS;
+const PointwiseStage_Op PointwiseStage::SQUARE;
+const PointwiseStage_Op PointwiseStage::Op_MIN;
+const PointwiseStage_Op PointwiseStage::Op_MAX;
+const int PointwiseStage::Op_ARRAYSIZE;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+const ::google::protobuf::EnumDescriptor* ReduceAllParam_ReduceAllOp_descriptor() {
+  protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_deepflow_2eproto::file_level_enum_descriptors[4];
+}
 bool ReduceAllParam_ReduceAllOp_IsValid(int value) {
   switch (value) {
     case 0:
@@ -1845,7 +2099,7 @@ const int ReduceAllParam::ReduceAllOp_ARRAYSIZE;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 const ::google::protobuf::EnumDescriptor* ReduceParam_ReduceOp_descriptor() {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_deepflow_2eproto::file_level_enum_descriptors[3];
+  return protobuf_deepflow_2eproto::file_level_enum_descriptors[5];
 }
 bool ReduceParam_ReduceOp_IsValid(int value) {
   switch (value) {
@@ -1878,7 +2132,7 @@ const int ReduceParam::ReduceOp_ARRAYSIZE;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 const ::google::protobuf::EnumDescriptor* ReduceParam_OutputType_descriptor() {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_deepflow_2eproto::file_level_enum_descriptors[4];
+  return protobuf_deepflow_2eproto::file_level_enum_descriptors[6];
 }
 bool ReduceParam_OutputType_IsValid(int value) {
   switch (value) {
@@ -1899,7 +2153,7 @@ const int ReduceParam::OutputType_ARRAYSIZE;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 const ::google::protobuf::EnumDescriptor* ActivationParam_Type_descriptor() {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_deepflow_2eproto::file_level_enum_descriptors[5];
+  return protobuf_deepflow_2eproto::file_level_enum_descriptors[7];
 }
 bool ActivationParam_Type_IsValid(int value) {
   switch (value) {
@@ -1926,7 +2180,7 @@ const int ActivationParam::Type_ARRAYSIZE;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 const ::google::protobuf::EnumDescriptor* ImageReaderParam_Type_descriptor() {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_deepflow_2eproto::file_level_enum_descriptors[6];
+  return protobuf_deepflow_2eproto::file_level_enum_descriptors[8];
 }
 bool ImageReaderParam_Type_IsValid(int value) {
   switch (value) {
@@ -1947,7 +2201,7 @@ const int ImageReaderParam::Type_ARRAYSIZE;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 const ::google::protobuf::EnumDescriptor* MnistParam_ReaderType_descriptor() {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_deepflow_2eproto::file_level_enum_descriptors[7];
+  return protobuf_deepflow_2eproto::file_level_enum_descriptors[9];
 }
 bool MnistParam_ReaderType_IsValid(int value) {
   switch (value) {
@@ -1968,7 +2222,7 @@ const int MnistParam::ReaderType_ARRAYSIZE;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 const ::google::protobuf::EnumDescriptor* MnistParam_OutputType_descriptor() {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_deepflow_2eproto::file_level_enum_descriptors[8];
+  return protobuf_deepflow_2eproto::file_level_enum_descriptors[10];
 }
 bool MnistParam_OutputType_IsValid(int value) {
   switch (value) {
@@ -1989,7 +2243,7 @@ const int MnistParam::OutputType_ARRAYSIZE;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 const ::google::protobuf::EnumDescriptor* BatchNormalizationParam_Mode_descriptor() {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_deepflow_2eproto::file_level_enum_descriptors[9];
+  return protobuf_deepflow_2eproto::file_level_enum_descriptors[11];
 }
 bool BatchNormalizationParam_Mode_IsValid(int value) {
   switch (value) {
@@ -2008,9 +2262,30 @@ const BatchNormalizationParam_Mode BatchNormalizationParam::Mode_MIN;
 const BatchNormalizationParam_Mode BatchNormalizationParam::Mode_MAX;
 const int BatchNormalizationParam::Mode_ARRAYSIZE;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+const ::google::protobuf::EnumDescriptor* ResizeParam_Mode_descriptor() {
+  protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_deepflow_2eproto::file_level_enum_descriptors[12];
+}
+bool ResizeParam_Mode_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const ResizeParam_Mode ResizeParam::NEAREST;
+const ResizeParam_Mode ResizeParam::BILINEAR;
+const ResizeParam_Mode ResizeParam::Mode_MIN;
+const ResizeParam_Mode ResizeParam::Mode_MAX;
+const int ResizeParam::Mode_ARRAYSIZE;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 const ::google::protobuf::EnumDescriptor* SoftmaxParam_Mode_descriptor() {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_deepflow_2eproto::file_level_enum_descriptors[10];
+  return protobuf_deepflow_2eproto::file_level_enum_descriptors[13];
 }
 bool SoftmaxParam_Mode_IsValid(int value) {
   switch (value) {
@@ -2031,7 +2306,7 @@ const int SoftmaxParam::Mode_ARRAYSIZE;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 const ::google::protobuf::EnumDescriptor* PatchingParam_Mode_descriptor() {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_deepflow_2eproto::file_level_enum_descriptors[11];
+  return protobuf_deepflow_2eproto::file_level_enum_descriptors[14];
 }
 bool PatchingParam_Mode_IsValid(int value) {
   switch (value) {
@@ -2056,7 +2331,7 @@ const int PatchingParam::Mode_ARRAYSIZE;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 const ::google::protobuf::EnumDescriptor* LiftingParam_Mode_descriptor() {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_deepflow_2eproto::file_level_enum_descriptors[12];
+  return protobuf_deepflow_2eproto::file_level_enum_descriptors[15];
 }
 bool LiftingParam_Mode_IsValid(int value) {
   switch (value) {
@@ -2081,13 +2356,14 @@ const int LiftingParam::Mode_ARRAYSIZE;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 const ::google::protobuf::EnumDescriptor* NodeParam_DataPolicy_descriptor() {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_deepflow_2eproto::file_level_enum_descriptors[13];
+  return protobuf_deepflow_2eproto::file_level_enum_descriptors[16];
 }
 bool NodeParam_DataPolicy_IsValid(int value) {
   switch (value) {
     case 0:
     case 1:
     case 2:
+    case 3:
       return true;
     default:
       return false;
@@ -2098,13 +2374,37 @@ bool NodeParam_DataPolicy_IsValid(int value) {
 const NodeParam_DataPolicy NodeParam::GPU_ONLY_POLICY;
 const NodeParam_DataPolicy NodeParam::GPU_WITH_CPU_OFFLOAD_POLICY;
 const NodeParam_DataPolicy NodeParam::CUDA_MANAGED_POLICY;
+const NodeParam_DataPolicy NodeParam::CPU_ONLY_POLICY;
 const NodeParam_DataPolicy NodeParam::DataPolicy_MIN;
 const NodeParam_DataPolicy NodeParam::DataPolicy_MAX;
 const int NodeParam::DataPolicy_ARRAYSIZE;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+const ::google::protobuf::EnumDescriptor* NodeParam_Layout_descriptor() {
+  protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_deepflow_2eproto::file_level_enum_descriptors[17];
+}
+bool NodeParam_Layout_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const NodeParam_Layout NodeParam::NCHW;
+const NodeParam_Layout NodeParam::NHWC;
+const NodeParam_Layout NodeParam::NCHW16C;
+const NodeParam_Layout NodeParam::Layout_MIN;
+const NodeParam_Layout NodeParam::Layout_MAX;
+const int NodeParam::Layout_ARRAYSIZE;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 const ::google::protobuf::EnumDescriptor* ActionType_descriptor() {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_deepflow_2eproto::file_level_enum_descriptors[14];
+  return protobuf_deepflow_2eproto::file_level_enum_descriptors[18];
 }
 bool ActionType_IsValid(int value) {
   switch (value) {
@@ -7653,6 +7953,7 @@ const int PoolingParam::kHPadFieldNumber;
 const int PoolingParam::kVPadFieldNumber;
 const int PoolingParam::kHStrideFieldNumber;
 const int PoolingParam::kVStrideFieldNumber;
+const int PoolingParam::kModeFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
 PoolingParam::PoolingParam()
@@ -7669,14 +7970,14 @@ PoolingParam::PoolingParam(const PoolingParam& from)
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::memcpy(&window_h_, &from.window_h_,
-    reinterpret_cast<char*>(&v_stride_) -
-    reinterpret_cast<char*>(&window_h_) + sizeof(v_stride_));
+    reinterpret_cast<char*>(&mode_) -
+    reinterpret_cast<char*>(&window_h_) + sizeof(mode_));
   // @@protoc_insertion_point(copy_constructor:deepflow.PoolingParam)
 }
 
 void PoolingParam::SharedCtor() {
-  ::memset(&window_h_, 0, reinterpret_cast<char*>(&v_stride_) -
-    reinterpret_cast<char*>(&window_h_) + sizeof(v_stride_));
+  ::memset(&window_h_, 0, reinterpret_cast<char*>(&mode_) -
+    reinterpret_cast<char*>(&window_h_) + sizeof(mode_));
   _cached_size_ = 0;
 }
 
@@ -7713,8 +8014,8 @@ PoolingParam* PoolingParam::New(::google::protobuf::Arena* arena) const {
 
 void PoolingParam::Clear() {
 // @@protoc_insertion_point(message_clear_start:deepflow.PoolingParam)
-  ::memset(&window_h_, 0, reinterpret_cast<char*>(&v_stride_) -
-    reinterpret_cast<char*>(&window_h_) + sizeof(v_stride_));
+  ::memset(&window_h_, 0, reinterpret_cast<char*>(&mode_) -
+    reinterpret_cast<char*>(&window_h_) + sizeof(mode_));
 }
 
 bool PoolingParam::MergePartialFromCodedStream(
@@ -7811,6 +8112,21 @@ bool PoolingParam::MergePartialFromCodedStream(
         break;
       }
 
+      // .deepflow.PoolingParam.Mode mode = 7;
+      case 7: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(56u)) {
+          int value;
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          set_mode(static_cast< ::deepflow::PoolingParam_Mode >(value));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
       default: {
       handle_unusual:
         if (tag == 0 ||
@@ -7868,6 +8184,12 @@ void PoolingParam::SerializeWithCachedSizes(
     ::google::protobuf::internal::WireFormatLite::WriteInt32(6, this->v_stride(), output);
   }
 
+  // .deepflow.PoolingParam.Mode mode = 7;
+  if (this->mode() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      7, this->mode(), output);
+  }
+
   // @@protoc_insertion_point(serialize_end:deepflow.PoolingParam)
 }
 
@@ -7907,6 +8229,12 @@ void PoolingParam::SerializeWithCachedSizes(
     target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(6, this->v_stride(), target);
   }
 
+  // .deepflow.PoolingParam.Mode mode = 7;
+  if (this->mode() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
+      7, this->mode(), target);
+  }
+
   // @@protoc_insertion_point(serialize_to_array_end:deepflow.PoolingParam)
   return target;
 }
@@ -7957,6 +8285,12 @@ size_t PoolingParam::ByteSizeLong() const {
         this->v_stride());
   }
 
+  // .deepflow.PoolingParam.Mode mode = 7;
+  if (this->mode() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::EnumSize(this->mode());
+  }
+
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = cached_size;
@@ -8004,6 +8338,9 @@ void PoolingParam::MergeFrom(const PoolingParam& from) {
   if (from.v_stride() != 0) {
     set_v_stride(from.v_stride());
   }
+  if (from.mode() != 0) {
+    set_mode(from.mode());
+  }
 }
 
 void PoolingParam::CopyFrom(const ::google::protobuf::Message& from) {
@@ -8035,6 +8372,7 @@ void PoolingParam::InternalSwap(PoolingParam* other) {
   std::swap(v_pad_, other->v_pad_);
   std::swap(h_stride_, other->h_stride_);
   std::swap(v_stride_, other->v_stride_);
+  std::swap(mode_, other->mode_);
   std::swap(_cached_size_, other->_cached_size_);
 }
 
@@ -8130,6 +8468,20 @@ void PoolingParam::set_v_stride(::google::protobuf::int32 value) {
   // @@protoc_insertion_point(field_set:deepflow.PoolingParam.v_stride)
 }
 
+// .deepflow.PoolingParam.Mode mode = 7;
+void PoolingParam::clear_mode() {
+  mode_ = 0;
+}
+::deepflow::PoolingParam_Mode PoolingParam::mode() const {
+  // @@protoc_insertion_point(field_get:deepflow.PoolingParam.mode)
+  return static_cast< ::deepflow::PoolingParam_Mode >(mode_);
+}
+void PoolingParam::set_mode(::deepflow::PoolingParam_Mode value) {
+  
+  mode_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.PoolingParam.mode)
+}
+
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
 // ===================================================================
@@ -8629,6 +8981,7 @@ const int Conv2dParam::kUFieldNumber;
 const int Conv2dParam::kVFieldNumber;
 const int Conv2dParam::kDilationHFieldNumber;
 const int Conv2dParam::kDilationWFieldNumber;
+const int Conv2dParam::kEpilogueFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
 Conv2dParam::Conv2dParam()
@@ -8644,6 +8997,11 @@ Conv2dParam::Conv2dParam(const Conv2dParam& from)
       _internal_metadata_(NULL),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
+  if (from.has_epilogue()) {
+    epilogue_ = new ::deepflow::EpilogueParam(*from.epilogue_);
+  } else {
+    epilogue_ = NULL;
+  }
   ::memcpy(&pad_h_, &from.pad_h_,
     reinterpret_cast<char*>(&dilation_w_) -
     reinterpret_cast<char*>(&pad_h_) + sizeof(dilation_w_));
@@ -8651,8 +9009,8 @@ Conv2dParam::Conv2dParam(const Conv2dParam& from)
 }
 
 void Conv2dParam::SharedCtor() {
-  ::memset(&pad_h_, 0, reinterpret_cast<char*>(&dilation_w_) -
-    reinterpret_cast<char*>(&pad_h_) + sizeof(dilation_w_));
+  ::memset(&epilogue_, 0, reinterpret_cast<char*>(&dilation_w_) -
+    reinterpret_cast<char*>(&epilogue_) + sizeof(dilation_w_));
   _cached_size_ = 0;
 }
 
@@ -8662,6 +9020,9 @@ Conv2dParam::~Conv2dParam() {
 }
 
 void Conv2dParam::SharedDtor() {
+  if (this != internal_default_instance()) {
+    delete epilogue_;
+  }
 }
 
 void Conv2dParam::SetCachedSize(int size) const {
@@ -8689,6 +9050,10 @@ Conv2dParam* Conv2dParam::New(::google::protobuf::Arena* arena) const {
 
 void Conv2dParam::Clear() {
 // @@protoc_insertion_point(message_clear_start:deepflow.Conv2dParam)
+  if (GetArenaNoVirtual() == NULL && epilogue_ != NULL) {
+    delete epilogue_;
+  }
+  epilogue_ = NULL;
   ::memset(&pad_h_, 0, reinterpret_cast<char*>(&dilation_w_) -
     reinterpret_cast<char*>(&pad_h_) + sizeof(dilation_w_));
 }
@@ -8787,6 +9152,18 @@ bool Conv2dParam::MergePartialFromCodedStream(
         break;
       }
 
+      // .deepflow.EpilogueParam epilogue = 7;
+      case 7: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(58u)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_epilogue()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
       default: {
       handle_unusual:
         if (tag == 0 ||
@@ -8844,6 +9221,12 @@ void Conv2dParam::SerializeWithCachedSizes(
     ::google::protobuf::internal::WireFormatLite::WriteInt32(6, this->dilation_w(), output);
   }
 
+  // .deepflow.EpilogueParam epilogue = 7;
+  if (this->has_epilogue()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      7, *this->epilogue_, output);
+  }
+
   // @@protoc_insertion_point(serialize_end:deepflow.Conv2dParam)
 }
 
@@ -8883,6 +9266,13 @@ void Conv2dParam::SerializeWithCachedSizes(
     target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(6, this->dilation_w(), target);
   }
 
+  // .deepflow.EpilogueParam epilogue = 7;
+  if (this->has_epilogue()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        7, *this->epilogue_, deterministic, target);
+  }
+
   // @@protoc_insertion_point(serialize_to_array_end:deepflow.Conv2dParam)
   return target;
 }
@@ -8891,6 +9281,13 @@ size_t Conv2dParam::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:deepflow.Conv2dParam)
   size_t total_size = 0;
 
+  // .deepflow.EpilogueParam epilogue = 7;
+  if (this->has_epilogue()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        *this->epilogue_);
+  }
+
   // int32 pad_h = 1;
   if (this->pad_h() != 0) {
     total_size += 1 +
@@ -8962,6 +9359,9 @@ void Conv2dParam::MergeFrom(const Conv2dParam& from) {
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
+  if (from.has_epilogue()) {
+    mutable_epilogue()->::deepflow::EpilogueParam::MergeFrom(from.epilogue());
+  }
   if (from.pad_h() != 0) {
     set_pad_h(from.pad_h());
   }
@@ -9005,6 +9405,7 @@ void Conv2dParam::Swap(Conv2dParam* other) {
   InternalSwap(other);
 }
 void Conv2dParam::InternalSwap(Conv2dParam* other) {
+  std::swap(epilogue_, other->epilogue_);
   std::swap(pad_h_, other->pad_h_);
   std::swap(pad_w_, other->pad_w_);
   std::swap(u_, other->u_);
@@ -9106,6 +9507,45 @@ void Conv2dParam::set_dilation_w(::google::protobuf::int32 value) {
   // @@protoc_insertion_point(field_set:deepflow.Conv2dParam.dilation_w)
 }
 
+// .deepflow.EpilogueParam epilogue = 7;
+bool Conv2dParam::has_epilogue() const {
+  return this != internal_default_instance() && epilogue_ != NULL;
+}
+void Conv2dParam::clear_epilogue() {
+  if (GetArenaNoVirtual() == NULL && epilogue_ != NULL) delete epilogue_;
+  epilogue_ = NULL;
+}
+const ::deepflow::EpilogueParam& Conv2dParam::epilogue() const {
+  // @@protoc_insertion_point(field_get:deepflow.Conv2dParam.epilogue)
+  return epilogue_ != NULL ? *epilogue_
+                         : *::deepflow::EpilogueParam::internal_default_instance();
+}
+::deepflow::EpilogueParam* Conv2dParam::mutable_epilogue() {
+  
+  if (epilogue_ == NULL) {
+    epilogue_ = new ::deepflow::EpilogueParam;
+  }
+  // @@protoc_insertion_point(field_mutable:deepflow.Conv2dParam.epilogue)
+  return epilogue_;
+}
+::deepflow::EpilogueParam* Conv2dParam::release_epilogue() {
+  // @@protoc_insertion_point(field_release:deepflow.Conv2dParam.epilogue)
+  
+  ::deepflow::EpilogueParam* temp = epilogue_;
+  epilogue_ = NULL;
+  return temp;
+}
+void Conv2dParam::set_allocated_epilogue(::deepflow::EpilogueParam* epilogue) {
+  delete epilogue_;
+  epilogue_ = epilogue;
+  if (epilogue) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:deepflow.Conv2dParam.epilogue)
+}
+
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
 // ===================================================================
@@ -9343,6 +9783,7 @@ void DropoutParam::set_dropout(float value) {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int MatMulParam::kEpilogueFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
 MatMulParam::MatMulParam()
@@ -9358,10 +9799,16 @@ MatMulParam::MatMulParam(const MatMulParam& from)
       _internal_metadata_(NULL),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
+  if (from.has_epilogue()) {
+    epilogue_ = new ::deepflow::EpilogueParam(*from.epilogue_);
+  } else {
+    epilogue_ = NULL;
+  }
   // @@protoc_insertion_point(copy_constructor:deepflow.MatMulParam)
 }
 
 void MatMulParam::SharedCtor() {
+  epilogue_ = NULL;
   _cached_size_ = 0;
 }
 
@@ -9371,6 +9818,9 @@ MatMulParam::~MatMulParam() {
 }
 
 void MatMulParam::SharedDtor() {
+  if (this != internal_default_instance()) {
+    delete epilogue_;
+  }
 }
 
 void MatMulParam::SetCachedSize(int size) const {
@@ -9398,6 +9848,10 @@ MatMulParam* MatMulParam::New(::google::protobuf::Arena* arena) const {
 
 void MatMulParam::Clear() {
 // @@protoc_insertion_point(message_clear_start:deepflow.MatMulParam)
+  if (GetArenaNoVirtual() == NULL && epilogue_ != NULL) {
+    delete epilogue_;
+  }
+  epilogue_ = NULL;
 }
 
 bool MatMulParam::MergePartialFromCodedStream(
@@ -9409,13 +9863,30 @@ bool MatMulParam::MergePartialFromCodedStream(
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
     if (!p.second) goto handle_unusual;
-  handle_unusual:
-    if (tag == 0 ||
-        ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-        ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-      goto success;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // .deepflow.EpilogueParam epilogue = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(10u)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_epilogue()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0 ||
+            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
+        break;
+      }
     }
-    DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
   }
 success:
   // @@protoc_insertion_point(parse_success:deepflow.MatMulParam)
@@ -9432,6 +9903,12 @@ void MatMulParam::SerializeWithCachedSizes(
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
+  // .deepflow.EpilogueParam epilogue = 1;
+  if (this->has_epilogue()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      1, *this->epilogue_, output);
+  }
+
   // @@protoc_insertion_point(serialize_end:deepflow.MatMulParam)
 }
 
@@ -9441,6 +9918,13 @@ void MatMulParam::SerializeWithCachedSizes(
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
+  // .deepflow.EpilogueParam epilogue = 1;
+  if (this->has_epilogue()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        1, *this->epilogue_, deterministic, target);
+  }
+
   // @@protoc_insertion_point(serialize_to_array_end:deepflow.MatMulParam)
   return target;
 }
@@ -9449,6 +9933,13 @@ size_t MatMulParam::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:deepflow.MatMulParam)
   size_t total_size = 0;
 
+  // .deepflow.EpilogueParam epilogue = 1;
+  if (this->has_epilogue()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        *this->epilogue_);
+  }
+
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = cached_size;
@@ -9478,6 +9969,9 @@ void MatMulParam::MergeFrom(const MatMulParam& from) {
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
+  if (from.has_epilogue()) {
+    mutable_epilogue()->::deepflow::EpilogueParam::MergeFrom(from.epilogue());
+  }
 }
 
 void MatMulParam::CopyFrom(const ::google::protobuf::Message& from) {
@@ -9503,6 +9997,7 @@ void MatMulParam::Swap(MatMulParam* other) {
   InternalSwap(other);
 }
 void MatMulParam::InternalSwap(MatMulParam* other) {
+  std::swap(epilogue_, other->epilogue_);
   std::swap(_cached_size_, other->_cached_size_);
 }
 
@@ -9514,90 +10009,149 @@ void MatMulParam::InternalSwap(MatMulParam* other) {
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
 // MatMulParam
 
+// .deepflow.EpilogueParam epilogue = 1;
+bool MatMulParam::has_epilogue() const {
+  return this != internal_default_instance() && epilogue_ != NULL;
+}
+void MatMulParam::clear_epilogue() {
+  if (GetArenaNoVirtual() == NULL && epilogue_ != NULL) delete epilogue_;
+  epilogue_ = NULL;
+}
+const ::deepflow::EpilogueParam& MatMulParam::epilogue() const {
+  // @@protoc_insertion_point(field_get:deepflow.MatMulParam.epilogue)
+  return epilogue_ != NULL ? *epilogue_
+                         : *::deepflow::EpilogueParam::internal_default_instance();
+}
+::deepflow::EpilogueParam* MatMulParam::mutable_epilogue() {
+  
+  if (epilogue_ == NULL) {
+    epilogue_ = new ::deepflow::EpilogueParam;
+  }
+  // @@protoc_insertion_point(field_mutable:deepflow.MatMulParam.epilogue)
+  return epilogue_;
+}
+::deepflow::EpilogueParam* MatMulParam::release_epilogue() {
+  // @@protoc_insertion_point(field_release:deepflow.MatMulParam.epilogue)
+  
+  ::deepflow::EpilogueParam* temp = epilogue_;
+  epilogue_ = NULL;
+  return temp;
+}
+void MatMulParam::set_allocated_epilogue(::deepflow::EpilogueParam* epilogue) {
+  delete epilogue_;
+  epilogue_ = epilogue;
+  if (epilogue) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:deepflow.MatMulParam.epilogue)
+}
+
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int LeakyReluParam::kNegativeSlopeFieldNumber;
+const int PointwiseStage::kOpFieldNumber;
+const int PointwiseStage::kCoefFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-LeakyReluParam::LeakyReluParam()
+PointwiseStage::PointwiseStage()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_deepflow_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:deepflow.LeakyReluParam)
+  // @@protoc_insertion_point(constructor:deepflow.PointwiseStage)
 }
-LeakyReluParam::LeakyReluParam(const LeakyReluParam& from)
+PointwiseStage::PointwiseStage(const PointwiseStage& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
-  negative_slope_ = from.negative_slope_;
-  // @@protoc_insertion_point(copy_constructor:deepflow.LeakyReluParam)
+  ::memcpy(&op_, &from.op_,
+    reinterpret_cast<char*>(&coef_) -
+    reinterpret_cast<char*>(&op_) + sizeof(coef_));
+  // @@protoc_insertion_point(copy_constructor:deepflow.PointwiseStage)
 }
 
-void LeakyReluParam::SharedCtor() {
-  negative_slope_ = 0;
+void PointwiseStage::SharedCtor() {
+  ::memset(&op_, 0, reinterpret_cast<char*>(&coef_) -
+    reinterpret_cast<char*>(&op_) + sizeof(coef_));
   _cached_size_ = 0;
 }
 
-LeakyReluParam::~LeakyReluParam() {
-  // @@protoc_insertion_point(destructor:deepflow.LeakyReluParam)
+PointwiseStage::~PointwiseStage() {
+  // @@protoc_insertion_point(destructor:deepflow.PointwiseStage)
   SharedDtor();
 }
 
-void LeakyReluParam::SharedDtor() {
+void PointwiseStage::SharedDtor() {
 }
 
-void LeakyReluParam::SetCachedSize(int size) const {
+void PointwiseStage::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* LeakyReluParam::descriptor() {
+const ::google::protobuf::Descriptor* PointwiseStage::descriptor() {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const LeakyReluParam& LeakyReluParam::default_instance() {
+const PointwiseStage& PointwiseStage::default_instance() {
   protobuf_deepflow_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-LeakyReluParam* LeakyReluParam::New(::google::protobuf::Arena* arena) const {
-  LeakyReluParam* n = new LeakyReluParam;
+PointwiseStage* PointwiseStage::New(::google::protobuf::Arena* arena) const {
+  PointwiseStage* n = new PointwiseStage;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void LeakyReluParam::Clear() {
-// @@protoc_insertion_point(message_clear_start:deepflow.LeakyReluParam)
-  negative_slope_ = 0;
+void PointwiseStage::Clear() {
+// @@protoc_insertion_point(message_clear_start:deepflow.PointwiseStage)
+  ::memset(&op_, 0, reinterpret_cast<char*>(&coef_) -
+    reinterpret_cast<char*>(&op_) + sizeof(coef_));
 }
 
-bool LeakyReluParam::MergePartialFromCodedStream(
+bool PointwiseStage::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:deepflow.LeakyReluParam)
+  // @@protoc_insertion_point(parse_start:deepflow.PointwiseStage)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // float negative_slope = 1;
+      // .deepflow.PointwiseStage.Op op = 1;
       case 1: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(13u)) {
+            static_cast< ::google::protobuf::uint8>(8u)) {
+          int value;
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          set_op(static_cast< ::deepflow::PointwiseStage_Op >(value));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // float coef = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(21u)) {
 
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
                    float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &negative_slope_)));
+                 input, &coef_)));
         } else {
           goto handle_unusual;
         }
@@ -9617,49 +10171,67 @@ bool LeakyReluParam::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:deepflow.LeakyReluParam)
+  // @@protoc_insertion_point(parse_success:deepflow.PointwiseStage)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:deepflow.LeakyReluParam)
+  // @@protoc_insertion_point(parse_failure:deepflow.PointwiseStage)
   return false;
 #undef DO_
 }
 
-void LeakyReluParam::SerializeWithCachedSizes(
+void PointwiseStage::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:deepflow.LeakyReluParam)
+  // @@protoc_insertion_point(serialize_start:deepflow.PointwiseStage)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // float negative_slope = 1;
-  if (this->negative_slope() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(1, this->negative_slope(), output);
+  // .deepflow.PointwiseStage.Op op = 1;
+  if (this->op() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      1, this->op(), output);
   }
 
-  // @@protoc_insertion_point(serialize_end:deepflow.LeakyReluParam)
+  // float coef = 2;
+  if (this->coef() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(2, this->coef(), output);
+  }
+
+  // @@protoc_insertion_point(serialize_end:deepflow.PointwiseStage)
 }
 
-::google::protobuf::uint8* LeakyReluParam::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* PointwiseStage::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:deepflow.LeakyReluParam)
+  // @@protoc_insertion_point(serialize_to_array_start:deepflow.PointwiseStage)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // float negative_slope = 1;
-  if (this->negative_slope() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(1, this->negative_slope(), target);
+  // .deepflow.PointwiseStage.Op op = 1;
+  if (this->op() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
+      1, this->op(), target);
   }
 
-  // @@protoc_insertion_point(serialize_to_array_end:deepflow.LeakyReluParam)
+  // float coef = 2;
+  if (this->coef() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(2, this->coef(), target);
+  }
+
+  // @@protoc_insertion_point(serialize_to_array_end:deepflow.PointwiseStage)
   return target;
 }
 
-size_t LeakyReluParam::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:deepflow.LeakyReluParam)
+size_t PointwiseStage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:deepflow.PointwiseStage)
   size_t total_size = 0;
 
-  // float negative_slope = 1;
-  if (this->negative_slope() != 0) {
+  // .deepflow.PointwiseStage.Op op = 1;
+  if (this->op() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::EnumSize(this->op());
+  }
+
+  // float coef = 2;
+  if (this->coef() != 0) {
     total_size += 1 + 4;
   }
 
@@ -9670,80 +10242,98 @@ size_t LeakyReluParam::ByteSizeLong() const {
   return total_size;
 }
 
-void LeakyReluParam::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:deepflow.LeakyReluParam)
+void PointwiseStage::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:deepflow.PointwiseStage)
   GOOGLE_DCHECK_NE(&from, this);
-  const LeakyReluParam* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const LeakyReluParam>(
+  const PointwiseStage* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const PointwiseStage>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.LeakyReluParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.PointwiseStage)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.LeakyReluParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.PointwiseStage)
     MergeFrom(*source);
   }
 }
 
-void LeakyReluParam::MergeFrom(const LeakyReluParam& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.LeakyReluParam)
+void PointwiseStage::MergeFrom(const PointwiseStage& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.PointwiseStage)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.negative_slope() != 0) {
-    set_negative_slope(from.negative_slope());
+  if (from.op() != 0) {
+    set_op(from.op());
+  }
+  if (from.coef() != 0) {
+    set_coef(from.coef());
   }
 }
 
-void LeakyReluParam::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:deepflow.LeakyReluParam)
+void PointwiseStage::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:deepflow.PointwiseStage)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void LeakyReluParam::CopyFrom(const LeakyReluParam& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.LeakyReluParam)
+void PointwiseStage::CopyFrom(const PointwiseStage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.PointwiseStage)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool LeakyReluParam::IsInitialized() const {
+bool PointwiseStage::IsInitialized() const {
   return true;
 }
 
-void LeakyReluParam::Swap(LeakyReluParam* other) {
+void PointwiseStage::Swap(PointwiseStage* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void LeakyReluParam::InternalSwap(LeakyReluParam* other) {
-  std::swap(negative_slope_, other->negative_slope_);
+void PointwiseStage::InternalSwap(PointwiseStage* other) {
+  std::swap(op_, other->op_);
+  std::swap(coef_, other->coef_);
   std::swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata LeakyReluParam::GetMetadata() const {
+::google::protobuf::Metadata PointwiseStage::GetMetadata() const {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// LeakyReluParam
+// PointwiseStage
 
-// float negative_slope = 1;
-void LeakyReluParam::clear_negative_slope() {
-  negative_slope_ = 0;
+// .deepflow.PointwiseStage.Op op = 1;
+void PointwiseStage::clear_op() {
+  op_ = 0;
 }
-float LeakyReluParam::negative_slope() const {
-  // @@protoc_insertion_point(field_get:deepflow.LeakyReluParam.negative_slope)
-  return negative_slope_;
+::deepflow::PointwiseStage_Op PointwiseStage::op() const {
+  // @@protoc_insertion_point(field_get:deepflow.PointwiseStage.op)
+  return static_cast< ::deepflow::PointwiseStage_Op >(op_);
 }
-void LeakyReluParam::set_negative_slope(float value) {
+void PointwiseStage::set_op(::deepflow::PointwiseStage_Op value) {
   
-  negative_slope_ = value;
-  // @@protoc_insertion_point(field_set:deepflow.LeakyReluParam.negative_slope)
+  op_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.PointwiseStage.op)
+}
+
+// float coef = 2;
+void PointwiseStage::clear_coef() {
+  coef_ = 0;
+}
+float PointwiseStage::coef() const {
+  // @@protoc_insertion_point(field_get:deepflow.PointwiseStage.coef)
+  return coef_;
+}
+void PointwiseStage::set_coef(float value) {
+  
+  coef_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.PointwiseStage.coef)
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -9751,112 +10341,196 @@ void LeakyReluParam::set_negative_slope(float value) {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int EpilogueParam::kBiasFieldNumber;
+const int EpilogueParam::kActivationFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-PReluParam::PReluParam()
+EpilogueParam::EpilogueParam()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_deepflow_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:deepflow.PReluParam)
+  // @@protoc_insertion_point(constructor:deepflow.EpilogueParam)
 }
-PReluParam::PReluParam(const PReluParam& from)
+EpilogueParam::EpilogueParam(const EpilogueParam& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:deepflow.PReluParam)
+  if (from.has_activation()) {
+    activation_ = new ::deepflow::PointwiseStage(*from.activation_);
+  } else {
+    activation_ = NULL;
+  }
+  bias_ = from.bias_;
+  // @@protoc_insertion_point(copy_constructor:deepflow.EpilogueParam)
 }
 
-void PReluParam::SharedCtor() {
+void EpilogueParam::SharedCtor() {
+  ::memset(&activation_, 0, reinterpret_cast<char*>(&bias_) -
+    reinterpret_cast<char*>(&activation_) + sizeof(bias_));
   _cached_size_ = 0;
 }
 
-PReluParam::~PReluParam() {
-  // @@protoc_insertion_point(destructor:deepflow.PReluParam)
+EpilogueParam::~EpilogueParam() {
+  // @@protoc_insertion_point(destructor:deepflow.EpilogueParam)
   SharedDtor();
 }
 
-void PReluParam::SharedDtor() {
+void EpilogueParam::SharedDtor() {
+  if (this != internal_default_instance()) {
+    delete activation_;
+  }
 }
 
-void PReluParam::SetCachedSize(int size) const {
+void EpilogueParam::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* PReluParam::descriptor() {
+const ::google::protobuf::Descriptor* EpilogueParam::descriptor() {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const PReluParam& PReluParam::default_instance() {
+const EpilogueParam& EpilogueParam::default_instance() {
   protobuf_deepflow_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-PReluParam* PReluParam::New(::google::protobuf::Arena* arena) const {
-  PReluParam* n = new PReluParam;
+EpilogueParam* EpilogueParam::New(::google::protobuf::Arena* arena) const {
+  EpilogueParam* n = new EpilogueParam;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void PReluParam::Clear() {
-// @@protoc_insertion_point(message_clear_start:deepflow.PReluParam)
+void EpilogueParam::Clear() {
+// @@protoc_insertion_point(message_clear_start:deepflow.EpilogueParam)
+  if (GetArenaNoVirtual() == NULL && activation_ != NULL) {
+    delete activation_;
+  }
+  activation_ = NULL;
+  bias_ = false;
 }
 
-bool PReluParam::MergePartialFromCodedStream(
+bool EpilogueParam::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:deepflow.PReluParam)
+  // @@protoc_insertion_point(parse_start:deepflow.EpilogueParam)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
     if (!p.second) goto handle_unusual;
-  handle_unusual:
-    if (tag == 0 ||
-        ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-        ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-      goto success;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // bool bias = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(8u)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &bias_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .deepflow.PointwiseStage activation = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(18u)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_activation()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0 ||
+            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
+        break;
+      }
     }
-    DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
   }
 success:
-  // @@protoc_insertion_point(parse_success:deepflow.PReluParam)
+  // @@protoc_insertion_point(parse_success:deepflow.EpilogueParam)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:deepflow.PReluParam)
+  // @@protoc_insertion_point(parse_failure:deepflow.EpilogueParam)
   return false;
 #undef DO_
 }
 
-void PReluParam::SerializeWithCachedSizes(
+void EpilogueParam::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:deepflow.PReluParam)
+  // @@protoc_insertion_point(serialize_start:deepflow.EpilogueParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // @@protoc_insertion_point(serialize_end:deepflow.PReluParam)
+  // bool bias = 1;
+  if (this->bias() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(1, this->bias(), output);
+  }
+
+  // .deepflow.PointwiseStage activation = 2;
+  if (this->has_activation()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      2, *this->activation_, output);
+  }
+
+  // @@protoc_insertion_point(serialize_end:deepflow.EpilogueParam)
 }
 
-::google::protobuf::uint8* PReluParam::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* EpilogueParam::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:deepflow.PReluParam)
+  // @@protoc_insertion_point(serialize_to_array_start:deepflow.EpilogueParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // @@protoc_insertion_point(serialize_to_array_end:deepflow.PReluParam)
+  // bool bias = 1;
+  if (this->bias() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(1, this->bias(), target);
+  }
+
+  // .deepflow.PointwiseStage activation = 2;
+  if (this->has_activation()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        2, *this->activation_, deterministic, target);
+  }
+
+  // @@protoc_insertion_point(serialize_to_array_end:deepflow.EpilogueParam)
   return target;
 }
 
-size_t PReluParam::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:deepflow.PReluParam)
+size_t EpilogueParam::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:deepflow.EpilogueParam)
   size_t total_size = 0;
 
+  // .deepflow.PointwiseStage activation = 2;
+  if (this->has_activation()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        *this->activation_);
+  }
+
+  // bool bias = 1;
+  if (this->bias() != 0) {
+    total_size += 1 + 1;
+  }
+
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = cached_size;
@@ -9864,148 +10538,206 @@ size_t PReluParam::ByteSizeLong() const {
   return total_size;
 }
 
-void PReluParam::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:deepflow.PReluParam)
+void EpilogueParam::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:deepflow.EpilogueParam)
   GOOGLE_DCHECK_NE(&from, this);
-  const PReluParam* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const PReluParam>(
+  const EpilogueParam* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const EpilogueParam>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.PReluParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.EpilogueParam)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.PReluParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.EpilogueParam)
     MergeFrom(*source);
   }
 }
 
-void PReluParam::MergeFrom(const PReluParam& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.PReluParam)
+void EpilogueParam::MergeFrom(const EpilogueParam& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.EpilogueParam)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
+  if (from.has_activation()) {
+    mutable_activation()->::deepflow::PointwiseStage::MergeFrom(from.activation());
+  }
+  if (from.bias() != 0) {
+    set_bias(from.bias());
+  }
 }
 
-void PReluParam::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:deepflow.PReluParam)
+void EpilogueParam::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:deepflow.EpilogueParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void PReluParam::CopyFrom(const PReluParam& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.PReluParam)
+void EpilogueParam::CopyFrom(const EpilogueParam& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.EpilogueParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool PReluParam::IsInitialized() const {
+bool EpilogueParam::IsInitialized() const {
   return true;
 }
 
-void PReluParam::Swap(PReluParam* other) {
+void EpilogueParam::Swap(EpilogueParam* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void PReluParam::InternalSwap(PReluParam* other) {
+void EpilogueParam::InternalSwap(EpilogueParam* other) {
+  std::swap(activation_, other->activation_);
+  std::swap(bias_, other->bias_);
   std::swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata PReluParam::GetMetadata() const {
+::google::protobuf::Metadata EpilogueParam::GetMetadata() const {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// PReluParam
+// EpilogueParam
+
+// bool bias = 1;
+void EpilogueParam::clear_bias() {
+  bias_ = false;
+}
+bool EpilogueParam::bias() const {
+  // @@protoc_insertion_point(field_get:deepflow.EpilogueParam.bias)
+  return bias_;
+}
+void EpilogueParam::set_bias(bool value) {
+  
+  bias_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.EpilogueParam.bias)
+}
+
+// .deepflow.PointwiseStage activation = 2;
+bool EpilogueParam::has_activation() const {
+  return this != internal_default_instance() && activation_ != NULL;
+}
+void EpilogueParam::clear_activation() {
+  if (GetArenaNoVirtual() == NULL && activation_ != NULL) delete activation_;
+  activation_ = NULL;
+}
+const ::deepflow::PointwiseStage& EpilogueParam::activation() const {
+  // @@protoc_insertion_point(field_get:deepflow.EpilogueParam.activation)
+  return activation_ != NULL ? *activation_
+                         : *::deepflow::PointwiseStage::internal_default_instance();
+}
+::deepflow::PointwiseStage* EpilogueParam::mutable_activation() {
+  
+  if (activation_ == NULL) {
+    activation_ = new ::deepflow::PointwiseStage;
+  }
+  // @@protoc_insertion_point(field_mutable:deepflow.EpilogueParam.activation)
+  return activation_;
+}
+::deepflow::PointwiseStage* EpilogueParam::release_activation() {
+  // @@protoc_insertion_point(field_release:deepflow.EpilogueParam.activation)
+  
+  ::deepflow::PointwiseStage* temp = activation_;
+  activation_ = NULL;
+  return temp;
+}
+void EpilogueParam::set_allocated_activation(::deepflow::PointwiseStage* activation) {
+  delete activation_;
+  activation_ = activation;
+  if (activation) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:deepflow.EpilogueParam.activation)
+}
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int DPReluParam::kNegativeSlopeFieldNumber;
+const int FusedElementwiseParam::kStageFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-DPReluParam::DPReluParam()
+FusedElementwiseParam::FusedElementwiseParam()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_deepflow_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:deepflow.DPReluParam)
+  // @@protoc_insertion_point(constructor:deepflow.FusedElementwiseParam)
 }
-DPReluParam::DPReluParam(const DPReluParam& from)
+FusedElementwiseParam::FusedElementwiseParam(const FusedElementwiseParam& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
+      stage_(from.stage_),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
-  negative_slope_ = from.negative_slope_;
-  // @@protoc_insertion_point(copy_constructor:deepflow.DPReluParam)
+  // @@protoc_insertion_point(copy_constructor:deepflow.FusedElementwiseParam)
 }
 
-void DPReluParam::SharedCtor() {
-  negative_slope_ = 0;
+void FusedElementwiseParam::SharedCtor() {
   _cached_size_ = 0;
 }
 
-DPReluParam::~DPReluParam() {
-  // @@protoc_insertion_point(destructor:deepflow.DPReluParam)
+FusedElementwiseParam::~FusedElementwiseParam() {
+  // @@protoc_insertion_point(destructor:deepflow.FusedElementwiseParam)
   SharedDtor();
 }
 
-void DPReluParam::SharedDtor() {
+void FusedElementwiseParam::SharedDtor() {
 }
 
-void DPReluParam::SetCachedSize(int size) const {
+void FusedElementwiseParam::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* DPReluParam::descriptor() {
+const ::google::protobuf::Descriptor* FusedElementwiseParam::descriptor() {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const DPReluParam& DPReluParam::default_instance() {
+const FusedElementwiseParam& FusedElementwiseParam::default_instance() {
   protobuf_deepflow_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-DPReluParam* DPReluParam::New(::google::protobuf::Arena* arena) const {
-  DPReluParam* n = new DPReluParam;
+FusedElementwiseParam* FusedElementwiseParam::New(::google::protobuf::Arena* arena) const {
+  FusedElementwiseParam* n = new FusedElementwiseParam;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void DPReluParam::Clear() {
-// @@protoc_insertion_point(message_clear_start:deepflow.DPReluParam)
-  negative_slope_ = 0;
+void FusedElementwiseParam::Clear() {
+// @@protoc_insertion_point(message_clear_start:deepflow.FusedElementwiseParam)
+  stage_.Clear();
 }
 
-bool DPReluParam::MergePartialFromCodedStream(
+bool FusedElementwiseParam::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:deepflow.DPReluParam)
+  // @@protoc_insertion_point(parse_start:deepflow.FusedElementwiseParam)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // float negative_slope = 1;
+      // repeated .deepflow.PointwiseStage stage = 1;
       case 1: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(13u)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &negative_slope_)));
+            static_cast< ::google::protobuf::uint8>(10u)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+                input, add_stage()));
         } else {
           goto handle_unusual;
         }
@@ -10025,50 +10757,59 @@ bool DPReluParam::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:deepflow.DPReluParam)
+  // @@protoc_insertion_point(parse_success:deepflow.FusedElementwiseParam)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:deepflow.DPReluParam)
+  // @@protoc_insertion_point(parse_failure:deepflow.FusedElementwiseParam)
   return false;
 #undef DO_
 }
 
-void DPReluParam::SerializeWithCachedSizes(
+void FusedElementwiseParam::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:deepflow.DPReluParam)
+  // @@protoc_insertion_point(serialize_start:deepflow.FusedElementwiseParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // float negative_slope = 1;
-  if (this->negative_slope() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(1, this->negative_slope(), output);
+  // repeated .deepflow.PointwiseStage stage = 1;
+  for (unsigned int i = 0, n = this->stage_size(); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      1, this->stage(i), output);
   }
 
-  // @@protoc_insertion_point(serialize_end:deepflow.DPReluParam)
+  // @@protoc_insertion_point(serialize_end:deepflow.FusedElementwiseParam)
 }
 
-::google::protobuf::uint8* DPReluParam::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* FusedElementwiseParam::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:deepflow.DPReluParam)
+  // @@protoc_insertion_point(serialize_to_array_start:deepflow.FusedElementwiseParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // float negative_slope = 1;
-  if (this->negative_slope() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(1, this->negative_slope(), target);
+  // repeated .deepflow.PointwiseStage stage = 1;
+  for (unsigned int i = 0, n = this->stage_size(); i < n; i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        1, this->stage(i), deterministic, target);
   }
 
-  // @@protoc_insertion_point(serialize_to_array_end:deepflow.DPReluParam)
+  // @@protoc_insertion_point(serialize_to_array_end:deepflow.FusedElementwiseParam)
   return target;
 }
 
-size_t DPReluParam::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:deepflow.DPReluParam)
+size_t FusedElementwiseParam::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:deepflow.FusedElementwiseParam)
   size_t total_size = 0;
 
-  // float negative_slope = 1;
-  if (this->negative_slope() != 0) {
-    total_size += 1 + 4;
+  // repeated .deepflow.PointwiseStage stage = 1;
+  {
+    unsigned int count = this->stage_size();
+    total_size += 1UL * count;
+    for (unsigned int i = 0; i < count; i++) {
+      total_size +=
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->stage(i));
+    }
   }
 
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
@@ -10078,80 +10819,94 @@ size_t DPReluParam::ByteSizeLong() const {
   return total_size;
 }
 
-void DPReluParam::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:deepflow.DPReluParam)
+void FusedElementwiseParam::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:deepflow.FusedElementwiseParam)
   GOOGLE_DCHECK_NE(&from, this);
-  const DPReluParam* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const DPReluParam>(
+  const FusedElementwiseParam* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const FusedElementwiseParam>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.DPReluParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.FusedElementwiseParam)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.DPReluParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.FusedElementwiseParam)
     MergeFrom(*source);
   }
 }
 
-void DPReluParam::MergeFrom(const DPReluParam& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.DPReluParam)
+void FusedElementwiseParam::MergeFrom(const FusedElementwiseParam& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.FusedElementwiseParam)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.negative_slope() != 0) {
-    set_negative_slope(from.negative_slope());
-  }
+  stage_.MergeFrom(from.stage_);
 }
 
-void DPReluParam::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:deepflow.DPReluParam)
+void FusedElementwiseParam::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:deepflow.FusedElementwiseParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void DPReluParam::CopyFrom(const DPReluParam& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.DPReluParam)
+void FusedElementwiseParam::CopyFrom(const FusedElementwiseParam& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.FusedElementwiseParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool DPReluParam::IsInitialized() const {
+bool FusedElementwiseParam::IsInitialized() const {
   return true;
 }
 
-void DPReluParam::Swap(DPReluParam* other) {
+void FusedElementwiseParam::Swap(FusedElementwiseParam* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void DPReluParam::InternalSwap(DPReluParam* other) {
-  std::swap(negative_slope_, other->negative_slope_);
+void FusedElementwiseParam::InternalSwap(FusedElementwiseParam* other) {
+  stage_.InternalSwap(&other->stage_);
   std::swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata DPReluParam::GetMetadata() const {
+::google::protobuf::Metadata FusedElementwiseParam::GetMetadata() const {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// DPReluParam
+// FusedElementwiseParam
 
-// float negative_slope = 1;
-void DPReluParam::clear_negative_slope() {
-  negative_slope_ = 0;
+// repeated .deepflow.PointwiseStage stage = 1;
+int FusedElementwiseParam::stage_size() const {
+  return stage_.size();
 }
-float DPReluParam::negative_slope() const {
-  // @@protoc_insertion_point(field_get:deepflow.DPReluParam.negative_slope)
-  return negative_slope_;
+void FusedElementwiseParam::clear_stage() {
+  stage_.Clear();
 }
-void DPReluParam::set_negative_slope(float value) {
-  
-  negative_slope_ = value;
-  // @@protoc_insertion_point(field_set:deepflow.DPReluParam.negative_slope)
+const ::deepflow::PointwiseStage& FusedElementwiseParam::stage(int index) const {
+  // @@protoc_insertion_point(field_get:deepflow.FusedElementwiseParam.stage)
+  return stage_.Get(index);
+}
+::deepflow::PointwiseStage* FusedElementwiseParam::mutable_stage(int index) {
+  // @@protoc_insertion_point(field_mutable:deepflow.FusedElementwiseParam.stage)
+  return stage_.Mutable(index);
+}
+::deepflow::PointwiseStage* FusedElementwiseParam::add_stage() {
+  // @@protoc_insertion_point(field_add:deepflow.FusedElementwiseParam.stage)
+  return stage_.Add();
+}
+::google::protobuf::RepeatedPtrField< ::deepflow::PointwiseStage >*
+FusedElementwiseParam::mutable_stage() {
+  // @@protoc_insertion_point(field_mutable_list:deepflow.FusedElementwiseParam.stage)
+  return &stage_;
+}
+const ::google::protobuf::RepeatedPtrField< ::deepflow::PointwiseStage >&
+FusedElementwiseParam::stage() const {
+  // @@protoc_insertion_point(field_list:deepflow.FusedElementwiseParam.stage)
+  return stage_;
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -10159,154 +10914,112 @@ void DPReluParam::set_negative_slope(float value) {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int ReduceAllParam::kReduceOpFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-ReduceAllParam::ReduceAllParam()
+ReorderParam::ReorderParam()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_deepflow_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:deepflow.ReduceAllParam)
+  // @@protoc_insertion_point(constructor:deepflow.ReorderParam)
 }
-ReduceAllParam::ReduceAllParam(const ReduceAllParam& from)
+ReorderParam::ReorderParam(const ReorderParam& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
-  reduce_op_ = from.reduce_op_;
-  // @@protoc_insertion_point(copy_constructor:deepflow.ReduceAllParam)
+  // @@protoc_insertion_point(copy_constructor:deepflow.ReorderParam)
 }
 
-void ReduceAllParam::SharedCtor() {
-  reduce_op_ = 0;
+void ReorderParam::SharedCtor() {
   _cached_size_ = 0;
 }
 
-ReduceAllParam::~ReduceAllParam() {
-  // @@protoc_insertion_point(destructor:deepflow.ReduceAllParam)
+ReorderParam::~ReorderParam() {
+  // @@protoc_insertion_point(destructor:deepflow.ReorderParam)
   SharedDtor();
 }
 
-void ReduceAllParam::SharedDtor() {
+void ReorderParam::SharedDtor() {
 }
 
-void ReduceAllParam::SetCachedSize(int size) const {
+void ReorderParam::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* ReduceAllParam::descriptor() {
+const ::google::protobuf::Descriptor* ReorderParam::descriptor() {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const ReduceAllParam& ReduceAllParam::default_instance() {
+const ReorderParam& ReorderParam::default_instance() {
   protobuf_deepflow_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-ReduceAllParam* ReduceAllParam::New(::google::protobuf::Arena* arena) const {
-  ReduceAllParam* n = new ReduceAllParam;
+ReorderParam* ReorderParam::New(::google::protobuf::Arena* arena) const {
+  ReorderParam* n = new ReorderParam;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void ReduceAllParam::Clear() {
-// @@protoc_insertion_point(message_clear_start:deepflow.ReduceAllParam)
-  reduce_op_ = 0;
+void ReorderParam::Clear() {
+// @@protoc_insertion_point(message_clear_start:deepflow.ReorderParam)
 }
 
-bool ReduceAllParam::MergePartialFromCodedStream(
+bool ReorderParam::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:deepflow.ReduceAllParam)
+  // @@protoc_insertion_point(parse_start:deepflow.ReorderParam)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
     if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // .deepflow.ReduceAllParam.ReduceAllOp reduce_op = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u)) {
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          set_reduce_op(static_cast< ::deepflow::ReduceAllParam_ReduceAllOp >(value));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-        break;
-      }
+  handle_unusual:
+    if (tag == 0 ||
+        ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+        ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+      goto success;
     }
+    DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
   }
 success:
-  // @@protoc_insertion_point(parse_success:deepflow.ReduceAllParam)
+  // @@protoc_insertion_point(parse_success:deepflow.ReorderParam)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:deepflow.ReduceAllParam)
+  // @@protoc_insertion_point(parse_failure:deepflow.ReorderParam)
   return false;
 #undef DO_
 }
 
-void ReduceAllParam::SerializeWithCachedSizes(
+void ReorderParam::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:deepflow.ReduceAllParam)
+  // @@protoc_insertion_point(serialize_start:deepflow.ReorderParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .deepflow.ReduceAllParam.ReduceAllOp reduce_op = 1;
-  if (this->reduce_op() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      1, this->reduce_op(), output);
-  }
-
-  // @@protoc_insertion_point(serialize_end:deepflow.ReduceAllParam)
+  // @@protoc_insertion_point(serialize_end:deepflow.ReorderParam)
 }
 
-::google::protobuf::uint8* ReduceAllParam::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* ReorderParam::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:deepflow.ReduceAllParam)
+  // @@protoc_insertion_point(serialize_to_array_start:deepflow.ReorderParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .deepflow.ReduceAllParam.ReduceAllOp reduce_op = 1;
-  if (this->reduce_op() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      1, this->reduce_op(), target);
-  }
-
-  // @@protoc_insertion_point(serialize_to_array_end:deepflow.ReduceAllParam)
+  // @@protoc_insertion_point(serialize_to_array_end:deepflow.ReorderParam)
   return target;
 }
 
-size_t ReduceAllParam::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:deepflow.ReduceAllParam)
+size_t ReorderParam::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:deepflow.ReorderParam)
   size_t total_size = 0;
 
-  // .deepflow.ReduceAllParam.ReduceAllOp reduce_op = 1;
-  if (this->reduce_op() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::EnumSize(this->reduce_op());
-  }
-
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = cached_size;
@@ -10314,202 +11027,182 @@ size_t ReduceAllParam::ByteSizeLong() const {
   return total_size;
 }
 
-void ReduceAllParam::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:deepflow.ReduceAllParam)
+void ReorderParam::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:deepflow.ReorderParam)
   GOOGLE_DCHECK_NE(&from, this);
-  const ReduceAllParam* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const ReduceAllParam>(
+  const ReorderParam* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const ReorderParam>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.ReduceAllParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.ReorderParam)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.ReduceAllParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.ReorderParam)
     MergeFrom(*source);
   }
 }
 
-void ReduceAllParam::MergeFrom(const ReduceAllParam& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.ReduceAllParam)
+void ReorderParam::MergeFrom(const ReorderParam& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.ReorderParam)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.reduce_op() != 0) {
-    set_reduce_op(from.reduce_op());
-  }
 }
 
-void ReduceAllParam::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:deepflow.ReduceAllParam)
+void ReorderParam::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:deepflow.ReorderParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void ReduceAllParam::CopyFrom(const ReduceAllParam& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.ReduceAllParam)
+void ReorderParam::CopyFrom(const ReorderParam& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.ReorderParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool ReduceAllParam::IsInitialized() const {
+bool ReorderParam::IsInitialized() const {
   return true;
 }
 
-void ReduceAllParam::Swap(ReduceAllParam* other) {
+void ReorderParam::Swap(ReorderParam* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void ReduceAllParam::InternalSwap(ReduceAllParam* other) {
-  std::swap(reduce_op_, other->reduce_op_);
+void ReorderParam::InternalSwap(ReorderParam* other) {
   std::swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata ReduceAllParam::GetMetadata() const {
+::google::protobuf::Metadata ReorderParam::GetMetadata() const {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// ReduceAllParam
-
-// .deepflow.ReduceAllParam.ReduceAllOp reduce_op = 1;
-void ReduceAllParam::clear_reduce_op() {
-  reduce_op_ = 0;
-}
-::deepflow::ReduceAllParam_ReduceAllOp ReduceAllParam::reduce_op() const {
-  // @@protoc_insertion_point(field_get:deepflow.ReduceAllParam.reduce_op)
-  return static_cast< ::deepflow::ReduceAllParam_ReduceAllOp >(reduce_op_);
-}
-void ReduceAllParam::set_reduce_op(::deepflow::ReduceAllParam_ReduceAllOp value) {
-  
-  reduce_op_ = value;
-  // @@protoc_insertion_point(field_set:deepflow.ReduceAllParam.reduce_op)
-}
+// ReorderParam
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int ReduceParam::kReduceOpFieldNumber;
-const int ReduceParam::kReduceDimFieldNumber;
-const int ReduceParam::kOutputTypeFieldNumber;
+const int SliceParam::kDimFieldNumber;
+const int SliceParam::kBeginFieldNumber;
+const int SliceParam::kSizeFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-ReduceParam::ReduceParam()
+SliceParam::SliceParam()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_deepflow_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:deepflow.ReduceParam)
+  // @@protoc_insertion_point(constructor:deepflow.SliceParam)
 }
-ReduceParam::ReduceParam(const ReduceParam& from)
+SliceParam::SliceParam(const SliceParam& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::memcpy(&reduce_op_, &from.reduce_op_,
-    reinterpret_cast<char*>(&output_type_) -
-    reinterpret_cast<char*>(&reduce_op_) + sizeof(output_type_));
-  // @@protoc_insertion_point(copy_constructor:deepflow.ReduceParam)
+  ::memcpy(&dim_, &from.dim_,
+    reinterpret_cast<char*>(&size_) -
+    reinterpret_cast<char*>(&dim_) + sizeof(size_));
+  // @@protoc_insertion_point(copy_constructor:deepflow.SliceParam)
 }
 
-void ReduceParam::SharedCtor() {
-  ::memset(&reduce_op_, 0, reinterpret_cast<char*>(&output_type_) -
-    reinterpret_cast<char*>(&reduce_op_) + sizeof(output_type_));
+void SliceParam::SharedCtor() {
+  ::memset(&dim_, 0, reinterpret_cast<char*>(&size_) -
+    reinterpret_cast<char*>(&dim_) + sizeof(size_));
   _cached_size_ = 0;
 }
 
-ReduceParam::~ReduceParam() {
-  // @@protoc_insertion_point(destructor:deepflow.ReduceParam)
+SliceParam::~SliceParam() {
+  // @@protoc_insertion_point(destructor:deepflow.SliceParam)
   SharedDtor();
 }
 
-void ReduceParam::SharedDtor() {
+void SliceParam::SharedDtor() {
 }
 
-void ReduceParam::SetCachedSize(int size) const {
+void SliceParam::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* ReduceParam::descriptor() {
+const ::google::protobuf::Descriptor* SliceParam::descriptor() {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const ReduceParam& ReduceParam::default_instance() {
+const SliceParam& SliceParam::default_instance() {
   protobuf_deepflow_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-ReduceParam* ReduceParam::New(::google::protobuf::Arena* arena) const {
-  ReduceParam* n = new ReduceParam;
+SliceParam* SliceParam::New(::google::protobuf::Arena* arena) const {
+  SliceParam* n = new SliceParam;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void ReduceParam::Clear() {
-// @@protoc_insertion_point(message_clear_start:deepflow.ReduceParam)
-  ::memset(&reduce_op_, 0, reinterpret_cast<char*>(&output_type_) -
-    reinterpret_cast<char*>(&reduce_op_) + sizeof(output_type_));
+void SliceParam::Clear() {
+// @@protoc_insertion_point(message_clear_start:deepflow.SliceParam)
+  ::memset(&dim_, 0, reinterpret_cast<char*>(&size_) -
+    reinterpret_cast<char*>(&dim_) + sizeof(size_));
 }
 
-bool ReduceParam::MergePartialFromCodedStream(
+bool SliceParam::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:deepflow.ReduceParam)
+  // @@protoc_insertion_point(parse_start:deepflow.SliceParam)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // .deepflow.ReduceParam.ReduceOp reduce_op = 1;
+      // int32 dim = 1;
       case 1: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
             static_cast< ::google::protobuf::uint8>(8u)) {
-          int value;
+
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          set_reduce_op(static_cast< ::deepflow::ReduceParam_ReduceOp >(value));
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &dim_)));
         } else {
           goto handle_unusual;
         }
         break;
       }
 
-      // int32 reduce_dim = 2;
+      // int32 begin = 2;
       case 2: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
             static_cast< ::google::protobuf::uint8>(16u)) {
 
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
                    ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &reduce_dim_)));
+                 input, &begin_)));
         } else {
           goto handle_unusual;
         }
         break;
       }
 
-      // .deepflow.ReduceParam.OutputType output_type = 3;
+      // int32 size = 3;
       case 3: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
             static_cast< ::google::protobuf::uint8>(24u)) {
-          int value;
+
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          set_output_type(static_cast< ::deepflow::ReduceParam_OutputType >(value));
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &size_)));
         } else {
           goto handle_unusual;
         }
@@ -10529,88 +11222,86 @@ bool ReduceParam::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:deepflow.ReduceParam)
+  // @@protoc_insertion_point(parse_success:deepflow.SliceParam)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:deepflow.ReduceParam)
+  // @@protoc_insertion_point(parse_failure:deepflow.SliceParam)
   return false;
 #undef DO_
 }
 
-void ReduceParam::SerializeWithCachedSizes(
+void SliceParam::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:deepflow.ReduceParam)
+  // @@protoc_insertion_point(serialize_start:deepflow.SliceParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .deepflow.ReduceParam.ReduceOp reduce_op = 1;
-  if (this->reduce_op() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      1, this->reduce_op(), output);
+  // int32 dim = 1;
+  if (this->dim() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->dim(), output);
   }
 
-  // int32 reduce_dim = 2;
-  if (this->reduce_dim() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(2, this->reduce_dim(), output);
+  // int32 begin = 2;
+  if (this->begin() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(2, this->begin(), output);
   }
 
-  // .deepflow.ReduceParam.OutputType output_type = 3;
-  if (this->output_type() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      3, this->output_type(), output);
+  // int32 size = 3;
+  if (this->size() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(3, this->size(), output);
   }
 
-  // @@protoc_insertion_point(serialize_end:deepflow.ReduceParam)
+  // @@protoc_insertion_point(serialize_end:deepflow.SliceParam)
 }
 
-::google::protobuf::uint8* ReduceParam::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* SliceParam::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:deepflow.ReduceParam)
+  // @@protoc_insertion_point(serialize_to_array_start:deepflow.SliceParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .deepflow.ReduceParam.ReduceOp reduce_op = 1;
-  if (this->reduce_op() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      1, this->reduce_op(), target);
+  // int32 dim = 1;
+  if (this->dim() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->dim(), target);
   }
 
-  // int32 reduce_dim = 2;
-  if (this->reduce_dim() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(2, this->reduce_dim(), target);
+  // int32 begin = 2;
+  if (this->begin() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(2, this->begin(), target);
   }
 
-  // .deepflow.ReduceParam.OutputType output_type = 3;
-  if (this->output_type() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      3, this->output_type(), target);
+  // int32 size = 3;
+  if (this->size() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(3, this->size(), target);
   }
 
-  // @@protoc_insertion_point(serialize_to_array_end:deepflow.ReduceParam)
+  // @@protoc_insertion_point(serialize_to_array_end:deepflow.SliceParam)
   return target;
 }
 
-size_t ReduceParam::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:deepflow.ReduceParam)
+size_t SliceParam::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:deepflow.SliceParam)
   size_t total_size = 0;
 
-  // .deepflow.ReduceParam.ReduceOp reduce_op = 1;
-  if (this->reduce_op() != 0) {
+  // int32 dim = 1;
+  if (this->dim() != 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::EnumSize(this->reduce_op());
+      ::google::protobuf::internal::WireFormatLite::Int32Size(
+        this->dim());
   }
 
-  // int32 reduce_dim = 2;
-  if (this->reduce_dim() != 0) {
+  // int32 begin = 2;
+  if (this->begin() != 0) {
     total_size += 1 +
       ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->reduce_dim());
+        this->begin());
   }
 
-  // .deepflow.ReduceParam.OutputType output_type = 3;
-  if (this->output_type() != 0) {
+  // int32 size = 3;
+  if (this->size() != 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::EnumSize(this->output_type());
+      ::google::protobuf::internal::WireFormatLite::Int32Size(
+        this->size());
   }
 
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
@@ -10620,116 +11311,116 @@ size_t ReduceParam::ByteSizeLong() const {
   return total_size;
 }
 
-void ReduceParam::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:deepflow.ReduceParam)
+void SliceParam::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:deepflow.SliceParam)
   GOOGLE_DCHECK_NE(&from, this);
-  const ReduceParam* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const ReduceParam>(
+  const SliceParam* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const SliceParam>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.ReduceParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.SliceParam)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.ReduceParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.SliceParam)
     MergeFrom(*source);
   }
 }
 
-void ReduceParam::MergeFrom(const ReduceParam& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.ReduceParam)
+void SliceParam::MergeFrom(const SliceParam& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.SliceParam)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.reduce_op() != 0) {
-    set_reduce_op(from.reduce_op());
+  if (from.dim() != 0) {
+    set_dim(from.dim());
   }
-  if (from.reduce_dim() != 0) {
-    set_reduce_dim(from.reduce_dim());
+  if (from.begin() != 0) {
+    set_begin(from.begin());
   }
-  if (from.output_type() != 0) {
-    set_output_type(from.output_type());
+  if (from.size() != 0) {
+    set_size(from.size());
   }
 }
 
-void ReduceParam::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:deepflow.ReduceParam)
+void SliceParam::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:deepflow.SliceParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void ReduceParam::CopyFrom(const ReduceParam& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.ReduceParam)
+void SliceParam::CopyFrom(const SliceParam& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.SliceParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool ReduceParam::IsInitialized() const {
+bool SliceParam::IsInitialized() const {
   return true;
 }
 
-void ReduceParam::Swap(ReduceParam* other) {
+void SliceParam::Swap(SliceParam* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void ReduceParam::InternalSwap(ReduceParam* other) {
-  std::swap(reduce_op_, other->reduce_op_);
-  std::swap(reduce_dim_, other->reduce_dim_);
-  std::swap(output_type_, other->output_type_);
+void SliceParam::InternalSwap(SliceParam* other) {
+  std::swap(dim_, other->dim_);
+  std::swap(begin_, other->begin_);
+  std::swap(size_, other->size_);
   std::swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata ReduceParam::GetMetadata() const {
+::google::protobuf::Metadata SliceParam::GetMetadata() const {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// ReduceParam
+// SliceParam
 
-// .deepflow.ReduceParam.ReduceOp reduce_op = 1;
-void ReduceParam::clear_reduce_op() {
-  reduce_op_ = 0;
+// int32 dim = 1;
+void SliceParam::clear_dim() {
+  dim_ = 0;
 }
-::deepflow::ReduceParam_ReduceOp ReduceParam::reduce_op() const {
-  // @@protoc_insertion_point(field_get:deepflow.ReduceParam.reduce_op)
-  return static_cast< ::deepflow::ReduceParam_ReduceOp >(reduce_op_);
+::google::protobuf::int32 SliceParam::dim() const {
+  // @@protoc_insertion_point(field_get:deepflow.SliceParam.dim)
+  return dim_;
 }
-void ReduceParam::set_reduce_op(::deepflow::ReduceParam_ReduceOp value) {
+void SliceParam::set_dim(::google::protobuf::int32 value) {
   
-  reduce_op_ = value;
-  // @@protoc_insertion_point(field_set:deepflow.ReduceParam.reduce_op)
+  dim_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.SliceParam.dim)
 }
 
-// int32 reduce_dim = 2;
-void ReduceParam::clear_reduce_dim() {
-  reduce_dim_ = 0;
+// int32 begin = 2;
+void SliceParam::clear_begin() {
+  begin_ = 0;
 }
-::google::protobuf::int32 ReduceParam::reduce_dim() const {
-  // @@protoc_insertion_point(field_get:deepflow.ReduceParam.reduce_dim)
-  return reduce_dim_;
+::google::protobuf::int32 SliceParam::begin() const {
+  // @@protoc_insertion_point(field_get:deepflow.SliceParam.begin)
+  return begin_;
 }
-void ReduceParam::set_reduce_dim(::google::protobuf::int32 value) {
+void SliceParam::set_begin(::google::protobuf::int32 value) {
   
-  reduce_dim_ = value;
-  // @@protoc_insertion_point(field_set:deepflow.ReduceParam.reduce_dim)
+  begin_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.SliceParam.begin)
 }
 
-// .deepflow.ReduceParam.OutputType output_type = 3;
-void ReduceParam::clear_output_type() {
-  output_type_ = 0;
+// int32 size = 3;
+void SliceParam::clear_size() {
+  size_ = 0;
 }
-::deepflow::ReduceParam_OutputType ReduceParam::output_type() const {
-  // @@protoc_insertion_point(field_get:deepflow.ReduceParam.output_type)
-  return static_cast< ::deepflow::ReduceParam_OutputType >(output_type_);
+::google::protobuf::int32 SliceParam::size() const {
+  // @@protoc_insertion_point(field_get:deepflow.SliceParam.size)
+  return size_;
 }
-void ReduceParam::set_output_type(::deepflow::ReduceParam_OutputType value) {
+void SliceParam::set_size(::google::protobuf::int32 value) {
   
-  output_type_ = value;
-  // @@protoc_insertion_point(field_set:deepflow.ReduceParam.output_type)
+  size_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.SliceParam.size)
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -10737,143 +11428,85 @@ void ReduceParam::set_output_type(::deepflow::ReduceParam_OutputType value) {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int SnapshotParam::kSnapshotIntervalFieldNumber;
-const int SnapshotParam::kSnapshotPrefixFieldNumber;
-const int SnapshotParam::kPerImageHeightFieldNumber;
-const int SnapshotParam::kPerImageWidthFieldNumber;
+const int LeakyReluParam::kNegativeSlopeFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-SnapshotParam::SnapshotParam()
+LeakyReluParam::LeakyReluParam()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_deepflow_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:deepflow.SnapshotParam)
+  // @@protoc_insertion_point(constructor:deepflow.LeakyReluParam)
 }
-SnapshotParam::SnapshotParam(const SnapshotParam& from)
+LeakyReluParam::LeakyReluParam(const LeakyReluParam& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
-  snapshot_prefix_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.snapshot_prefix().size() > 0) {
-    snapshot_prefix_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.snapshot_prefix_);
-  }
-  ::memcpy(&snapshot_interval_, &from.snapshot_interval_,
-    reinterpret_cast<char*>(&per_image_width_) -
-    reinterpret_cast<char*>(&snapshot_interval_) + sizeof(per_image_width_));
-  // @@protoc_insertion_point(copy_constructor:deepflow.SnapshotParam)
+  negative_slope_ = from.negative_slope_;
+  // @@protoc_insertion_point(copy_constructor:deepflow.LeakyReluParam)
 }
 
-void SnapshotParam::SharedCtor() {
-  snapshot_prefix_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&snapshot_interval_, 0, reinterpret_cast<char*>(&per_image_width_) -
-    reinterpret_cast<char*>(&snapshot_interval_) + sizeof(per_image_width_));
+void LeakyReluParam::SharedCtor() {
+  negative_slope_ = 0;
   _cached_size_ = 0;
 }
 
-SnapshotParam::~SnapshotParam() {
-  // @@protoc_insertion_point(destructor:deepflow.SnapshotParam)
+LeakyReluParam::~LeakyReluParam() {
+  // @@protoc_insertion_point(destructor:deepflow.LeakyReluParam)
   SharedDtor();
 }
 
-void SnapshotParam::SharedDtor() {
-  snapshot_prefix_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+void LeakyReluParam::SharedDtor() {
 }
 
-void SnapshotParam::SetCachedSize(int size) const {
+void LeakyReluParam::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* SnapshotParam::descriptor() {
+const ::google::protobuf::Descriptor* LeakyReluParam::descriptor() {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const SnapshotParam& SnapshotParam::default_instance() {
+const LeakyReluParam& LeakyReluParam::default_instance() {
   protobuf_deepflow_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-SnapshotParam* SnapshotParam::New(::google::protobuf::Arena* arena) const {
-  SnapshotParam* n = new SnapshotParam;
+LeakyReluParam* LeakyReluParam::New(::google::protobuf::Arena* arena) const {
+  LeakyReluParam* n = new LeakyReluParam;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void SnapshotParam::Clear() {
-// @@protoc_insertion_point(message_clear_start:deepflow.SnapshotParam)
-  snapshot_prefix_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&snapshot_interval_, 0, reinterpret_cast<char*>(&per_image_width_) -
-    reinterpret_cast<char*>(&snapshot_interval_) + sizeof(per_image_width_));
+void LeakyReluParam::Clear() {
+// @@protoc_insertion_point(message_clear_start:deepflow.LeakyReluParam)
+  negative_slope_ = 0;
 }
 
-bool SnapshotParam::MergePartialFromCodedStream(
+bool LeakyReluParam::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:deepflow.SnapshotParam)
+  // @@protoc_insertion_point(parse_start:deepflow.LeakyReluParam)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // int32 snapshot_interval = 1;
+      // float negative_slope = 1;
       case 1: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &snapshot_interval_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // string snapshot_prefix = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_snapshot_prefix()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->snapshot_prefix().data(), this->snapshot_prefix().length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "deepflow.SnapshotParam.snapshot_prefix"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // int32 per_image_height = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(24u)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &per_image_height_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // int32 per_image_width = 4;
-      case 4: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(32u)) {
+            static_cast< ::google::protobuf::uint8>(13u)) {
 
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &per_image_width_)));
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, &negative_slope_)));
         } else {
           goto handle_unusual;
         }
@@ -10893,114 +11526,50 @@ bool SnapshotParam::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:deepflow.SnapshotParam)
+  // @@protoc_insertion_point(parse_success:deepflow.LeakyReluParam)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:deepflow.SnapshotParam)
+  // @@protoc_insertion_point(parse_failure:deepflow.LeakyReluParam)
   return false;
 #undef DO_
 }
 
-void SnapshotParam::SerializeWithCachedSizes(
+void LeakyReluParam::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:deepflow.SnapshotParam)
+  // @@protoc_insertion_point(serialize_start:deepflow.LeakyReluParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // int32 snapshot_interval = 1;
-  if (this->snapshot_interval() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->snapshot_interval(), output);
-  }
-
-  // string snapshot_prefix = 2;
-  if (this->snapshot_prefix().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->snapshot_prefix().data(), this->snapshot_prefix().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "deepflow.SnapshotParam.snapshot_prefix");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->snapshot_prefix(), output);
-  }
-
-  // int32 per_image_height = 3;
-  if (this->per_image_height() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(3, this->per_image_height(), output);
-  }
-
-  // int32 per_image_width = 4;
-  if (this->per_image_width() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(4, this->per_image_width(), output);
+  // float negative_slope = 1;
+  if (this->negative_slope() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(1, this->negative_slope(), output);
   }
 
-  // @@protoc_insertion_point(serialize_end:deepflow.SnapshotParam)
+  // @@protoc_insertion_point(serialize_end:deepflow.LeakyReluParam)
 }
 
-::google::protobuf::uint8* SnapshotParam::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* LeakyReluParam::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:deepflow.SnapshotParam)
+  // @@protoc_insertion_point(serialize_to_array_start:deepflow.LeakyReluParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // int32 snapshot_interval = 1;
-  if (this->snapshot_interval() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->snapshot_interval(), target);
-  }
-
-  // string snapshot_prefix = 2;
-  if (this->snapshot_prefix().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->snapshot_prefix().data(), this->snapshot_prefix().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "deepflow.SnapshotParam.snapshot_prefix");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->snapshot_prefix(), target);
-  }
-
-  // int32 per_image_height = 3;
-  if (this->per_image_height() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(3, this->per_image_height(), target);
-  }
-
-  // int32 per_image_width = 4;
-  if (this->per_image_width() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(4, this->per_image_width(), target);
+  // float negative_slope = 1;
+  if (this->negative_slope() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(1, this->negative_slope(), target);
   }
 
-  // @@protoc_insertion_point(serialize_to_array_end:deepflow.SnapshotParam)
+  // @@protoc_insertion_point(serialize_to_array_end:deepflow.LeakyReluParam)
   return target;
 }
 
-size_t SnapshotParam::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:deepflow.SnapshotParam)
+size_t LeakyReluParam::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:deepflow.LeakyReluParam)
   size_t total_size = 0;
 
-  // string snapshot_prefix = 2;
-  if (this->snapshot_prefix().size() > 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->snapshot_prefix());
-  }
-
-  // int32 snapshot_interval = 1;
-  if (this->snapshot_interval() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->snapshot_interval());
-  }
-
-  // int32 per_image_height = 3;
-  if (this->per_image_height() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->per_image_height());
-  }
-
-  // int32 per_image_width = 4;
-  if (this->per_image_width() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->per_image_width());
+  // float negative_slope = 1;
+  if (this->negative_slope() != 0) {
+    total_size += 1 + 4;
   }
 
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
@@ -11010,268 +11579,342 @@ size_t SnapshotParam::ByteSizeLong() const {
   return total_size;
 }
 
-void SnapshotParam::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:deepflow.SnapshotParam)
+void LeakyReluParam::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:deepflow.LeakyReluParam)
   GOOGLE_DCHECK_NE(&from, this);
-  const SnapshotParam* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const SnapshotParam>(
+  const LeakyReluParam* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const LeakyReluParam>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.SnapshotParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.LeakyReluParam)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.SnapshotParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.LeakyReluParam)
     MergeFrom(*source);
   }
 }
 
-void SnapshotParam::MergeFrom(const SnapshotParam& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.SnapshotParam)
+void LeakyReluParam::MergeFrom(const LeakyReluParam& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.LeakyReluParam)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.snapshot_prefix().size() > 0) {
-
-    snapshot_prefix_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.snapshot_prefix_);
-  }
-  if (from.snapshot_interval() != 0) {
-    set_snapshot_interval(from.snapshot_interval());
-  }
-  if (from.per_image_height() != 0) {
-    set_per_image_height(from.per_image_height());
-  }
-  if (from.per_image_width() != 0) {
-    set_per_image_width(from.per_image_width());
+  if (from.negative_slope() != 0) {
+    set_negative_slope(from.negative_slope());
   }
 }
 
-void SnapshotParam::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:deepflow.SnapshotParam)
+void LeakyReluParam::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:deepflow.LeakyReluParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void SnapshotParam::CopyFrom(const SnapshotParam& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.SnapshotParam)
+void LeakyReluParam::CopyFrom(const LeakyReluParam& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.LeakyReluParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool SnapshotParam::IsInitialized() const {
+bool LeakyReluParam::IsInitialized() const {
   return true;
 }
 
-void SnapshotParam::Swap(SnapshotParam* other) {
+void LeakyReluParam::Swap(LeakyReluParam* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void SnapshotParam::InternalSwap(SnapshotParam* other) {
-  snapshot_prefix_.Swap(&other->snapshot_prefix_);
-  std::swap(snapshot_interval_, other->snapshot_interval_);
-  std::swap(per_image_height_, other->per_image_height_);
-  std::swap(per_image_width_, other->per_image_width_);
+void LeakyReluParam::InternalSwap(LeakyReluParam* other) {
+  std::swap(negative_slope_, other->negative_slope_);
   std::swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata SnapshotParam::GetMetadata() const {
+::google::protobuf::Metadata LeakyReluParam::GetMetadata() const {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// SnapshotParam
+// LeakyReluParam
 
-// int32 snapshot_interval = 1;
-void SnapshotParam::clear_snapshot_interval() {
-  snapshot_interval_ = 0;
+// float negative_slope = 1;
+void LeakyReluParam::clear_negative_slope() {
+  negative_slope_ = 0;
 }
-::google::protobuf::int32 SnapshotParam::snapshot_interval() const {
-  // @@protoc_insertion_point(field_get:deepflow.SnapshotParam.snapshot_interval)
-  return snapshot_interval_;
+float LeakyReluParam::negative_slope() const {
+  // @@protoc_insertion_point(field_get:deepflow.LeakyReluParam.negative_slope)
+  return negative_slope_;
 }
-void SnapshotParam::set_snapshot_interval(::google::protobuf::int32 value) {
+void LeakyReluParam::set_negative_slope(float value) {
   
-  snapshot_interval_ = value;
-  // @@protoc_insertion_point(field_set:deepflow.SnapshotParam.snapshot_interval)
+  negative_slope_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.LeakyReluParam.negative_slope)
 }
 
-// string snapshot_prefix = 2;
-void SnapshotParam::clear_snapshot_prefix() {
-  snapshot_prefix_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
+
+// ===================================================================
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+PReluParam::PReluParam()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    protobuf_deepflow_2eproto::InitDefaults();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:deepflow.PReluParam)
 }
-const ::std::string& SnapshotParam::snapshot_prefix() const {
-  // @@protoc_insertion_point(field_get:deepflow.SnapshotParam.snapshot_prefix)
-  return snapshot_prefix_.GetNoArena();
+PReluParam::PReluParam(const PReluParam& from)
+  : ::google::protobuf::Message(),
+      _internal_metadata_(NULL),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:deepflow.PReluParam)
 }
-void SnapshotParam::set_snapshot_prefix(const ::std::string& value) {
-  
-  snapshot_prefix_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:deepflow.SnapshotParam.snapshot_prefix)
+
+void PReluParam::SharedCtor() {
+  _cached_size_ = 0;
 }
-#if LANG_CXX11
-void SnapshotParam::set_snapshot_prefix(::std::string&& value) {
-  
-  snapshot_prefix_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:deepflow.SnapshotParam.snapshot_prefix)
+
+PReluParam::~PReluParam() {
+  // @@protoc_insertion_point(destructor:deepflow.PReluParam)
+  SharedDtor();
 }
-#endif
-void SnapshotParam::set_snapshot_prefix(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  snapshot_prefix_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:deepflow.SnapshotParam.snapshot_prefix)
+
+void PReluParam::SharedDtor() {
 }
-void SnapshotParam::set_snapshot_prefix(const char* value, size_t size) {
-  
-  snapshot_prefix_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:deepflow.SnapshotParam.snapshot_prefix)
+
+void PReluParam::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-::std::string* SnapshotParam::mutable_snapshot_prefix() {
-  
-  // @@protoc_insertion_point(field_mutable:deepflow.SnapshotParam.snapshot_prefix)
-  return snapshot_prefix_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+const ::google::protobuf::Descriptor* PReluParam::descriptor() {
+  protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
-::std::string* SnapshotParam::release_snapshot_prefix() {
-  // @@protoc_insertion_point(field_release:deepflow.SnapshotParam.snapshot_prefix)
-  
-  return snapshot_prefix_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+
+const PReluParam& PReluParam::default_instance() {
+  protobuf_deepflow_2eproto::InitDefaults();
+  return *internal_default_instance();
 }
-void SnapshotParam::set_allocated_snapshot_prefix(::std::string* snapshot_prefix) {
-  if (snapshot_prefix != NULL) {
-    
+
+PReluParam* PReluParam::New(::google::protobuf::Arena* arena) const {
+  PReluParam* n = new PReluParam;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void PReluParam::Clear() {
+// @@protoc_insertion_point(message_clear_start:deepflow.PReluParam)
+}
+
+bool PReluParam::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:deepflow.PReluParam)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+  handle_unusual:
+    if (tag == 0 ||
+        ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+        ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+      goto success;
+    }
+    DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
+  }
+success:
+  // @@protoc_insertion_point(parse_success:deepflow.PReluParam)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:deepflow.PReluParam)
+  return false;
+#undef DO_
+}
+
+void PReluParam::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:deepflow.PReluParam)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // @@protoc_insertion_point(serialize_end:deepflow.PReluParam)
+}
+
+::google::protobuf::uint8* PReluParam::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:deepflow.PReluParam)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // @@protoc_insertion_point(serialize_to_array_end:deepflow.PReluParam)
+  return target;
+}
+
+size_t PReluParam::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:deepflow.PReluParam)
+  size_t total_size = 0;
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void PReluParam::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:deepflow.PReluParam)
+  GOOGLE_DCHECK_NE(&from, this);
+  const PReluParam* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const PReluParam>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.PReluParam)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-    
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.PReluParam)
+    MergeFrom(*source);
   }
-  snapshot_prefix_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), snapshot_prefix);
-  // @@protoc_insertion_point(field_set_allocated:deepflow.SnapshotParam.snapshot_prefix)
 }
 
-// int32 per_image_height = 3;
-void SnapshotParam::clear_per_image_height() {
-  per_image_height_ = 0;
+void PReluParam::MergeFrom(const PReluParam& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.PReluParam)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
 }
-::google::protobuf::int32 SnapshotParam::per_image_height() const {
-  // @@protoc_insertion_point(field_get:deepflow.SnapshotParam.per_image_height)
-  return per_image_height_;
+
+void PReluParam::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:deepflow.PReluParam)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
 }
-void SnapshotParam::set_per_image_height(::google::protobuf::int32 value) {
-  
-  per_image_height_ = value;
-  // @@protoc_insertion_point(field_set:deepflow.SnapshotParam.per_image_height)
+
+void PReluParam::CopyFrom(const PReluParam& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.PReluParam)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
 }
 
-// int32 per_image_width = 4;
-void SnapshotParam::clear_per_image_width() {
-  per_image_width_ = 0;
+bool PReluParam::IsInitialized() const {
+  return true;
 }
-::google::protobuf::int32 SnapshotParam::per_image_width() const {
-  // @@protoc_insertion_point(field_get:deepflow.SnapshotParam.per_image_width)
-  return per_image_width_;
+
+void PReluParam::Swap(PReluParam* other) {
+  if (other == this) return;
+  InternalSwap(other);
 }
-void SnapshotParam::set_per_image_width(::google::protobuf::int32 value) {
-  
-  per_image_width_ = value;
-  // @@protoc_insertion_point(field_set:deepflow.SnapshotParam.per_image_width)
+void PReluParam::InternalSwap(PReluParam* other) {
+  std::swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata PReluParam::GetMetadata() const {
+  protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
+#if PROTOBUF_INLINE_NOT_IN_HEADERS
+// PReluParam
+
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int PlaceHolderParam::kTensorParamFieldNumber;
+const int DPReluParam::kNegativeSlopeFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-PlaceHolderParam::PlaceHolderParam()
+DPReluParam::DPReluParam()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_deepflow_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:deepflow.PlaceHolderParam)
+  // @@protoc_insertion_point(constructor:deepflow.DPReluParam)
 }
-PlaceHolderParam::PlaceHolderParam(const PlaceHolderParam& from)
+DPReluParam::DPReluParam(const DPReluParam& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
-  if (from.has_tensor_param()) {
-    tensor_param_ = new ::deepflow::TensorParam(*from.tensor_param_);
-  } else {
-    tensor_param_ = NULL;
-  }
-  // @@protoc_insertion_point(copy_constructor:deepflow.PlaceHolderParam)
+  negative_slope_ = from.negative_slope_;
+  // @@protoc_insertion_point(copy_constructor:deepflow.DPReluParam)
 }
 
-void PlaceHolderParam::SharedCtor() {
-  tensor_param_ = NULL;
+void DPReluParam::SharedCtor() {
+  negative_slope_ = 0;
   _cached_size_ = 0;
 }
 
-PlaceHolderParam::~PlaceHolderParam() {
-  // @@protoc_insertion_point(destructor:deepflow.PlaceHolderParam)
+DPReluParam::~DPReluParam() {
+  // @@protoc_insertion_point(destructor:deepflow.DPReluParam)
   SharedDtor();
 }
 
-void PlaceHolderParam::SharedDtor() {
-  if (this != internal_default_instance()) {
-    delete tensor_param_;
-  }
+void DPReluParam::SharedDtor() {
 }
 
-void PlaceHolderParam::SetCachedSize(int size) const {
+void DPReluParam::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* PlaceHolderParam::descriptor() {
+const ::google::protobuf::Descriptor* DPReluParam::descriptor() {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const PlaceHolderParam& PlaceHolderParam::default_instance() {
+const DPReluParam& DPReluParam::default_instance() {
   protobuf_deepflow_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-PlaceHolderParam* PlaceHolderParam::New(::google::protobuf::Arena* arena) const {
-  PlaceHolderParam* n = new PlaceHolderParam;
+DPReluParam* DPReluParam::New(::google::protobuf::Arena* arena) const {
+  DPReluParam* n = new DPReluParam;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void PlaceHolderParam::Clear() {
-// @@protoc_insertion_point(message_clear_start:deepflow.PlaceHolderParam)
-  if (GetArenaNoVirtual() == NULL && tensor_param_ != NULL) {
-    delete tensor_param_;
-  }
-  tensor_param_ = NULL;
+void DPReluParam::Clear() {
+// @@protoc_insertion_point(message_clear_start:deepflow.DPReluParam)
+  negative_slope_ = 0;
 }
 
-bool PlaceHolderParam::MergePartialFromCodedStream(
+bool DPReluParam::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:deepflow.PlaceHolderParam)
+  // @@protoc_insertion_point(parse_start:deepflow.DPReluParam)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // .deepflow.TensorParam tensor_param = 1;
+      // float negative_slope = 1;
       case 1: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_tensor_param()));
+            static_cast< ::google::protobuf::uint8>(13u)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, &negative_slope_)));
         } else {
           goto handle_unusual;
         }
@@ -11291,55 +11934,50 @@ bool PlaceHolderParam::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:deepflow.PlaceHolderParam)
+  // @@protoc_insertion_point(parse_success:deepflow.DPReluParam)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:deepflow.PlaceHolderParam)
+  // @@protoc_insertion_point(parse_failure:deepflow.DPReluParam)
   return false;
 #undef DO_
 }
 
-void PlaceHolderParam::SerializeWithCachedSizes(
+void DPReluParam::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:deepflow.PlaceHolderParam)
+  // @@protoc_insertion_point(serialize_start:deepflow.DPReluParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .deepflow.TensorParam tensor_param = 1;
-  if (this->has_tensor_param()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, *this->tensor_param_, output);
+  // float negative_slope = 1;
+  if (this->negative_slope() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(1, this->negative_slope(), output);
   }
 
-  // @@protoc_insertion_point(serialize_end:deepflow.PlaceHolderParam)
+  // @@protoc_insertion_point(serialize_end:deepflow.DPReluParam)
 }
 
-::google::protobuf::uint8* PlaceHolderParam::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* DPReluParam::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:deepflow.PlaceHolderParam)
+  // @@protoc_insertion_point(serialize_to_array_start:deepflow.DPReluParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .deepflow.TensorParam tensor_param = 1;
-  if (this->has_tensor_param()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageNoVirtualToArray(
-        1, *this->tensor_param_, deterministic, target);
+  // float negative_slope = 1;
+  if (this->negative_slope() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(1, this->negative_slope(), target);
   }
 
-  // @@protoc_insertion_point(serialize_to_array_end:deepflow.PlaceHolderParam)
+  // @@protoc_insertion_point(serialize_to_array_end:deepflow.DPReluParam)
   return target;
 }
 
-size_t PlaceHolderParam::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:deepflow.PlaceHolderParam)
+size_t DPReluParam::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:deepflow.DPReluParam)
   size_t total_size = 0;
 
-  // .deepflow.TensorParam tensor_param = 1;
-  if (this->has_tensor_param()) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        *this->tensor_param_);
+  // float negative_slope = 1;
+  if (this->negative_slope() != 0) {
+    total_size += 1 + 4;
   }
 
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
@@ -11349,105 +11987,80 @@ size_t PlaceHolderParam::ByteSizeLong() const {
   return total_size;
 }
 
-void PlaceHolderParam::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:deepflow.PlaceHolderParam)
+void DPReluParam::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:deepflow.DPReluParam)
   GOOGLE_DCHECK_NE(&from, this);
-  const PlaceHolderParam* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const PlaceHolderParam>(
+  const DPReluParam* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const DPReluParam>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.PlaceHolderParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.DPReluParam)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.PlaceHolderParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.DPReluParam)
     MergeFrom(*source);
   }
 }
 
-void PlaceHolderParam::MergeFrom(const PlaceHolderParam& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.PlaceHolderParam)
+void DPReluParam::MergeFrom(const DPReluParam& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.DPReluParam)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.has_tensor_param()) {
-    mutable_tensor_param()->::deepflow::TensorParam::MergeFrom(from.tensor_param());
+  if (from.negative_slope() != 0) {
+    set_negative_slope(from.negative_slope());
   }
 }
 
-void PlaceHolderParam::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:deepflow.PlaceHolderParam)
+void DPReluParam::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:deepflow.DPReluParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void PlaceHolderParam::CopyFrom(const PlaceHolderParam& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.PlaceHolderParam)
+void DPReluParam::CopyFrom(const DPReluParam& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.DPReluParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool PlaceHolderParam::IsInitialized() const {
+bool DPReluParam::IsInitialized() const {
   return true;
 }
 
-void PlaceHolderParam::Swap(PlaceHolderParam* other) {
+void DPReluParam::Swap(DPReluParam* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void PlaceHolderParam::InternalSwap(PlaceHolderParam* other) {
-  std::swap(tensor_param_, other->tensor_param_);
+void DPReluParam::InternalSwap(DPReluParam* other) {
+  std::swap(negative_slope_, other->negative_slope_);
   std::swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata PlaceHolderParam::GetMetadata() const {
+::google::protobuf::Metadata DPReluParam::GetMetadata() const {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// PlaceHolderParam
+// DPReluParam
 
-// .deepflow.TensorParam tensor_param = 1;
-bool PlaceHolderParam::has_tensor_param() const {
-  return this != internal_default_instance() && tensor_param_ != NULL;
-}
-void PlaceHolderParam::clear_tensor_param() {
-  if (GetArenaNoVirtual() == NULL && tensor_param_ != NULL) delete tensor_param_;
-  tensor_param_ = NULL;
-}
-const ::deepflow::TensorParam& PlaceHolderParam::tensor_param() const {
-  // @@protoc_insertion_point(field_get:deepflow.PlaceHolderParam.tensor_param)
-  return tensor_param_ != NULL ? *tensor_param_
-                         : *::deepflow::TensorParam::internal_default_instance();
+// float negative_slope = 1;
+void DPReluParam::clear_negative_slope() {
+  negative_slope_ = 0;
 }
-::deepflow::TensorParam* PlaceHolderParam::mutable_tensor_param() {
-  
-  if (tensor_param_ == NULL) {
-    tensor_param_ = new ::deepflow::TensorParam;
-  }
-  // @@protoc_insertion_point(field_mutable:deepflow.PlaceHolderParam.tensor_param)
-  return tensor_param_;
+float DPReluParam::negative_slope() const {
+  // @@protoc_insertion_point(field_get:deepflow.DPReluParam.negative_slope)
+  return negative_slope_;
 }
-::deepflow::TensorParam* PlaceHolderParam::release_tensor_param() {
-  // @@protoc_insertion_point(field_release:deepflow.PlaceHolderParam.tensor_param)
+void DPReluParam::set_negative_slope(float value) {
   
-  ::deepflow::TensorParam* temp = tensor_param_;
-  tensor_param_ = NULL;
-  return temp;
-}
-void PlaceHolderParam::set_allocated_tensor_param(::deepflow::TensorParam* tensor_param) {
-  delete tensor_param_;
-  tensor_param_ = tensor_param;
-  if (tensor_param) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_set_allocated:deepflow.PlaceHolderParam.tensor_param)
+  negative_slope_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.DPReluParam.negative_slope)
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -11455,104 +12068,86 @@ void PlaceHolderParam::set_allocated_tensor_param(::deepflow::TensorParam* tenso
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int RestructureParam::kFirstDimFieldNumber;
-const int RestructureParam::kSecondDimFieldNumber;
+const int ReduceAllParam::kReduceOpFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-RestructureParam::RestructureParam()
+ReduceAllParam::ReduceAllParam()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_deepflow_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:deepflow.RestructureParam)
+  // @@protoc_insertion_point(constructor:deepflow.ReduceAllParam)
 }
-RestructureParam::RestructureParam(const RestructureParam& from)
+ReduceAllParam::ReduceAllParam(const ReduceAllParam& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::memcpy(&first_dim_, &from.first_dim_,
-    reinterpret_cast<char*>(&second_dim_) -
-    reinterpret_cast<char*>(&first_dim_) + sizeof(second_dim_));
-  // @@protoc_insertion_point(copy_constructor:deepflow.RestructureParam)
+  reduce_op_ = from.reduce_op_;
+  // @@protoc_insertion_point(copy_constructor:deepflow.ReduceAllParam)
 }
 
-void RestructureParam::SharedCtor() {
-  ::memset(&first_dim_, 0, reinterpret_cast<char*>(&second_dim_) -
-    reinterpret_cast<char*>(&first_dim_) + sizeof(second_dim_));
+void ReduceAllParam::SharedCtor() {
+  reduce_op_ = 0;
   _cached_size_ = 0;
 }
 
-RestructureParam::~RestructureParam() {
-  // @@protoc_insertion_point(destructor:deepflow.RestructureParam)
+ReduceAllParam::~ReduceAllParam() {
+  // @@protoc_insertion_point(destructor:deepflow.ReduceAllParam)
   SharedDtor();
 }
 
-void RestructureParam::SharedDtor() {
+void ReduceAllParam::SharedDtor() {
 }
 
-void RestructureParam::SetCachedSize(int size) const {
+void ReduceAllParam::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* RestructureParam::descriptor() {
+const ::google::protobuf::Descriptor* ReduceAllParam::descriptor() {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const RestructureParam& RestructureParam::default_instance() {
+const ReduceAllParam& ReduceAllParam::default_instance() {
   protobuf_deepflow_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-RestructureParam* RestructureParam::New(::google::protobuf::Arena* arena) const {
-  RestructureParam* n = new RestructureParam;
+ReduceAllParam* ReduceAllParam::New(::google::protobuf::Arena* arena) const {
+  ReduceAllParam* n = new ReduceAllParam;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void RestructureParam::Clear() {
-// @@protoc_insertion_point(message_clear_start:deepflow.RestructureParam)
-  ::memset(&first_dim_, 0, reinterpret_cast<char*>(&second_dim_) -
-    reinterpret_cast<char*>(&first_dim_) + sizeof(second_dim_));
+void ReduceAllParam::Clear() {
+// @@protoc_insertion_point(message_clear_start:deepflow.ReduceAllParam)
+  reduce_op_ = 0;
 }
 
-bool RestructureParam::MergePartialFromCodedStream(
+bool ReduceAllParam::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:deepflow.RestructureParam)
+  // @@protoc_insertion_point(parse_start:deepflow.ReduceAllParam)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // int32 first_dim = 1;
+      // .deepflow.ReduceAllParam.ReduceAllOp reduce_op = 1;
       case 1: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
             static_cast< ::google::protobuf::uint8>(8u)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &first_dim_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // int32 second_dim = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(16u)) {
-
+          int value;
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &second_dim_)));
+                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          set_reduce_op(static_cast< ::deepflow::ReduceAllParam_ReduceAllOp >(value));
         } else {
           goto handle_unusual;
         }
@@ -11572,69 +12167,53 @@ bool RestructureParam::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:deepflow.RestructureParam)
+  // @@protoc_insertion_point(parse_success:deepflow.ReduceAllParam)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:deepflow.RestructureParam)
+  // @@protoc_insertion_point(parse_failure:deepflow.ReduceAllParam)
   return false;
 #undef DO_
 }
 
-void RestructureParam::SerializeWithCachedSizes(
+void ReduceAllParam::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:deepflow.RestructureParam)
+  // @@protoc_insertion_point(serialize_start:deepflow.ReduceAllParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // int32 first_dim = 1;
-  if (this->first_dim() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->first_dim(), output);
-  }
-
-  // int32 second_dim = 2;
-  if (this->second_dim() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(2, this->second_dim(), output);
+  // .deepflow.ReduceAllParam.ReduceAllOp reduce_op = 1;
+  if (this->reduce_op() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      1, this->reduce_op(), output);
   }
 
-  // @@protoc_insertion_point(serialize_end:deepflow.RestructureParam)
+  // @@protoc_insertion_point(serialize_end:deepflow.ReduceAllParam)
 }
 
-::google::protobuf::uint8* RestructureParam::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* ReduceAllParam::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:deepflow.RestructureParam)
+  // @@protoc_insertion_point(serialize_to_array_start:deepflow.ReduceAllParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // int32 first_dim = 1;
-  if (this->first_dim() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->first_dim(), target);
-  }
-
-  // int32 second_dim = 2;
-  if (this->second_dim() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(2, this->second_dim(), target);
+  // .deepflow.ReduceAllParam.ReduceAllOp reduce_op = 1;
+  if (this->reduce_op() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
+      1, this->reduce_op(), target);
   }
 
-  // @@protoc_insertion_point(serialize_to_array_end:deepflow.RestructureParam)
+  // @@protoc_insertion_point(serialize_to_array_end:deepflow.ReduceAllParam)
   return target;
 }
 
-size_t RestructureParam::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:deepflow.RestructureParam)
+size_t ReduceAllParam::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:deepflow.ReduceAllParam)
   size_t total_size = 0;
 
-  // int32 first_dim = 1;
-  if (this->first_dim() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->first_dim());
-  }
-
-  // int32 second_dim = 2;
-  if (this->second_dim() != 0) {
+  // .deepflow.ReduceAllParam.ReduceAllOp reduce_op = 1;
+  if (this->reduce_op() != 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->second_dim());
+      ::google::protobuf::internal::WireFormatLite::EnumSize(this->reduce_op());
   }
 
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
@@ -11644,98 +12223,80 @@ size_t RestructureParam::ByteSizeLong() const {
   return total_size;
 }
 
-void RestructureParam::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:deepflow.RestructureParam)
+void ReduceAllParam::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:deepflow.ReduceAllParam)
   GOOGLE_DCHECK_NE(&from, this);
-  const RestructureParam* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const RestructureParam>(
+  const ReduceAllParam* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const ReduceAllParam>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.RestructureParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.ReduceAllParam)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.RestructureParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.ReduceAllParam)
     MergeFrom(*source);
   }
 }
 
-void RestructureParam::MergeFrom(const RestructureParam& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.RestructureParam)
-  GOOGLE_DCHECK_NE(&from, this);
+void ReduceAllParam::MergeFrom(const ReduceAllParam& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.ReduceAllParam)
+  GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.first_dim() != 0) {
-    set_first_dim(from.first_dim());
-  }
-  if (from.second_dim() != 0) {
-    set_second_dim(from.second_dim());
+  if (from.reduce_op() != 0) {
+    set_reduce_op(from.reduce_op());
   }
 }
 
-void RestructureParam::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:deepflow.RestructureParam)
+void ReduceAllParam::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:deepflow.ReduceAllParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void RestructureParam::CopyFrom(const RestructureParam& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.RestructureParam)
+void ReduceAllParam::CopyFrom(const ReduceAllParam& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.ReduceAllParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool RestructureParam::IsInitialized() const {
+bool ReduceAllParam::IsInitialized() const {
   return true;
 }
 
-void RestructureParam::Swap(RestructureParam* other) {
+void ReduceAllParam::Swap(ReduceAllParam* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void RestructureParam::InternalSwap(RestructureParam* other) {
-  std::swap(first_dim_, other->first_dim_);
-  std::swap(second_dim_, other->second_dim_);
+void ReduceAllParam::InternalSwap(ReduceAllParam* other) {
+  std::swap(reduce_op_, other->reduce_op_);
   std::swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata RestructureParam::GetMetadata() const {
+::google::protobuf::Metadata ReduceAllParam::GetMetadata() const {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// RestructureParam
-
-// int32 first_dim = 1;
-void RestructureParam::clear_first_dim() {
-  first_dim_ = 0;
-}
-::google::protobuf::int32 RestructureParam::first_dim() const {
-  // @@protoc_insertion_point(field_get:deepflow.RestructureParam.first_dim)
-  return first_dim_;
-}
-void RestructureParam::set_first_dim(::google::protobuf::int32 value) {
-  
-  first_dim_ = value;
-  // @@protoc_insertion_point(field_set:deepflow.RestructureParam.first_dim)
-}
+// ReduceAllParam
 
-// int32 second_dim = 2;
-void RestructureParam::clear_second_dim() {
-  second_dim_ = 0;
+// .deepflow.ReduceAllParam.ReduceAllOp reduce_op = 1;
+void ReduceAllParam::clear_reduce_op() {
+  reduce_op_ = 0;
 }
-::google::protobuf::int32 RestructureParam::second_dim() const {
-  // @@protoc_insertion_point(field_get:deepflow.RestructureParam.second_dim)
-  return second_dim_;
+::deepflow::ReduceAllParam_ReduceAllOp ReduceAllParam::reduce_op() const {
+  // @@protoc_insertion_point(field_get:deepflow.ReduceAllParam.reduce_op)
+  return static_cast< ::deepflow::ReduceAllParam_ReduceAllOp >(reduce_op_);
 }
-void RestructureParam::set_second_dim(::google::protobuf::int32 value) {
+void ReduceAllParam::set_reduce_op(::deepflow::ReduceAllParam_ReduceAllOp value) {
   
-  second_dim_ = value;
-  // @@protoc_insertion_point(field_set:deepflow.RestructureParam.second_dim)
+  reduce_op_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.ReduceAllParam.reduce_op)
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -11743,143 +12304,142 @@ void RestructureParam::set_second_dim(::google::protobuf::int32 value) {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int VariableParam::kInitParamFieldNumber;
-const int VariableParam::kSolverNameFieldNumber;
-const int VariableParam::kWeightsFieldNumber;
+const int ReduceParam::kReduceOpFieldNumber;
+const int ReduceParam::kReduceDimFieldNumber;
+const int ReduceParam::kOutputTypeFieldNumber;
+const int ReduceParam::kReduceDimsFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-VariableParam::VariableParam()
+ReduceParam::ReduceParam()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_deepflow_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:deepflow.VariableParam)
+  // @@protoc_insertion_point(constructor:deepflow.ReduceParam)
 }
-VariableParam::VariableParam(const VariableParam& from)
+ReduceParam::ReduceParam(const ReduceParam& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
+      reduce_dims_(from.reduce_dims_),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
-  solver_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.solver_name().size() > 0) {
-    solver_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.solver_name_);
-  }
-  if (from.has_init_param()) {
-    init_param_ = new ::deepflow::InitParam(*from.init_param_);
-  } else {
-    init_param_ = NULL;
-  }
-  if (from.has_weights()) {
-    weights_ = new ::deepflow::TensorData(*from.weights_);
-  } else {
-    weights_ = NULL;
-  }
-  // @@protoc_insertion_point(copy_constructor:deepflow.VariableParam)
+  ::memcpy(&reduce_op_, &from.reduce_op_,
+    reinterpret_cast<char*>(&output_type_) -
+    reinterpret_cast<char*>(&reduce_op_) + sizeof(output_type_));
+  // @@protoc_insertion_point(copy_constructor:deepflow.ReduceParam)
 }
 
-void VariableParam::SharedCtor() {
-  solver_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&init_param_, 0, reinterpret_cast<char*>(&weights_) -
-    reinterpret_cast<char*>(&init_param_) + sizeof(weights_));
+void ReduceParam::SharedCtor() {
+  ::memset(&reduce_op_, 0, reinterpret_cast<char*>(&output_type_) -
+    reinterpret_cast<char*>(&reduce_op_) + sizeof(output_type_));
   _cached_size_ = 0;
 }
 
-VariableParam::~VariableParam() {
-  // @@protoc_insertion_point(destructor:deepflow.VariableParam)
+ReduceParam::~ReduceParam() {
+  // @@protoc_insertion_point(destructor:deepflow.ReduceParam)
   SharedDtor();
 }
 
-void VariableParam::SharedDtor() {
-  solver_name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (this != internal_default_instance()) {
-    delete init_param_;
-  }
-  if (this != internal_default_instance()) {
-    delete weights_;
-  }
+void ReduceParam::SharedDtor() {
 }
 
-void VariableParam::SetCachedSize(int size) const {
+void ReduceParam::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* VariableParam::descriptor() {
+const ::google::protobuf::Descriptor* ReduceParam::descriptor() {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const VariableParam& VariableParam::default_instance() {
+const ReduceParam& ReduceParam::default_instance() {
   protobuf_deepflow_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-VariableParam* VariableParam::New(::google::protobuf::Arena* arena) const {
-  VariableParam* n = new VariableParam;
+ReduceParam* ReduceParam::New(::google::protobuf::Arena* arena) const {
+  ReduceParam* n = new ReduceParam;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void VariableParam::Clear() {
-// @@protoc_insertion_point(message_clear_start:deepflow.VariableParam)
-  solver_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (GetArenaNoVirtual() == NULL && init_param_ != NULL) {
-    delete init_param_;
-  }
-  init_param_ = NULL;
-  if (GetArenaNoVirtual() == NULL && weights_ != NULL) {
-    delete weights_;
-  }
-  weights_ = NULL;
+void ReduceParam::Clear() {
+// @@protoc_insertion_point(message_clear_start:deepflow.ReduceParam)
+  reduce_dims_.Clear();
+  ::memset(&reduce_op_, 0, reinterpret_cast<char*>(&output_type_) -
+    reinterpret_cast<char*>(&reduce_op_) + sizeof(output_type_));
 }
 
-bool VariableParam::MergePartialFromCodedStream(
+bool ReduceParam::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:deepflow.VariableParam)
+  // @@protoc_insertion_point(parse_start:deepflow.ReduceParam)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // .deepflow.InitParam init_param = 1;
+      // .deepflow.ReduceParam.ReduceOp reduce_op = 1;
       case 1: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_init_param()));
+            static_cast< ::google::protobuf::uint8>(8u)) {
+          int value;
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          set_reduce_op(static_cast< ::deepflow::ReduceParam_ReduceOp >(value));
         } else {
           goto handle_unusual;
         }
         break;
       }
 
-      // string solver_name = 2;
+      // int32 reduce_dim = 2;
       case 2: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_solver_name()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->solver_name().data(), this->solver_name().length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "deepflow.VariableParam.solver_name"));
+            static_cast< ::google::protobuf::uint8>(16u)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &reduce_dim_)));
         } else {
           goto handle_unusual;
         }
         break;
       }
 
-      // .deepflow.TensorData weights = 3;
+      // .deepflow.ReduceParam.OutputType output_type = 3;
       case 3: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(26u)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_weights()));
+            static_cast< ::google::protobuf::uint8>(24u)) {
+          int value;
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          set_output_type(static_cast< ::deepflow::ReduceParam_OutputType >(value));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated int32 reduce_dims = 4;
+      case 4: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(34u)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, this->mutable_reduce_dims())));
+        } else if (static_cast< ::google::protobuf::uint8>(tag) ==
+                   static_cast< ::google::protobuf::uint8>(32u)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 1, 34u, input, this->mutable_reduce_dims())));
         } else {
           goto handle_unusual;
         }
@@ -11899,103 +12459,125 @@ bool VariableParam::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:deepflow.VariableParam)
+  // @@protoc_insertion_point(parse_success:deepflow.ReduceParam)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:deepflow.VariableParam)
+  // @@protoc_insertion_point(parse_failure:deepflow.ReduceParam)
   return false;
 #undef DO_
 }
 
-void VariableParam::SerializeWithCachedSizes(
+void ReduceParam::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:deepflow.VariableParam)
+  // @@protoc_insertion_point(serialize_start:deepflow.ReduceParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .deepflow.InitParam init_param = 1;
-  if (this->has_init_param()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, *this->init_param_, output);
+  // .deepflow.ReduceParam.ReduceOp reduce_op = 1;
+  if (this->reduce_op() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      1, this->reduce_op(), output);
   }
 
-  // string solver_name = 2;
-  if (this->solver_name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->solver_name().data(), this->solver_name().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "deepflow.VariableParam.solver_name");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->solver_name(), output);
+  // int32 reduce_dim = 2;
+  if (this->reduce_dim() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(2, this->reduce_dim(), output);
   }
 
-  // .deepflow.TensorData weights = 3;
-  if (this->has_weights()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      3, *this->weights_, output);
+  // .deepflow.ReduceParam.OutputType output_type = 3;
+  if (this->output_type() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      3, this->output_type(), output);
   }
 
-  // @@protoc_insertion_point(serialize_end:deepflow.VariableParam)
+  // repeated int32 reduce_dims = 4;
+  if (this->reduce_dims_size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteTag(4, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(_reduce_dims_cached_byte_size_);
+  }
+  for (int i = 0, n = this->reduce_dims_size(); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32NoTag(
+      this->reduce_dims(i), output);
+  }
+
+  // @@protoc_insertion_point(serialize_end:deepflow.ReduceParam)
 }
 
-::google::protobuf::uint8* VariableParam::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* ReduceParam::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:deepflow.VariableParam)
+  // @@protoc_insertion_point(serialize_to_array_start:deepflow.ReduceParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .deepflow.InitParam init_param = 1;
-  if (this->has_init_param()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageNoVirtualToArray(
-        1, *this->init_param_, deterministic, target);
+  // .deepflow.ReduceParam.ReduceOp reduce_op = 1;
+  if (this->reduce_op() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
+      1, this->reduce_op(), target);
   }
 
-  // string solver_name = 2;
-  if (this->solver_name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->solver_name().data(), this->solver_name().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "deepflow.VariableParam.solver_name");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->solver_name(), target);
+  // int32 reduce_dim = 2;
+  if (this->reduce_dim() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(2, this->reduce_dim(), target);
   }
 
-  // .deepflow.TensorData weights = 3;
-  if (this->has_weights()) {
+  // .deepflow.ReduceParam.OutputType output_type = 3;
+  if (this->output_type() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
+      3, this->output_type(), target);
+  }
+
+  // repeated int32 reduce_dims = 4;
+  if (this->reduce_dims_size() > 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
+      4,
+      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
+      _reduce_dims_cached_byte_size_, target);
     target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageNoVirtualToArray(
-        3, *this->weights_, deterministic, target);
+      WriteInt32NoTagToArray(this->reduce_dims_, target);
   }
 
-  // @@protoc_insertion_point(serialize_to_array_end:deepflow.VariableParam)
+  // @@protoc_insertion_point(serialize_to_array_end:deepflow.ReduceParam)
   return target;
 }
 
-size_t VariableParam::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:deepflow.VariableParam)
+size_t ReduceParam::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:deepflow.ReduceParam)
   size_t total_size = 0;
 
-  // string solver_name = 2;
-  if (this->solver_name().size() > 0) {
+  // repeated int32 reduce_dims = 4;
+  {
+    size_t data_size = ::google::protobuf::internal::WireFormatLite::
+      Int32Size(this->reduce_dims_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
+    }
+    int cached_size = ::google::protobuf::internal::ToCachedSize(data_size);
+    GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+    _reduce_dims_cached_byte_size_ = cached_size;
+    GOOGLE_SAFE_CONCURRENT_WRITES_END();
+    total_size += data_size;
+  }
+
+  // .deepflow.ReduceParam.ReduceOp reduce_op = 1;
+  if (this->reduce_op() != 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->solver_name());
+      ::google::protobuf::internal::WireFormatLite::EnumSize(this->reduce_op());
   }
 
-  // .deepflow.InitParam init_param = 1;
-  if (this->has_init_param()) {
+  // int32 reduce_dim = 2;
+  if (this->reduce_dim() != 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        *this->init_param_);
+      ::google::protobuf::internal::WireFormatLite::Int32Size(
+        this->reduce_dim());
   }
 
-  // .deepflow.TensorData weights = 3;
-  if (this->has_weights()) {
+  // .deepflow.ReduceParam.OutputType output_type = 3;
+  if (this->output_type() != 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        *this->weights_);
+      ::google::protobuf::internal::WireFormatLite::EnumSize(this->output_type());
   }
 
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
@@ -12005,206 +12587,148 @@ size_t VariableParam::ByteSizeLong() const {
   return total_size;
 }
 
-void VariableParam::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:deepflow.VariableParam)
+void ReduceParam::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:deepflow.ReduceParam)
   GOOGLE_DCHECK_NE(&from, this);
-  const VariableParam* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const VariableParam>(
+  const ReduceParam* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const ReduceParam>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.VariableParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.ReduceParam)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.VariableParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.ReduceParam)
     MergeFrom(*source);
   }
 }
 
-void VariableParam::MergeFrom(const VariableParam& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.VariableParam)
+void ReduceParam::MergeFrom(const ReduceParam& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.ReduceParam)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.solver_name().size() > 0) {
-
-    solver_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.solver_name_);
+  reduce_dims_.MergeFrom(from.reduce_dims_);
+  if (from.reduce_op() != 0) {
+    set_reduce_op(from.reduce_op());
   }
-  if (from.has_init_param()) {
-    mutable_init_param()->::deepflow::InitParam::MergeFrom(from.init_param());
+  if (from.reduce_dim() != 0) {
+    set_reduce_dim(from.reduce_dim());
   }
-  if (from.has_weights()) {
-    mutable_weights()->::deepflow::TensorData::MergeFrom(from.weights());
+  if (from.output_type() != 0) {
+    set_output_type(from.output_type());
   }
 }
 
-void VariableParam::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:deepflow.VariableParam)
+void ReduceParam::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:deepflow.ReduceParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void VariableParam::CopyFrom(const VariableParam& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.VariableParam)
+void ReduceParam::CopyFrom(const ReduceParam& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.ReduceParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool VariableParam::IsInitialized() const {
+bool ReduceParam::IsInitialized() const {
   return true;
 }
 
-void VariableParam::Swap(VariableParam* other) {
+void ReduceParam::Swap(ReduceParam* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void VariableParam::InternalSwap(VariableParam* other) {
-  solver_name_.Swap(&other->solver_name_);
-  std::swap(init_param_, other->init_param_);
-  std::swap(weights_, other->weights_);
+void ReduceParam::InternalSwap(ReduceParam* other) {
+  reduce_dims_.InternalSwap(&other->reduce_dims_);
+  std::swap(reduce_op_, other->reduce_op_);
+  std::swap(reduce_dim_, other->reduce_dim_);
+  std::swap(output_type_, other->output_type_);
   std::swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata VariableParam::GetMetadata() const {
+::google::protobuf::Metadata ReduceParam::GetMetadata() const {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// VariableParam
+// ReduceParam
 
-// .deepflow.InitParam init_param = 1;
-bool VariableParam::has_init_param() const {
-  return this != internal_default_instance() && init_param_ != NULL;
-}
-void VariableParam::clear_init_param() {
-  if (GetArenaNoVirtual() == NULL && init_param_ != NULL) delete init_param_;
-  init_param_ = NULL;
-}
-const ::deepflow::InitParam& VariableParam::init_param() const {
-  // @@protoc_insertion_point(field_get:deepflow.VariableParam.init_param)
-  return init_param_ != NULL ? *init_param_
-                         : *::deepflow::InitParam::internal_default_instance();
+// .deepflow.ReduceParam.ReduceOp reduce_op = 1;
+void ReduceParam::clear_reduce_op() {
+  reduce_op_ = 0;
 }
-::deepflow::InitParam* VariableParam::mutable_init_param() {
-  
-  if (init_param_ == NULL) {
-    init_param_ = new ::deepflow::InitParam;
-  }
-  // @@protoc_insertion_point(field_mutable:deepflow.VariableParam.init_param)
-  return init_param_;
+::deepflow::ReduceParam_ReduceOp ReduceParam::reduce_op() const {
+  // @@protoc_insertion_point(field_get:deepflow.ReduceParam.reduce_op)
+  return static_cast< ::deepflow::ReduceParam_ReduceOp >(reduce_op_);
 }
-::deepflow::InitParam* VariableParam::release_init_param() {
-  // @@protoc_insertion_point(field_release:deepflow.VariableParam.init_param)
+void ReduceParam::set_reduce_op(::deepflow::ReduceParam_ReduceOp value) {
   
-  ::deepflow::InitParam* temp = init_param_;
-  init_param_ = NULL;
-  return temp;
-}
-void VariableParam::set_allocated_init_param(::deepflow::InitParam* init_param) {
-  delete init_param_;
-  init_param_ = init_param;
-  if (init_param) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_set_allocated:deepflow.VariableParam.init_param)
+  reduce_op_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.ReduceParam.reduce_op)
 }
 
-// string solver_name = 2;
-void VariableParam::clear_solver_name() {
-  solver_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-const ::std::string& VariableParam::solver_name() const {
-  // @@protoc_insertion_point(field_get:deepflow.VariableParam.solver_name)
-  return solver_name_.GetNoArena();
-}
-void VariableParam::set_solver_name(const ::std::string& value) {
-  
-  solver_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:deepflow.VariableParam.solver_name)
+// int32 reduce_dim = 2;
+void ReduceParam::clear_reduce_dim() {
+  reduce_dim_ = 0;
 }
-#if LANG_CXX11
-void VariableParam::set_solver_name(::std::string&& value) {
-  
-  solver_name_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:deepflow.VariableParam.solver_name)
+::google::protobuf::int32 ReduceParam::reduce_dim() const {
+  // @@protoc_insertion_point(field_get:deepflow.ReduceParam.reduce_dim)
+  return reduce_dim_;
 }
-#endif
-void VariableParam::set_solver_name(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
+void ReduceParam::set_reduce_dim(::google::protobuf::int32 value) {
   
-  solver_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:deepflow.VariableParam.solver_name)
+  reduce_dim_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.ReduceParam.reduce_dim)
 }
-void VariableParam::set_solver_name(const char* value, size_t size) {
-  
-  solver_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:deepflow.VariableParam.solver_name)
+
+// .deepflow.ReduceParam.OutputType output_type = 3;
+void ReduceParam::clear_output_type() {
+  output_type_ = 0;
 }
-::std::string* VariableParam::mutable_solver_name() {
-  
-  // @@protoc_insertion_point(field_mutable:deepflow.VariableParam.solver_name)
-  return solver_name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+::deepflow::ReduceParam_OutputType ReduceParam::output_type() const {
+  // @@protoc_insertion_point(field_get:deepflow.ReduceParam.output_type)
+  return static_cast< ::deepflow::ReduceParam_OutputType >(output_type_);
 }
-::std::string* VariableParam::release_solver_name() {
-  // @@protoc_insertion_point(field_release:deepflow.VariableParam.solver_name)
+void ReduceParam::set_output_type(::deepflow::ReduceParam_OutputType value) {
   
-  return solver_name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-void VariableParam::set_allocated_solver_name(::std::string* solver_name) {
-  if (solver_name != NULL) {
-    
-  } else {
-    
-  }
-  solver_name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), solver_name);
-  // @@protoc_insertion_point(field_set_allocated:deepflow.VariableParam.solver_name)
+  output_type_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.ReduceParam.output_type)
 }
 
-// .deepflow.TensorData weights = 3;
-bool VariableParam::has_weights() const {
-  return this != internal_default_instance() && weights_ != NULL;
+// repeated int32 reduce_dims = 4;
+int ReduceParam::reduce_dims_size() const {
+  return reduce_dims_.size();
 }
-void VariableParam::clear_weights() {
-  if (GetArenaNoVirtual() == NULL && weights_ != NULL) delete weights_;
-  weights_ = NULL;
+void ReduceParam::clear_reduce_dims() {
+  reduce_dims_.Clear();
 }
-const ::deepflow::TensorData& VariableParam::weights() const {
-  // @@protoc_insertion_point(field_get:deepflow.VariableParam.weights)
-  return weights_ != NULL ? *weights_
-                         : *::deepflow::TensorData::internal_default_instance();
+::google::protobuf::int32 ReduceParam::reduce_dims(int index) const {
+  // @@protoc_insertion_point(field_get:deepflow.ReduceParam.reduce_dims)
+  return reduce_dims_.Get(index);
 }
-::deepflow::TensorData* VariableParam::mutable_weights() {
-  
-  if (weights_ == NULL) {
-    weights_ = new ::deepflow::TensorData;
-  }
-  // @@protoc_insertion_point(field_mutable:deepflow.VariableParam.weights)
-  return weights_;
+void ReduceParam::set_reduce_dims(int index, ::google::protobuf::int32 value) {
+  reduce_dims_.Set(index, value);
+  // @@protoc_insertion_point(field_set:deepflow.ReduceParam.reduce_dims)
 }
-::deepflow::TensorData* VariableParam::release_weights() {
-  // @@protoc_insertion_point(field_release:deepflow.VariableParam.weights)
-  
-  ::deepflow::TensorData* temp = weights_;
-  weights_ = NULL;
-  return temp;
+void ReduceParam::add_reduce_dims(::google::protobuf::int32 value) {
+  reduce_dims_.Add(value);
+  // @@protoc_insertion_point(field_add:deepflow.ReduceParam.reduce_dims)
 }
-void VariableParam::set_allocated_weights(::deepflow::TensorData* weights) {
-  delete weights_;
-  weights_ = weights;
-  if (weights) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_set_allocated:deepflow.VariableParam.weights)
+const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+ReduceParam::reduce_dims() const {
+  // @@protoc_insertion_point(field_list:deepflow.ReduceParam.reduce_dims)
+  return reduce_dims_;
+}
+::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+ReduceParam::mutable_reduce_dims() {
+  // @@protoc_insertion_point(field_mutable_list:deepflow.ReduceParam.reduce_dims)
+  return &reduce_dims_;
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -12212,85 +12736,143 @@ void VariableParam::set_allocated_weights(::deepflow::TensorData* weights) {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int DataGeneratorParam::kFreqFieldNumber;
+const int SnapshotParam::kSnapshotIntervalFieldNumber;
+const int SnapshotParam::kSnapshotPrefixFieldNumber;
+const int SnapshotParam::kPerImageHeightFieldNumber;
+const int SnapshotParam::kPerImageWidthFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-DataGeneratorParam::DataGeneratorParam()
+SnapshotParam::SnapshotParam()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_deepflow_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:deepflow.DataGeneratorParam)
+  // @@protoc_insertion_point(constructor:deepflow.SnapshotParam)
 }
-DataGeneratorParam::DataGeneratorParam(const DataGeneratorParam& from)
+SnapshotParam::SnapshotParam(const SnapshotParam& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
-  freq_ = from.freq_;
-  // @@protoc_insertion_point(copy_constructor:deepflow.DataGeneratorParam)
+  snapshot_prefix_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.snapshot_prefix().size() > 0) {
+    snapshot_prefix_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.snapshot_prefix_);
+  }
+  ::memcpy(&snapshot_interval_, &from.snapshot_interval_,
+    reinterpret_cast<char*>(&per_image_width_) -
+    reinterpret_cast<char*>(&snapshot_interval_) + sizeof(per_image_width_));
+  // @@protoc_insertion_point(copy_constructor:deepflow.SnapshotParam)
 }
 
-void DataGeneratorParam::SharedCtor() {
-  freq_ = 0;
+void SnapshotParam::SharedCtor() {
+  snapshot_prefix_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::memset(&snapshot_interval_, 0, reinterpret_cast<char*>(&per_image_width_) -
+    reinterpret_cast<char*>(&snapshot_interval_) + sizeof(per_image_width_));
   _cached_size_ = 0;
 }
 
-DataGeneratorParam::~DataGeneratorParam() {
-  // @@protoc_insertion_point(destructor:deepflow.DataGeneratorParam)
+SnapshotParam::~SnapshotParam() {
+  // @@protoc_insertion_point(destructor:deepflow.SnapshotParam)
   SharedDtor();
 }
 
-void DataGeneratorParam::SharedDtor() {
+void SnapshotParam::SharedDtor() {
+  snapshot_prefix_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
 
-void DataGeneratorParam::SetCachedSize(int size) const {
+void SnapshotParam::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* DataGeneratorParam::descriptor() {
+const ::google::protobuf::Descriptor* SnapshotParam::descriptor() {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const DataGeneratorParam& DataGeneratorParam::default_instance() {
+const SnapshotParam& SnapshotParam::default_instance() {
   protobuf_deepflow_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-DataGeneratorParam* DataGeneratorParam::New(::google::protobuf::Arena* arena) const {
-  DataGeneratorParam* n = new DataGeneratorParam;
+SnapshotParam* SnapshotParam::New(::google::protobuf::Arena* arena) const {
+  SnapshotParam* n = new SnapshotParam;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void DataGeneratorParam::Clear() {
-// @@protoc_insertion_point(message_clear_start:deepflow.DataGeneratorParam)
-  freq_ = 0;
+void SnapshotParam::Clear() {
+// @@protoc_insertion_point(message_clear_start:deepflow.SnapshotParam)
+  snapshot_prefix_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::memset(&snapshot_interval_, 0, reinterpret_cast<char*>(&per_image_width_) -
+    reinterpret_cast<char*>(&snapshot_interval_) + sizeof(per_image_width_));
 }
 
-bool DataGeneratorParam::MergePartialFromCodedStream(
+bool SnapshotParam::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:deepflow.DataGeneratorParam)
+  // @@protoc_insertion_point(parse_start:deepflow.SnapshotParam)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // int32 freq = 1;
+      // int32 snapshot_interval = 1;
       case 1: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
             static_cast< ::google::protobuf::uint8>(8u)) {
 
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
                    ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &freq_)));
+                 input, &snapshot_interval_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // string snapshot_prefix = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(18u)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_snapshot_prefix()));
+          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            this->snapshot_prefix().data(), this->snapshot_prefix().length(),
+            ::google::protobuf::internal::WireFormatLite::PARSE,
+            "deepflow.SnapshotParam.snapshot_prefix"));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // int32 per_image_height = 3;
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(24u)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &per_image_height_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // int32 per_image_width = 4;
+      case 4: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(32u)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &per_image_width_)));
         } else {
           goto handle_unusual;
         }
@@ -12310,52 +12892,114 @@ bool DataGeneratorParam::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:deepflow.DataGeneratorParam)
+  // @@protoc_insertion_point(parse_success:deepflow.SnapshotParam)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:deepflow.DataGeneratorParam)
+  // @@protoc_insertion_point(parse_failure:deepflow.SnapshotParam)
   return false;
 #undef DO_
 }
 
-void DataGeneratorParam::SerializeWithCachedSizes(
+void SnapshotParam::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:deepflow.DataGeneratorParam)
+  // @@protoc_insertion_point(serialize_start:deepflow.SnapshotParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // int32 freq = 1;
-  if (this->freq() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->freq(), output);
+  // int32 snapshot_interval = 1;
+  if (this->snapshot_interval() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->snapshot_interval(), output);
   }
 
-  // @@protoc_insertion_point(serialize_end:deepflow.DataGeneratorParam)
+  // string snapshot_prefix = 2;
+  if (this->snapshot_prefix().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->snapshot_prefix().data(), this->snapshot_prefix().length(),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "deepflow.SnapshotParam.snapshot_prefix");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      2, this->snapshot_prefix(), output);
+  }
+
+  // int32 per_image_height = 3;
+  if (this->per_image_height() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(3, this->per_image_height(), output);
+  }
+
+  // int32 per_image_width = 4;
+  if (this->per_image_width() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(4, this->per_image_width(), output);
+  }
+
+  // @@protoc_insertion_point(serialize_end:deepflow.SnapshotParam)
 }
 
-::google::protobuf::uint8* DataGeneratorParam::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* SnapshotParam::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:deepflow.DataGeneratorParam)
+  // @@protoc_insertion_point(serialize_to_array_start:deepflow.SnapshotParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // int32 freq = 1;
-  if (this->freq() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->freq(), target);
+  // int32 snapshot_interval = 1;
+  if (this->snapshot_interval() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->snapshot_interval(), target);
   }
 
-  // @@protoc_insertion_point(serialize_to_array_end:deepflow.DataGeneratorParam)
+  // string snapshot_prefix = 2;
+  if (this->snapshot_prefix().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->snapshot_prefix().data(), this->snapshot_prefix().length(),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "deepflow.SnapshotParam.snapshot_prefix");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        2, this->snapshot_prefix(), target);
+  }
+
+  // int32 per_image_height = 3;
+  if (this->per_image_height() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(3, this->per_image_height(), target);
+  }
+
+  // int32 per_image_width = 4;
+  if (this->per_image_width() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(4, this->per_image_width(), target);
+  }
+
+  // @@protoc_insertion_point(serialize_to_array_end:deepflow.SnapshotParam)
   return target;
 }
 
-size_t DataGeneratorParam::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:deepflow.DataGeneratorParam)
+size_t SnapshotParam::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:deepflow.SnapshotParam)
   size_t total_size = 0;
 
-  // int32 freq = 1;
-  if (this->freq() != 0) {
+  // string snapshot_prefix = 2;
+  if (this->snapshot_prefix().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::StringSize(
+        this->snapshot_prefix());
+  }
+
+  // int32 snapshot_interval = 1;
+  if (this->snapshot_interval() != 0) {
     total_size += 1 +
       ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->freq());
+        this->snapshot_interval());
+  }
+
+  // int32 per_image_height = 3;
+  if (this->per_image_height() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::Int32Size(
+        this->per_image_height());
+  }
+
+  // int32 per_image_width = 4;
+  if (this->per_image_width() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::Int32Size(
+        this->per_image_width());
   }
 
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
@@ -12365,80 +13009,174 @@ size_t DataGeneratorParam::ByteSizeLong() const {
   return total_size;
 }
 
-void DataGeneratorParam::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:deepflow.DataGeneratorParam)
+void SnapshotParam::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:deepflow.SnapshotParam)
   GOOGLE_DCHECK_NE(&from, this);
-  const DataGeneratorParam* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const DataGeneratorParam>(
+  const SnapshotParam* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const SnapshotParam>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.DataGeneratorParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.SnapshotParam)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.DataGeneratorParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.SnapshotParam)
     MergeFrom(*source);
   }
 }
 
-void DataGeneratorParam::MergeFrom(const DataGeneratorParam& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.DataGeneratorParam)
+void SnapshotParam::MergeFrom(const SnapshotParam& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.SnapshotParam)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.freq() != 0) {
-    set_freq(from.freq());
+  if (from.snapshot_prefix().size() > 0) {
+
+    snapshot_prefix_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.snapshot_prefix_);
+  }
+  if (from.snapshot_interval() != 0) {
+    set_snapshot_interval(from.snapshot_interval());
+  }
+  if (from.per_image_height() != 0) {
+    set_per_image_height(from.per_image_height());
+  }
+  if (from.per_image_width() != 0) {
+    set_per_image_width(from.per_image_width());
   }
 }
 
-void DataGeneratorParam::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:deepflow.DataGeneratorParam)
+void SnapshotParam::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:deepflow.SnapshotParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void DataGeneratorParam::CopyFrom(const DataGeneratorParam& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.DataGeneratorParam)
+void SnapshotParam::CopyFrom(const SnapshotParam& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.SnapshotParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool DataGeneratorParam::IsInitialized() const {
+bool SnapshotParam::IsInitialized() const {
   return true;
 }
 
-void DataGeneratorParam::Swap(DataGeneratorParam* other) {
+void SnapshotParam::Swap(SnapshotParam* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void DataGeneratorParam::InternalSwap(DataGeneratorParam* other) {
-  std::swap(freq_, other->freq_);
+void SnapshotParam::InternalSwap(SnapshotParam* other) {
+  snapshot_prefix_.Swap(&other->snapshot_prefix_);
+  std::swap(snapshot_interval_, other->snapshot_interval_);
+  std::swap(per_image_height_, other->per_image_height_);
+  std::swap(per_image_width_, other->per_image_width_);
   std::swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata DataGeneratorParam::GetMetadata() const {
+::google::protobuf::Metadata SnapshotParam::GetMetadata() const {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// DataGeneratorParam
+// SnapshotParam
 
-// int32 freq = 1;
-void DataGeneratorParam::clear_freq() {
-  freq_ = 0;
+// int32 snapshot_interval = 1;
+void SnapshotParam::clear_snapshot_interval() {
+  snapshot_interval_ = 0;
 }
-::google::protobuf::int32 DataGeneratorParam::freq() const {
-  // @@protoc_insertion_point(field_get:deepflow.DataGeneratorParam.freq)
-  return freq_;
+::google::protobuf::int32 SnapshotParam::snapshot_interval() const {
+  // @@protoc_insertion_point(field_get:deepflow.SnapshotParam.snapshot_interval)
+  return snapshot_interval_;
 }
-void DataGeneratorParam::set_freq(::google::protobuf::int32 value) {
+void SnapshotParam::set_snapshot_interval(::google::protobuf::int32 value) {
   
-  freq_ = value;
-  // @@protoc_insertion_point(field_set:deepflow.DataGeneratorParam.freq)
+  snapshot_interval_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.SnapshotParam.snapshot_interval)
+}
+
+// string snapshot_prefix = 2;
+void SnapshotParam::clear_snapshot_prefix() {
+  snapshot_prefix_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+const ::std::string& SnapshotParam::snapshot_prefix() const {
+  // @@protoc_insertion_point(field_get:deepflow.SnapshotParam.snapshot_prefix)
+  return snapshot_prefix_.GetNoArena();
+}
+void SnapshotParam::set_snapshot_prefix(const ::std::string& value) {
+  
+  snapshot_prefix_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:deepflow.SnapshotParam.snapshot_prefix)
+}
+#if LANG_CXX11
+void SnapshotParam::set_snapshot_prefix(::std::string&& value) {
+  
+  snapshot_prefix_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:deepflow.SnapshotParam.snapshot_prefix)
+}
+#endif
+void SnapshotParam::set_snapshot_prefix(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  snapshot_prefix_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:deepflow.SnapshotParam.snapshot_prefix)
+}
+void SnapshotParam::set_snapshot_prefix(const char* value, size_t size) {
+  
+  snapshot_prefix_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:deepflow.SnapshotParam.snapshot_prefix)
+}
+::std::string* SnapshotParam::mutable_snapshot_prefix() {
+  
+  // @@protoc_insertion_point(field_mutable:deepflow.SnapshotParam.snapshot_prefix)
+  return snapshot_prefix_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+::std::string* SnapshotParam::release_snapshot_prefix() {
+  // @@protoc_insertion_point(field_release:deepflow.SnapshotParam.snapshot_prefix)
+  
+  return snapshot_prefix_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+void SnapshotParam::set_allocated_snapshot_prefix(::std::string* snapshot_prefix) {
+  if (snapshot_prefix != NULL) {
+    
+  } else {
+    
+  }
+  snapshot_prefix_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), snapshot_prefix);
+  // @@protoc_insertion_point(field_set_allocated:deepflow.SnapshotParam.snapshot_prefix)
+}
+
+// int32 per_image_height = 3;
+void SnapshotParam::clear_per_image_height() {
+  per_image_height_ = 0;
+}
+::google::protobuf::int32 SnapshotParam::per_image_height() const {
+  // @@protoc_insertion_point(field_get:deepflow.SnapshotParam.per_image_height)
+  return per_image_height_;
+}
+void SnapshotParam::set_per_image_height(::google::protobuf::int32 value) {
+  
+  per_image_height_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.SnapshotParam.per_image_height)
+}
+
+// int32 per_image_width = 4;
+void SnapshotParam::clear_per_image_width() {
+  per_image_width_ = 0;
+}
+::google::protobuf::int32 SnapshotParam::per_image_width() const {
+  // @@protoc_insertion_point(field_get:deepflow.SnapshotParam.per_image_width)
+  return per_image_width_;
+}
+void SnapshotParam::set_per_image_width(::google::protobuf::int32 value) {
+  
+  per_image_width_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.SnapshotParam.per_image_width)
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -12446,105 +13184,93 @@ void DataGeneratorParam::set_freq(::google::protobuf::int32 value) {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int ActivationParam::kTypeFieldNumber;
-const int ActivationParam::kCoefFieldNumber;
+const int PlaceHolderParam::kTensorParamFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-ActivationParam::ActivationParam()
+PlaceHolderParam::PlaceHolderParam()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_deepflow_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:deepflow.ActivationParam)
+  // @@protoc_insertion_point(constructor:deepflow.PlaceHolderParam)
 }
-ActivationParam::ActivationParam(const ActivationParam& from)
+PlaceHolderParam::PlaceHolderParam(const PlaceHolderParam& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::memcpy(&type_, &from.type_,
-    reinterpret_cast<char*>(&coef_) -
-    reinterpret_cast<char*>(&type_) + sizeof(coef_));
-  // @@protoc_insertion_point(copy_constructor:deepflow.ActivationParam)
+  if (from.has_tensor_param()) {
+    tensor_param_ = new ::deepflow::TensorParam(*from.tensor_param_);
+  } else {
+    tensor_param_ = NULL;
+  }
+  // @@protoc_insertion_point(copy_constructor:deepflow.PlaceHolderParam)
 }
 
-void ActivationParam::SharedCtor() {
-  ::memset(&type_, 0, reinterpret_cast<char*>(&coef_) -
-    reinterpret_cast<char*>(&type_) + sizeof(coef_));
+void PlaceHolderParam::SharedCtor() {
+  tensor_param_ = NULL;
   _cached_size_ = 0;
 }
 
-ActivationParam::~ActivationParam() {
-  // @@protoc_insertion_point(destructor:deepflow.ActivationParam)
+PlaceHolderParam::~PlaceHolderParam() {
+  // @@protoc_insertion_point(destructor:deepflow.PlaceHolderParam)
   SharedDtor();
 }
 
-void ActivationParam::SharedDtor() {
+void PlaceHolderParam::SharedDtor() {
+  if (this != internal_default_instance()) {
+    delete tensor_param_;
+  }
 }
 
-void ActivationParam::SetCachedSize(int size) const {
+void PlaceHolderParam::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* ActivationParam::descriptor() {
+const ::google::protobuf::Descriptor* PlaceHolderParam::descriptor() {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const ActivationParam& ActivationParam::default_instance() {
+const PlaceHolderParam& PlaceHolderParam::default_instance() {
   protobuf_deepflow_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-ActivationParam* ActivationParam::New(::google::protobuf::Arena* arena) const {
-  ActivationParam* n = new ActivationParam;
+PlaceHolderParam* PlaceHolderParam::New(::google::protobuf::Arena* arena) const {
+  PlaceHolderParam* n = new PlaceHolderParam;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void ActivationParam::Clear() {
-// @@protoc_insertion_point(message_clear_start:deepflow.ActivationParam)
-  ::memset(&type_, 0, reinterpret_cast<char*>(&coef_) -
-    reinterpret_cast<char*>(&type_) + sizeof(coef_));
+void PlaceHolderParam::Clear() {
+// @@protoc_insertion_point(message_clear_start:deepflow.PlaceHolderParam)
+  if (GetArenaNoVirtual() == NULL && tensor_param_ != NULL) {
+    delete tensor_param_;
+  }
+  tensor_param_ = NULL;
 }
 
-bool ActivationParam::MergePartialFromCodedStream(
+bool PlaceHolderParam::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:deepflow.ActivationParam)
+  // @@protoc_insertion_point(parse_start:deepflow.PlaceHolderParam)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // .deepflow.ActivationParam.Type type = 1;
+      // .deepflow.TensorParam tensor_param = 1;
       case 1: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u)) {
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          set_type(static_cast< ::deepflow::ActivationParam_Type >(value));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // float coef = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(21u)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &coef_)));
+            static_cast< ::google::protobuf::uint8>(10u)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_tensor_param()));
         } else {
           goto handle_unusual;
         }
@@ -12564,68 +13290,55 @@ bool ActivationParam::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:deepflow.ActivationParam)
+  // @@protoc_insertion_point(parse_success:deepflow.PlaceHolderParam)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:deepflow.ActivationParam)
+  // @@protoc_insertion_point(parse_failure:deepflow.PlaceHolderParam)
   return false;
 #undef DO_
 }
 
-void ActivationParam::SerializeWithCachedSizes(
+void PlaceHolderParam::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:deepflow.ActivationParam)
+  // @@protoc_insertion_point(serialize_start:deepflow.PlaceHolderParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .deepflow.ActivationParam.Type type = 1;
-  if (this->type() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      1, this->type(), output);
-  }
-
-  // float coef = 2;
-  if (this->coef() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(2, this->coef(), output);
+  // .deepflow.TensorParam tensor_param = 1;
+  if (this->has_tensor_param()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      1, *this->tensor_param_, output);
   }
 
-  // @@protoc_insertion_point(serialize_end:deepflow.ActivationParam)
+  // @@protoc_insertion_point(serialize_end:deepflow.PlaceHolderParam)
 }
 
-::google::protobuf::uint8* ActivationParam::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* PlaceHolderParam::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:deepflow.ActivationParam)
+  // @@protoc_insertion_point(serialize_to_array_start:deepflow.PlaceHolderParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .deepflow.ActivationParam.Type type = 1;
-  if (this->type() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      1, this->type(), target);
-  }
-
-  // float coef = 2;
-  if (this->coef() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(2, this->coef(), target);
+  // .deepflow.TensorParam tensor_param = 1;
+  if (this->has_tensor_param()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        1, *this->tensor_param_, deterministic, target);
   }
 
-  // @@protoc_insertion_point(serialize_to_array_end:deepflow.ActivationParam)
+  // @@protoc_insertion_point(serialize_to_array_end:deepflow.PlaceHolderParam)
   return target;
 }
 
-size_t ActivationParam::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:deepflow.ActivationParam)
+size_t PlaceHolderParam::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:deepflow.PlaceHolderParam)
   size_t total_size = 0;
 
-  // .deepflow.ActivationParam.Type type = 1;
-  if (this->type() != 0) {
+  // .deepflow.TensorParam tensor_param = 1;
+  if (this->has_tensor_param()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::EnumSize(this->type());
-  }
-
-  // float coef = 2;
-  if (this->coef() != 0) {
-    total_size += 1 + 4;
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        *this->tensor_param_);
   }
 
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
@@ -12635,98 +13348,105 @@ size_t ActivationParam::ByteSizeLong() const {
   return total_size;
 }
 
-void ActivationParam::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:deepflow.ActivationParam)
+void PlaceHolderParam::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:deepflow.PlaceHolderParam)
   GOOGLE_DCHECK_NE(&from, this);
-  const ActivationParam* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const ActivationParam>(
+  const PlaceHolderParam* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const PlaceHolderParam>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.ActivationParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.PlaceHolderParam)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.ActivationParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.PlaceHolderParam)
     MergeFrom(*source);
   }
 }
 
-void ActivationParam::MergeFrom(const ActivationParam& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.ActivationParam)
+void PlaceHolderParam::MergeFrom(const PlaceHolderParam& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.PlaceHolderParam)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.type() != 0) {
-    set_type(from.type());
-  }
-  if (from.coef() != 0) {
-    set_coef(from.coef());
+  if (from.has_tensor_param()) {
+    mutable_tensor_param()->::deepflow::TensorParam::MergeFrom(from.tensor_param());
   }
 }
 
-void ActivationParam::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:deepflow.ActivationParam)
+void PlaceHolderParam::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:deepflow.PlaceHolderParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void ActivationParam::CopyFrom(const ActivationParam& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.ActivationParam)
+void PlaceHolderParam::CopyFrom(const PlaceHolderParam& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.PlaceHolderParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool ActivationParam::IsInitialized() const {
+bool PlaceHolderParam::IsInitialized() const {
   return true;
 }
 
-void ActivationParam::Swap(ActivationParam* other) {
+void PlaceHolderParam::Swap(PlaceHolderParam* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void ActivationParam::InternalSwap(ActivationParam* other) {
-  std::swap(type_, other->type_);
-  std::swap(coef_, other->coef_);
+void PlaceHolderParam::InternalSwap(PlaceHolderParam* other) {
+  std::swap(tensor_param_, other->tensor_param_);
   std::swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata ActivationParam::GetMetadata() const {
+::google::protobuf::Metadata PlaceHolderParam::GetMetadata() const {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// ActivationParam
+// PlaceHolderParam
 
-// .deepflow.ActivationParam.Type type = 1;
-void ActivationParam::clear_type() {
-  type_ = 0;
-}
-::deepflow::ActivationParam_Type ActivationParam::type() const {
-  // @@protoc_insertion_point(field_get:deepflow.ActivationParam.type)
-  return static_cast< ::deepflow::ActivationParam_Type >(type_);
+// .deepflow.TensorParam tensor_param = 1;
+bool PlaceHolderParam::has_tensor_param() const {
+  return this != internal_default_instance() && tensor_param_ != NULL;
 }
-void ActivationParam::set_type(::deepflow::ActivationParam_Type value) {
-  
-  type_ = value;
-  // @@protoc_insertion_point(field_set:deepflow.ActivationParam.type)
+void PlaceHolderParam::clear_tensor_param() {
+  if (GetArenaNoVirtual() == NULL && tensor_param_ != NULL) delete tensor_param_;
+  tensor_param_ = NULL;
 }
-
-// float coef = 2;
-void ActivationParam::clear_coef() {
-  coef_ = 0;
+const ::deepflow::TensorParam& PlaceHolderParam::tensor_param() const {
+  // @@protoc_insertion_point(field_get:deepflow.PlaceHolderParam.tensor_param)
+  return tensor_param_ != NULL ? *tensor_param_
+                         : *::deepflow::TensorParam::internal_default_instance();
 }
-float ActivationParam::coef() const {
-  // @@protoc_insertion_point(field_get:deepflow.ActivationParam.coef)
-  return coef_;
+::deepflow::TensorParam* PlaceHolderParam::mutable_tensor_param() {
+  
+  if (tensor_param_ == NULL) {
+    tensor_param_ = new ::deepflow::TensorParam;
+  }
+  // @@protoc_insertion_point(field_mutable:deepflow.PlaceHolderParam.tensor_param)
+  return tensor_param_;
 }
-void ActivationParam::set_coef(float value) {
+::deepflow::TensorParam* PlaceHolderParam::release_tensor_param() {
+  // @@protoc_insertion_point(field_release:deepflow.PlaceHolderParam.tensor_param)
   
-  coef_ = value;
-  // @@protoc_insertion_point(field_set:deepflow.ActivationParam.coef)
+  ::deepflow::TensorParam* temp = tensor_param_;
+  tensor_param_ = NULL;
+  return temp;
+}
+void PlaceHolderParam::set_allocated_tensor_param(::deepflow::TensorParam* tensor_param) {
+  delete tensor_param_;
+  tensor_param_ = tensor_param;
+  if (tensor_param) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:deepflow.PlaceHolderParam.tensor_param)
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -12734,153 +13454,104 @@ void ActivationParam::set_coef(float value) {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int ImageBatchReaderParam::kFolderPathFieldNumber;
-const int ImageBatchReaderParam::kTensorParamFieldNumber;
-const int ImageBatchReaderParam::kRandomizeFieldNumber;
-const int ImageBatchReaderParam::kBetween0And1FieldNumber;
+const int RestructureParam::kFirstDimFieldNumber;
+const int RestructureParam::kSecondDimFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-ImageBatchReaderParam::ImageBatchReaderParam()
+RestructureParam::RestructureParam()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_deepflow_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:deepflow.ImageBatchReaderParam)
+  // @@protoc_insertion_point(constructor:deepflow.RestructureParam)
 }
-ImageBatchReaderParam::ImageBatchReaderParam(const ImageBatchReaderParam& from)
+RestructureParam::RestructureParam(const RestructureParam& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
-  folder_path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.folder_path().size() > 0) {
-    folder_path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.folder_path_);
-  }
-  if (from.has_tensor_param()) {
-    tensor_param_ = new ::deepflow::TensorParam(*from.tensor_param_);
-  } else {
-    tensor_param_ = NULL;
-  }
-  ::memcpy(&randomize_, &from.randomize_,
-    reinterpret_cast<char*>(&between_0_and_1_) -
-    reinterpret_cast<char*>(&randomize_) + sizeof(between_0_and_1_));
-  // @@protoc_insertion_point(copy_constructor:deepflow.ImageBatchReaderParam)
+  ::memcpy(&first_dim_, &from.first_dim_,
+    reinterpret_cast<char*>(&second_dim_) -
+    reinterpret_cast<char*>(&first_dim_) + sizeof(second_dim_));
+  // @@protoc_insertion_point(copy_constructor:deepflow.RestructureParam)
 }
 
-void ImageBatchReaderParam::SharedCtor() {
-  folder_path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&tensor_param_, 0, reinterpret_cast<char*>(&between_0_and_1_) -
-    reinterpret_cast<char*>(&tensor_param_) + sizeof(between_0_and_1_));
+void RestructureParam::SharedCtor() {
+  ::memset(&first_dim_, 0, reinterpret_cast<char*>(&second_dim_) -
+    reinterpret_cast<char*>(&first_dim_) + sizeof(second_dim_));
   _cached_size_ = 0;
 }
 
-ImageBatchReaderParam::~ImageBatchReaderParam() {
-  // @@protoc_insertion_point(destructor:deepflow.ImageBatchReaderParam)
+RestructureParam::~RestructureParam() {
+  // @@protoc_insertion_point(destructor:deepflow.RestructureParam)
   SharedDtor();
 }
 
-void ImageBatchReaderParam::SharedDtor() {
-  folder_path_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (this != internal_default_instance()) {
-    delete tensor_param_;
-  }
+void RestructureParam::SharedDtor() {
 }
 
-void ImageBatchReaderParam::SetCachedSize(int size) const {
+void RestructureParam::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* ImageBatchReaderParam::descriptor() {
+const ::google::protobuf::Descriptor* RestructureParam::descriptor() {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const ImageBatchReaderParam& ImageBatchReaderParam::default_instance() {
+const RestructureParam& RestructureParam::default_instance() {
   protobuf_deepflow_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-ImageBatchReaderParam* ImageBatchReaderParam::New(::google::protobuf::Arena* arena) const {
-  ImageBatchReaderParam* n = new ImageBatchReaderParam;
+RestructureParam* RestructureParam::New(::google::protobuf::Arena* arena) const {
+  RestructureParam* n = new RestructureParam;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void ImageBatchReaderParam::Clear() {
-// @@protoc_insertion_point(message_clear_start:deepflow.ImageBatchReaderParam)
-  folder_path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (GetArenaNoVirtual() == NULL && tensor_param_ != NULL) {
-    delete tensor_param_;
-  }
-  tensor_param_ = NULL;
-  ::memset(&randomize_, 0, reinterpret_cast<char*>(&between_0_and_1_) -
-    reinterpret_cast<char*>(&randomize_) + sizeof(between_0_and_1_));
+void RestructureParam::Clear() {
+// @@protoc_insertion_point(message_clear_start:deepflow.RestructureParam)
+  ::memset(&first_dim_, 0, reinterpret_cast<char*>(&second_dim_) -
+    reinterpret_cast<char*>(&first_dim_) + sizeof(second_dim_));
 }
 
-bool ImageBatchReaderParam::MergePartialFromCodedStream(
+bool RestructureParam::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:deepflow.ImageBatchReaderParam)
+  // @@protoc_insertion_point(parse_start:deepflow.RestructureParam)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // string folder_path = 1;
+      // int32 first_dim = 1;
       case 1: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_folder_path()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->folder_path().data(), this->folder_path().length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "deepflow.ImageBatchReaderParam.folder_path"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // .deepflow.TensorParam tensor_param = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_tensor_param()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // bool randomize = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(24u)) {
+            static_cast< ::google::protobuf::uint8>(8u)) {
 
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &randomize_)));
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &first_dim_)));
         } else {
           goto handle_unusual;
         }
         break;
       }
 
-      // bool between_0_and_1 = 4;
-      case 4: {
+      // int32 second_dim = 2;
+      case 2: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(32u)) {
+            static_cast< ::google::protobuf::uint8>(16u)) {
 
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &between_0_and_1_)));
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &second_dim_)));
         } else {
           goto handle_unusual;
         }
@@ -12900,113 +13571,69 @@ bool ImageBatchReaderParam::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:deepflow.ImageBatchReaderParam)
+  // @@protoc_insertion_point(parse_success:deepflow.RestructureParam)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:deepflow.ImageBatchReaderParam)
+  // @@protoc_insertion_point(parse_failure:deepflow.RestructureParam)
   return false;
 #undef DO_
 }
 
-void ImageBatchReaderParam::SerializeWithCachedSizes(
+void RestructureParam::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:deepflow.ImageBatchReaderParam)
+  // @@protoc_insertion_point(serialize_start:deepflow.RestructureParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string folder_path = 1;
-  if (this->folder_path().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->folder_path().data(), this->folder_path().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "deepflow.ImageBatchReaderParam.folder_path");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->folder_path(), output);
-  }
-
-  // .deepflow.TensorParam tensor_param = 2;
-  if (this->has_tensor_param()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, *this->tensor_param_, output);
-  }
-
-  // bool randomize = 3;
-  if (this->randomize() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(3, this->randomize(), output);
+  // int32 first_dim = 1;
+  if (this->first_dim() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->first_dim(), output);
   }
 
-  // bool between_0_and_1 = 4;
-  if (this->between_0_and_1() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(4, this->between_0_and_1(), output);
+  // int32 second_dim = 2;
+  if (this->second_dim() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(2, this->second_dim(), output);
   }
 
-  // @@protoc_insertion_point(serialize_end:deepflow.ImageBatchReaderParam)
+  // @@protoc_insertion_point(serialize_end:deepflow.RestructureParam)
 }
 
-::google::protobuf::uint8* ImageBatchReaderParam::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* RestructureParam::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:deepflow.ImageBatchReaderParam)
+  // @@protoc_insertion_point(serialize_to_array_start:deepflow.RestructureParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string folder_path = 1;
-  if (this->folder_path().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->folder_path().data(), this->folder_path().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "deepflow.ImageBatchReaderParam.folder_path");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->folder_path(), target);
-  }
-
-  // .deepflow.TensorParam tensor_param = 2;
-  if (this->has_tensor_param()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageNoVirtualToArray(
-        2, *this->tensor_param_, deterministic, target);
-  }
-
-  // bool randomize = 3;
-  if (this->randomize() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(3, this->randomize(), target);
+  // int32 first_dim = 1;
+  if (this->first_dim() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->first_dim(), target);
   }
 
-  // bool between_0_and_1 = 4;
-  if (this->between_0_and_1() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(4, this->between_0_and_1(), target);
+  // int32 second_dim = 2;
+  if (this->second_dim() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(2, this->second_dim(), target);
   }
 
-  // @@protoc_insertion_point(serialize_to_array_end:deepflow.ImageBatchReaderParam)
+  // @@protoc_insertion_point(serialize_to_array_end:deepflow.RestructureParam)
   return target;
 }
 
-size_t ImageBatchReaderParam::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:deepflow.ImageBatchReaderParam)
+size_t RestructureParam::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:deepflow.RestructureParam)
   size_t total_size = 0;
 
-  // string folder_path = 1;
-  if (this->folder_path().size() > 0) {
+  // int32 first_dim = 1;
+  if (this->first_dim() != 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->folder_path());
+      ::google::protobuf::internal::WireFormatLite::Int32Size(
+        this->first_dim());
   }
 
-  // .deepflow.TensorParam tensor_param = 2;
-  if (this->has_tensor_param()) {
+  // int32 second_dim = 2;
+  if (this->second_dim() != 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        *this->tensor_param_);
-  }
-
-  // bool randomize = 3;
-  if (this->randomize() != 0) {
-    total_size += 1 + 1;
-  }
-
-  // bool between_0_and_1 = 4;
-  if (this->between_0_and_1() != 0) {
-    total_size += 1 + 1;
+      ::google::protobuf::internal::WireFormatLite::Int32Size(
+        this->second_dim());
   }
 
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
@@ -13016,199 +13643,98 @@ size_t ImageBatchReaderParam::ByteSizeLong() const {
   return total_size;
 }
 
-void ImageBatchReaderParam::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:deepflow.ImageBatchReaderParam)
+void RestructureParam::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:deepflow.RestructureParam)
   GOOGLE_DCHECK_NE(&from, this);
-  const ImageBatchReaderParam* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const ImageBatchReaderParam>(
+  const RestructureParam* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const RestructureParam>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.ImageBatchReaderParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.RestructureParam)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.ImageBatchReaderParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.RestructureParam)
     MergeFrom(*source);
   }
 }
 
-void ImageBatchReaderParam::MergeFrom(const ImageBatchReaderParam& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.ImageBatchReaderParam)
+void RestructureParam::MergeFrom(const RestructureParam& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.RestructureParam)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.folder_path().size() > 0) {
-
-    folder_path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.folder_path_);
-  }
-  if (from.has_tensor_param()) {
-    mutable_tensor_param()->::deepflow::TensorParam::MergeFrom(from.tensor_param());
-  }
-  if (from.randomize() != 0) {
-    set_randomize(from.randomize());
+  if (from.first_dim() != 0) {
+    set_first_dim(from.first_dim());
   }
-  if (from.between_0_and_1() != 0) {
-    set_between_0_and_1(from.between_0_and_1());
+  if (from.second_dim() != 0) {
+    set_second_dim(from.second_dim());
   }
 }
 
-void ImageBatchReaderParam::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:deepflow.ImageBatchReaderParam)
+void RestructureParam::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:deepflow.RestructureParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void ImageBatchReaderParam::CopyFrom(const ImageBatchReaderParam& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.ImageBatchReaderParam)
+void RestructureParam::CopyFrom(const RestructureParam& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.RestructureParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool ImageBatchReaderParam::IsInitialized() const {
+bool RestructureParam::IsInitialized() const {
   return true;
 }
 
-void ImageBatchReaderParam::Swap(ImageBatchReaderParam* other) {
+void RestructureParam::Swap(RestructureParam* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void ImageBatchReaderParam::InternalSwap(ImageBatchReaderParam* other) {
-  folder_path_.Swap(&other->folder_path_);
-  std::swap(tensor_param_, other->tensor_param_);
-  std::swap(randomize_, other->randomize_);
-  std::swap(between_0_and_1_, other->between_0_and_1_);
+void RestructureParam::InternalSwap(RestructureParam* other) {
+  std::swap(first_dim_, other->first_dim_);
+  std::swap(second_dim_, other->second_dim_);
   std::swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata ImageBatchReaderParam::GetMetadata() const {
+::google::protobuf::Metadata RestructureParam::GetMetadata() const {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// ImageBatchReaderParam
-
-// string folder_path = 1;
-void ImageBatchReaderParam::clear_folder_path() {
-  folder_path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-const ::std::string& ImageBatchReaderParam::folder_path() const {
-  // @@protoc_insertion_point(field_get:deepflow.ImageBatchReaderParam.folder_path)
-  return folder_path_.GetNoArena();
-}
-void ImageBatchReaderParam::set_folder_path(const ::std::string& value) {
-  
-  folder_path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:deepflow.ImageBatchReaderParam.folder_path)
-}
-#if LANG_CXX11
-void ImageBatchReaderParam::set_folder_path(::std::string&& value) {
-  
-  folder_path_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:deepflow.ImageBatchReaderParam.folder_path)
-}
-#endif
-void ImageBatchReaderParam::set_folder_path(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  folder_path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:deepflow.ImageBatchReaderParam.folder_path)
-}
-void ImageBatchReaderParam::set_folder_path(const char* value, size_t size) {
-  
-  folder_path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:deepflow.ImageBatchReaderParam.folder_path)
-}
-::std::string* ImageBatchReaderParam::mutable_folder_path() {
-  
-  // @@protoc_insertion_point(field_mutable:deepflow.ImageBatchReaderParam.folder_path)
-  return folder_path_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-::std::string* ImageBatchReaderParam::release_folder_path() {
-  // @@protoc_insertion_point(field_release:deepflow.ImageBatchReaderParam.folder_path)
-  
-  return folder_path_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-void ImageBatchReaderParam::set_allocated_folder_path(::std::string* folder_path) {
-  if (folder_path != NULL) {
-    
-  } else {
-    
-  }
-  folder_path_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), folder_path);
-  // @@protoc_insertion_point(field_set_allocated:deepflow.ImageBatchReaderParam.folder_path)
-}
-
-// .deepflow.TensorParam tensor_param = 2;
-bool ImageBatchReaderParam::has_tensor_param() const {
-  return this != internal_default_instance() && tensor_param_ != NULL;
-}
-void ImageBatchReaderParam::clear_tensor_param() {
-  if (GetArenaNoVirtual() == NULL && tensor_param_ != NULL) delete tensor_param_;
-  tensor_param_ = NULL;
-}
-const ::deepflow::TensorParam& ImageBatchReaderParam::tensor_param() const {
-  // @@protoc_insertion_point(field_get:deepflow.ImageBatchReaderParam.tensor_param)
-  return tensor_param_ != NULL ? *tensor_param_
-                         : *::deepflow::TensorParam::internal_default_instance();
-}
-::deepflow::TensorParam* ImageBatchReaderParam::mutable_tensor_param() {
-  
-  if (tensor_param_ == NULL) {
-    tensor_param_ = new ::deepflow::TensorParam;
-  }
-  // @@protoc_insertion_point(field_mutable:deepflow.ImageBatchReaderParam.tensor_param)
-  return tensor_param_;
-}
-::deepflow::TensorParam* ImageBatchReaderParam::release_tensor_param() {
-  // @@protoc_insertion_point(field_release:deepflow.ImageBatchReaderParam.tensor_param)
-  
-  ::deepflow::TensorParam* temp = tensor_param_;
-  tensor_param_ = NULL;
-  return temp;
-}
-void ImageBatchReaderParam::set_allocated_tensor_param(::deepflow::TensorParam* tensor_param) {
-  delete tensor_param_;
-  tensor_param_ = tensor_param;
-  if (tensor_param) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_set_allocated:deepflow.ImageBatchReaderParam.tensor_param)
-}
+// RestructureParam
 
-// bool randomize = 3;
-void ImageBatchReaderParam::clear_randomize() {
-  randomize_ = false;
+// int32 first_dim = 1;
+void RestructureParam::clear_first_dim() {
+  first_dim_ = 0;
 }
-bool ImageBatchReaderParam::randomize() const {
-  // @@protoc_insertion_point(field_get:deepflow.ImageBatchReaderParam.randomize)
-  return randomize_;
+::google::protobuf::int32 RestructureParam::first_dim() const {
+  // @@protoc_insertion_point(field_get:deepflow.RestructureParam.first_dim)
+  return first_dim_;
 }
-void ImageBatchReaderParam::set_randomize(bool value) {
+void RestructureParam::set_first_dim(::google::protobuf::int32 value) {
   
-  randomize_ = value;
-  // @@protoc_insertion_point(field_set:deepflow.ImageBatchReaderParam.randomize)
+  first_dim_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.RestructureParam.first_dim)
 }
 
-// bool between_0_and_1 = 4;
-void ImageBatchReaderParam::clear_between_0_and_1() {
-  between_0_and_1_ = false;
+// int32 second_dim = 2;
+void RestructureParam::clear_second_dim() {
+  second_dim_ = 0;
 }
-bool ImageBatchReaderParam::between_0_and_1() const {
-  // @@protoc_insertion_point(field_get:deepflow.ImageBatchReaderParam.between_0_and_1)
-  return between_0_and_1_;
+::google::protobuf::int32 RestructureParam::second_dim() const {
+  // @@protoc_insertion_point(field_get:deepflow.RestructureParam.second_dim)
+  return second_dim_;
 }
-void ImageBatchReaderParam::set_between_0_and_1(bool value) {
+void RestructureParam::set_second_dim(::google::protobuf::int32 value) {
   
-  between_0_and_1_ = value;
-  // @@protoc_insertion_point(field_set:deepflow.ImageBatchReaderParam.between_0_and_1)
+  second_dim_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.RestructureParam.second_dim)
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -13216,110 +13742,143 @@ void ImageBatchReaderParam::set_between_0_and_1(bool value) {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int ImageReaderParam::kFileNameFieldNumber;
-const int ImageReaderParam::kTypeFieldNumber;
+const int VariableParam::kInitParamFieldNumber;
+const int VariableParam::kSolverNameFieldNumber;
+const int VariableParam::kWeightsFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-ImageReaderParam::ImageReaderParam()
+VariableParam::VariableParam()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_deepflow_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:deepflow.ImageReaderParam)
+  // @@protoc_insertion_point(constructor:deepflow.VariableParam)
 }
-ImageReaderParam::ImageReaderParam(const ImageReaderParam& from)
+VariableParam::VariableParam(const VariableParam& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
-  file_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.file_name().size() > 0) {
-    file_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.file_name_);
+  solver_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.solver_name().size() > 0) {
+    solver_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.solver_name_);
   }
-  type_ = from.type_;
-  // @@protoc_insertion_point(copy_constructor:deepflow.ImageReaderParam)
-}
-
-void ImageReaderParam::SharedCtor() {
-  file_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  type_ = 0;
-  _cached_size_ = 0;
-}
-
-ImageReaderParam::~ImageReaderParam() {
-  // @@protoc_insertion_point(destructor:deepflow.ImageReaderParam)
+  if (from.has_init_param()) {
+    init_param_ = new ::deepflow::InitParam(*from.init_param_);
+  } else {
+    init_param_ = NULL;
+  }
+  if (from.has_weights()) {
+    weights_ = new ::deepflow::TensorData(*from.weights_);
+  } else {
+    weights_ = NULL;
+  }
+  // @@protoc_insertion_point(copy_constructor:deepflow.VariableParam)
+}
+
+void VariableParam::SharedCtor() {
+  solver_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::memset(&init_param_, 0, reinterpret_cast<char*>(&weights_) -
+    reinterpret_cast<char*>(&init_param_) + sizeof(weights_));
+  _cached_size_ = 0;
+}
+
+VariableParam::~VariableParam() {
+  // @@protoc_insertion_point(destructor:deepflow.VariableParam)
   SharedDtor();
 }
 
-void ImageReaderParam::SharedDtor() {
-  file_name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+void VariableParam::SharedDtor() {
+  solver_name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (this != internal_default_instance()) {
+    delete init_param_;
+  }
+  if (this != internal_default_instance()) {
+    delete weights_;
+  }
 }
 
-void ImageReaderParam::SetCachedSize(int size) const {
+void VariableParam::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* ImageReaderParam::descriptor() {
+const ::google::protobuf::Descriptor* VariableParam::descriptor() {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const ImageReaderParam& ImageReaderParam::default_instance() {
+const VariableParam& VariableParam::default_instance() {
   protobuf_deepflow_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-ImageReaderParam* ImageReaderParam::New(::google::protobuf::Arena* arena) const {
-  ImageReaderParam* n = new ImageReaderParam;
+VariableParam* VariableParam::New(::google::protobuf::Arena* arena) const {
+  VariableParam* n = new VariableParam;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void ImageReaderParam::Clear() {
-// @@protoc_insertion_point(message_clear_start:deepflow.ImageReaderParam)
-  file_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  type_ = 0;
+void VariableParam::Clear() {
+// @@protoc_insertion_point(message_clear_start:deepflow.VariableParam)
+  solver_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (GetArenaNoVirtual() == NULL && init_param_ != NULL) {
+    delete init_param_;
+  }
+  init_param_ = NULL;
+  if (GetArenaNoVirtual() == NULL && weights_ != NULL) {
+    delete weights_;
+  }
+  weights_ = NULL;
 }
 
-bool ImageReaderParam::MergePartialFromCodedStream(
+bool VariableParam::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:deepflow.ImageReaderParam)
+  // @@protoc_insertion_point(parse_start:deepflow.VariableParam)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // string file_name = 1;
+      // .deepflow.InitParam init_param = 1;
       case 1: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
             static_cast< ::google::protobuf::uint8>(10u)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_init_param()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // string solver_name = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(18u)) {
           DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_file_name()));
+                input, this->mutable_solver_name()));
           DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->file_name().data(), this->file_name().length(),
+            this->solver_name().data(), this->solver_name().length(),
             ::google::protobuf::internal::WireFormatLite::PARSE,
-            "deepflow.ImageReaderParam.file_name"));
+            "deepflow.VariableParam.solver_name"));
         } else {
           goto handle_unusual;
         }
         break;
       }
 
-      // .deepflow.ImageReaderParam.Type type = 2;
-      case 2: {
+      // .deepflow.TensorData weights = 3;
+      case 3: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(16u)) {
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          set_type(static_cast< ::deepflow::ImageReaderParam_Type >(value));
+            static_cast< ::google::protobuf::uint8>(26u)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_weights()));
         } else {
           goto handle_unusual;
         }
@@ -13339,81 +13898,103 @@ bool ImageReaderParam::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:deepflow.ImageReaderParam)
+  // @@protoc_insertion_point(parse_success:deepflow.VariableParam)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:deepflow.ImageReaderParam)
+  // @@protoc_insertion_point(parse_failure:deepflow.VariableParam)
   return false;
 #undef DO_
 }
 
-void ImageReaderParam::SerializeWithCachedSizes(
+void VariableParam::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:deepflow.ImageReaderParam)
+  // @@protoc_insertion_point(serialize_start:deepflow.VariableParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string file_name = 1;
-  if (this->file_name().size() > 0) {
+  // .deepflow.InitParam init_param = 1;
+  if (this->has_init_param()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      1, *this->init_param_, output);
+  }
+
+  // string solver_name = 2;
+  if (this->solver_name().size() > 0) {
     ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->file_name().data(), this->file_name().length(),
+      this->solver_name().data(), this->solver_name().length(),
       ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "deepflow.ImageReaderParam.file_name");
+      "deepflow.VariableParam.solver_name");
     ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->file_name(), output);
+      2, this->solver_name(), output);
   }
 
-  // .deepflow.ImageReaderParam.Type type = 2;
-  if (this->type() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      2, this->type(), output);
+  // .deepflow.TensorData weights = 3;
+  if (this->has_weights()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      3, *this->weights_, output);
   }
 
-  // @@protoc_insertion_point(serialize_end:deepflow.ImageReaderParam)
+  // @@protoc_insertion_point(serialize_end:deepflow.VariableParam)
 }
 
-::google::protobuf::uint8* ImageReaderParam::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* VariableParam::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:deepflow.ImageReaderParam)
+  // @@protoc_insertion_point(serialize_to_array_start:deepflow.VariableParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string file_name = 1;
-  if (this->file_name().size() > 0) {
+  // .deepflow.InitParam init_param = 1;
+  if (this->has_init_param()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        1, *this->init_param_, deterministic, target);
+  }
+
+  // string solver_name = 2;
+  if (this->solver_name().size() > 0) {
     ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->file_name().data(), this->file_name().length(),
+      this->solver_name().data(), this->solver_name().length(),
       ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "deepflow.ImageReaderParam.file_name");
+      "deepflow.VariableParam.solver_name");
     target =
       ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->file_name(), target);
+        2, this->solver_name(), target);
   }
 
-  // .deepflow.ImageReaderParam.Type type = 2;
-  if (this->type() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      2, this->type(), target);
+  // .deepflow.TensorData weights = 3;
+  if (this->has_weights()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        3, *this->weights_, deterministic, target);
   }
 
-  // @@protoc_insertion_point(serialize_to_array_end:deepflow.ImageReaderParam)
+  // @@protoc_insertion_point(serialize_to_array_end:deepflow.VariableParam)
   return target;
 }
 
-size_t ImageReaderParam::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:deepflow.ImageReaderParam)
+size_t VariableParam::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:deepflow.VariableParam)
   size_t total_size = 0;
 
-  // string file_name = 1;
-  if (this->file_name().size() > 0) {
+  // string solver_name = 2;
+  if (this->solver_name().size() > 0) {
     total_size += 1 +
       ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->file_name());
+        this->solver_name());
   }
 
-  // .deepflow.ImageReaderParam.Type type = 2;
-  if (this->type() != 0) {
+  // .deepflow.InitParam init_param = 1;
+  if (this->has_init_param()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::EnumSize(this->type());
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        *this->init_param_);
+  }
+
+  // .deepflow.TensorData weights = 3;
+  if (this->has_weights()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        *this->weights_);
   }
 
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
@@ -13423,138 +14004,206 @@ size_t ImageReaderParam::ByteSizeLong() const {
   return total_size;
 }
 
-void ImageReaderParam::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:deepflow.ImageReaderParam)
+void VariableParam::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:deepflow.VariableParam)
   GOOGLE_DCHECK_NE(&from, this);
-  const ImageReaderParam* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const ImageReaderParam>(
+  const VariableParam* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const VariableParam>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.ImageReaderParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.VariableParam)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.ImageReaderParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.VariableParam)
     MergeFrom(*source);
   }
 }
 
-void ImageReaderParam::MergeFrom(const ImageReaderParam& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.ImageReaderParam)
+void VariableParam::MergeFrom(const VariableParam& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.VariableParam)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.file_name().size() > 0) {
+  if (from.solver_name().size() > 0) {
 
-    file_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.file_name_);
+    solver_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.solver_name_);
   }
-  if (from.type() != 0) {
-    set_type(from.type());
+  if (from.has_init_param()) {
+    mutable_init_param()->::deepflow::InitParam::MergeFrom(from.init_param());
+  }
+  if (from.has_weights()) {
+    mutable_weights()->::deepflow::TensorData::MergeFrom(from.weights());
   }
 }
 
-void ImageReaderParam::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:deepflow.ImageReaderParam)
+void VariableParam::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:deepflow.VariableParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void ImageReaderParam::CopyFrom(const ImageReaderParam& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.ImageReaderParam)
+void VariableParam::CopyFrom(const VariableParam& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.VariableParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool ImageReaderParam::IsInitialized() const {
+bool VariableParam::IsInitialized() const {
   return true;
 }
 
-void ImageReaderParam::Swap(ImageReaderParam* other) {
+void VariableParam::Swap(VariableParam* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void ImageReaderParam::InternalSwap(ImageReaderParam* other) {
-  file_name_.Swap(&other->file_name_);
-  std::swap(type_, other->type_);
+void VariableParam::InternalSwap(VariableParam* other) {
+  solver_name_.Swap(&other->solver_name_);
+  std::swap(init_param_, other->init_param_);
+  std::swap(weights_, other->weights_);
   std::swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata ImageReaderParam::GetMetadata() const {
+::google::protobuf::Metadata VariableParam::GetMetadata() const {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// ImageReaderParam
+// VariableParam
 
-// string file_name = 1;
-void ImageReaderParam::clear_file_name() {
-  file_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// .deepflow.InitParam init_param = 1;
+bool VariableParam::has_init_param() const {
+  return this != internal_default_instance() && init_param_ != NULL;
 }
-const ::std::string& ImageReaderParam::file_name() const {
-  // @@protoc_insertion_point(field_get:deepflow.ImageReaderParam.file_name)
-  return file_name_.GetNoArena();
+void VariableParam::clear_init_param() {
+  if (GetArenaNoVirtual() == NULL && init_param_ != NULL) delete init_param_;
+  init_param_ = NULL;
 }
-void ImageReaderParam::set_file_name(const ::std::string& value) {
+const ::deepflow::InitParam& VariableParam::init_param() const {
+  // @@protoc_insertion_point(field_get:deepflow.VariableParam.init_param)
+  return init_param_ != NULL ? *init_param_
+                         : *::deepflow::InitParam::internal_default_instance();
+}
+::deepflow::InitParam* VariableParam::mutable_init_param() {
   
-  file_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:deepflow.ImageReaderParam.file_name)
+  if (init_param_ == NULL) {
+    init_param_ = new ::deepflow::InitParam;
+  }
+  // @@protoc_insertion_point(field_mutable:deepflow.VariableParam.init_param)
+  return init_param_;
+}
+::deepflow::InitParam* VariableParam::release_init_param() {
+  // @@protoc_insertion_point(field_release:deepflow.VariableParam.init_param)
+  
+  ::deepflow::InitParam* temp = init_param_;
+  init_param_ = NULL;
+  return temp;
+}
+void VariableParam::set_allocated_init_param(::deepflow::InitParam* init_param) {
+  delete init_param_;
+  init_param_ = init_param;
+  if (init_param) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:deepflow.VariableParam.init_param)
+}
+
+// string solver_name = 2;
+void VariableParam::clear_solver_name() {
+  solver_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+const ::std::string& VariableParam::solver_name() const {
+  // @@protoc_insertion_point(field_get:deepflow.VariableParam.solver_name)
+  return solver_name_.GetNoArena();
+}
+void VariableParam::set_solver_name(const ::std::string& value) {
+  
+  solver_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:deepflow.VariableParam.solver_name)
 }
 #if LANG_CXX11
-void ImageReaderParam::set_file_name(::std::string&& value) {
+void VariableParam::set_solver_name(::std::string&& value) {
   
-  file_name_.SetNoArena(
+  solver_name_.SetNoArena(
     &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:deepflow.ImageReaderParam.file_name)
+  // @@protoc_insertion_point(field_set_rvalue:deepflow.VariableParam.solver_name)
 }
 #endif
-void ImageReaderParam::set_file_name(const char* value) {
+void VariableParam::set_solver_name(const char* value) {
   GOOGLE_DCHECK(value != NULL);
   
-  file_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:deepflow.ImageReaderParam.file_name)
+  solver_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:deepflow.VariableParam.solver_name)
 }
-void ImageReaderParam::set_file_name(const char* value, size_t size) {
+void VariableParam::set_solver_name(const char* value, size_t size) {
   
-  file_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+  solver_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
       ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:deepflow.ImageReaderParam.file_name)
+  // @@protoc_insertion_point(field_set_pointer:deepflow.VariableParam.solver_name)
 }
-::std::string* ImageReaderParam::mutable_file_name() {
+::std::string* VariableParam::mutable_solver_name() {
   
-  // @@protoc_insertion_point(field_mutable:deepflow.ImageReaderParam.file_name)
-  return file_name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  // @@protoc_insertion_point(field_mutable:deepflow.VariableParam.solver_name)
+  return solver_name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-::std::string* ImageReaderParam::release_file_name() {
-  // @@protoc_insertion_point(field_release:deepflow.ImageReaderParam.file_name)
+::std::string* VariableParam::release_solver_name() {
+  // @@protoc_insertion_point(field_release:deepflow.VariableParam.solver_name)
   
-  return file_name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return solver_name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-void ImageReaderParam::set_allocated_file_name(::std::string* file_name) {
-  if (file_name != NULL) {
+void VariableParam::set_allocated_solver_name(::std::string* solver_name) {
+  if (solver_name != NULL) {
     
   } else {
     
   }
-  file_name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), file_name);
-  // @@protoc_insertion_point(field_set_allocated:deepflow.ImageReaderParam.file_name)
+  solver_name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), solver_name);
+  // @@protoc_insertion_point(field_set_allocated:deepflow.VariableParam.solver_name)
 }
 
-// .deepflow.ImageReaderParam.Type type = 2;
-void ImageReaderParam::clear_type() {
-  type_ = 0;
+// .deepflow.TensorData weights = 3;
+bool VariableParam::has_weights() const {
+  return this != internal_default_instance() && weights_ != NULL;
 }
-::deepflow::ImageReaderParam_Type ImageReaderParam::type() const {
-  // @@protoc_insertion_point(field_get:deepflow.ImageReaderParam.type)
-  return static_cast< ::deepflow::ImageReaderParam_Type >(type_);
+void VariableParam::clear_weights() {
+  if (GetArenaNoVirtual() == NULL && weights_ != NULL) delete weights_;
+  weights_ = NULL;
 }
-void ImageReaderParam::set_type(::deepflow::ImageReaderParam_Type value) {
+const ::deepflow::TensorData& VariableParam::weights() const {
+  // @@protoc_insertion_point(field_get:deepflow.VariableParam.weights)
+  return weights_ != NULL ? *weights_
+                         : *::deepflow::TensorData::internal_default_instance();
+}
+::deepflow::TensorData* VariableParam::mutable_weights() {
   
-  type_ = value;
-  // @@protoc_insertion_point(field_set:deepflow.ImageReaderParam.type)
+  if (weights_ == NULL) {
+    weights_ = new ::deepflow::TensorData;
+  }
+  // @@protoc_insertion_point(field_mutable:deepflow.VariableParam.weights)
+  return weights_;
+}
+::deepflow::TensorData* VariableParam::release_weights() {
+  // @@protoc_insertion_point(field_release:deepflow.VariableParam.weights)
+  
+  ::deepflow::TensorData* temp = weights_;
+  weights_ = NULL;
+  return temp;
+}
+void VariableParam::set_allocated_weights(::deepflow::TensorData* weights) {
+  delete weights_;
+  weights_ = weights;
+  if (weights) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:deepflow.VariableParam.weights)
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -13562,145 +14211,85 @@ void ImageReaderParam::set_type(::deepflow::ImageReaderParam_Type value) {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int MnistParam::kFolderPathFieldNumber;
-const int MnistParam::kReaderTypeFieldNumber;
-const int MnistParam::kOutputTypeFieldNumber;
-const int MnistParam::kBatchSizeFieldNumber;
+const int DataGeneratorParam::kFreqFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-MnistParam::MnistParam()
+DataGeneratorParam::DataGeneratorParam()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_deepflow_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:deepflow.MnistParam)
+  // @@protoc_insertion_point(constructor:deepflow.DataGeneratorParam)
 }
-MnistParam::MnistParam(const MnistParam& from)
+DataGeneratorParam::DataGeneratorParam(const DataGeneratorParam& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
-  folder_path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.folder_path().size() > 0) {
-    folder_path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.folder_path_);
-  }
-  ::memcpy(&reader_type_, &from.reader_type_,
-    reinterpret_cast<char*>(&batch_size_) -
-    reinterpret_cast<char*>(&reader_type_) + sizeof(batch_size_));
-  // @@protoc_insertion_point(copy_constructor:deepflow.MnistParam)
+  freq_ = from.freq_;
+  // @@protoc_insertion_point(copy_constructor:deepflow.DataGeneratorParam)
 }
 
-void MnistParam::SharedCtor() {
-  folder_path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&reader_type_, 0, reinterpret_cast<char*>(&batch_size_) -
-    reinterpret_cast<char*>(&reader_type_) + sizeof(batch_size_));
+void DataGeneratorParam::SharedCtor() {
+  freq_ = 0;
   _cached_size_ = 0;
 }
 
-MnistParam::~MnistParam() {
-  // @@protoc_insertion_point(destructor:deepflow.MnistParam)
+DataGeneratorParam::~DataGeneratorParam() {
+  // @@protoc_insertion_point(destructor:deepflow.DataGeneratorParam)
   SharedDtor();
 }
 
-void MnistParam::SharedDtor() {
-  folder_path_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+void DataGeneratorParam::SharedDtor() {
 }
 
-void MnistParam::SetCachedSize(int size) const {
+void DataGeneratorParam::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* MnistParam::descriptor() {
+const ::google::protobuf::Descriptor* DataGeneratorParam::descriptor() {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const MnistParam& MnistParam::default_instance() {
+const DataGeneratorParam& DataGeneratorParam::default_instance() {
   protobuf_deepflow_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-MnistParam* MnistParam::New(::google::protobuf::Arena* arena) const {
-  MnistParam* n = new MnistParam;
+DataGeneratorParam* DataGeneratorParam::New(::google::protobuf::Arena* arena) const {
+  DataGeneratorParam* n = new DataGeneratorParam;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void MnistParam::Clear() {
-// @@protoc_insertion_point(message_clear_start:deepflow.MnistParam)
-  folder_path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&reader_type_, 0, reinterpret_cast<char*>(&batch_size_) -
-    reinterpret_cast<char*>(&reader_type_) + sizeof(batch_size_));
+void DataGeneratorParam::Clear() {
+// @@protoc_insertion_point(message_clear_start:deepflow.DataGeneratorParam)
+  freq_ = 0;
 }
 
-bool MnistParam::MergePartialFromCodedStream(
+bool DataGeneratorParam::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:deepflow.MnistParam)
+  // @@protoc_insertion_point(parse_start:deepflow.DataGeneratorParam)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // string folder_path = 1;
+      // int32 freq = 1;
       case 1: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_folder_path()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->folder_path().data(), this->folder_path().length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "deepflow.MnistParam.folder_path"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // .deepflow.MnistParam.ReaderType reader_type = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(16u)) {
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          set_reader_type(static_cast< ::deepflow::MnistParam_ReaderType >(value));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // .deepflow.MnistParam.OutputType output_type = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(24u)) {
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          set_output_type(static_cast< ::deepflow::MnistParam_OutputType >(value));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // int32 batch_size = 4;
-      case 4: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(32u)) {
+            static_cast< ::google::protobuf::uint8>(8u)) {
 
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
                    ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &batch_size_)));
+                 input, &freq_)));
         } else {
           goto handle_unusual;
         }
@@ -13720,116 +14309,52 @@ bool MnistParam::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:deepflow.MnistParam)
+  // @@protoc_insertion_point(parse_success:deepflow.DataGeneratorParam)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:deepflow.MnistParam)
+  // @@protoc_insertion_point(parse_failure:deepflow.DataGeneratorParam)
   return false;
 #undef DO_
 }
 
-void MnistParam::SerializeWithCachedSizes(
+void DataGeneratorParam::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:deepflow.MnistParam)
+  // @@protoc_insertion_point(serialize_start:deepflow.DataGeneratorParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string folder_path = 1;
-  if (this->folder_path().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->folder_path().data(), this->folder_path().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "deepflow.MnistParam.folder_path");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->folder_path(), output);
-  }
-
-  // .deepflow.MnistParam.ReaderType reader_type = 2;
-  if (this->reader_type() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      2, this->reader_type(), output);
+  // int32 freq = 1;
+  if (this->freq() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->freq(), output);
   }
 
-  // .deepflow.MnistParam.OutputType output_type = 3;
-  if (this->output_type() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      3, this->output_type(), output);
-  }
+  // @@protoc_insertion_point(serialize_end:deepflow.DataGeneratorParam)
+}
 
-  // int32 batch_size = 4;
-  if (this->batch_size() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(4, this->batch_size(), output);
-  }
-
-  // @@protoc_insertion_point(serialize_end:deepflow.MnistParam)
-}
-
-::google::protobuf::uint8* MnistParam::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* DataGeneratorParam::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:deepflow.MnistParam)
+  // @@protoc_insertion_point(serialize_to_array_start:deepflow.DataGeneratorParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string folder_path = 1;
-  if (this->folder_path().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->folder_path().data(), this->folder_path().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "deepflow.MnistParam.folder_path");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->folder_path(), target);
-  }
-
-  // .deepflow.MnistParam.ReaderType reader_type = 2;
-  if (this->reader_type() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      2, this->reader_type(), target);
-  }
-
-  // .deepflow.MnistParam.OutputType output_type = 3;
-  if (this->output_type() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      3, this->output_type(), target);
-  }
-
-  // int32 batch_size = 4;
-  if (this->batch_size() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(4, this->batch_size(), target);
+  // int32 freq = 1;
+  if (this->freq() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->freq(), target);
   }
 
-  // @@protoc_insertion_point(serialize_to_array_end:deepflow.MnistParam)
+  // @@protoc_insertion_point(serialize_to_array_end:deepflow.DataGeneratorParam)
   return target;
 }
 
-size_t MnistParam::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:deepflow.MnistParam)
+size_t DataGeneratorParam::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:deepflow.DataGeneratorParam)
   size_t total_size = 0;
 
-  // string folder_path = 1;
-  if (this->folder_path().size() > 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->folder_path());
-  }
-
-  // .deepflow.MnistParam.ReaderType reader_type = 2;
-  if (this->reader_type() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::EnumSize(this->reader_type());
-  }
-
-  // .deepflow.MnistParam.OutputType output_type = 3;
-  if (this->output_type() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::EnumSize(this->output_type());
-  }
-
-  // int32 batch_size = 4;
-  if (this->batch_size() != 0) {
+  // int32 freq = 1;
+  if (this->freq() != 0) {
     total_size += 1 +
       ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->batch_size());
+        this->freq());
   }
 
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
@@ -13839,174 +14364,80 @@ size_t MnistParam::ByteSizeLong() const {
   return total_size;
 }
 
-void MnistParam::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:deepflow.MnistParam)
+void DataGeneratorParam::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:deepflow.DataGeneratorParam)
   GOOGLE_DCHECK_NE(&from, this);
-  const MnistParam* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const MnistParam>(
+  const DataGeneratorParam* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const DataGeneratorParam>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.MnistParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.DataGeneratorParam)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.MnistParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.DataGeneratorParam)
     MergeFrom(*source);
   }
 }
 
-void MnistParam::MergeFrom(const MnistParam& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.MnistParam)
+void DataGeneratorParam::MergeFrom(const DataGeneratorParam& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.DataGeneratorParam)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.folder_path().size() > 0) {
-
-    folder_path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.folder_path_);
-  }
-  if (from.reader_type() != 0) {
-    set_reader_type(from.reader_type());
-  }
-  if (from.output_type() != 0) {
-    set_output_type(from.output_type());
-  }
-  if (from.batch_size() != 0) {
-    set_batch_size(from.batch_size());
+  if (from.freq() != 0) {
+    set_freq(from.freq());
   }
 }
 
-void MnistParam::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:deepflow.MnistParam)
+void DataGeneratorParam::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:deepflow.DataGeneratorParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void MnistParam::CopyFrom(const MnistParam& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.MnistParam)
+void DataGeneratorParam::CopyFrom(const DataGeneratorParam& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.DataGeneratorParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool MnistParam::IsInitialized() const {
+bool DataGeneratorParam::IsInitialized() const {
   return true;
 }
 
-void MnistParam::Swap(MnistParam* other) {
+void DataGeneratorParam::Swap(DataGeneratorParam* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void MnistParam::InternalSwap(MnistParam* other) {
-  folder_path_.Swap(&other->folder_path_);
-  std::swap(reader_type_, other->reader_type_);
-  std::swap(output_type_, other->output_type_);
-  std::swap(batch_size_, other->batch_size_);
+void DataGeneratorParam::InternalSwap(DataGeneratorParam* other) {
+  std::swap(freq_, other->freq_);
   std::swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata MnistParam::GetMetadata() const {
+::google::protobuf::Metadata DataGeneratorParam::GetMetadata() const {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// MnistParam
-
-// string folder_path = 1;
-void MnistParam::clear_folder_path() {
-  folder_path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-const ::std::string& MnistParam::folder_path() const {
-  // @@protoc_insertion_point(field_get:deepflow.MnistParam.folder_path)
-  return folder_path_.GetNoArena();
-}
-void MnistParam::set_folder_path(const ::std::string& value) {
-  
-  folder_path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:deepflow.MnistParam.folder_path)
-}
-#if LANG_CXX11
-void MnistParam::set_folder_path(::std::string&& value) {
-  
-  folder_path_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:deepflow.MnistParam.folder_path)
-}
-#endif
-void MnistParam::set_folder_path(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  folder_path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:deepflow.MnistParam.folder_path)
-}
-void MnistParam::set_folder_path(const char* value, size_t size) {
-  
-  folder_path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:deepflow.MnistParam.folder_path)
-}
-::std::string* MnistParam::mutable_folder_path() {
-  
-  // @@protoc_insertion_point(field_mutable:deepflow.MnistParam.folder_path)
-  return folder_path_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-::std::string* MnistParam::release_folder_path() {
-  // @@protoc_insertion_point(field_release:deepflow.MnistParam.folder_path)
-  
-  return folder_path_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-void MnistParam::set_allocated_folder_path(::std::string* folder_path) {
-  if (folder_path != NULL) {
-    
-  } else {
-    
-  }
-  folder_path_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), folder_path);
-  // @@protoc_insertion_point(field_set_allocated:deepflow.MnistParam.folder_path)
-}
-
-// .deepflow.MnistParam.ReaderType reader_type = 2;
-void MnistParam::clear_reader_type() {
-  reader_type_ = 0;
-}
-::deepflow::MnistParam_ReaderType MnistParam::reader_type() const {
-  // @@protoc_insertion_point(field_get:deepflow.MnistParam.reader_type)
-  return static_cast< ::deepflow::MnistParam_ReaderType >(reader_type_);
-}
-void MnistParam::set_reader_type(::deepflow::MnistParam_ReaderType value) {
-  
-  reader_type_ = value;
-  // @@protoc_insertion_point(field_set:deepflow.MnistParam.reader_type)
-}
-
-// .deepflow.MnistParam.OutputType output_type = 3;
-void MnistParam::clear_output_type() {
-  output_type_ = 0;
-}
-::deepflow::MnistParam_OutputType MnistParam::output_type() const {
-  // @@protoc_insertion_point(field_get:deepflow.MnistParam.output_type)
-  return static_cast< ::deepflow::MnistParam_OutputType >(output_type_);
-}
-void MnistParam::set_output_type(::deepflow::MnistParam_OutputType value) {
-  
-  output_type_ = value;
-  // @@protoc_insertion_point(field_set:deepflow.MnistParam.output_type)
-}
+// DataGeneratorParam
 
-// int32 batch_size = 4;
-void MnistParam::clear_batch_size() {
-  batch_size_ = 0;
+// int32 freq = 1;
+void DataGeneratorParam::clear_freq() {
+  freq_ = 0;
 }
-::google::protobuf::int32 MnistParam::batch_size() const {
-  // @@protoc_insertion_point(field_get:deepflow.MnistParam.batch_size)
-  return batch_size_;
+::google::protobuf::int32 DataGeneratorParam::freq() const {
+  // @@protoc_insertion_point(field_get:deepflow.DataGeneratorParam.freq)
+  return freq_;
 }
-void MnistParam::set_batch_size(::google::protobuf::int32 value) {
+void DataGeneratorParam::set_freq(::google::protobuf::int32 value) {
   
-  batch_size_ = value;
-  // @@protoc_insertion_point(field_set:deepflow.MnistParam.batch_size)
+  freq_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.DataGeneratorParam.freq)
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -14014,85 +14445,105 @@ void MnistParam::set_batch_size(::google::protobuf::int32 value) {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int InstanceNormalizationParam::kEpsFieldNumber;
+const int ActivationParam::kTypeFieldNumber;
+const int ActivationParam::kCoefFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-InstanceNormalizationParam::InstanceNormalizationParam()
+ActivationParam::ActivationParam()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_deepflow_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:deepflow.InstanceNormalizationParam)
+  // @@protoc_insertion_point(constructor:deepflow.ActivationParam)
 }
-InstanceNormalizationParam::InstanceNormalizationParam(const InstanceNormalizationParam& from)
+ActivationParam::ActivationParam(const ActivationParam& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
-  eps_ = from.eps_;
-  // @@protoc_insertion_point(copy_constructor:deepflow.InstanceNormalizationParam)
+  ::memcpy(&type_, &from.type_,
+    reinterpret_cast<char*>(&coef_) -
+    reinterpret_cast<char*>(&type_) + sizeof(coef_));
+  // @@protoc_insertion_point(copy_constructor:deepflow.ActivationParam)
 }
 
-void InstanceNormalizationParam::SharedCtor() {
-  eps_ = 0;
+void ActivationParam::SharedCtor() {
+  ::memset(&type_, 0, reinterpret_cast<char*>(&coef_) -
+    reinterpret_cast<char*>(&type_) + sizeof(coef_));
   _cached_size_ = 0;
 }
 
-InstanceNormalizationParam::~InstanceNormalizationParam() {
-  // @@protoc_insertion_point(destructor:deepflow.InstanceNormalizationParam)
+ActivationParam::~ActivationParam() {
+  // @@protoc_insertion_point(destructor:deepflow.ActivationParam)
   SharedDtor();
 }
 
-void InstanceNormalizationParam::SharedDtor() {
+void ActivationParam::SharedDtor() {
 }
 
-void InstanceNormalizationParam::SetCachedSize(int size) const {
+void ActivationParam::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* InstanceNormalizationParam::descriptor() {
+const ::google::protobuf::Descriptor* ActivationParam::descriptor() {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const InstanceNormalizationParam& InstanceNormalizationParam::default_instance() {
+const ActivationParam& ActivationParam::default_instance() {
   protobuf_deepflow_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-InstanceNormalizationParam* InstanceNormalizationParam::New(::google::protobuf::Arena* arena) const {
-  InstanceNormalizationParam* n = new InstanceNormalizationParam;
+ActivationParam* ActivationParam::New(::google::protobuf::Arena* arena) const {
+  ActivationParam* n = new ActivationParam;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void InstanceNormalizationParam::Clear() {
-// @@protoc_insertion_point(message_clear_start:deepflow.InstanceNormalizationParam)
-  eps_ = 0;
+void ActivationParam::Clear() {
+// @@protoc_insertion_point(message_clear_start:deepflow.ActivationParam)
+  ::memset(&type_, 0, reinterpret_cast<char*>(&coef_) -
+    reinterpret_cast<char*>(&type_) + sizeof(coef_));
 }
 
-bool InstanceNormalizationParam::MergePartialFromCodedStream(
+bool ActivationParam::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:deepflow.InstanceNormalizationParam)
+  // @@protoc_insertion_point(parse_start:deepflow.ActivationParam)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // float eps = 1;
+      // .deepflow.ActivationParam.Type type = 1;
       case 1: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(13u)) {
+            static_cast< ::google::protobuf::uint8>(8u)) {
+          int value;
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          set_type(static_cast< ::deepflow::ActivationParam_Type >(value));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // float coef = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(21u)) {
 
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
                    float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &eps_)));
+                 input, &coef_)));
         } else {
           goto handle_unusual;
         }
@@ -14112,49 +14563,67 @@ bool InstanceNormalizationParam::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:deepflow.InstanceNormalizationParam)
+  // @@protoc_insertion_point(parse_success:deepflow.ActivationParam)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:deepflow.InstanceNormalizationParam)
+  // @@protoc_insertion_point(parse_failure:deepflow.ActivationParam)
   return false;
 #undef DO_
 }
 
-void InstanceNormalizationParam::SerializeWithCachedSizes(
+void ActivationParam::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:deepflow.InstanceNormalizationParam)
+  // @@protoc_insertion_point(serialize_start:deepflow.ActivationParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // float eps = 1;
-  if (this->eps() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(1, this->eps(), output);
+  // .deepflow.ActivationParam.Type type = 1;
+  if (this->type() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      1, this->type(), output);
   }
 
-  // @@protoc_insertion_point(serialize_end:deepflow.InstanceNormalizationParam)
+  // float coef = 2;
+  if (this->coef() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(2, this->coef(), output);
+  }
+
+  // @@protoc_insertion_point(serialize_end:deepflow.ActivationParam)
 }
 
-::google::protobuf::uint8* InstanceNormalizationParam::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* ActivationParam::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:deepflow.InstanceNormalizationParam)
+  // @@protoc_insertion_point(serialize_to_array_start:deepflow.ActivationParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // float eps = 1;
-  if (this->eps() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(1, this->eps(), target);
+  // .deepflow.ActivationParam.Type type = 1;
+  if (this->type() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
+      1, this->type(), target);
   }
 
-  // @@protoc_insertion_point(serialize_to_array_end:deepflow.InstanceNormalizationParam)
+  // float coef = 2;
+  if (this->coef() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(2, this->coef(), target);
+  }
+
+  // @@protoc_insertion_point(serialize_to_array_end:deepflow.ActivationParam)
   return target;
 }
 
-size_t InstanceNormalizationParam::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:deepflow.InstanceNormalizationParam)
+size_t ActivationParam::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:deepflow.ActivationParam)
   size_t total_size = 0;
 
-  // float eps = 1;
-  if (this->eps() != 0) {
+  // .deepflow.ActivationParam.Type type = 1;
+  if (this->type() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::EnumSize(this->type());
+  }
+
+  // float coef = 2;
+  if (this->coef() != 0) {
     total_size += 1 + 4;
   }
 
@@ -14165,80 +14634,98 @@ size_t InstanceNormalizationParam::ByteSizeLong() const {
   return total_size;
 }
 
-void InstanceNormalizationParam::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:deepflow.InstanceNormalizationParam)
+void ActivationParam::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:deepflow.ActivationParam)
   GOOGLE_DCHECK_NE(&from, this);
-  const InstanceNormalizationParam* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const InstanceNormalizationParam>(
+  const ActivationParam* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const ActivationParam>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.InstanceNormalizationParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.ActivationParam)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.InstanceNormalizationParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.ActivationParam)
     MergeFrom(*source);
   }
 }
 
-void InstanceNormalizationParam::MergeFrom(const InstanceNormalizationParam& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.InstanceNormalizationParam)
+void ActivationParam::MergeFrom(const ActivationParam& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.ActivationParam)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.eps() != 0) {
-    set_eps(from.eps());
+  if (from.type() != 0) {
+    set_type(from.type());
+  }
+  if (from.coef() != 0) {
+    set_coef(from.coef());
   }
 }
 
-void InstanceNormalizationParam::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:deepflow.InstanceNormalizationParam)
+void ActivationParam::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:deepflow.ActivationParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void InstanceNormalizationParam::CopyFrom(const InstanceNormalizationParam& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.InstanceNormalizationParam)
+void ActivationParam::CopyFrom(const ActivationParam& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.ActivationParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool InstanceNormalizationParam::IsInitialized() const {
+bool ActivationParam::IsInitialized() const {
   return true;
 }
 
-void InstanceNormalizationParam::Swap(InstanceNormalizationParam* other) {
+void ActivationParam::Swap(ActivationParam* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void InstanceNormalizationParam::InternalSwap(InstanceNormalizationParam* other) {
-  std::swap(eps_, other->eps_);
+void ActivationParam::InternalSwap(ActivationParam* other) {
+  std::swap(type_, other->type_);
+  std::swap(coef_, other->coef_);
   std::swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata InstanceNormalizationParam::GetMetadata() const {
+::google::protobuf::Metadata ActivationParam::GetMetadata() const {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// InstanceNormalizationParam
+// ActivationParam
 
-// float eps = 1;
-void InstanceNormalizationParam::clear_eps() {
-  eps_ = 0;
+// .deepflow.ActivationParam.Type type = 1;
+void ActivationParam::clear_type() {
+  type_ = 0;
 }
-float InstanceNormalizationParam::eps() const {
-  // @@protoc_insertion_point(field_get:deepflow.InstanceNormalizationParam.eps)
-  return eps_;
+::deepflow::ActivationParam_Type ActivationParam::type() const {
+  // @@protoc_insertion_point(field_get:deepflow.ActivationParam.type)
+  return static_cast< ::deepflow::ActivationParam_Type >(type_);
 }
-void InstanceNormalizationParam::set_eps(float value) {
+void ActivationParam::set_type(::deepflow::ActivationParam_Type value) {
   
-  eps_ = value;
-  // @@protoc_insertion_point(field_set:deepflow.InstanceNormalizationParam.eps)
+  type_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.ActivationParam.type)
+}
+
+// float coef = 2;
+void ActivationParam::clear_coef() {
+  coef_ = 0;
+}
+float ActivationParam::coef() const {
+  // @@protoc_insertion_point(field_get:deepflow.ActivationParam.coef)
+  return coef_;
+}
+void ActivationParam::set_coef(float value) {
+  
+  coef_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.ActivationParam.coef)
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -14246,185 +14733,153 @@ void InstanceNormalizationParam::set_eps(float value) {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int BatchNormalizationParam::kModeFieldNumber;
-const int BatchNormalizationParam::kCacheMeanvarFieldNumber;
-const int BatchNormalizationParam::kMeanFieldNumber;
-const int BatchNormalizationParam::kVarFieldNumber;
-const int BatchNormalizationParam::kExpAvgFactorFieldNumber;
-const int BatchNormalizationParam::kEpsFieldNumber;
+const int ImageBatchReaderParam::kFolderPathFieldNumber;
+const int ImageBatchReaderParam::kTensorParamFieldNumber;
+const int ImageBatchReaderParam::kRandomizeFieldNumber;
+const int ImageBatchReaderParam::kBetween0And1FieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-BatchNormalizationParam::BatchNormalizationParam()
+ImageBatchReaderParam::ImageBatchReaderParam()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_deepflow_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:deepflow.BatchNormalizationParam)
+  // @@protoc_insertion_point(constructor:deepflow.ImageBatchReaderParam)
 }
-BatchNormalizationParam::BatchNormalizationParam(const BatchNormalizationParam& from)
+ImageBatchReaderParam::ImageBatchReaderParam(const ImageBatchReaderParam& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
-  if (from.has_mean()) {
-    mean_ = new ::deepflow::TensorData(*from.mean_);
-  } else {
-    mean_ = NULL;
+  folder_path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.folder_path().size() > 0) {
+    folder_path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.folder_path_);
   }
-  if (from.has_var()) {
-    var_ = new ::deepflow::TensorData(*from.var_);
+  if (from.has_tensor_param()) {
+    tensor_param_ = new ::deepflow::TensorParam(*from.tensor_param_);
   } else {
-    var_ = NULL;
+    tensor_param_ = NULL;
   }
-  ::memcpy(&mode_, &from.mode_,
-    reinterpret_cast<char*>(&eps_) -
-    reinterpret_cast<char*>(&mode_) + sizeof(eps_));
-  // @@protoc_insertion_point(copy_constructor:deepflow.BatchNormalizationParam)
+  ::memcpy(&randomize_, &from.randomize_,
+    reinterpret_cast<char*>(&between_0_and_1_) -
+    reinterpret_cast<char*>(&randomize_) + sizeof(between_0_and_1_));
+  // @@protoc_insertion_point(copy_constructor:deepflow.ImageBatchReaderParam)
 }
 
-void BatchNormalizationParam::SharedCtor() {
-  ::memset(&mean_, 0, reinterpret_cast<char*>(&eps_) -
-    reinterpret_cast<char*>(&mean_) + sizeof(eps_));
+void ImageBatchReaderParam::SharedCtor() {
+  folder_path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::memset(&tensor_param_, 0, reinterpret_cast<char*>(&between_0_and_1_) -
+    reinterpret_cast<char*>(&tensor_param_) + sizeof(between_0_and_1_));
   _cached_size_ = 0;
 }
 
-BatchNormalizationParam::~BatchNormalizationParam() {
-  // @@protoc_insertion_point(destructor:deepflow.BatchNormalizationParam)
+ImageBatchReaderParam::~ImageBatchReaderParam() {
+  // @@protoc_insertion_point(destructor:deepflow.ImageBatchReaderParam)
   SharedDtor();
 }
 
-void BatchNormalizationParam::SharedDtor() {
-  if (this != internal_default_instance()) {
-    delete mean_;
-  }
+void ImageBatchReaderParam::SharedDtor() {
+  folder_path_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (this != internal_default_instance()) {
-    delete var_;
+    delete tensor_param_;
   }
 }
 
-void BatchNormalizationParam::SetCachedSize(int size) const {
+void ImageBatchReaderParam::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* BatchNormalizationParam::descriptor() {
+const ::google::protobuf::Descriptor* ImageBatchReaderParam::descriptor() {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const BatchNormalizationParam& BatchNormalizationParam::default_instance() {
+const ImageBatchReaderParam& ImageBatchReaderParam::default_instance() {
   protobuf_deepflow_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-BatchNormalizationParam* BatchNormalizationParam::New(::google::protobuf::Arena* arena) const {
-  BatchNormalizationParam* n = new BatchNormalizationParam;
+ImageBatchReaderParam* ImageBatchReaderParam::New(::google::protobuf::Arena* arena) const {
+  ImageBatchReaderParam* n = new ImageBatchReaderParam;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void BatchNormalizationParam::Clear() {
-// @@protoc_insertion_point(message_clear_start:deepflow.BatchNormalizationParam)
-  if (GetArenaNoVirtual() == NULL && mean_ != NULL) {
-    delete mean_;
-  }
-  mean_ = NULL;
-  if (GetArenaNoVirtual() == NULL && var_ != NULL) {
-    delete var_;
+void ImageBatchReaderParam::Clear() {
+// @@protoc_insertion_point(message_clear_start:deepflow.ImageBatchReaderParam)
+  folder_path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (GetArenaNoVirtual() == NULL && tensor_param_ != NULL) {
+    delete tensor_param_;
   }
-  var_ = NULL;
-  ::memset(&mode_, 0, reinterpret_cast<char*>(&eps_) -
-    reinterpret_cast<char*>(&mode_) + sizeof(eps_));
+  tensor_param_ = NULL;
+  ::memset(&randomize_, 0, reinterpret_cast<char*>(&between_0_and_1_) -
+    reinterpret_cast<char*>(&randomize_) + sizeof(between_0_and_1_));
 }
 
-bool BatchNormalizationParam::MergePartialFromCodedStream(
+bool ImageBatchReaderParam::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:deepflow.BatchNormalizationParam)
+  // @@protoc_insertion_point(parse_start:deepflow.ImageBatchReaderParam)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // .deepflow.BatchNormalizationParam.Mode mode = 1;
+      // string folder_path = 1;
       case 1: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u)) {
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          set_mode(static_cast< ::deepflow::BatchNormalizationParam_Mode >(value));
+            static_cast< ::google::protobuf::uint8>(10u)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_folder_path()));
+          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            this->folder_path().data(), this->folder_path().length(),
+            ::google::protobuf::internal::WireFormatLite::PARSE,
+            "deepflow.ImageBatchReaderParam.folder_path"));
         } else {
           goto handle_unusual;
         }
         break;
       }
 
-      // bool cache_meanvar = 2;
+      // .deepflow.TensorParam tensor_param = 2;
       case 2: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(16u)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &cache_meanvar_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // .deepflow.TensorData mean = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(26u)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_mean()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // .deepflow.TensorData var = 4;
-      case 4: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(34u)) {
+            static_cast< ::google::protobuf::uint8>(18u)) {
           DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_var()));
+               input, mutable_tensor_param()));
         } else {
           goto handle_unusual;
         }
         break;
       }
 
-      // float exp_avg_factor = 5;
-      case 5: {
+      // bool randomize = 3;
+      case 3: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(45u)) {
+            static_cast< ::google::protobuf::uint8>(24u)) {
 
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &exp_avg_factor_)));
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &randomize_)));
         } else {
           goto handle_unusual;
         }
         break;
       }
 
-      // float eps = 6;
-      case 6: {
+      // bool between_0_and_1 = 4;
+      case 4: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(53u)) {
+            static_cast< ::google::protobuf::uint8>(32u)) {
 
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &eps_)));
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &between_0_and_1_)));
         } else {
           goto handle_unusual;
         }
@@ -14444,138 +14899,113 @@ bool BatchNormalizationParam::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:deepflow.BatchNormalizationParam)
+  // @@protoc_insertion_point(parse_success:deepflow.ImageBatchReaderParam)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:deepflow.BatchNormalizationParam)
+  // @@protoc_insertion_point(parse_failure:deepflow.ImageBatchReaderParam)
   return false;
 #undef DO_
 }
 
-void BatchNormalizationParam::SerializeWithCachedSizes(
+void ImageBatchReaderParam::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:deepflow.BatchNormalizationParam)
+  // @@protoc_insertion_point(serialize_start:deepflow.ImageBatchReaderParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .deepflow.BatchNormalizationParam.Mode mode = 1;
-  if (this->mode() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      1, this->mode(), output);
-  }
-
-  // bool cache_meanvar = 2;
-  if (this->cache_meanvar() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(2, this->cache_meanvar(), output);
-  }
-
-  // .deepflow.TensorData mean = 3;
-  if (this->has_mean()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      3, *this->mean_, output);
+  // string folder_path = 1;
+  if (this->folder_path().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->folder_path().data(), this->folder_path().length(),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "deepflow.ImageBatchReaderParam.folder_path");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      1, this->folder_path(), output);
   }
 
-  // .deepflow.TensorData var = 4;
-  if (this->has_var()) {
+  // .deepflow.TensorParam tensor_param = 2;
+  if (this->has_tensor_param()) {
     ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      4, *this->var_, output);
+      2, *this->tensor_param_, output);
   }
 
-  // float exp_avg_factor = 5;
-  if (this->exp_avg_factor() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(5, this->exp_avg_factor(), output);
+  // bool randomize = 3;
+  if (this->randomize() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(3, this->randomize(), output);
   }
 
-  // float eps = 6;
-  if (this->eps() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(6, this->eps(), output);
+  // bool between_0_and_1 = 4;
+  if (this->between_0_and_1() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(4, this->between_0_and_1(), output);
   }
 
-  // @@protoc_insertion_point(serialize_end:deepflow.BatchNormalizationParam)
+  // @@protoc_insertion_point(serialize_end:deepflow.ImageBatchReaderParam)
 }
 
-::google::protobuf::uint8* BatchNormalizationParam::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* ImageBatchReaderParam::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:deepflow.BatchNormalizationParam)
+  // @@protoc_insertion_point(serialize_to_array_start:deepflow.ImageBatchReaderParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .deepflow.BatchNormalizationParam.Mode mode = 1;
-  if (this->mode() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      1, this->mode(), target);
-  }
-
-  // bool cache_meanvar = 2;
-  if (this->cache_meanvar() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(2, this->cache_meanvar(), target);
-  }
-
-  // .deepflow.TensorData mean = 3;
-  if (this->has_mean()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageNoVirtualToArray(
-        3, *this->mean_, deterministic, target);
+  // string folder_path = 1;
+  if (this->folder_path().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->folder_path().data(), this->folder_path().length(),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "deepflow.ImageBatchReaderParam.folder_path");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        1, this->folder_path(), target);
   }
 
-  // .deepflow.TensorData var = 4;
-  if (this->has_var()) {
+  // .deepflow.TensorParam tensor_param = 2;
+  if (this->has_tensor_param()) {
     target = ::google::protobuf::internal::WireFormatLite::
       InternalWriteMessageNoVirtualToArray(
-        4, *this->var_, deterministic, target);
+        2, *this->tensor_param_, deterministic, target);
   }
 
-  // float exp_avg_factor = 5;
-  if (this->exp_avg_factor() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(5, this->exp_avg_factor(), target);
+  // bool randomize = 3;
+  if (this->randomize() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(3, this->randomize(), target);
   }
 
-  // float eps = 6;
-  if (this->eps() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(6, this->eps(), target);
+  // bool between_0_and_1 = 4;
+  if (this->between_0_and_1() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(4, this->between_0_and_1(), target);
   }
 
-  // @@protoc_insertion_point(serialize_to_array_end:deepflow.BatchNormalizationParam)
+  // @@protoc_insertion_point(serialize_to_array_end:deepflow.ImageBatchReaderParam)
   return target;
 }
 
-size_t BatchNormalizationParam::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:deepflow.BatchNormalizationParam)
+size_t ImageBatchReaderParam::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:deepflow.ImageBatchReaderParam)
   size_t total_size = 0;
 
-  // .deepflow.TensorData mean = 3;
-  if (this->has_mean()) {
+  // string folder_path = 1;
+  if (this->folder_path().size() > 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        *this->mean_);
+      ::google::protobuf::internal::WireFormatLite::StringSize(
+        this->folder_path());
   }
 
-  // .deepflow.TensorData var = 4;
-  if (this->has_var()) {
+  // .deepflow.TensorParam tensor_param = 2;
+  if (this->has_tensor_param()) {
     total_size += 1 +
       ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        *this->var_);
-  }
-
-  // .deepflow.BatchNormalizationParam.Mode mode = 1;
-  if (this->mode() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::EnumSize(this->mode());
+        *this->tensor_param_);
   }
 
-  // bool cache_meanvar = 2;
-  if (this->cache_meanvar() != 0) {
+  // bool randomize = 3;
+  if (this->randomize() != 0) {
     total_size += 1 + 1;
   }
 
-  // float exp_avg_factor = 5;
-  if (this->exp_avg_factor() != 0) {
-    total_size += 1 + 4;
-  }
-
-  // float eps = 6;
-  if (this->eps() != 0) {
-    total_size += 1 + 4;
+  // bool between_0_and_1 = 4;
+  if (this->between_0_and_1() != 0) {
+    total_size += 1 + 1;
   }
 
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
@@ -14585,220 +15015,199 @@ size_t BatchNormalizationParam::ByteSizeLong() const {
   return total_size;
 }
 
-void BatchNormalizationParam::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:deepflow.BatchNormalizationParam)
+void ImageBatchReaderParam::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:deepflow.ImageBatchReaderParam)
   GOOGLE_DCHECK_NE(&from, this);
-  const BatchNormalizationParam* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const BatchNormalizationParam>(
+  const ImageBatchReaderParam* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const ImageBatchReaderParam>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.BatchNormalizationParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.ImageBatchReaderParam)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.BatchNormalizationParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.ImageBatchReaderParam)
     MergeFrom(*source);
   }
 }
 
-void BatchNormalizationParam::MergeFrom(const BatchNormalizationParam& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.BatchNormalizationParam)
+void ImageBatchReaderParam::MergeFrom(const ImageBatchReaderParam& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.ImageBatchReaderParam)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.has_mean()) {
-    mutable_mean()->::deepflow::TensorData::MergeFrom(from.mean());
-  }
-  if (from.has_var()) {
-    mutable_var()->::deepflow::TensorData::MergeFrom(from.var());
-  }
-  if (from.mode() != 0) {
-    set_mode(from.mode());
+  if (from.folder_path().size() > 0) {
+
+    folder_path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.folder_path_);
   }
-  if (from.cache_meanvar() != 0) {
-    set_cache_meanvar(from.cache_meanvar());
+  if (from.has_tensor_param()) {
+    mutable_tensor_param()->::deepflow::TensorParam::MergeFrom(from.tensor_param());
   }
-  if (from.exp_avg_factor() != 0) {
-    set_exp_avg_factor(from.exp_avg_factor());
+  if (from.randomize() != 0) {
+    set_randomize(from.randomize());
   }
-  if (from.eps() != 0) {
-    set_eps(from.eps());
+  if (from.between_0_and_1() != 0) {
+    set_between_0_and_1(from.between_0_and_1());
   }
 }
 
-void BatchNormalizationParam::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:deepflow.BatchNormalizationParam)
+void ImageBatchReaderParam::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:deepflow.ImageBatchReaderParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void BatchNormalizationParam::CopyFrom(const BatchNormalizationParam& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.BatchNormalizationParam)
+void ImageBatchReaderParam::CopyFrom(const ImageBatchReaderParam& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.ImageBatchReaderParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool BatchNormalizationParam::IsInitialized() const {
+bool ImageBatchReaderParam::IsInitialized() const {
   return true;
 }
 
-void BatchNormalizationParam::Swap(BatchNormalizationParam* other) {
+void ImageBatchReaderParam::Swap(ImageBatchReaderParam* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void BatchNormalizationParam::InternalSwap(BatchNormalizationParam* other) {
-  std::swap(mean_, other->mean_);
-  std::swap(var_, other->var_);
-  std::swap(mode_, other->mode_);
-  std::swap(cache_meanvar_, other->cache_meanvar_);
-  std::swap(exp_avg_factor_, other->exp_avg_factor_);
-  std::swap(eps_, other->eps_);
+void ImageBatchReaderParam::InternalSwap(ImageBatchReaderParam* other) {
+  folder_path_.Swap(&other->folder_path_);
+  std::swap(tensor_param_, other->tensor_param_);
+  std::swap(randomize_, other->randomize_);
+  std::swap(between_0_and_1_, other->between_0_and_1_);
   std::swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata BatchNormalizationParam::GetMetadata() const {
+::google::protobuf::Metadata ImageBatchReaderParam::GetMetadata() const {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// BatchNormalizationParam
+// ImageBatchReaderParam
 
-// .deepflow.BatchNormalizationParam.Mode mode = 1;
-void BatchNormalizationParam::clear_mode() {
-  mode_ = 0;
+// string folder_path = 1;
+void ImageBatchReaderParam::clear_folder_path() {
+  folder_path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-::deepflow::BatchNormalizationParam_Mode BatchNormalizationParam::mode() const {
-  // @@protoc_insertion_point(field_get:deepflow.BatchNormalizationParam.mode)
-  return static_cast< ::deepflow::BatchNormalizationParam_Mode >(mode_);
+const ::std::string& ImageBatchReaderParam::folder_path() const {
+  // @@protoc_insertion_point(field_get:deepflow.ImageBatchReaderParam.folder_path)
+  return folder_path_.GetNoArena();
 }
-void BatchNormalizationParam::set_mode(::deepflow::BatchNormalizationParam_Mode value) {
+void ImageBatchReaderParam::set_folder_path(const ::std::string& value) {
   
-  mode_ = value;
-  // @@protoc_insertion_point(field_set:deepflow.BatchNormalizationParam.mode)
-}
-
-// bool cache_meanvar = 2;
-void BatchNormalizationParam::clear_cache_meanvar() {
-  cache_meanvar_ = false;
-}
-bool BatchNormalizationParam::cache_meanvar() const {
-  // @@protoc_insertion_point(field_get:deepflow.BatchNormalizationParam.cache_meanvar)
-  return cache_meanvar_;
+  folder_path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:deepflow.ImageBatchReaderParam.folder_path)
 }
-void BatchNormalizationParam::set_cache_meanvar(bool value) {
+#if LANG_CXX11
+void ImageBatchReaderParam::set_folder_path(::std::string&& value) {
   
-  cache_meanvar_ = value;
-  // @@protoc_insertion_point(field_set:deepflow.BatchNormalizationParam.cache_meanvar)
-}
-
-// .deepflow.TensorData mean = 3;
-bool BatchNormalizationParam::has_mean() const {
-  return this != internal_default_instance() && mean_ != NULL;
+  folder_path_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:deepflow.ImageBatchReaderParam.folder_path)
 }
-void BatchNormalizationParam::clear_mean() {
-  if (GetArenaNoVirtual() == NULL && mean_ != NULL) delete mean_;
-  mean_ = NULL;
+#endif
+void ImageBatchReaderParam::set_folder_path(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  folder_path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:deepflow.ImageBatchReaderParam.folder_path)
 }
-const ::deepflow::TensorData& BatchNormalizationParam::mean() const {
-  // @@protoc_insertion_point(field_get:deepflow.BatchNormalizationParam.mean)
-  return mean_ != NULL ? *mean_
-                         : *::deepflow::TensorData::internal_default_instance();
+void ImageBatchReaderParam::set_folder_path(const char* value, size_t size) {
+  
+  folder_path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:deepflow.ImageBatchReaderParam.folder_path)
 }
-::deepflow::TensorData* BatchNormalizationParam::mutable_mean() {
+::std::string* ImageBatchReaderParam::mutable_folder_path() {
   
-  if (mean_ == NULL) {
-    mean_ = new ::deepflow::TensorData;
-  }
-  // @@protoc_insertion_point(field_mutable:deepflow.BatchNormalizationParam.mean)
-  return mean_;
+  // @@protoc_insertion_point(field_mutable:deepflow.ImageBatchReaderParam.folder_path)
+  return folder_path_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-::deepflow::TensorData* BatchNormalizationParam::release_mean() {
-  // @@protoc_insertion_point(field_release:deepflow.BatchNormalizationParam.mean)
+::std::string* ImageBatchReaderParam::release_folder_path() {
+  // @@protoc_insertion_point(field_release:deepflow.ImageBatchReaderParam.folder_path)
   
-  ::deepflow::TensorData* temp = mean_;
-  mean_ = NULL;
-  return temp;
+  return folder_path_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-void BatchNormalizationParam::set_allocated_mean(::deepflow::TensorData* mean) {
-  delete mean_;
-  mean_ = mean;
-  if (mean) {
+void ImageBatchReaderParam::set_allocated_folder_path(::std::string* folder_path) {
+  if (folder_path != NULL) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:deepflow.BatchNormalizationParam.mean)
+  folder_path_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), folder_path);
+  // @@protoc_insertion_point(field_set_allocated:deepflow.ImageBatchReaderParam.folder_path)
 }
 
-// .deepflow.TensorData var = 4;
-bool BatchNormalizationParam::has_var() const {
-  return this != internal_default_instance() && var_ != NULL;
+// .deepflow.TensorParam tensor_param = 2;
+bool ImageBatchReaderParam::has_tensor_param() const {
+  return this != internal_default_instance() && tensor_param_ != NULL;
 }
-void BatchNormalizationParam::clear_var() {
-  if (GetArenaNoVirtual() == NULL && var_ != NULL) delete var_;
-  var_ = NULL;
+void ImageBatchReaderParam::clear_tensor_param() {
+  if (GetArenaNoVirtual() == NULL && tensor_param_ != NULL) delete tensor_param_;
+  tensor_param_ = NULL;
 }
-const ::deepflow::TensorData& BatchNormalizationParam::var() const {
-  // @@protoc_insertion_point(field_get:deepflow.BatchNormalizationParam.var)
-  return var_ != NULL ? *var_
-                         : *::deepflow::TensorData::internal_default_instance();
+const ::deepflow::TensorParam& ImageBatchReaderParam::tensor_param() const {
+  // @@protoc_insertion_point(field_get:deepflow.ImageBatchReaderParam.tensor_param)
+  return tensor_param_ != NULL ? *tensor_param_
+                         : *::deepflow::TensorParam::internal_default_instance();
 }
-::deepflow::TensorData* BatchNormalizationParam::mutable_var() {
+::deepflow::TensorParam* ImageBatchReaderParam::mutable_tensor_param() {
   
-  if (var_ == NULL) {
-    var_ = new ::deepflow::TensorData;
+  if (tensor_param_ == NULL) {
+    tensor_param_ = new ::deepflow::TensorParam;
   }
-  // @@protoc_insertion_point(field_mutable:deepflow.BatchNormalizationParam.var)
-  return var_;
+  // @@protoc_insertion_point(field_mutable:deepflow.ImageBatchReaderParam.tensor_param)
+  return tensor_param_;
 }
-::deepflow::TensorData* BatchNormalizationParam::release_var() {
-  // @@protoc_insertion_point(field_release:deepflow.BatchNormalizationParam.var)
+::deepflow::TensorParam* ImageBatchReaderParam::release_tensor_param() {
+  // @@protoc_insertion_point(field_release:deepflow.ImageBatchReaderParam.tensor_param)
   
-  ::deepflow::TensorData* temp = var_;
-  var_ = NULL;
+  ::deepflow::TensorParam* temp = tensor_param_;
+  tensor_param_ = NULL;
   return temp;
 }
-void BatchNormalizationParam::set_allocated_var(::deepflow::TensorData* var) {
-  delete var_;
-  var_ = var;
-  if (var) {
+void ImageBatchReaderParam::set_allocated_tensor_param(::deepflow::TensorParam* tensor_param) {
+  delete tensor_param_;
+  tensor_param_ = tensor_param;
+  if (tensor_param) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:deepflow.BatchNormalizationParam.var)
+  // @@protoc_insertion_point(field_set_allocated:deepflow.ImageBatchReaderParam.tensor_param)
 }
 
-// float exp_avg_factor = 5;
-void BatchNormalizationParam::clear_exp_avg_factor() {
-  exp_avg_factor_ = 0;
+// bool randomize = 3;
+void ImageBatchReaderParam::clear_randomize() {
+  randomize_ = false;
 }
-float BatchNormalizationParam::exp_avg_factor() const {
-  // @@protoc_insertion_point(field_get:deepflow.BatchNormalizationParam.exp_avg_factor)
-  return exp_avg_factor_;
+bool ImageBatchReaderParam::randomize() const {
+  // @@protoc_insertion_point(field_get:deepflow.ImageBatchReaderParam.randomize)
+  return randomize_;
 }
-void BatchNormalizationParam::set_exp_avg_factor(float value) {
+void ImageBatchReaderParam::set_randomize(bool value) {
   
-  exp_avg_factor_ = value;
-  // @@protoc_insertion_point(field_set:deepflow.BatchNormalizationParam.exp_avg_factor)
+  randomize_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.ImageBatchReaderParam.randomize)
 }
 
-// float eps = 6;
-void BatchNormalizationParam::clear_eps() {
-  eps_ = 0;
+// bool between_0_and_1 = 4;
+void ImageBatchReaderParam::clear_between_0_and_1() {
+  between_0_and_1_ = false;
 }
-float BatchNormalizationParam::eps() const {
-  // @@protoc_insertion_point(field_get:deepflow.BatchNormalizationParam.eps)
-  return eps_;
+bool ImageBatchReaderParam::between_0_and_1() const {
+  // @@protoc_insertion_point(field_get:deepflow.ImageBatchReaderParam.between_0_and_1)
+  return between_0_and_1_;
 }
-void BatchNormalizationParam::set_eps(float value) {
+void ImageBatchReaderParam::set_between_0_and_1(bool value) {
   
-  eps_ = value;
-  // @@protoc_insertion_point(field_set:deepflow.BatchNormalizationParam.eps)
+  between_0_and_1_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.ImageBatchReaderParam.between_0_and_1)
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -14806,150 +15215,204 @@ void BatchNormalizationParam::set_eps(float value) {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int ReplayMemoryParam::kCapacityFieldNumber;
+const int ImageReaderParam::kFileNameFieldNumber;
+const int ImageReaderParam::kTypeFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-ReplayMemoryParam::ReplayMemoryParam()
+ImageReaderParam::ImageReaderParam()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_deepflow_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:deepflow.ReplayMemoryParam)
+  // @@protoc_insertion_point(constructor:deepflow.ImageReaderParam)
 }
-ReplayMemoryParam::ReplayMemoryParam(const ReplayMemoryParam& from)
+ImageReaderParam::ImageReaderParam(const ImageReaderParam& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
-  capacity_ = from.capacity_;
-  // @@protoc_insertion_point(copy_constructor:deepflow.ReplayMemoryParam)
+  file_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.file_name().size() > 0) {
+    file_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.file_name_);
+  }
+  type_ = from.type_;
+  // @@protoc_insertion_point(copy_constructor:deepflow.ImageReaderParam)
 }
 
-void ReplayMemoryParam::SharedCtor() {
-  capacity_ = 0;
+void ImageReaderParam::SharedCtor() {
+  file_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  type_ = 0;
   _cached_size_ = 0;
 }
 
-ReplayMemoryParam::~ReplayMemoryParam() {
-  // @@protoc_insertion_point(destructor:deepflow.ReplayMemoryParam)
+ImageReaderParam::~ImageReaderParam() {
+  // @@protoc_insertion_point(destructor:deepflow.ImageReaderParam)
   SharedDtor();
 }
 
-void ReplayMemoryParam::SharedDtor() {
+void ImageReaderParam::SharedDtor() {
+  file_name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
 
-void ReplayMemoryParam::SetCachedSize(int size) const {
+void ImageReaderParam::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* ReplayMemoryParam::descriptor() {
+const ::google::protobuf::Descriptor* ImageReaderParam::descriptor() {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const ReplayMemoryParam& ReplayMemoryParam::default_instance() {
+const ImageReaderParam& ImageReaderParam::default_instance() {
   protobuf_deepflow_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-ReplayMemoryParam* ReplayMemoryParam::New(::google::protobuf::Arena* arena) const {
-  ReplayMemoryParam* n = new ReplayMemoryParam;
+ImageReaderParam* ImageReaderParam::New(::google::protobuf::Arena* arena) const {
+  ImageReaderParam* n = new ImageReaderParam;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void ReplayMemoryParam::Clear() {
-// @@protoc_insertion_point(message_clear_start:deepflow.ReplayMemoryParam)
-  capacity_ = 0;
+void ImageReaderParam::Clear() {
+// @@protoc_insertion_point(message_clear_start:deepflow.ImageReaderParam)
+  file_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  type_ = 0;
 }
 
-bool ReplayMemoryParam::MergePartialFromCodedStream(
+bool ImageReaderParam::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:deepflow.ReplayMemoryParam)
+  // @@protoc_insertion_point(parse_start:deepflow.ImageReaderParam)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // int32 capacity = 1;
+      // string file_name = 1;
       case 1: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &capacity_)));
+            static_cast< ::google::protobuf::uint8>(10u)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_file_name()));
+          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            this->file_name().data(), this->file_name().length(),
+            ::google::protobuf::internal::WireFormatLite::PARSE,
+            "deepflow.ImageReaderParam.file_name"));
         } else {
           goto handle_unusual;
         }
         break;
       }
 
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-        break;
+      // .deepflow.ImageReaderParam.Type type = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(16u)) {
+          int value;
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          set_type(static_cast< ::deepflow::ImageReaderParam_Type >(value));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0 ||
+            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
+        break;
       }
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:deepflow.ReplayMemoryParam)
+  // @@protoc_insertion_point(parse_success:deepflow.ImageReaderParam)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:deepflow.ReplayMemoryParam)
+  // @@protoc_insertion_point(parse_failure:deepflow.ImageReaderParam)
   return false;
 #undef DO_
 }
 
-void ReplayMemoryParam::SerializeWithCachedSizes(
+void ImageReaderParam::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:deepflow.ReplayMemoryParam)
+  // @@protoc_insertion_point(serialize_start:deepflow.ImageReaderParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // int32 capacity = 1;
-  if (this->capacity() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->capacity(), output);
+  // string file_name = 1;
+  if (this->file_name().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->file_name().data(), this->file_name().length(),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "deepflow.ImageReaderParam.file_name");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      1, this->file_name(), output);
   }
 
-  // @@protoc_insertion_point(serialize_end:deepflow.ReplayMemoryParam)
+  // .deepflow.ImageReaderParam.Type type = 2;
+  if (this->type() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      2, this->type(), output);
+  }
+
+  // @@protoc_insertion_point(serialize_end:deepflow.ImageReaderParam)
 }
 
-::google::protobuf::uint8* ReplayMemoryParam::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* ImageReaderParam::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:deepflow.ReplayMemoryParam)
+  // @@protoc_insertion_point(serialize_to_array_start:deepflow.ImageReaderParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // int32 capacity = 1;
-  if (this->capacity() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->capacity(), target);
+  // string file_name = 1;
+  if (this->file_name().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->file_name().data(), this->file_name().length(),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "deepflow.ImageReaderParam.file_name");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        1, this->file_name(), target);
   }
 
-  // @@protoc_insertion_point(serialize_to_array_end:deepflow.ReplayMemoryParam)
+  // .deepflow.ImageReaderParam.Type type = 2;
+  if (this->type() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
+      2, this->type(), target);
+  }
+
+  // @@protoc_insertion_point(serialize_to_array_end:deepflow.ImageReaderParam)
   return target;
 }
 
-size_t ReplayMemoryParam::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:deepflow.ReplayMemoryParam)
+size_t ImageReaderParam::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:deepflow.ImageReaderParam)
   size_t total_size = 0;
 
-  // int32 capacity = 1;
-  if (this->capacity() != 0) {
+  // string file_name = 1;
+  if (this->file_name().size() > 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->capacity());
+      ::google::protobuf::internal::WireFormatLite::StringSize(
+        this->file_name());
+  }
+
+  // .deepflow.ImageReaderParam.Type type = 2;
+  if (this->type() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::EnumSize(this->type());
   }
 
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
@@ -14959,80 +15422,138 @@ size_t ReplayMemoryParam::ByteSizeLong() const {
   return total_size;
 }
 
-void ReplayMemoryParam::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:deepflow.ReplayMemoryParam)
+void ImageReaderParam::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:deepflow.ImageReaderParam)
   GOOGLE_DCHECK_NE(&from, this);
-  const ReplayMemoryParam* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const ReplayMemoryParam>(
+  const ImageReaderParam* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const ImageReaderParam>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.ReplayMemoryParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.ImageReaderParam)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.ReplayMemoryParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.ImageReaderParam)
     MergeFrom(*source);
   }
 }
 
-void ReplayMemoryParam::MergeFrom(const ReplayMemoryParam& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.ReplayMemoryParam)
+void ImageReaderParam::MergeFrom(const ImageReaderParam& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.ImageReaderParam)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.capacity() != 0) {
-    set_capacity(from.capacity());
+  if (from.file_name().size() > 0) {
+
+    file_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.file_name_);
+  }
+  if (from.type() != 0) {
+    set_type(from.type());
   }
 }
 
-void ReplayMemoryParam::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:deepflow.ReplayMemoryParam)
+void ImageReaderParam::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:deepflow.ImageReaderParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void ReplayMemoryParam::CopyFrom(const ReplayMemoryParam& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.ReplayMemoryParam)
+void ImageReaderParam::CopyFrom(const ImageReaderParam& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.ImageReaderParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool ReplayMemoryParam::IsInitialized() const {
+bool ImageReaderParam::IsInitialized() const {
   return true;
 }
 
-void ReplayMemoryParam::Swap(ReplayMemoryParam* other) {
+void ImageReaderParam::Swap(ImageReaderParam* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void ReplayMemoryParam::InternalSwap(ReplayMemoryParam* other) {
-  std::swap(capacity_, other->capacity_);
+void ImageReaderParam::InternalSwap(ImageReaderParam* other) {
+  file_name_.Swap(&other->file_name_);
+  std::swap(type_, other->type_);
   std::swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata ReplayMemoryParam::GetMetadata() const {
+::google::protobuf::Metadata ImageReaderParam::GetMetadata() const {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// ReplayMemoryParam
+// ImageReaderParam
 
-// int32 capacity = 1;
-void ReplayMemoryParam::clear_capacity() {
-  capacity_ = 0;
+// string file_name = 1;
+void ImageReaderParam::clear_file_name() {
+  file_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-::google::protobuf::int32 ReplayMemoryParam::capacity() const {
-  // @@protoc_insertion_point(field_get:deepflow.ReplayMemoryParam.capacity)
-  return capacity_;
+const ::std::string& ImageReaderParam::file_name() const {
+  // @@protoc_insertion_point(field_get:deepflow.ImageReaderParam.file_name)
+  return file_name_.GetNoArena();
 }
-void ReplayMemoryParam::set_capacity(::google::protobuf::int32 value) {
+void ImageReaderParam::set_file_name(const ::std::string& value) {
   
-  capacity_ = value;
-  // @@protoc_insertion_point(field_set:deepflow.ReplayMemoryParam.capacity)
+  file_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:deepflow.ImageReaderParam.file_name)
+}
+#if LANG_CXX11
+void ImageReaderParam::set_file_name(::std::string&& value) {
+  
+  file_name_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:deepflow.ImageReaderParam.file_name)
+}
+#endif
+void ImageReaderParam::set_file_name(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  file_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:deepflow.ImageReaderParam.file_name)
+}
+void ImageReaderParam::set_file_name(const char* value, size_t size) {
+  
+  file_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:deepflow.ImageReaderParam.file_name)
+}
+::std::string* ImageReaderParam::mutable_file_name() {
+  
+  // @@protoc_insertion_point(field_mutable:deepflow.ImageReaderParam.file_name)
+  return file_name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+::std::string* ImageReaderParam::release_file_name() {
+  // @@protoc_insertion_point(field_release:deepflow.ImageReaderParam.file_name)
+  
+  return file_name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+void ImageReaderParam::set_allocated_file_name(::std::string* file_name) {
+  if (file_name != NULL) {
+    
+  } else {
+    
+  }
+  file_name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), file_name);
+  // @@protoc_insertion_point(field_set_allocated:deepflow.ImageReaderParam.file_name)
+}
+
+// .deepflow.ImageReaderParam.Type type = 2;
+void ImageReaderParam::clear_type() {
+  type_ = 0;
+}
+::deepflow::ImageReaderParam_Type ImageReaderParam::type() const {
+  // @@protoc_insertion_point(field_get:deepflow.ImageReaderParam.type)
+  return static_cast< ::deepflow::ImageReaderParam_Type >(type_);
+}
+void ImageReaderParam::set_type(::deepflow::ImageReaderParam_Type value) {
+  
+  type_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.ImageReaderParam.type)
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -15040,134 +15561,145 @@ void ReplayMemoryParam::set_capacity(::google::protobuf::int32 value) {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int LrnParam::kNFieldNumber;
-const int LrnParam::kAlphaFieldNumber;
-const int LrnParam::kBetaFieldNumber;
-const int LrnParam::kKFieldNumber;
+const int MnistParam::kFolderPathFieldNumber;
+const int MnistParam::kReaderTypeFieldNumber;
+const int MnistParam::kOutputTypeFieldNumber;
+const int MnistParam::kBatchSizeFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-LrnParam::LrnParam()
+MnistParam::MnistParam()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_deepflow_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:deepflow.LrnParam)
+  // @@protoc_insertion_point(constructor:deepflow.MnistParam)
 }
-LrnParam::LrnParam(const LrnParam& from)
+MnistParam::MnistParam(const MnistParam& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::memcpy(&n_, &from.n_,
-    reinterpret_cast<char*>(&k_) -
-    reinterpret_cast<char*>(&n_) + sizeof(k_));
-  // @@protoc_insertion_point(copy_constructor:deepflow.LrnParam)
+  folder_path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.folder_path().size() > 0) {
+    folder_path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.folder_path_);
+  }
+  ::memcpy(&reader_type_, &from.reader_type_,
+    reinterpret_cast<char*>(&batch_size_) -
+    reinterpret_cast<char*>(&reader_type_) + sizeof(batch_size_));
+  // @@protoc_insertion_point(copy_constructor:deepflow.MnistParam)
 }
 
-void LrnParam::SharedCtor() {
-  ::memset(&n_, 0, reinterpret_cast<char*>(&k_) -
-    reinterpret_cast<char*>(&n_) + sizeof(k_));
+void MnistParam::SharedCtor() {
+  folder_path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::memset(&reader_type_, 0, reinterpret_cast<char*>(&batch_size_) -
+    reinterpret_cast<char*>(&reader_type_) + sizeof(batch_size_));
   _cached_size_ = 0;
 }
 
-LrnParam::~LrnParam() {
-  // @@protoc_insertion_point(destructor:deepflow.LrnParam)
+MnistParam::~MnistParam() {
+  // @@protoc_insertion_point(destructor:deepflow.MnistParam)
   SharedDtor();
 }
 
-void LrnParam::SharedDtor() {
+void MnistParam::SharedDtor() {
+  folder_path_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
 
-void LrnParam::SetCachedSize(int size) const {
+void MnistParam::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* LrnParam::descriptor() {
+const ::google::protobuf::Descriptor* MnistParam::descriptor() {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const LrnParam& LrnParam::default_instance() {
+const MnistParam& MnistParam::default_instance() {
   protobuf_deepflow_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-LrnParam* LrnParam::New(::google::protobuf::Arena* arena) const {
-  LrnParam* n = new LrnParam;
+MnistParam* MnistParam::New(::google::protobuf::Arena* arena) const {
+  MnistParam* n = new MnistParam;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void LrnParam::Clear() {
-// @@protoc_insertion_point(message_clear_start:deepflow.LrnParam)
-  ::memset(&n_, 0, reinterpret_cast<char*>(&k_) -
-    reinterpret_cast<char*>(&n_) + sizeof(k_));
+void MnistParam::Clear() {
+// @@protoc_insertion_point(message_clear_start:deepflow.MnistParam)
+  folder_path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::memset(&reader_type_, 0, reinterpret_cast<char*>(&batch_size_) -
+    reinterpret_cast<char*>(&reader_type_) + sizeof(batch_size_));
 }
 
-bool LrnParam::MergePartialFromCodedStream(
+bool MnistParam::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:deepflow.LrnParam)
+  // @@protoc_insertion_point(parse_start:deepflow.MnistParam)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // int32 n = 1;
+      // string folder_path = 1;
       case 1: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &n_)));
+            static_cast< ::google::protobuf::uint8>(10u)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_folder_path()));
+          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            this->folder_path().data(), this->folder_path().length(),
+            ::google::protobuf::internal::WireFormatLite::PARSE,
+            "deepflow.MnistParam.folder_path"));
         } else {
           goto handle_unusual;
         }
         break;
       }
 
-      // float alpha = 2;
+      // .deepflow.MnistParam.ReaderType reader_type = 2;
       case 2: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(21u)) {
-
+            static_cast< ::google::protobuf::uint8>(16u)) {
+          int value;
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &alpha_)));
+                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          set_reader_type(static_cast< ::deepflow::MnistParam_ReaderType >(value));
         } else {
           goto handle_unusual;
         }
         break;
       }
 
-      // float beta = 3;
+      // .deepflow.MnistParam.OutputType output_type = 3;
       case 3: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(29u)) {
-
+            static_cast< ::google::protobuf::uint8>(24u)) {
+          int value;
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &beta_)));
+                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          set_output_type(static_cast< ::deepflow::MnistParam_OutputType >(value));
         } else {
           goto handle_unusual;
         }
         break;
       }
 
-      // float k = 4;
+      // int32 batch_size = 4;
       case 4: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(37u)) {
+            static_cast< ::google::protobuf::uint8>(32u)) {
 
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &k_)));
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &batch_size_)));
         } else {
           goto handle_unusual;
         }
@@ -15187,97 +15719,116 @@ bool LrnParam::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:deepflow.LrnParam)
+  // @@protoc_insertion_point(parse_success:deepflow.MnistParam)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:deepflow.LrnParam)
+  // @@protoc_insertion_point(parse_failure:deepflow.MnistParam)
   return false;
 #undef DO_
 }
 
-void LrnParam::SerializeWithCachedSizes(
+void MnistParam::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:deepflow.LrnParam)
+  // @@protoc_insertion_point(serialize_start:deepflow.MnistParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // int32 n = 1;
-  if (this->n() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->n(), output);
+  // string folder_path = 1;
+  if (this->folder_path().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->folder_path().data(), this->folder_path().length(),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "deepflow.MnistParam.folder_path");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      1, this->folder_path(), output);
   }
 
-  // float alpha = 2;
-  if (this->alpha() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(2, this->alpha(), output);
+  // .deepflow.MnistParam.ReaderType reader_type = 2;
+  if (this->reader_type() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      2, this->reader_type(), output);
   }
 
-  // float beta = 3;
-  if (this->beta() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(3, this->beta(), output);
+  // .deepflow.MnistParam.OutputType output_type = 3;
+  if (this->output_type() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      3, this->output_type(), output);
   }
 
-  // float k = 4;
-  if (this->k() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(4, this->k(), output);
+  // int32 batch_size = 4;
+  if (this->batch_size() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(4, this->batch_size(), output);
   }
 
-  // @@protoc_insertion_point(serialize_end:deepflow.LrnParam)
+  // @@protoc_insertion_point(serialize_end:deepflow.MnistParam)
 }
 
-::google::protobuf::uint8* LrnParam::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* MnistParam::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:deepflow.LrnParam)
+  // @@protoc_insertion_point(serialize_to_array_start:deepflow.MnistParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // int32 n = 1;
-  if (this->n() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->n(), target);
+  // string folder_path = 1;
+  if (this->folder_path().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->folder_path().data(), this->folder_path().length(),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "deepflow.MnistParam.folder_path");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        1, this->folder_path(), target);
   }
 
-  // float alpha = 2;
-  if (this->alpha() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(2, this->alpha(), target);
+  // .deepflow.MnistParam.ReaderType reader_type = 2;
+  if (this->reader_type() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
+      2, this->reader_type(), target);
   }
 
-  // float beta = 3;
-  if (this->beta() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(3, this->beta(), target);
+  // .deepflow.MnistParam.OutputType output_type = 3;
+  if (this->output_type() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
+      3, this->output_type(), target);
   }
 
-  // float k = 4;
-  if (this->k() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(4, this->k(), target);
+  // int32 batch_size = 4;
+  if (this->batch_size() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(4, this->batch_size(), target);
   }
 
-  // @@protoc_insertion_point(serialize_to_array_end:deepflow.LrnParam)
+  // @@protoc_insertion_point(serialize_to_array_end:deepflow.MnistParam)
   return target;
 }
 
-size_t LrnParam::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:deepflow.LrnParam)
+size_t MnistParam::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:deepflow.MnistParam)
   size_t total_size = 0;
 
-  // int32 n = 1;
-  if (this->n() != 0) {
+  // string folder_path = 1;
+  if (this->folder_path().size() > 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->n());
+      ::google::protobuf::internal::WireFormatLite::StringSize(
+        this->folder_path());
   }
 
-  // float alpha = 2;
-  if (this->alpha() != 0) {
-    total_size += 1 + 4;
+  // .deepflow.MnistParam.ReaderType reader_type = 2;
+  if (this->reader_type() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::EnumSize(this->reader_type());
   }
 
-  // float beta = 3;
-  if (this->beta() != 0) {
-    total_size += 1 + 4;
+  // .deepflow.MnistParam.OutputType output_type = 3;
+  if (this->output_type() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::EnumSize(this->output_type());
   }
 
-  // float k = 4;
-  if (this->k() != 0) {
-    total_size += 1 + 4;
+  // int32 batch_size = 4;
+  if (this->batch_size() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::Int32Size(
+        this->batch_size());
   }
 
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
@@ -15287,134 +15838,174 @@ size_t LrnParam::ByteSizeLong() const {
   return total_size;
 }
 
-void LrnParam::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:deepflow.LrnParam)
+void MnistParam::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:deepflow.MnistParam)
   GOOGLE_DCHECK_NE(&from, this);
-  const LrnParam* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const LrnParam>(
+  const MnistParam* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const MnistParam>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.LrnParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.MnistParam)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.LrnParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.MnistParam)
     MergeFrom(*source);
   }
 }
 
-void LrnParam::MergeFrom(const LrnParam& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.LrnParam)
+void MnistParam::MergeFrom(const MnistParam& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.MnistParam)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.n() != 0) {
-    set_n(from.n());
+  if (from.folder_path().size() > 0) {
+
+    folder_path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.folder_path_);
   }
-  if (from.alpha() != 0) {
-    set_alpha(from.alpha());
+  if (from.reader_type() != 0) {
+    set_reader_type(from.reader_type());
   }
-  if (from.beta() != 0) {
-    set_beta(from.beta());
+  if (from.output_type() != 0) {
+    set_output_type(from.output_type());
   }
-  if (from.k() != 0) {
-    set_k(from.k());
+  if (from.batch_size() != 0) {
+    set_batch_size(from.batch_size());
   }
 }
 
-void LrnParam::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:deepflow.LrnParam)
+void MnistParam::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:deepflow.MnistParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void LrnParam::CopyFrom(const LrnParam& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.LrnParam)
+void MnistParam::CopyFrom(const MnistParam& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.MnistParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool LrnParam::IsInitialized() const {
+bool MnistParam::IsInitialized() const {
   return true;
 }
 
-void LrnParam::Swap(LrnParam* other) {
+void MnistParam::Swap(MnistParam* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void LrnParam::InternalSwap(LrnParam* other) {
-  std::swap(n_, other->n_);
-  std::swap(alpha_, other->alpha_);
-  std::swap(beta_, other->beta_);
-  std::swap(k_, other->k_);
+void MnistParam::InternalSwap(MnistParam* other) {
+  folder_path_.Swap(&other->folder_path_);
+  std::swap(reader_type_, other->reader_type_);
+  std::swap(output_type_, other->output_type_);
+  std::swap(batch_size_, other->batch_size_);
   std::swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata LrnParam::GetMetadata() const {
+::google::protobuf::Metadata MnistParam::GetMetadata() const {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// LrnParam
+// MnistParam
 
-// int32 n = 1;
-void LrnParam::clear_n() {
-  n_ = 0;
+// string folder_path = 1;
+void MnistParam::clear_folder_path() {
+  folder_path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-::google::protobuf::int32 LrnParam::n() const {
-  // @@protoc_insertion_point(field_get:deepflow.LrnParam.n)
-  return n_;
+const ::std::string& MnistParam::folder_path() const {
+  // @@protoc_insertion_point(field_get:deepflow.MnistParam.folder_path)
+  return folder_path_.GetNoArena();
 }
-void LrnParam::set_n(::google::protobuf::int32 value) {
+void MnistParam::set_folder_path(const ::std::string& value) {
   
-  n_ = value;
-  // @@protoc_insertion_point(field_set:deepflow.LrnParam.n)
-}
-
-// float alpha = 2;
-void LrnParam::clear_alpha() {
-  alpha_ = 0;
+  folder_path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:deepflow.MnistParam.folder_path)
 }
-float LrnParam::alpha() const {
-  // @@protoc_insertion_point(field_get:deepflow.LrnParam.alpha)
-  return alpha_;
+#if LANG_CXX11
+void MnistParam::set_folder_path(::std::string&& value) {
+  
+  folder_path_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:deepflow.MnistParam.folder_path)
 }
-void LrnParam::set_alpha(float value) {
+#endif
+void MnistParam::set_folder_path(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
   
-  alpha_ = value;
-  // @@protoc_insertion_point(field_set:deepflow.LrnParam.alpha)
+  folder_path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:deepflow.MnistParam.folder_path)
+}
+void MnistParam::set_folder_path(const char* value, size_t size) {
+  
+  folder_path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:deepflow.MnistParam.folder_path)
+}
+::std::string* MnistParam::mutable_folder_path() {
+  
+  // @@protoc_insertion_point(field_mutable:deepflow.MnistParam.folder_path)
+  return folder_path_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+::std::string* MnistParam::release_folder_path() {
+  // @@protoc_insertion_point(field_release:deepflow.MnistParam.folder_path)
+  
+  return folder_path_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+void MnistParam::set_allocated_folder_path(::std::string* folder_path) {
+  if (folder_path != NULL) {
+    
+  } else {
+    
+  }
+  folder_path_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), folder_path);
+  // @@protoc_insertion_point(field_set_allocated:deepflow.MnistParam.folder_path)
 }
 
-// float beta = 3;
-void LrnParam::clear_beta() {
-  beta_ = 0;
+// .deepflow.MnistParam.ReaderType reader_type = 2;
+void MnistParam::clear_reader_type() {
+  reader_type_ = 0;
 }
-float LrnParam::beta() const {
-  // @@protoc_insertion_point(field_get:deepflow.LrnParam.beta)
-  return beta_;
+::deepflow::MnistParam_ReaderType MnistParam::reader_type() const {
+  // @@protoc_insertion_point(field_get:deepflow.MnistParam.reader_type)
+  return static_cast< ::deepflow::MnistParam_ReaderType >(reader_type_);
 }
-void LrnParam::set_beta(float value) {
+void MnistParam::set_reader_type(::deepflow::MnistParam_ReaderType value) {
   
-  beta_ = value;
-  // @@protoc_insertion_point(field_set:deepflow.LrnParam.beta)
+  reader_type_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.MnistParam.reader_type)
 }
 
-// float k = 4;
-void LrnParam::clear_k() {
-  k_ = 0;
+// .deepflow.MnistParam.OutputType output_type = 3;
+void MnistParam::clear_output_type() {
+  output_type_ = 0;
 }
-float LrnParam::k() const {
-  // @@protoc_insertion_point(field_get:deepflow.LrnParam.k)
-  return k_;
+::deepflow::MnistParam_OutputType MnistParam::output_type() const {
+  // @@protoc_insertion_point(field_get:deepflow.MnistParam.output_type)
+  return static_cast< ::deepflow::MnistParam_OutputType >(output_type_);
 }
-void LrnParam::set_k(float value) {
+void MnistParam::set_output_type(::deepflow::MnistParam_OutputType value) {
   
-  k_ = value;
-  // @@protoc_insertion_point(field_set:deepflow.LrnParam.k)
+  output_type_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.MnistParam.output_type)
+}
+
+// int32 batch_size = 4;
+void MnistParam::clear_batch_size() {
+  batch_size_ = 0;
+}
+::google::protobuf::int32 MnistParam::batch_size() const {
+  // @@protoc_insertion_point(field_get:deepflow.MnistParam.batch_size)
+  return batch_size_;
+}
+void MnistParam::set_batch_size(::google::protobuf::int32 value) {
+  
+  batch_size_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.MnistParam.batch_size)
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -15422,104 +16013,85 @@ void LrnParam::set_k(float value) {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int ResizeParam::kHeightScaleFieldNumber;
-const int ResizeParam::kWidthScaleFieldNumber;
+const int InstanceNormalizationParam::kEpsFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-ResizeParam::ResizeParam()
+InstanceNormalizationParam::InstanceNormalizationParam()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_deepflow_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:deepflow.ResizeParam)
+  // @@protoc_insertion_point(constructor:deepflow.InstanceNormalizationParam)
 }
-ResizeParam::ResizeParam(const ResizeParam& from)
+InstanceNormalizationParam::InstanceNormalizationParam(const InstanceNormalizationParam& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::memcpy(&height_scale_, &from.height_scale_,
-    reinterpret_cast<char*>(&width_scale_) -
-    reinterpret_cast<char*>(&height_scale_) + sizeof(width_scale_));
-  // @@protoc_insertion_point(copy_constructor:deepflow.ResizeParam)
+  eps_ = from.eps_;
+  // @@protoc_insertion_point(copy_constructor:deepflow.InstanceNormalizationParam)
 }
 
-void ResizeParam::SharedCtor() {
-  ::memset(&height_scale_, 0, reinterpret_cast<char*>(&width_scale_) -
-    reinterpret_cast<char*>(&height_scale_) + sizeof(width_scale_));
+void InstanceNormalizationParam::SharedCtor() {
+  eps_ = 0;
   _cached_size_ = 0;
 }
 
-ResizeParam::~ResizeParam() {
-  // @@protoc_insertion_point(destructor:deepflow.ResizeParam)
+InstanceNormalizationParam::~InstanceNormalizationParam() {
+  // @@protoc_insertion_point(destructor:deepflow.InstanceNormalizationParam)
   SharedDtor();
 }
 
-void ResizeParam::SharedDtor() {
+void InstanceNormalizationParam::SharedDtor() {
 }
 
-void ResizeParam::SetCachedSize(int size) const {
+void InstanceNormalizationParam::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* ResizeParam::descriptor() {
+const ::google::protobuf::Descriptor* InstanceNormalizationParam::descriptor() {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const ResizeParam& ResizeParam::default_instance() {
+const InstanceNormalizationParam& InstanceNormalizationParam::default_instance() {
   protobuf_deepflow_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-ResizeParam* ResizeParam::New(::google::protobuf::Arena* arena) const {
-  ResizeParam* n = new ResizeParam;
+InstanceNormalizationParam* InstanceNormalizationParam::New(::google::protobuf::Arena* arena) const {
+  InstanceNormalizationParam* n = new InstanceNormalizationParam;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void ResizeParam::Clear() {
-// @@protoc_insertion_point(message_clear_start:deepflow.ResizeParam)
-  ::memset(&height_scale_, 0, reinterpret_cast<char*>(&width_scale_) -
-    reinterpret_cast<char*>(&height_scale_) + sizeof(width_scale_));
+void InstanceNormalizationParam::Clear() {
+// @@protoc_insertion_point(message_clear_start:deepflow.InstanceNormalizationParam)
+  eps_ = 0;
 }
 
-bool ResizeParam::MergePartialFromCodedStream(
+bool InstanceNormalizationParam::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:deepflow.ResizeParam)
+  // @@protoc_insertion_point(parse_start:deepflow.InstanceNormalizationParam)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // float height_scale = 1;
+      // float eps = 1;
       case 1: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
             static_cast< ::google::protobuf::uint8>(13u)) {
 
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
                    float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &height_scale_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // float width_scale = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(21u)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &width_scale_)));
+                 input, &eps_)));
         } else {
           goto handle_unusual;
         }
@@ -15539,64 +16111,49 @@ bool ResizeParam::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:deepflow.ResizeParam)
+  // @@protoc_insertion_point(parse_success:deepflow.InstanceNormalizationParam)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:deepflow.ResizeParam)
+  // @@protoc_insertion_point(parse_failure:deepflow.InstanceNormalizationParam)
   return false;
 #undef DO_
 }
 
-void ResizeParam::SerializeWithCachedSizes(
+void InstanceNormalizationParam::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:deepflow.ResizeParam)
+  // @@protoc_insertion_point(serialize_start:deepflow.InstanceNormalizationParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // float height_scale = 1;
-  if (this->height_scale() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(1, this->height_scale(), output);
-  }
-
-  // float width_scale = 2;
-  if (this->width_scale() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(2, this->width_scale(), output);
+  // float eps = 1;
+  if (this->eps() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(1, this->eps(), output);
   }
 
-  // @@protoc_insertion_point(serialize_end:deepflow.ResizeParam)
+  // @@protoc_insertion_point(serialize_end:deepflow.InstanceNormalizationParam)
 }
 
-::google::protobuf::uint8* ResizeParam::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* InstanceNormalizationParam::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:deepflow.ResizeParam)
+  // @@protoc_insertion_point(serialize_to_array_start:deepflow.InstanceNormalizationParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // float height_scale = 1;
-  if (this->height_scale() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(1, this->height_scale(), target);
-  }
-
-  // float width_scale = 2;
-  if (this->width_scale() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(2, this->width_scale(), target);
+  // float eps = 1;
+  if (this->eps() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(1, this->eps(), target);
   }
 
-  // @@protoc_insertion_point(serialize_to_array_end:deepflow.ResizeParam)
+  // @@protoc_insertion_point(serialize_to_array_end:deepflow.InstanceNormalizationParam)
   return target;
 }
 
-size_t ResizeParam::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:deepflow.ResizeParam)
+size_t InstanceNormalizationParam::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:deepflow.InstanceNormalizationParam)
   size_t total_size = 0;
 
-  // float height_scale = 1;
-  if (this->height_scale() != 0) {
-    total_size += 1 + 4;
-  }
-
-  // float width_scale = 2;
-  if (this->width_scale() != 0) {
+  // float eps = 1;
+  if (this->eps() != 0) {
     total_size += 1 + 4;
   }
 
@@ -15607,98 +16164,80 @@ size_t ResizeParam::ByteSizeLong() const {
   return total_size;
 }
 
-void ResizeParam::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:deepflow.ResizeParam)
+void InstanceNormalizationParam::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:deepflow.InstanceNormalizationParam)
   GOOGLE_DCHECK_NE(&from, this);
-  const ResizeParam* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const ResizeParam>(
+  const InstanceNormalizationParam* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const InstanceNormalizationParam>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.ResizeParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.InstanceNormalizationParam)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.ResizeParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.InstanceNormalizationParam)
     MergeFrom(*source);
   }
 }
 
-void ResizeParam::MergeFrom(const ResizeParam& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.ResizeParam)
+void InstanceNormalizationParam::MergeFrom(const InstanceNormalizationParam& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.InstanceNormalizationParam)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.height_scale() != 0) {
-    set_height_scale(from.height_scale());
-  }
-  if (from.width_scale() != 0) {
-    set_width_scale(from.width_scale());
+  if (from.eps() != 0) {
+    set_eps(from.eps());
   }
 }
 
-void ResizeParam::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:deepflow.ResizeParam)
+void InstanceNormalizationParam::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:deepflow.InstanceNormalizationParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void ResizeParam::CopyFrom(const ResizeParam& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.ResizeParam)
+void InstanceNormalizationParam::CopyFrom(const InstanceNormalizationParam& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.InstanceNormalizationParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool ResizeParam::IsInitialized() const {
+bool InstanceNormalizationParam::IsInitialized() const {
   return true;
 }
 
-void ResizeParam::Swap(ResizeParam* other) {
+void InstanceNormalizationParam::Swap(InstanceNormalizationParam* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void ResizeParam::InternalSwap(ResizeParam* other) {
-  std::swap(height_scale_, other->height_scale_);
-  std::swap(width_scale_, other->width_scale_);
+void InstanceNormalizationParam::InternalSwap(InstanceNormalizationParam* other) {
+  std::swap(eps_, other->eps_);
   std::swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata ResizeParam::GetMetadata() const {
+::google::protobuf::Metadata InstanceNormalizationParam::GetMetadata() const {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// ResizeParam
-
-// float height_scale = 1;
-void ResizeParam::clear_height_scale() {
-  height_scale_ = 0;
-}
-float ResizeParam::height_scale() const {
-  // @@protoc_insertion_point(field_get:deepflow.ResizeParam.height_scale)
-  return height_scale_;
-}
-void ResizeParam::set_height_scale(float value) {
-  
-  height_scale_ = value;
-  // @@protoc_insertion_point(field_set:deepflow.ResizeParam.height_scale)
-}
+// InstanceNormalizationParam
 
-// float width_scale = 2;
-void ResizeParam::clear_width_scale() {
-  width_scale_ = 0;
+// float eps = 1;
+void InstanceNormalizationParam::clear_eps() {
+  eps_ = 0;
 }
-float ResizeParam::width_scale() const {
-  // @@protoc_insertion_point(field_get:deepflow.ResizeParam.width_scale)
-  return width_scale_;
+float InstanceNormalizationParam::eps() const {
+  // @@protoc_insertion_point(field_get:deepflow.InstanceNormalizationParam.eps)
+  return eps_;
 }
-void ResizeParam::set_width_scale(float value) {
+void InstanceNormalizationParam::set_eps(float value) {
   
-  width_scale_ = value;
-  // @@protoc_insertion_point(field_set:deepflow.ResizeParam.width_scale)
+  eps_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.InstanceNormalizationParam.eps)
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -15706,288 +16245,776 @@ void ResizeParam::set_width_scale(float value) {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int BatchNormalizationParam::kModeFieldNumber;
+const int BatchNormalizationParam::kCacheMeanvarFieldNumber;
+const int BatchNormalizationParam::kMeanFieldNumber;
+const int BatchNormalizationParam::kVarFieldNumber;
+const int BatchNormalizationParam::kExpAvgFactorFieldNumber;
+const int BatchNormalizationParam::kEpsFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-SquareParam::SquareParam()
+BatchNormalizationParam::BatchNormalizationParam()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_deepflow_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:deepflow.SquareParam)
+  // @@protoc_insertion_point(constructor:deepflow.BatchNormalizationParam)
 }
-SquareParam::SquareParam(const SquareParam& from)
+BatchNormalizationParam::BatchNormalizationParam(const BatchNormalizationParam& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:deepflow.SquareParam)
+  if (from.has_mean()) {
+    mean_ = new ::deepflow::TensorData(*from.mean_);
+  } else {
+    mean_ = NULL;
+  }
+  if (from.has_var()) {
+    var_ = new ::deepflow::TensorData(*from.var_);
+  } else {
+    var_ = NULL;
+  }
+  ::memcpy(&mode_, &from.mode_,
+    reinterpret_cast<char*>(&eps_) -
+    reinterpret_cast<char*>(&mode_) + sizeof(eps_));
+  // @@protoc_insertion_point(copy_constructor:deepflow.BatchNormalizationParam)
 }
 
-void SquareParam::SharedCtor() {
+void BatchNormalizationParam::SharedCtor() {
+  ::memset(&mean_, 0, reinterpret_cast<char*>(&eps_) -
+    reinterpret_cast<char*>(&mean_) + sizeof(eps_));
   _cached_size_ = 0;
 }
 
-SquareParam::~SquareParam() {
-  // @@protoc_insertion_point(destructor:deepflow.SquareParam)
+BatchNormalizationParam::~BatchNormalizationParam() {
+  // @@protoc_insertion_point(destructor:deepflow.BatchNormalizationParam)
   SharedDtor();
 }
 
-void SquareParam::SharedDtor() {
+void BatchNormalizationParam::SharedDtor() {
+  if (this != internal_default_instance()) {
+    delete mean_;
+  }
+  if (this != internal_default_instance()) {
+    delete var_;
+  }
 }
 
-void SquareParam::SetCachedSize(int size) const {
+void BatchNormalizationParam::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* SquareParam::descriptor() {
+const ::google::protobuf::Descriptor* BatchNormalizationParam::descriptor() {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const SquareParam& SquareParam::default_instance() {
+const BatchNormalizationParam& BatchNormalizationParam::default_instance() {
   protobuf_deepflow_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-SquareParam* SquareParam::New(::google::protobuf::Arena* arena) const {
-  SquareParam* n = new SquareParam;
+BatchNormalizationParam* BatchNormalizationParam::New(::google::protobuf::Arena* arena) const {
+  BatchNormalizationParam* n = new BatchNormalizationParam;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void SquareParam::Clear() {
-// @@protoc_insertion_point(message_clear_start:deepflow.SquareParam)
+void BatchNormalizationParam::Clear() {
+// @@protoc_insertion_point(message_clear_start:deepflow.BatchNormalizationParam)
+  if (GetArenaNoVirtual() == NULL && mean_ != NULL) {
+    delete mean_;
+  }
+  mean_ = NULL;
+  if (GetArenaNoVirtual() == NULL && var_ != NULL) {
+    delete var_;
+  }
+  var_ = NULL;
+  ::memset(&mode_, 0, reinterpret_cast<char*>(&eps_) -
+    reinterpret_cast<char*>(&mode_) + sizeof(eps_));
 }
 
-bool SquareParam::MergePartialFromCodedStream(
+bool BatchNormalizationParam::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:deepflow.SquareParam)
+  // @@protoc_insertion_point(parse_start:deepflow.BatchNormalizationParam)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
     if (!p.second) goto handle_unusual;
-  handle_unusual:
-    if (tag == 0 ||
-        ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-        ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-      goto success;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // .deepflow.BatchNormalizationParam.Mode mode = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(8u)) {
+          int value;
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          set_mode(static_cast< ::deepflow::BatchNormalizationParam_Mode >(value));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // bool cache_meanvar = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(16u)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &cache_meanvar_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .deepflow.TensorData mean = 3;
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(26u)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_mean()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .deepflow.TensorData var = 4;
+      case 4: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(34u)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_var()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // float exp_avg_factor = 5;
+      case 5: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(45u)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, &exp_avg_factor_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // float eps = 6;
+      case 6: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(53u)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, &eps_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0 ||
+            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
+        break;
+      }
     }
-    DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
   }
 success:
-  // @@protoc_insertion_point(parse_success:deepflow.SquareParam)
+  // @@protoc_insertion_point(parse_success:deepflow.BatchNormalizationParam)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:deepflow.SquareParam)
+  // @@protoc_insertion_point(parse_failure:deepflow.BatchNormalizationParam)
   return false;
 #undef DO_
 }
 
-void SquareParam::SerializeWithCachedSizes(
+void BatchNormalizationParam::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:deepflow.SquareParam)
+  // @@protoc_insertion_point(serialize_start:deepflow.BatchNormalizationParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // @@protoc_insertion_point(serialize_end:deepflow.SquareParam)
+  // .deepflow.BatchNormalizationParam.Mode mode = 1;
+  if (this->mode() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      1, this->mode(), output);
+  }
+
+  // bool cache_meanvar = 2;
+  if (this->cache_meanvar() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(2, this->cache_meanvar(), output);
+  }
+
+  // .deepflow.TensorData mean = 3;
+  if (this->has_mean()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      3, *this->mean_, output);
+  }
+
+  // .deepflow.TensorData var = 4;
+  if (this->has_var()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      4, *this->var_, output);
+  }
+
+  // float exp_avg_factor = 5;
+  if (this->exp_avg_factor() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(5, this->exp_avg_factor(), output);
+  }
+
+  // float eps = 6;
+  if (this->eps() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(6, this->eps(), output);
+  }
+
+  // @@protoc_insertion_point(serialize_end:deepflow.BatchNormalizationParam)
 }
 
-::google::protobuf::uint8* SquareParam::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* BatchNormalizationParam::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:deepflow.SquareParam)
+  // @@protoc_insertion_point(serialize_to_array_start:deepflow.BatchNormalizationParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // @@protoc_insertion_point(serialize_to_array_end:deepflow.SquareParam)
-  return target;
-}
+  // .deepflow.BatchNormalizationParam.Mode mode = 1;
+  if (this->mode() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
+      1, this->mode(), target);
+  }
 
-size_t SquareParam::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:deepflow.SquareParam)
-  size_t total_size = 0;
+  // bool cache_meanvar = 2;
+  if (this->cache_meanvar() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(2, this->cache_meanvar(), target);
+  }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = cached_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  // .deepflow.TensorData mean = 3;
+  if (this->has_mean()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        3, *this->mean_, deterministic, target);
+  }
+
+  // .deepflow.TensorData var = 4;
+  if (this->has_var()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        4, *this->var_, deterministic, target);
+  }
+
+  // float exp_avg_factor = 5;
+  if (this->exp_avg_factor() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(5, this->exp_avg_factor(), target);
+  }
+
+  // float eps = 6;
+  if (this->eps() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(6, this->eps(), target);
+  }
+
+  // @@protoc_insertion_point(serialize_to_array_end:deepflow.BatchNormalizationParam)
+  return target;
+}
+
+size_t BatchNormalizationParam::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:deepflow.BatchNormalizationParam)
+  size_t total_size = 0;
+
+  // .deepflow.TensorData mean = 3;
+  if (this->has_mean()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        *this->mean_);
+  }
+
+  // .deepflow.TensorData var = 4;
+  if (this->has_var()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        *this->var_);
+  }
+
+  // .deepflow.BatchNormalizationParam.Mode mode = 1;
+  if (this->mode() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::EnumSize(this->mode());
+  }
+
+  // bool cache_meanvar = 2;
+  if (this->cache_meanvar() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // float exp_avg_factor = 5;
+  if (this->exp_avg_factor() != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float eps = 6;
+  if (this->eps() != 0) {
+    total_size += 1 + 4;
+  }
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
   return total_size;
 }
 
-void SquareParam::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:deepflow.SquareParam)
+void BatchNormalizationParam::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:deepflow.BatchNormalizationParam)
   GOOGLE_DCHECK_NE(&from, this);
-  const SquareParam* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const SquareParam>(
+  const BatchNormalizationParam* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const BatchNormalizationParam>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.SquareParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.BatchNormalizationParam)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.SquareParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.BatchNormalizationParam)
     MergeFrom(*source);
   }
 }
 
-void SquareParam::MergeFrom(const SquareParam& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.SquareParam)
+void BatchNormalizationParam::MergeFrom(const BatchNormalizationParam& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.BatchNormalizationParam)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
+  if (from.has_mean()) {
+    mutable_mean()->::deepflow::TensorData::MergeFrom(from.mean());
+  }
+  if (from.has_var()) {
+    mutable_var()->::deepflow::TensorData::MergeFrom(from.var());
+  }
+  if (from.mode() != 0) {
+    set_mode(from.mode());
+  }
+  if (from.cache_meanvar() != 0) {
+    set_cache_meanvar(from.cache_meanvar());
+  }
+  if (from.exp_avg_factor() != 0) {
+    set_exp_avg_factor(from.exp_avg_factor());
+  }
+  if (from.eps() != 0) {
+    set_eps(from.eps());
+  }
 }
 
-void SquareParam::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:deepflow.SquareParam)
+void BatchNormalizationParam::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:deepflow.BatchNormalizationParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void SquareParam::CopyFrom(const SquareParam& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.SquareParam)
+void BatchNormalizationParam::CopyFrom(const BatchNormalizationParam& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.BatchNormalizationParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool SquareParam::IsInitialized() const {
+bool BatchNormalizationParam::IsInitialized() const {
   return true;
 }
 
-void SquareParam::Swap(SquareParam* other) {
+void BatchNormalizationParam::Swap(BatchNormalizationParam* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void SquareParam::InternalSwap(SquareParam* other) {
+void BatchNormalizationParam::InternalSwap(BatchNormalizationParam* other) {
+  std::swap(mean_, other->mean_);
+  std::swap(var_, other->var_);
+  std::swap(mode_, other->mode_);
+  std::swap(cache_meanvar_, other->cache_meanvar_);
+  std::swap(exp_avg_factor_, other->exp_avg_factor_);
+  std::swap(eps_, other->eps_);
   std::swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata SquareParam::GetMetadata() const {
+::google::protobuf::Metadata BatchNormalizationParam::GetMetadata() const {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// SquareParam
+// BatchNormalizationParam
+
+// .deepflow.BatchNormalizationParam.Mode mode = 1;
+void BatchNormalizationParam::clear_mode() {
+  mode_ = 0;
+}
+::deepflow::BatchNormalizationParam_Mode BatchNormalizationParam::mode() const {
+  // @@protoc_insertion_point(field_get:deepflow.BatchNormalizationParam.mode)
+  return static_cast< ::deepflow::BatchNormalizationParam_Mode >(mode_);
+}
+void BatchNormalizationParam::set_mode(::deepflow::BatchNormalizationParam_Mode value) {
+  
+  mode_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.BatchNormalizationParam.mode)
+}
+
+// bool cache_meanvar = 2;
+void BatchNormalizationParam::clear_cache_meanvar() {
+  cache_meanvar_ = false;
+}
+bool BatchNormalizationParam::cache_meanvar() const {
+  // @@protoc_insertion_point(field_get:deepflow.BatchNormalizationParam.cache_meanvar)
+  return cache_meanvar_;
+}
+void BatchNormalizationParam::set_cache_meanvar(bool value) {
+  
+  cache_meanvar_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.BatchNormalizationParam.cache_meanvar)
+}
+
+// .deepflow.TensorData mean = 3;
+bool BatchNormalizationParam::has_mean() const {
+  return this != internal_default_instance() && mean_ != NULL;
+}
+void BatchNormalizationParam::clear_mean() {
+  if (GetArenaNoVirtual() == NULL && mean_ != NULL) delete mean_;
+  mean_ = NULL;
+}
+const ::deepflow::TensorData& BatchNormalizationParam::mean() const {
+  // @@protoc_insertion_point(field_get:deepflow.BatchNormalizationParam.mean)
+  return mean_ != NULL ? *mean_
+                         : *::deepflow::TensorData::internal_default_instance();
+}
+::deepflow::TensorData* BatchNormalizationParam::mutable_mean() {
+  
+  if (mean_ == NULL) {
+    mean_ = new ::deepflow::TensorData;
+  }
+  // @@protoc_insertion_point(field_mutable:deepflow.BatchNormalizationParam.mean)
+  return mean_;
+}
+::deepflow::TensorData* BatchNormalizationParam::release_mean() {
+  // @@protoc_insertion_point(field_release:deepflow.BatchNormalizationParam.mean)
+  
+  ::deepflow::TensorData* temp = mean_;
+  mean_ = NULL;
+  return temp;
+}
+void BatchNormalizationParam::set_allocated_mean(::deepflow::TensorData* mean) {
+  delete mean_;
+  mean_ = mean;
+  if (mean) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:deepflow.BatchNormalizationParam.mean)
+}
+
+// .deepflow.TensorData var = 4;
+bool BatchNormalizationParam::has_var() const {
+  return this != internal_default_instance() && var_ != NULL;
+}
+void BatchNormalizationParam::clear_var() {
+  if (GetArenaNoVirtual() == NULL && var_ != NULL) delete var_;
+  var_ = NULL;
+}
+const ::deepflow::TensorData& BatchNormalizationParam::var() const {
+  // @@protoc_insertion_point(field_get:deepflow.BatchNormalizationParam.var)
+  return var_ != NULL ? *var_
+                         : *::deepflow::TensorData::internal_default_instance();
+}
+::deepflow::TensorData* BatchNormalizationParam::mutable_var() {
+  
+  if (var_ == NULL) {
+    var_ = new ::deepflow::TensorData;
+  }
+  // @@protoc_insertion_point(field_mutable:deepflow.BatchNormalizationParam.var)
+  return var_;
+}
+::deepflow::TensorData* BatchNormalizationParam::release_var() {
+  // @@protoc_insertion_point(field_release:deepflow.BatchNormalizationParam.var)
+  
+  ::deepflow::TensorData* temp = var_;
+  var_ = NULL;
+  return temp;
+}
+void BatchNormalizationParam::set_allocated_var(::deepflow::TensorData* var) {
+  delete var_;
+  var_ = var;
+  if (var) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:deepflow.BatchNormalizationParam.var)
+}
+
+// float exp_avg_factor = 5;
+void BatchNormalizationParam::clear_exp_avg_factor() {
+  exp_avg_factor_ = 0;
+}
+float BatchNormalizationParam::exp_avg_factor() const {
+  // @@protoc_insertion_point(field_get:deepflow.BatchNormalizationParam.exp_avg_factor)
+  return exp_avg_factor_;
+}
+void BatchNormalizationParam::set_exp_avg_factor(float value) {
+  
+  exp_avg_factor_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.BatchNormalizationParam.exp_avg_factor)
+}
+
+// float eps = 6;
+void BatchNormalizationParam::clear_eps() {
+  eps_ = 0;
+}
+float BatchNormalizationParam::eps() const {
+  // @@protoc_insertion_point(field_get:deepflow.BatchNormalizationParam.eps)
+  return eps_;
+}
+void BatchNormalizationParam::set_eps(float value) {
+  
+  eps_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.BatchNormalizationParam.eps)
+}
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int ReplayMemoryParam::kCapacityFieldNumber;
+const int ReplayMemoryParam::kPrioritizedFieldNumber;
+const int ReplayMemoryParam::kAlphaFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-AbsParam::AbsParam()
+ReplayMemoryParam::ReplayMemoryParam()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_deepflow_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:deepflow.AbsParam)
+  // @@protoc_insertion_point(constructor:deepflow.ReplayMemoryParam)
 }
-AbsParam::AbsParam(const AbsParam& from)
+ReplayMemoryParam::ReplayMemoryParam(const ReplayMemoryParam& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:deepflow.AbsParam)
+  ::memcpy(&capacity_, &from.capacity_,
+    reinterpret_cast<char*>(&alpha_) -
+    reinterpret_cast<char*>(&capacity_) + sizeof(alpha_));
+  // @@protoc_insertion_point(copy_constructor:deepflow.ReplayMemoryParam)
 }
 
-void AbsParam::SharedCtor() {
+void ReplayMemoryParam::SharedCtor() {
+  ::memset(&capacity_, 0, reinterpret_cast<char*>(&alpha_) -
+    reinterpret_cast<char*>(&capacity_) + sizeof(alpha_));
   _cached_size_ = 0;
 }
 
-AbsParam::~AbsParam() {
-  // @@protoc_insertion_point(destructor:deepflow.AbsParam)
+ReplayMemoryParam::~ReplayMemoryParam() {
+  // @@protoc_insertion_point(destructor:deepflow.ReplayMemoryParam)
   SharedDtor();
 }
 
-void AbsParam::SharedDtor() {
+void ReplayMemoryParam::SharedDtor() {
 }
 
-void AbsParam::SetCachedSize(int size) const {
+void ReplayMemoryParam::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* AbsParam::descriptor() {
+const ::google::protobuf::Descriptor* ReplayMemoryParam::descriptor() {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const AbsParam& AbsParam::default_instance() {
+const ReplayMemoryParam& ReplayMemoryParam::default_instance() {
   protobuf_deepflow_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-AbsParam* AbsParam::New(::google::protobuf::Arena* arena) const {
-  AbsParam* n = new AbsParam;
+ReplayMemoryParam* ReplayMemoryParam::New(::google::protobuf::Arena* arena) const {
+  ReplayMemoryParam* n = new ReplayMemoryParam;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void AbsParam::Clear() {
-// @@protoc_insertion_point(message_clear_start:deepflow.AbsParam)
+void ReplayMemoryParam::Clear() {
+// @@protoc_insertion_point(message_clear_start:deepflow.ReplayMemoryParam)
+  ::memset(&capacity_, 0, reinterpret_cast<char*>(&alpha_) -
+    reinterpret_cast<char*>(&capacity_) + sizeof(alpha_));
 }
 
-bool AbsParam::MergePartialFromCodedStream(
+bool ReplayMemoryParam::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:deepflow.AbsParam)
+  // @@protoc_insertion_point(parse_start:deepflow.ReplayMemoryParam)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
     if (!p.second) goto handle_unusual;
-  handle_unusual:
-    if (tag == 0 ||
-        ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-        ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-      goto success;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // int32 capacity = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(8u)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &capacity_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // bool prioritized = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(16u)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &prioritized_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // float alpha = 3;
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(29u)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, &alpha_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0 ||
+            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
+        break;
+      }
     }
-    DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
   }
 success:
-  // @@protoc_insertion_point(parse_success:deepflow.AbsParam)
+  // @@protoc_insertion_point(parse_success:deepflow.ReplayMemoryParam)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:deepflow.AbsParam)
+  // @@protoc_insertion_point(parse_failure:deepflow.ReplayMemoryParam)
   return false;
 #undef DO_
 }
 
-void AbsParam::SerializeWithCachedSizes(
+void ReplayMemoryParam::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:deepflow.AbsParam)
+  // @@protoc_insertion_point(serialize_start:deepflow.ReplayMemoryParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // @@protoc_insertion_point(serialize_end:deepflow.AbsParam)
+  // int32 capacity = 1;
+  if (this->capacity() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->capacity(), output);
+  }
+
+  // bool prioritized = 2;
+  if (this->prioritized() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(2, this->prioritized(), output);
+  }
+
+  // float alpha = 3;
+  if (this->alpha() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(3, this->alpha(), output);
+  }
+
+  // @@protoc_insertion_point(serialize_end:deepflow.ReplayMemoryParam)
 }
 
-::google::protobuf::uint8* AbsParam::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* ReplayMemoryParam::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:deepflow.AbsParam)
+  // @@protoc_insertion_point(serialize_to_array_start:deepflow.ReplayMemoryParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // @@protoc_insertion_point(serialize_to_array_end:deepflow.AbsParam)
+  // int32 capacity = 1;
+  if (this->capacity() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->capacity(), target);
+  }
+
+  // bool prioritized = 2;
+  if (this->prioritized() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(2, this->prioritized(), target);
+  }
+
+  // float alpha = 3;
+  if (this->alpha() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(3, this->alpha(), target);
+  }
+
+  // @@protoc_insertion_point(serialize_to_array_end:deepflow.ReplayMemoryParam)
   return target;
 }
 
-size_t AbsParam::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:deepflow.AbsParam)
+size_t ReplayMemoryParam::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:deepflow.ReplayMemoryParam)
   size_t total_size = 0;
 
+  // int32 capacity = 1;
+  if (this->capacity() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::Int32Size(
+        this->capacity());
+  }
+
+  // bool prioritized = 2;
+  if (this->prioritized() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // float alpha = 3;
+  if (this->alpha() != 0) {
+    total_size += 1 + 4;
+  }
+
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = cached_size;
@@ -15995,175 +17022,363 @@ size_t AbsParam::ByteSizeLong() const {
   return total_size;
 }
 
-void AbsParam::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:deepflow.AbsParam)
+void ReplayMemoryParam::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:deepflow.ReplayMemoryParam)
   GOOGLE_DCHECK_NE(&from, this);
-  const AbsParam* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const AbsParam>(
+  const ReplayMemoryParam* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const ReplayMemoryParam>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.AbsParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.ReplayMemoryParam)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.AbsParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.ReplayMemoryParam)
     MergeFrom(*source);
   }
 }
 
-void AbsParam::MergeFrom(const AbsParam& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.AbsParam)
+void ReplayMemoryParam::MergeFrom(const ReplayMemoryParam& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.ReplayMemoryParam)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
+  if (from.capacity() != 0) {
+    set_capacity(from.capacity());
+  }
+  if (from.prioritized() != 0) {
+    set_prioritized(from.prioritized());
+  }
+  if (from.alpha() != 0) {
+    set_alpha(from.alpha());
+  }
 }
 
-void AbsParam::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:deepflow.AbsParam)
+void ReplayMemoryParam::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:deepflow.ReplayMemoryParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void AbsParam::CopyFrom(const AbsParam& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.AbsParam)
+void ReplayMemoryParam::CopyFrom(const ReplayMemoryParam& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.ReplayMemoryParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool AbsParam::IsInitialized() const {
+bool ReplayMemoryParam::IsInitialized() const {
   return true;
 }
 
-void AbsParam::Swap(AbsParam* other) {
+void ReplayMemoryParam::Swap(ReplayMemoryParam* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void AbsParam::InternalSwap(AbsParam* other) {
+void ReplayMemoryParam::InternalSwap(ReplayMemoryParam* other) {
+  std::swap(capacity_, other->capacity_);
+  std::swap(prioritized_, other->prioritized_);
+  std::swap(alpha_, other->alpha_);
   std::swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata AbsParam::GetMetadata() const {
+::google::protobuf::Metadata ReplayMemoryParam::GetMetadata() const {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// AbsParam
+// ReplayMemoryParam
+
+// int32 capacity = 1;
+void ReplayMemoryParam::clear_capacity() {
+  capacity_ = 0;
+}
+::google::protobuf::int32 ReplayMemoryParam::capacity() const {
+  // @@protoc_insertion_point(field_get:deepflow.ReplayMemoryParam.capacity)
+  return capacity_;
+}
+void ReplayMemoryParam::set_capacity(::google::protobuf::int32 value) {
+  
+  capacity_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.ReplayMemoryParam.capacity)
+}
+
+// bool prioritized = 2;
+void ReplayMemoryParam::clear_prioritized() {
+  prioritized_ = false;
+}
+bool ReplayMemoryParam::prioritized() const {
+  // @@protoc_insertion_point(field_get:deepflow.ReplayMemoryParam.prioritized)
+  return prioritized_;
+}
+void ReplayMemoryParam::set_prioritized(bool value) {
+  
+  prioritized_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.ReplayMemoryParam.prioritized)
+}
+
+// float alpha = 3;
+void ReplayMemoryParam::clear_alpha() {
+  alpha_ = 0;
+}
+float ReplayMemoryParam::alpha() const {
+  // @@protoc_insertion_point(field_get:deepflow.ReplayMemoryParam.alpha)
+  return alpha_;
+}
+void ReplayMemoryParam::set_alpha(float value) {
+  
+  alpha_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.ReplayMemoryParam.alpha)
+}
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int LrnParam::kNFieldNumber;
+const int LrnParam::kAlphaFieldNumber;
+const int LrnParam::kBetaFieldNumber;
+const int LrnParam::kKFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-SquareErrorParam::SquareErrorParam()
+LrnParam::LrnParam()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_deepflow_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:deepflow.SquareErrorParam)
+  // @@protoc_insertion_point(constructor:deepflow.LrnParam)
 }
-SquareErrorParam::SquareErrorParam(const SquareErrorParam& from)
+LrnParam::LrnParam(const LrnParam& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:deepflow.SquareErrorParam)
+  ::memcpy(&n_, &from.n_,
+    reinterpret_cast<char*>(&k_) -
+    reinterpret_cast<char*>(&n_) + sizeof(k_));
+  // @@protoc_insertion_point(copy_constructor:deepflow.LrnParam)
 }
 
-void SquareErrorParam::SharedCtor() {
+void LrnParam::SharedCtor() {
+  ::memset(&n_, 0, reinterpret_cast<char*>(&k_) -
+    reinterpret_cast<char*>(&n_) + sizeof(k_));
   _cached_size_ = 0;
 }
 
-SquareErrorParam::~SquareErrorParam() {
-  // @@protoc_insertion_point(destructor:deepflow.SquareErrorParam)
+LrnParam::~LrnParam() {
+  // @@protoc_insertion_point(destructor:deepflow.LrnParam)
   SharedDtor();
 }
 
-void SquareErrorParam::SharedDtor() {
+void LrnParam::SharedDtor() {
 }
 
-void SquareErrorParam::SetCachedSize(int size) const {
+void LrnParam::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* SquareErrorParam::descriptor() {
+const ::google::protobuf::Descriptor* LrnParam::descriptor() {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const SquareErrorParam& SquareErrorParam::default_instance() {
+const LrnParam& LrnParam::default_instance() {
   protobuf_deepflow_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-SquareErrorParam* SquareErrorParam::New(::google::protobuf::Arena* arena) const {
-  SquareErrorParam* n = new SquareErrorParam;
-  if (arena != NULL) {
+LrnParam* LrnParam::New(::google::protobuf::Arena* arena) const {
+  LrnParam* n = new LrnParam;
+  if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void SquareErrorParam::Clear() {
-// @@protoc_insertion_point(message_clear_start:deepflow.SquareErrorParam)
+void LrnParam::Clear() {
+// @@protoc_insertion_point(message_clear_start:deepflow.LrnParam)
+  ::memset(&n_, 0, reinterpret_cast<char*>(&k_) -
+    reinterpret_cast<char*>(&n_) + sizeof(k_));
 }
 
-bool SquareErrorParam::MergePartialFromCodedStream(
+bool LrnParam::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:deepflow.SquareErrorParam)
+  // @@protoc_insertion_point(parse_start:deepflow.LrnParam)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
     if (!p.second) goto handle_unusual;
-  handle_unusual:
-    if (tag == 0 ||
-        ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-        ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-      goto success;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // int32 n = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(8u)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &n_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // float alpha = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(21u)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, &alpha_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // float beta = 3;
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(29u)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, &beta_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // float k = 4;
+      case 4: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(37u)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, &k_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0 ||
+            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
+        break;
+      }
     }
-    DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
   }
 success:
-  // @@protoc_insertion_point(parse_success:deepflow.SquareErrorParam)
+  // @@protoc_insertion_point(parse_success:deepflow.LrnParam)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:deepflow.SquareErrorParam)
+  // @@protoc_insertion_point(parse_failure:deepflow.LrnParam)
   return false;
 #undef DO_
 }
 
-void SquareErrorParam::SerializeWithCachedSizes(
+void LrnParam::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:deepflow.SquareErrorParam)
+  // @@protoc_insertion_point(serialize_start:deepflow.LrnParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // @@protoc_insertion_point(serialize_end:deepflow.SquareErrorParam)
+  // int32 n = 1;
+  if (this->n() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->n(), output);
+  }
+
+  // float alpha = 2;
+  if (this->alpha() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(2, this->alpha(), output);
+  }
+
+  // float beta = 3;
+  if (this->beta() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(3, this->beta(), output);
+  }
+
+  // float k = 4;
+  if (this->k() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(4, this->k(), output);
+  }
+
+  // @@protoc_insertion_point(serialize_end:deepflow.LrnParam)
 }
 
-::google::protobuf::uint8* SquareErrorParam::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* LrnParam::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:deepflow.SquareErrorParam)
+  // @@protoc_insertion_point(serialize_to_array_start:deepflow.LrnParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // @@protoc_insertion_point(serialize_to_array_end:deepflow.SquareErrorParam)
+  // int32 n = 1;
+  if (this->n() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->n(), target);
+  }
+
+  // float alpha = 2;
+  if (this->alpha() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(2, this->alpha(), target);
+  }
+
+  // float beta = 3;
+  if (this->beta() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(3, this->beta(), target);
+  }
+
+  // float k = 4;
+  if (this->k() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(4, this->k(), target);
+  }
+
+  // @@protoc_insertion_point(serialize_to_array_end:deepflow.LrnParam)
   return target;
 }
 
-size_t SquareErrorParam::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:deepflow.SquareErrorParam)
+size_t LrnParam::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:deepflow.LrnParam)
   size_t total_size = 0;
 
+  // int32 n = 1;
+  if (this->n() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::Int32Size(
+        this->n());
+  }
+
+  // float alpha = 2;
+  if (this->alpha() != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float beta = 3;
+  if (this->beta() != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float k = 4;
+  if (this->k() != 0) {
+    total_size += 1 + 4;
+  }
+
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = cached_size;
@@ -16171,149 +17386,300 @@ size_t SquareErrorParam::ByteSizeLong() const {
   return total_size;
 }
 
-void SquareErrorParam::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:deepflow.SquareErrorParam)
+void LrnParam::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:deepflow.LrnParam)
   GOOGLE_DCHECK_NE(&from, this);
-  const SquareErrorParam* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const SquareErrorParam>(
+  const LrnParam* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const LrnParam>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.SquareErrorParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.LrnParam)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.SquareErrorParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.LrnParam)
     MergeFrom(*source);
   }
 }
 
-void SquareErrorParam::MergeFrom(const SquareErrorParam& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.SquareErrorParam)
+void LrnParam::MergeFrom(const LrnParam& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.LrnParam)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
+  if (from.n() != 0) {
+    set_n(from.n());
+  }
+  if (from.alpha() != 0) {
+    set_alpha(from.alpha());
+  }
+  if (from.beta() != 0) {
+    set_beta(from.beta());
+  }
+  if (from.k() != 0) {
+    set_k(from.k());
+  }
 }
 
-void SquareErrorParam::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:deepflow.SquareErrorParam)
+void LrnParam::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:deepflow.LrnParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void SquareErrorParam::CopyFrom(const SquareErrorParam& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.SquareErrorParam)
+void LrnParam::CopyFrom(const LrnParam& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.LrnParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool SquareErrorParam::IsInitialized() const {
+bool LrnParam::IsInitialized() const {
   return true;
 }
 
-void SquareErrorParam::Swap(SquareErrorParam* other) {
+void LrnParam::Swap(LrnParam* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void SquareErrorParam::InternalSwap(SquareErrorParam* other) {
+void LrnParam::InternalSwap(LrnParam* other) {
+  std::swap(n_, other->n_);
+  std::swap(alpha_, other->alpha_);
+  std::swap(beta_, other->beta_);
+  std::swap(k_, other->k_);
   std::swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata SquareErrorParam::GetMetadata() const {
+::google::protobuf::Metadata LrnParam::GetMetadata() const {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// SquareErrorParam
+// LrnParam
+
+// int32 n = 1;
+void LrnParam::clear_n() {
+  n_ = 0;
+}
+::google::protobuf::int32 LrnParam::n() const {
+  // @@protoc_insertion_point(field_get:deepflow.LrnParam.n)
+  return n_;
+}
+void LrnParam::set_n(::google::protobuf::int32 value) {
+  
+  n_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.LrnParam.n)
+}
+
+// float alpha = 2;
+void LrnParam::clear_alpha() {
+  alpha_ = 0;
+}
+float LrnParam::alpha() const {
+  // @@protoc_insertion_point(field_get:deepflow.LrnParam.alpha)
+  return alpha_;
+}
+void LrnParam::set_alpha(float value) {
+  
+  alpha_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.LrnParam.alpha)
+}
+
+// float beta = 3;
+void LrnParam::clear_beta() {
+  beta_ = 0;
+}
+float LrnParam::beta() const {
+  // @@protoc_insertion_point(field_get:deepflow.LrnParam.beta)
+  return beta_;
+}
+void LrnParam::set_beta(float value) {
+  
+  beta_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.LrnParam.beta)
+}
+
+// float k = 4;
+void LrnParam::clear_k() {
+  k_ = 0;
+}
+float LrnParam::k() const {
+  // @@protoc_insertion_point(field_get:deepflow.LrnParam.k)
+  return k_;
+}
+void LrnParam::set_k(float value) {
+  
+  k_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.LrnParam.k)
+}
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int SoftmaxParam::kModeFieldNumber;
+const int ResizeParam::kHeightScaleFieldNumber;
+const int ResizeParam::kWidthScaleFieldNumber;
+const int ResizeParam::kModeFieldNumber;
+const int ResizeParam::kAddFieldNumber;
+const int ResizeParam::kAlphaFieldNumber;
+const int ResizeParam::kBetaFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-SoftmaxParam::SoftmaxParam()
+ResizeParam::ResizeParam()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_deepflow_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:deepflow.SoftmaxParam)
+  // @@protoc_insertion_point(constructor:deepflow.ResizeParam)
 }
-SoftmaxParam::SoftmaxParam(const SoftmaxParam& from)
+ResizeParam::ResizeParam(const ResizeParam& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
-  mode_ = from.mode_;
-  // @@protoc_insertion_point(copy_constructor:deepflow.SoftmaxParam)
+  ::memcpy(&height_scale_, &from.height_scale_,
+    reinterpret_cast<char*>(&beta_) -
+    reinterpret_cast<char*>(&height_scale_) + sizeof(beta_));
+  // @@protoc_insertion_point(copy_constructor:deepflow.ResizeParam)
 }
 
-void SoftmaxParam::SharedCtor() {
-  mode_ = 0;
+void ResizeParam::SharedCtor() {
+  ::memset(&height_scale_, 0, reinterpret_cast<char*>(&beta_) -
+    reinterpret_cast<char*>(&height_scale_) + sizeof(beta_));
   _cached_size_ = 0;
 }
 
-SoftmaxParam::~SoftmaxParam() {
-  // @@protoc_insertion_point(destructor:deepflow.SoftmaxParam)
+ResizeParam::~ResizeParam() {
+  // @@protoc_insertion_point(destructor:deepflow.ResizeParam)
   SharedDtor();
 }
 
-void SoftmaxParam::SharedDtor() {
+void ResizeParam::SharedDtor() {
 }
 
-void SoftmaxParam::SetCachedSize(int size) const {
+void ResizeParam::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* SoftmaxParam::descriptor() {
+const ::google::protobuf::Descriptor* ResizeParam::descriptor() {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const SoftmaxParam& SoftmaxParam::default_instance() {
+const ResizeParam& ResizeParam::default_instance() {
   protobuf_deepflow_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-SoftmaxParam* SoftmaxParam::New(::google::protobuf::Arena* arena) const {
-  SoftmaxParam* n = new SoftmaxParam;
+ResizeParam* ResizeParam::New(::google::protobuf::Arena* arena) const {
+  ResizeParam* n = new ResizeParam;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void SoftmaxParam::Clear() {
-// @@protoc_insertion_point(message_clear_start:deepflow.SoftmaxParam)
-  mode_ = 0;
+void ResizeParam::Clear() {
+// @@protoc_insertion_point(message_clear_start:deepflow.ResizeParam)
+  ::memset(&height_scale_, 0, reinterpret_cast<char*>(&beta_) -
+    reinterpret_cast<char*>(&height_scale_) + sizeof(beta_));
 }
 
-bool SoftmaxParam::MergePartialFromCodedStream(
+bool ResizeParam::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:deepflow.SoftmaxParam)
+  // @@protoc_insertion_point(parse_start:deepflow.ResizeParam)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // .deepflow.SoftmaxParam.Mode mode = 1;
+      // float height_scale = 1;
       case 1: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u)) {
+            static_cast< ::google::protobuf::uint8>(13u)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, &height_scale_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // float width_scale = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(21u)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, &width_scale_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .deepflow.ResizeParam.Mode mode = 3;
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(24u)) {
           int value;
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
                    int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
                  input, &value)));
-          set_mode(static_cast< ::deepflow::SoftmaxParam_Mode >(value));
+          set_mode(static_cast< ::deepflow::ResizeParam_Mode >(value));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // bool add = 4;
+      case 4: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(32u)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &add_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // float alpha = 5;
+      case 5: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(45u)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, &alpha_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // float beta = 6;
+      case 6: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(53u)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, &beta_)));
         } else {
           goto handle_unusual;
         }
@@ -16333,55 +17699,130 @@ bool SoftmaxParam::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:deepflow.SoftmaxParam)
+  // @@protoc_insertion_point(parse_success:deepflow.ResizeParam)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:deepflow.SoftmaxParam)
+  // @@protoc_insertion_point(parse_failure:deepflow.ResizeParam)
   return false;
 #undef DO_
 }
 
-void SoftmaxParam::SerializeWithCachedSizes(
+void ResizeParam::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:deepflow.SoftmaxParam)
+  // @@protoc_insertion_point(serialize_start:deepflow.ResizeParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .deepflow.SoftmaxParam.Mode mode = 1;
+  // float height_scale = 1;
+  if (this->height_scale() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(1, this->height_scale(), output);
+  }
+
+  // float width_scale = 2;
+  if (this->width_scale() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(2, this->width_scale(), output);
+  }
+
+  // .deepflow.ResizeParam.Mode mode = 3;
   if (this->mode() != 0) {
     ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      1, this->mode(), output);
+      3, this->mode(), output);
   }
 
-  // @@protoc_insertion_point(serialize_end:deepflow.SoftmaxParam)
+  // bool add = 4;
+  if (this->add() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(4, this->add(), output);
+  }
+
+  // float alpha = 5;
+  if (this->alpha() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(5, this->alpha(), output);
+  }
+
+  // float beta = 6;
+  if (this->beta() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(6, this->beta(), output);
+  }
+
+  // @@protoc_insertion_point(serialize_end:deepflow.ResizeParam)
 }
 
-::google::protobuf::uint8* SoftmaxParam::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* ResizeParam::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:deepflow.SoftmaxParam)
+  // @@protoc_insertion_point(serialize_to_array_start:deepflow.ResizeParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .deepflow.SoftmaxParam.Mode mode = 1;
+  // float height_scale = 1;
+  if (this->height_scale() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(1, this->height_scale(), target);
+  }
+
+  // float width_scale = 2;
+  if (this->width_scale() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(2, this->width_scale(), target);
+  }
+
+  // .deepflow.ResizeParam.Mode mode = 3;
   if (this->mode() != 0) {
     target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      1, this->mode(), target);
+      3, this->mode(), target);
   }
 
-  // @@protoc_insertion_point(serialize_to_array_end:deepflow.SoftmaxParam)
+  // bool add = 4;
+  if (this->add() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(4, this->add(), target);
+  }
+
+  // float alpha = 5;
+  if (this->alpha() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(5, this->alpha(), target);
+  }
+
+  // float beta = 6;
+  if (this->beta() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(6, this->beta(), target);
+  }
+
+  // @@protoc_insertion_point(serialize_to_array_end:deepflow.ResizeParam)
   return target;
 }
 
-size_t SoftmaxParam::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:deepflow.SoftmaxParam)
+size_t ResizeParam::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:deepflow.ResizeParam)
   size_t total_size = 0;
 
-  // .deepflow.SoftmaxParam.Mode mode = 1;
+  // float height_scale = 1;
+  if (this->height_scale() != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float width_scale = 2;
+  if (this->width_scale() != 0) {
+    total_size += 1 + 4;
+  }
+
+  // .deepflow.ResizeParam.Mode mode = 3;
   if (this->mode() != 0) {
     total_size += 1 +
       ::google::protobuf::internal::WireFormatLite::EnumSize(this->mode());
   }
 
+  // bool add = 4;
+  if (this->add() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // float alpha = 5;
+  if (this->alpha() != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float beta = 6;
+  if (this->beta() != 0) {
+    total_size += 1 + 4;
+  }
+
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = cached_size;
@@ -16389,80 +17830,170 @@ size_t SoftmaxParam::ByteSizeLong() const {
   return total_size;
 }
 
-void SoftmaxParam::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:deepflow.SoftmaxParam)
+void ResizeParam::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:deepflow.ResizeParam)
   GOOGLE_DCHECK_NE(&from, this);
-  const SoftmaxParam* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const SoftmaxParam>(
+  const ResizeParam* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const ResizeParam>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.SoftmaxParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.ResizeParam)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.SoftmaxParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.ResizeParam)
     MergeFrom(*source);
   }
 }
 
-void SoftmaxParam::MergeFrom(const SoftmaxParam& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.SoftmaxParam)
+void ResizeParam::MergeFrom(const ResizeParam& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.ResizeParam)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
+  if (from.height_scale() != 0) {
+    set_height_scale(from.height_scale());
+  }
+  if (from.width_scale() != 0) {
+    set_width_scale(from.width_scale());
+  }
   if (from.mode() != 0) {
     set_mode(from.mode());
   }
+  if (from.add() != 0) {
+    set_add(from.add());
+  }
+  if (from.alpha() != 0) {
+    set_alpha(from.alpha());
+  }
+  if (from.beta() != 0) {
+    set_beta(from.beta());
+  }
 }
 
-void SoftmaxParam::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:deepflow.SoftmaxParam)
+void ResizeParam::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:deepflow.ResizeParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void SoftmaxParam::CopyFrom(const SoftmaxParam& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.SoftmaxParam)
+void ResizeParam::CopyFrom(const ResizeParam& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.ResizeParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool SoftmaxParam::IsInitialized() const {
+bool ResizeParam::IsInitialized() const {
   return true;
 }
 
-void SoftmaxParam::Swap(SoftmaxParam* other) {
+void ResizeParam::Swap(ResizeParam* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void SoftmaxParam::InternalSwap(SoftmaxParam* other) {
-  std::swap(mode_, other->mode_);
-  std::swap(_cached_size_, other->_cached_size_);
+void ResizeParam::InternalSwap(ResizeParam* other) {
+  std::swap(height_scale_, other->height_scale_);
+  std::swap(width_scale_, other->width_scale_);
+  std::swap(mode_, other->mode_);
+  std::swap(add_, other->add_);
+  std::swap(alpha_, other->alpha_);
+  std::swap(beta_, other->beta_);
+  std::swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata SoftmaxParam::GetMetadata() const {
+::google::protobuf::Metadata ResizeParam::GetMetadata() const {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// SoftmaxParam
+// ResizeParam
 
-// .deepflow.SoftmaxParam.Mode mode = 1;
-void SoftmaxParam::clear_mode() {
+// float height_scale = 1;
+void ResizeParam::clear_height_scale() {
+  height_scale_ = 0;
+}
+float ResizeParam::height_scale() const {
+  // @@protoc_insertion_point(field_get:deepflow.ResizeParam.height_scale)
+  return height_scale_;
+}
+void ResizeParam::set_height_scale(float value) {
+  
+  height_scale_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.ResizeParam.height_scale)
+}
+
+// float width_scale = 2;
+void ResizeParam::clear_width_scale() {
+  width_scale_ = 0;
+}
+float ResizeParam::width_scale() const {
+  // @@protoc_insertion_point(field_get:deepflow.ResizeParam.width_scale)
+  return width_scale_;
+}
+void ResizeParam::set_width_scale(float value) {
+  
+  width_scale_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.ResizeParam.width_scale)
+}
+
+// .deepflow.ResizeParam.Mode mode = 3;
+void ResizeParam::clear_mode() {
   mode_ = 0;
 }
-::deepflow::SoftmaxParam_Mode SoftmaxParam::mode() const {
-  // @@protoc_insertion_point(field_get:deepflow.SoftmaxParam.mode)
-  return static_cast< ::deepflow::SoftmaxParam_Mode >(mode_);
+::deepflow::ResizeParam_Mode ResizeParam::mode() const {
+  // @@protoc_insertion_point(field_get:deepflow.ResizeParam.mode)
+  return static_cast< ::deepflow::ResizeParam_Mode >(mode_);
 }
-void SoftmaxParam::set_mode(::deepflow::SoftmaxParam_Mode value) {
+void ResizeParam::set_mode(::deepflow::ResizeParam_Mode value) {
   
   mode_ = value;
-  // @@protoc_insertion_point(field_set:deepflow.SoftmaxParam.mode)
+  // @@protoc_insertion_point(field_set:deepflow.ResizeParam.mode)
+}
+
+// bool add = 4;
+void ResizeParam::clear_add() {
+  add_ = false;
+}
+bool ResizeParam::add() const {
+  // @@protoc_insertion_point(field_get:deepflow.ResizeParam.add)
+  return add_;
+}
+void ResizeParam::set_add(bool value) {
+  
+  add_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.ResizeParam.add)
+}
+
+// float alpha = 5;
+void ResizeParam::clear_alpha() {
+  alpha_ = 0;
+}
+float ResizeParam::alpha() const {
+  // @@protoc_insertion_point(field_get:deepflow.ResizeParam.alpha)
+  return alpha_;
+}
+void ResizeParam::set_alpha(float value) {
+  
+  alpha_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.ResizeParam.alpha)
+}
+
+// float beta = 6;
+void ResizeParam::clear_beta() {
+  beta_ = 0;
+}
+float ResizeParam::beta() const {
+  // @@protoc_insertion_point(field_get:deepflow.ResizeParam.beta)
+  return beta_;
+}
+void ResizeParam::set_beta(float value) {
+  
+  beta_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.ResizeParam.beta)
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -16470,222 +18001,112 @@ void SoftmaxParam::set_mode(::deepflow::SoftmaxParam_Mode value) {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int PatchingParam::kModeFieldNumber;
-const int PatchingParam::kNumVerticalPatchFieldNumber;
-const int PatchingParam::kNumHorizontalPatchFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-PatchingParam::PatchingParam()
+SquareParam::SquareParam()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_deepflow_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:deepflow.PatchingParam)
+  // @@protoc_insertion_point(constructor:deepflow.SquareParam)
 }
-PatchingParam::PatchingParam(const PatchingParam& from)
+SquareParam::SquareParam(const SquareParam& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::memcpy(&mode_, &from.mode_,
-    reinterpret_cast<char*>(&num_horizontal_patch_) -
-    reinterpret_cast<char*>(&mode_) + sizeof(num_horizontal_patch_));
-  // @@protoc_insertion_point(copy_constructor:deepflow.PatchingParam)
+  // @@protoc_insertion_point(copy_constructor:deepflow.SquareParam)
 }
 
-void PatchingParam::SharedCtor() {
-  ::memset(&mode_, 0, reinterpret_cast<char*>(&num_horizontal_patch_) -
-    reinterpret_cast<char*>(&mode_) + sizeof(num_horizontal_patch_));
+void SquareParam::SharedCtor() {
   _cached_size_ = 0;
 }
 
-PatchingParam::~PatchingParam() {
-  // @@protoc_insertion_point(destructor:deepflow.PatchingParam)
+SquareParam::~SquareParam() {
+  // @@protoc_insertion_point(destructor:deepflow.SquareParam)
   SharedDtor();
 }
 
-void PatchingParam::SharedDtor() {
+void SquareParam::SharedDtor() {
 }
 
-void PatchingParam::SetCachedSize(int size) const {
+void SquareParam::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* PatchingParam::descriptor() {
+const ::google::protobuf::Descriptor* SquareParam::descriptor() {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const PatchingParam& PatchingParam::default_instance() {
+const SquareParam& SquareParam::default_instance() {
   protobuf_deepflow_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-PatchingParam* PatchingParam::New(::google::protobuf::Arena* arena) const {
-  PatchingParam* n = new PatchingParam;
+SquareParam* SquareParam::New(::google::protobuf::Arena* arena) const {
+  SquareParam* n = new SquareParam;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void PatchingParam::Clear() {
-// @@protoc_insertion_point(message_clear_start:deepflow.PatchingParam)
-  ::memset(&mode_, 0, reinterpret_cast<char*>(&num_horizontal_patch_) -
-    reinterpret_cast<char*>(&mode_) + sizeof(num_horizontal_patch_));
+void SquareParam::Clear() {
+// @@protoc_insertion_point(message_clear_start:deepflow.SquareParam)
 }
 
-bool PatchingParam::MergePartialFromCodedStream(
+bool SquareParam::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:deepflow.PatchingParam)
+  // @@protoc_insertion_point(parse_start:deepflow.SquareParam)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
     if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // .deepflow.PatchingParam.Mode mode = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u)) {
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          set_mode(static_cast< ::deepflow::PatchingParam_Mode >(value));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // int32 num_vertical_patch = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(16u)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &num_vertical_patch_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // int32 num_horizontal_patch = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(24u)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &num_horizontal_patch_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-        break;
-      }
+  handle_unusual:
+    if (tag == 0 ||
+        ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+        ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+      goto success;
     }
+    DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
   }
 success:
-  // @@protoc_insertion_point(parse_success:deepflow.PatchingParam)
+  // @@protoc_insertion_point(parse_success:deepflow.SquareParam)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:deepflow.PatchingParam)
+  // @@protoc_insertion_point(parse_failure:deepflow.SquareParam)
   return false;
 #undef DO_
 }
 
-void PatchingParam::SerializeWithCachedSizes(
+void SquareParam::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:deepflow.PatchingParam)
+  // @@protoc_insertion_point(serialize_start:deepflow.SquareParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .deepflow.PatchingParam.Mode mode = 1;
-  if (this->mode() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      1, this->mode(), output);
-  }
-
-  // int32 num_vertical_patch = 2;
-  if (this->num_vertical_patch() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(2, this->num_vertical_patch(), output);
-  }
-
-  // int32 num_horizontal_patch = 3;
-  if (this->num_horizontal_patch() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(3, this->num_horizontal_patch(), output);
-  }
-
-  // @@protoc_insertion_point(serialize_end:deepflow.PatchingParam)
+  // @@protoc_insertion_point(serialize_end:deepflow.SquareParam)
 }
 
-::google::protobuf::uint8* PatchingParam::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* SquareParam::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:deepflow.PatchingParam)
+  // @@protoc_insertion_point(serialize_to_array_start:deepflow.SquareParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .deepflow.PatchingParam.Mode mode = 1;
-  if (this->mode() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      1, this->mode(), target);
-  }
-
-  // int32 num_vertical_patch = 2;
-  if (this->num_vertical_patch() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(2, this->num_vertical_patch(), target);
-  }
-
-  // int32 num_horizontal_patch = 3;
-  if (this->num_horizontal_patch() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(3, this->num_horizontal_patch(), target);
-  }
-
-  // @@protoc_insertion_point(serialize_to_array_end:deepflow.PatchingParam)
+  // @@protoc_insertion_point(serialize_to_array_end:deepflow.SquareParam)
   return target;
 }
 
-size_t PatchingParam::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:deepflow.PatchingParam)
+size_t SquareParam::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:deepflow.SquareParam)
   size_t total_size = 0;
 
-  // .deepflow.PatchingParam.Mode mode = 1;
-  if (this->mode() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::EnumSize(this->mode());
-  }
-
-  // int32 num_vertical_patch = 2;
-  if (this->num_vertical_patch() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->num_vertical_patch());
-  }
-
-  // int32 num_horizontal_patch = 3;
-  if (this->num_horizontal_patch() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->num_horizontal_patch());
-  }
-
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = cached_size;
@@ -16693,271 +18114,175 @@ size_t PatchingParam::ByteSizeLong() const {
   return total_size;
 }
 
-void PatchingParam::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:deepflow.PatchingParam)
+void SquareParam::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:deepflow.SquareParam)
   GOOGLE_DCHECK_NE(&from, this);
-  const PatchingParam* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const PatchingParam>(
+  const SquareParam* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const SquareParam>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.PatchingParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.SquareParam)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.PatchingParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.SquareParam)
     MergeFrom(*source);
   }
 }
 
-void PatchingParam::MergeFrom(const PatchingParam& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.PatchingParam)
+void SquareParam::MergeFrom(const SquareParam& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.SquareParam)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.mode() != 0) {
-    set_mode(from.mode());
-  }
-  if (from.num_vertical_patch() != 0) {
-    set_num_vertical_patch(from.num_vertical_patch());
-  }
-  if (from.num_horizontal_patch() != 0) {
-    set_num_horizontal_patch(from.num_horizontal_patch());
-  }
 }
 
-void PatchingParam::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:deepflow.PatchingParam)
+void SquareParam::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:deepflow.SquareParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void PatchingParam::CopyFrom(const PatchingParam& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.PatchingParam)
+void SquareParam::CopyFrom(const SquareParam& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.SquareParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool PatchingParam::IsInitialized() const {
+bool SquareParam::IsInitialized() const {
   return true;
 }
 
-void PatchingParam::Swap(PatchingParam* other) {
+void SquareParam::Swap(SquareParam* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void PatchingParam::InternalSwap(PatchingParam* other) {
-  std::swap(mode_, other->mode_);
-  std::swap(num_vertical_patch_, other->num_vertical_patch_);
-  std::swap(num_horizontal_patch_, other->num_horizontal_patch_);
+void SquareParam::InternalSwap(SquareParam* other) {
   std::swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata PatchingParam::GetMetadata() const {
+::google::protobuf::Metadata SquareParam::GetMetadata() const {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// PatchingParam
-
-// .deepflow.PatchingParam.Mode mode = 1;
-void PatchingParam::clear_mode() {
-  mode_ = 0;
-}
-::deepflow::PatchingParam_Mode PatchingParam::mode() const {
-  // @@protoc_insertion_point(field_get:deepflow.PatchingParam.mode)
-  return static_cast< ::deepflow::PatchingParam_Mode >(mode_);
-}
-void PatchingParam::set_mode(::deepflow::PatchingParam_Mode value) {
-  
-  mode_ = value;
-  // @@protoc_insertion_point(field_set:deepflow.PatchingParam.mode)
-}
-
-// int32 num_vertical_patch = 2;
-void PatchingParam::clear_num_vertical_patch() {
-  num_vertical_patch_ = 0;
-}
-::google::protobuf::int32 PatchingParam::num_vertical_patch() const {
-  // @@protoc_insertion_point(field_get:deepflow.PatchingParam.num_vertical_patch)
-  return num_vertical_patch_;
-}
-void PatchingParam::set_num_vertical_patch(::google::protobuf::int32 value) {
-  
-  num_vertical_patch_ = value;
-  // @@protoc_insertion_point(field_set:deepflow.PatchingParam.num_vertical_patch)
-}
-
-// int32 num_horizontal_patch = 3;
-void PatchingParam::clear_num_horizontal_patch() {
-  num_horizontal_patch_ = 0;
-}
-::google::protobuf::int32 PatchingParam::num_horizontal_patch() const {
-  // @@protoc_insertion_point(field_get:deepflow.PatchingParam.num_horizontal_patch)
-  return num_horizontal_patch_;
-}
-void PatchingParam::set_num_horizontal_patch(::google::protobuf::int32 value) {
-  
-  num_horizontal_patch_ = value;
-  // @@protoc_insertion_point(field_set:deepflow.PatchingParam.num_horizontal_patch)
-}
+// SquareParam
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int LiftingParam::kModeFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-LiftingParam::LiftingParam()
+AbsParam::AbsParam()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_deepflow_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:deepflow.LiftingParam)
+  // @@protoc_insertion_point(constructor:deepflow.AbsParam)
 }
-LiftingParam::LiftingParam(const LiftingParam& from)
+AbsParam::AbsParam(const AbsParam& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
-  mode_ = from.mode_;
-  // @@protoc_insertion_point(copy_constructor:deepflow.LiftingParam)
+  // @@protoc_insertion_point(copy_constructor:deepflow.AbsParam)
 }
 
-void LiftingParam::SharedCtor() {
-  mode_ = 0;
+void AbsParam::SharedCtor() {
   _cached_size_ = 0;
 }
 
-LiftingParam::~LiftingParam() {
-  // @@protoc_insertion_point(destructor:deepflow.LiftingParam)
+AbsParam::~AbsParam() {
+  // @@protoc_insertion_point(destructor:deepflow.AbsParam)
   SharedDtor();
 }
 
-void LiftingParam::SharedDtor() {
+void AbsParam::SharedDtor() {
 }
 
-void LiftingParam::SetCachedSize(int size) const {
+void AbsParam::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* LiftingParam::descriptor() {
+const ::google::protobuf::Descriptor* AbsParam::descriptor() {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const LiftingParam& LiftingParam::default_instance() {
+const AbsParam& AbsParam::default_instance() {
   protobuf_deepflow_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-LiftingParam* LiftingParam::New(::google::protobuf::Arena* arena) const {
-  LiftingParam* n = new LiftingParam;
+AbsParam* AbsParam::New(::google::protobuf::Arena* arena) const {
+  AbsParam* n = new AbsParam;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void LiftingParam::Clear() {
-// @@protoc_insertion_point(message_clear_start:deepflow.LiftingParam)
-  mode_ = 0;
+void AbsParam::Clear() {
+// @@protoc_insertion_point(message_clear_start:deepflow.AbsParam)
 }
 
-bool LiftingParam::MergePartialFromCodedStream(
+bool AbsParam::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:deepflow.LiftingParam)
+  // @@protoc_insertion_point(parse_start:deepflow.AbsParam)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
     if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // .deepflow.LiftingParam.Mode mode = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u)) {
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          set_mode(static_cast< ::deepflow::LiftingParam_Mode >(value));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-        break;
-      }
+  handle_unusual:
+    if (tag == 0 ||
+        ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+        ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+      goto success;
     }
+    DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
   }
 success:
-  // @@protoc_insertion_point(parse_success:deepflow.LiftingParam)
+  // @@protoc_insertion_point(parse_success:deepflow.AbsParam)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:deepflow.LiftingParam)
+  // @@protoc_insertion_point(parse_failure:deepflow.AbsParam)
   return false;
 #undef DO_
 }
 
-void LiftingParam::SerializeWithCachedSizes(
+void AbsParam::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:deepflow.LiftingParam)
+  // @@protoc_insertion_point(serialize_start:deepflow.AbsParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .deepflow.LiftingParam.Mode mode = 1;
-  if (this->mode() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      1, this->mode(), output);
-  }
-
-  // @@protoc_insertion_point(serialize_end:deepflow.LiftingParam)
+  // @@protoc_insertion_point(serialize_end:deepflow.AbsParam)
 }
 
-::google::protobuf::uint8* LiftingParam::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* AbsParam::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:deepflow.LiftingParam)
+  // @@protoc_insertion_point(serialize_to_array_start:deepflow.AbsParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .deepflow.LiftingParam.Mode mode = 1;
-  if (this->mode() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      1, this->mode(), target);
-  }
-
-  // @@protoc_insertion_point(serialize_to_array_end:deepflow.LiftingParam)
+  // @@protoc_insertion_point(serialize_to_array_end:deepflow.AbsParam)
   return target;
 }
 
-size_t LiftingParam::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:deepflow.LiftingParam)
+size_t AbsParam::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:deepflow.AbsParam)
   size_t total_size = 0;
 
-  // .deepflow.LiftingParam.Mode mode = 1;
-  if (this->mode() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::EnumSize(this->mode());
-  }
-
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = cached_size;
@@ -16965,231 +18290,175 @@ size_t LiftingParam::ByteSizeLong() const {
   return total_size;
 }
 
-void LiftingParam::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:deepflow.LiftingParam)
+void AbsParam::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:deepflow.AbsParam)
   GOOGLE_DCHECK_NE(&from, this);
-  const LiftingParam* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const LiftingParam>(
+  const AbsParam* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const AbsParam>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.LiftingParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.AbsParam)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.LiftingParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.AbsParam)
     MergeFrom(*source);
   }
 }
 
-void LiftingParam::MergeFrom(const LiftingParam& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.LiftingParam)
+void AbsParam::MergeFrom(const AbsParam& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.AbsParam)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.mode() != 0) {
-    set_mode(from.mode());
-  }
 }
 
-void LiftingParam::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:deepflow.LiftingParam)
+void AbsParam::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:deepflow.AbsParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void LiftingParam::CopyFrom(const LiftingParam& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.LiftingParam)
+void AbsParam::CopyFrom(const AbsParam& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.AbsParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool LiftingParam::IsInitialized() const {
+bool AbsParam::IsInitialized() const {
   return true;
 }
 
-void LiftingParam::Swap(LiftingParam* other) {
+void AbsParam::Swap(AbsParam* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void LiftingParam::InternalSwap(LiftingParam* other) {
-  std::swap(mode_, other->mode_);
+void AbsParam::InternalSwap(AbsParam* other) {
   std::swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata LiftingParam::GetMetadata() const {
+::google::protobuf::Metadata AbsParam::GetMetadata() const {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// LiftingParam
-
-// .deepflow.LiftingParam.Mode mode = 1;
-void LiftingParam::clear_mode() {
-  mode_ = 0;
-}
-::deepflow::LiftingParam_Mode LiftingParam::mode() const {
-  // @@protoc_insertion_point(field_get:deepflow.LiftingParam.mode)
-  return static_cast< ::deepflow::LiftingParam_Mode >(mode_);
-}
-void LiftingParam::set_mode(::deepflow::LiftingParam_Mode value) {
-  
-  mode_ = value;
-  // @@protoc_insertion_point(field_set:deepflow.LiftingParam.mode)
-}
+// AbsParam
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int InitFillParam::kValueFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-InitFillParam::InitFillParam()
+SquareErrorParam::SquareErrorParam()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_deepflow_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:deepflow.InitFillParam)
+  // @@protoc_insertion_point(constructor:deepflow.SquareErrorParam)
 }
-InitFillParam::InitFillParam(const InitFillParam& from)
+SquareErrorParam::SquareErrorParam(const SquareErrorParam& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
-  value_ = from.value_;
-  // @@protoc_insertion_point(copy_constructor:deepflow.InitFillParam)
+  // @@protoc_insertion_point(copy_constructor:deepflow.SquareErrorParam)
 }
 
-void InitFillParam::SharedCtor() {
-  value_ = 0;
+void SquareErrorParam::SharedCtor() {
   _cached_size_ = 0;
 }
 
-InitFillParam::~InitFillParam() {
-  // @@protoc_insertion_point(destructor:deepflow.InitFillParam)
+SquareErrorParam::~SquareErrorParam() {
+  // @@protoc_insertion_point(destructor:deepflow.SquareErrorParam)
   SharedDtor();
 }
 
-void InitFillParam::SharedDtor() {
+void SquareErrorParam::SharedDtor() {
 }
 
-void InitFillParam::SetCachedSize(int size) const {
+void SquareErrorParam::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* InitFillParam::descriptor() {
+const ::google::protobuf::Descriptor* SquareErrorParam::descriptor() {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const InitFillParam& InitFillParam::default_instance() {
+const SquareErrorParam& SquareErrorParam::default_instance() {
   protobuf_deepflow_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-InitFillParam* InitFillParam::New(::google::protobuf::Arena* arena) const {
-  InitFillParam* n = new InitFillParam;
+SquareErrorParam* SquareErrorParam::New(::google::protobuf::Arena* arena) const {
+  SquareErrorParam* n = new SquareErrorParam;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void InitFillParam::Clear() {
-// @@protoc_insertion_point(message_clear_start:deepflow.InitFillParam)
-  value_ = 0;
+void SquareErrorParam::Clear() {
+// @@protoc_insertion_point(message_clear_start:deepflow.SquareErrorParam)
 }
 
-bool InitFillParam::MergePartialFromCodedStream(
+bool SquareErrorParam::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:deepflow.InitFillParam)
+  // @@protoc_insertion_point(parse_start:deepflow.SquareErrorParam)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
     if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // float value = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(13u)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &value_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-        break;
-      }
+  handle_unusual:
+    if (tag == 0 ||
+        ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+        ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+      goto success;
     }
+    DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
   }
 success:
-  // @@protoc_insertion_point(parse_success:deepflow.InitFillParam)
+  // @@protoc_insertion_point(parse_success:deepflow.SquareErrorParam)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:deepflow.InitFillParam)
+  // @@protoc_insertion_point(parse_failure:deepflow.SquareErrorParam)
   return false;
 #undef DO_
 }
 
-void InitFillParam::SerializeWithCachedSizes(
+void SquareErrorParam::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:deepflow.InitFillParam)
+  // @@protoc_insertion_point(serialize_start:deepflow.SquareErrorParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // float value = 1;
-  if (this->value() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(1, this->value(), output);
-  }
-
-  // @@protoc_insertion_point(serialize_end:deepflow.InitFillParam)
+  // @@protoc_insertion_point(serialize_end:deepflow.SquareErrorParam)
 }
 
-::google::protobuf::uint8* InitFillParam::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* SquareErrorParam::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:deepflow.InitFillParam)
+  // @@protoc_insertion_point(serialize_to_array_start:deepflow.SquareErrorParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // float value = 1;
-  if (this->value() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(1, this->value(), target);
-  }
-
-  // @@protoc_insertion_point(serialize_to_array_end:deepflow.InitFillParam)
+  // @@protoc_insertion_point(serialize_to_array_end:deepflow.SquareErrorParam)
   return target;
 }
 
-size_t InitFillParam::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:deepflow.InitFillParam)
+size_t SquareErrorParam::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:deepflow.SquareErrorParam)
   size_t total_size = 0;
 
-  // float value = 1;
-  if (this->value() != 0) {
-    total_size += 1 + 4;
-  }
-
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = cached_size;
@@ -17197,166 +18466,149 @@ size_t InitFillParam::ByteSizeLong() const {
   return total_size;
 }
 
-void InitFillParam::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:deepflow.InitFillParam)
+void SquareErrorParam::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:deepflow.SquareErrorParam)
   GOOGLE_DCHECK_NE(&from, this);
-  const InitFillParam* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const InitFillParam>(
+  const SquareErrorParam* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const SquareErrorParam>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.InitFillParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.SquareErrorParam)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.InitFillParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.SquareErrorParam)
     MergeFrom(*source);
   }
 }
 
-void InitFillParam::MergeFrom(const InitFillParam& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.InitFillParam)
+void SquareErrorParam::MergeFrom(const SquareErrorParam& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.SquareErrorParam)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.value() != 0) {
-    set_value(from.value());
-  }
 }
 
-void InitFillParam::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:deepflow.InitFillParam)
+void SquareErrorParam::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:deepflow.SquareErrorParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void InitFillParam::CopyFrom(const InitFillParam& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.InitFillParam)
+void SquareErrorParam::CopyFrom(const SquareErrorParam& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.SquareErrorParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool InitFillParam::IsInitialized() const {
+bool SquareErrorParam::IsInitialized() const {
   return true;
 }
 
-void InitFillParam::Swap(InitFillParam* other) {
+void SquareErrorParam::Swap(SquareErrorParam* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void InitFillParam::InternalSwap(InitFillParam* other) {
-  std::swap(value_, other->value_);
+void SquareErrorParam::InternalSwap(SquareErrorParam* other) {
   std::swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata InitFillParam::GetMetadata() const {
+::google::protobuf::Metadata SquareErrorParam::GetMetadata() const {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// InitFillParam
-
-// float value = 1;
-void InitFillParam::clear_value() {
-  value_ = 0;
-}
-float InitFillParam::value() const {
-  // @@protoc_insertion_point(field_get:deepflow.InitFillParam.value)
-  return value_;
-}
-void InitFillParam::set_value(float value) {
-  
-  value_ = value;
-  // @@protoc_insertion_point(field_set:deepflow.InitFillParam.value)
-}
+// SquareErrorParam
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int InitIndexFillParam::kOffsetFieldNumber;
+const int SoftmaxParam::kModeFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-InitIndexFillParam::InitIndexFillParam()
+SoftmaxParam::SoftmaxParam()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_deepflow_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:deepflow.InitIndexFillParam)
+  // @@protoc_insertion_point(constructor:deepflow.SoftmaxParam)
 }
-InitIndexFillParam::InitIndexFillParam(const InitIndexFillParam& from)
+SoftmaxParam::SoftmaxParam(const SoftmaxParam& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
-  offset_ = from.offset_;
-  // @@protoc_insertion_point(copy_constructor:deepflow.InitIndexFillParam)
+  mode_ = from.mode_;
+  // @@protoc_insertion_point(copy_constructor:deepflow.SoftmaxParam)
 }
 
-void InitIndexFillParam::SharedCtor() {
-  offset_ = 0;
+void SoftmaxParam::SharedCtor() {
+  mode_ = 0;
   _cached_size_ = 0;
 }
 
-InitIndexFillParam::~InitIndexFillParam() {
-  // @@protoc_insertion_point(destructor:deepflow.InitIndexFillParam)
+SoftmaxParam::~SoftmaxParam() {
+  // @@protoc_insertion_point(destructor:deepflow.SoftmaxParam)
   SharedDtor();
 }
 
-void InitIndexFillParam::SharedDtor() {
+void SoftmaxParam::SharedDtor() {
 }
 
-void InitIndexFillParam::SetCachedSize(int size) const {
+void SoftmaxParam::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* InitIndexFillParam::descriptor() {
+const ::google::protobuf::Descriptor* SoftmaxParam::descriptor() {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const InitIndexFillParam& InitIndexFillParam::default_instance() {
+const SoftmaxParam& SoftmaxParam::default_instance() {
   protobuf_deepflow_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-InitIndexFillParam* InitIndexFillParam::New(::google::protobuf::Arena* arena) const {
-  InitIndexFillParam* n = new InitIndexFillParam;
+SoftmaxParam* SoftmaxParam::New(::google::protobuf::Arena* arena) const {
+  SoftmaxParam* n = new SoftmaxParam;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void InitIndexFillParam::Clear() {
-// @@protoc_insertion_point(message_clear_start:deepflow.InitIndexFillParam)
-  offset_ = 0;
+void SoftmaxParam::Clear() {
+// @@protoc_insertion_point(message_clear_start:deepflow.SoftmaxParam)
+  mode_ = 0;
 }
 
-bool InitIndexFillParam::MergePartialFromCodedStream(
+bool SoftmaxParam::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:deepflow.InitIndexFillParam)
+  // @@protoc_insertion_point(parse_start:deepflow.SoftmaxParam)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // float offset = 1;
+      // .deepflow.SoftmaxParam.Mode mode = 1;
       case 1: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(13u)) {
-
+            static_cast< ::google::protobuf::uint8>(8u)) {
+          int value;
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &offset_)));
+                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          set_mode(static_cast< ::deepflow::SoftmaxParam_Mode >(value));
         } else {
           goto handle_unusual;
         }
@@ -17376,50 +18628,53 @@ bool InitIndexFillParam::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:deepflow.InitIndexFillParam)
+  // @@protoc_insertion_point(parse_success:deepflow.SoftmaxParam)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:deepflow.InitIndexFillParam)
+  // @@protoc_insertion_point(parse_failure:deepflow.SoftmaxParam)
   return false;
 #undef DO_
 }
 
-void InitIndexFillParam::SerializeWithCachedSizes(
+void SoftmaxParam::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:deepflow.InitIndexFillParam)
+  // @@protoc_insertion_point(serialize_start:deepflow.SoftmaxParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // float offset = 1;
-  if (this->offset() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(1, this->offset(), output);
+  // .deepflow.SoftmaxParam.Mode mode = 1;
+  if (this->mode() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      1, this->mode(), output);
   }
 
-  // @@protoc_insertion_point(serialize_end:deepflow.InitIndexFillParam)
+  // @@protoc_insertion_point(serialize_end:deepflow.SoftmaxParam)
 }
 
-::google::protobuf::uint8* InitIndexFillParam::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* SoftmaxParam::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:deepflow.InitIndexFillParam)
+  // @@protoc_insertion_point(serialize_to_array_start:deepflow.SoftmaxParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // float offset = 1;
-  if (this->offset() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(1, this->offset(), target);
+  // .deepflow.SoftmaxParam.Mode mode = 1;
+  if (this->mode() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
+      1, this->mode(), target);
   }
 
-  // @@protoc_insertion_point(serialize_to_array_end:deepflow.InitIndexFillParam)
+  // @@protoc_insertion_point(serialize_to_array_end:deepflow.SoftmaxParam)
   return target;
 }
 
-size_t InitIndexFillParam::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:deepflow.InitIndexFillParam)
+size_t SoftmaxParam::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:deepflow.SoftmaxParam)
   size_t total_size = 0;
 
-  // float offset = 1;
-  if (this->offset() != 0) {
-    total_size += 1 + 4;
+  // .deepflow.SoftmaxParam.Mode mode = 1;
+  if (this->mode() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::EnumSize(this->mode());
   }
 
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
@@ -17429,80 +18684,80 @@ size_t InitIndexFillParam::ByteSizeLong() const {
   return total_size;
 }
 
-void InitIndexFillParam::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:deepflow.InitIndexFillParam)
+void SoftmaxParam::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:deepflow.SoftmaxParam)
   GOOGLE_DCHECK_NE(&from, this);
-  const InitIndexFillParam* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const InitIndexFillParam>(
+  const SoftmaxParam* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const SoftmaxParam>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.InitIndexFillParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.SoftmaxParam)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.InitIndexFillParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.SoftmaxParam)
     MergeFrom(*source);
   }
 }
 
-void InitIndexFillParam::MergeFrom(const InitIndexFillParam& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.InitIndexFillParam)
+void SoftmaxParam::MergeFrom(const SoftmaxParam& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.SoftmaxParam)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.offset() != 0) {
-    set_offset(from.offset());
+  if (from.mode() != 0) {
+    set_mode(from.mode());
   }
 }
 
-void InitIndexFillParam::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:deepflow.InitIndexFillParam)
+void SoftmaxParam::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:deepflow.SoftmaxParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void InitIndexFillParam::CopyFrom(const InitIndexFillParam& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.InitIndexFillParam)
+void SoftmaxParam::CopyFrom(const SoftmaxParam& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.SoftmaxParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool InitIndexFillParam::IsInitialized() const {
+bool SoftmaxParam::IsInitialized() const {
   return true;
 }
 
-void InitIndexFillParam::Swap(InitIndexFillParam* other) {
+void SoftmaxParam::Swap(SoftmaxParam* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void InitIndexFillParam::InternalSwap(InitIndexFillParam* other) {
-  std::swap(offset_, other->offset_);
+void SoftmaxParam::InternalSwap(SoftmaxParam* other) {
+  std::swap(mode_, other->mode_);
   std::swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata InitIndexFillParam::GetMetadata() const {
+::google::protobuf::Metadata SoftmaxParam::GetMetadata() const {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// InitIndexFillParam
+// SoftmaxParam
 
-// float offset = 1;
-void InitIndexFillParam::clear_offset() {
-  offset_ = 0;
+// .deepflow.SoftmaxParam.Mode mode = 1;
+void SoftmaxParam::clear_mode() {
+  mode_ = 0;
 }
-float InitIndexFillParam::offset() const {
-  // @@protoc_insertion_point(field_get:deepflow.InitIndexFillParam.offset)
-  return offset_;
+::deepflow::SoftmaxParam_Mode SoftmaxParam::mode() const {
+  // @@protoc_insertion_point(field_get:deepflow.SoftmaxParam.mode)
+  return static_cast< ::deepflow::SoftmaxParam_Mode >(mode_);
 }
-void InitIndexFillParam::set_offset(float value) {
+void SoftmaxParam::set_mode(::deepflow::SoftmaxParam_Mode value) {
   
-  offset_ = value;
-  // @@protoc_insertion_point(field_set:deepflow.InitIndexFillParam.offset)
+  mode_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.SoftmaxParam.mode)
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -17510,112 +18765,188 @@ void InitIndexFillParam::set_offset(float value) {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int SoftmaxCrossEntropyParam::kModeFieldNumber;
+const int SoftmaxCrossEntropyParam::kAlphaFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-InitGradientFillParam::InitGradientFillParam()
+SoftmaxCrossEntropyParam::SoftmaxCrossEntropyParam()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_deepflow_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:deepflow.InitGradientFillParam)
+  // @@protoc_insertion_point(constructor:deepflow.SoftmaxCrossEntropyParam)
 }
-InitGradientFillParam::InitGradientFillParam(const InitGradientFillParam& from)
+SoftmaxCrossEntropyParam::SoftmaxCrossEntropyParam(const SoftmaxCrossEntropyParam& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:deepflow.InitGradientFillParam)
+  ::memcpy(&mode_, &from.mode_,
+    reinterpret_cast<char*>(&alpha_) -
+    reinterpret_cast<char*>(&mode_) + sizeof(alpha_));
+  // @@protoc_insertion_point(copy_constructor:deepflow.SoftmaxCrossEntropyParam)
 }
 
-void InitGradientFillParam::SharedCtor() {
+void SoftmaxCrossEntropyParam::SharedCtor() {
+  ::memset(&mode_, 0, reinterpret_cast<char*>(&alpha_) -
+    reinterpret_cast<char*>(&mode_) + sizeof(alpha_));
   _cached_size_ = 0;
 }
 
-InitGradientFillParam::~InitGradientFillParam() {
-  // @@protoc_insertion_point(destructor:deepflow.InitGradientFillParam)
+SoftmaxCrossEntropyParam::~SoftmaxCrossEntropyParam() {
+  // @@protoc_insertion_point(destructor:deepflow.SoftmaxCrossEntropyParam)
   SharedDtor();
 }
 
-void InitGradientFillParam::SharedDtor() {
+void SoftmaxCrossEntropyParam::SharedDtor() {
 }
 
-void InitGradientFillParam::SetCachedSize(int size) const {
+void SoftmaxCrossEntropyParam::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* InitGradientFillParam::descriptor() {
+const ::google::protobuf::Descriptor* SoftmaxCrossEntropyParam::descriptor() {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const InitGradientFillParam& InitGradientFillParam::default_instance() {
+const SoftmaxCrossEntropyParam& SoftmaxCrossEntropyParam::default_instance() {
   protobuf_deepflow_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-InitGradientFillParam* InitGradientFillParam::New(::google::protobuf::Arena* arena) const {
-  InitGradientFillParam* n = new InitGradientFillParam;
+SoftmaxCrossEntropyParam* SoftmaxCrossEntropyParam::New(::google::protobuf::Arena* arena) const {
+  SoftmaxCrossEntropyParam* n = new SoftmaxCrossEntropyParam;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void InitGradientFillParam::Clear() {
-// @@protoc_insertion_point(message_clear_start:deepflow.InitGradientFillParam)
+void SoftmaxCrossEntropyParam::Clear() {
+// @@protoc_insertion_point(message_clear_start:deepflow.SoftmaxCrossEntropyParam)
+  ::memset(&mode_, 0, reinterpret_cast<char*>(&alpha_) -
+    reinterpret_cast<char*>(&mode_) + sizeof(alpha_));
 }
 
-bool InitGradientFillParam::MergePartialFromCodedStream(
+bool SoftmaxCrossEntropyParam::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:deepflow.InitGradientFillParam)
+  // @@protoc_insertion_point(parse_start:deepflow.SoftmaxCrossEntropyParam)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
     if (!p.second) goto handle_unusual;
-  handle_unusual:
-    if (tag == 0 ||
-        ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-        ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-      goto success;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // .deepflow.SoftmaxParam.Mode mode = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(8u)) {
+          int value;
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          set_mode(static_cast< ::deepflow::SoftmaxParam_Mode >(value));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // float alpha = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(21u)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, &alpha_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0 ||
+            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
+        break;
+      }
     }
-    DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
   }
 success:
-  // @@protoc_insertion_point(parse_success:deepflow.InitGradientFillParam)
+  // @@protoc_insertion_point(parse_success:deepflow.SoftmaxCrossEntropyParam)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:deepflow.InitGradientFillParam)
+  // @@protoc_insertion_point(parse_failure:deepflow.SoftmaxCrossEntropyParam)
   return false;
 #undef DO_
 }
 
-void InitGradientFillParam::SerializeWithCachedSizes(
+void SoftmaxCrossEntropyParam::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:deepflow.InitGradientFillParam)
+  // @@protoc_insertion_point(serialize_start:deepflow.SoftmaxCrossEntropyParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // @@protoc_insertion_point(serialize_end:deepflow.InitGradientFillParam)
+  // .deepflow.SoftmaxParam.Mode mode = 1;
+  if (this->mode() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      1, this->mode(), output);
+  }
+
+  // float alpha = 2;
+  if (this->alpha() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(2, this->alpha(), output);
+  }
+
+  // @@protoc_insertion_point(serialize_end:deepflow.SoftmaxCrossEntropyParam)
 }
 
-::google::protobuf::uint8* InitGradientFillParam::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* SoftmaxCrossEntropyParam::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:deepflow.InitGradientFillParam)
+  // @@protoc_insertion_point(serialize_to_array_start:deepflow.SoftmaxCrossEntropyParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // @@protoc_insertion_point(serialize_to_array_end:deepflow.InitGradientFillParam)
+  // .deepflow.SoftmaxParam.Mode mode = 1;
+  if (this->mode() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
+      1, this->mode(), target);
+  }
+
+  // float alpha = 2;
+  if (this->alpha() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(2, this->alpha(), target);
+  }
+
+  // @@protoc_insertion_point(serialize_to_array_end:deepflow.SoftmaxCrossEntropyParam)
   return target;
 }
 
-size_t InitGradientFillParam::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:deepflow.InitGradientFillParam)
+size_t SoftmaxCrossEntropyParam::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:deepflow.SoftmaxCrossEntropyParam)
   size_t total_size = 0;
 
+  // .deepflow.SoftmaxParam.Mode mode = 1;
+  if (this->mode() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::EnumSize(this->mode());
+  }
+
+  // float alpha = 2;
+  if (this->alpha() != 0) {
+    total_size += 1 + 4;
+  }
+
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = cached_size;
@@ -17623,176 +18954,228 @@ size_t InitGradientFillParam::ByteSizeLong() const {
   return total_size;
 }
 
-void InitGradientFillParam::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:deepflow.InitGradientFillParam)
+void SoftmaxCrossEntropyParam::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:deepflow.SoftmaxCrossEntropyParam)
   GOOGLE_DCHECK_NE(&from, this);
-  const InitGradientFillParam* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const InitGradientFillParam>(
+  const SoftmaxCrossEntropyParam* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const SoftmaxCrossEntropyParam>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.InitGradientFillParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.SoftmaxCrossEntropyParam)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.InitGradientFillParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.SoftmaxCrossEntropyParam)
     MergeFrom(*source);
   }
 }
 
-void InitGradientFillParam::MergeFrom(const InitGradientFillParam& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.InitGradientFillParam)
+void SoftmaxCrossEntropyParam::MergeFrom(const SoftmaxCrossEntropyParam& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.SoftmaxCrossEntropyParam)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
+  if (from.mode() != 0) {
+    set_mode(from.mode());
+  }
+  if (from.alpha() != 0) {
+    set_alpha(from.alpha());
+  }
 }
 
-void InitGradientFillParam::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:deepflow.InitGradientFillParam)
+void SoftmaxCrossEntropyParam::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:deepflow.SoftmaxCrossEntropyParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void InitGradientFillParam::CopyFrom(const InitGradientFillParam& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.InitGradientFillParam)
+void SoftmaxCrossEntropyParam::CopyFrom(const SoftmaxCrossEntropyParam& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.SoftmaxCrossEntropyParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool InitGradientFillParam::IsInitialized() const {
+bool SoftmaxCrossEntropyParam::IsInitialized() const {
   return true;
 }
 
-void InitGradientFillParam::Swap(InitGradientFillParam* other) {
+void SoftmaxCrossEntropyParam::Swap(SoftmaxCrossEntropyParam* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void InitGradientFillParam::InternalSwap(InitGradientFillParam* other) {
+void SoftmaxCrossEntropyParam::InternalSwap(SoftmaxCrossEntropyParam* other) {
+  std::swap(mode_, other->mode_);
+  std::swap(alpha_, other->alpha_);
   std::swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata InitGradientFillParam::GetMetadata() const {
+::google::protobuf::Metadata SoftmaxCrossEntropyParam::GetMetadata() const {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// InitGradientFillParam
+// SoftmaxCrossEntropyParam
+
+// .deepflow.SoftmaxParam.Mode mode = 1;
+void SoftmaxCrossEntropyParam::clear_mode() {
+  mode_ = 0;
+}
+::deepflow::SoftmaxParam_Mode SoftmaxCrossEntropyParam::mode() const {
+  // @@protoc_insertion_point(field_get:deepflow.SoftmaxCrossEntropyParam.mode)
+  return static_cast< ::deepflow::SoftmaxParam_Mode >(mode_);
+}
+void SoftmaxCrossEntropyParam::set_mode(::deepflow::SoftmaxParam_Mode value) {
+  
+  mode_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.SoftmaxCrossEntropyParam.mode)
+}
+
+// float alpha = 2;
+void SoftmaxCrossEntropyParam::clear_alpha() {
+  alpha_ = 0;
+}
+float SoftmaxCrossEntropyParam::alpha() const {
+  // @@protoc_insertion_point(field_get:deepflow.SoftmaxCrossEntropyParam.alpha)
+  return alpha_;
+}
+void SoftmaxCrossEntropyParam::set_alpha(float value) {
+  
+  alpha_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.SoftmaxCrossEntropyParam.alpha)
+}
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int InitRandomUniformParam::kMinFieldNumber;
-const int InitRandomUniformParam::kMaxFieldNumber;
+const int PatchingParam::kModeFieldNumber;
+const int PatchingParam::kNumVerticalPatchFieldNumber;
+const int PatchingParam::kNumHorizontalPatchFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-InitRandomUniformParam::InitRandomUniformParam()
+PatchingParam::PatchingParam()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_deepflow_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:deepflow.InitRandomUniformParam)
+  // @@protoc_insertion_point(constructor:deepflow.PatchingParam)
 }
-InitRandomUniformParam::InitRandomUniformParam(const InitRandomUniformParam& from)
+PatchingParam::PatchingParam(const PatchingParam& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::memcpy(&min_, &from.min_,
-    reinterpret_cast<char*>(&max_) -
-    reinterpret_cast<char*>(&min_) + sizeof(max_));
-  // @@protoc_insertion_point(copy_constructor:deepflow.InitRandomUniformParam)
+  ::memcpy(&mode_, &from.mode_,
+    reinterpret_cast<char*>(&num_horizontal_patch_) -
+    reinterpret_cast<char*>(&mode_) + sizeof(num_horizontal_patch_));
+  // @@protoc_insertion_point(copy_constructor:deepflow.PatchingParam)
 }
 
-void InitRandomUniformParam::SharedCtor() {
-  ::memset(&min_, 0, reinterpret_cast<char*>(&max_) -
-    reinterpret_cast<char*>(&min_) + sizeof(max_));
+void PatchingParam::SharedCtor() {
+  ::memset(&mode_, 0, reinterpret_cast<char*>(&num_horizontal_patch_) -
+    reinterpret_cast<char*>(&mode_) + sizeof(num_horizontal_patch_));
   _cached_size_ = 0;
 }
 
-InitRandomUniformParam::~InitRandomUniformParam() {
-  // @@protoc_insertion_point(destructor:deepflow.InitRandomUniformParam)
+PatchingParam::~PatchingParam() {
+  // @@protoc_insertion_point(destructor:deepflow.PatchingParam)
   SharedDtor();
 }
 
-void InitRandomUniformParam::SharedDtor() {
+void PatchingParam::SharedDtor() {
 }
 
-void InitRandomUniformParam::SetCachedSize(int size) const {
+void PatchingParam::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* InitRandomUniformParam::descriptor() {
+const ::google::protobuf::Descriptor* PatchingParam::descriptor() {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const InitRandomUniformParam& InitRandomUniformParam::default_instance() {
+const PatchingParam& PatchingParam::default_instance() {
   protobuf_deepflow_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-InitRandomUniformParam* InitRandomUniformParam::New(::google::protobuf::Arena* arena) const {
-  InitRandomUniformParam* n = new InitRandomUniformParam;
+PatchingParam* PatchingParam::New(::google::protobuf::Arena* arena) const {
+  PatchingParam* n = new PatchingParam;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void InitRandomUniformParam::Clear() {
-// @@protoc_insertion_point(message_clear_start:deepflow.InitRandomUniformParam)
-  ::memset(&min_, 0, reinterpret_cast<char*>(&max_) -
-    reinterpret_cast<char*>(&min_) + sizeof(max_));
+void PatchingParam::Clear() {
+// @@protoc_insertion_point(message_clear_start:deepflow.PatchingParam)
+  ::memset(&mode_, 0, reinterpret_cast<char*>(&num_horizontal_patch_) -
+    reinterpret_cast<char*>(&mode_) + sizeof(num_horizontal_patch_));
 }
 
-bool InitRandomUniformParam::MergePartialFromCodedStream(
+bool PatchingParam::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:deepflow.InitRandomUniformParam)
+  // @@protoc_insertion_point(parse_start:deepflow.PatchingParam)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // float min = 1;
+      // .deepflow.PatchingParam.Mode mode = 1;
       case 1: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(13u)) {
-
+            static_cast< ::google::protobuf::uint8>(8u)) {
+          int value;
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &min_)));
+                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          set_mode(static_cast< ::deepflow::PatchingParam_Mode >(value));
         } else {
           goto handle_unusual;
         }
         break;
       }
 
-      // float max = 2;
+      // int32 num_vertical_patch = 2;
       case 2: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(21u)) {
+            static_cast< ::google::protobuf::uint8>(16u)) {
 
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &max_)));
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &num_vertical_patch_)));
         } else {
           goto handle_unusual;
         }
         break;
       }
 
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
+      // int32 num_horizontal_patch = 3;
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(24u)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &num_horizontal_patch_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0 ||
             ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
             ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
           goto success;
@@ -17803,65 +19186,87 @@ bool InitRandomUniformParam::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:deepflow.InitRandomUniformParam)
+  // @@protoc_insertion_point(parse_success:deepflow.PatchingParam)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:deepflow.InitRandomUniformParam)
+  // @@protoc_insertion_point(parse_failure:deepflow.PatchingParam)
   return false;
 #undef DO_
 }
 
-void InitRandomUniformParam::SerializeWithCachedSizes(
+void PatchingParam::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:deepflow.InitRandomUniformParam)
+  // @@protoc_insertion_point(serialize_start:deepflow.PatchingParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // float min = 1;
-  if (this->min() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(1, this->min(), output);
+  // .deepflow.PatchingParam.Mode mode = 1;
+  if (this->mode() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      1, this->mode(), output);
   }
 
-  // float max = 2;
-  if (this->max() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(2, this->max(), output);
+  // int32 num_vertical_patch = 2;
+  if (this->num_vertical_patch() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(2, this->num_vertical_patch(), output);
   }
 
-  // @@protoc_insertion_point(serialize_end:deepflow.InitRandomUniformParam)
+  // int32 num_horizontal_patch = 3;
+  if (this->num_horizontal_patch() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(3, this->num_horizontal_patch(), output);
+  }
+
+  // @@protoc_insertion_point(serialize_end:deepflow.PatchingParam)
 }
 
-::google::protobuf::uint8* InitRandomUniformParam::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* PatchingParam::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:deepflow.InitRandomUniformParam)
+  // @@protoc_insertion_point(serialize_to_array_start:deepflow.PatchingParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // float min = 1;
-  if (this->min() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(1, this->min(), target);
+  // .deepflow.PatchingParam.Mode mode = 1;
+  if (this->mode() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
+      1, this->mode(), target);
   }
 
-  // float max = 2;
-  if (this->max() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(2, this->max(), target);
+  // int32 num_vertical_patch = 2;
+  if (this->num_vertical_patch() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(2, this->num_vertical_patch(), target);
   }
 
-  // @@protoc_insertion_point(serialize_to_array_end:deepflow.InitRandomUniformParam)
+  // int32 num_horizontal_patch = 3;
+  if (this->num_horizontal_patch() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(3, this->num_horizontal_patch(), target);
+  }
+
+  // @@protoc_insertion_point(serialize_to_array_end:deepflow.PatchingParam)
   return target;
 }
 
-size_t InitRandomUniformParam::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:deepflow.InitRandomUniformParam)
+size_t PatchingParam::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:deepflow.PatchingParam)
   size_t total_size = 0;
 
-  // float min = 1;
-  if (this->min() != 0) {
-    total_size += 1 + 4;
+  // .deepflow.PatchingParam.Mode mode = 1;
+  if (this->mode() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::EnumSize(this->mode());
   }
 
-  // float max = 2;
-  if (this->max() != 0) {
-    total_size += 1 + 4;
+  // int32 num_vertical_patch = 2;
+  if (this->num_vertical_patch() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::Int32Size(
+        this->num_vertical_patch());
+  }
+
+  // int32 num_horizontal_patch = 3;
+  if (this->num_horizontal_patch() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::Int32Size(
+        this->num_horizontal_patch());
   }
 
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
@@ -17871,98 +19276,116 @@ size_t InitRandomUniformParam::ByteSizeLong() const {
   return total_size;
 }
 
-void InitRandomUniformParam::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:deepflow.InitRandomUniformParam)
+void PatchingParam::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:deepflow.PatchingParam)
   GOOGLE_DCHECK_NE(&from, this);
-  const InitRandomUniformParam* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const InitRandomUniformParam>(
+  const PatchingParam* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const PatchingParam>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.InitRandomUniformParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.PatchingParam)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.InitRandomUniformParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.PatchingParam)
     MergeFrom(*source);
   }
 }
 
-void InitRandomUniformParam::MergeFrom(const InitRandomUniformParam& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.InitRandomUniformParam)
+void PatchingParam::MergeFrom(const PatchingParam& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.PatchingParam)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.min() != 0) {
-    set_min(from.min());
+  if (from.mode() != 0) {
+    set_mode(from.mode());
   }
-  if (from.max() != 0) {
-    set_max(from.max());
+  if (from.num_vertical_patch() != 0) {
+    set_num_vertical_patch(from.num_vertical_patch());
+  }
+  if (from.num_horizontal_patch() != 0) {
+    set_num_horizontal_patch(from.num_horizontal_patch());
   }
 }
 
-void InitRandomUniformParam::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:deepflow.InitRandomUniformParam)
+void PatchingParam::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:deepflow.PatchingParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void InitRandomUniformParam::CopyFrom(const InitRandomUniformParam& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.InitRandomUniformParam)
+void PatchingParam::CopyFrom(const PatchingParam& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.PatchingParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool InitRandomUniformParam::IsInitialized() const {
+bool PatchingParam::IsInitialized() const {
   return true;
 }
 
-void InitRandomUniformParam::Swap(InitRandomUniformParam* other) {
+void PatchingParam::Swap(PatchingParam* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void InitRandomUniformParam::InternalSwap(InitRandomUniformParam* other) {
-  std::swap(min_, other->min_);
-  std::swap(max_, other->max_);
+void PatchingParam::InternalSwap(PatchingParam* other) {
+  std::swap(mode_, other->mode_);
+  std::swap(num_vertical_patch_, other->num_vertical_patch_);
+  std::swap(num_horizontal_patch_, other->num_horizontal_patch_);
   std::swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata InitRandomUniformParam::GetMetadata() const {
+::google::protobuf::Metadata PatchingParam::GetMetadata() const {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// InitRandomUniformParam
+// PatchingParam
 
-// float min = 1;
-void InitRandomUniformParam::clear_min() {
-  min_ = 0;
+// .deepflow.PatchingParam.Mode mode = 1;
+void PatchingParam::clear_mode() {
+  mode_ = 0;
 }
-float InitRandomUniformParam::min() const {
-  // @@protoc_insertion_point(field_get:deepflow.InitRandomUniformParam.min)
-  return min_;
+::deepflow::PatchingParam_Mode PatchingParam::mode() const {
+  // @@protoc_insertion_point(field_get:deepflow.PatchingParam.mode)
+  return static_cast< ::deepflow::PatchingParam_Mode >(mode_);
 }
-void InitRandomUniformParam::set_min(float value) {
+void PatchingParam::set_mode(::deepflow::PatchingParam_Mode value) {
   
-  min_ = value;
-  // @@protoc_insertion_point(field_set:deepflow.InitRandomUniformParam.min)
+  mode_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.PatchingParam.mode)
 }
 
-// float max = 2;
-void InitRandomUniformParam::clear_max() {
-  max_ = 0;
+// int32 num_vertical_patch = 2;
+void PatchingParam::clear_num_vertical_patch() {
+  num_vertical_patch_ = 0;
 }
-float InitRandomUniformParam::max() const {
-  // @@protoc_insertion_point(field_get:deepflow.InitRandomUniformParam.max)
-  return max_;
+::google::protobuf::int32 PatchingParam::num_vertical_patch() const {
+  // @@protoc_insertion_point(field_get:deepflow.PatchingParam.num_vertical_patch)
+  return num_vertical_patch_;
 }
-void InitRandomUniformParam::set_max(float value) {
+void PatchingParam::set_num_vertical_patch(::google::protobuf::int32 value) {
   
-  max_ = value;
-  // @@protoc_insertion_point(field_set:deepflow.InitRandomUniformParam.max)
+  num_vertical_patch_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.PatchingParam.num_vertical_patch)
+}
+
+// int32 num_horizontal_patch = 3;
+void PatchingParam::clear_num_horizontal_patch() {
+  num_horizontal_patch_ = 0;
+}
+::google::protobuf::int32 PatchingParam::num_horizontal_patch() const {
+  // @@protoc_insertion_point(field_get:deepflow.PatchingParam.num_horizontal_patch)
+  return num_horizontal_patch_;
+}
+void PatchingParam::set_num_horizontal_patch(::google::protobuf::int32 value) {
+  
+  num_horizontal_patch_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.PatchingParam.num_horizontal_patch)
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -17970,104 +19393,86 @@ void InitRandomUniformParam::set_max(float value) {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int InitRandomNormalParam::kMeanFieldNumber;
-const int InitRandomNormalParam::kStddevFieldNumber;
+const int LiftingParam::kModeFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-InitRandomNormalParam::InitRandomNormalParam()
+LiftingParam::LiftingParam()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_deepflow_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:deepflow.InitRandomNormalParam)
+  // @@protoc_insertion_point(constructor:deepflow.LiftingParam)
 }
-InitRandomNormalParam::InitRandomNormalParam(const InitRandomNormalParam& from)
+LiftingParam::LiftingParam(const LiftingParam& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::memcpy(&mean_, &from.mean_,
-    reinterpret_cast<char*>(&stddev_) -
-    reinterpret_cast<char*>(&mean_) + sizeof(stddev_));
-  // @@protoc_insertion_point(copy_constructor:deepflow.InitRandomNormalParam)
+  mode_ = from.mode_;
+  // @@protoc_insertion_point(copy_constructor:deepflow.LiftingParam)
 }
 
-void InitRandomNormalParam::SharedCtor() {
-  ::memset(&mean_, 0, reinterpret_cast<char*>(&stddev_) -
-    reinterpret_cast<char*>(&mean_) + sizeof(stddev_));
+void LiftingParam::SharedCtor() {
+  mode_ = 0;
   _cached_size_ = 0;
 }
 
-InitRandomNormalParam::~InitRandomNormalParam() {
-  // @@protoc_insertion_point(destructor:deepflow.InitRandomNormalParam)
+LiftingParam::~LiftingParam() {
+  // @@protoc_insertion_point(destructor:deepflow.LiftingParam)
   SharedDtor();
 }
 
-void InitRandomNormalParam::SharedDtor() {
+void LiftingParam::SharedDtor() {
 }
 
-void InitRandomNormalParam::SetCachedSize(int size) const {
+void LiftingParam::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* InitRandomNormalParam::descriptor() {
+const ::google::protobuf::Descriptor* LiftingParam::descriptor() {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const InitRandomNormalParam& InitRandomNormalParam::default_instance() {
+const LiftingParam& LiftingParam::default_instance() {
   protobuf_deepflow_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-InitRandomNormalParam* InitRandomNormalParam::New(::google::protobuf::Arena* arena) const {
-  InitRandomNormalParam* n = new InitRandomNormalParam;
+LiftingParam* LiftingParam::New(::google::protobuf::Arena* arena) const {
+  LiftingParam* n = new LiftingParam;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void InitRandomNormalParam::Clear() {
-// @@protoc_insertion_point(message_clear_start:deepflow.InitRandomNormalParam)
-  ::memset(&mean_, 0, reinterpret_cast<char*>(&stddev_) -
-    reinterpret_cast<char*>(&mean_) + sizeof(stddev_));
+void LiftingParam::Clear() {
+// @@protoc_insertion_point(message_clear_start:deepflow.LiftingParam)
+  mode_ = 0;
 }
 
-bool InitRandomNormalParam::MergePartialFromCodedStream(
+bool LiftingParam::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:deepflow.InitRandomNormalParam)
+  // @@protoc_insertion_point(parse_start:deepflow.LiftingParam)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // float mean = 1;
+      // .deepflow.LiftingParam.Mode mode = 1;
       case 1: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(13u)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &mean_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // float stddev = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(21u)) {
-
+            static_cast< ::google::protobuf::uint8>(8u)) {
+          int value;
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &stddev_)));
+                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          set_mode(static_cast< ::deepflow::LiftingParam_Mode >(value));
         } else {
           goto handle_unusual;
         }
@@ -18087,65 +19492,53 @@ bool InitRandomNormalParam::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:deepflow.InitRandomNormalParam)
+  // @@protoc_insertion_point(parse_success:deepflow.LiftingParam)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:deepflow.InitRandomNormalParam)
+  // @@protoc_insertion_point(parse_failure:deepflow.LiftingParam)
   return false;
 #undef DO_
 }
 
-void InitRandomNormalParam::SerializeWithCachedSizes(
+void LiftingParam::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:deepflow.InitRandomNormalParam)
+  // @@protoc_insertion_point(serialize_start:deepflow.LiftingParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // float mean = 1;
-  if (this->mean() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(1, this->mean(), output);
-  }
-
-  // float stddev = 2;
-  if (this->stddev() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(2, this->stddev(), output);
+  // .deepflow.LiftingParam.Mode mode = 1;
+  if (this->mode() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      1, this->mode(), output);
   }
 
-  // @@protoc_insertion_point(serialize_end:deepflow.InitRandomNormalParam)
+  // @@protoc_insertion_point(serialize_end:deepflow.LiftingParam)
 }
 
-::google::protobuf::uint8* InitRandomNormalParam::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* LiftingParam::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:deepflow.InitRandomNormalParam)
+  // @@protoc_insertion_point(serialize_to_array_start:deepflow.LiftingParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // float mean = 1;
-  if (this->mean() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(1, this->mean(), target);
-  }
-
-  // float stddev = 2;
-  if (this->stddev() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(2, this->stddev(), target);
+  // .deepflow.LiftingParam.Mode mode = 1;
+  if (this->mode() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
+      1, this->mode(), target);
   }
 
-  // @@protoc_insertion_point(serialize_to_array_end:deepflow.InitRandomNormalParam)
+  // @@protoc_insertion_point(serialize_to_array_end:deepflow.LiftingParam)
   return target;
 }
 
-size_t InitRandomNormalParam::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:deepflow.InitRandomNormalParam)
+size_t LiftingParam::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:deepflow.LiftingParam)
   size_t total_size = 0;
 
-  // float mean = 1;
-  if (this->mean() != 0) {
-    total_size += 1 + 4;
-  }
-
-  // float stddev = 2;
-  if (this->stddev() != 0) {
-    total_size += 1 + 4;
+  // .deepflow.LiftingParam.Mode mode = 1;
+  if (this->mode() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::EnumSize(this->mode());
   }
 
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
@@ -18155,98 +19548,80 @@ size_t InitRandomNormalParam::ByteSizeLong() const {
   return total_size;
 }
 
-void InitRandomNormalParam::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:deepflow.InitRandomNormalParam)
+void LiftingParam::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:deepflow.LiftingParam)
   GOOGLE_DCHECK_NE(&from, this);
-  const InitRandomNormalParam* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const InitRandomNormalParam>(
+  const LiftingParam* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const LiftingParam>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.InitRandomNormalParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.LiftingParam)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.InitRandomNormalParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.LiftingParam)
     MergeFrom(*source);
   }
 }
 
-void InitRandomNormalParam::MergeFrom(const InitRandomNormalParam& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.InitRandomNormalParam)
+void LiftingParam::MergeFrom(const LiftingParam& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.LiftingParam)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.mean() != 0) {
-    set_mean(from.mean());
-  }
-  if (from.stddev() != 0) {
-    set_stddev(from.stddev());
+  if (from.mode() != 0) {
+    set_mode(from.mode());
   }
 }
 
-void InitRandomNormalParam::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:deepflow.InitRandomNormalParam)
+void LiftingParam::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:deepflow.LiftingParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void InitRandomNormalParam::CopyFrom(const InitRandomNormalParam& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.InitRandomNormalParam)
+void LiftingParam::CopyFrom(const LiftingParam& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.LiftingParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool InitRandomNormalParam::IsInitialized() const {
+bool LiftingParam::IsInitialized() const {
   return true;
 }
 
-void InitRandomNormalParam::Swap(InitRandomNormalParam* other) {
+void LiftingParam::Swap(LiftingParam* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void InitRandomNormalParam::InternalSwap(InitRandomNormalParam* other) {
-  std::swap(mean_, other->mean_);
-  std::swap(stddev_, other->stddev_);
+void LiftingParam::InternalSwap(LiftingParam* other) {
+  std::swap(mode_, other->mode_);
   std::swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata InitRandomNormalParam::GetMetadata() const {
+::google::protobuf::Metadata LiftingParam::GetMetadata() const {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// InitRandomNormalParam
-
-// float mean = 1;
-void InitRandomNormalParam::clear_mean() {
-  mean_ = 0;
-}
-float InitRandomNormalParam::mean() const {
-  // @@protoc_insertion_point(field_get:deepflow.InitRandomNormalParam.mean)
-  return mean_;
-}
-void InitRandomNormalParam::set_mean(float value) {
-  
-  mean_ = value;
-  // @@protoc_insertion_point(field_set:deepflow.InitRandomNormalParam.mean)
-}
+// LiftingParam
 
-// float stddev = 2;
-void InitRandomNormalParam::clear_stddev() {
-  stddev_ = 0;
+// .deepflow.LiftingParam.Mode mode = 1;
+void LiftingParam::clear_mode() {
+  mode_ = 0;
 }
-float InitRandomNormalParam::stddev() const {
-  // @@protoc_insertion_point(field_get:deepflow.InitRandomNormalParam.stddev)
-  return stddev_;
+::deepflow::LiftingParam_Mode LiftingParam::mode() const {
+  // @@protoc_insertion_point(field_get:deepflow.LiftingParam.mode)
+  return static_cast< ::deepflow::LiftingParam_Mode >(mode_);
 }
-void InitRandomNormalParam::set_stddev(float value) {
+void LiftingParam::set_mode(::deepflow::LiftingParam_Mode value) {
   
-  stddev_ = value;
-  // @@protoc_insertion_point(field_set:deepflow.InitRandomNormalParam.stddev)
+  mode_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.LiftingParam.mode)
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -18254,104 +19629,85 @@ void InitRandomNormalParam::set_stddev(float value) {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int InitTruncatedNormalParam::kMeanFieldNumber;
-const int InitTruncatedNormalParam::kStddevFieldNumber;
+const int InitFillParam::kValueFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-InitTruncatedNormalParam::InitTruncatedNormalParam()
+InitFillParam::InitFillParam()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_deepflow_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:deepflow.InitTruncatedNormalParam)
+  // @@protoc_insertion_point(constructor:deepflow.InitFillParam)
 }
-InitTruncatedNormalParam::InitTruncatedNormalParam(const InitTruncatedNormalParam& from)
+InitFillParam::InitFillParam(const InitFillParam& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::memcpy(&mean_, &from.mean_,
-    reinterpret_cast<char*>(&stddev_) -
-    reinterpret_cast<char*>(&mean_) + sizeof(stddev_));
-  // @@protoc_insertion_point(copy_constructor:deepflow.InitTruncatedNormalParam)
+  value_ = from.value_;
+  // @@protoc_insertion_point(copy_constructor:deepflow.InitFillParam)
 }
 
-void InitTruncatedNormalParam::SharedCtor() {
-  ::memset(&mean_, 0, reinterpret_cast<char*>(&stddev_) -
-    reinterpret_cast<char*>(&mean_) + sizeof(stddev_));
+void InitFillParam::SharedCtor() {
+  value_ = 0;
   _cached_size_ = 0;
 }
 
-InitTruncatedNormalParam::~InitTruncatedNormalParam() {
-  // @@protoc_insertion_point(destructor:deepflow.InitTruncatedNormalParam)
+InitFillParam::~InitFillParam() {
+  // @@protoc_insertion_point(destructor:deepflow.InitFillParam)
   SharedDtor();
 }
 
-void InitTruncatedNormalParam::SharedDtor() {
+void InitFillParam::SharedDtor() {
 }
 
-void InitTruncatedNormalParam::SetCachedSize(int size) const {
+void InitFillParam::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* InitTruncatedNormalParam::descriptor() {
+const ::google::protobuf::Descriptor* InitFillParam::descriptor() {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const InitTruncatedNormalParam& InitTruncatedNormalParam::default_instance() {
+const InitFillParam& InitFillParam::default_instance() {
   protobuf_deepflow_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-InitTruncatedNormalParam* InitTruncatedNormalParam::New(::google::protobuf::Arena* arena) const {
-  InitTruncatedNormalParam* n = new InitTruncatedNormalParam;
+InitFillParam* InitFillParam::New(::google::protobuf::Arena* arena) const {
+  InitFillParam* n = new InitFillParam;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void InitTruncatedNormalParam::Clear() {
-// @@protoc_insertion_point(message_clear_start:deepflow.InitTruncatedNormalParam)
-  ::memset(&mean_, 0, reinterpret_cast<char*>(&stddev_) -
-    reinterpret_cast<char*>(&mean_) + sizeof(stddev_));
+void InitFillParam::Clear() {
+// @@protoc_insertion_point(message_clear_start:deepflow.InitFillParam)
+  value_ = 0;
 }
 
-bool InitTruncatedNormalParam::MergePartialFromCodedStream(
+bool InitFillParam::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:deepflow.InitTruncatedNormalParam)
+  // @@protoc_insertion_point(parse_start:deepflow.InitFillParam)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // float mean = 1;
+      // float value = 1;
       case 1: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
             static_cast< ::google::protobuf::uint8>(13u)) {
 
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
                    float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &mean_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // float stddev = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(21u)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &stddev_)));
+                 input, &value_)));
         } else {
           goto handle_unusual;
         }
@@ -18371,64 +19727,49 @@ bool InitTruncatedNormalParam::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:deepflow.InitTruncatedNormalParam)
+  // @@protoc_insertion_point(parse_success:deepflow.InitFillParam)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:deepflow.InitTruncatedNormalParam)
+  // @@protoc_insertion_point(parse_failure:deepflow.InitFillParam)
   return false;
 #undef DO_
 }
 
-void InitTruncatedNormalParam::SerializeWithCachedSizes(
+void InitFillParam::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:deepflow.InitTruncatedNormalParam)
+  // @@protoc_insertion_point(serialize_start:deepflow.InitFillParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // float mean = 1;
-  if (this->mean() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(1, this->mean(), output);
-  }
-
-  // float stddev = 2;
-  if (this->stddev() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(2, this->stddev(), output);
+  // float value = 1;
+  if (this->value() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(1, this->value(), output);
   }
 
-  // @@protoc_insertion_point(serialize_end:deepflow.InitTruncatedNormalParam)
+  // @@protoc_insertion_point(serialize_end:deepflow.InitFillParam)
 }
 
-::google::protobuf::uint8* InitTruncatedNormalParam::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* InitFillParam::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:deepflow.InitTruncatedNormalParam)
+  // @@protoc_insertion_point(serialize_to_array_start:deepflow.InitFillParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // float mean = 1;
-  if (this->mean() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(1, this->mean(), target);
-  }
-
-  // float stddev = 2;
-  if (this->stddev() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(2, this->stddev(), target);
+  // float value = 1;
+  if (this->value() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(1, this->value(), target);
   }
 
-  // @@protoc_insertion_point(serialize_to_array_end:deepflow.InitTruncatedNormalParam)
+  // @@protoc_insertion_point(serialize_to_array_end:deepflow.InitFillParam)
   return target;
 }
 
-size_t InitTruncatedNormalParam::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:deepflow.InitTruncatedNormalParam)
+size_t InitFillParam::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:deepflow.InitFillParam)
   size_t total_size = 0;
 
-  // float mean = 1;
-  if (this->mean() != 0) {
-    total_size += 1 + 4;
-  }
-
-  // float stddev = 2;
-  if (this->stddev() != 0) {
+  // float value = 1;
+  if (this->value() != 0) {
     total_size += 1 + 4;
   }
 
@@ -18439,98 +19780,80 @@ size_t InitTruncatedNormalParam::ByteSizeLong() const {
   return total_size;
 }
 
-void InitTruncatedNormalParam::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:deepflow.InitTruncatedNormalParam)
+void InitFillParam::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:deepflow.InitFillParam)
   GOOGLE_DCHECK_NE(&from, this);
-  const InitTruncatedNormalParam* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const InitTruncatedNormalParam>(
+  const InitFillParam* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const InitFillParam>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.InitTruncatedNormalParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.InitFillParam)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.InitTruncatedNormalParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.InitFillParam)
     MergeFrom(*source);
   }
 }
 
-void InitTruncatedNormalParam::MergeFrom(const InitTruncatedNormalParam& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.InitTruncatedNormalParam)
+void InitFillParam::MergeFrom(const InitFillParam& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.InitFillParam)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.mean() != 0) {
-    set_mean(from.mean());
-  }
-  if (from.stddev() != 0) {
-    set_stddev(from.stddev());
+  if (from.value() != 0) {
+    set_value(from.value());
   }
 }
 
-void InitTruncatedNormalParam::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:deepflow.InitTruncatedNormalParam)
+void InitFillParam::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:deepflow.InitFillParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void InitTruncatedNormalParam::CopyFrom(const InitTruncatedNormalParam& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.InitTruncatedNormalParam)
+void InitFillParam::CopyFrom(const InitFillParam& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.InitFillParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool InitTruncatedNormalParam::IsInitialized() const {
+bool InitFillParam::IsInitialized() const {
   return true;
 }
 
-void InitTruncatedNormalParam::Swap(InitTruncatedNormalParam* other) {
+void InitFillParam::Swap(InitFillParam* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void InitTruncatedNormalParam::InternalSwap(InitTruncatedNormalParam* other) {
-  std::swap(mean_, other->mean_);
-  std::swap(stddev_, other->stddev_);
+void InitFillParam::InternalSwap(InitFillParam* other) {
+  std::swap(value_, other->value_);
   std::swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata InitTruncatedNormalParam::GetMetadata() const {
+::google::protobuf::Metadata InitFillParam::GetMetadata() const {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// InitTruncatedNormalParam
-
-// float mean = 1;
-void InitTruncatedNormalParam::clear_mean() {
-  mean_ = 0;
-}
-float InitTruncatedNormalParam::mean() const {
-  // @@protoc_insertion_point(field_get:deepflow.InitTruncatedNormalParam.mean)
-  return mean_;
-}
-void InitTruncatedNormalParam::set_mean(float value) {
-  
-  mean_ = value;
-  // @@protoc_insertion_point(field_set:deepflow.InitTruncatedNormalParam.mean)
-}
+// InitFillParam
 
-// float stddev = 2;
-void InitTruncatedNormalParam::clear_stddev() {
-  stddev_ = 0;
+// float value = 1;
+void InitFillParam::clear_value() {
+  value_ = 0;
 }
-float InitTruncatedNormalParam::stddev() const {
-  // @@protoc_insertion_point(field_get:deepflow.InitTruncatedNormalParam.stddev)
-  return stddev_;
+float InitFillParam::value() const {
+  // @@protoc_insertion_point(field_get:deepflow.InitFillParam.value)
+  return value_;
 }
-void InitTruncatedNormalParam::set_stddev(float value) {
+void InitFillParam::set_value(float value) {
   
-  stddev_ = value;
-  // @@protoc_insertion_point(field_set:deepflow.InitTruncatedNormalParam.stddev)
+  value_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.InitFillParam.value)
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -18538,104 +19861,85 @@ void InitTruncatedNormalParam::set_stddev(float value) {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int InitStepParam::kMinFieldNumber;
-const int InitStepParam::kMaxFieldNumber;
+const int InitIndexFillParam::kOffsetFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-InitStepParam::InitStepParam()
+InitIndexFillParam::InitIndexFillParam()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_deepflow_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:deepflow.InitStepParam)
+  // @@protoc_insertion_point(constructor:deepflow.InitIndexFillParam)
 }
-InitStepParam::InitStepParam(const InitStepParam& from)
+InitIndexFillParam::InitIndexFillParam(const InitIndexFillParam& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::memcpy(&min_, &from.min_,
-    reinterpret_cast<char*>(&max_) -
-    reinterpret_cast<char*>(&min_) + sizeof(max_));
-  // @@protoc_insertion_point(copy_constructor:deepflow.InitStepParam)
+  offset_ = from.offset_;
+  // @@protoc_insertion_point(copy_constructor:deepflow.InitIndexFillParam)
 }
 
-void InitStepParam::SharedCtor() {
-  ::memset(&min_, 0, reinterpret_cast<char*>(&max_) -
-    reinterpret_cast<char*>(&min_) + sizeof(max_));
+void InitIndexFillParam::SharedCtor() {
+  offset_ = 0;
   _cached_size_ = 0;
 }
 
-InitStepParam::~InitStepParam() {
-  // @@protoc_insertion_point(destructor:deepflow.InitStepParam)
+InitIndexFillParam::~InitIndexFillParam() {
+  // @@protoc_insertion_point(destructor:deepflow.InitIndexFillParam)
   SharedDtor();
 }
 
-void InitStepParam::SharedDtor() {
+void InitIndexFillParam::SharedDtor() {
 }
 
-void InitStepParam::SetCachedSize(int size) const {
+void InitIndexFillParam::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* InitStepParam::descriptor() {
+const ::google::protobuf::Descriptor* InitIndexFillParam::descriptor() {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const InitStepParam& InitStepParam::default_instance() {
+const InitIndexFillParam& InitIndexFillParam::default_instance() {
   protobuf_deepflow_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-InitStepParam* InitStepParam::New(::google::protobuf::Arena* arena) const {
-  InitStepParam* n = new InitStepParam;
+InitIndexFillParam* InitIndexFillParam::New(::google::protobuf::Arena* arena) const {
+  InitIndexFillParam* n = new InitIndexFillParam;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void InitStepParam::Clear() {
-// @@protoc_insertion_point(message_clear_start:deepflow.InitStepParam)
-  ::memset(&min_, 0, reinterpret_cast<char*>(&max_) -
-    reinterpret_cast<char*>(&min_) + sizeof(max_));
+void InitIndexFillParam::Clear() {
+// @@protoc_insertion_point(message_clear_start:deepflow.InitIndexFillParam)
+  offset_ = 0;
 }
 
-bool InitStepParam::MergePartialFromCodedStream(
+bool InitIndexFillParam::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:deepflow.InitStepParam)
+  // @@protoc_insertion_point(parse_start:deepflow.InitIndexFillParam)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // float min = 1;
+      // float offset = 1;
       case 1: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
             static_cast< ::google::protobuf::uint8>(13u)) {
 
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
                    float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &min_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // float max = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(21u)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &max_)));
+                 input, &offset_)));
         } else {
           goto handle_unusual;
         }
@@ -18655,64 +19959,49 @@ bool InitStepParam::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:deepflow.InitStepParam)
+  // @@protoc_insertion_point(parse_success:deepflow.InitIndexFillParam)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:deepflow.InitStepParam)
+  // @@protoc_insertion_point(parse_failure:deepflow.InitIndexFillParam)
   return false;
 #undef DO_
 }
 
-void InitStepParam::SerializeWithCachedSizes(
+void InitIndexFillParam::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:deepflow.InitStepParam)
+  // @@protoc_insertion_point(serialize_start:deepflow.InitIndexFillParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // float min = 1;
-  if (this->min() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(1, this->min(), output);
-  }
-
-  // float max = 2;
-  if (this->max() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(2, this->max(), output);
+  // float offset = 1;
+  if (this->offset() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(1, this->offset(), output);
   }
 
-  // @@protoc_insertion_point(serialize_end:deepflow.InitStepParam)
+  // @@protoc_insertion_point(serialize_end:deepflow.InitIndexFillParam)
 }
 
-::google::protobuf::uint8* InitStepParam::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* InitIndexFillParam::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:deepflow.InitStepParam)
+  // @@protoc_insertion_point(serialize_to_array_start:deepflow.InitIndexFillParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // float min = 1;
-  if (this->min() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(1, this->min(), target);
-  }
-
-  // float max = 2;
-  if (this->max() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(2, this->max(), target);
+  // float offset = 1;
+  if (this->offset() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(1, this->offset(), target);
   }
 
-  // @@protoc_insertion_point(serialize_to_array_end:deepflow.InitStepParam)
+  // @@protoc_insertion_point(serialize_to_array_end:deepflow.InitIndexFillParam)
   return target;
 }
 
-size_t InitStepParam::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:deepflow.InitStepParam)
+size_t InitIndexFillParam::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:deepflow.InitIndexFillParam)
   size_t total_size = 0;
 
-  // float min = 1;
-  if (this->min() != 0) {
-    total_size += 1 + 4;
-  }
-
-  // float max = 2;
-  if (this->max() != 0) {
+  // float offset = 1;
+  if (this->offset() != 0) {
     total_size += 1 + 4;
   }
 
@@ -18723,98 +20012,80 @@ size_t InitStepParam::ByteSizeLong() const {
   return total_size;
 }
 
-void InitStepParam::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:deepflow.InitStepParam)
+void InitIndexFillParam::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:deepflow.InitIndexFillParam)
   GOOGLE_DCHECK_NE(&from, this);
-  const InitStepParam* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const InitStepParam>(
+  const InitIndexFillParam* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const InitIndexFillParam>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.InitStepParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.InitIndexFillParam)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.InitStepParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.InitIndexFillParam)
     MergeFrom(*source);
   }
 }
 
-void InitStepParam::MergeFrom(const InitStepParam& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.InitStepParam)
+void InitIndexFillParam::MergeFrom(const InitIndexFillParam& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.InitIndexFillParam)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.min() != 0) {
-    set_min(from.min());
-  }
-  if (from.max() != 0) {
-    set_max(from.max());
+  if (from.offset() != 0) {
+    set_offset(from.offset());
   }
 }
 
-void InitStepParam::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:deepflow.InitStepParam)
+void InitIndexFillParam::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:deepflow.InitIndexFillParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void InitStepParam::CopyFrom(const InitStepParam& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.InitStepParam)
+void InitIndexFillParam::CopyFrom(const InitIndexFillParam& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.InitIndexFillParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool InitStepParam::IsInitialized() const {
+bool InitIndexFillParam::IsInitialized() const {
   return true;
 }
 
-void InitStepParam::Swap(InitStepParam* other) {
+void InitIndexFillParam::Swap(InitIndexFillParam* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void InitStepParam::InternalSwap(InitStepParam* other) {
-  std::swap(min_, other->min_);
-  std::swap(max_, other->max_);
+void InitIndexFillParam::InternalSwap(InitIndexFillParam* other) {
+  std::swap(offset_, other->offset_);
   std::swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata InitStepParam::GetMetadata() const {
+::google::protobuf::Metadata InitIndexFillParam::GetMetadata() const {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// InitStepParam
-
-// float min = 1;
-void InitStepParam::clear_min() {
-  min_ = 0;
-}
-float InitStepParam::min() const {
-  // @@protoc_insertion_point(field_get:deepflow.InitStepParam.min)
-  return min_;
-}
-void InitStepParam::set_min(float value) {
-  
-  min_ = value;
-  // @@protoc_insertion_point(field_set:deepflow.InitStepParam.min)
-}
+// InitIndexFillParam
 
-// float max = 2;
-void InitStepParam::clear_max() {
-  max_ = 0;
+// float offset = 1;
+void InitIndexFillParam::clear_offset() {
+  offset_ = 0;
 }
-float InitStepParam::max() const {
-  // @@protoc_insertion_point(field_get:deepflow.InitStepParam.max)
-  return max_;
+float InitIndexFillParam::offset() const {
+  // @@protoc_insertion_point(field_get:deepflow.InitIndexFillParam.offset)
+  return offset_;
 }
-void InitStepParam::set_max(float value) {
+void InitIndexFillParam::set_offset(float value) {
   
-  max_ = value;
-  // @@protoc_insertion_point(field_set:deepflow.InitStepParam.max)
+  offset_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.InitIndexFillParam.offset)
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -18824,66 +20095,66 @@ void InitStepParam::set_max(float value) {
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-InitThreeStateParam::InitThreeStateParam()
+InitGradientFillParam::InitGradientFillParam()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_deepflow_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:deepflow.InitThreeStateParam)
+  // @@protoc_insertion_point(constructor:deepflow.InitGradientFillParam)
 }
-InitThreeStateParam::InitThreeStateParam(const InitThreeStateParam& from)
+InitGradientFillParam::InitGradientFillParam(const InitGradientFillParam& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:deepflow.InitThreeStateParam)
+  // @@protoc_insertion_point(copy_constructor:deepflow.InitGradientFillParam)
 }
 
-void InitThreeStateParam::SharedCtor() {
+void InitGradientFillParam::SharedCtor() {
   _cached_size_ = 0;
 }
 
-InitThreeStateParam::~InitThreeStateParam() {
-  // @@protoc_insertion_point(destructor:deepflow.InitThreeStateParam)
+InitGradientFillParam::~InitGradientFillParam() {
+  // @@protoc_insertion_point(destructor:deepflow.InitGradientFillParam)
   SharedDtor();
 }
 
-void InitThreeStateParam::SharedDtor() {
+void InitGradientFillParam::SharedDtor() {
 }
 
-void InitThreeStateParam::SetCachedSize(int size) const {
+void InitGradientFillParam::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* InitThreeStateParam::descriptor() {
+const ::google::protobuf::Descriptor* InitGradientFillParam::descriptor() {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const InitThreeStateParam& InitThreeStateParam::default_instance() {
+const InitGradientFillParam& InitGradientFillParam::default_instance() {
   protobuf_deepflow_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-InitThreeStateParam* InitThreeStateParam::New(::google::protobuf::Arena* arena) const {
-  InitThreeStateParam* n = new InitThreeStateParam;
+InitGradientFillParam* InitGradientFillParam::New(::google::protobuf::Arena* arena) const {
+  InitGradientFillParam* n = new InitGradientFillParam;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void InitThreeStateParam::Clear() {
-// @@protoc_insertion_point(message_clear_start:deepflow.InitThreeStateParam)
+void InitGradientFillParam::Clear() {
+// @@protoc_insertion_point(message_clear_start:deepflow.InitGradientFillParam)
 }
 
-bool InitThreeStateParam::MergePartialFromCodedStream(
+bool InitGradientFillParam::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:deepflow.InitThreeStateParam)
+  // @@protoc_insertion_point(parse_start:deepflow.InitGradientFillParam)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
@@ -18897,35 +20168,35 @@ bool InitThreeStateParam::MergePartialFromCodedStream(
     DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
   }
 success:
-  // @@protoc_insertion_point(parse_success:deepflow.InitThreeStateParam)
+  // @@protoc_insertion_point(parse_success:deepflow.InitGradientFillParam)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:deepflow.InitThreeStateParam)
+  // @@protoc_insertion_point(parse_failure:deepflow.InitGradientFillParam)
   return false;
 #undef DO_
 }
 
-void InitThreeStateParam::SerializeWithCachedSizes(
+void InitGradientFillParam::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:deepflow.InitThreeStateParam)
+  // @@protoc_insertion_point(serialize_start:deepflow.InitGradientFillParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // @@protoc_insertion_point(serialize_end:deepflow.InitThreeStateParam)
+  // @@protoc_insertion_point(serialize_end:deepflow.InitGradientFillParam)
 }
 
-::google::protobuf::uint8* InitThreeStateParam::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* InitGradientFillParam::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:deepflow.InitThreeStateParam)
+  // @@protoc_insertion_point(serialize_to_array_start:deepflow.InitGradientFillParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // @@protoc_insertion_point(serialize_to_array_end:deepflow.InitThreeStateParam)
+  // @@protoc_insertion_point(serialize_to_array_end:deepflow.InitGradientFillParam)
   return target;
 }
 
-size_t InitThreeStateParam::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:deepflow.InitThreeStateParam)
+size_t InitGradientFillParam::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:deepflow.InitGradientFillParam)
   size_t total_size = 0;
 
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
@@ -18935,23 +20206,23 @@ size_t InitThreeStateParam::ByteSizeLong() const {
   return total_size;
 }
 
-void InitThreeStateParam::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:deepflow.InitThreeStateParam)
+void InitGradientFillParam::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:deepflow.InitGradientFillParam)
   GOOGLE_DCHECK_NE(&from, this);
-  const InitThreeStateParam* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const InitThreeStateParam>(
+  const InitGradientFillParam* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const InitGradientFillParam>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.InitThreeStateParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.InitGradientFillParam)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.InitThreeStateParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.InitGradientFillParam)
     MergeFrom(*source);
   }
 }
 
-void InitThreeStateParam::MergeFrom(const InitThreeStateParam& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.InitThreeStateParam)
+void InitGradientFillParam::MergeFrom(const InitGradientFillParam& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.InitGradientFillParam)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
@@ -18959,127 +20230,143 @@ void InitThreeStateParam::MergeFrom(const InitThreeStateParam& from) {
 
 }
 
-void InitThreeStateParam::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:deepflow.InitThreeStateParam)
+void InitGradientFillParam::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:deepflow.InitGradientFillParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void InitThreeStateParam::CopyFrom(const InitThreeStateParam& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.InitThreeStateParam)
+void InitGradientFillParam::CopyFrom(const InitGradientFillParam& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.InitGradientFillParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool InitThreeStateParam::IsInitialized() const {
+bool InitGradientFillParam::IsInitialized() const {
   return true;
 }
 
-void InitThreeStateParam::Swap(InitThreeStateParam* other) {
+void InitGradientFillParam::Swap(InitGradientFillParam* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void InitThreeStateParam::InternalSwap(InitThreeStateParam* other) {
+void InitGradientFillParam::InternalSwap(InitGradientFillParam* other) {
   std::swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata InitThreeStateParam::GetMetadata() const {
+::google::protobuf::Metadata InitGradientFillParam::GetMetadata() const {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// InitThreeStateParam
+// InitGradientFillParam
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int InitConstantParam::kValuesFieldNumber;
+const int InitRandomUniformParam::kMinFieldNumber;
+const int InitRandomUniformParam::kMaxFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-InitConstantParam::InitConstantParam()
+InitRandomUniformParam::InitRandomUniformParam()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_deepflow_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:deepflow.InitConstantParam)
+  // @@protoc_insertion_point(constructor:deepflow.InitRandomUniformParam)
 }
-InitConstantParam::InitConstantParam(const InitConstantParam& from)
+InitRandomUniformParam::InitRandomUniformParam(const InitRandomUniformParam& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
-      values_(from.values_),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:deepflow.InitConstantParam)
+  ::memcpy(&min_, &from.min_,
+    reinterpret_cast<char*>(&max_) -
+    reinterpret_cast<char*>(&min_) + sizeof(max_));
+  // @@protoc_insertion_point(copy_constructor:deepflow.InitRandomUniformParam)
 }
 
-void InitConstantParam::SharedCtor() {
+void InitRandomUniformParam::SharedCtor() {
+  ::memset(&min_, 0, reinterpret_cast<char*>(&max_) -
+    reinterpret_cast<char*>(&min_) + sizeof(max_));
   _cached_size_ = 0;
 }
 
-InitConstantParam::~InitConstantParam() {
-  // @@protoc_insertion_point(destructor:deepflow.InitConstantParam)
+InitRandomUniformParam::~InitRandomUniformParam() {
+  // @@protoc_insertion_point(destructor:deepflow.InitRandomUniformParam)
   SharedDtor();
 }
 
-void InitConstantParam::SharedDtor() {
+void InitRandomUniformParam::SharedDtor() {
 }
 
-void InitConstantParam::SetCachedSize(int size) const {
+void InitRandomUniformParam::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* InitConstantParam::descriptor() {
+const ::google::protobuf::Descriptor* InitRandomUniformParam::descriptor() {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const InitConstantParam& InitConstantParam::default_instance() {
+const InitRandomUniformParam& InitRandomUniformParam::default_instance() {
   protobuf_deepflow_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-InitConstantParam* InitConstantParam::New(::google::protobuf::Arena* arena) const {
-  InitConstantParam* n = new InitConstantParam;
+InitRandomUniformParam* InitRandomUniformParam::New(::google::protobuf::Arena* arena) const {
+  InitRandomUniformParam* n = new InitRandomUniformParam;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void InitConstantParam::Clear() {
-// @@protoc_insertion_point(message_clear_start:deepflow.InitConstantParam)
-  values_.Clear();
+void InitRandomUniformParam::Clear() {
+// @@protoc_insertion_point(message_clear_start:deepflow.InitRandomUniformParam)
+  ::memset(&min_, 0, reinterpret_cast<char*>(&max_) -
+    reinterpret_cast<char*>(&min_) + sizeof(max_));
 }
 
-bool InitConstantParam::MergePartialFromCodedStream(
+bool InitRandomUniformParam::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:deepflow.InitConstantParam)
+  // @@protoc_insertion_point(parse_start:deepflow.InitRandomUniformParam)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // repeated float values = 1;
+      // float min = 1;
       case 1: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u)) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
+            static_cast< ::google::protobuf::uint8>(13u)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
                    float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, this->mutable_values())));
-        } else if (static_cast< ::google::protobuf::uint8>(tag) ==
-                   static_cast< ::google::protobuf::uint8>(13u)) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                 input, &min_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // float max = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(21u)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
                    float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 1, 10u, input, this->mutable_values())));
+                 input, &max_)));
         } else {
           goto handle_unusual;
         }
@@ -19099,70 +20386,65 @@ bool InitConstantParam::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:deepflow.InitConstantParam)
+  // @@protoc_insertion_point(parse_success:deepflow.InitRandomUniformParam)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:deepflow.InitConstantParam)
+  // @@protoc_insertion_point(parse_failure:deepflow.InitRandomUniformParam)
   return false;
 #undef DO_
 }
 
-void InitConstantParam::SerializeWithCachedSizes(
+void InitRandomUniformParam::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:deepflow.InitConstantParam)
+  // @@protoc_insertion_point(serialize_start:deepflow.InitRandomUniformParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // repeated float values = 1;
-  if (this->values_size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteTag(1, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
-    output->WriteVarint32(_values_cached_byte_size_);
-    ::google::protobuf::internal::WireFormatLite::WriteFloatArray(
-      this->values().data(), this->values_size(), output);
+  // float min = 1;
+  if (this->min() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(1, this->min(), output);
   }
 
-  // @@protoc_insertion_point(serialize_end:deepflow.InitConstantParam)
+  // float max = 2;
+  if (this->max() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(2, this->max(), output);
+  }
+
+  // @@protoc_insertion_point(serialize_end:deepflow.InitRandomUniformParam)
 }
 
-::google::protobuf::uint8* InitConstantParam::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* InitRandomUniformParam::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:deepflow.InitConstantParam)
+  // @@protoc_insertion_point(serialize_to_array_start:deepflow.InitRandomUniformParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // repeated float values = 1;
-  if (this->values_size() > 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
-      1,
-      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
-      target);
-    target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
-      _values_cached_byte_size_, target);
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteFloatNoTagToArray(this->values_, target);
+  // float min = 1;
+  if (this->min() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(1, this->min(), target);
   }
 
-  // @@protoc_insertion_point(serialize_to_array_end:deepflow.InitConstantParam)
+  // float max = 2;
+  if (this->max() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(2, this->max(), target);
+  }
+
+  // @@protoc_insertion_point(serialize_to_array_end:deepflow.InitRandomUniformParam)
   return target;
 }
 
-size_t InitConstantParam::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:deepflow.InitConstantParam)
+size_t InitRandomUniformParam::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:deepflow.InitRandomUniformParam)
   size_t total_size = 0;
 
-  // repeated float values = 1;
-  {
-    unsigned int count = this->values_size();
-    size_t data_size = 4UL * count;
-    if (data_size > 0) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
-    }
-    int cached_size = ::google::protobuf::internal::ToCachedSize(data_size);
-    GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-    _values_cached_byte_size_ = cached_size;
-    GOOGLE_SAFE_CONCURRENT_WRITES_END();
-    total_size += data_size;
+  // float min = 1;
+  if (this->min() != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float max = 2;
+  if (this->max() != 0) {
+    total_size += 1 + 4;
   }
 
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
@@ -19172,94 +20454,98 @@ size_t InitConstantParam::ByteSizeLong() const {
   return total_size;
 }
 
-void InitConstantParam::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:deepflow.InitConstantParam)
+void InitRandomUniformParam::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:deepflow.InitRandomUniformParam)
   GOOGLE_DCHECK_NE(&from, this);
-  const InitConstantParam* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const InitConstantParam>(
+  const InitRandomUniformParam* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const InitRandomUniformParam>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.InitConstantParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.InitRandomUniformParam)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.InitConstantParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.InitRandomUniformParam)
     MergeFrom(*source);
   }
 }
 
-void InitConstantParam::MergeFrom(const InitConstantParam& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.InitConstantParam)
+void InitRandomUniformParam::MergeFrom(const InitRandomUniformParam& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.InitRandomUniformParam)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  values_.MergeFrom(from.values_);
+  if (from.min() != 0) {
+    set_min(from.min());
+  }
+  if (from.max() != 0) {
+    set_max(from.max());
+  }
 }
 
-void InitConstantParam::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:deepflow.InitConstantParam)
+void InitRandomUniformParam::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:deepflow.InitRandomUniformParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void InitConstantParam::CopyFrom(const InitConstantParam& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.InitConstantParam)
+void InitRandomUniformParam::CopyFrom(const InitRandomUniformParam& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.InitRandomUniformParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool InitConstantParam::IsInitialized() const {
+bool InitRandomUniformParam::IsInitialized() const {
   return true;
 }
 
-void InitConstantParam::Swap(InitConstantParam* other) {
+void InitRandomUniformParam::Swap(InitRandomUniformParam* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void InitConstantParam::InternalSwap(InitConstantParam* other) {
-  values_.InternalSwap(&other->values_);
+void InitRandomUniformParam::InternalSwap(InitRandomUniformParam* other) {
+  std::swap(min_, other->min_);
+  std::swap(max_, other->max_);
   std::swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata InitConstantParam::GetMetadata() const {
+::google::protobuf::Metadata InitRandomUniformParam::GetMetadata() const {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// InitConstantParam
+// InitRandomUniformParam
 
-// repeated float values = 1;
-int InitConstantParam::values_size() const {
-  return values_.size();
-}
-void InitConstantParam::clear_values() {
-  values_.Clear();
+// float min = 1;
+void InitRandomUniformParam::clear_min() {
+  min_ = 0;
 }
-float InitConstantParam::values(int index) const {
-  // @@protoc_insertion_point(field_get:deepflow.InitConstantParam.values)
-  return values_.Get(index);
+float InitRandomUniformParam::min() const {
+  // @@protoc_insertion_point(field_get:deepflow.InitRandomUniformParam.min)
+  return min_;
 }
-void InitConstantParam::set_values(int index, float value) {
-  values_.Set(index, value);
-  // @@protoc_insertion_point(field_set:deepflow.InitConstantParam.values)
+void InitRandomUniformParam::set_min(float value) {
+  
+  min_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.InitRandomUniformParam.min)
 }
-void InitConstantParam::add_values(float value) {
-  values_.Add(value);
-  // @@protoc_insertion_point(field_add:deepflow.InitConstantParam.values)
+
+// float max = 2;
+void InitRandomUniformParam::clear_max() {
+  max_ = 0;
 }
-const ::google::protobuf::RepeatedField< float >&
-InitConstantParam::values() const {
-  // @@protoc_insertion_point(field_list:deepflow.InitConstantParam.values)
-  return values_;
+float InitRandomUniformParam::max() const {
+  // @@protoc_insertion_point(field_get:deepflow.InitRandomUniformParam.max)
+  return max_;
 }
-::google::protobuf::RepeatedField< float >*
-InitConstantParam::mutable_values() {
-  // @@protoc_insertion_point(field_mutable_list:deepflow.InitConstantParam.values)
-  return &values_;
+void InitRandomUniformParam::set_max(float value) {
+  
+  max_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.InitRandomUniformParam.max)
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -19267,368 +20553,104 @@ InitConstantParam::mutable_values() {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int InitParam::kNameFieldNumber;
-const int InitParam::kTensorParamFieldNumber;
-const int InitParam::kInitDataFieldNumber;
-const int InitParam::kFillParamFieldNumber;
-const int InitParam::kIndexFillParamFieldNumber;
-const int InitParam::kRandomUniformParamFieldNumber;
-const int InitParam::kStepParamFieldNumber;
-const int InitParam::kRandomNormalParamFieldNumber;
-const int InitParam::kThreeStateParamFieldNumber;
-const int InitParam::kTruncatedNormalParamFieldNumber;
-const int InitParam::kGradientFillParamFieldNumber;
-const int InitParam::kConstantParamFieldNumber;
+const int InitRandomNormalParam::kMeanFieldNumber;
+const int InitRandomNormalParam::kStddevFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-InitParam::InitParam()
+InitRandomNormalParam::InitRandomNormalParam()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_deepflow_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:deepflow.InitParam)
+  // @@protoc_insertion_point(constructor:deepflow.InitRandomNormalParam)
 }
-InitParam::InitParam(const InitParam& from)
+InitRandomNormalParam::InitRandomNormalParam(const InitRandomNormalParam& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
-  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.name().size() > 0) {
-    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
-  }
-  if (from.has_tensor_param()) {
-    tensor_param_ = new ::deepflow::TensorParam(*from.tensor_param_);
-  } else {
-    tensor_param_ = NULL;
-  }
-  if (from.has_init_data()) {
-    init_data_ = new ::deepflow::TensorData(*from.init_data_);
-  } else {
-    init_data_ = NULL;
-  }
-  if (from.has_fill_param()) {
-    fill_param_ = new ::deepflow::InitFillParam(*from.fill_param_);
-  } else {
-    fill_param_ = NULL;
-  }
-  if (from.has_index_fill_param()) {
-    index_fill_param_ = new ::deepflow::InitIndexFillParam(*from.index_fill_param_);
-  } else {
-    index_fill_param_ = NULL;
-  }
-  if (from.has_random_uniform_param()) {
-    random_uniform_param_ = new ::deepflow::InitRandomUniformParam(*from.random_uniform_param_);
-  } else {
-    random_uniform_param_ = NULL;
-  }
-  if (from.has_step_param()) {
-    step_param_ = new ::deepflow::InitStepParam(*from.step_param_);
-  } else {
-    step_param_ = NULL;
-  }
-  if (from.has_random_normal_param()) {
-    random_normal_param_ = new ::deepflow::InitRandomNormalParam(*from.random_normal_param_);
-  } else {
-    random_normal_param_ = NULL;
-  }
-  if (from.has_three_state_param()) {
-    three_state_param_ = new ::deepflow::InitThreeStateParam(*from.three_state_param_);
-  } else {
-    three_state_param_ = NULL;
-  }
-  if (from.has_truncated_normal_param()) {
-    truncated_normal_param_ = new ::deepflow::InitTruncatedNormalParam(*from.truncated_normal_param_);
-  } else {
-    truncated_normal_param_ = NULL;
-  }
-  if (from.has_gradient_fill_param()) {
-    gradient_fill_param_ = new ::deepflow::InitGradientFillParam(*from.gradient_fill_param_);
-  } else {
-    gradient_fill_param_ = NULL;
-  }
-  if (from.has_constant_param()) {
-    constant_param_ = new ::deepflow::InitConstantParam(*from.constant_param_);
-  } else {
-    constant_param_ = NULL;
-  }
-  // @@protoc_insertion_point(copy_constructor:deepflow.InitParam)
+  ::memcpy(&mean_, &from.mean_,
+    reinterpret_cast<char*>(&stddev_) -
+    reinterpret_cast<char*>(&mean_) + sizeof(stddev_));
+  // @@protoc_insertion_point(copy_constructor:deepflow.InitRandomNormalParam)
 }
 
-void InitParam::SharedCtor() {
-  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&tensor_param_, 0, reinterpret_cast<char*>(&constant_param_) -
-    reinterpret_cast<char*>(&tensor_param_) + sizeof(constant_param_));
+void InitRandomNormalParam::SharedCtor() {
+  ::memset(&mean_, 0, reinterpret_cast<char*>(&stddev_) -
+    reinterpret_cast<char*>(&mean_) + sizeof(stddev_));
   _cached_size_ = 0;
 }
 
-InitParam::~InitParam() {
-  // @@protoc_insertion_point(destructor:deepflow.InitParam)
+InitRandomNormalParam::~InitRandomNormalParam() {
+  // @@protoc_insertion_point(destructor:deepflow.InitRandomNormalParam)
   SharedDtor();
 }
 
-void InitParam::SharedDtor() {
-  name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (this != internal_default_instance()) {
-    delete tensor_param_;
-  }
-  if (this != internal_default_instance()) {
-    delete init_data_;
-  }
-  if (this != internal_default_instance()) {
-    delete fill_param_;
-  }
-  if (this != internal_default_instance()) {
-    delete index_fill_param_;
-  }
-  if (this != internal_default_instance()) {
-    delete random_uniform_param_;
-  }
-  if (this != internal_default_instance()) {
-    delete step_param_;
-  }
-  if (this != internal_default_instance()) {
-    delete random_normal_param_;
-  }
-  if (this != internal_default_instance()) {
-    delete three_state_param_;
-  }
-  if (this != internal_default_instance()) {
-    delete truncated_normal_param_;
-  }
-  if (this != internal_default_instance()) {
-    delete gradient_fill_param_;
-  }
-  if (this != internal_default_instance()) {
-    delete constant_param_;
-  }
+void InitRandomNormalParam::SharedDtor() {
 }
 
-void InitParam::SetCachedSize(int size) const {
+void InitRandomNormalParam::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* InitParam::descriptor() {
+const ::google::protobuf::Descriptor* InitRandomNormalParam::descriptor() {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const InitParam& InitParam::default_instance() {
+const InitRandomNormalParam& InitRandomNormalParam::default_instance() {
   protobuf_deepflow_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-InitParam* InitParam::New(::google::protobuf::Arena* arena) const {
-  InitParam* n = new InitParam;
+InitRandomNormalParam* InitRandomNormalParam::New(::google::protobuf::Arena* arena) const {
+  InitRandomNormalParam* n = new InitRandomNormalParam;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void InitParam::Clear() {
-// @@protoc_insertion_point(message_clear_start:deepflow.InitParam)
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (GetArenaNoVirtual() == NULL && tensor_param_ != NULL) {
-    delete tensor_param_;
-  }
-  tensor_param_ = NULL;
-  if (GetArenaNoVirtual() == NULL && init_data_ != NULL) {
-    delete init_data_;
-  }
-  init_data_ = NULL;
-  if (GetArenaNoVirtual() == NULL && fill_param_ != NULL) {
-    delete fill_param_;
-  }
-  fill_param_ = NULL;
-  if (GetArenaNoVirtual() == NULL && index_fill_param_ != NULL) {
-    delete index_fill_param_;
-  }
-  index_fill_param_ = NULL;
-  if (GetArenaNoVirtual() == NULL && random_uniform_param_ != NULL) {
-    delete random_uniform_param_;
-  }
-  random_uniform_param_ = NULL;
-  if (GetArenaNoVirtual() == NULL && step_param_ != NULL) {
-    delete step_param_;
-  }
-  step_param_ = NULL;
-  if (GetArenaNoVirtual() == NULL && random_normal_param_ != NULL) {
-    delete random_normal_param_;
-  }
-  random_normal_param_ = NULL;
-  if (GetArenaNoVirtual() == NULL && three_state_param_ != NULL) {
-    delete three_state_param_;
-  }
-  three_state_param_ = NULL;
-  if (GetArenaNoVirtual() == NULL && truncated_normal_param_ != NULL) {
-    delete truncated_normal_param_;
-  }
-  truncated_normal_param_ = NULL;
-  if (GetArenaNoVirtual() == NULL && gradient_fill_param_ != NULL) {
-    delete gradient_fill_param_;
-  }
-  gradient_fill_param_ = NULL;
-  if (GetArenaNoVirtual() == NULL && constant_param_ != NULL) {
-    delete constant_param_;
-  }
-  constant_param_ = NULL;
+void InitRandomNormalParam::Clear() {
+// @@protoc_insertion_point(message_clear_start:deepflow.InitRandomNormalParam)
+  ::memset(&mean_, 0, reinterpret_cast<char*>(&stddev_) -
+    reinterpret_cast<char*>(&mean_) + sizeof(stddev_));
 }
 
-bool InitParam::MergePartialFromCodedStream(
+bool InitRandomNormalParam::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:deepflow.InitParam)
+  // @@protoc_insertion_point(parse_start:deepflow.InitRandomNormalParam)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // string name = 1;
+      // float mean = 1;
       case 1: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_name()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->name().data(), this->name().length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "deepflow.InitParam.name"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // .deepflow.TensorParam tensor_param = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_tensor_param()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // .deepflow.TensorData init_data = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(26u)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_init_data()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // .deepflow.InitFillParam fill_param = 4;
-      case 4: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(34u)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_fill_param()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // .deepflow.InitIndexFillParam index_fill_param = 5;
-      case 5: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(42u)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_index_fill_param()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // .deepflow.InitRandomUniformParam random_uniform_param = 6;
-      case 6: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(50u)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_random_uniform_param()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // .deepflow.InitStepParam step_param = 7;
-      case 7: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(58u)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_step_param()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // .deepflow.InitRandomNormalParam random_normal_param = 8;
-      case 8: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(66u)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_random_normal_param()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // .deepflow.InitThreeStateParam three_state_param = 9;
-      case 9: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(74u)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_three_state_param()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
+            static_cast< ::google::protobuf::uint8>(13u)) {
 
-      // .deepflow.InitTruncatedNormalParam truncated_normal_param = 10;
-      case 10: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(82u)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_truncated_normal_param()));
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, &mean_)));
         } else {
           goto handle_unusual;
         }
         break;
       }
 
-      // .deepflow.InitGradientFillParam gradient_fill_param = 11;
-      case 11: {
+      // float stddev = 2;
+      case 2: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(90u)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_gradient_fill_param()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
+            static_cast< ::google::protobuf::uint8>(21u)) {
 
-      // .deepflow.InitConstantParam constant_param = 12;
-      case 12: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(98u)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_constant_param()));
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, &stddev_)));
         } else {
           goto handle_unusual;
         }
@@ -19648,283 +20670,349 @@ bool InitParam::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:deepflow.InitParam)
+  // @@protoc_insertion_point(parse_success:deepflow.InitRandomNormalParam)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:deepflow.InitParam)
+  // @@protoc_insertion_point(parse_failure:deepflow.InitRandomNormalParam)
   return false;
 #undef DO_
 }
 
-void InitParam::SerializeWithCachedSizes(
+void InitRandomNormalParam::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:deepflow.InitParam)
+  // @@protoc_insertion_point(serialize_start:deepflow.InitRandomNormalParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string name = 1;
-  if (this->name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->name().data(), this->name().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "deepflow.InitParam.name");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->name(), output);
-  }
-
-  // .deepflow.TensorParam tensor_param = 2;
-  if (this->has_tensor_param()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, *this->tensor_param_, output);
+  // float mean = 1;
+  if (this->mean() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(1, this->mean(), output);
   }
 
-  // .deepflow.TensorData init_data = 3;
-  if (this->has_init_data()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      3, *this->init_data_, output);
+  // float stddev = 2;
+  if (this->stddev() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(2, this->stddev(), output);
   }
 
-  // .deepflow.InitFillParam fill_param = 4;
-  if (this->has_fill_param()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      4, *this->fill_param_, output);
-  }
+  // @@protoc_insertion_point(serialize_end:deepflow.InitRandomNormalParam)
+}
 
-  // .deepflow.InitIndexFillParam index_fill_param = 5;
-  if (this->has_index_fill_param()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      5, *this->index_fill_param_, output);
-  }
+::google::protobuf::uint8* InitRandomNormalParam::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:deepflow.InitRandomNormalParam)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
 
-  // .deepflow.InitRandomUniformParam random_uniform_param = 6;
-  if (this->has_random_uniform_param()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      6, *this->random_uniform_param_, output);
+  // float mean = 1;
+  if (this->mean() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(1, this->mean(), target);
   }
 
-  // .deepflow.InitStepParam step_param = 7;
-  if (this->has_step_param()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      7, *this->step_param_, output);
+  // float stddev = 2;
+  if (this->stddev() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(2, this->stddev(), target);
   }
 
-  // .deepflow.InitRandomNormalParam random_normal_param = 8;
-  if (this->has_random_normal_param()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      8, *this->random_normal_param_, output);
-  }
+  // @@protoc_insertion_point(serialize_to_array_end:deepflow.InitRandomNormalParam)
+  return target;
+}
 
-  // .deepflow.InitThreeStateParam three_state_param = 9;
-  if (this->has_three_state_param()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      9, *this->three_state_param_, output);
-  }
+size_t InitRandomNormalParam::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:deepflow.InitRandomNormalParam)
+  size_t total_size = 0;
 
-  // .deepflow.InitTruncatedNormalParam truncated_normal_param = 10;
-  if (this->has_truncated_normal_param()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      10, *this->truncated_normal_param_, output);
+  // float mean = 1;
+  if (this->mean() != 0) {
+    total_size += 1 + 4;
   }
 
-  // .deepflow.InitGradientFillParam gradient_fill_param = 11;
-  if (this->has_gradient_fill_param()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      11, *this->gradient_fill_param_, output);
+  // float stddev = 2;
+  if (this->stddev() != 0) {
+    total_size += 1 + 4;
   }
 
-  // .deepflow.InitConstantParam constant_param = 12;
-  if (this->has_constant_param()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      12, *this->constant_param_, output);
-  }
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
 
-  // @@protoc_insertion_point(serialize_end:deepflow.InitParam)
+void InitRandomNormalParam::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:deepflow.InitRandomNormalParam)
+  GOOGLE_DCHECK_NE(&from, this);
+  const InitRandomNormalParam* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const InitRandomNormalParam>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.InitRandomNormalParam)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.InitRandomNormalParam)
+    MergeFrom(*source);
+  }
 }
 
-::google::protobuf::uint8* InitParam::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:deepflow.InitParam)
+void InitRandomNormalParam::MergeFrom(const InitRandomNormalParam& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.InitRandomNormalParam)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string name = 1;
-  if (this->name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->name().data(), this->name().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "deepflow.InitParam.name");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->name(), target);
+  if (from.mean() != 0) {
+    set_mean(from.mean());
   }
-
-  // .deepflow.TensorParam tensor_param = 2;
-  if (this->has_tensor_param()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageNoVirtualToArray(
-        2, *this->tensor_param_, deterministic, target);
+  if (from.stddev() != 0) {
+    set_stddev(from.stddev());
   }
+}
 
-  // .deepflow.TensorData init_data = 3;
-  if (this->has_init_data()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageNoVirtualToArray(
-        3, *this->init_data_, deterministic, target);
-  }
+void InitRandomNormalParam::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:deepflow.InitRandomNormalParam)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
 
-  // .deepflow.InitFillParam fill_param = 4;
-  if (this->has_fill_param()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageNoVirtualToArray(
-        4, *this->fill_param_, deterministic, target);
-  }
+void InitRandomNormalParam::CopyFrom(const InitRandomNormalParam& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.InitRandomNormalParam)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
 
-  // .deepflow.InitIndexFillParam index_fill_param = 5;
-  if (this->has_index_fill_param()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageNoVirtualToArray(
-        5, *this->index_fill_param_, deterministic, target);
-  }
+bool InitRandomNormalParam::IsInitialized() const {
+  return true;
+}
 
-  // .deepflow.InitRandomUniformParam random_uniform_param = 6;
-  if (this->has_random_uniform_param()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageNoVirtualToArray(
-        6, *this->random_uniform_param_, deterministic, target);
-  }
+void InitRandomNormalParam::Swap(InitRandomNormalParam* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void InitRandomNormalParam::InternalSwap(InitRandomNormalParam* other) {
+  std::swap(mean_, other->mean_);
+  std::swap(stddev_, other->stddev_);
+  std::swap(_cached_size_, other->_cached_size_);
+}
 
-  // .deepflow.InitStepParam step_param = 7;
-  if (this->has_step_param()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageNoVirtualToArray(
-        7, *this->step_param_, deterministic, target);
-  }
+::google::protobuf::Metadata InitRandomNormalParam::GetMetadata() const {
+  protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages];
+}
 
-  // .deepflow.InitRandomNormalParam random_normal_param = 8;
-  if (this->has_random_normal_param()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageNoVirtualToArray(
-        8, *this->random_normal_param_, deterministic, target);
-  }
+#if PROTOBUF_INLINE_NOT_IN_HEADERS
+// InitRandomNormalParam
 
-  // .deepflow.InitThreeStateParam three_state_param = 9;
-  if (this->has_three_state_param()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageNoVirtualToArray(
-        9, *this->three_state_param_, deterministic, target);
-  }
+// float mean = 1;
+void InitRandomNormalParam::clear_mean() {
+  mean_ = 0;
+}
+float InitRandomNormalParam::mean() const {
+  // @@protoc_insertion_point(field_get:deepflow.InitRandomNormalParam.mean)
+  return mean_;
+}
+void InitRandomNormalParam::set_mean(float value) {
+  
+  mean_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.InitRandomNormalParam.mean)
+}
 
-  // .deepflow.InitTruncatedNormalParam truncated_normal_param = 10;
-  if (this->has_truncated_normal_param()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageNoVirtualToArray(
-        10, *this->truncated_normal_param_, deterministic, target);
-  }
+// float stddev = 2;
+void InitRandomNormalParam::clear_stddev() {
+  stddev_ = 0;
+}
+float InitRandomNormalParam::stddev() const {
+  // @@protoc_insertion_point(field_get:deepflow.InitRandomNormalParam.stddev)
+  return stddev_;
+}
+void InitRandomNormalParam::set_stddev(float value) {
+  
+  stddev_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.InitRandomNormalParam.stddev)
+}
 
-  // .deepflow.InitGradientFillParam gradient_fill_param = 11;
-  if (this->has_gradient_fill_param()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageNoVirtualToArray(
-        11, *this->gradient_fill_param_, deterministic, target);
-  }
+#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
-  // .deepflow.InitConstantParam constant_param = 12;
-  if (this->has_constant_param()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageNoVirtualToArray(
-        12, *this->constant_param_, deterministic, target);
+// ===================================================================
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int InitTruncatedNormalParam::kMeanFieldNumber;
+const int InitTruncatedNormalParam::kStddevFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+InitTruncatedNormalParam::InitTruncatedNormalParam()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    protobuf_deepflow_2eproto::InitDefaults();
   }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:deepflow.InitTruncatedNormalParam)
+}
+InitTruncatedNormalParam::InitTruncatedNormalParam(const InitTruncatedNormalParam& from)
+  : ::google::protobuf::Message(),
+      _internal_metadata_(NULL),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::memcpy(&mean_, &from.mean_,
+    reinterpret_cast<char*>(&stddev_) -
+    reinterpret_cast<char*>(&mean_) + sizeof(stddev_));
+  // @@protoc_insertion_point(copy_constructor:deepflow.InitTruncatedNormalParam)
+}
 
-  // @@protoc_insertion_point(serialize_to_array_end:deepflow.InitParam)
-  return target;
+void InitTruncatedNormalParam::SharedCtor() {
+  ::memset(&mean_, 0, reinterpret_cast<char*>(&stddev_) -
+    reinterpret_cast<char*>(&mean_) + sizeof(stddev_));
+  _cached_size_ = 0;
 }
 
-size_t InitParam::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:deepflow.InitParam)
-  size_t total_size = 0;
+InitTruncatedNormalParam::~InitTruncatedNormalParam() {
+  // @@protoc_insertion_point(destructor:deepflow.InitTruncatedNormalParam)
+  SharedDtor();
+}
 
-  // string name = 1;
-  if (this->name().size() > 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->name());
-  }
+void InitTruncatedNormalParam::SharedDtor() {
+}
 
-  // .deepflow.TensorParam tensor_param = 2;
-  if (this->has_tensor_param()) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        *this->tensor_param_);
-  }
+void InitTruncatedNormalParam::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* InitTruncatedNormalParam::descriptor() {
+  protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+}
 
-  // .deepflow.TensorData init_data = 3;
-  if (this->has_init_data()) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        *this->init_data_);
-  }
+const InitTruncatedNormalParam& InitTruncatedNormalParam::default_instance() {
+  protobuf_deepflow_2eproto::InitDefaults();
+  return *internal_default_instance();
+}
 
-  // .deepflow.InitFillParam fill_param = 4;
-  if (this->has_fill_param()) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        *this->fill_param_);
+InitTruncatedNormalParam* InitTruncatedNormalParam::New(::google::protobuf::Arena* arena) const {
+  InitTruncatedNormalParam* n = new InitTruncatedNormalParam;
+  if (arena != NULL) {
+    arena->Own(n);
   }
+  return n;
+}
 
-  // .deepflow.InitIndexFillParam index_fill_param = 5;
-  if (this->has_index_fill_param()) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        *this->index_fill_param_);
-  }
+void InitTruncatedNormalParam::Clear() {
+// @@protoc_insertion_point(message_clear_start:deepflow.InitTruncatedNormalParam)
+  ::memset(&mean_, 0, reinterpret_cast<char*>(&stddev_) -
+    reinterpret_cast<char*>(&mean_) + sizeof(stddev_));
+}
 
-  // .deepflow.InitRandomUniformParam random_uniform_param = 6;
-  if (this->has_random_uniform_param()) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        *this->random_uniform_param_);
+bool InitTruncatedNormalParam::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:deepflow.InitTruncatedNormalParam)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // float mean = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(13u)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, &mean_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // float stddev = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(21u)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, &stddev_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0 ||
+            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
+        break;
+      }
+    }
   }
+success:
+  // @@protoc_insertion_point(parse_success:deepflow.InitTruncatedNormalParam)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:deepflow.InitTruncatedNormalParam)
+  return false;
+#undef DO_
+}
 
-  // .deepflow.InitStepParam step_param = 7;
-  if (this->has_step_param()) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        *this->step_param_);
+void InitTruncatedNormalParam::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:deepflow.InitTruncatedNormalParam)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // float mean = 1;
+  if (this->mean() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(1, this->mean(), output);
   }
 
-  // .deepflow.InitRandomNormalParam random_normal_param = 8;
-  if (this->has_random_normal_param()) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        *this->random_normal_param_);
+  // float stddev = 2;
+  if (this->stddev() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(2, this->stddev(), output);
   }
 
-  // .deepflow.InitThreeStateParam three_state_param = 9;
-  if (this->has_three_state_param()) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        *this->three_state_param_);
+  // @@protoc_insertion_point(serialize_end:deepflow.InitTruncatedNormalParam)
+}
+
+::google::protobuf::uint8* InitTruncatedNormalParam::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:deepflow.InitTruncatedNormalParam)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // float mean = 1;
+  if (this->mean() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(1, this->mean(), target);
   }
 
-  // .deepflow.InitTruncatedNormalParam truncated_normal_param = 10;
-  if (this->has_truncated_normal_param()) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        *this->truncated_normal_param_);
+  // float stddev = 2;
+  if (this->stddev() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(2, this->stddev(), target);
   }
 
-  // .deepflow.InitGradientFillParam gradient_fill_param = 11;
-  if (this->has_gradient_fill_param()) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        *this->gradient_fill_param_);
+  // @@protoc_insertion_point(serialize_to_array_end:deepflow.InitTruncatedNormalParam)
+  return target;
+}
+
+size_t InitTruncatedNormalParam::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:deepflow.InitTruncatedNormalParam)
+  size_t total_size = 0;
+
+  // float mean = 1;
+  if (this->mean() != 0) {
+    total_size += 1 + 4;
   }
 
-  // .deepflow.InitConstantParam constant_param = 12;
-  if (this->has_constant_param()) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        *this->constant_param_);
+  // float stddev = 2;
+  if (this->stddev() != 0) {
+    total_size += 1 + 4;
   }
 
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
@@ -19934,138 +21022,1633 @@ size_t InitParam::ByteSizeLong() const {
   return total_size;
 }
 
-void InitParam::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:deepflow.InitParam)
+void InitTruncatedNormalParam::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:deepflow.InitTruncatedNormalParam)
   GOOGLE_DCHECK_NE(&from, this);
-  const InitParam* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const InitParam>(
+  const InitTruncatedNormalParam* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const InitTruncatedNormalParam>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.InitParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.InitTruncatedNormalParam)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.InitParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.InitTruncatedNormalParam)
     MergeFrom(*source);
   }
 }
 
-void InitParam::MergeFrom(const InitParam& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.InitParam)
+void InitTruncatedNormalParam::MergeFrom(const InitTruncatedNormalParam& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.InitTruncatedNormalParam)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.name().size() > 0) {
-
-    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
-  }
-  if (from.has_tensor_param()) {
-    mutable_tensor_param()->::deepflow::TensorParam::MergeFrom(from.tensor_param());
-  }
-  if (from.has_init_data()) {
-    mutable_init_data()->::deepflow::TensorData::MergeFrom(from.init_data());
-  }
-  if (from.has_fill_param()) {
-    mutable_fill_param()->::deepflow::InitFillParam::MergeFrom(from.fill_param());
-  }
-  if (from.has_index_fill_param()) {
-    mutable_index_fill_param()->::deepflow::InitIndexFillParam::MergeFrom(from.index_fill_param());
-  }
-  if (from.has_random_uniform_param()) {
-    mutable_random_uniform_param()->::deepflow::InitRandomUniformParam::MergeFrom(from.random_uniform_param());
-  }
-  if (from.has_step_param()) {
-    mutable_step_param()->::deepflow::InitStepParam::MergeFrom(from.step_param());
-  }
-  if (from.has_random_normal_param()) {
-    mutable_random_normal_param()->::deepflow::InitRandomNormalParam::MergeFrom(from.random_normal_param());
-  }
-  if (from.has_three_state_param()) {
-    mutable_three_state_param()->::deepflow::InitThreeStateParam::MergeFrom(from.three_state_param());
-  }
-  if (from.has_truncated_normal_param()) {
-    mutable_truncated_normal_param()->::deepflow::InitTruncatedNormalParam::MergeFrom(from.truncated_normal_param());
-  }
-  if (from.has_gradient_fill_param()) {
-    mutable_gradient_fill_param()->::deepflow::InitGradientFillParam::MergeFrom(from.gradient_fill_param());
+  if (from.mean() != 0) {
+    set_mean(from.mean());
   }
-  if (from.has_constant_param()) {
-    mutable_constant_param()->::deepflow::InitConstantParam::MergeFrom(from.constant_param());
+  if (from.stddev() != 0) {
+    set_stddev(from.stddev());
   }
 }
 
-void InitParam::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:deepflow.InitParam)
+void InitTruncatedNormalParam::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:deepflow.InitTruncatedNormalParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void InitParam::CopyFrom(const InitParam& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.InitParam)
+void InitTruncatedNormalParam::CopyFrom(const InitTruncatedNormalParam& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.InitTruncatedNormalParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool InitParam::IsInitialized() const {
+bool InitTruncatedNormalParam::IsInitialized() const {
   return true;
 }
 
-void InitParam::Swap(InitParam* other) {
+void InitTruncatedNormalParam::Swap(InitTruncatedNormalParam* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void InitParam::InternalSwap(InitParam* other) {
-  name_.Swap(&other->name_);
-  std::swap(tensor_param_, other->tensor_param_);
-  std::swap(init_data_, other->init_data_);
-  std::swap(fill_param_, other->fill_param_);
-  std::swap(index_fill_param_, other->index_fill_param_);
-  std::swap(random_uniform_param_, other->random_uniform_param_);
-  std::swap(step_param_, other->step_param_);
-  std::swap(random_normal_param_, other->random_normal_param_);
-  std::swap(three_state_param_, other->three_state_param_);
-  std::swap(truncated_normal_param_, other->truncated_normal_param_);
-  std::swap(gradient_fill_param_, other->gradient_fill_param_);
-  std::swap(constant_param_, other->constant_param_);
+void InitTruncatedNormalParam::InternalSwap(InitTruncatedNormalParam* other) {
+  std::swap(mean_, other->mean_);
+  std::swap(stddev_, other->stddev_);
   std::swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata InitParam::GetMetadata() const {
+::google::protobuf::Metadata InitTruncatedNormalParam::GetMetadata() const {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// InitParam
+// InitTruncatedNormalParam
 
-// string name = 1;
-void InitParam::clear_name() {
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// float mean = 1;
+void InitTruncatedNormalParam::clear_mean() {
+  mean_ = 0;
 }
-const ::std::string& InitParam::name() const {
-  // @@protoc_insertion_point(field_get:deepflow.InitParam.name)
-  return name_.GetNoArena();
+float InitTruncatedNormalParam::mean() const {
+  // @@protoc_insertion_point(field_get:deepflow.InitTruncatedNormalParam.mean)
+  return mean_;
 }
-void InitParam::set_name(const ::std::string& value) {
+void InitTruncatedNormalParam::set_mean(float value) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:deepflow.InitParam.name)
+  mean_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.InitTruncatedNormalParam.mean)
 }
-#if LANG_CXX11
-void InitParam::set_name(::std::string&& value) {
-  
-  name_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:deepflow.InitParam.name)
+
+// float stddev = 2;
+void InitTruncatedNormalParam::clear_stddev() {
+  stddev_ = 0;
 }
-#endif
-void InitParam::set_name(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+float InitTruncatedNormalParam::stddev() const {
+  // @@protoc_insertion_point(field_get:deepflow.InitTruncatedNormalParam.stddev)
+  return stddev_;
+}
+void InitTruncatedNormalParam::set_stddev(float value) {
+  
+  stddev_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.InitTruncatedNormalParam.stddev)
+}
+
+#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
+
+// ===================================================================
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int InitStepParam::kMinFieldNumber;
+const int InitStepParam::kMaxFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+InitStepParam::InitStepParam()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    protobuf_deepflow_2eproto::InitDefaults();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:deepflow.InitStepParam)
+}
+InitStepParam::InitStepParam(const InitStepParam& from)
+  : ::google::protobuf::Message(),
+      _internal_metadata_(NULL),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::memcpy(&min_, &from.min_,
+    reinterpret_cast<char*>(&max_) -
+    reinterpret_cast<char*>(&min_) + sizeof(max_));
+  // @@protoc_insertion_point(copy_constructor:deepflow.InitStepParam)
+}
+
+void InitStepParam::SharedCtor() {
+  ::memset(&min_, 0, reinterpret_cast<char*>(&max_) -
+    reinterpret_cast<char*>(&min_) + sizeof(max_));
+  _cached_size_ = 0;
+}
+
+InitStepParam::~InitStepParam() {
+  // @@protoc_insertion_point(destructor:deepflow.InitStepParam)
+  SharedDtor();
+}
+
+void InitStepParam::SharedDtor() {
+}
+
+void InitStepParam::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* InitStepParam::descriptor() {
+  protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+}
+
+const InitStepParam& InitStepParam::default_instance() {
+  protobuf_deepflow_2eproto::InitDefaults();
+  return *internal_default_instance();
+}
+
+InitStepParam* InitStepParam::New(::google::protobuf::Arena* arena) const {
+  InitStepParam* n = new InitStepParam;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void InitStepParam::Clear() {
+// @@protoc_insertion_point(message_clear_start:deepflow.InitStepParam)
+  ::memset(&min_, 0, reinterpret_cast<char*>(&max_) -
+    reinterpret_cast<char*>(&min_) + sizeof(max_));
+}
+
+bool InitStepParam::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:deepflow.InitStepParam)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // float min = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(13u)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, &min_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // float max = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(21u)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, &max_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0 ||
+            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:deepflow.InitStepParam)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:deepflow.InitStepParam)
+  return false;
+#undef DO_
+}
+
+void InitStepParam::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:deepflow.InitStepParam)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // float min = 1;
+  if (this->min() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(1, this->min(), output);
+  }
+
+  // float max = 2;
+  if (this->max() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(2, this->max(), output);
+  }
+
+  // @@protoc_insertion_point(serialize_end:deepflow.InitStepParam)
+}
+
+::google::protobuf::uint8* InitStepParam::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:deepflow.InitStepParam)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // float min = 1;
+  if (this->min() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(1, this->min(), target);
+  }
+
+  // float max = 2;
+  if (this->max() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(2, this->max(), target);
+  }
+
+  // @@protoc_insertion_point(serialize_to_array_end:deepflow.InitStepParam)
+  return target;
+}
+
+size_t InitStepParam::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:deepflow.InitStepParam)
+  size_t total_size = 0;
+
+  // float min = 1;
+  if (this->min() != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float max = 2;
+  if (this->max() != 0) {
+    total_size += 1 + 4;
+  }
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void InitStepParam::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:deepflow.InitStepParam)
+  GOOGLE_DCHECK_NE(&from, this);
+  const InitStepParam* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const InitStepParam>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.InitStepParam)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.InitStepParam)
+    MergeFrom(*source);
+  }
+}
+
+void InitStepParam::MergeFrom(const InitStepParam& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.InitStepParam)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.min() != 0) {
+    set_min(from.min());
+  }
+  if (from.max() != 0) {
+    set_max(from.max());
+  }
+}
+
+void InitStepParam::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:deepflow.InitStepParam)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void InitStepParam::CopyFrom(const InitStepParam& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.InitStepParam)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool InitStepParam::IsInitialized() const {
+  return true;
+}
+
+void InitStepParam::Swap(InitStepParam* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void InitStepParam::InternalSwap(InitStepParam* other) {
+  std::swap(min_, other->min_);
+  std::swap(max_, other->max_);
+  std::swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata InitStepParam::GetMetadata() const {
+  protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages];
+}
+
+#if PROTOBUF_INLINE_NOT_IN_HEADERS
+// InitStepParam
+
+// float min = 1;
+void InitStepParam::clear_min() {
+  min_ = 0;
+}
+float InitStepParam::min() const {
+  // @@protoc_insertion_point(field_get:deepflow.InitStepParam.min)
+  return min_;
+}
+void InitStepParam::set_min(float value) {
+  
+  min_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.InitStepParam.min)
+}
+
+// float max = 2;
+void InitStepParam::clear_max() {
+  max_ = 0;
+}
+float InitStepParam::max() const {
+  // @@protoc_insertion_point(field_get:deepflow.InitStepParam.max)
+  return max_;
+}
+void InitStepParam::set_max(float value) {
+  
+  max_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.InitStepParam.max)
+}
+
+#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
+
+// ===================================================================
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+InitThreeStateParam::InitThreeStateParam()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    protobuf_deepflow_2eproto::InitDefaults();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:deepflow.InitThreeStateParam)
+}
+InitThreeStateParam::InitThreeStateParam(const InitThreeStateParam& from)
+  : ::google::protobuf::Message(),
+      _internal_metadata_(NULL),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:deepflow.InitThreeStateParam)
+}
+
+void InitThreeStateParam::SharedCtor() {
+  _cached_size_ = 0;
+}
+
+InitThreeStateParam::~InitThreeStateParam() {
+  // @@protoc_insertion_point(destructor:deepflow.InitThreeStateParam)
+  SharedDtor();
+}
+
+void InitThreeStateParam::SharedDtor() {
+}
+
+void InitThreeStateParam::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* InitThreeStateParam::descriptor() {
+  protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+}
+
+const InitThreeStateParam& InitThreeStateParam::default_instance() {
+  protobuf_deepflow_2eproto::InitDefaults();
+  return *internal_default_instance();
+}
+
+InitThreeStateParam* InitThreeStateParam::New(::google::protobuf::Arena* arena) const {
+  InitThreeStateParam* n = new InitThreeStateParam;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void InitThreeStateParam::Clear() {
+// @@protoc_insertion_point(message_clear_start:deepflow.InitThreeStateParam)
+}
+
+bool InitThreeStateParam::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:deepflow.InitThreeStateParam)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+  handle_unusual:
+    if (tag == 0 ||
+        ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+        ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+      goto success;
+    }
+    DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
+  }
+success:
+  // @@protoc_insertion_point(parse_success:deepflow.InitThreeStateParam)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:deepflow.InitThreeStateParam)
+  return false;
+#undef DO_
+}
+
+void InitThreeStateParam::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:deepflow.InitThreeStateParam)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // @@protoc_insertion_point(serialize_end:deepflow.InitThreeStateParam)
+}
+
+::google::protobuf::uint8* InitThreeStateParam::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:deepflow.InitThreeStateParam)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // @@protoc_insertion_point(serialize_to_array_end:deepflow.InitThreeStateParam)
+  return target;
+}
+
+size_t InitThreeStateParam::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:deepflow.InitThreeStateParam)
+  size_t total_size = 0;
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void InitThreeStateParam::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:deepflow.InitThreeStateParam)
+  GOOGLE_DCHECK_NE(&from, this);
+  const InitThreeStateParam* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const InitThreeStateParam>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.InitThreeStateParam)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.InitThreeStateParam)
+    MergeFrom(*source);
+  }
+}
+
+void InitThreeStateParam::MergeFrom(const InitThreeStateParam& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.InitThreeStateParam)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+}
+
+void InitThreeStateParam::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:deepflow.InitThreeStateParam)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void InitThreeStateParam::CopyFrom(const InitThreeStateParam& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.InitThreeStateParam)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool InitThreeStateParam::IsInitialized() const {
+  return true;
+}
+
+void InitThreeStateParam::Swap(InitThreeStateParam* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void InitThreeStateParam::InternalSwap(InitThreeStateParam* other) {
+  std::swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata InitThreeStateParam::GetMetadata() const {
+  protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages];
+}
+
+#if PROTOBUF_INLINE_NOT_IN_HEADERS
+// InitThreeStateParam
+
+#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
+
+// ===================================================================
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int InitConstantParam::kValuesFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+InitConstantParam::InitConstantParam()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    protobuf_deepflow_2eproto::InitDefaults();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:deepflow.InitConstantParam)
+}
+InitConstantParam::InitConstantParam(const InitConstantParam& from)
+  : ::google::protobuf::Message(),
+      _internal_metadata_(NULL),
+      values_(from.values_),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:deepflow.InitConstantParam)
+}
+
+void InitConstantParam::SharedCtor() {
+  _cached_size_ = 0;
+}
+
+InitConstantParam::~InitConstantParam() {
+  // @@protoc_insertion_point(destructor:deepflow.InitConstantParam)
+  SharedDtor();
+}
+
+void InitConstantParam::SharedDtor() {
+}
+
+void InitConstantParam::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* InitConstantParam::descriptor() {
+  protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+}
+
+const InitConstantParam& InitConstantParam::default_instance() {
+  protobuf_deepflow_2eproto::InitDefaults();
+  return *internal_default_instance();
+}
+
+InitConstantParam* InitConstantParam::New(::google::protobuf::Arena* arena) const {
+  InitConstantParam* n = new InitConstantParam;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void InitConstantParam::Clear() {
+// @@protoc_insertion_point(message_clear_start:deepflow.InitConstantParam)
+  values_.Clear();
+}
+
+bool InitConstantParam::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:deepflow.InitConstantParam)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // repeated float values = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(10u)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, this->mutable_values())));
+        } else if (static_cast< ::google::protobuf::uint8>(tag) ==
+                   static_cast< ::google::protobuf::uint8>(13u)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 1, 10u, input, this->mutable_values())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0 ||
+            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:deepflow.InitConstantParam)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:deepflow.InitConstantParam)
+  return false;
+#undef DO_
+}
+
+void InitConstantParam::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:deepflow.InitConstantParam)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated float values = 1;
+  if (this->values_size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteTag(1, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(_values_cached_byte_size_);
+    ::google::protobuf::internal::WireFormatLite::WriteFloatArray(
+      this->values().data(), this->values_size(), output);
+  }
+
+  // @@protoc_insertion_point(serialize_end:deepflow.InitConstantParam)
+}
+
+::google::protobuf::uint8* InitConstantParam::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:deepflow.InitConstantParam)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated float values = 1;
+  if (this->values_size() > 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
+      1,
+      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
+      _values_cached_byte_size_, target);
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteFloatNoTagToArray(this->values_, target);
+  }
+
+  // @@protoc_insertion_point(serialize_to_array_end:deepflow.InitConstantParam)
+  return target;
+}
+
+size_t InitConstantParam::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:deepflow.InitConstantParam)
+  size_t total_size = 0;
+
+  // repeated float values = 1;
+  {
+    unsigned int count = this->values_size();
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
+    }
+    int cached_size = ::google::protobuf::internal::ToCachedSize(data_size);
+    GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+    _values_cached_byte_size_ = cached_size;
+    GOOGLE_SAFE_CONCURRENT_WRITES_END();
+    total_size += data_size;
+  }
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void InitConstantParam::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:deepflow.InitConstantParam)
+  GOOGLE_DCHECK_NE(&from, this);
+  const InitConstantParam* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const InitConstantParam>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.InitConstantParam)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.InitConstantParam)
+    MergeFrom(*source);
+  }
+}
+
+void InitConstantParam::MergeFrom(const InitConstantParam& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.InitConstantParam)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  values_.MergeFrom(from.values_);
+}
+
+void InitConstantParam::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:deepflow.InitConstantParam)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void InitConstantParam::CopyFrom(const InitConstantParam& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.InitConstantParam)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool InitConstantParam::IsInitialized() const {
+  return true;
+}
+
+void InitConstantParam::Swap(InitConstantParam* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void InitConstantParam::InternalSwap(InitConstantParam* other) {
+  values_.InternalSwap(&other->values_);
+  std::swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata InitConstantParam::GetMetadata() const {
+  protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages];
+}
+
+#if PROTOBUF_INLINE_NOT_IN_HEADERS
+// InitConstantParam
+
+// repeated float values = 1;
+int InitConstantParam::values_size() const {
+  return values_.size();
+}
+void InitConstantParam::clear_values() {
+  values_.Clear();
+}
+float InitConstantParam::values(int index) const {
+  // @@protoc_insertion_point(field_get:deepflow.InitConstantParam.values)
+  return values_.Get(index);
+}
+void InitConstantParam::set_values(int index, float value) {
+  values_.Set(index, value);
+  // @@protoc_insertion_point(field_set:deepflow.InitConstantParam.values)
+}
+void InitConstantParam::add_values(float value) {
+  values_.Add(value);
+  // @@protoc_insertion_point(field_add:deepflow.InitConstantParam.values)
+}
+const ::google::protobuf::RepeatedField< float >&
+InitConstantParam::values() const {
+  // @@protoc_insertion_point(field_list:deepflow.InitConstantParam.values)
+  return values_;
+}
+::google::protobuf::RepeatedField< float >*
+InitConstantParam::mutable_values() {
+  // @@protoc_insertion_point(field_mutable_list:deepflow.InitConstantParam.values)
+  return &values_;
+}
+
+#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
+
+// ===================================================================
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int InitParam::kNameFieldNumber;
+const int InitParam::kTensorParamFieldNumber;
+const int InitParam::kInitDataFieldNumber;
+const int InitParam::kFillParamFieldNumber;
+const int InitParam::kIndexFillParamFieldNumber;
+const int InitParam::kRandomUniformParamFieldNumber;
+const int InitParam::kStepParamFieldNumber;
+const int InitParam::kRandomNormalParamFieldNumber;
+const int InitParam::kThreeStateParamFieldNumber;
+const int InitParam::kTruncatedNormalParamFieldNumber;
+const int InitParam::kGradientFillParamFieldNumber;
+const int InitParam::kConstantParamFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+InitParam::InitParam()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    protobuf_deepflow_2eproto::InitDefaults();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:deepflow.InitParam)
+}
+InitParam::InitParam(const InitParam& from)
+  : ::google::protobuf::Message(),
+      _internal_metadata_(NULL),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.name().size() > 0) {
+    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
+  }
+  if (from.has_tensor_param()) {
+    tensor_param_ = new ::deepflow::TensorParam(*from.tensor_param_);
+  } else {
+    tensor_param_ = NULL;
+  }
+  if (from.has_init_data()) {
+    init_data_ = new ::deepflow::TensorData(*from.init_data_);
+  } else {
+    init_data_ = NULL;
+  }
+  if (from.has_fill_param()) {
+    fill_param_ = new ::deepflow::InitFillParam(*from.fill_param_);
+  } else {
+    fill_param_ = NULL;
+  }
+  if (from.has_index_fill_param()) {
+    index_fill_param_ = new ::deepflow::InitIndexFillParam(*from.index_fill_param_);
+  } else {
+    index_fill_param_ = NULL;
+  }
+  if (from.has_random_uniform_param()) {
+    random_uniform_param_ = new ::deepflow::InitRandomUniformParam(*from.random_uniform_param_);
+  } else {
+    random_uniform_param_ = NULL;
+  }
+  if (from.has_step_param()) {
+    step_param_ = new ::deepflow::InitStepParam(*from.step_param_);
+  } else {
+    step_param_ = NULL;
+  }
+  if (from.has_random_normal_param()) {
+    random_normal_param_ = new ::deepflow::InitRandomNormalParam(*from.random_normal_param_);
+  } else {
+    random_normal_param_ = NULL;
+  }
+  if (from.has_three_state_param()) {
+    three_state_param_ = new ::deepflow::InitThreeStateParam(*from.three_state_param_);
+  } else {
+    three_state_param_ = NULL;
+  }
+  if (from.has_truncated_normal_param()) {
+    truncated_normal_param_ = new ::deepflow::InitTruncatedNormalParam(*from.truncated_normal_param_);
+  } else {
+    truncated_normal_param_ = NULL;
+  }
+  if (from.has_gradient_fill_param()) {
+    gradient_fill_param_ = new ::deepflow::InitGradientFillParam(*from.gradient_fill_param_);
+  } else {
+    gradient_fill_param_ = NULL;
+  }
+  if (from.has_constant_param()) {
+    constant_param_ = new ::deepflow::InitConstantParam(*from.constant_param_);
+  } else {
+    constant_param_ = NULL;
+  }
+  // @@protoc_insertion_point(copy_constructor:deepflow.InitParam)
+}
+
+void InitParam::SharedCtor() {
+  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::memset(&tensor_param_, 0, reinterpret_cast<char*>(&constant_param_) -
+    reinterpret_cast<char*>(&tensor_param_) + sizeof(constant_param_));
+  _cached_size_ = 0;
+}
+
+InitParam::~InitParam() {
+  // @@protoc_insertion_point(destructor:deepflow.InitParam)
+  SharedDtor();
+}
+
+void InitParam::SharedDtor() {
+  name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (this != internal_default_instance()) {
+    delete tensor_param_;
+  }
+  if (this != internal_default_instance()) {
+    delete init_data_;
+  }
+  if (this != internal_default_instance()) {
+    delete fill_param_;
+  }
+  if (this != internal_default_instance()) {
+    delete index_fill_param_;
+  }
+  if (this != internal_default_instance()) {
+    delete random_uniform_param_;
+  }
+  if (this != internal_default_instance()) {
+    delete step_param_;
+  }
+  if (this != internal_default_instance()) {
+    delete random_normal_param_;
+  }
+  if (this != internal_default_instance()) {
+    delete three_state_param_;
+  }
+  if (this != internal_default_instance()) {
+    delete truncated_normal_param_;
+  }
+  if (this != internal_default_instance()) {
+    delete gradient_fill_param_;
+  }
+  if (this != internal_default_instance()) {
+    delete constant_param_;
+  }
+}
+
+void InitParam::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* InitParam::descriptor() {
+  protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+}
+
+const InitParam& InitParam::default_instance() {
+  protobuf_deepflow_2eproto::InitDefaults();
+  return *internal_default_instance();
+}
+
+InitParam* InitParam::New(::google::protobuf::Arena* arena) const {
+  InitParam* n = new InitParam;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void InitParam::Clear() {
+// @@protoc_insertion_point(message_clear_start:deepflow.InitParam)
+  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (GetArenaNoVirtual() == NULL && tensor_param_ != NULL) {
+    delete tensor_param_;
+  }
+  tensor_param_ = NULL;
+  if (GetArenaNoVirtual() == NULL && init_data_ != NULL) {
+    delete init_data_;
+  }
+  init_data_ = NULL;
+  if (GetArenaNoVirtual() == NULL && fill_param_ != NULL) {
+    delete fill_param_;
+  }
+  fill_param_ = NULL;
+  if (GetArenaNoVirtual() == NULL && index_fill_param_ != NULL) {
+    delete index_fill_param_;
+  }
+  index_fill_param_ = NULL;
+  if (GetArenaNoVirtual() == NULL && random_uniform_param_ != NULL) {
+    delete random_uniform_param_;
+  }
+  random_uniform_param_ = NULL;
+  if (GetArenaNoVirtual() == NULL && step_param_ != NULL) {
+    delete step_param_;
+  }
+  step_param_ = NULL;
+  if (GetArenaNoVirtual() == NULL && random_normal_param_ != NULL) {
+    delete random_normal_param_;
+  }
+  random_normal_param_ = NULL;
+  if (GetArenaNoVirtual() == NULL && three_state_param_ != NULL) {
+    delete three_state_param_;
+  }
+  three_state_param_ = NULL;
+  if (GetArenaNoVirtual() == NULL && truncated_normal_param_ != NULL) {
+    delete truncated_normal_param_;
+  }
+  truncated_normal_param_ = NULL;
+  if (GetArenaNoVirtual() == NULL && gradient_fill_param_ != NULL) {
+    delete gradient_fill_param_;
+  }
+  gradient_fill_param_ = NULL;
+  if (GetArenaNoVirtual() == NULL && constant_param_ != NULL) {
+    delete constant_param_;
+  }
+  constant_param_ = NULL;
+}
+
+bool InitParam::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:deepflow.InitParam)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // string name = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(10u)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_name()));
+          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            this->name().data(), this->name().length(),
+            ::google::protobuf::internal::WireFormatLite::PARSE,
+            "deepflow.InitParam.name"));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .deepflow.TensorParam tensor_param = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(18u)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_tensor_param()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .deepflow.TensorData init_data = 3;
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(26u)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_init_data()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .deepflow.InitFillParam fill_param = 4;
+      case 4: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(34u)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_fill_param()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .deepflow.InitIndexFillParam index_fill_param = 5;
+      case 5: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(42u)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_index_fill_param()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .deepflow.InitRandomUniformParam random_uniform_param = 6;
+      case 6: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(50u)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_random_uniform_param()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .deepflow.InitStepParam step_param = 7;
+      case 7: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(58u)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_step_param()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .deepflow.InitRandomNormalParam random_normal_param = 8;
+      case 8: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(66u)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_random_normal_param()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .deepflow.InitThreeStateParam three_state_param = 9;
+      case 9: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(74u)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_three_state_param()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .deepflow.InitTruncatedNormalParam truncated_normal_param = 10;
+      case 10: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(82u)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_truncated_normal_param()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .deepflow.InitGradientFillParam gradient_fill_param = 11;
+      case 11: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(90u)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_gradient_fill_param()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .deepflow.InitConstantParam constant_param = 12;
+      case 12: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(98u)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_constant_param()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0 ||
+            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:deepflow.InitParam)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:deepflow.InitParam)
+  return false;
+#undef DO_
+}
+
+void InitParam::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:deepflow.InitParam)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (this->name().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->name().data(), this->name().length(),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "deepflow.InitParam.name");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      1, this->name(), output);
+  }
+
+  // .deepflow.TensorParam tensor_param = 2;
+  if (this->has_tensor_param()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      2, *this->tensor_param_, output);
+  }
+
+  // .deepflow.TensorData init_data = 3;
+  if (this->has_init_data()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      3, *this->init_data_, output);
+  }
+
+  // .deepflow.InitFillParam fill_param = 4;
+  if (this->has_fill_param()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      4, *this->fill_param_, output);
+  }
+
+  // .deepflow.InitIndexFillParam index_fill_param = 5;
+  if (this->has_index_fill_param()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      5, *this->index_fill_param_, output);
+  }
+
+  // .deepflow.InitRandomUniformParam random_uniform_param = 6;
+  if (this->has_random_uniform_param()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      6, *this->random_uniform_param_, output);
+  }
+
+  // .deepflow.InitStepParam step_param = 7;
+  if (this->has_step_param()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      7, *this->step_param_, output);
+  }
+
+  // .deepflow.InitRandomNormalParam random_normal_param = 8;
+  if (this->has_random_normal_param()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      8, *this->random_normal_param_, output);
+  }
+
+  // .deepflow.InitThreeStateParam three_state_param = 9;
+  if (this->has_three_state_param()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      9, *this->three_state_param_, output);
+  }
+
+  // .deepflow.InitTruncatedNormalParam truncated_normal_param = 10;
+  if (this->has_truncated_normal_param()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      10, *this->truncated_normal_param_, output);
+  }
+
+  // .deepflow.InitGradientFillParam gradient_fill_param = 11;
+  if (this->has_gradient_fill_param()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      11, *this->gradient_fill_param_, output);
+  }
+
+  // .deepflow.InitConstantParam constant_param = 12;
+  if (this->has_constant_param()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      12, *this->constant_param_, output);
+  }
+
+  // @@protoc_insertion_point(serialize_end:deepflow.InitParam)
+}
+
+::google::protobuf::uint8* InitParam::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:deepflow.InitParam)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (this->name().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->name().data(), this->name().length(),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "deepflow.InitParam.name");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        1, this->name(), target);
+  }
+
+  // .deepflow.TensorParam tensor_param = 2;
+  if (this->has_tensor_param()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        2, *this->tensor_param_, deterministic, target);
+  }
+
+  // .deepflow.TensorData init_data = 3;
+  if (this->has_init_data()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        3, *this->init_data_, deterministic, target);
+  }
+
+  // .deepflow.InitFillParam fill_param = 4;
+  if (this->has_fill_param()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        4, *this->fill_param_, deterministic, target);
+  }
+
+  // .deepflow.InitIndexFillParam index_fill_param = 5;
+  if (this->has_index_fill_param()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        5, *this->index_fill_param_, deterministic, target);
+  }
+
+  // .deepflow.InitRandomUniformParam random_uniform_param = 6;
+  if (this->has_random_uniform_param()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        6, *this->random_uniform_param_, deterministic, target);
+  }
+
+  // .deepflow.InitStepParam step_param = 7;
+  if (this->has_step_param()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        7, *this->step_param_, deterministic, target);
+  }
+
+  // .deepflow.InitRandomNormalParam random_normal_param = 8;
+  if (this->has_random_normal_param()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        8, *this->random_normal_param_, deterministic, target);
+  }
+
+  // .deepflow.InitThreeStateParam three_state_param = 9;
+  if (this->has_three_state_param()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        9, *this->three_state_param_, deterministic, target);
+  }
+
+  // .deepflow.InitTruncatedNormalParam truncated_normal_param = 10;
+  if (this->has_truncated_normal_param()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        10, *this->truncated_normal_param_, deterministic, target);
+  }
+
+  // .deepflow.InitGradientFillParam gradient_fill_param = 11;
+  if (this->has_gradient_fill_param()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        11, *this->gradient_fill_param_, deterministic, target);
+  }
+
+  // .deepflow.InitConstantParam constant_param = 12;
+  if (this->has_constant_param()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        12, *this->constant_param_, deterministic, target);
+  }
+
+  // @@protoc_insertion_point(serialize_to_array_end:deepflow.InitParam)
+  return target;
+}
+
+size_t InitParam::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:deepflow.InitParam)
+  size_t total_size = 0;
+
+  // string name = 1;
+  if (this->name().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::StringSize(
+        this->name());
+  }
+
+  // .deepflow.TensorParam tensor_param = 2;
+  if (this->has_tensor_param()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        *this->tensor_param_);
+  }
+
+  // .deepflow.TensorData init_data = 3;
+  if (this->has_init_data()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        *this->init_data_);
+  }
+
+  // .deepflow.InitFillParam fill_param = 4;
+  if (this->has_fill_param()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        *this->fill_param_);
+  }
+
+  // .deepflow.InitIndexFillParam index_fill_param = 5;
+  if (this->has_index_fill_param()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        *this->index_fill_param_);
+  }
+
+  // .deepflow.InitRandomUniformParam random_uniform_param = 6;
+  if (this->has_random_uniform_param()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        *this->random_uniform_param_);
+  }
+
+  // .deepflow.InitStepParam step_param = 7;
+  if (this->has_step_param()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        *this->step_param_);
+  }
+
+  // .deepflow.InitRandomNormalParam random_normal_param = 8;
+  if (this->has_random_normal_param()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        *this->random_normal_param_);
+  }
+
+  // .deepflow.InitThreeStateParam three_state_param = 9;
+  if (this->has_three_state_param()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        *this->three_state_param_);
+  }
+
+  // .deepflow.InitTruncatedNormalParam truncated_normal_param = 10;
+  if (this->has_truncated_normal_param()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        *this->truncated_normal_param_);
+  }
+
+  // .deepflow.InitGradientFillParam gradient_fill_param = 11;
+  if (this->has_gradient_fill_param()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        *this->gradient_fill_param_);
+  }
+
+  // .deepflow.InitConstantParam constant_param = 12;
+  if (this->has_constant_param()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        *this->constant_param_);
+  }
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void InitParam::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:deepflow.InitParam)
+  GOOGLE_DCHECK_NE(&from, this);
+  const InitParam* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const InitParam>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.InitParam)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.InitParam)
+    MergeFrom(*source);
+  }
+}
+
+void InitParam::MergeFrom(const InitParam& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.InitParam)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.name().size() > 0) {
+
+    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
+  }
+  if (from.has_tensor_param()) {
+    mutable_tensor_param()->::deepflow::TensorParam::MergeFrom(from.tensor_param());
+  }
+  if (from.has_init_data()) {
+    mutable_init_data()->::deepflow::TensorData::MergeFrom(from.init_data());
+  }
+  if (from.has_fill_param()) {
+    mutable_fill_param()->::deepflow::InitFillParam::MergeFrom(from.fill_param());
+  }
+  if (from.has_index_fill_param()) {
+    mutable_index_fill_param()->::deepflow::InitIndexFillParam::MergeFrom(from.index_fill_param());
+  }
+  if (from.has_random_uniform_param()) {
+    mutable_random_uniform_param()->::deepflow::InitRandomUniformParam::MergeFrom(from.random_uniform_param());
+  }
+  if (from.has_step_param()) {
+    mutable_step_param()->::deepflow::InitStepParam::MergeFrom(from.step_param());
+  }
+  if (from.has_random_normal_param()) {
+    mutable_random_normal_param()->::deepflow::InitRandomNormalParam::MergeFrom(from.random_normal_param());
+  }
+  if (from.has_three_state_param()) {
+    mutable_three_state_param()->::deepflow::InitThreeStateParam::MergeFrom(from.three_state_param());
+  }
+  if (from.has_truncated_normal_param()) {
+    mutable_truncated_normal_param()->::deepflow::InitTruncatedNormalParam::MergeFrom(from.truncated_normal_param());
+  }
+  if (from.has_gradient_fill_param()) {
+    mutable_gradient_fill_param()->::deepflow::InitGradientFillParam::MergeFrom(from.gradient_fill_param());
+  }
+  if (from.has_constant_param()) {
+    mutable_constant_param()->::deepflow::InitConstantParam::MergeFrom(from.constant_param());
+  }
+}
+
+void InitParam::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:deepflow.InitParam)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void InitParam::CopyFrom(const InitParam& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.InitParam)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool InitParam::IsInitialized() const {
+  return true;
+}
+
+void InitParam::Swap(InitParam* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void InitParam::InternalSwap(InitParam* other) {
+  name_.Swap(&other->name_);
+  std::swap(tensor_param_, other->tensor_param_);
+  std::swap(init_data_, other->init_data_);
+  std::swap(fill_param_, other->fill_param_);
+  std::swap(index_fill_param_, other->index_fill_param_);
+  std::swap(random_uniform_param_, other->random_uniform_param_);
+  std::swap(step_param_, other->step_param_);
+  std::swap(random_normal_param_, other->random_normal_param_);
+  std::swap(three_state_param_, other->three_state_param_);
+  std::swap(truncated_normal_param_, other->truncated_normal_param_);
+  std::swap(gradient_fill_param_, other->gradient_fill_param_);
+  std::swap(constant_param_, other->constant_param_);
+  std::swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata InitParam::GetMetadata() const {
+  protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages];
+}
+
+#if PROTOBUF_INLINE_NOT_IN_HEADERS
+// InitParam
+
+// string name = 1;
+void InitParam::clear_name() {
+  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+const ::std::string& InitParam::name() const {
+  // @@protoc_insertion_point(field_get:deepflow.InitParam.name)
+  return name_.GetNoArena();
+}
+void InitParam::set_name(const ::std::string& value) {
+  
+  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:deepflow.InitParam.name)
+}
+#if LANG_CXX11
+void InitParam::set_name(::std::string&& value) {
+  
+  name_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:deepflow.InitParam.name)
+}
+#endif
+void InitParam::set_name(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
   // @@protoc_insertion_point(field_set_char:deepflow.InitParam.name)
 }
 void InitParam::set_name(const char* value, size_t size) {
@@ -20118,409 +22701,925 @@ const ::deepflow::TensorParam& InitParam::tensor_param() const {
 ::deepflow::TensorParam* InitParam::release_tensor_param() {
   // @@protoc_insertion_point(field_release:deepflow.InitParam.tensor_param)
   
-  ::deepflow::TensorParam* temp = tensor_param_;
-  tensor_param_ = NULL;
+  ::deepflow::TensorParam* temp = tensor_param_;
+  tensor_param_ = NULL;
+  return temp;
+}
+void InitParam::set_allocated_tensor_param(::deepflow::TensorParam* tensor_param) {
+  delete tensor_param_;
+  tensor_param_ = tensor_param;
+  if (tensor_param) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:deepflow.InitParam.tensor_param)
+}
+
+// .deepflow.TensorData init_data = 3;
+bool InitParam::has_init_data() const {
+  return this != internal_default_instance() && init_data_ != NULL;
+}
+void InitParam::clear_init_data() {
+  if (GetArenaNoVirtual() == NULL && init_data_ != NULL) delete init_data_;
+  init_data_ = NULL;
+}
+const ::deepflow::TensorData& InitParam::init_data() const {
+  // @@protoc_insertion_point(field_get:deepflow.InitParam.init_data)
+  return init_data_ != NULL ? *init_data_
+                         : *::deepflow::TensorData::internal_default_instance();
+}
+::deepflow::TensorData* InitParam::mutable_init_data() {
+  
+  if (init_data_ == NULL) {
+    init_data_ = new ::deepflow::TensorData;
+  }
+  // @@protoc_insertion_point(field_mutable:deepflow.InitParam.init_data)
+  return init_data_;
+}
+::deepflow::TensorData* InitParam::release_init_data() {
+  // @@protoc_insertion_point(field_release:deepflow.InitParam.init_data)
+  
+  ::deepflow::TensorData* temp = init_data_;
+  init_data_ = NULL;
+  return temp;
+}
+void InitParam::set_allocated_init_data(::deepflow::TensorData* init_data) {
+  delete init_data_;
+  init_data_ = init_data;
+  if (init_data) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:deepflow.InitParam.init_data)
+}
+
+// .deepflow.InitFillParam fill_param = 4;
+bool InitParam::has_fill_param() const {
+  return this != internal_default_instance() && fill_param_ != NULL;
+}
+void InitParam::clear_fill_param() {
+  if (GetArenaNoVirtual() == NULL && fill_param_ != NULL) delete fill_param_;
+  fill_param_ = NULL;
+}
+const ::deepflow::InitFillParam& InitParam::fill_param() const {
+  // @@protoc_insertion_point(field_get:deepflow.InitParam.fill_param)
+  return fill_param_ != NULL ? *fill_param_
+                         : *::deepflow::InitFillParam::internal_default_instance();
+}
+::deepflow::InitFillParam* InitParam::mutable_fill_param() {
+  
+  if (fill_param_ == NULL) {
+    fill_param_ = new ::deepflow::InitFillParam;
+  }
+  // @@protoc_insertion_point(field_mutable:deepflow.InitParam.fill_param)
+  return fill_param_;
+}
+::deepflow::InitFillParam* InitParam::release_fill_param() {
+  // @@protoc_insertion_point(field_release:deepflow.InitParam.fill_param)
+  
+  ::deepflow::InitFillParam* temp = fill_param_;
+  fill_param_ = NULL;
+  return temp;
+}
+void InitParam::set_allocated_fill_param(::deepflow::InitFillParam* fill_param) {
+  delete fill_param_;
+  fill_param_ = fill_param;
+  if (fill_param) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:deepflow.InitParam.fill_param)
+}
+
+// .deepflow.InitIndexFillParam index_fill_param = 5;
+bool InitParam::has_index_fill_param() const {
+  return this != internal_default_instance() && index_fill_param_ != NULL;
+}
+void InitParam::clear_index_fill_param() {
+  if (GetArenaNoVirtual() == NULL && index_fill_param_ != NULL) delete index_fill_param_;
+  index_fill_param_ = NULL;
+}
+const ::deepflow::InitIndexFillParam& InitParam::index_fill_param() const {
+  // @@protoc_insertion_point(field_get:deepflow.InitParam.index_fill_param)
+  return index_fill_param_ != NULL ? *index_fill_param_
+                         : *::deepflow::InitIndexFillParam::internal_default_instance();
+}
+::deepflow::InitIndexFillParam* InitParam::mutable_index_fill_param() {
+  
+  if (index_fill_param_ == NULL) {
+    index_fill_param_ = new ::deepflow::InitIndexFillParam;
+  }
+  // @@protoc_insertion_point(field_mutable:deepflow.InitParam.index_fill_param)
+  return index_fill_param_;
+}
+::deepflow::InitIndexFillParam* InitParam::release_index_fill_param() {
+  // @@protoc_insertion_point(field_release:deepflow.InitParam.index_fill_param)
+  
+  ::deepflow::InitIndexFillParam* temp = index_fill_param_;
+  index_fill_param_ = NULL;
+  return temp;
+}
+void InitParam::set_allocated_index_fill_param(::deepflow::InitIndexFillParam* index_fill_param) {
+  delete index_fill_param_;
+  index_fill_param_ = index_fill_param;
+  if (index_fill_param) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:deepflow.InitParam.index_fill_param)
+}
+
+// .deepflow.InitRandomUniformParam random_uniform_param = 6;
+bool InitParam::has_random_uniform_param() const {
+  return this != internal_default_instance() && random_uniform_param_ != NULL;
+}
+void InitParam::clear_random_uniform_param() {
+  if (GetArenaNoVirtual() == NULL && random_uniform_param_ != NULL) delete random_uniform_param_;
+  random_uniform_param_ = NULL;
+}
+const ::deepflow::InitRandomUniformParam& InitParam::random_uniform_param() const {
+  // @@protoc_insertion_point(field_get:deepflow.InitParam.random_uniform_param)
+  return random_uniform_param_ != NULL ? *random_uniform_param_
+                         : *::deepflow::InitRandomUniformParam::internal_default_instance();
+}
+::deepflow::InitRandomUniformParam* InitParam::mutable_random_uniform_param() {
+  
+  if (random_uniform_param_ == NULL) {
+    random_uniform_param_ = new ::deepflow::InitRandomUniformParam;
+  }
+  // @@protoc_insertion_point(field_mutable:deepflow.InitParam.random_uniform_param)
+  return random_uniform_param_;
+}
+::deepflow::InitRandomUniformParam* InitParam::release_random_uniform_param() {
+  // @@protoc_insertion_point(field_release:deepflow.InitParam.random_uniform_param)
+  
+  ::deepflow::InitRandomUniformParam* temp = random_uniform_param_;
+  random_uniform_param_ = NULL;
+  return temp;
+}
+void InitParam::set_allocated_random_uniform_param(::deepflow::InitRandomUniformParam* random_uniform_param) {
+  delete random_uniform_param_;
+  random_uniform_param_ = random_uniform_param;
+  if (random_uniform_param) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:deepflow.InitParam.random_uniform_param)
+}
+
+// .deepflow.InitStepParam step_param = 7;
+bool InitParam::has_step_param() const {
+  return this != internal_default_instance() && step_param_ != NULL;
+}
+void InitParam::clear_step_param() {
+  if (GetArenaNoVirtual() == NULL && step_param_ != NULL) delete step_param_;
+  step_param_ = NULL;
+}
+const ::deepflow::InitStepParam& InitParam::step_param() const {
+  // @@protoc_insertion_point(field_get:deepflow.InitParam.step_param)
+  return step_param_ != NULL ? *step_param_
+                         : *::deepflow::InitStepParam::internal_default_instance();
+}
+::deepflow::InitStepParam* InitParam::mutable_step_param() {
+  
+  if (step_param_ == NULL) {
+    step_param_ = new ::deepflow::InitStepParam;
+  }
+  // @@protoc_insertion_point(field_mutable:deepflow.InitParam.step_param)
+  return step_param_;
+}
+::deepflow::InitStepParam* InitParam::release_step_param() {
+  // @@protoc_insertion_point(field_release:deepflow.InitParam.step_param)
+  
+  ::deepflow::InitStepParam* temp = step_param_;
+  step_param_ = NULL;
+  return temp;
+}
+void InitParam::set_allocated_step_param(::deepflow::InitStepParam* step_param) {
+  delete step_param_;
+  step_param_ = step_param;
+  if (step_param) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:deepflow.InitParam.step_param)
+}
+
+// .deepflow.InitRandomNormalParam random_normal_param = 8;
+bool InitParam::has_random_normal_param() const {
+  return this != internal_default_instance() && random_normal_param_ != NULL;
+}
+void InitParam::clear_random_normal_param() {
+  if (GetArenaNoVirtual() == NULL && random_normal_param_ != NULL) delete random_normal_param_;
+  random_normal_param_ = NULL;
+}
+const ::deepflow::InitRandomNormalParam& InitParam::random_normal_param() const {
+  // @@protoc_insertion_point(field_get:deepflow.InitParam.random_normal_param)
+  return random_normal_param_ != NULL ? *random_normal_param_
+                         : *::deepflow::InitRandomNormalParam::internal_default_instance();
+}
+::deepflow::InitRandomNormalParam* InitParam::mutable_random_normal_param() {
+  
+  if (random_normal_param_ == NULL) {
+    random_normal_param_ = new ::deepflow::InitRandomNormalParam;
+  }
+  // @@protoc_insertion_point(field_mutable:deepflow.InitParam.random_normal_param)
+  return random_normal_param_;
+}
+::deepflow::InitRandomNormalParam* InitParam::release_random_normal_param() {
+  // @@protoc_insertion_point(field_release:deepflow.InitParam.random_normal_param)
+  
+  ::deepflow::InitRandomNormalParam* temp = random_normal_param_;
+  random_normal_param_ = NULL;
+  return temp;
+}
+void InitParam::set_allocated_random_normal_param(::deepflow::InitRandomNormalParam* random_normal_param) {
+  delete random_normal_param_;
+  random_normal_param_ = random_normal_param;
+  if (random_normal_param) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:deepflow.InitParam.random_normal_param)
+}
+
+// .deepflow.InitThreeStateParam three_state_param = 9;
+bool InitParam::has_three_state_param() const {
+  return this != internal_default_instance() && three_state_param_ != NULL;
+}
+void InitParam::clear_three_state_param() {
+  if (GetArenaNoVirtual() == NULL && three_state_param_ != NULL) delete three_state_param_;
+  three_state_param_ = NULL;
+}
+const ::deepflow::InitThreeStateParam& InitParam::three_state_param() const {
+  // @@protoc_insertion_point(field_get:deepflow.InitParam.three_state_param)
+  return three_state_param_ != NULL ? *three_state_param_
+                         : *::deepflow::InitThreeStateParam::internal_default_instance();
+}
+::deepflow::InitThreeStateParam* InitParam::mutable_three_state_param() {
+  
+  if (three_state_param_ == NULL) {
+    three_state_param_ = new ::deepflow::InitThreeStateParam;
+  }
+  // @@protoc_insertion_point(field_mutable:deepflow.InitParam.three_state_param)
+  return three_state_param_;
+}
+::deepflow::InitThreeStateParam* InitParam::release_three_state_param() {
+  // @@protoc_insertion_point(field_release:deepflow.InitParam.three_state_param)
+  
+  ::deepflow::InitThreeStateParam* temp = three_state_param_;
+  three_state_param_ = NULL;
+  return temp;
+}
+void InitParam::set_allocated_three_state_param(::deepflow::InitThreeStateParam* three_state_param) {
+  delete three_state_param_;
+  three_state_param_ = three_state_param;
+  if (three_state_param) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:deepflow.InitParam.three_state_param)
+}
+
+// .deepflow.InitTruncatedNormalParam truncated_normal_param = 10;
+bool InitParam::has_truncated_normal_param() const {
+  return this != internal_default_instance() && truncated_normal_param_ != NULL;
+}
+void InitParam::clear_truncated_normal_param() {
+  if (GetArenaNoVirtual() == NULL && truncated_normal_param_ != NULL) delete truncated_normal_param_;
+  truncated_normal_param_ = NULL;
+}
+const ::deepflow::InitTruncatedNormalParam& InitParam::truncated_normal_param() const {
+  // @@protoc_insertion_point(field_get:deepflow.InitParam.truncated_normal_param)
+  return truncated_normal_param_ != NULL ? *truncated_normal_param_
+                         : *::deepflow::InitTruncatedNormalParam::internal_default_instance();
+}
+::deepflow::InitTruncatedNormalParam* InitParam::mutable_truncated_normal_param() {
+  
+  if (truncated_normal_param_ == NULL) {
+    truncated_normal_param_ = new ::deepflow::InitTruncatedNormalParam;
+  }
+  // @@protoc_insertion_point(field_mutable:deepflow.InitParam.truncated_normal_param)
+  return truncated_normal_param_;
+}
+::deepflow::InitTruncatedNormalParam* InitParam::release_truncated_normal_param() {
+  // @@protoc_insertion_point(field_release:deepflow.InitParam.truncated_normal_param)
+  
+  ::deepflow::InitTruncatedNormalParam* temp = truncated_normal_param_;
+  truncated_normal_param_ = NULL;
+  return temp;
+}
+void InitParam::set_allocated_truncated_normal_param(::deepflow::InitTruncatedNormalParam* truncated_normal_param) {
+  delete truncated_normal_param_;
+  truncated_normal_param_ = truncated_normal_param;
+  if (truncated_normal_param) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:deepflow.InitParam.truncated_normal_param)
+}
+
+// .deepflow.InitGradientFillParam gradient_fill_param = 11;
+bool InitParam::has_gradient_fill_param() const {
+  return this != internal_default_instance() && gradient_fill_param_ != NULL;
+}
+void InitParam::clear_gradient_fill_param() {
+  if (GetArenaNoVirtual() == NULL && gradient_fill_param_ != NULL) delete gradient_fill_param_;
+  gradient_fill_param_ = NULL;
+}
+const ::deepflow::InitGradientFillParam& InitParam::gradient_fill_param() const {
+  // @@protoc_insertion_point(field_get:deepflow.InitParam.gradient_fill_param)
+  return gradient_fill_param_ != NULL ? *gradient_fill_param_
+                         : *::deepflow::InitGradientFillParam::internal_default_instance();
+}
+::deepflow::InitGradientFillParam* InitParam::mutable_gradient_fill_param() {
+  
+  if (gradient_fill_param_ == NULL) {
+    gradient_fill_param_ = new ::deepflow::InitGradientFillParam;
+  }
+  // @@protoc_insertion_point(field_mutable:deepflow.InitParam.gradient_fill_param)
+  return gradient_fill_param_;
+}
+::deepflow::InitGradientFillParam* InitParam::release_gradient_fill_param() {
+  // @@protoc_insertion_point(field_release:deepflow.InitParam.gradient_fill_param)
+  
+  ::deepflow::InitGradientFillParam* temp = gradient_fill_param_;
+  gradient_fill_param_ = NULL;
   return temp;
 }
-void InitParam::set_allocated_tensor_param(::deepflow::TensorParam* tensor_param) {
-  delete tensor_param_;
-  tensor_param_ = tensor_param;
-  if (tensor_param) {
+void InitParam::set_allocated_gradient_fill_param(::deepflow::InitGradientFillParam* gradient_fill_param) {
+  delete gradient_fill_param_;
+  gradient_fill_param_ = gradient_fill_param;
+  if (gradient_fill_param) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:deepflow.InitParam.tensor_param)
+  // @@protoc_insertion_point(field_set_allocated:deepflow.InitParam.gradient_fill_param)
 }
 
-// .deepflow.TensorData init_data = 3;
-bool InitParam::has_init_data() const {
-  return this != internal_default_instance() && init_data_ != NULL;
+// .deepflow.InitConstantParam constant_param = 12;
+bool InitParam::has_constant_param() const {
+  return this != internal_default_instance() && constant_param_ != NULL;
 }
-void InitParam::clear_init_data() {
-  if (GetArenaNoVirtual() == NULL && init_data_ != NULL) delete init_data_;
-  init_data_ = NULL;
+void InitParam::clear_constant_param() {
+  if (GetArenaNoVirtual() == NULL && constant_param_ != NULL) delete constant_param_;
+  constant_param_ = NULL;
 }
-const ::deepflow::TensorData& InitParam::init_data() const {
-  // @@protoc_insertion_point(field_get:deepflow.InitParam.init_data)
-  return init_data_ != NULL ? *init_data_
-                         : *::deepflow::TensorData::internal_default_instance();
+const ::deepflow::InitConstantParam& InitParam::constant_param() const {
+  // @@protoc_insertion_point(field_get:deepflow.InitParam.constant_param)
+  return constant_param_ != NULL ? *constant_param_
+                         : *::deepflow::InitConstantParam::internal_default_instance();
 }
-::deepflow::TensorData* InitParam::mutable_init_data() {
+::deepflow::InitConstantParam* InitParam::mutable_constant_param() {
   
-  if (init_data_ == NULL) {
-    init_data_ = new ::deepflow::TensorData;
+  if (constant_param_ == NULL) {
+    constant_param_ = new ::deepflow::InitConstantParam;
   }
-  // @@protoc_insertion_point(field_mutable:deepflow.InitParam.init_data)
-  return init_data_;
+  // @@protoc_insertion_point(field_mutable:deepflow.InitParam.constant_param)
+  return constant_param_;
 }
-::deepflow::TensorData* InitParam::release_init_data() {
-  // @@protoc_insertion_point(field_release:deepflow.InitParam.init_data)
+::deepflow::InitConstantParam* InitParam::release_constant_param() {
+  // @@protoc_insertion_point(field_release:deepflow.InitParam.constant_param)
   
-  ::deepflow::TensorData* temp = init_data_;
-  init_data_ = NULL;
+  ::deepflow::InitConstantParam* temp = constant_param_;
+  constant_param_ = NULL;
   return temp;
 }
-void InitParam::set_allocated_init_data(::deepflow::TensorData* init_data) {
-  delete init_data_;
-  init_data_ = init_data;
-  if (init_data) {
+void InitParam::set_allocated_constant_param(::deepflow::InitConstantParam* constant_param) {
+  delete constant_param_;
+  constant_param_ = constant_param;
+  if (constant_param) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:deepflow.InitParam.init_data)
+  // @@protoc_insertion_point(field_set_allocated:deepflow.InitParam.constant_param)
 }
 
-// .deepflow.InitFillParam fill_param = 4;
-bool InitParam::has_fill_param() const {
-  return this != internal_default_instance() && fill_param_ != NULL;
+#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
+
+// ===================================================================
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int SGDSolverParam::kMomentumFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+SGDSolverParam::SGDSolverParam()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    protobuf_deepflow_2eproto::InitDefaults();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:deepflow.SGDSolverParam)
 }
-void InitParam::clear_fill_param() {
-  if (GetArenaNoVirtual() == NULL && fill_param_ != NULL) delete fill_param_;
-  fill_param_ = NULL;
+SGDSolverParam::SGDSolverParam(const SGDSolverParam& from)
+  : ::google::protobuf::Message(),
+      _internal_metadata_(NULL),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  momentum_ = from.momentum_;
+  // @@protoc_insertion_point(copy_constructor:deepflow.SGDSolverParam)
 }
-const ::deepflow::InitFillParam& InitParam::fill_param() const {
-  // @@protoc_insertion_point(field_get:deepflow.InitParam.fill_param)
-  return fill_param_ != NULL ? *fill_param_
-                         : *::deepflow::InitFillParam::internal_default_instance();
+
+void SGDSolverParam::SharedCtor() {
+  momentum_ = 0;
+  _cached_size_ = 0;
 }
-::deepflow::InitFillParam* InitParam::mutable_fill_param() {
-  
-  if (fill_param_ == NULL) {
-    fill_param_ = new ::deepflow::InitFillParam;
-  }
-  // @@protoc_insertion_point(field_mutable:deepflow.InitParam.fill_param)
-  return fill_param_;
+
+SGDSolverParam::~SGDSolverParam() {
+  // @@protoc_insertion_point(destructor:deepflow.SGDSolverParam)
+  SharedDtor();
 }
-::deepflow::InitFillParam* InitParam::release_fill_param() {
-  // @@protoc_insertion_point(field_release:deepflow.InitParam.fill_param)
-  
-  ::deepflow::InitFillParam* temp = fill_param_;
-  fill_param_ = NULL;
-  return temp;
+
+void SGDSolverParam::SharedDtor() {
 }
-void InitParam::set_allocated_fill_param(::deepflow::InitFillParam* fill_param) {
-  delete fill_param_;
-  fill_param_ = fill_param;
-  if (fill_param) {
-    
-  } else {
-    
+
+void SGDSolverParam::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* SGDSolverParam::descriptor() {
+  protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+}
+
+const SGDSolverParam& SGDSolverParam::default_instance() {
+  protobuf_deepflow_2eproto::InitDefaults();
+  return *internal_default_instance();
+}
+
+SGDSolverParam* SGDSolverParam::New(::google::protobuf::Arena* arena) const {
+  SGDSolverParam* n = new SGDSolverParam;
+  if (arena != NULL) {
+    arena->Own(n);
   }
-  // @@protoc_insertion_point(field_set_allocated:deepflow.InitParam.fill_param)
+  return n;
 }
 
-// .deepflow.InitIndexFillParam index_fill_param = 5;
-bool InitParam::has_index_fill_param() const {
-  return this != internal_default_instance() && index_fill_param_ != NULL;
+void SGDSolverParam::Clear() {
+// @@protoc_insertion_point(message_clear_start:deepflow.SGDSolverParam)
+  momentum_ = 0;
 }
-void InitParam::clear_index_fill_param() {
-  if (GetArenaNoVirtual() == NULL && index_fill_param_ != NULL) delete index_fill_param_;
-  index_fill_param_ = NULL;
+
+bool SGDSolverParam::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:deepflow.SGDSolverParam)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // float momentum = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(21u)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, &momentum_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0 ||
+            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:deepflow.SGDSolverParam)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:deepflow.SGDSolverParam)
+  return false;
+#undef DO_
 }
-const ::deepflow::InitIndexFillParam& InitParam::index_fill_param() const {
-  // @@protoc_insertion_point(field_get:deepflow.InitParam.index_fill_param)
-  return index_fill_param_ != NULL ? *index_fill_param_
-                         : *::deepflow::InitIndexFillParam::internal_default_instance();
+
+void SGDSolverParam::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:deepflow.SGDSolverParam)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // float momentum = 2;
+  if (this->momentum() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(2, this->momentum(), output);
+  }
+
+  // @@protoc_insertion_point(serialize_end:deepflow.SGDSolverParam)
 }
-::deepflow::InitIndexFillParam* InitParam::mutable_index_fill_param() {
-  
-  if (index_fill_param_ == NULL) {
-    index_fill_param_ = new ::deepflow::InitIndexFillParam;
+
+::google::protobuf::uint8* SGDSolverParam::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:deepflow.SGDSolverParam)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // float momentum = 2;
+  if (this->momentum() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(2, this->momentum(), target);
   }
-  // @@protoc_insertion_point(field_mutable:deepflow.InitParam.index_fill_param)
-  return index_fill_param_;
+
+  // @@protoc_insertion_point(serialize_to_array_end:deepflow.SGDSolverParam)
+  return target;
 }
-::deepflow::InitIndexFillParam* InitParam::release_index_fill_param() {
-  // @@protoc_insertion_point(field_release:deepflow.InitParam.index_fill_param)
-  
-  ::deepflow::InitIndexFillParam* temp = index_fill_param_;
-  index_fill_param_ = NULL;
-  return temp;
+
+size_t SGDSolverParam::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:deepflow.SGDSolverParam)
+  size_t total_size = 0;
+
+  // float momentum = 2;
+  if (this->momentum() != 0) {
+    total_size += 1 + 4;
+  }
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
 }
-void InitParam::set_allocated_index_fill_param(::deepflow::InitIndexFillParam* index_fill_param) {
-  delete index_fill_param_;
-  index_fill_param_ = index_fill_param;
-  if (index_fill_param) {
-    
+
+void SGDSolverParam::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:deepflow.SGDSolverParam)
+  GOOGLE_DCHECK_NE(&from, this);
+  const SGDSolverParam* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const SGDSolverParam>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.SGDSolverParam)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-    
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.SGDSolverParam)
+    MergeFrom(*source);
   }
-  // @@protoc_insertion_point(field_set_allocated:deepflow.InitParam.index_fill_param)
 }
 
-// .deepflow.InitRandomUniformParam random_uniform_param = 6;
-bool InitParam::has_random_uniform_param() const {
-  return this != internal_default_instance() && random_uniform_param_ != NULL;
+void SGDSolverParam::MergeFrom(const SGDSolverParam& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.SGDSolverParam)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.momentum() != 0) {
+    set_momentum(from.momentum());
+  }
 }
-void InitParam::clear_random_uniform_param() {
-  if (GetArenaNoVirtual() == NULL && random_uniform_param_ != NULL) delete random_uniform_param_;
-  random_uniform_param_ = NULL;
+
+void SGDSolverParam::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:deepflow.SGDSolverParam)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
 }
-const ::deepflow::InitRandomUniformParam& InitParam::random_uniform_param() const {
-  // @@protoc_insertion_point(field_get:deepflow.InitParam.random_uniform_param)
-  return random_uniform_param_ != NULL ? *random_uniform_param_
-                         : *::deepflow::InitRandomUniformParam::internal_default_instance();
+
+void SGDSolverParam::CopyFrom(const SGDSolverParam& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.SGDSolverParam)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
 }
-::deepflow::InitRandomUniformParam* InitParam::mutable_random_uniform_param() {
-  
-  if (random_uniform_param_ == NULL) {
-    random_uniform_param_ = new ::deepflow::InitRandomUniformParam;
-  }
-  // @@protoc_insertion_point(field_mutable:deepflow.InitParam.random_uniform_param)
-  return random_uniform_param_;
+
+bool SGDSolverParam::IsInitialized() const {
+  return true;
 }
-::deepflow::InitRandomUniformParam* InitParam::release_random_uniform_param() {
-  // @@protoc_insertion_point(field_release:deepflow.InitParam.random_uniform_param)
+
+void SGDSolverParam::Swap(SGDSolverParam* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void SGDSolverParam::InternalSwap(SGDSolverParam* other) {
+  std::swap(momentum_, other->momentum_);
+  std::swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata SGDSolverParam::GetMetadata() const {
+  protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages];
+}
+
+#if PROTOBUF_INLINE_NOT_IN_HEADERS
+// SGDSolverParam
+
+// float momentum = 2;
+void SGDSolverParam::clear_momentum() {
+  momentum_ = 0;
+}
+float SGDSolverParam::momentum() const {
+  // @@protoc_insertion_point(field_get:deepflow.SGDSolverParam.momentum)
+  return momentum_;
+}
+void SGDSolverParam::set_momentum(float value) {
   
-  ::deepflow::InitRandomUniformParam* temp = random_uniform_param_;
-  random_uniform_param_ = NULL;
-  return temp;
+  momentum_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.SGDSolverParam.momentum)
 }
-void InitParam::set_allocated_random_uniform_param(::deepflow::InitRandomUniformParam* random_uniform_param) {
-  delete random_uniform_param_;
-  random_uniform_param_ = random_uniform_param;
-  if (random_uniform_param) {
-    
-  } else {
-    
+
+#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
+
+// ===================================================================
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int AdaDeltaSolverParam::kMomentumFieldNumber;
+const int AdaDeltaSolverParam::kDeltaFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+AdaDeltaSolverParam::AdaDeltaSolverParam()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    protobuf_deepflow_2eproto::InitDefaults();
   }
-  // @@protoc_insertion_point(field_set_allocated:deepflow.InitParam.random_uniform_param)
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:deepflow.AdaDeltaSolverParam)
+}
+AdaDeltaSolverParam::AdaDeltaSolverParam(const AdaDeltaSolverParam& from)
+  : ::google::protobuf::Message(),
+      _internal_metadata_(NULL),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::memcpy(&momentum_, &from.momentum_,
+    reinterpret_cast<char*>(&delta_) -
+    reinterpret_cast<char*>(&momentum_) + sizeof(delta_));
+  // @@protoc_insertion_point(copy_constructor:deepflow.AdaDeltaSolverParam)
 }
 
-// .deepflow.InitStepParam step_param = 7;
-bool InitParam::has_step_param() const {
-  return this != internal_default_instance() && step_param_ != NULL;
+void AdaDeltaSolverParam::SharedCtor() {
+  ::memset(&momentum_, 0, reinterpret_cast<char*>(&delta_) -
+    reinterpret_cast<char*>(&momentum_) + sizeof(delta_));
+  _cached_size_ = 0;
 }
-void InitParam::clear_step_param() {
-  if (GetArenaNoVirtual() == NULL && step_param_ != NULL) delete step_param_;
-  step_param_ = NULL;
+
+AdaDeltaSolverParam::~AdaDeltaSolverParam() {
+  // @@protoc_insertion_point(destructor:deepflow.AdaDeltaSolverParam)
+  SharedDtor();
 }
-const ::deepflow::InitStepParam& InitParam::step_param() const {
-  // @@protoc_insertion_point(field_get:deepflow.InitParam.step_param)
-  return step_param_ != NULL ? *step_param_
-                         : *::deepflow::InitStepParam::internal_default_instance();
+
+void AdaDeltaSolverParam::SharedDtor() {
 }
-::deepflow::InitStepParam* InitParam::mutable_step_param() {
-  
-  if (step_param_ == NULL) {
-    step_param_ = new ::deepflow::InitStepParam;
+
+void AdaDeltaSolverParam::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* AdaDeltaSolverParam::descriptor() {
+  protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+}
+
+const AdaDeltaSolverParam& AdaDeltaSolverParam::default_instance() {
+  protobuf_deepflow_2eproto::InitDefaults();
+  return *internal_default_instance();
+}
+
+AdaDeltaSolverParam* AdaDeltaSolverParam::New(::google::protobuf::Arena* arena) const {
+  AdaDeltaSolverParam* n = new AdaDeltaSolverParam;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void AdaDeltaSolverParam::Clear() {
+// @@protoc_insertion_point(message_clear_start:deepflow.AdaDeltaSolverParam)
+  ::memset(&momentum_, 0, reinterpret_cast<char*>(&delta_) -
+    reinterpret_cast<char*>(&momentum_) + sizeof(delta_));
+}
+
+bool AdaDeltaSolverParam::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:deepflow.AdaDeltaSolverParam)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // float momentum = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(21u)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, &momentum_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // float delta = 3;
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(29u)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, &delta_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0 ||
+            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:deepflow.AdaDeltaSolverParam)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:deepflow.AdaDeltaSolverParam)
+  return false;
+#undef DO_
+}
+
+void AdaDeltaSolverParam::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:deepflow.AdaDeltaSolverParam)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // float momentum = 2;
+  if (this->momentum() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(2, this->momentum(), output);
+  }
+
+  // float delta = 3;
+  if (this->delta() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(3, this->delta(), output);
   }
-  // @@protoc_insertion_point(field_mutable:deepflow.InitParam.step_param)
-  return step_param_;
-}
-::deepflow::InitStepParam* InitParam::release_step_param() {
-  // @@protoc_insertion_point(field_release:deepflow.InitParam.step_param)
-  
-  ::deepflow::InitStepParam* temp = step_param_;
-  step_param_ = NULL;
-  return temp;
+
+  // @@protoc_insertion_point(serialize_end:deepflow.AdaDeltaSolverParam)
 }
-void InitParam::set_allocated_step_param(::deepflow::InitStepParam* step_param) {
-  delete step_param_;
-  step_param_ = step_param;
-  if (step_param) {
-    
-  } else {
-    
+
+::google::protobuf::uint8* AdaDeltaSolverParam::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:deepflow.AdaDeltaSolverParam)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // float momentum = 2;
+  if (this->momentum() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(2, this->momentum(), target);
   }
-  // @@protoc_insertion_point(field_set_allocated:deepflow.InitParam.step_param)
-}
 
-// .deepflow.InitRandomNormalParam random_normal_param = 8;
-bool InitParam::has_random_normal_param() const {
-  return this != internal_default_instance() && random_normal_param_ != NULL;
-}
-void InitParam::clear_random_normal_param() {
-  if (GetArenaNoVirtual() == NULL && random_normal_param_ != NULL) delete random_normal_param_;
-  random_normal_param_ = NULL;
-}
-const ::deepflow::InitRandomNormalParam& InitParam::random_normal_param() const {
-  // @@protoc_insertion_point(field_get:deepflow.InitParam.random_normal_param)
-  return random_normal_param_ != NULL ? *random_normal_param_
-                         : *::deepflow::InitRandomNormalParam::internal_default_instance();
-}
-::deepflow::InitRandomNormalParam* InitParam::mutable_random_normal_param() {
-  
-  if (random_normal_param_ == NULL) {
-    random_normal_param_ = new ::deepflow::InitRandomNormalParam;
+  // float delta = 3;
+  if (this->delta() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(3, this->delta(), target);
   }
-  // @@protoc_insertion_point(field_mutable:deepflow.InitParam.random_normal_param)
-  return random_normal_param_;
-}
-::deepflow::InitRandomNormalParam* InitParam::release_random_normal_param() {
-  // @@protoc_insertion_point(field_release:deepflow.InitParam.random_normal_param)
-  
-  ::deepflow::InitRandomNormalParam* temp = random_normal_param_;
-  random_normal_param_ = NULL;
-  return temp;
+
+  // @@protoc_insertion_point(serialize_to_array_end:deepflow.AdaDeltaSolverParam)
+  return target;
 }
-void InitParam::set_allocated_random_normal_param(::deepflow::InitRandomNormalParam* random_normal_param) {
-  delete random_normal_param_;
-  random_normal_param_ = random_normal_param;
-  if (random_normal_param) {
-    
-  } else {
-    
+
+size_t AdaDeltaSolverParam::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:deepflow.AdaDeltaSolverParam)
+  size_t total_size = 0;
+
+  // float momentum = 2;
+  if (this->momentum() != 0) {
+    total_size += 1 + 4;
   }
-  // @@protoc_insertion_point(field_set_allocated:deepflow.InitParam.random_normal_param)
-}
 
-// .deepflow.InitThreeStateParam three_state_param = 9;
-bool InitParam::has_three_state_param() const {
-  return this != internal_default_instance() && three_state_param_ != NULL;
-}
-void InitParam::clear_three_state_param() {
-  if (GetArenaNoVirtual() == NULL && three_state_param_ != NULL) delete three_state_param_;
-  three_state_param_ = NULL;
-}
-const ::deepflow::InitThreeStateParam& InitParam::three_state_param() const {
-  // @@protoc_insertion_point(field_get:deepflow.InitParam.three_state_param)
-  return three_state_param_ != NULL ? *three_state_param_
-                         : *::deepflow::InitThreeStateParam::internal_default_instance();
-}
-::deepflow::InitThreeStateParam* InitParam::mutable_three_state_param() {
-  
-  if (three_state_param_ == NULL) {
-    three_state_param_ = new ::deepflow::InitThreeStateParam;
+  // float delta = 3;
+  if (this->delta() != 0) {
+    total_size += 1 + 4;
   }
-  // @@protoc_insertion_point(field_mutable:deepflow.InitParam.three_state_param)
-  return three_state_param_;
-}
-::deepflow::InitThreeStateParam* InitParam::release_three_state_param() {
-  // @@protoc_insertion_point(field_release:deepflow.InitParam.three_state_param)
-  
-  ::deepflow::InitThreeStateParam* temp = three_state_param_;
-  three_state_param_ = NULL;
-  return temp;
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
 }
-void InitParam::set_allocated_three_state_param(::deepflow::InitThreeStateParam* three_state_param) {
-  delete three_state_param_;
-  three_state_param_ = three_state_param;
-  if (three_state_param) {
-    
+
+void AdaDeltaSolverParam::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:deepflow.AdaDeltaSolverParam)
+  GOOGLE_DCHECK_NE(&from, this);
+  const AdaDeltaSolverParam* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const AdaDeltaSolverParam>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.AdaDeltaSolverParam)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-    
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.AdaDeltaSolverParam)
+    MergeFrom(*source);
   }
-  // @@protoc_insertion_point(field_set_allocated:deepflow.InitParam.three_state_param)
 }
 
-// .deepflow.InitTruncatedNormalParam truncated_normal_param = 10;
-bool InitParam::has_truncated_normal_param() const {
-  return this != internal_default_instance() && truncated_normal_param_ != NULL;
-}
-void InitParam::clear_truncated_normal_param() {
-  if (GetArenaNoVirtual() == NULL && truncated_normal_param_ != NULL) delete truncated_normal_param_;
-  truncated_normal_param_ = NULL;
-}
-const ::deepflow::InitTruncatedNormalParam& InitParam::truncated_normal_param() const {
-  // @@protoc_insertion_point(field_get:deepflow.InitParam.truncated_normal_param)
-  return truncated_normal_param_ != NULL ? *truncated_normal_param_
-                         : *::deepflow::InitTruncatedNormalParam::internal_default_instance();
-}
-::deepflow::InitTruncatedNormalParam* InitParam::mutable_truncated_normal_param() {
-  
-  if (truncated_normal_param_ == NULL) {
-    truncated_normal_param_ = new ::deepflow::InitTruncatedNormalParam;
+void AdaDeltaSolverParam::MergeFrom(const AdaDeltaSolverParam& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.AdaDeltaSolverParam)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.momentum() != 0) {
+    set_momentum(from.momentum());
   }
-  // @@protoc_insertion_point(field_mutable:deepflow.InitParam.truncated_normal_param)
-  return truncated_normal_param_;
-}
-::deepflow::InitTruncatedNormalParam* InitParam::release_truncated_normal_param() {
-  // @@protoc_insertion_point(field_release:deepflow.InitParam.truncated_normal_param)
-  
-  ::deepflow::InitTruncatedNormalParam* temp = truncated_normal_param_;
-  truncated_normal_param_ = NULL;
-  return temp;
-}
-void InitParam::set_allocated_truncated_normal_param(::deepflow::InitTruncatedNormalParam* truncated_normal_param) {
-  delete truncated_normal_param_;
-  truncated_normal_param_ = truncated_normal_param;
-  if (truncated_normal_param) {
-    
-  } else {
-    
+  if (from.delta() != 0) {
+    set_delta(from.delta());
   }
-  // @@protoc_insertion_point(field_set_allocated:deepflow.InitParam.truncated_normal_param)
 }
 
-// .deepflow.InitGradientFillParam gradient_fill_param = 11;
-bool InitParam::has_gradient_fill_param() const {
-  return this != internal_default_instance() && gradient_fill_param_ != NULL;
-}
-void InitParam::clear_gradient_fill_param() {
-  if (GetArenaNoVirtual() == NULL && gradient_fill_param_ != NULL) delete gradient_fill_param_;
-  gradient_fill_param_ = NULL;
+void AdaDeltaSolverParam::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:deepflow.AdaDeltaSolverParam)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
 }
-const ::deepflow::InitGradientFillParam& InitParam::gradient_fill_param() const {
-  // @@protoc_insertion_point(field_get:deepflow.InitParam.gradient_fill_param)
-  return gradient_fill_param_ != NULL ? *gradient_fill_param_
-                         : *::deepflow::InitGradientFillParam::internal_default_instance();
+
+void AdaDeltaSolverParam::CopyFrom(const AdaDeltaSolverParam& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.AdaDeltaSolverParam)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
 }
-::deepflow::InitGradientFillParam* InitParam::mutable_gradient_fill_param() {
-  
-  if (gradient_fill_param_ == NULL) {
-    gradient_fill_param_ = new ::deepflow::InitGradientFillParam;
-  }
-  // @@protoc_insertion_point(field_mutable:deepflow.InitParam.gradient_fill_param)
-  return gradient_fill_param_;
+
+bool AdaDeltaSolverParam::IsInitialized() const {
+  return true;
 }
-::deepflow::InitGradientFillParam* InitParam::release_gradient_fill_param() {
-  // @@protoc_insertion_point(field_release:deepflow.InitParam.gradient_fill_param)
-  
-  ::deepflow::InitGradientFillParam* temp = gradient_fill_param_;
-  gradient_fill_param_ = NULL;
-  return temp;
+
+void AdaDeltaSolverParam::Swap(AdaDeltaSolverParam* other) {
+  if (other == this) return;
+  InternalSwap(other);
 }
-void InitParam::set_allocated_gradient_fill_param(::deepflow::InitGradientFillParam* gradient_fill_param) {
-  delete gradient_fill_param_;
-  gradient_fill_param_ = gradient_fill_param;
-  if (gradient_fill_param) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_set_allocated:deepflow.InitParam.gradient_fill_param)
+void AdaDeltaSolverParam::InternalSwap(AdaDeltaSolverParam* other) {
+  std::swap(momentum_, other->momentum_);
+  std::swap(delta_, other->delta_);
+  std::swap(_cached_size_, other->_cached_size_);
 }
 
-// .deepflow.InitConstantParam constant_param = 12;
-bool InitParam::has_constant_param() const {
-  return this != internal_default_instance() && constant_param_ != NULL;
+::google::protobuf::Metadata AdaDeltaSolverParam::GetMetadata() const {
+  protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages];
 }
-void InitParam::clear_constant_param() {
-  if (GetArenaNoVirtual() == NULL && constant_param_ != NULL) delete constant_param_;
-  constant_param_ = NULL;
+
+#if PROTOBUF_INLINE_NOT_IN_HEADERS
+// AdaDeltaSolverParam
+
+// float momentum = 2;
+void AdaDeltaSolverParam::clear_momentum() {
+  momentum_ = 0;
 }
-const ::deepflow::InitConstantParam& InitParam::constant_param() const {
-  // @@protoc_insertion_point(field_get:deepflow.InitParam.constant_param)
-  return constant_param_ != NULL ? *constant_param_
-                         : *::deepflow::InitConstantParam::internal_default_instance();
+float AdaDeltaSolverParam::momentum() const {
+  // @@protoc_insertion_point(field_get:deepflow.AdaDeltaSolverParam.momentum)
+  return momentum_;
 }
-::deepflow::InitConstantParam* InitParam::mutable_constant_param() {
+void AdaDeltaSolverParam::set_momentum(float value) {
   
-  if (constant_param_ == NULL) {
-    constant_param_ = new ::deepflow::InitConstantParam;
-  }
-  // @@protoc_insertion_point(field_mutable:deepflow.InitParam.constant_param)
-  return constant_param_;
+  momentum_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.AdaDeltaSolverParam.momentum)
 }
-::deepflow::InitConstantParam* InitParam::release_constant_param() {
-  // @@protoc_insertion_point(field_release:deepflow.InitParam.constant_param)
-  
-  ::deepflow::InitConstantParam* temp = constant_param_;
-  constant_param_ = NULL;
-  return temp;
+
+// float delta = 3;
+void AdaDeltaSolverParam::clear_delta() {
+  delta_ = 0;
 }
-void InitParam::set_allocated_constant_param(::deepflow::InitConstantParam* constant_param) {
-  delete constant_param_;
-  constant_param_ = constant_param;
-  if (constant_param) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_set_allocated:deepflow.InitParam.constant_param)
+float AdaDeltaSolverParam::delta() const {
+  // @@protoc_insertion_point(field_get:deepflow.AdaDeltaSolverParam.delta)
+  return delta_;
+}
+void AdaDeltaSolverParam::set_delta(float value) {
+  
+  delta_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.AdaDeltaSolverParam.delta)
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -20528,85 +23627,119 @@ void InitParam::set_allocated_constant_param(::deepflow::InitConstantParam* cons
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int SGDSolverParam::kMomentumFieldNumber;
+const int AdamSolverParam::kBeta1FieldNumber;
+const int AdamSolverParam::kBeta2FieldNumber;
+const int AdamSolverParam::kEpsFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-SGDSolverParam::SGDSolverParam()
+AdamSolverParam::AdamSolverParam()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_deepflow_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:deepflow.SGDSolverParam)
+  // @@protoc_insertion_point(constructor:deepflow.AdamSolverParam)
 }
-SGDSolverParam::SGDSolverParam(const SGDSolverParam& from)
+AdamSolverParam::AdamSolverParam(const AdamSolverParam& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
-  momentum_ = from.momentum_;
-  // @@protoc_insertion_point(copy_constructor:deepflow.SGDSolverParam)
+  ::memcpy(&beta1_, &from.beta1_,
+    reinterpret_cast<char*>(&eps_) -
+    reinterpret_cast<char*>(&beta1_) + sizeof(eps_));
+  // @@protoc_insertion_point(copy_constructor:deepflow.AdamSolverParam)
 }
 
-void SGDSolverParam::SharedCtor() {
-  momentum_ = 0;
+void AdamSolverParam::SharedCtor() {
+  ::memset(&beta1_, 0, reinterpret_cast<char*>(&eps_) -
+    reinterpret_cast<char*>(&beta1_) + sizeof(eps_));
   _cached_size_ = 0;
 }
 
-SGDSolverParam::~SGDSolverParam() {
-  // @@protoc_insertion_point(destructor:deepflow.SGDSolverParam)
+AdamSolverParam::~AdamSolverParam() {
+  // @@protoc_insertion_point(destructor:deepflow.AdamSolverParam)
   SharedDtor();
 }
 
-void SGDSolverParam::SharedDtor() {
+void AdamSolverParam::SharedDtor() {
 }
 
-void SGDSolverParam::SetCachedSize(int size) const {
+void AdamSolverParam::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* SGDSolverParam::descriptor() {
+const ::google::protobuf::Descriptor* AdamSolverParam::descriptor() {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const SGDSolverParam& SGDSolverParam::default_instance() {
+const AdamSolverParam& AdamSolverParam::default_instance() {
   protobuf_deepflow_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-SGDSolverParam* SGDSolverParam::New(::google::protobuf::Arena* arena) const {
-  SGDSolverParam* n = new SGDSolverParam;
+AdamSolverParam* AdamSolverParam::New(::google::protobuf::Arena* arena) const {
+  AdamSolverParam* n = new AdamSolverParam;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void SGDSolverParam::Clear() {
-// @@protoc_insertion_point(message_clear_start:deepflow.SGDSolverParam)
-  momentum_ = 0;
+void AdamSolverParam::Clear() {
+// @@protoc_insertion_point(message_clear_start:deepflow.AdamSolverParam)
+  ::memset(&beta1_, 0, reinterpret_cast<char*>(&eps_) -
+    reinterpret_cast<char*>(&beta1_) + sizeof(eps_));
 }
 
-bool SGDSolverParam::MergePartialFromCodedStream(
+bool AdamSolverParam::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:deepflow.SGDSolverParam)
+  // @@protoc_insertion_point(parse_start:deepflow.AdamSolverParam)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // float momentum = 2;
+      // float beta1 = 2;
       case 2: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
             static_cast< ::google::protobuf::uint8>(21u)) {
 
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
                    float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &momentum_)));
+                 input, &beta1_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // float beta2 = 3;
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(29u)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, &beta2_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // float eps = 4;
+      case 4: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(37u)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, &eps_)));
         } else {
           goto handle_unusual;
         }
@@ -20626,49 +23759,79 @@ bool SGDSolverParam::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:deepflow.SGDSolverParam)
+  // @@protoc_insertion_point(parse_success:deepflow.AdamSolverParam)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:deepflow.SGDSolverParam)
+  // @@protoc_insertion_point(parse_failure:deepflow.AdamSolverParam)
   return false;
 #undef DO_
 }
 
-void SGDSolverParam::SerializeWithCachedSizes(
+void AdamSolverParam::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:deepflow.SGDSolverParam)
+  // @@protoc_insertion_point(serialize_start:deepflow.AdamSolverParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // float momentum = 2;
-  if (this->momentum() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(2, this->momentum(), output);
+  // float beta1 = 2;
+  if (this->beta1() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(2, this->beta1(), output);
   }
 
-  // @@protoc_insertion_point(serialize_end:deepflow.SGDSolverParam)
+  // float beta2 = 3;
+  if (this->beta2() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(3, this->beta2(), output);
+  }
+
+  // float eps = 4;
+  if (this->eps() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(4, this->eps(), output);
+  }
+
+  // @@protoc_insertion_point(serialize_end:deepflow.AdamSolverParam)
 }
 
-::google::protobuf::uint8* SGDSolverParam::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* AdamSolverParam::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:deepflow.SGDSolverParam)
+  // @@protoc_insertion_point(serialize_to_array_start:deepflow.AdamSolverParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // float momentum = 2;
-  if (this->momentum() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(2, this->momentum(), target);
+  // float beta1 = 2;
+  if (this->beta1() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(2, this->beta1(), target);
   }
 
-  // @@protoc_insertion_point(serialize_to_array_end:deepflow.SGDSolverParam)
+  // float beta2 = 3;
+  if (this->beta2() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(3, this->beta2(), target);
+  }
+
+  // float eps = 4;
+  if (this->eps() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(4, this->eps(), target);
+  }
+
+  // @@protoc_insertion_point(serialize_to_array_end:deepflow.AdamSolverParam)
   return target;
 }
 
-size_t SGDSolverParam::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:deepflow.SGDSolverParam)
+size_t AdamSolverParam::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:deepflow.AdamSolverParam)
   size_t total_size = 0;
 
-  // float momentum = 2;
-  if (this->momentum() != 0) {
+  // float beta1 = 2;
+  if (this->beta1() != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float beta2 = 3;
+  if (this->beta2() != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float eps = 4;
+  if (this->eps() != 0) {
     total_size += 1 + 4;
   }
 
@@ -20679,80 +23842,116 @@ size_t SGDSolverParam::ByteSizeLong() const {
   return total_size;
 }
 
-void SGDSolverParam::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:deepflow.SGDSolverParam)
+void AdamSolverParam::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:deepflow.AdamSolverParam)
   GOOGLE_DCHECK_NE(&from, this);
-  const SGDSolverParam* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const SGDSolverParam>(
+  const AdamSolverParam* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const AdamSolverParam>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.SGDSolverParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.AdamSolverParam)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.SGDSolverParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.AdamSolverParam)
     MergeFrom(*source);
   }
 }
 
-void SGDSolverParam::MergeFrom(const SGDSolverParam& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.SGDSolverParam)
+void AdamSolverParam::MergeFrom(const AdamSolverParam& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.AdamSolverParam)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.momentum() != 0) {
-    set_momentum(from.momentum());
+  if (from.beta1() != 0) {
+    set_beta1(from.beta1());
+  }
+  if (from.beta2() != 0) {
+    set_beta2(from.beta2());
+  }
+  if (from.eps() != 0) {
+    set_eps(from.eps());
   }
 }
 
-void SGDSolverParam::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:deepflow.SGDSolverParam)
+void AdamSolverParam::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:deepflow.AdamSolverParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void SGDSolverParam::CopyFrom(const SGDSolverParam& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.SGDSolverParam)
+void AdamSolverParam::CopyFrom(const AdamSolverParam& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.AdamSolverParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool SGDSolverParam::IsInitialized() const {
+bool AdamSolverParam::IsInitialized() const {
   return true;
 }
 
-void SGDSolverParam::Swap(SGDSolverParam* other) {
+void AdamSolverParam::Swap(AdamSolverParam* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void SGDSolverParam::InternalSwap(SGDSolverParam* other) {
-  std::swap(momentum_, other->momentum_);
+void AdamSolverParam::InternalSwap(AdamSolverParam* other) {
+  std::swap(beta1_, other->beta1_);
+  std::swap(beta2_, other->beta2_);
+  std::swap(eps_, other->eps_);
   std::swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata SGDSolverParam::GetMetadata() const {
+::google::protobuf::Metadata AdamSolverParam::GetMetadata() const {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// SGDSolverParam
-
-// float momentum = 2;
-void SGDSolverParam::clear_momentum() {
-  momentum_ = 0;
+#if PROTOBUF_INLINE_NOT_IN_HEADERS
+// AdamSolverParam
+
+// float beta1 = 2;
+void AdamSolverParam::clear_beta1() {
+  beta1_ = 0;
+}
+float AdamSolverParam::beta1() const {
+  // @@protoc_insertion_point(field_get:deepflow.AdamSolverParam.beta1)
+  return beta1_;
+}
+void AdamSolverParam::set_beta1(float value) {
+  
+  beta1_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.AdamSolverParam.beta1)
+}
+
+// float beta2 = 3;
+void AdamSolverParam::clear_beta2() {
+  beta2_ = 0;
+}
+float AdamSolverParam::beta2() const {
+  // @@protoc_insertion_point(field_get:deepflow.AdamSolverParam.beta2)
+  return beta2_;
+}
+void AdamSolverParam::set_beta2(float value) {
+  
+  beta2_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.AdamSolverParam.beta2)
+}
+
+// float eps = 4;
+void AdamSolverParam::clear_eps() {
+  eps_ = 0;
 }
-float SGDSolverParam::momentum() const {
-  // @@protoc_insertion_point(field_get:deepflow.SGDSolverParam.momentum)
-  return momentum_;
+float AdamSolverParam::eps() const {
+  // @@protoc_insertion_point(field_get:deepflow.AdamSolverParam.eps)
+  return eps_;
 }
-void SGDSolverParam::set_momentum(float value) {
+void AdamSolverParam::set_eps(float value) {
   
-  momentum_ = value;
-  // @@protoc_insertion_point(field_set:deepflow.SGDSolverParam.momentum)
+  eps_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.AdamSolverParam.eps)
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -20760,104 +23959,104 @@ void SGDSolverParam::set_momentum(float value) {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int AdaDeltaSolverParam::kMomentumFieldNumber;
-const int AdaDeltaSolverParam::kDeltaFieldNumber;
+const int RMSPropSolverParam::kRmsDecayFieldNumber;
+const int RMSPropSolverParam::kEpsFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-AdaDeltaSolverParam::AdaDeltaSolverParam()
+RMSPropSolverParam::RMSPropSolverParam()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_deepflow_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:deepflow.AdaDeltaSolverParam)
+  // @@protoc_insertion_point(constructor:deepflow.RMSPropSolverParam)
 }
-AdaDeltaSolverParam::AdaDeltaSolverParam(const AdaDeltaSolverParam& from)
+RMSPropSolverParam::RMSPropSolverParam(const RMSPropSolverParam& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::memcpy(&momentum_, &from.momentum_,
-    reinterpret_cast<char*>(&delta_) -
-    reinterpret_cast<char*>(&momentum_) + sizeof(delta_));
-  // @@protoc_insertion_point(copy_constructor:deepflow.AdaDeltaSolverParam)
+  ::memcpy(&rms_decay_, &from.rms_decay_,
+    reinterpret_cast<char*>(&eps_) -
+    reinterpret_cast<char*>(&rms_decay_) + sizeof(eps_));
+  // @@protoc_insertion_point(copy_constructor:deepflow.RMSPropSolverParam)
 }
 
-void AdaDeltaSolverParam::SharedCtor() {
-  ::memset(&momentum_, 0, reinterpret_cast<char*>(&delta_) -
-    reinterpret_cast<char*>(&momentum_) + sizeof(delta_));
+void RMSPropSolverParam::SharedCtor() {
+  ::memset(&rms_decay_, 0, reinterpret_cast<char*>(&eps_) -
+    reinterpret_cast<char*>(&rms_decay_) + sizeof(eps_));
   _cached_size_ = 0;
 }
 
-AdaDeltaSolverParam::~AdaDeltaSolverParam() {
-  // @@protoc_insertion_point(destructor:deepflow.AdaDeltaSolverParam)
+RMSPropSolverParam::~RMSPropSolverParam() {
+  // @@protoc_insertion_point(destructor:deepflow.RMSPropSolverParam)
   SharedDtor();
 }
 
-void AdaDeltaSolverParam::SharedDtor() {
+void RMSPropSolverParam::SharedDtor() {
 }
 
-void AdaDeltaSolverParam::SetCachedSize(int size) const {
+void RMSPropSolverParam::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* AdaDeltaSolverParam::descriptor() {
+const ::google::protobuf::Descriptor* RMSPropSolverParam::descriptor() {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const AdaDeltaSolverParam& AdaDeltaSolverParam::default_instance() {
+const RMSPropSolverParam& RMSPropSolverParam::default_instance() {
   protobuf_deepflow_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-AdaDeltaSolverParam* AdaDeltaSolverParam::New(::google::protobuf::Arena* arena) const {
-  AdaDeltaSolverParam* n = new AdaDeltaSolverParam;
+RMSPropSolverParam* RMSPropSolverParam::New(::google::protobuf::Arena* arena) const {
+  RMSPropSolverParam* n = new RMSPropSolverParam;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void AdaDeltaSolverParam::Clear() {
-// @@protoc_insertion_point(message_clear_start:deepflow.AdaDeltaSolverParam)
-  ::memset(&momentum_, 0, reinterpret_cast<char*>(&delta_) -
-    reinterpret_cast<char*>(&momentum_) + sizeof(delta_));
+void RMSPropSolverParam::Clear() {
+// @@protoc_insertion_point(message_clear_start:deepflow.RMSPropSolverParam)
+  ::memset(&rms_decay_, 0, reinterpret_cast<char*>(&eps_) -
+    reinterpret_cast<char*>(&rms_decay_) + sizeof(eps_));
 }
 
-bool AdaDeltaSolverParam::MergePartialFromCodedStream(
+bool RMSPropSolverParam::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:deepflow.AdaDeltaSolverParam)
+  // @@protoc_insertion_point(parse_start:deepflow.RMSPropSolverParam)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // float momentum = 2;
-      case 2: {
+      // float rms_decay = 1;
+      case 1: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(21u)) {
+            static_cast< ::google::protobuf::uint8>(13u)) {
 
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
                    float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &momentum_)));
+                 input, &rms_decay_)));
         } else {
           goto handle_unusual;
         }
         break;
       }
 
-      // float delta = 3;
-      case 3: {
+      // float eps = 2;
+      case 2: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(29u)) {
+            static_cast< ::google::protobuf::uint8>(21u)) {
 
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
                    float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &delta_)));
+                 input, &eps_)));
         } else {
           goto handle_unusual;
         }
@@ -20877,64 +24076,64 @@ bool AdaDeltaSolverParam::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:deepflow.AdaDeltaSolverParam)
+  // @@protoc_insertion_point(parse_success:deepflow.RMSPropSolverParam)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:deepflow.AdaDeltaSolverParam)
+  // @@protoc_insertion_point(parse_failure:deepflow.RMSPropSolverParam)
   return false;
 #undef DO_
 }
 
-void AdaDeltaSolverParam::SerializeWithCachedSizes(
+void RMSPropSolverParam::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:deepflow.AdaDeltaSolverParam)
+  // @@protoc_insertion_point(serialize_start:deepflow.RMSPropSolverParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // float momentum = 2;
-  if (this->momentum() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(2, this->momentum(), output);
+  // float rms_decay = 1;
+  if (this->rms_decay() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(1, this->rms_decay(), output);
   }
 
-  // float delta = 3;
-  if (this->delta() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(3, this->delta(), output);
+  // float eps = 2;
+  if (this->eps() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(2, this->eps(), output);
   }
 
-  // @@protoc_insertion_point(serialize_end:deepflow.AdaDeltaSolverParam)
+  // @@protoc_insertion_point(serialize_end:deepflow.RMSPropSolverParam)
 }
 
-::google::protobuf::uint8* AdaDeltaSolverParam::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* RMSPropSolverParam::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:deepflow.AdaDeltaSolverParam)
+  // @@protoc_insertion_point(serialize_to_array_start:deepflow.RMSPropSolverParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // float momentum = 2;
-  if (this->momentum() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(2, this->momentum(), target);
+  // float rms_decay = 1;
+  if (this->rms_decay() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(1, this->rms_decay(), target);
   }
 
-  // float delta = 3;
-  if (this->delta() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(3, this->delta(), target);
+  // float eps = 2;
+  if (this->eps() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(2, this->eps(), target);
   }
 
-  // @@protoc_insertion_point(serialize_to_array_end:deepflow.AdaDeltaSolverParam)
+  // @@protoc_insertion_point(serialize_to_array_end:deepflow.RMSPropSolverParam)
   return target;
 }
 
-size_t AdaDeltaSolverParam::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:deepflow.AdaDeltaSolverParam)
+size_t RMSPropSolverParam::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:deepflow.RMSPropSolverParam)
   size_t total_size = 0;
 
-  // float momentum = 2;
-  if (this->momentum() != 0) {
+  // float rms_decay = 1;
+  if (this->rms_decay() != 0) {
     total_size += 1 + 4;
   }
 
-  // float delta = 3;
-  if (this->delta() != 0) {
+  // float eps = 2;
+  if (this->eps() != 0) {
     total_size += 1 + 4;
   }
 
@@ -20945,98 +24144,98 @@ size_t AdaDeltaSolverParam::ByteSizeLong() const {
   return total_size;
 }
 
-void AdaDeltaSolverParam::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:deepflow.AdaDeltaSolverParam)
+void RMSPropSolverParam::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:deepflow.RMSPropSolverParam)
   GOOGLE_DCHECK_NE(&from, this);
-  const AdaDeltaSolverParam* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const AdaDeltaSolverParam>(
+  const RMSPropSolverParam* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const RMSPropSolverParam>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.AdaDeltaSolverParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.RMSPropSolverParam)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.AdaDeltaSolverParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.RMSPropSolverParam)
     MergeFrom(*source);
   }
 }
 
-void AdaDeltaSolverParam::MergeFrom(const AdaDeltaSolverParam& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.AdaDeltaSolverParam)
+void RMSPropSolverParam::MergeFrom(const RMSPropSolverParam& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.RMSPropSolverParam)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.momentum() != 0) {
-    set_momentum(from.momentum());
+  if (from.rms_decay() != 0) {
+    set_rms_decay(from.rms_decay());
   }
-  if (from.delta() != 0) {
-    set_delta(from.delta());
+  if (from.eps() != 0) {
+    set_eps(from.eps());
   }
 }
 
-void AdaDeltaSolverParam::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:deepflow.AdaDeltaSolverParam)
+void RMSPropSolverParam::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:deepflow.RMSPropSolverParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void AdaDeltaSolverParam::CopyFrom(const AdaDeltaSolverParam& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.AdaDeltaSolverParam)
+void RMSPropSolverParam::CopyFrom(const RMSPropSolverParam& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.RMSPropSolverParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool AdaDeltaSolverParam::IsInitialized() const {
+bool RMSPropSolverParam::IsInitialized() const {
   return true;
 }
 
-void AdaDeltaSolverParam::Swap(AdaDeltaSolverParam* other) {
+void RMSPropSolverParam::Swap(RMSPropSolverParam* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void AdaDeltaSolverParam::InternalSwap(AdaDeltaSolverParam* other) {
-  std::swap(momentum_, other->momentum_);
-  std::swap(delta_, other->delta_);
+void RMSPropSolverParam::InternalSwap(RMSPropSolverParam* other) {
+  std::swap(rms_decay_, other->rms_decay_);
+  std::swap(eps_, other->eps_);
   std::swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata AdaDeltaSolverParam::GetMetadata() const {
+::google::protobuf::Metadata RMSPropSolverParam::GetMetadata() const {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// AdaDeltaSolverParam
+// RMSPropSolverParam
 
-// float momentum = 2;
-void AdaDeltaSolverParam::clear_momentum() {
-  momentum_ = 0;
+// float rms_decay = 1;
+void RMSPropSolverParam::clear_rms_decay() {
+  rms_decay_ = 0;
 }
-float AdaDeltaSolverParam::momentum() const {
-  // @@protoc_insertion_point(field_get:deepflow.AdaDeltaSolverParam.momentum)
-  return momentum_;
+float RMSPropSolverParam::rms_decay() const {
+  // @@protoc_insertion_point(field_get:deepflow.RMSPropSolverParam.rms_decay)
+  return rms_decay_;
 }
-void AdaDeltaSolverParam::set_momentum(float value) {
+void RMSPropSolverParam::set_rms_decay(float value) {
   
-  momentum_ = value;
-  // @@protoc_insertion_point(field_set:deepflow.AdaDeltaSolverParam.momentum)
+  rms_decay_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.RMSPropSolverParam.rms_decay)
 }
 
-// float delta = 3;
-void AdaDeltaSolverParam::clear_delta() {
-  delta_ = 0;
+// float eps = 2;
+void RMSPropSolverParam::clear_eps() {
+  eps_ = 0;
 }
-float AdaDeltaSolverParam::delta() const {
-  // @@protoc_insertion_point(field_get:deepflow.AdaDeltaSolverParam.delta)
-  return delta_;
+float RMSPropSolverParam::eps() const {
+  // @@protoc_insertion_point(field_get:deepflow.RMSPropSolverParam.eps)
+  return eps_;
 }
-void AdaDeltaSolverParam::set_delta(float value) {
+void RMSPropSolverParam::set_eps(float value) {
   
-  delta_ = value;
-  // @@protoc_insertion_point(field_set:deepflow.AdaDeltaSolverParam.delta)
+  eps_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.RMSPropSolverParam.eps)
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -21044,119 +24243,234 @@ void AdaDeltaSolverParam::set_delta(float value) {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int AdamSolverParam::kBeta1FieldNumber;
-const int AdamSolverParam::kBeta2FieldNumber;
-const int AdamSolverParam::kEpsFieldNumber;
+const int SolverParam::kNameFieldNumber;
+const int SolverParam::kLearningRateFieldNumber;
+const int SolverParam::kSgdSolverFieldNumber;
+const int SolverParam::kAdamSolverFieldNumber;
+const int SolverParam::kAdadeltaSolverFieldNumber;
+const int SolverParam::kRmspropSolverFieldNumber;
+const int SolverParam::kScopeFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-AdamSolverParam::AdamSolverParam()
+SolverParam::SolverParam()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_deepflow_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:deepflow.AdamSolverParam)
+  // @@protoc_insertion_point(constructor:deepflow.SolverParam)
 }
-AdamSolverParam::AdamSolverParam(const AdamSolverParam& from)
+SolverParam::SolverParam(const SolverParam& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::memcpy(&beta1_, &from.beta1_,
-    reinterpret_cast<char*>(&eps_) -
-    reinterpret_cast<char*>(&beta1_) + sizeof(eps_));
-  // @@protoc_insertion_point(copy_constructor:deepflow.AdamSolverParam)
+  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.name().size() > 0) {
+    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
+  }
+  scope_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.scope().size() > 0) {
+    scope_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.scope_);
+  }
+  if (from.has_sgd_solver()) {
+    sgd_solver_ = new ::deepflow::SGDSolverParam(*from.sgd_solver_);
+  } else {
+    sgd_solver_ = NULL;
+  }
+  if (from.has_adam_solver()) {
+    adam_solver_ = new ::deepflow::AdamSolverParam(*from.adam_solver_);
+  } else {
+    adam_solver_ = NULL;
+  }
+  if (from.has_adadelta_solver()) {
+    adadelta_solver_ = new ::deepflow::AdaDeltaSolverParam(*from.adadelta_solver_);
+  } else {
+    adadelta_solver_ = NULL;
+  }
+  if (from.has_rmsprop_solver()) {
+    rmsprop_solver_ = new ::deepflow::RMSPropSolverParam(*from.rmsprop_solver_);
+  } else {
+    rmsprop_solver_ = NULL;
+  }
+  learning_rate_ = from.learning_rate_;
+  // @@protoc_insertion_point(copy_constructor:deepflow.SolverParam)
 }
 
-void AdamSolverParam::SharedCtor() {
-  ::memset(&beta1_, 0, reinterpret_cast<char*>(&eps_) -
-    reinterpret_cast<char*>(&beta1_) + sizeof(eps_));
+void SolverParam::SharedCtor() {
+  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  scope_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::memset(&sgd_solver_, 0, reinterpret_cast<char*>(&learning_rate_) -
+    reinterpret_cast<char*>(&sgd_solver_) + sizeof(learning_rate_));
   _cached_size_ = 0;
 }
 
-AdamSolverParam::~AdamSolverParam() {
-  // @@protoc_insertion_point(destructor:deepflow.AdamSolverParam)
+SolverParam::~SolverParam() {
+  // @@protoc_insertion_point(destructor:deepflow.SolverParam)
   SharedDtor();
 }
 
-void AdamSolverParam::SharedDtor() {
+void SolverParam::SharedDtor() {
+  name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  scope_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (this != internal_default_instance()) {
+    delete sgd_solver_;
+  }
+  if (this != internal_default_instance()) {
+    delete adam_solver_;
+  }
+  if (this != internal_default_instance()) {
+    delete adadelta_solver_;
+  }
+  if (this != internal_default_instance()) {
+    delete rmsprop_solver_;
+  }
 }
 
-void AdamSolverParam::SetCachedSize(int size) const {
+void SolverParam::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* AdamSolverParam::descriptor() {
+const ::google::protobuf::Descriptor* SolverParam::descriptor() {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const AdamSolverParam& AdamSolverParam::default_instance() {
+const SolverParam& SolverParam::default_instance() {
   protobuf_deepflow_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-AdamSolverParam* AdamSolverParam::New(::google::protobuf::Arena* arena) const {
-  AdamSolverParam* n = new AdamSolverParam;
+SolverParam* SolverParam::New(::google::protobuf::Arena* arena) const {
+  SolverParam* n = new SolverParam;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void AdamSolverParam::Clear() {
-// @@protoc_insertion_point(message_clear_start:deepflow.AdamSolverParam)
-  ::memset(&beta1_, 0, reinterpret_cast<char*>(&eps_) -
-    reinterpret_cast<char*>(&beta1_) + sizeof(eps_));
+void SolverParam::Clear() {
+// @@protoc_insertion_point(message_clear_start:deepflow.SolverParam)
+  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  scope_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (GetArenaNoVirtual() == NULL && sgd_solver_ != NULL) {
+    delete sgd_solver_;
+  }
+  sgd_solver_ = NULL;
+  if (GetArenaNoVirtual() == NULL && adam_solver_ != NULL) {
+    delete adam_solver_;
+  }
+  adam_solver_ = NULL;
+  if (GetArenaNoVirtual() == NULL && adadelta_solver_ != NULL) {
+    delete adadelta_solver_;
+  }
+  adadelta_solver_ = NULL;
+  if (GetArenaNoVirtual() == NULL && rmsprop_solver_ != NULL) {
+    delete rmsprop_solver_;
+  }
+  rmsprop_solver_ = NULL;
+  learning_rate_ = 0;
 }
 
-bool AdamSolverParam::MergePartialFromCodedStream(
+bool SolverParam::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:deepflow.AdamSolverParam)
+  // @@protoc_insertion_point(parse_start:deepflow.SolverParam)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // float beta1 = 2;
+      // string name = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(10u)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_name()));
+          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            this->name().data(), this->name().length(),
+            ::google::protobuf::internal::WireFormatLite::PARSE,
+            "deepflow.SolverParam.name"));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // float learning_rate = 2;
       case 2: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
             static_cast< ::google::protobuf::uint8>(21u)) {
 
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
                    float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &beta1_)));
+                 input, &learning_rate_)));
         } else {
           goto handle_unusual;
         }
         break;
       }
 
-      // float beta2 = 3;
+      // .deepflow.SGDSolverParam sgd_solver = 3;
       case 3: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(29u)) {
+            static_cast< ::google::protobuf::uint8>(26u)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_sgd_solver()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
 
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &beta2_)));
+      // .deepflow.AdamSolverParam adam_solver = 5;
+      case 5: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(42u)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_adam_solver()));
         } else {
           goto handle_unusual;
         }
         break;
       }
 
-      // float eps = 4;
-      case 4: {
+      // .deepflow.AdaDeltaSolverParam adadelta_solver = 6;
+      case 6: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(37u)) {
+            static_cast< ::google::protobuf::uint8>(50u)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_adadelta_solver()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
 
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &eps_)));
+      // .deepflow.RMSPropSolverParam rmsprop_solver = 7;
+      case 7: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(58u)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_rmsprop_solver()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // string scope = 8;
+      case 8: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(66u)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_scope()));
+          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            this->scope().data(), this->scope().length(),
+            ::google::protobuf::internal::WireFormatLite::PARSE,
+            "deepflow.SolverParam.scope"));
         } else {
           goto handle_unusual;
         }
@@ -21176,79 +24490,185 @@ bool AdamSolverParam::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:deepflow.AdamSolverParam)
+  // @@protoc_insertion_point(parse_success:deepflow.SolverParam)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:deepflow.AdamSolverParam)
+  // @@protoc_insertion_point(parse_failure:deepflow.SolverParam)
   return false;
 #undef DO_
 }
 
-void AdamSolverParam::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:deepflow.AdamSolverParam)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+void SolverParam::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:deepflow.SolverParam)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (this->name().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->name().data(), this->name().length(),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "deepflow.SolverParam.name");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      1, this->name(), output);
+  }
+
+  // float learning_rate = 2;
+  if (this->learning_rate() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(2, this->learning_rate(), output);
+  }
+
+  // .deepflow.SGDSolverParam sgd_solver = 3;
+  if (this->has_sgd_solver()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      3, *this->sgd_solver_, output);
+  }
+
+  // .deepflow.AdamSolverParam adam_solver = 5;
+  if (this->has_adam_solver()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      5, *this->adam_solver_, output);
+  }
+
+  // .deepflow.AdaDeltaSolverParam adadelta_solver = 6;
+  if (this->has_adadelta_solver()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      6, *this->adadelta_solver_, output);
+  }
+
+  // .deepflow.RMSPropSolverParam rmsprop_solver = 7;
+  if (this->has_rmsprop_solver()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      7, *this->rmsprop_solver_, output);
+  }
+
+  // string scope = 8;
+  if (this->scope().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->scope().data(), this->scope().length(),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "deepflow.SolverParam.scope");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      8, this->scope(), output);
+  }
+
+  // @@protoc_insertion_point(serialize_end:deepflow.SolverParam)
+}
+
+::google::protobuf::uint8* SolverParam::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:deepflow.SolverParam)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (this->name().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->name().data(), this->name().length(),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "deepflow.SolverParam.name");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        1, this->name(), target);
+  }
+
+  // float learning_rate = 2;
+  if (this->learning_rate() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(2, this->learning_rate(), target);
+  }
+
+  // .deepflow.SGDSolverParam sgd_solver = 3;
+  if (this->has_sgd_solver()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        3, *this->sgd_solver_, deterministic, target);
+  }
+
+  // .deepflow.AdamSolverParam adam_solver = 5;
+  if (this->has_adam_solver()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        5, *this->adam_solver_, deterministic, target);
+  }
 
-  // float beta1 = 2;
-  if (this->beta1() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(2, this->beta1(), output);
+  // .deepflow.AdaDeltaSolverParam adadelta_solver = 6;
+  if (this->has_adadelta_solver()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        6, *this->adadelta_solver_, deterministic, target);
   }
 
-  // float beta2 = 3;
-  if (this->beta2() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(3, this->beta2(), output);
+  // .deepflow.RMSPropSolverParam rmsprop_solver = 7;
+  if (this->has_rmsprop_solver()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        7, *this->rmsprop_solver_, deterministic, target);
   }
 
-  // float eps = 4;
-  if (this->eps() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(4, this->eps(), output);
+  // string scope = 8;
+  if (this->scope().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->scope().data(), this->scope().length(),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "deepflow.SolverParam.scope");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        8, this->scope(), target);
   }
 
-  // @@protoc_insertion_point(serialize_end:deepflow.AdamSolverParam)
+  // @@protoc_insertion_point(serialize_to_array_end:deepflow.SolverParam)
+  return target;
 }
 
-::google::protobuf::uint8* AdamSolverParam::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:deepflow.AdamSolverParam)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+size_t SolverParam::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:deepflow.SolverParam)
+  size_t total_size = 0;
 
-  // float beta1 = 2;
-  if (this->beta1() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(2, this->beta1(), target);
+  // string name = 1;
+  if (this->name().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::StringSize(
+        this->name());
   }
 
-  // float beta2 = 3;
-  if (this->beta2() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(3, this->beta2(), target);
+  // string scope = 8;
+  if (this->scope().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::StringSize(
+        this->scope());
   }
 
-  // float eps = 4;
-  if (this->eps() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(4, this->eps(), target);
+  // .deepflow.SGDSolverParam sgd_solver = 3;
+  if (this->has_sgd_solver()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        *this->sgd_solver_);
   }
 
-  // @@protoc_insertion_point(serialize_to_array_end:deepflow.AdamSolverParam)
-  return target;
-}
-
-size_t AdamSolverParam::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:deepflow.AdamSolverParam)
-  size_t total_size = 0;
+  // .deepflow.AdamSolverParam adam_solver = 5;
+  if (this->has_adam_solver()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        *this->adam_solver_);
+  }
 
-  // float beta1 = 2;
-  if (this->beta1() != 0) {
-    total_size += 1 + 4;
+  // .deepflow.AdaDeltaSolverParam adadelta_solver = 6;
+  if (this->has_adadelta_solver()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        *this->adadelta_solver_);
   }
 
-  // float beta2 = 3;
-  if (this->beta2() != 0) {
-    total_size += 1 + 4;
+  // .deepflow.RMSPropSolverParam rmsprop_solver = 7;
+  if (this->has_rmsprop_solver()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        *this->rmsprop_solver_);
   }
 
-  // float eps = 4;
-  if (this->eps() != 0) {
+  // float learning_rate = 2;
+  if (this->learning_rate() != 0) {
     total_size += 1 + 4;
   }
 
@@ -21259,116 +24679,368 @@ size_t AdamSolverParam::ByteSizeLong() const {
   return total_size;
 }
 
-void AdamSolverParam::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:deepflow.AdamSolverParam)
+void SolverParam::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:deepflow.SolverParam)
   GOOGLE_DCHECK_NE(&from, this);
-  const AdamSolverParam* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const AdamSolverParam>(
+  const SolverParam* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const SolverParam>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.AdamSolverParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.SolverParam)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.AdamSolverParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.SolverParam)
     MergeFrom(*source);
   }
 }
 
-void AdamSolverParam::MergeFrom(const AdamSolverParam& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.AdamSolverParam)
+void SolverParam::MergeFrom(const SolverParam& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.SolverParam)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.beta1() != 0) {
-    set_beta1(from.beta1());
+  if (from.name().size() > 0) {
+
+    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
   }
-  if (from.beta2() != 0) {
-    set_beta2(from.beta2());
+  if (from.scope().size() > 0) {
+
+    scope_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.scope_);
   }
-  if (from.eps() != 0) {
-    set_eps(from.eps());
+  if (from.has_sgd_solver()) {
+    mutable_sgd_solver()->::deepflow::SGDSolverParam::MergeFrom(from.sgd_solver());
+  }
+  if (from.has_adam_solver()) {
+    mutable_adam_solver()->::deepflow::AdamSolverParam::MergeFrom(from.adam_solver());
+  }
+  if (from.has_adadelta_solver()) {
+    mutable_adadelta_solver()->::deepflow::AdaDeltaSolverParam::MergeFrom(from.adadelta_solver());
+  }
+  if (from.has_rmsprop_solver()) {
+    mutable_rmsprop_solver()->::deepflow::RMSPropSolverParam::MergeFrom(from.rmsprop_solver());
+  }
+  if (from.learning_rate() != 0) {
+    set_learning_rate(from.learning_rate());
   }
 }
 
-void AdamSolverParam::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:deepflow.AdamSolverParam)
+void SolverParam::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:deepflow.SolverParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void AdamSolverParam::CopyFrom(const AdamSolverParam& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.AdamSolverParam)
+void SolverParam::CopyFrom(const SolverParam& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.SolverParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool AdamSolverParam::IsInitialized() const {
+bool SolverParam::IsInitialized() const {
   return true;
 }
 
-void AdamSolverParam::Swap(AdamSolverParam* other) {
+void SolverParam::Swap(SolverParam* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void AdamSolverParam::InternalSwap(AdamSolverParam* other) {
-  std::swap(beta1_, other->beta1_);
-  std::swap(beta2_, other->beta2_);
-  std::swap(eps_, other->eps_);
+void SolverParam::InternalSwap(SolverParam* other) {
+  name_.Swap(&other->name_);
+  scope_.Swap(&other->scope_);
+  std::swap(sgd_solver_, other->sgd_solver_);
+  std::swap(adam_solver_, other->adam_solver_);
+  std::swap(adadelta_solver_, other->adadelta_solver_);
+  std::swap(rmsprop_solver_, other->rmsprop_solver_);
+  std::swap(learning_rate_, other->learning_rate_);
   std::swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata AdamSolverParam::GetMetadata() const {
+::google::protobuf::Metadata SolverParam::GetMetadata() const {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// AdamSolverParam
+// SolverParam
 
-// float beta1 = 2;
-void AdamSolverParam::clear_beta1() {
-  beta1_ = 0;
+// string name = 1;
+void SolverParam::clear_name() {
+  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-float AdamSolverParam::beta1() const {
-  // @@protoc_insertion_point(field_get:deepflow.AdamSolverParam.beta1)
-  return beta1_;
+const ::std::string& SolverParam::name() const {
+  // @@protoc_insertion_point(field_get:deepflow.SolverParam.name)
+  return name_.GetNoArena();
 }
-void AdamSolverParam::set_beta1(float value) {
+void SolverParam::set_name(const ::std::string& value) {
   
-  beta1_ = value;
-  // @@protoc_insertion_point(field_set:deepflow.AdamSolverParam.beta1)
+  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:deepflow.SolverParam.name)
+}
+#if LANG_CXX11
+void SolverParam::set_name(::std::string&& value) {
+  
+  name_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:deepflow.SolverParam.name)
+}
+#endif
+void SolverParam::set_name(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:deepflow.SolverParam.name)
+}
+void SolverParam::set_name(const char* value, size_t size) {
+  
+  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:deepflow.SolverParam.name)
+}
+::std::string* SolverParam::mutable_name() {
+  
+  // @@protoc_insertion_point(field_mutable:deepflow.SolverParam.name)
+  return name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+::std::string* SolverParam::release_name() {
+  // @@protoc_insertion_point(field_release:deepflow.SolverParam.name)
+  
+  return name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+void SolverParam::set_allocated_name(::std::string* name) {
+  if (name != NULL) {
+    
+  } else {
+    
+  }
+  name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name);
+  // @@protoc_insertion_point(field_set_allocated:deepflow.SolverParam.name)
 }
 
-// float beta2 = 3;
-void AdamSolverParam::clear_beta2() {
-  beta2_ = 0;
+// float learning_rate = 2;
+void SolverParam::clear_learning_rate() {
+  learning_rate_ = 0;
 }
-float AdamSolverParam::beta2() const {
-  // @@protoc_insertion_point(field_get:deepflow.AdamSolverParam.beta2)
-  return beta2_;
+float SolverParam::learning_rate() const {
+  // @@protoc_insertion_point(field_get:deepflow.SolverParam.learning_rate)
+  return learning_rate_;
 }
-void AdamSolverParam::set_beta2(float value) {
+void SolverParam::set_learning_rate(float value) {
   
-  beta2_ = value;
-  // @@protoc_insertion_point(field_set:deepflow.AdamSolverParam.beta2)
+  learning_rate_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.SolverParam.learning_rate)
 }
 
-// float eps = 4;
-void AdamSolverParam::clear_eps() {
-  eps_ = 0;
+// .deepflow.SGDSolverParam sgd_solver = 3;
+bool SolverParam::has_sgd_solver() const {
+  return this != internal_default_instance() && sgd_solver_ != NULL;
 }
-float AdamSolverParam::eps() const {
-  // @@protoc_insertion_point(field_get:deepflow.AdamSolverParam.eps)
-  return eps_;
+void SolverParam::clear_sgd_solver() {
+  if (GetArenaNoVirtual() == NULL && sgd_solver_ != NULL) delete sgd_solver_;
+  sgd_solver_ = NULL;
 }
-void AdamSolverParam::set_eps(float value) {
+const ::deepflow::SGDSolverParam& SolverParam::sgd_solver() const {
+  // @@protoc_insertion_point(field_get:deepflow.SolverParam.sgd_solver)
+  return sgd_solver_ != NULL ? *sgd_solver_
+                         : *::deepflow::SGDSolverParam::internal_default_instance();
+}
+::deepflow::SGDSolverParam* SolverParam::mutable_sgd_solver() {
   
-  eps_ = value;
-  // @@protoc_insertion_point(field_set:deepflow.AdamSolverParam.eps)
+  if (sgd_solver_ == NULL) {
+    sgd_solver_ = new ::deepflow::SGDSolverParam;
+  }
+  // @@protoc_insertion_point(field_mutable:deepflow.SolverParam.sgd_solver)
+  return sgd_solver_;
+}
+::deepflow::SGDSolverParam* SolverParam::release_sgd_solver() {
+  // @@protoc_insertion_point(field_release:deepflow.SolverParam.sgd_solver)
+  
+  ::deepflow::SGDSolverParam* temp = sgd_solver_;
+  sgd_solver_ = NULL;
+  return temp;
+}
+void SolverParam::set_allocated_sgd_solver(::deepflow::SGDSolverParam* sgd_solver) {
+  delete sgd_solver_;
+  sgd_solver_ = sgd_solver;
+  if (sgd_solver) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:deepflow.SolverParam.sgd_solver)
+}
+
+// .deepflow.AdamSolverParam adam_solver = 5;
+bool SolverParam::has_adam_solver() const {
+  return this != internal_default_instance() && adam_solver_ != NULL;
+}
+void SolverParam::clear_adam_solver() {
+  if (GetArenaNoVirtual() == NULL && adam_solver_ != NULL) delete adam_solver_;
+  adam_solver_ = NULL;
+}
+const ::deepflow::AdamSolverParam& SolverParam::adam_solver() const {
+  // @@protoc_insertion_point(field_get:deepflow.SolverParam.adam_solver)
+  return adam_solver_ != NULL ? *adam_solver_
+                         : *::deepflow::AdamSolverParam::internal_default_instance();
+}
+::deepflow::AdamSolverParam* SolverParam::mutable_adam_solver() {
+  
+  if (adam_solver_ == NULL) {
+    adam_solver_ = new ::deepflow::AdamSolverParam;
+  }
+  // @@protoc_insertion_point(field_mutable:deepflow.SolverParam.adam_solver)
+  return adam_solver_;
+}
+::deepflow::AdamSolverParam* SolverParam::release_adam_solver() {
+  // @@protoc_insertion_point(field_release:deepflow.SolverParam.adam_solver)
+  
+  ::deepflow::AdamSolverParam* temp = adam_solver_;
+  adam_solver_ = NULL;
+  return temp;
+}
+void SolverParam::set_allocated_adam_solver(::deepflow::AdamSolverParam* adam_solver) {
+  delete adam_solver_;
+  adam_solver_ = adam_solver;
+  if (adam_solver) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:deepflow.SolverParam.adam_solver)
+}
+
+// .deepflow.AdaDeltaSolverParam adadelta_solver = 6;
+bool SolverParam::has_adadelta_solver() const {
+  return this != internal_default_instance() && adadelta_solver_ != NULL;
+}
+void SolverParam::clear_adadelta_solver() {
+  if (GetArenaNoVirtual() == NULL && adadelta_solver_ != NULL) delete adadelta_solver_;
+  adadelta_solver_ = NULL;
+}
+const ::deepflow::AdaDeltaSolverParam& SolverParam::adadelta_solver() const {
+  // @@protoc_insertion_point(field_get:deepflow.SolverParam.adadelta_solver)
+  return adadelta_solver_ != NULL ? *adadelta_solver_
+                         : *::deepflow::AdaDeltaSolverParam::internal_default_instance();
+}
+::deepflow::AdaDeltaSolverParam* SolverParam::mutable_adadelta_solver() {
+  
+  if (adadelta_solver_ == NULL) {
+    adadelta_solver_ = new ::deepflow::AdaDeltaSolverParam;
+  }
+  // @@protoc_insertion_point(field_mutable:deepflow.SolverParam.adadelta_solver)
+  return adadelta_solver_;
+}
+::deepflow::AdaDeltaSolverParam* SolverParam::release_adadelta_solver() {
+  // @@protoc_insertion_point(field_release:deepflow.SolverParam.adadelta_solver)
+  
+  ::deepflow::AdaDeltaSolverParam* temp = adadelta_solver_;
+  adadelta_solver_ = NULL;
+  return temp;
+}
+void SolverParam::set_allocated_adadelta_solver(::deepflow::AdaDeltaSolverParam* adadelta_solver) {
+  delete adadelta_solver_;
+  adadelta_solver_ = adadelta_solver;
+  if (adadelta_solver) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:deepflow.SolverParam.adadelta_solver)
+}
+
+// .deepflow.RMSPropSolverParam rmsprop_solver = 7;
+bool SolverParam::has_rmsprop_solver() const {
+  return this != internal_default_instance() && rmsprop_solver_ != NULL;
+}
+void SolverParam::clear_rmsprop_solver() {
+  if (GetArenaNoVirtual() == NULL && rmsprop_solver_ != NULL) delete rmsprop_solver_;
+  rmsprop_solver_ = NULL;
+}
+const ::deepflow::RMSPropSolverParam& SolverParam::rmsprop_solver() const {
+  // @@protoc_insertion_point(field_get:deepflow.SolverParam.rmsprop_solver)
+  return rmsprop_solver_ != NULL ? *rmsprop_solver_
+                         : *::deepflow::RMSPropSolverParam::internal_default_instance();
+}
+::deepflow::RMSPropSolverParam* SolverParam::mutable_rmsprop_solver() {
+  
+  if (rmsprop_solver_ == NULL) {
+    rmsprop_solver_ = new ::deepflow::RMSPropSolverParam;
+  }
+  // @@protoc_insertion_point(field_mutable:deepflow.SolverParam.rmsprop_solver)
+  return rmsprop_solver_;
+}
+::deepflow::RMSPropSolverParam* SolverParam::release_rmsprop_solver() {
+  // @@protoc_insertion_point(field_release:deepflow.SolverParam.rmsprop_solver)
+  
+  ::deepflow::RMSPropSolverParam* temp = rmsprop_solver_;
+  rmsprop_solver_ = NULL;
+  return temp;
+}
+void SolverParam::set_allocated_rmsprop_solver(::deepflow::RMSPropSolverParam* rmsprop_solver) {
+  delete rmsprop_solver_;
+  rmsprop_solver_ = rmsprop_solver;
+  if (rmsprop_solver) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:deepflow.SolverParam.rmsprop_solver)
+}
+
+// string scope = 8;
+void SolverParam::clear_scope() {
+  scope_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+const ::std::string& SolverParam::scope() const {
+  // @@protoc_insertion_point(field_get:deepflow.SolverParam.scope)
+  return scope_.GetNoArena();
+}
+void SolverParam::set_scope(const ::std::string& value) {
+  
+  scope_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:deepflow.SolverParam.scope)
+}
+#if LANG_CXX11
+void SolverParam::set_scope(::std::string&& value) {
+  
+  scope_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:deepflow.SolverParam.scope)
+}
+#endif
+void SolverParam::set_scope(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  scope_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:deepflow.SolverParam.scope)
+}
+void SolverParam::set_scope(const char* value, size_t size) {
+  
+  scope_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:deepflow.SolverParam.scope)
+}
+::std::string* SolverParam::mutable_scope() {
+  
+  // @@protoc_insertion_point(field_mutable:deepflow.SolverParam.scope)
+  return scope_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+::std::string* SolverParam::release_scope() {
+  // @@protoc_insertion_point(field_release:deepflow.SolverParam.scope)
+  
+  return scope_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+void SolverParam::set_allocated_scope(::std::string* scope) {
+  if (scope != NULL) {
+    
+  } else {
+    
+  }
+  scope_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), scope);
+  // @@protoc_insertion_point(field_set_allocated:deepflow.SolverParam.scope)
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -21376,104 +25048,130 @@ void AdamSolverParam::set_eps(float value) {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int RMSPropSolverParam::kRmsDecayFieldNumber;
-const int RMSPropSolverParam::kEpsFieldNumber;
+const int FrozenParam_Output::kNameFieldNumber;
+const int FrozenParam_Output::kDimsFieldNumber;
+const int FrozenParam_Output::kOffsetFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-RMSPropSolverParam::RMSPropSolverParam()
+FrozenParam_Output::FrozenParam_Output()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_deepflow_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:deepflow.RMSPropSolverParam)
+  // @@protoc_insertion_point(constructor:deepflow.FrozenParam.Output)
 }
-RMSPropSolverParam::RMSPropSolverParam(const RMSPropSolverParam& from)
+FrozenParam_Output::FrozenParam_Output(const FrozenParam_Output& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
+      dims_(from.dims_),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::memcpy(&rms_decay_, &from.rms_decay_,
-    reinterpret_cast<char*>(&eps_) -
-    reinterpret_cast<char*>(&rms_decay_) + sizeof(eps_));
-  // @@protoc_insertion_point(copy_constructor:deepflow.RMSPropSolverParam)
+  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.name().size() > 0) {
+    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
+  }
+  offset_ = from.offset_;
+  // @@protoc_insertion_point(copy_constructor:deepflow.FrozenParam.Output)
 }
 
-void RMSPropSolverParam::SharedCtor() {
-  ::memset(&rms_decay_, 0, reinterpret_cast<char*>(&eps_) -
-    reinterpret_cast<char*>(&rms_decay_) + sizeof(eps_));
+void FrozenParam_Output::SharedCtor() {
+  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  offset_ = GOOGLE_LONGLONG(0);
   _cached_size_ = 0;
 }
 
-RMSPropSolverParam::~RMSPropSolverParam() {
-  // @@protoc_insertion_point(destructor:deepflow.RMSPropSolverParam)
+FrozenParam_Output::~FrozenParam_Output() {
+  // @@protoc_insertion_point(destructor:deepflow.FrozenParam.Output)
   SharedDtor();
 }
 
-void RMSPropSolverParam::SharedDtor() {
+void FrozenParam_Output::SharedDtor() {
+  name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
 
-void RMSPropSolverParam::SetCachedSize(int size) const {
+void FrozenParam_Output::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* RMSPropSolverParam::descriptor() {
+const ::google::protobuf::Descriptor* FrozenParam_Output::descriptor() {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const RMSPropSolverParam& RMSPropSolverParam::default_instance() {
+const FrozenParam_Output& FrozenParam_Output::default_instance() {
   protobuf_deepflow_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-RMSPropSolverParam* RMSPropSolverParam::New(::google::protobuf::Arena* arena) const {
-  RMSPropSolverParam* n = new RMSPropSolverParam;
+FrozenParam_Output* FrozenParam_Output::New(::google::protobuf::Arena* arena) const {
+  FrozenParam_Output* n = new FrozenParam_Output;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void RMSPropSolverParam::Clear() {
-// @@protoc_insertion_point(message_clear_start:deepflow.RMSPropSolverParam)
-  ::memset(&rms_decay_, 0, reinterpret_cast<char*>(&eps_) -
-    reinterpret_cast<char*>(&rms_decay_) + sizeof(eps_));
+void FrozenParam_Output::Clear() {
+// @@protoc_insertion_point(message_clear_start:deepflow.FrozenParam.Output)
+  dims_.Clear();
+  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  offset_ = GOOGLE_LONGLONG(0);
 }
 
-bool RMSPropSolverParam::MergePartialFromCodedStream(
+bool FrozenParam_Output::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:deepflow.RMSPropSolverParam)
+  // @@protoc_insertion_point(parse_start:deepflow.FrozenParam.Output)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
     if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // float rms_decay = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(13u)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &rms_decay_)));
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // string name = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(10u)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_name()));
+          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            this->name().data(), this->name().length(),
+            ::google::protobuf::internal::WireFormatLite::PARSE,
+            "deepflow.FrozenParam.Output.name"));
         } else {
           goto handle_unusual;
         }
         break;
       }
 
-      // float eps = 2;
+      // repeated int32 dims = 2;
       case 2: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(21u)) {
+            static_cast< ::google::protobuf::uint8>(18u)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, this->mutable_dims())));
+        } else if (static_cast< ::google::protobuf::uint8>(tag) ==
+                   static_cast< ::google::protobuf::uint8>(16u)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 1, 18u, input, this->mutable_dims())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // int64 offset = 3;
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(24u)) {
 
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &eps_)));
+                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
+                 input, &offset_)));
         } else {
           goto handle_unusual;
         }
@@ -21493,65 +25191,117 @@ bool RMSPropSolverParam::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:deepflow.RMSPropSolverParam)
+  // @@protoc_insertion_point(parse_success:deepflow.FrozenParam.Output)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:deepflow.RMSPropSolverParam)
+  // @@protoc_insertion_point(parse_failure:deepflow.FrozenParam.Output)
   return false;
 #undef DO_
 }
 
-void RMSPropSolverParam::SerializeWithCachedSizes(
+void FrozenParam_Output::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:deepflow.RMSPropSolverParam)
+  // @@protoc_insertion_point(serialize_start:deepflow.FrozenParam.Output)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // float rms_decay = 1;
-  if (this->rms_decay() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(1, this->rms_decay(), output);
+  // string name = 1;
+  if (this->name().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->name().data(), this->name().length(),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "deepflow.FrozenParam.Output.name");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      1, this->name(), output);
   }
 
-  // float eps = 2;
-  if (this->eps() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(2, this->eps(), output);
+  // repeated int32 dims = 2;
+  if (this->dims_size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteTag(2, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(_dims_cached_byte_size_);
+  }
+  for (int i = 0, n = this->dims_size(); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32NoTag(
+      this->dims(i), output);
   }
 
-  // @@protoc_insertion_point(serialize_end:deepflow.RMSPropSolverParam)
+  // int64 offset = 3;
+  if (this->offset() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt64(3, this->offset(), output);
+  }
+
+  // @@protoc_insertion_point(serialize_end:deepflow.FrozenParam.Output)
 }
 
-::google::protobuf::uint8* RMSPropSolverParam::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* FrozenParam_Output::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:deepflow.RMSPropSolverParam)
+  // @@protoc_insertion_point(serialize_to_array_start:deepflow.FrozenParam.Output)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // float rms_decay = 1;
-  if (this->rms_decay() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(1, this->rms_decay(), target);
+  // string name = 1;
+  if (this->name().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->name().data(), this->name().length(),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "deepflow.FrozenParam.Output.name");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        1, this->name(), target);
   }
 
-  // float eps = 2;
-  if (this->eps() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(2, this->eps(), target);
+  // repeated int32 dims = 2;
+  if (this->dims_size() > 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
+      2,
+      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
+      _dims_cached_byte_size_, target);
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteInt32NoTagToArray(this->dims_, target);
   }
 
-  // @@protoc_insertion_point(serialize_to_array_end:deepflow.RMSPropSolverParam)
+  // int64 offset = 3;
+  if (this->offset() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(3, this->offset(), target);
+  }
+
+  // @@protoc_insertion_point(serialize_to_array_end:deepflow.FrozenParam.Output)
   return target;
 }
 
-size_t RMSPropSolverParam::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:deepflow.RMSPropSolverParam)
+size_t FrozenParam_Output::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:deepflow.FrozenParam.Output)
   size_t total_size = 0;
 
-  // float rms_decay = 1;
-  if (this->rms_decay() != 0) {
-    total_size += 1 + 4;
+  // repeated int32 dims = 2;
+  {
+    size_t data_size = ::google::protobuf::internal::WireFormatLite::
+      Int32Size(this->dims_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
+    }
+    int cached_size = ::google::protobuf::internal::ToCachedSize(data_size);
+    GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+    _dims_cached_byte_size_ = cached_size;
+    GOOGLE_SAFE_CONCURRENT_WRITES_END();
+    total_size += data_size;
   }
 
-  // float eps = 2;
-  if (this->eps() != 0) {
-    total_size += 1 + 4;
+  // string name = 1;
+  if (this->name().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::StringSize(
+        this->name());
+  }
+
+  // int64 offset = 3;
+  if (this->offset() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::Int64Size(
+        this->offset());
   }
 
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
@@ -21561,98 +25311,170 @@ size_t RMSPropSolverParam::ByteSizeLong() const {
   return total_size;
 }
 
-void RMSPropSolverParam::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:deepflow.RMSPropSolverParam)
+void FrozenParam_Output::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:deepflow.FrozenParam.Output)
   GOOGLE_DCHECK_NE(&from, this);
-  const RMSPropSolverParam* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const RMSPropSolverParam>(
+  const FrozenParam_Output* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const FrozenParam_Output>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.RMSPropSolverParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.FrozenParam.Output)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.RMSPropSolverParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.FrozenParam.Output)
     MergeFrom(*source);
   }
 }
 
-void RMSPropSolverParam::MergeFrom(const RMSPropSolverParam& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.RMSPropSolverParam)
+void FrozenParam_Output::MergeFrom(const FrozenParam_Output& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.FrozenParam.Output)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.rms_decay() != 0) {
-    set_rms_decay(from.rms_decay());
+  dims_.MergeFrom(from.dims_);
+  if (from.name().size() > 0) {
+
+    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
   }
-  if (from.eps() != 0) {
-    set_eps(from.eps());
+  if (from.offset() != 0) {
+    set_offset(from.offset());
   }
 }
 
-void RMSPropSolverParam::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:deepflow.RMSPropSolverParam)
+void FrozenParam_Output::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:deepflow.FrozenParam.Output)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void RMSPropSolverParam::CopyFrom(const RMSPropSolverParam& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.RMSPropSolverParam)
+void FrozenParam_Output::CopyFrom(const FrozenParam_Output& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.FrozenParam.Output)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool RMSPropSolverParam::IsInitialized() const {
+bool FrozenParam_Output::IsInitialized() const {
   return true;
 }
 
-void RMSPropSolverParam::Swap(RMSPropSolverParam* other) {
+void FrozenParam_Output::Swap(FrozenParam_Output* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void RMSPropSolverParam::InternalSwap(RMSPropSolverParam* other) {
-  std::swap(rms_decay_, other->rms_decay_);
-  std::swap(eps_, other->eps_);
+void FrozenParam_Output::InternalSwap(FrozenParam_Output* other) {
+  dims_.InternalSwap(&other->dims_);
+  name_.Swap(&other->name_);
+  std::swap(offset_, other->offset_);
   std::swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata RMSPropSolverParam::GetMetadata() const {
+::google::protobuf::Metadata FrozenParam_Output::GetMetadata() const {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// RMSPropSolverParam
+// FrozenParam_Output
 
-// float rms_decay = 1;
-void RMSPropSolverParam::clear_rms_decay() {
-  rms_decay_ = 0;
+// string name = 1;
+void FrozenParam_Output::clear_name() {
+  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-float RMSPropSolverParam::rms_decay() const {
-  // @@protoc_insertion_point(field_get:deepflow.RMSPropSolverParam.rms_decay)
-  return rms_decay_;
+const ::std::string& FrozenParam_Output::name() const {
+  // @@protoc_insertion_point(field_get:deepflow.FrozenParam.Output.name)
+  return name_.GetNoArena();
 }
-void RMSPropSolverParam::set_rms_decay(float value) {
+void FrozenParam_Output::set_name(const ::std::string& value) {
   
-  rms_decay_ = value;
-  // @@protoc_insertion_point(field_set:deepflow.RMSPropSolverParam.rms_decay)
+  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:deepflow.FrozenParam.Output.name)
+}
+#if LANG_CXX11
+void FrozenParam_Output::set_name(::std::string&& value) {
+  
+  name_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:deepflow.FrozenParam.Output.name)
+}
+#endif
+void FrozenParam_Output::set_name(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:deepflow.FrozenParam.Output.name)
+}
+void FrozenParam_Output::set_name(const char* value, size_t size) {
+  
+  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:deepflow.FrozenParam.Output.name)
+}
+::std::string* FrozenParam_Output::mutable_name() {
+  
+  // @@protoc_insertion_point(field_mutable:deepflow.FrozenParam.Output.name)
+  return name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+::std::string* FrozenParam_Output::release_name() {
+  // @@protoc_insertion_point(field_release:deepflow.FrozenParam.Output.name)
+  
+  return name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+void FrozenParam_Output::set_allocated_name(::std::string* name) {
+  if (name != NULL) {
+    
+  } else {
+    
+  }
+  name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name);
+  // @@protoc_insertion_point(field_set_allocated:deepflow.FrozenParam.Output.name)
 }
 
-// float eps = 2;
-void RMSPropSolverParam::clear_eps() {
-  eps_ = 0;
+// repeated int32 dims = 2;
+int FrozenParam_Output::dims_size() const {
+  return dims_.size();
 }
-float RMSPropSolverParam::eps() const {
-  // @@protoc_insertion_point(field_get:deepflow.RMSPropSolverParam.eps)
-  return eps_;
+void FrozenParam_Output::clear_dims() {
+  dims_.Clear();
 }
-void RMSPropSolverParam::set_eps(float value) {
+::google::protobuf::int32 FrozenParam_Output::dims(int index) const {
+  // @@protoc_insertion_point(field_get:deepflow.FrozenParam.Output.dims)
+  return dims_.Get(index);
+}
+void FrozenParam_Output::set_dims(int index, ::google::protobuf::int32 value) {
+  dims_.Set(index, value);
+  // @@protoc_insertion_point(field_set:deepflow.FrozenParam.Output.dims)
+}
+void FrozenParam_Output::add_dims(::google::protobuf::int32 value) {
+  dims_.Add(value);
+  // @@protoc_insertion_point(field_add:deepflow.FrozenParam.Output.dims)
+}
+const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+FrozenParam_Output::dims() const {
+  // @@protoc_insertion_point(field_list:deepflow.FrozenParam.Output.dims)
+  return dims_;
+}
+::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+FrozenParam_Output::mutable_dims() {
+  // @@protoc_insertion_point(field_mutable_list:deepflow.FrozenParam.Output.dims)
+  return &dims_;
+}
+
+// int64 offset = 3;
+void FrozenParam_Output::clear_offset() {
+  offset_ = GOOGLE_LONGLONG(0);
+}
+::google::protobuf::int64 FrozenParam_Output::offset() const {
+  // @@protoc_insertion_point(field_get:deepflow.FrozenParam.Output.offset)
+  return offset_;
+}
+void FrozenParam_Output::set_offset(::google::protobuf::int64 value) {
   
-  eps_ = value;
-  // @@protoc_insertion_point(field_set:deepflow.RMSPropSolverParam.eps)
+  offset_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.FrozenParam.Output.offset)
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -21660,234 +25482,164 @@ void RMSPropSolverParam::set_eps(float value) {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int SolverParam::kNameFieldNumber;
-const int SolverParam::kLearningRateFieldNumber;
-const int SolverParam::kSgdSolverFieldNumber;
-const int SolverParam::kAdamSolverFieldNumber;
-const int SolverParam::kAdadeltaSolverFieldNumber;
-const int SolverParam::kRmspropSolverFieldNumber;
-const int SolverParam::kScopeFieldNumber;
+const int FrozenParam::kOutputFieldNumber;
+const int FrozenParam::kFetchFieldNumber;
+const int FrozenParam::kArenaSizeFieldNumber;
+const int FrozenParam::kArenaPolicyFieldNumber;
+const int FrozenParam::kSharedWeightsFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-SolverParam::SolverParam()
+FrozenParam::FrozenParam()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_deepflow_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:deepflow.SolverParam)
+  // @@protoc_insertion_point(constructor:deepflow.FrozenParam)
 }
-SolverParam::SolverParam(const SolverParam& from)
+FrozenParam::FrozenParam(const FrozenParam& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
+      output_(from.output_),
+      fetch_(from.fetch_),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
-  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.name().size() > 0) {
-    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
-  }
-  scope_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.scope().size() > 0) {
-    scope_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.scope_);
-  }
-  if (from.has_sgd_solver()) {
-    sgd_solver_ = new ::deepflow::SGDSolverParam(*from.sgd_solver_);
-  } else {
-    sgd_solver_ = NULL;
-  }
-  if (from.has_adam_solver()) {
-    adam_solver_ = new ::deepflow::AdamSolverParam(*from.adam_solver_);
-  } else {
-    adam_solver_ = NULL;
-  }
-  if (from.has_adadelta_solver()) {
-    adadelta_solver_ = new ::deepflow::AdaDeltaSolverParam(*from.adadelta_solver_);
-  } else {
-    adadelta_solver_ = NULL;
-  }
-  if (from.has_rmsprop_solver()) {
-    rmsprop_solver_ = new ::deepflow::RMSPropSolverParam(*from.rmsprop_solver_);
-  } else {
-    rmsprop_solver_ = NULL;
+  shared_weights_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.shared_weights().size() > 0) {
+    shared_weights_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.shared_weights_);
   }
-  learning_rate_ = from.learning_rate_;
-  // @@protoc_insertion_point(copy_constructor:deepflow.SolverParam)
+  ::memcpy(&arena_size_, &from.arena_size_,
+    reinterpret_cast<char*>(&arena_policy_) -
+    reinterpret_cast<char*>(&arena_size_) + sizeof(arena_policy_));
+  // @@protoc_insertion_point(copy_constructor:deepflow.FrozenParam)
 }
 
-void SolverParam::SharedCtor() {
-  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  scope_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&sgd_solver_, 0, reinterpret_cast<char*>(&learning_rate_) -
-    reinterpret_cast<char*>(&sgd_solver_) + sizeof(learning_rate_));
+void FrozenParam::SharedCtor() {
+  shared_weights_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::memset(&arena_size_, 0, reinterpret_cast<char*>(&arena_policy_) -
+    reinterpret_cast<char*>(&arena_size_) + sizeof(arena_policy_));
   _cached_size_ = 0;
 }
 
-SolverParam::~SolverParam() {
-  // @@protoc_insertion_point(destructor:deepflow.SolverParam)
+FrozenParam::~FrozenParam() {
+  // @@protoc_insertion_point(destructor:deepflow.FrozenParam)
   SharedDtor();
 }
 
-void SolverParam::SharedDtor() {
-  name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  scope_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (this != internal_default_instance()) {
-    delete sgd_solver_;
-  }
-  if (this != internal_default_instance()) {
-    delete adam_solver_;
-  }
-  if (this != internal_default_instance()) {
-    delete adadelta_solver_;
-  }
-  if (this != internal_default_instance()) {
-    delete rmsprop_solver_;
-  }
+void FrozenParam::SharedDtor() {
+  shared_weights_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
 
-void SolverParam::SetCachedSize(int size) const {
+void FrozenParam::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* SolverParam::descriptor() {
+const ::google::protobuf::Descriptor* FrozenParam::descriptor() {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const SolverParam& SolverParam::default_instance() {
+const FrozenParam& FrozenParam::default_instance() {
   protobuf_deepflow_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-SolverParam* SolverParam::New(::google::protobuf::Arena* arena) const {
-  SolverParam* n = new SolverParam;
+FrozenParam* FrozenParam::New(::google::protobuf::Arena* arena) const {
+  FrozenParam* n = new FrozenParam;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void SolverParam::Clear() {
-// @@protoc_insertion_point(message_clear_start:deepflow.SolverParam)
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  scope_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (GetArenaNoVirtual() == NULL && sgd_solver_ != NULL) {
-    delete sgd_solver_;
-  }
-  sgd_solver_ = NULL;
-  if (GetArenaNoVirtual() == NULL && adam_solver_ != NULL) {
-    delete adam_solver_;
-  }
-  adam_solver_ = NULL;
-  if (GetArenaNoVirtual() == NULL && adadelta_solver_ != NULL) {
-    delete adadelta_solver_;
-  }
-  adadelta_solver_ = NULL;
-  if (GetArenaNoVirtual() == NULL && rmsprop_solver_ != NULL) {
-    delete rmsprop_solver_;
-  }
-  rmsprop_solver_ = NULL;
-  learning_rate_ = 0;
+void FrozenParam::Clear() {
+// @@protoc_insertion_point(message_clear_start:deepflow.FrozenParam)
+  output_.Clear();
+  fetch_.Clear();
+  shared_weights_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::memset(&arena_size_, 0, reinterpret_cast<char*>(&arena_policy_) -
+    reinterpret_cast<char*>(&arena_size_) + sizeof(arena_policy_));
 }
 
-bool SolverParam::MergePartialFromCodedStream(
+bool FrozenParam::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:deepflow.SolverParam)
+  // @@protoc_insertion_point(parse_start:deepflow.FrozenParam)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // string name = 1;
+      // repeated .deepflow.FrozenParam.Output output = 1;
       case 1: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
             static_cast< ::google::protobuf::uint8>(10u)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_name()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->name().data(), this->name().length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "deepflow.SolverParam.name"));
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+                input, add_output()));
         } else {
           goto handle_unusual;
         }
         break;
       }
 
-      // float learning_rate = 2;
+      // repeated string fetch = 2;
       case 2: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(21u)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &learning_rate_)));
+            static_cast< ::google::protobuf::uint8>(18u)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->add_fetch()));
+          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            this->fetch(this->fetch_size() - 1).data(),
+            this->fetch(this->fetch_size() - 1).length(),
+            ::google::protobuf::internal::WireFormatLite::PARSE,
+            "deepflow.FrozenParam.fetch"));
         } else {
           goto handle_unusual;
         }
         break;
       }
 
-      // .deepflow.SGDSolverParam sgd_solver = 3;
+      // int64 arena_size = 3;
       case 3: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(26u)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_sgd_solver()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // .deepflow.AdamSolverParam adam_solver = 5;
-      case 5: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(42u)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_adam_solver()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
+            static_cast< ::google::protobuf::uint8>(24u)) {
 
-      // .deepflow.AdaDeltaSolverParam adadelta_solver = 6;
-      case 6: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(50u)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_adadelta_solver()));
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
+                 input, &arena_size_)));
         } else {
           goto handle_unusual;
         }
         break;
       }
 
-      // .deepflow.RMSPropSolverParam rmsprop_solver = 7;
-      case 7: {
+      // .deepflow.NodeParam.DataPolicy arena_policy = 4;
+      case 4: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(58u)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_rmsprop_solver()));
+            static_cast< ::google::protobuf::uint8>(32u)) {
+          int value;
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          set_arena_policy(static_cast< ::deepflow::NodeParam_DataPolicy >(value));
         } else {
           goto handle_unusual;
         }
         break;
       }
 
-      // string scope = 8;
-      case 8: {
+      // string shared_weights = 5;
+      case 5: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(66u)) {
+            static_cast< ::google::protobuf::uint8>(42u)) {
           DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_scope()));
+                input, this->mutable_shared_weights()));
           DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->scope().data(), this->scope().length(),
+            this->shared_weights().data(), this->shared_weights().length(),
             ::google::protobuf::internal::WireFormatLite::PARSE,
-            "deepflow.SolverParam.scope"));
+            "deepflow.FrozenParam.shared_weights"));
         } else {
           goto handle_unusual;
         }
@@ -21907,186 +25659,150 @@ bool SolverParam::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:deepflow.SolverParam)
+  // @@protoc_insertion_point(parse_success:deepflow.FrozenParam)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:deepflow.SolverParam)
+  // @@protoc_insertion_point(parse_failure:deepflow.FrozenParam)
   return false;
 #undef DO_
 }
 
-void SolverParam::SerializeWithCachedSizes(
+void FrozenParam::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:deepflow.SolverParam)
+  // @@protoc_insertion_point(serialize_start:deepflow.FrozenParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string name = 1;
-  if (this->name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->name().data(), this->name().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "deepflow.SolverParam.name");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->name(), output);
-  }
-
-  // float learning_rate = 2;
-  if (this->learning_rate() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(2, this->learning_rate(), output);
-  }
-
-  // .deepflow.SGDSolverParam sgd_solver = 3;
-  if (this->has_sgd_solver()) {
+  // repeated .deepflow.FrozenParam.Output output = 1;
+  for (unsigned int i = 0, n = this->output_size(); i < n; i++) {
     ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      3, *this->sgd_solver_, output);
+      1, this->output(i), output);
   }
 
-  // .deepflow.AdamSolverParam adam_solver = 5;
-  if (this->has_adam_solver()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      5, *this->adam_solver_, output);
+  // repeated string fetch = 2;
+  for (int i = 0, n = this->fetch_size(); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->fetch(i).data(), this->fetch(i).length(),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "deepflow.FrozenParam.fetch");
+    ::google::protobuf::internal::WireFormatLite::WriteString(
+      2, this->fetch(i), output);
   }
 
-  // .deepflow.AdaDeltaSolverParam adadelta_solver = 6;
-  if (this->has_adadelta_solver()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      6, *this->adadelta_solver_, output);
+  // int64 arena_size = 3;
+  if (this->arena_size() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt64(3, this->arena_size(), output);
   }
 
-  // .deepflow.RMSPropSolverParam rmsprop_solver = 7;
-  if (this->has_rmsprop_solver()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      7, *this->rmsprop_solver_, output);
+  // .deepflow.NodeParam.DataPolicy arena_policy = 4;
+  if (this->arena_policy() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      4, this->arena_policy(), output);
   }
 
-  // string scope = 8;
-  if (this->scope().size() > 0) {
+  // string shared_weights = 5;
+  if (this->shared_weights().size() > 0) {
     ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->scope().data(), this->scope().length(),
+      this->shared_weights().data(), this->shared_weights().length(),
       ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "deepflow.SolverParam.scope");
+      "deepflow.FrozenParam.shared_weights");
     ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      8, this->scope(), output);
+      5, this->shared_weights(), output);
   }
 
-  // @@protoc_insertion_point(serialize_end:deepflow.SolverParam)
+  // @@protoc_insertion_point(serialize_end:deepflow.FrozenParam)
 }
 
-::google::protobuf::uint8* SolverParam::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* FrozenParam::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:deepflow.SolverParam)
+  // @@protoc_insertion_point(serialize_to_array_start:deepflow.FrozenParam)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string name = 1;
-  if (this->name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->name().data(), this->name().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "deepflow.SolverParam.name");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->name(), target);
-  }
-
-  // float learning_rate = 2;
-  if (this->learning_rate() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(2, this->learning_rate(), target);
-  }
-
-  // .deepflow.SGDSolverParam sgd_solver = 3;
-  if (this->has_sgd_solver()) {
+  // repeated .deepflow.FrozenParam.Output output = 1;
+  for (unsigned int i = 0, n = this->output_size(); i < n; i++) {
     target = ::google::protobuf::internal::WireFormatLite::
       InternalWriteMessageNoVirtualToArray(
-        3, *this->sgd_solver_, deterministic, target);
+        1, this->output(i), deterministic, target);
   }
 
-  // .deepflow.AdamSolverParam adam_solver = 5;
-  if (this->has_adam_solver()) {
+  // repeated string fetch = 2;
+  for (int i = 0, n = this->fetch_size(); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->fetch(i).data(), this->fetch(i).length(),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "deepflow.FrozenParam.fetch");
     target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageNoVirtualToArray(
-        5, *this->adam_solver_, deterministic, target);
+      WriteStringToArray(2, this->fetch(i), target);
   }
 
-  // .deepflow.AdaDeltaSolverParam adadelta_solver = 6;
-  if (this->has_adadelta_solver()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageNoVirtualToArray(
-        6, *this->adadelta_solver_, deterministic, target);
+  // int64 arena_size = 3;
+  if (this->arena_size() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(3, this->arena_size(), target);
   }
 
-  // .deepflow.RMSPropSolverParam rmsprop_solver = 7;
-  if (this->has_rmsprop_solver()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageNoVirtualToArray(
-        7, *this->rmsprop_solver_, deterministic, target);
+  // .deepflow.NodeParam.DataPolicy arena_policy = 4;
+  if (this->arena_policy() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
+      4, this->arena_policy(), target);
   }
 
-  // string scope = 8;
-  if (this->scope().size() > 0) {
+  // string shared_weights = 5;
+  if (this->shared_weights().size() > 0) {
     ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->scope().data(), this->scope().length(),
+      this->shared_weights().data(), this->shared_weights().length(),
       ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "deepflow.SolverParam.scope");
+      "deepflow.FrozenParam.shared_weights");
     target =
       ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        8, this->scope(), target);
+        5, this->shared_weights(), target);
   }
 
-  // @@protoc_insertion_point(serialize_to_array_end:deepflow.SolverParam)
+  // @@protoc_insertion_point(serialize_to_array_end:deepflow.FrozenParam)
   return target;
 }
 
-size_t SolverParam::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:deepflow.SolverParam)
+size_t FrozenParam::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:deepflow.FrozenParam)
   size_t total_size = 0;
 
-  // string name = 1;
-  if (this->name().size() > 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->name());
-  }
-
-  // string scope = 8;
-  if (this->scope().size() > 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->scope());
-  }
-
-  // .deepflow.SGDSolverParam sgd_solver = 3;
-  if (this->has_sgd_solver()) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        *this->sgd_solver_);
+  // repeated .deepflow.FrozenParam.Output output = 1;
+  {
+    unsigned int count = this->output_size();
+    total_size += 1UL * count;
+    for (unsigned int i = 0; i < count; i++) {
+      total_size +=
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->output(i));
+    }
   }
 
-  // .deepflow.AdamSolverParam adam_solver = 5;
-  if (this->has_adam_solver()) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        *this->adam_solver_);
+  // repeated string fetch = 2;
+  total_size += 1 *
+      ::google::protobuf::internal::FromIntSize(this->fetch_size());
+  for (int i = 0, n = this->fetch_size(); i < n; i++) {
+    total_size += ::google::protobuf::internal::WireFormatLite::StringSize(
+      this->fetch(i));
   }
 
-  // .deepflow.AdaDeltaSolverParam adadelta_solver = 6;
-  if (this->has_adadelta_solver()) {
+  // string shared_weights = 5;
+  if (this->shared_weights().size() > 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        *this->adadelta_solver_);
+      ::google::protobuf::internal::WireFormatLite::StringSize(
+        this->shared_weights());
   }
 
-  // .deepflow.RMSPropSolverParam rmsprop_solver = 7;
-  if (this->has_rmsprop_solver()) {
+  // int64 arena_size = 3;
+  if (this->arena_size() != 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        *this->rmsprop_solver_);
+      ::google::protobuf::internal::WireFormatLite::Int64Size(
+        this->arena_size());
   }
 
-  // float learning_rate = 2;
-  if (this->learning_rate() != 0) {
-    total_size += 1 + 4;
+  // .deepflow.NodeParam.DataPolicy arena_policy = 4;
+  if (this->arena_policy() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::EnumSize(this->arena_policy());
   }
 
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
@@ -22096,368 +25812,259 @@ size_t SolverParam::ByteSizeLong() const {
   return total_size;
 }
 
-void SolverParam::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:deepflow.SolverParam)
+void FrozenParam::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:deepflow.FrozenParam)
   GOOGLE_DCHECK_NE(&from, this);
-  const SolverParam* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const SolverParam>(
+  const FrozenParam* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const FrozenParam>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.SolverParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:deepflow.FrozenParam)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.SolverParam)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:deepflow.FrozenParam)
     MergeFrom(*source);
   }
 }
 
-void SolverParam::MergeFrom(const SolverParam& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.SolverParam)
+void FrozenParam::MergeFrom(const FrozenParam& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:deepflow.FrozenParam)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.name().size() > 0) {
-
-    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
-  }
-  if (from.scope().size() > 0) {
+  output_.MergeFrom(from.output_);
+  fetch_.MergeFrom(from.fetch_);
+  if (from.shared_weights().size() > 0) {
 
-    scope_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.scope_);
-  }
-  if (from.has_sgd_solver()) {
-    mutable_sgd_solver()->::deepflow::SGDSolverParam::MergeFrom(from.sgd_solver());
-  }
-  if (from.has_adam_solver()) {
-    mutable_adam_solver()->::deepflow::AdamSolverParam::MergeFrom(from.adam_solver());
-  }
-  if (from.has_adadelta_solver()) {
-    mutable_adadelta_solver()->::deepflow::AdaDeltaSolverParam::MergeFrom(from.adadelta_solver());
+    shared_weights_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.shared_weights_);
   }
-  if (from.has_rmsprop_solver()) {
-    mutable_rmsprop_solver()->::deepflow::RMSPropSolverParam::MergeFrom(from.rmsprop_solver());
+  if (from.arena_size() != 0) {
+    set_arena_size(from.arena_size());
   }
-  if (from.learning_rate() != 0) {
-    set_learning_rate(from.learning_rate());
+  if (from.arena_policy() != 0) {
+    set_arena_policy(from.arena_policy());
   }
 }
 
-void SolverParam::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:deepflow.SolverParam)
+void FrozenParam::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:deepflow.FrozenParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void SolverParam::CopyFrom(const SolverParam& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.SolverParam)
+void FrozenParam::CopyFrom(const FrozenParam& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:deepflow.FrozenParam)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool SolverParam::IsInitialized() const {
+bool FrozenParam::IsInitialized() const {
   return true;
 }
 
-void SolverParam::Swap(SolverParam* other) {
+void FrozenParam::Swap(FrozenParam* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void SolverParam::InternalSwap(SolverParam* other) {
-  name_.Swap(&other->name_);
-  scope_.Swap(&other->scope_);
-  std::swap(sgd_solver_, other->sgd_solver_);
-  std::swap(adam_solver_, other->adam_solver_);
-  std::swap(adadelta_solver_, other->adadelta_solver_);
-  std::swap(rmsprop_solver_, other->rmsprop_solver_);
-  std::swap(learning_rate_, other->learning_rate_);
+void FrozenParam::InternalSwap(FrozenParam* other) {
+  output_.InternalSwap(&other->output_);
+  fetch_.InternalSwap(&other->fetch_);
+  shared_weights_.Swap(&other->shared_weights_);
+  std::swap(arena_size_, other->arena_size_);
+  std::swap(arena_policy_, other->arena_policy_);
   std::swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata SolverParam::GetMetadata() const {
+::google::protobuf::Metadata FrozenParam::GetMetadata() const {
   protobuf_deepflow_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_deepflow_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// SolverParam
+// FrozenParam
 
-// string name = 1;
-void SolverParam::clear_name() {
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-const ::std::string& SolverParam::name() const {
-  // @@protoc_insertion_point(field_get:deepflow.SolverParam.name)
-  return name_.GetNoArena();
-}
-void SolverParam::set_name(const ::std::string& value) {
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:deepflow.SolverParam.name)
+// repeated .deepflow.FrozenParam.Output output = 1;
+int FrozenParam::output_size() const {
+  return output_.size();
 }
-#if LANG_CXX11
-void SolverParam::set_name(::std::string&& value) {
-  
-  name_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:deepflow.SolverParam.name)
+void FrozenParam::clear_output() {
+  output_.Clear();
 }
-#endif
-void SolverParam::set_name(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:deepflow.SolverParam.name)
+const ::deepflow::FrozenParam_Output& FrozenParam::output(int index) const {
+  // @@protoc_insertion_point(field_get:deepflow.FrozenParam.output)
+  return output_.Get(index);
 }
-void SolverParam::set_name(const char* value, size_t size) {
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:deepflow.SolverParam.name)
+::deepflow::FrozenParam_Output* FrozenParam::mutable_output(int index) {
+  // @@protoc_insertion_point(field_mutable:deepflow.FrozenParam.output)
+  return output_.Mutable(index);
 }
-::std::string* SolverParam::mutable_name() {
-  
-  // @@protoc_insertion_point(field_mutable:deepflow.SolverParam.name)
-  return name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+::deepflow::FrozenParam_Output* FrozenParam::add_output() {
+  // @@protoc_insertion_point(field_add:deepflow.FrozenParam.output)
+  return output_.Add();
 }
-::std::string* SolverParam::release_name() {
-  // @@protoc_insertion_point(field_release:deepflow.SolverParam.name)
-  
-  return name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+::google::protobuf::RepeatedPtrField< ::deepflow::FrozenParam_Output >*
+FrozenParam::mutable_output() {
+  // @@protoc_insertion_point(field_mutable_list:deepflow.FrozenParam.output)
+  return &output_;
 }
-void SolverParam::set_allocated_name(::std::string* name) {
-  if (name != NULL) {
-    
-  } else {
-    
-  }
-  name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name);
-  // @@protoc_insertion_point(field_set_allocated:deepflow.SolverParam.name)
+const ::google::protobuf::RepeatedPtrField< ::deepflow::FrozenParam_Output >&
+FrozenParam::output() const {
+  // @@protoc_insertion_point(field_list:deepflow.FrozenParam.output)
+  return output_;
 }
 
-// float learning_rate = 2;
-void SolverParam::clear_learning_rate() {
-  learning_rate_ = 0;
+// repeated string fetch = 2;
+int FrozenParam::fetch_size() const {
+  return fetch_.size();
 }
-float SolverParam::learning_rate() const {
-  // @@protoc_insertion_point(field_get:deepflow.SolverParam.learning_rate)
-  return learning_rate_;
+void FrozenParam::clear_fetch() {
+  fetch_.Clear();
 }
-void SolverParam::set_learning_rate(float value) {
-  
-  learning_rate_ = value;
-  // @@protoc_insertion_point(field_set:deepflow.SolverParam.learning_rate)
+const ::std::string& FrozenParam::fetch(int index) const {
+  // @@protoc_insertion_point(field_get:deepflow.FrozenParam.fetch)
+  return fetch_.Get(index);
 }
-
-// .deepflow.SGDSolverParam sgd_solver = 3;
-bool SolverParam::has_sgd_solver() const {
-  return this != internal_default_instance() && sgd_solver_ != NULL;
+::std::string* FrozenParam::mutable_fetch(int index) {
+  // @@protoc_insertion_point(field_mutable:deepflow.FrozenParam.fetch)
+  return fetch_.Mutable(index);
 }
-void SolverParam::clear_sgd_solver() {
-  if (GetArenaNoVirtual() == NULL && sgd_solver_ != NULL) delete sgd_solver_;
-  sgd_solver_ = NULL;
+void FrozenParam::set_fetch(int index, const ::std::string& value) {
+  // @@protoc_insertion_point(field_set:deepflow.FrozenParam.fetch)
+  fetch_.Mutable(index)->assign(value);
 }
-const ::deepflow::SGDSolverParam& SolverParam::sgd_solver() const {
-  // @@protoc_insertion_point(field_get:deepflow.SolverParam.sgd_solver)
-  return sgd_solver_ != NULL ? *sgd_solver_
-                         : *::deepflow::SGDSolverParam::internal_default_instance();
+#if LANG_CXX11
+void FrozenParam::set_fetch(int index, ::std::string&& value) {
+  // @@protoc_insertion_point(field_set:deepflow.FrozenParam.fetch)
+  fetch_.Mutable(index)->assign(std::move(value));
 }
-::deepflow::SGDSolverParam* SolverParam::mutable_sgd_solver() {
-  
-  if (sgd_solver_ == NULL) {
-    sgd_solver_ = new ::deepflow::SGDSolverParam;
-  }
-  // @@protoc_insertion_point(field_mutable:deepflow.SolverParam.sgd_solver)
-  return sgd_solver_;
+#endif
+void FrozenParam::set_fetch(int index, const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  fetch_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:deepflow.FrozenParam.fetch)
 }
-::deepflow::SGDSolverParam* SolverParam::release_sgd_solver() {
-  // @@protoc_insertion_point(field_release:deepflow.SolverParam.sgd_solver)
-  
-  ::deepflow::SGDSolverParam* temp = sgd_solver_;
-  sgd_solver_ = NULL;
-  return temp;
+void FrozenParam::set_fetch(int index, const char* value, size_t size) {
+  fetch_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:deepflow.FrozenParam.fetch)
 }
-void SolverParam::set_allocated_sgd_solver(::deepflow::SGDSolverParam* sgd_solver) {
-  delete sgd_solver_;
-  sgd_solver_ = sgd_solver;
-  if (sgd_solver) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_set_allocated:deepflow.SolverParam.sgd_solver)
+::std::string* FrozenParam::add_fetch() {
+  // @@protoc_insertion_point(field_add_mutable:deepflow.FrozenParam.fetch)
+  return fetch_.Add();
 }
-
-// .deepflow.AdamSolverParam adam_solver = 5;
-bool SolverParam::has_adam_solver() const {
-  return this != internal_default_instance() && adam_solver_ != NULL;
+void FrozenParam::add_fetch(const ::std::string& value) {
+  fetch_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:deepflow.FrozenParam.fetch)
 }
-void SolverParam::clear_adam_solver() {
-  if (GetArenaNoVirtual() == NULL && adam_solver_ != NULL) delete adam_solver_;
-  adam_solver_ = NULL;
+#if LANG_CXX11
+void FrozenParam::add_fetch(::std::string&& value) {
+  fetch_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:deepflow.FrozenParam.fetch)
 }
-const ::deepflow::AdamSolverParam& SolverParam::adam_solver() const {
-  // @@protoc_insertion_point(field_get:deepflow.SolverParam.adam_solver)
-  return adam_solver_ != NULL ? *adam_solver_
-                         : *::deepflow::AdamSolverParam::internal_default_instance();
+#endif
+void FrozenParam::add_fetch(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  fetch_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:deepflow.FrozenParam.fetch)
 }
-::deepflow::AdamSolverParam* SolverParam::mutable_adam_solver() {
-  
-  if (adam_solver_ == NULL) {
-    adam_solver_ = new ::deepflow::AdamSolverParam;
-  }
-  // @@protoc_insertion_point(field_mutable:deepflow.SolverParam.adam_solver)
-  return adam_solver_;
+void FrozenParam::add_fetch(const char* value, size_t size) {
+  fetch_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:deepflow.FrozenParam.fetch)
 }
-::deepflow::AdamSolverParam* SolverParam::release_adam_solver() {
-  // @@protoc_insertion_point(field_release:deepflow.SolverParam.adam_solver)
-  
-  ::deepflow::AdamSolverParam* temp = adam_solver_;
-  adam_solver_ = NULL;
-  return temp;
+const ::google::protobuf::RepeatedPtrField< ::std::string>&
+FrozenParam::fetch() const {
+  // @@protoc_insertion_point(field_list:deepflow.FrozenParam.fetch)
+  return fetch_;
 }
-void SolverParam::set_allocated_adam_solver(::deepflow::AdamSolverParam* adam_solver) {
-  delete adam_solver_;
-  adam_solver_ = adam_solver;
-  if (adam_solver) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_set_allocated:deepflow.SolverParam.adam_solver)
+::google::protobuf::RepeatedPtrField< ::std::string>*
+FrozenParam::mutable_fetch() {
+  // @@protoc_insertion_point(field_mutable_list:deepflow.FrozenParam.fetch)
+  return &fetch_;
 }
 
-// .deepflow.AdaDeltaSolverParam adadelta_solver = 6;
-bool SolverParam::has_adadelta_solver() const {
-  return this != internal_default_instance() && adadelta_solver_ != NULL;
-}
-void SolverParam::clear_adadelta_solver() {
-  if (GetArenaNoVirtual() == NULL && adadelta_solver_ != NULL) delete adadelta_solver_;
-  adadelta_solver_ = NULL;
-}
-const ::deepflow::AdaDeltaSolverParam& SolverParam::adadelta_solver() const {
-  // @@protoc_insertion_point(field_get:deepflow.SolverParam.adadelta_solver)
-  return adadelta_solver_ != NULL ? *adadelta_solver_
-                         : *::deepflow::AdaDeltaSolverParam::internal_default_instance();
+// int64 arena_size = 3;
+void FrozenParam::clear_arena_size() {
+  arena_size_ = GOOGLE_LONGLONG(0);
 }
-::deepflow::AdaDeltaSolverParam* SolverParam::mutable_adadelta_solver() {
-  
-  if (adadelta_solver_ == NULL) {
-    adadelta_solver_ = new ::deepflow::AdaDeltaSolverParam;
-  }
-  // @@protoc_insertion_point(field_mutable:deepflow.SolverParam.adadelta_solver)
-  return adadelta_solver_;
+::google::protobuf::int64 FrozenParam::arena_size() const {
+  // @@protoc_insertion_point(field_get:deepflow.FrozenParam.arena_size)
+  return arena_size_;
 }
-::deepflow::AdaDeltaSolverParam* SolverParam::release_adadelta_solver() {
-  // @@protoc_insertion_point(field_release:deepflow.SolverParam.adadelta_solver)
+void FrozenParam::set_arena_size(::google::protobuf::int64 value) {
   
-  ::deepflow::AdaDeltaSolverParam* temp = adadelta_solver_;
-  adadelta_solver_ = NULL;
-  return temp;
-}
-void SolverParam::set_allocated_adadelta_solver(::deepflow::AdaDeltaSolverParam* adadelta_solver) {
-  delete adadelta_solver_;
-  adadelta_solver_ = adadelta_solver;
-  if (adadelta_solver) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_set_allocated:deepflow.SolverParam.adadelta_solver)
+  arena_size_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.FrozenParam.arena_size)
 }
 
-// .deepflow.RMSPropSolverParam rmsprop_solver = 7;
-bool SolverParam::has_rmsprop_solver() const {
-  return this != internal_default_instance() && rmsprop_solver_ != NULL;
-}
-void SolverParam::clear_rmsprop_solver() {
-  if (GetArenaNoVirtual() == NULL && rmsprop_solver_ != NULL) delete rmsprop_solver_;
-  rmsprop_solver_ = NULL;
-}
-const ::deepflow::RMSPropSolverParam& SolverParam::rmsprop_solver() const {
-  // @@protoc_insertion_point(field_get:deepflow.SolverParam.rmsprop_solver)
-  return rmsprop_solver_ != NULL ? *rmsprop_solver_
-                         : *::deepflow::RMSPropSolverParam::internal_default_instance();
+// .deepflow.NodeParam.DataPolicy arena_policy = 4;
+void FrozenParam::clear_arena_policy() {
+  arena_policy_ = 0;
 }
-::deepflow::RMSPropSolverParam* SolverParam::mutable_rmsprop_solver() {
-  
-  if (rmsprop_solver_ == NULL) {
-    rmsprop_solver_ = new ::deepflow::RMSPropSolverParam;
-  }
-  // @@protoc_insertion_point(field_mutable:deepflow.SolverParam.rmsprop_solver)
-  return rmsprop_solver_;
+::deepflow::NodeParam_DataPolicy FrozenParam::arena_policy() const {
+  // @@protoc_insertion_point(field_get:deepflow.FrozenParam.arena_policy)
+  return static_cast< ::deepflow::NodeParam_DataPolicy >(arena_policy_);
 }
-::deepflow::RMSPropSolverParam* SolverParam::release_rmsprop_solver() {
-  // @@protoc_insertion_point(field_release:deepflow.SolverParam.rmsprop_solver)
+void FrozenParam::set_arena_policy(::deepflow::NodeParam_DataPolicy value) {
   
-  ::deepflow::RMSPropSolverParam* temp = rmsprop_solver_;
-  rmsprop_solver_ = NULL;
-  return temp;
-}
-void SolverParam::set_allocated_rmsprop_solver(::deepflow::RMSPropSolverParam* rmsprop_solver) {
-  delete rmsprop_solver_;
-  rmsprop_solver_ = rmsprop_solver;
-  if (rmsprop_solver) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_set_allocated:deepflow.SolverParam.rmsprop_solver)
+  arena_policy_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.FrozenParam.arena_policy)
 }
 
-// string scope = 8;
-void SolverParam::clear_scope() {
-  scope_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// string shared_weights = 5;
+void FrozenParam::clear_shared_weights() {
+  shared_weights_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-const ::std::string& SolverParam::scope() const {
-  // @@protoc_insertion_point(field_get:deepflow.SolverParam.scope)
-  return scope_.GetNoArena();
+const ::std::string& FrozenParam::shared_weights() const {
+  // @@protoc_insertion_point(field_get:deepflow.FrozenParam.shared_weights)
+  return shared_weights_.GetNoArena();
 }
-void SolverParam::set_scope(const ::std::string& value) {
+void FrozenParam::set_shared_weights(const ::std::string& value) {
   
-  scope_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:deepflow.SolverParam.scope)
+  shared_weights_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:deepflow.FrozenParam.shared_weights)
 }
 #if LANG_CXX11
-void SolverParam::set_scope(::std::string&& value) {
+void FrozenParam::set_shared_weights(::std::string&& value) {
   
-  scope_.SetNoArena(
+  shared_weights_.SetNoArena(
     &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:deepflow.SolverParam.scope)
+  // @@protoc_insertion_point(field_set_rvalue:deepflow.FrozenParam.shared_weights)
 }
 #endif
-void SolverParam::set_scope(const char* value) {
+void FrozenParam::set_shared_weights(const char* value) {
   GOOGLE_DCHECK(value != NULL);
   
-  scope_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:deepflow.SolverParam.scope)
+  shared_weights_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:deepflow.FrozenParam.shared_weights)
 }
-void SolverParam::set_scope(const char* value, size_t size) {
+void FrozenParam::set_shared_weights(const char* value, size_t size) {
   
-  scope_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+  shared_weights_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
       ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:deepflow.SolverParam.scope)
+  // @@protoc_insertion_point(field_set_pointer:deepflow.FrozenParam.shared_weights)
 }
-::std::string* SolverParam::mutable_scope() {
+::std::string* FrozenParam::mutable_shared_weights() {
   
-  // @@protoc_insertion_point(field_mutable:deepflow.SolverParam.scope)
-  return scope_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  // @@protoc_insertion_point(field_mutable:deepflow.FrozenParam.shared_weights)
+  return shared_weights_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-::std::string* SolverParam::release_scope() {
-  // @@protoc_insertion_point(field_release:deepflow.SolverParam.scope)
+::std::string* FrozenParam::release_shared_weights() {
+  // @@protoc_insertion_point(field_release:deepflow.FrozenParam.shared_weights)
   
-  return scope_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return shared_weights_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-void SolverParam::set_allocated_scope(::std::string* scope) {
-  if (scope != NULL) {
+void FrozenParam::set_allocated_shared_weights(::std::string* shared_weights) {
+  if (shared_weights != NULL) {
     
   } else {
     
   }
-  scope_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), scope);
-  // @@protoc_insertion_point(field_set_allocated:deepflow.SolverParam.scope)
+  shared_weights_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), shared_weights);
+  // @@protoc_insertion_point(field_set_allocated:deepflow.FrozenParam.shared_weights)
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -22468,6 +26075,7 @@ void SolverParam::set_allocated_scope(::std::string* scope) {
 const int BlockParam::kNodeFieldNumber;
 const int BlockParam::kSolverFieldNumber;
 const int BlockParam::kInitializerFieldNumber;
+const int BlockParam::kFrozenParamFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
 BlockParam::BlockParam()
@@ -22486,10 +26094,16 @@ BlockParam::BlockParam(const BlockParam& from)
       initializer_(from.initializer_),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
+  if (from.has_frozen_param()) {
+    frozen_param_ = new ::deepflow::FrozenParam(*from.frozen_param_);
+  } else {
+    frozen_param_ = NULL;
+  }
   // @@protoc_insertion_point(copy_constructor:deepflow.BlockParam)
 }
 
 void BlockParam::SharedCtor() {
+  frozen_param_ = NULL;
   _cached_size_ = 0;
 }
 
@@ -22499,6 +26113,9 @@ BlockParam::~BlockParam() {
 }
 
 void BlockParam::SharedDtor() {
+  if (this != internal_default_instance()) {
+    delete frozen_param_;
+  }
 }
 
 void BlockParam::SetCachedSize(int size) const {
@@ -22529,6 +26146,10 @@ void BlockParam::Clear() {
   node_.Clear();
   solver_.Clear();
   initializer_.Clear();
+  if (GetArenaNoVirtual() == NULL && frozen_param_ != NULL) {
+    delete frozen_param_;
+  }
+  frozen_param_ = NULL;
 }
 
 bool BlockParam::MergePartialFromCodedStream(
@@ -22577,6 +26198,18 @@ bool BlockParam::MergePartialFromCodedStream(
         break;
       }
 
+      // .deepflow.FrozenParam frozen_param = 5;
+      case 5: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(42u)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_frozen_param()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
       default: {
       handle_unusual:
         if (tag == 0 ||
@@ -22622,6 +26255,12 @@ void BlockParam::SerializeWithCachedSizes(
       4, this->initializer(i), output);
   }
 
+  // .deepflow.FrozenParam frozen_param = 5;
+  if (this->has_frozen_param()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      5, *this->frozen_param_, output);
+  }
+
   // @@protoc_insertion_point(serialize_end:deepflow.BlockParam)
 }
 
@@ -22652,6 +26291,13 @@ void BlockParam::SerializeWithCachedSizes(
         4, this->initializer(i), deterministic, target);
   }
 
+  // .deepflow.FrozenParam frozen_param = 5;
+  if (this->has_frozen_param()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        5, *this->frozen_param_, deterministic, target);
+  }
+
   // @@protoc_insertion_point(serialize_to_array_end:deepflow.BlockParam)
   return target;
 }
@@ -22693,6 +26339,13 @@ size_t BlockParam::ByteSizeLong() const {
     }
   }
 
+  // .deepflow.FrozenParam frozen_param = 5;
+  if (this->has_frozen_param()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        *this->frozen_param_);
+  }
+
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = cached_size;
@@ -22725,6 +26378,9 @@ void BlockParam::MergeFrom(const BlockParam& from) {
   node_.MergeFrom(from.node_);
   solver_.MergeFrom(from.solver_);
   initializer_.MergeFrom(from.initializer_);
+  if (from.has_frozen_param()) {
+    mutable_frozen_param()->::deepflow::FrozenParam::MergeFrom(from.frozen_param());
+  }
 }
 
 void BlockParam::CopyFrom(const ::google::protobuf::Message& from) {
@@ -22753,6 +26409,7 @@ void BlockParam::InternalSwap(BlockParam* other) {
   node_.InternalSwap(&other->node_);
   solver_.InternalSwap(&other->solver_);
   initializer_.InternalSwap(&other->initializer_);
+  std::swap(frozen_param_, other->frozen_param_);
   std::swap(_cached_size_, other->_cached_size_);
 }
 
@@ -22854,6 +26511,45 @@ BlockParam::initializer() const {
   return initializer_;
 }
 
+// .deepflow.FrozenParam frozen_param = 5;
+bool BlockParam::has_frozen_param() const {
+  return this != internal_default_instance() && frozen_param_ != NULL;
+}
+void BlockParam::clear_frozen_param() {
+  if (GetArenaNoVirtual() == NULL && frozen_param_ != NULL) delete frozen_param_;
+  frozen_param_ = NULL;
+}
+const ::deepflow::FrozenParam& BlockParam::frozen_param() const {
+  // @@protoc_insertion_point(field_get:deepflow.BlockParam.frozen_param)
+  return frozen_param_ != NULL ? *frozen_param_
+                         : *::deepflow::FrozenParam::internal_default_instance();
+}
+::deepflow::FrozenParam* BlockParam::mutable_frozen_param() {
+  
+  if (frozen_param_ == NULL) {
+    frozen_param_ = new ::deepflow::FrozenParam;
+  }
+  // @@protoc_insertion_point(field_mutable:deepflow.BlockParam.frozen_param)
+  return frozen_param_;
+}
+::deepflow::FrozenParam* BlockParam::release_frozen_param() {
+  // @@protoc_insertion_point(field_release:deepflow.BlockParam.frozen_param)
+  
+  ::deepflow::FrozenParam* temp = frozen_param_;
+  frozen_param_ = NULL;
+  return temp;
+}
+void BlockParam::set_allocated_frozen_param(::deepflow::FrozenParam* frozen_param) {
+  delete frozen_param_;
+  frozen_param_ = frozen_param;
+  if (frozen_param) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:deepflow.BlockParam.frozen_param)
+}
+
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
 // ===================================================================
@@ -26065,6 +29761,7 @@ const int NodeParam::kInputFieldNumber;
 const int NodeParam::kOutputFieldNumber;
 const int NodeParam::kBlockParamFieldNumber;
 const int NodeParam::kDataPolicyFieldNumber;
+const int NodeParam::kLayoutFieldNumber;
 const int NodeParam::kVariableParamFieldNumber;
 const int NodeParam::kPlaceHolderParamFieldNumber;
 const int NodeParam::kAddParamFieldNumber;
@@ -26124,6 +29821,10 @@ const int NodeParam::kInstanceNormalizationFieldNumber;
 const int NodeParam::kSpatialTransformerParamFieldNumber;
 const int NodeParam::kNandParamFieldNumber;
 const int NodeParam::kGaborKernelParamFieldNumber;
+const int NodeParam::kSoftmaxCrossEntropyParamFieldNumber;
+const int NodeParam::kFusedElementwiseParamFieldNumber;
+const int NodeParam::kReorderParamFieldNumber;
+const int NodeParam::kSliceParamFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
 NodeParam::NodeParam()
@@ -26449,15 +30150,37 @@ NodeParam::NodeParam(const NodeParam& from)
   } else {
     gabor_kernel_param_ = NULL;
   }
-  data_policy_ = from.data_policy_;
+  if (from.has_softmax_cross_entropy_param()) {
+    softmax_cross_entropy_param_ = new ::deepflow::SoftmaxCrossEntropyParam(*from.softmax_cross_entropy_param_);
+  } else {
+    softmax_cross_entropy_param_ = NULL;
+  }
+  if (from.has_fused_elementwise_param()) {
+    fused_elementwise_param_ = new ::deepflow::FusedElementwiseParam(*from.fused_elementwise_param_);
+  } else {
+    fused_elementwise_param_ = NULL;
+  }
+  if (from.has_reorder_param()) {
+    reorder_param_ = new ::deepflow::ReorderParam(*from.reorder_param_);
+  } else {
+    reorder_param_ = NULL;
+  }
+  if (from.has_slice_param()) {
+    slice_param_ = new ::deepflow::SliceParam(*from.slice_param_);
+  } else {
+    slice_param_ = NULL;
+  }
+  ::memcpy(&data_policy_, &from.data_policy_,
+    reinterpret_cast<char*>(&layout_) -
+    reinterpret_cast<char*>(&data_policy_) + sizeof(layout_));
   // @@protoc_insertion_point(copy_constructor:deepflow.NodeParam)
 }
 
 void NodeParam::SharedCtor() {
   name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   scope_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&block_param_, 0, reinterpret_cast<char*>(&data_policy_) -
-    reinterpret_cast<char*>(&block_param_) + sizeof(data_policy_));
+  ::memset(&block_param_, 0, reinterpret_cast<char*>(&layout_) -
+    reinterpret_cast<char*>(&block_param_) + sizeof(layout_));
   _cached_size_ = 0;
 }
 
@@ -26649,6 +30372,18 @@ void NodeParam::SharedDtor() {
   if (this != internal_default_instance()) {
     delete gabor_kernel_param_;
   }
+  if (this != internal_default_instance()) {
+    delete softmax_cross_entropy_param_;
+  }
+  if (this != internal_default_instance()) {
+    delete fused_elementwise_param_;
+  }
+  if (this != internal_default_instance()) {
+    delete reorder_param_;
+  }
+  if (this != internal_default_instance()) {
+    delete slice_param_;
+  }
 }
 
 void NodeParam::SetCachedSize(int size) const {
@@ -26920,7 +30655,24 @@ void NodeParam::Clear() {
     delete gabor_kernel_param_;
   }
   gabor_kernel_param_ = NULL;
-  data_policy_ = 0;
+  if (GetArenaNoVirtual() == NULL && softmax_cross_entropy_param_ != NULL) {
+    delete softmax_cross_entropy_param_;
+  }
+  softmax_cross_entropy_param_ = NULL;
+  if (GetArenaNoVirtual() == NULL && fused_elementwise_param_ != NULL) {
+    delete fused_elementwise_param_;
+  }
+  fused_elementwise_param_ = NULL;
+  if (GetArenaNoVirtual() == NULL && reorder_param_ != NULL) {
+    delete reorder_param_;
+  }
+  reorder_param_ = NULL;
+  if (GetArenaNoVirtual() == NULL && slice_param_ != NULL) {
+    delete slice_param_;
+  }
+  slice_param_ = NULL;
+  ::memset(&data_policy_, 0, reinterpret_cast<char*>(&layout_) -
+    reinterpret_cast<char*>(&data_policy_) + sizeof(layout_));
 }
 
 bool NodeParam::MergePartialFromCodedStream(
@@ -27026,6 +30778,21 @@ bool NodeParam::MergePartialFromCodedStream(
         break;
       }
 
+      // .deepflow.NodeParam.Layout layout = 7;
+      case 7: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(56u)) {
+          int value;
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          set_layout(static_cast< ::deepflow::NodeParam_Layout >(value));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
       // .deepflow.VariableParam variable_param = 100;
       case 100: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
@@ -27734,6 +31501,54 @@ bool NodeParam::MergePartialFromCodedStream(
         break;
       }
 
+      // .deepflow.SoftmaxCrossEntropyParam softmax_cross_entropy_param = 164;
+      case 164: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(1314u)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_softmax_cross_entropy_param()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .deepflow.FusedElementwiseParam fused_elementwise_param = 165;
+      case 165: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(1322u)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_fused_elementwise_param()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .deepflow.ReorderParam reorder_param = 166;
+      case 166: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(1330u)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_reorder_param()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .deepflow.SliceParam slice_param = 167;
+      case 167: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(1338u)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_slice_param()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
       default: {
       handle_unusual:
         if (tag == 0 ||
@@ -27813,6 +31628,12 @@ void NodeParam::SerializeWithCachedSizes(
       6, this->data_policy(), output);
   }
 
+  // .deepflow.NodeParam.Layout layout = 7;
+  if (this->layout() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      7, this->layout(), output);
+  }
+
   // .deepflow.VariableParam variable_param = 100;
   if (this->has_variable_param()) {
     ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
@@ -28167,6 +31988,30 @@ void NodeParam::SerializeWithCachedSizes(
       163, *this->gabor_kernel_param_, output);
   }
 
+  // .deepflow.SoftmaxCrossEntropyParam softmax_cross_entropy_param = 164;
+  if (this->has_softmax_cross_entropy_param()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      164, *this->softmax_cross_entropy_param_, output);
+  }
+
+  // .deepflow.FusedElementwiseParam fused_elementwise_param = 165;
+  if (this->has_fused_elementwise_param()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      165, *this->fused_elementwise_param_, output);
+  }
+
+  // .deepflow.ReorderParam reorder_param = 166;
+  if (this->has_reorder_param()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      166, *this->reorder_param_, output);
+  }
+
+  // .deepflow.SliceParam slice_param = 167;
+  if (this->has_slice_param()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      167, *this->slice_param_, output);
+  }
+
   // @@protoc_insertion_point(serialize_end:deepflow.NodeParam)
 }
 
@@ -28231,6 +32076,12 @@ void NodeParam::SerializeWithCachedSizes(
       6, this->data_policy(), target);
   }
 
+  // .deepflow.NodeParam.Layout layout = 7;
+  if (this->layout() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
+      7, this->layout(), target);
+  }
+
   // .deepflow.VariableParam variable_param = 100;
   if (this->has_variable_param()) {
     target = ::google::protobuf::internal::WireFormatLite::
@@ -28644,6 +32495,34 @@ void NodeParam::SerializeWithCachedSizes(
         163, *this->gabor_kernel_param_, deterministic, target);
   }
 
+  // .deepflow.SoftmaxCrossEntropyParam softmax_cross_entropy_param = 164;
+  if (this->has_softmax_cross_entropy_param()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        164, *this->softmax_cross_entropy_param_, deterministic, target);
+  }
+
+  // .deepflow.FusedElementwiseParam fused_elementwise_param = 165;
+  if (this->has_fused_elementwise_param()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        165, *this->fused_elementwise_param_, deterministic, target);
+  }
+
+  // .deepflow.ReorderParam reorder_param = 166;
+  if (this->has_reorder_param()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        166, *this->reorder_param_, deterministic, target);
+  }
+
+  // .deepflow.SliceParam slice_param = 167;
+  if (this->has_slice_param()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        167, *this->slice_param_, deterministic, target);
+  }
+
   // @@protoc_insertion_point(serialize_to_array_end:deepflow.NodeParam)
   return target;
 }
@@ -29102,12 +32981,46 @@ size_t NodeParam::ByteSizeLong() const {
         *this->gabor_kernel_param_);
   }
 
+  // .deepflow.SoftmaxCrossEntropyParam softmax_cross_entropy_param = 164;
+  if (this->has_softmax_cross_entropy_param()) {
+    total_size += 2 +
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        *this->softmax_cross_entropy_param_);
+  }
+
+  // .deepflow.FusedElementwiseParam fused_elementwise_param = 165;
+  if (this->has_fused_elementwise_param()) {
+    total_size += 2 +
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        *this->fused_elementwise_param_);
+  }
+
+  // .deepflow.ReorderParam reorder_param = 166;
+  if (this->has_reorder_param()) {
+    total_size += 2 +
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        *this->reorder_param_);
+  }
+
+  // .deepflow.SliceParam slice_param = 167;
+  if (this->has_slice_param()) {
+    total_size += 2 +
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        *this->slice_param_);
+  }
+
   // .deepflow.NodeParam.DataPolicy data_policy = 6;
   if (this->data_policy() != 0) {
     total_size += 1 +
       ::google::protobuf::internal::WireFormatLite::EnumSize(this->data_policy());
   }
 
+  // .deepflow.NodeParam.Layout layout = 7;
+  if (this->layout() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::EnumSize(this->layout());
+  }
+
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = cached_size;
@@ -29327,9 +33240,24 @@ void NodeParam::MergeFrom(const NodeParam& from) {
   if (from.has_gabor_kernel_param()) {
     mutable_gabor_kernel_param()->::deepflow::GaborKernelParam::MergeFrom(from.gabor_kernel_param());
   }
+  if (from.has_softmax_cross_entropy_param()) {
+    mutable_softmax_cross_entropy_param()->::deepflow::SoftmaxCrossEntropyParam::MergeFrom(from.softmax_cross_entropy_param());
+  }
+  if (from.has_fused_elementwise_param()) {
+    mutable_fused_elementwise_param()->::deepflow::FusedElementwiseParam::MergeFrom(from.fused_elementwise_param());
+  }
+  if (from.has_reorder_param()) {
+    mutable_reorder_param()->::deepflow::ReorderParam::MergeFrom(from.reorder_param());
+  }
+  if (from.has_slice_param()) {
+    mutable_slice_param()->::deepflow::SliceParam::MergeFrom(from.slice_param());
+  }
   if (from.data_policy() != 0) {
     set_data_policy(from.data_policy());
   }
+  if (from.layout() != 0) {
+    set_layout(from.layout());
+  }
 }
 
 void NodeParam::CopyFrom(const ::google::protobuf::Message& from) {
@@ -29419,7 +33347,12 @@ void NodeParam::InternalSwap(NodeParam* other) {
   std::swap(spatial_transformer_param_, other->spatial_transformer_param_);
   std::swap(nand_param_, other->nand_param_);
   std::swap(gabor_kernel_param_, other->gabor_kernel_param_);
+  std::swap(softmax_cross_entropy_param_, other->softmax_cross_entropy_param_);
+  std::swap(fused_elementwise_param_, other->fused_elementwise_param_);
+  std::swap(reorder_param_, other->reorder_param_);
+  std::swap(slice_param_, other->slice_param_);
   std::swap(data_policy_, other->data_policy_);
+  std::swap(layout_, other->layout_);
   std::swap(_cached_size_, other->_cached_size_);
 }
 
@@ -29728,6 +33661,20 @@ void NodeParam::set_data_policy(::deepflow::NodeParam_DataPolicy value) {
   // @@protoc_insertion_point(field_set:deepflow.NodeParam.data_policy)
 }
 
+// .deepflow.NodeParam.Layout layout = 7;
+void NodeParam::clear_layout() {
+  layout_ = 0;
+}
+::deepflow::NodeParam_Layout NodeParam::layout() const {
+  // @@protoc_insertion_point(field_get:deepflow.NodeParam.layout)
+  return static_cast< ::deepflow::NodeParam_Layout >(layout_);
+}
+void NodeParam::set_layout(::deepflow::NodeParam_Layout value) {
+  
+  layout_ = value;
+  // @@protoc_insertion_point(field_set:deepflow.NodeParam.layout)
+}
+
 // .deepflow.VariableParam variable_param = 100;
 bool NodeParam::has_variable_param() const {
   return this != internal_default_instance() && variable_param_ != NULL;
@@ -32029,6 +35976,162 @@ void NodeParam::set_allocated_gabor_kernel_param(::deepflow::GaborKernelParam* g
   // @@protoc_insertion_point(field_set_allocated:deepflow.NodeParam.gabor_kernel_param)
 }
 
+// .deepflow.SoftmaxCrossEntropyParam softmax_cross_entropy_param = 164;
+bool NodeParam::has_softmax_cross_entropy_param() const {
+  return this != internal_default_instance() && softmax_cross_entropy_param_ != NULL;
+}
+void NodeParam::clear_softmax_cross_entropy_param() {
+  if (GetArenaNoVirtual() == NULL && softmax_cross_entropy_param_ != NULL) delete softmax_cross_entropy_param_;
+  softmax_cross_entropy_param_ = NULL;
+}
+const ::deepflow::SoftmaxCrossEntropyParam& NodeParam::softmax_cross_entropy_param() const {
+  // @@protoc_insertion_point(field_get:deepflow.NodeParam.softmax_cross_entropy_param)
+  return softmax_cross_entropy_param_ != NULL ? *softmax_cross_entropy_param_
+                         : *::deepflow::SoftmaxCrossEntropyParam::internal_default_instance();
+}
+::deepflow::SoftmaxCrossEntropyParam* NodeParam::mutable_softmax_cross_entropy_param() {
+  
+  if (softmax_cross_entropy_param_ == NULL) {
+    softmax_cross_entropy_param_ = new ::deepflow::SoftmaxCrossEntropyParam;
+  }
+  // @@protoc_insertion_point(field_mutable:deepflow.NodeParam.softmax_cross_entropy_param)
+  return softmax_cross_entropy_param_;
+}
+::deepflow::SoftmaxCrossEntropyParam* NodeParam::release_softmax_cross_entropy_param() {
+  // @@protoc_insertion_point(field_release:deepflow.NodeParam.softmax_cross_entropy_param)
+  
+  ::deepflow::SoftmaxCrossEntropyParam* temp = softmax_cross_entropy_param_;
+  softmax_cross_entropy_param_ = NULL;
+  return temp;
+}
+void NodeParam::set_allocated_softmax_cross_entropy_param(::deepflow::SoftmaxCrossEntropyParam* softmax_cross_entropy_param) {
+  delete softmax_cross_entropy_param_;
+  softmax_cross_entropy_param_ = softmax_cross_entropy_param;
+  if (softmax_cross_entropy_param) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:deepflow.NodeParam.softmax_cross_entropy_param)
+}
+
+// .deepflow.FusedElementwiseParam fused_elementwise_param = 165;
+bool NodeParam::has_fused_elementwise_param() const {
+  return this != internal_default_instance() && fused_elementwise_param_ != NULL;
+}
+void NodeParam::clear_fused_elementwise_param() {
+  if (GetArenaNoVirtual() == NULL && fused_elementwise_param_ != NULL) delete fused_elementwise_param_;
+  fused_elementwise_param_ = NULL;
+}
+const ::deepflow::FusedElementwiseParam& NodeParam::fused_elementwise_param() const {
+  // @@protoc_insertion_point(field_get:deepflow.NodeParam.fused_elementwise_param)
+  return fused_elementwise_param_ != NULL ? *fused_elementwise_param_
+                         : *::deepflow::FusedElementwiseParam::internal_default_instance();
+}
+::deepflow::FusedElementwiseParam* NodeParam::mutable_fused_elementwise_param() {
+  
+  if (fused_elementwise_param_ == NULL) {
+    fused_elementwise_param_ = new ::deepflow::FusedElementwiseParam;
+  }
+  // @@protoc_insertion_point(field_mutable:deepflow.NodeParam.fused_elementwise_param)
+  return fused_elementwise_param_;
+}
+::deepflow::FusedElementwiseParam* NodeParam::release_fused_elementwise_param() {
+  // @@protoc_insertion_point(field_release:deepflow.NodeParam.fused_elementwise_param)
+  
+  ::deepflow::FusedElementwiseParam* temp = fused_elementwise_param_;
+  fused_elementwise_param_ = NULL;
+  return temp;
+}
+void NodeParam::set_allocated_fused_elementwise_param(::deepflow::FusedElementwiseParam* fused_elementwise_param) {
+  delete fused_elementwise_param_;
+  fused_elementwise_param_ = fused_elementwise_param;
+  if (fused_elementwise_param) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:deepflow.NodeParam.fused_elementwise_param)
+}
+
+// .deepflow.ReorderParam reorder_param = 166;
+bool NodeParam::has_reorder_param() const {
+  return this != internal_default_instance() && reorder_param_ != NULL;
+}
+void NodeParam::clear_reorder_param() {
+  if (GetArenaNoVirtual() == NULL && reorder_param_ != NULL) delete reorder_param_;
+  reorder_param_ = NULL;
+}
+const ::deepflow::ReorderParam& NodeParam::reorder_param() const {
+  // @@protoc_insertion_point(field_get:deepflow.NodeParam.reorder_param)
+  return reorder_param_ != NULL ? *reorder_param_
+                         : *::deepflow::ReorderParam::internal_default_instance();
+}
+::deepflow::ReorderParam* NodeParam::mutable_reorder_param() {
+  
+  if (reorder_param_ == NULL) {
+    reorder_param_ = new ::deepflow::ReorderParam;
+  }
+  // @@protoc_insertion_point(field_mutable:deepflow.NodeParam.reorder_param)
+  return reorder_param_;
+}
+::deepflow::ReorderParam* NodeParam::release_reorder_param() {
+  // @@protoc_insertion_point(field_release:deepflow.NodeParam.reorder_param)
+  
+  ::deepflow::ReorderParam* temp = reorder_param_;
+  reorder_param_ = NULL;
+  return temp;
+}
+void NodeParam::set_allocated_reorder_param(::deepflow::ReorderParam* reorder_param) {
+  delete reorder_param_;
+  reorder_param_ = reorder_param;
+  if (reorder_param) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:deepflow.NodeParam.reorder_param)
+}
+
+// .deepflow.SliceParam slice_param = 167;
+bool NodeParam::has_slice_param() const {
+  return this != internal_default_instance() && slice_param_ != NULL;
+}
+void NodeParam::clear_slice_param() {
+  if (GetArenaNoVirtual() == NULL && slice_param_ != NULL) delete slice_param_;
+  slice_param_ = NULL;
+}
+const ::deepflow::SliceParam& NodeParam::slice_param() const {
+  // @@protoc_insertion_point(field_get:deepflow.NodeParam.slice_param)
+  return slice_param_ != NULL ? *slice_param_
+                         : *::deepflow::SliceParam::internal_default_instance();
+}
+::deepflow::SliceParam* NodeParam::mutable_slice_param() {
+  
+  if (slice_param_ == NULL) {
+    slice_param_ = new ::deepflow::SliceParam;
+  }
+  // @@protoc_insertion_point(field_mutable:deepflow.NodeParam.slice_param)
+  return slice_param_;
+}
+::deepflow::SliceParam* NodeParam::release_slice_param() {
+  // @@protoc_insertion_point(field_release:deepflow.NodeParam.slice_param)
+  
+  ::deepflow::SliceParam* temp = slice_param_;
+  slice_param_ = NULL;
+  return temp;
+}
+void NodeParam::set_allocated_slice_param(::deepflow::SliceParam* slice_param) {
+  delete slice_param_;
+  slice_param_ = slice_param;
+  if (slice_param) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:deepflow.NodeParam.slice_param)
+}
+
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
 // @@protoc_insertion_point(namespace_scope)
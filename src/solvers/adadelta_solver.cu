@@ -4,24 +4,22 @@
 
 #include <glog/logging.h>
 
-__global__
-void FillKernel(int n, float *a)
+__host__ __device__ inline void adadelta_update(const int i, float *w, float *g, float *h1, float *h2, const float momentum, const float learning_rate, const float delta)
 {
-	int i = blockIdx.x*blockDim.x + threadIdx.x;
-	if (i < n) a[i] = 0.0f;
+	float gi = g[i];
+	g[i] = 0;
+	float hi = h1[i] = momentum * h1[i] + (1 - momentum) * gi * gi;
+	gi = gi * sqrt((h2[i] + delta) / (hi + delta));
+	h2[i] = momentum * h2[i] + (1 - momentum) * gi * gi;		
+	w[i] -= learning_rate * gi;
 }
 
 __global__
-void AdaDeltaKernel(const int n, float *w, const float *g, float *h1, float *h2, const float momentum, const float learning_rate, const float delta)
+void AdaDeltaKernel(const int n, float *w, float *g, float *h1, float *h2, const float momentum, const float learning_rate, const float delta)
 {
 	int i = blockIdx.x*blockDim.x + threadIdx.x;
-	if (i < n) {
-		float gi = g[i];
-		float hi = h1[i] = momentum * h1[i] + (1 - momentum) * gi * gi;
-		gi = gi * sqrt((h2[i] + delta) / (hi + delta));
-		h2[i] = momentum * h2[i] + (1 - momentum) * gi * gi;		
-		w[i] -= learning_rate * gi;
-	}
+	if (i < n)
+		adadelta_update(i, w, g, h1, h2, momentum, learning_rate, delta);
 }
 
 AdaDeltaSolver::AdaDeltaSolver(deepflow::SolverParam *param) : Solver(param) {
@@ -41,20 +39,21 @@ void AdaDeltaSolver::apply(std::shared_ptr<Variable> var) {
 		return;
 	LOG_IF(INFO, verbos) << "applying solver " << name() << " ON " << var->name();	
 	auto size = var->output(0)->value()->size();
-	AdaDeltaKernel << <numOfBlocks(size), maxThreadsPerBlock, 0>> > (size, (float*)var->output(0)->value()->gpu_data(), (float*)var->gradients(), _h1, _h2, _my_param->momentum(), _learning_rate, _my_param->delta());
-	DF_KERNEL_CHECK();
-	var->reset_gradients();
+	if (var->is_cpu()) {
+		float *w = var->output(0)->value()->cpu_data(), *g = var->gradients();
+		for (int i = 0; i < size; ++i)
+			adadelta_update(i, w, g, _h1, _h2, _my_param->momentum(), _learning_rate, _my_param->delta());
+	}
+	else {
+		AdaDeltaKernel << <numOfBlocks(size), maxThreadsPerBlock, 0>> > (size, (float*)var->output(0)->value()->gpu_data(), (float*)var->gradients(), _h1, _h2, _my_param->momentum(), _learning_rate, _my_param->delta());
+		DF_KERNEL_CHECK();
+	}
+	var->gradients_applied();
 }
 
 void AdaDeltaSolver::init(std::shared_ptr<Variable> var) {
-	auto size = var->output(0)->value()->size();
-	auto sizeInBytes = var->output(0)->value()->bytes();
-	DF_CUDA_CHECK(cudaMalloc(&_h1, sizeInBytes));
-	FillKernel << <numOfBlocks(size), maxThreadsPerBlock >> >(size, _h1);
-	DF_KERNEL_CHECK();
-	DF_CUDA_CHECK(cudaMalloc(&_h2, sizeInBytes));	
-	FillKernel << <numOfBlocks(size), maxThreadsPerBlock >> >(size, _h2);
-	DF_KERNEL_CHECK();
+	_h1 = _state(var, 0);
+	_h2 = _state(var, 0);
 	_initialized = true;
 }
 
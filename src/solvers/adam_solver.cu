@@ -5,25 +5,22 @@
 
 #include <glog/logging.h>
 
-__global__
-void AdamFillKernel(const int n, const float value, float *dst)
+__host__ __device__ inline void adam_update(const int i, float *w, float *g, float *m, float *v, const float beta1, const float beta2, const float eps, const float learning_rate, const bool dry_run)
 {
-	int i = blockIdx.x*blockDim.x + threadIdx.x;
-	if (i < n)
-		dst[i] = value;
+	float gi = g[i];
+	g[i] = 0;
+	float mi = m[i] = m[i] * beta1 + gi*(1 - beta1);
+	float vi = v[i] = v[i] * beta2 + gi*gi*(1 - beta2);
+	if (!dry_run)
+		w[i] -= learning_rate * mi / (sqrt(vi) + eps);
 }
 
 __global__
-void AdamKernel(const int n, float *w, const float *g, float *m, float *v, const float beta1, const float beta2, const float eps, const float learning_rate, const bool dry_run)
+void AdamKernel(const int n, float *w, float *g, float *m, float *v, const float beta1, const float beta2, const float eps, const float learning_rate, const bool dry_run)
 {
 	int i = blockIdx.x*blockDim.x + threadIdx.x;
-	if (i < n) {
-		float gi = g[i];
-		float mi = m[i] = m[i] * beta1 + gi*(1 - beta1);
-		float vi = v[i] = v[i] * beta2 + gi*gi*(1 - beta2);
-		if (!dry_run)
-			w[i] -= learning_rate * mi / (sqrt(vi) + eps);
-	}
+	if (i < n)
+		adam_update(i, w, g, m, v, beta1, beta2, eps, learning_rate, dry_run);
 }
 
 AdamSolver::AdamSolver(deepflow::SolverParam *param) : Solver(param) {
@@ -49,19 +46,21 @@ void AdamSolver::apply(std::shared_ptr<Variable> var) {
 	double iter = context->current_iteration + 1;	
 	float corrected_lr = (float)((double)_learning_rate * std::sqrt(1.0 - pow(beta2, iter)) / (1.0 - pow(beta1, iter)));
 	LOG_IF(INFO, verbos) << "applying solver " << name() << " on " << var->name() << " | lr: " << corrected_lr;
-	AdamKernel << <numOfBlocks(size), maxThreadsPerBlock, 0 >> > (size, (float*)var->output(0)->value()->gpu_data(), (float*)var->gradients(), _m, _v, _my_param->beta1(), _my_param->beta2(), _my_param->eps(), corrected_lr, dry_run);
-	DF_KERNEL_CHECK();	
-	var->reset_gradients();
+	if (var->is_cpu()) {
+		float *w = var->output(0)->value()->cpu_data(), *g = var->gradients();
+		for (int i = 0; i < size; ++i)
+			adam_update(i, w, g, _m, _v, _my_param->beta1(), _my_param->beta2(), _my_param->eps(), corrected_lr, dry_run);
+	}
+	else {
+		AdamKernel << <numOfBlocks(size), maxThreadsPerBlock, 0 >> > (size, (float*)var->output(0)->value()->gpu_data(), (float*)var->gradients(), _m, _v, _my_param->beta1(), _my_param->beta2(), _my_param->eps(), corrected_lr, dry_run);
+		DF_KERNEL_CHECK();
+	}
+	var->gradients_applied();
 }
 
 void AdamSolver::init(std::shared_ptr<Variable> var) {
-	auto size = var->output(0)->value()->size();
-	auto sizeInBytes = var->output(0)->value()->bytes();
-	DF_CUDA_CHECK(cudaMalloc(&_m, sizeInBytes));	
-	DF_CUDA_CHECK(cudaMemset(_m, 0, sizeInBytes));
-	DF_CUDA_CHECK(cudaMalloc(&_v, sizeInBytes));
-	AdamFillKernel << < numOfBlocks(size), maxThreadsPerBlock >> > (size, 1, _v);
-	DF_KERNEL_CHECK();	
+	_m = _state(var, 0);
+	_v = _state(var, 1);
 	_initialized = true;
 }
 
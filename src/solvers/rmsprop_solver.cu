@@ -5,16 +5,21 @@
 
 #include <glog/logging.h>
 
+__host__ __device__ inline void rmsprop_update(const int i, float *w, float *g, float *h, const float rms_decay, const float eps, const float learning_rate, const bool dry_run)
+{
+	float gi = g[i];
+	g[i] = 0;
+	float hi = h[i] = rms_decay * h[i] * (1 - rms_decay) * gi * gi;		
+	if (!dry_run)
+		w[i] -= learning_rate * gi / (sqrt(hi) + eps);
+}
+
 __global__
-void RMSPropKernel(const int n, float *w, const float *g, float *h, const float rms_decay, const float eps, const float learning_rate, const bool dry_run)
+void RMSPropKernel(const int n, float *w, float *g, float *h, const float rms_decay, const float eps, const float learning_rate, const bool dry_run)
 {
 	int i = blockIdx.x*blockDim.x + threadIdx.x;
-	if (i < n) {
-		float gi = g[i];
-		float hi = h[i] = rms_decay * h[i] * (1 - rms_decay) * gi * gi;		
-		if (!dry_run)
-			w[i] -= learning_rate * gi / (sqrt(hi) + eps);
-	}
+	if (i < n)
+		rmsprop_update(i, w, g, h, rms_decay, eps, learning_rate, dry_run);
 }
 
 
@@ -38,16 +43,20 @@ void RMSPropSolver::apply(std::shared_ptr<Variable> var) {
 		return;
 	LOG_IF(INFO, verbos) << "applying solver " << name() << " on " << var->name();
 	auto size = var->output(0)->value()->size();
-	RMSPropKernel << <numOfBlocks(size), maxThreadsPerBlock, 0 >> > (size, (float*)var->output(0)->value()->gpu_data(), (float*)var->gradients(), _h, _my_param->rms_decay(), _my_param->eps(), _learning_rate, dry_run);
-	DF_KERNEL_CHECK();
-	var->reset_gradients();
+	if (var->is_cpu()) {
+		float *w = var->output(0)->value()->cpu_data(), *g = var->gradients();
+		for (int i = 0; i < size; ++i)
+			rmsprop_update(i, w, g, _h, _my_param->rms_decay(), _my_param->eps(), _learning_rate, dry_run);
+	}
+	else {
+		RMSPropKernel << <numOfBlocks(size), maxThreadsPerBlock, 0 >> > (size, (float*)var->output(0)->value()->gpu_data(), (float*)var->gradients(), _h, _my_param->rms_decay(), _my_param->eps(), _learning_rate, dry_run);
+		DF_KERNEL_CHECK();
+	}
+	var->gradients_applied();
 }
 
 void RMSPropSolver::init(std::shared_ptr<Variable> var) {
-	auto size = var->output(0)->value()->size();
-	auto sizeInBytes = var->output(0)->value()->bytes();
-	DF_CUDA_CHECK(cudaMalloc(&_h, sizeInBytes));
-	DF_CUDA_CHECK(cudaMemset(_h, 0, sizeInBytes));
+	_h = _state(var, 0);
 	_initialized = true;
 }
 
@@ -5,14 +5,19 @@
 
 #include "nodes/variable.h"
 
+__host__ __device__ inline void sgd_update(const int i, const float momentum, const float learning_rate, float *w, float *g, float *h)
+{
+	float gi = h[i] = momentum*h[i] + learning_rate*g[i];
+	g[i] = 0;
+	w[i] -= gi;
+}
+
 __global__
-void ApplyGradientKernel(const int n, const float momentum, const float learning_rate, float *w, const float *g, float *h)
+void ApplyGradientKernel(const int n, const float momentum, const float learning_rate, float *w, float *g, float *h)
 {
 	int i = blockIdx.x*blockDim.x + threadIdx.x;
-	if (i < n) {
-		float gi = h[i] = momentum*h[i] + learning_rate*g[i];
-		w[i] -= gi;
-	}
+	if (i < n)
+		sgd_update(i, momentum, learning_rate, w, g, h);
 }
 
 SGDSolver::SGDSolver(deepflow::SolverParam *param) : Solver(param) {
@@ -32,16 +37,20 @@ void SGDSolver::apply(std::shared_ptr<Variable> var) {
 		return;
 	LOG_IF(INFO, verbos) << "applying solver " << name() << " on " << var->name();
 	auto size = var->output(0)->value()->size();
-	ApplyGradientKernel << <numOfBlocks(size), maxThreadsPerBlock, 0>> > (size, _my_param->momentum(), _learning_rate, (float*)var->output(0)->value()->gpu_data(), (float*)var->gradients(), _h);
-	DF_KERNEL_CHECK();
-	var->reset_gradients();
+	if (var->is_cpu()) {
+		float *w = var->output(0)->value()->cpu_data(), *g = var->gradients();
+		for (int i = 0; i < size; ++i)
+			sgd_update(i, _my_param->momentum(), _learning_rate, w, g, _h);
+	}
+	else {
+		ApplyGradientKernel << <numOfBlocks(size), maxThreadsPerBlock, 0>> > (size, _my_param->momentum(), _learning_rate, (float*)var->output(0)->value()->gpu_data(), (float*)var->gradients(), _h);
+		DF_KERNEL_CHECK();
+	}
+	var->gradients_applied();
 }
 
 void SGDSolver::init(std::shared_ptr<Variable> var) {
-	auto size = var->output(0)->value()->size();
-	auto sizeInBytes = var->output(0)->value()->bytes();
-	DF_CUDA_CHECK(cudaMalloc(&_h, sizeInBytes));
-	DF_CUDA_CHECK(cudaMemset(_h, 0, sizeInBytes));
+	_h = _state(var, 0);
 	_initialized = true;
 }
 
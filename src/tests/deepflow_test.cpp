@@ -3,7 +3,20 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 #include <random>
+#include <cfloat>
 #include "core/session.h"
+#include "core/cpu_reduction.h"
+#include "core/cpu_math.h"
+#include "core/cpu_convolution.h"
+#include "core/cpu_philox.h"
+#include "nodes/replay_memory.h"
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <algorithm>
+#include <set>
+#include <fstream>
+#include <cstdlib>
 
 TEST(fill, initialization) {
 	std::random_device r;
@@ -371,6 +384,1198 @@ TEST(softmax, forward) {
 
 }
 
+TEST(session, to_aot_cpp) {
+	DeepFlow df;
+	auto x = df.place_holder({ 2, 3, 1, 1 }, PlaceholderOp("x"));
+	auto w = df.variable(df.fill({ 3, 4, 1, 1 }, 0.5f), "", VariableOp("w"));
+	auto b = df.variable(df.fill({ 1, 4, 1, 1 }, 1.0f), "", VariableOp("b"));
+	auto m = df.matmul(x, w, MatmulOp("m"));
+	df.relu(df.bias_add(m, b, BiasAddOp("bias")), ReluOp("y"));
+	auto session = df.session();
+	session->initialize();
+	auto code = session->to_aot_cpp({ "y" }, "net");
+	EXPECT_NE(code.find("kernels::matmul<2, 3, 4>"), std::string::npos);
+	EXPECT_NE(code.find("void run(const float * __restrict x, float * __restrict y)"), std::string::npos);
+	EXPECT_EQ(code.find("shared_ptr"), std::string::npos);
+	// bias_add and relu are fused into one in-place loop over the matmul output
+	auto first_loop = code.find("float v =");
+	EXPECT_NE(first_loop, std::string::npos);
+	EXPECT_EQ(code.find("float v =", first_loop + 1), std::string::npos);
+}
+
+TEST(session, to_aot_cpp_matches_session) {
+	DeepFlow df;
+	auto x = df.place_holder({ 2, 3, 1, 1 }, PlaceholderOp("x"));
+	auto w = df.variable(df.fill({ 3, 4, 1, 1 }, 0.5f), "", VariableOp("w"));
+	auto b = df.variable(df.fill({ 1, 4, 1, 1 }, 1.0f), "", VariableOp("b"));
+	auto m = df.bias_add(df.matmul(x, w, MatmulOp("m")), b, BiasAddOp("bias"));
+	df.log(df.exp(m, ExpOp("e")), LogOp("z").coef(0.5f));
+	auto session = df.session();
+	session->initialize();
+	std::vector<float> x_values = { 0.1f, -0.2f, 0.3f, -0.4f, 0.5f, -0.6f };
+	auto input = std::make_shared<Tensor>(std::array<int, 4>{ 2, 3, 1, 1 }, "input", Tensor::GPU_ONLY_POLICY);
+	input->set(x_values);
+	auto z = session->get_node("z");
+	session->forward({ z }, { { session->get_placeholder("x"), input } });
+	auto expected = z->output(0)->value()->to_vec();
+	// Build the generated unit with a driver that prints z, DEEPFLOW_TEST_CXX overrides the compiler command.
+	auto code = session->to_aot_cpp({ "z" }, "net");
+	code += "\n#include <cstdio>\n\nint main()\n{\n\tconst float x[] = { ";
+	for (auto v : x_values)
+		code += std::to_string(v) + "f, ";
+	code += "};\n\tfloat z[net::z_size];\n\tnet::run(x, z);\n\tfor (int i = 0; i < net::z_size; ++i)\n\t\tstd::printf(\"%.9g\\n\", z[i]);\n\treturn 0;\n}\n";
+	std::ofstream("aot_net.cpp") << code;
+	auto cxx = std::getenv("DEEPFLOW_TEST_CXX");
+#ifdef _MSC_VER
+	std::string compile = std::string(cxx ? cxx : "cl /nologo /O2 /EHsc") + " aot_net.cpp /Feaot_net.exe";
+	std::string run = "aot_net.exe > aot_net.txt";
+#else
+	std::string compile = std::string(cxx ? cxx : "c++ -O2") + " aot_net.cpp -o aot_net";
+	std::string run = "./aot_net > aot_net.txt";
+#endif
+	ASSERT_EQ(std::system(compile.c_str()), 0) << compile;
+	ASSERT_EQ(std::system(run.c_str()), 0) << run;
+	std::ifstream output("aot_net.txt");
+	std::vector<float> actual;
+	for (float v; output >> v;)
+		actual.push_back(v);
+	ASSERT_EQ(actual.size(), expected->size());
+	for (size_t i = 0; i < actual.size(); ++i)
+		EXPECT_NEAR(actual[i], expected->at(i), 1e-5f);
+}
+
+TEST(session, frozen_graph) {
+	DeepFlow df;
+	auto x = df.place_holder({ 2, 3, 1, 1 }, PlaceholderOp("x"));
+	auto w = df.variable(df.random_uniform({ 3, 4, 1, 1 }, -1, 1), "", VariableOp("w"));
+	auto m = df.matmul(x, w, MatmulOp("m"));
+	df.relu(df.leaky_relu(m, LeakyReluOp("l")), ReluOp("y"));
+	df.square(m, SquareOp("z"));
+	auto session = df.session();
+	session->initialize();
+	auto input = std::make_shared<Tensor>(std::array<int, 4>{ 2, 3, 1, 1 }, "input", Tensor::GPU_ONLY_POLICY);
+	input->set({ 1, -2, 3, -4, 5, -6 });
+	session->forward({ session->get_node("y") }, { { session->get_placeholder("x"), input } });
+	auto expected = session->get_node("y")->output(0)->value()->to_vec();
+	session->save_frozen("frozen_graph.bin", { "y" });
+
+	auto frozen = Session::load_frozen("frozen_graph.bin");
+	EXPECT_EQ(frozen->get_node("z", "", false), nullptr);
+	frozen->forward({ frozen->get_node("y") }, { { frozen->get_placeholder("x"), input } });
+	EXPECT_TRUE(frozen->get_node("y")->output(0)->value()->verify(*expected));
+}
+
+TEST(session, shared_weights) {
+	DeepFlow df;
+	df.variable(df.random_uniform({ 2, 3, 4, 5 }, -1, 1), "", VariableOp("w"));
+	auto session = df.session();
+	session->initialize();
+	auto expected = session->get_node("w")->output(0)->value()->to_vec();
+	session->save_shared_weights("shared_weights.bin");
+
+	DeepFlow cpu_df;
+	cpu_df.with(Tensor::CPU_ONLY_POLICY);
+	cpu_df.variable(cpu_df.fill({ 2, 3, 4, 5 }, 0), "", VariableOp("w"));
+	auto cpu_session = cpu_df.session();
+	cpu_session->map_shared_weights("shared_weights.bin");
+	cpu_session->initialize();
+	auto w = cpu_session->get_node("w")->output(0)->value();
+	EXPECT_TRUE(w->is_read_only());
+	EXPECT_TRUE(w->verify(*expected));
+}
+
+TEST(session, parallel_initialize) {
+	DeepFlow df;
+	auto sum = df.variable(df.fill({ 2, 2, 2, 2 }, 1), "", VariableOp("v0"));
+	for (int i = 1; i < 32; ++i)
+		sum = df.add(sum, df.variable(df.fill({ 2, 2, 2, 2 }, i), "", VariableOp("v" + std::to_string(i))));
+	auto session = df.session();
+	session->initialize(nullptr, true);
+	auto end = session->end_node("");
+	EXPECT_TRUE(end->isInitialized());
+	session->forward({ end });
+	double mean, std, min, max;
+	end->output(0)->value()->statistics(&mean, &std, &min, &max);
+	EXPECT_EQ(min, 1 + 31 * 32 / 2);
+	EXPECT_EQ(max, 1 + 31 * 32 / 2);
+}
+
+// Builds the same graph once with cuDNN and once on the host, runs a training step and an inference
+// forward on both and expects the outputs and the input gradients to agree.
+static void expect_cpu_matches_cudnn(std::array<int, 4> dims, const std::string &node_name, std::function<void(DeepFlow &, std::string)> build, float tolerance = 1e-4f) {
+	int size = dims[0] * dims[1] * dims[2] * dims[3];
+	std::vector<float> values(size);
+	for (int i = 0; i < size; ++i)
+		values[i] = 3 * sin(0.7f * i) + 0.5f;
+	std::shared_ptr<std::vector<float>> results[2][3];
+	for (int cpu = 0; cpu < 2; ++cpu) {
+		auto policy = cpu ? Tensor::CPU_ONLY_POLICY : Tensor::GPU_ONLY_POLICY;
+		DeepFlow df;
+		df.with(policy);
+		auto x = df.place_holder(dims, PlaceholderOp("x"));
+		build(df, x);
+		auto session = df.session();
+		auto context = std::make_shared<ExecutionContext>();
+		session->initialize(context);
+		auto node = session->get_node(node_name);
+		auto output_dims = node->output(0)->dims();
+		std::vector<float> grads(output_dims[0] * output_dims[1] * output_dims[2] * output_dims[3]);
+		for (int i = 0; i < grads.size(); ++i)
+			grads[i] = cos(0.3f * i);
+		auto input = std::make_shared<Tensor>(dims, "input", policy);
+		input->set(values);
+		auto dy = std::make_shared<Tensor>(output_dims, "dy", policy);
+		dy->set(grads);
+		session->forward({ node }, { { session->get_placeholder("x"), input } });
+		results[cpu][0] = node->output(0)->value()->to_vec();
+		session->backward({ node }, { { node, dy } });
+		results[cpu][1] = session->get_node("x")->output(0)->diff()->to_vec();
+		context->execution_mode = ExecutionContext::TEST;
+		session->forward({ node }, { { session->get_placeholder("x"), input } });
+		results[cpu][2] = node->output(0)->value()->to_vec();
+	}
+	for (int k = 0; k < 3; ++k) {
+		ASSERT_EQ(results[0][k]->size(), results[1][k]->size());
+		for (int i = 0; i < results[0][k]->size(); ++i)
+			EXPECT_NEAR(results[0][k]->at(i), results[1][k]->at(i), tolerance);
+	}
+}
+
+TEST(batch_normalization, cpu_matches_cudnn) {
+	expect_cpu_matches_cudnn({ 2, 3, 4, 5 }, "bn", [](DeepFlow &df, std::string x) {
+		df.batch_normalization(x, 3, "", BatchNormalizationOp("bn"));
+	});
+}
+
+TEST(pooling, cpu_matches_cudnn) {
+	expect_cpu_matches_cudnn({ 2, 3, 8, 10 }, "max2", [](DeepFlow &df, std::string x) {
+		df.pooling(x, PoolingOp("max2").window(2).stride(2));
+	});
+	expect_cpu_matches_cudnn({ 2, 3, 9, 11 }, "max3", [](DeepFlow &df, std::string x) {
+		df.pooling(x, PoolingOp("max3").window(3).stride(2).pad(1));
+	});
+	expect_cpu_matches_cudnn({ 2, 3, 9, 11 }, "avg", [](DeepFlow &df, std::string x) {
+		df.pooling(x, PoolingOp("avg").window(3).stride(2).pad(1).average());
+	});
+	expect_cpu_matches_cudnn({ 2, 3, 9, 11 }, "avg_pad", [](DeepFlow &df, std::string x) {
+		df.pooling(x, PoolingOp("avg_pad").window(3).stride(2).pad(1).average(true));
+	});
+}
+
+TEST(lrn, cpu_matches_cudnn) {
+	expect_cpu_matches_cudnn({ 2, 7, 4, 5 }, "lrn", [](DeepFlow &df, std::string x) {
+		df.lrn(x, LrnOp("lrn").n(5).alpha(0.1f));
+	});
+}
+
+TEST(layout, cpu_matches_cudnn) {
+	expect_cpu_matches_cudnn({ 2, 3, 8, 12 }, "patch_samples", [](DeepFlow &df, std::string x) {
+		df.patching(x, PatchingOp("patch_samples").down().samples().v(2).h(3));
+	});
+	expect_cpu_matches_cudnn({ 2, 3, 8, 12 }, "patch_channels", [](DeepFlow &df, std::string x) {
+		df.patching(x, PatchingOp("patch_channels").down().channels().v(4).h(2));
+	});
+	expect_cpu_matches_cudnn({ 6, 4, 3, 5 }, "unpatch_samples", [](DeepFlow &df, std::string x) {
+		df.patching(x, PatchingOp("unpatch_samples").up().samples().v(3).h(2));
+	});
+	expect_cpu_matches_cudnn({ 2, 8, 3, 5 }, "unpatch_channels", [](DeepFlow &df, std::string x) {
+		df.patching(x, PatchingOp("unpatch_channels").up().channels().v(2).h(2));
+	});
+	expect_cpu_matches_cudnn({ 2, 3, 8, 6 }, "lift_down", [](DeepFlow &df, std::string x) {
+		df.lifting(x, LiftingOp("lift_down").down());
+	});
+	expect_cpu_matches_cudnn({ 2, 3, 8, 6 }, "lift_down_flip", [](DeepFlow &df, std::string x) {
+		df.lifting(x, LiftingOp("lift_down_flip").down().with_flip());
+	});
+	expect_cpu_matches_cudnn({ 2, 8, 4, 3 }, "lift_up", [](DeepFlow &df, std::string x) {
+		df.lifting(x, LiftingOp("lift_up").up());
+	});
+	expect_cpu_matches_cudnn({ 2, 8, 4, 3 }, "lift_up_flip", [](DeepFlow &df, std::string x) {
+		df.lifting(x, LiftingOp("lift_up_flip").up().with_flip());
+	});
+	for (int first = 0; first < 4; ++first)
+		for (int second = first + 1; second < 4; ++second)
+			expect_cpu_matches_cudnn({ 2, 3, 4, 5 }, "restructure", [&](DeepFlow &df, std::string x) {
+				df.restructure(x, first, second, RestructureOp("restructure"));
+			});
+	expect_cpu_matches_cudnn({ 2, 3, 4, 5 }, "concate", [](DeepFlow &df, std::string x) {
+		auto y = df.restructure(x, 2, 3, RestructureOp("hw"));
+		df.concate({ df.restructure(y, 2, 3, RestructureOp("wh")), x }, ConcateOp("concate"));
+	});
+}
+
+TEST(resize, cpu_matches_cudnn) {
+	expect_cpu_matches_cudnn({ 2, 3, 6, 8 }, "up2", [](DeepFlow &df, std::string x) {
+		df.resize(x, 2, 2, ResizeOp("up2"));
+	});
+	expect_cpu_matches_cudnn({ 2, 3, 6, 8 }, "down2", [](DeepFlow &df, std::string x) {
+		df.resize(x, 0.5f, 0.5f, ResizeOp("down2"));
+	});
+	expect_cpu_matches_cudnn({ 2, 3, 6, 8 }, "nearest", [](DeepFlow &df, std::string x) {
+		df.resize(x, 1.5f, 0.75f, ResizeOp("nearest"));
+	});
+	expect_cpu_matches_cudnn({ 2, 3, 6, 8 }, "bilinear_up2", [](DeepFlow &df, std::string x) {
+		df.resize(x, 2, 2, ResizeOp("bilinear_up2").bilinear());
+	});
+	expect_cpu_matches_cudnn({ 2, 3, 6, 8 }, "bilinear", [](DeepFlow &df, std::string x) {
+		df.resize(x, 0.5f, 1.5f, ResizeOp("bilinear").bilinear());
+	});
+	expect_cpu_matches_cudnn({ 2, 3, 6, 8 }, "fused", [](DeepFlow &df, std::string x) {
+		auto skip = df.resize(x, 2, 2, ResizeOp("skip").bilinear());
+		df.resize_add(x, skip, 2, 2, ResizeOp("fused").alpha(0.3f).beta(0.7f));
+	});
+}
+
+TEST(elementwise, cpu_matches_cudnn) {
+	expect_cpu_matches_cudnn({ 2, 3, 4, 5 }, "relu", [](DeepFlow &df, std::string x) {
+		df.relu(x, ReluOp("relu"));
+	});
+	expect_cpu_matches_cudnn({ 2, 3, 4, 5 }, "sigmoid", [](DeepFlow &df, std::string x) {
+		df.sigmoid(x, SigmoidOp("sigmoid"));
+	});
+	expect_cpu_matches_cudnn({ 2, 3, 4, 5 }, "tanh", [](DeepFlow &df, std::string x) {
+		df.tanh(x, TanhOp("tanh"));
+	});
+	expect_cpu_matches_cudnn({ 2, 3, 4, 5 }, "clipped_relu", [](DeepFlow &df, std::string x) {
+		df.clipped_relu(x, ClippedReluOp("clipped_relu").threshold(2));
+	});
+	expect_cpu_matches_cudnn({ 2, 3, 4, 5 }, "elu", [](DeepFlow &df, std::string x) {
+		df.elu(x, EluOp("elu").alpha(0.5f));
+	});
+	expect_cpu_matches_cudnn({ 2, 3, 4, 5 }, "leaky_relu", [](DeepFlow &df, std::string x) {
+		df.leaky_relu(x, LeakyReluOp("leaky_relu").negative_slope(0.1f));
+	});
+	expect_cpu_matches_cudnn({ 2, 3, 4, 5 }, "log", [](DeepFlow &df, std::string x) {
+		df.log(df.exp(x), LogOp("log"));
+	});
+	expect_cpu_matches_cudnn({ 2, 3, 4, 5 }, "square", [](DeepFlow &df, std::string x) {
+		df.square(df.abs(x), SquareOp("square"));
+	});
+	expect_cpu_matches_cudnn({ 2, 3, 4, 5 }, "add", [](DeepFlow &df, std::string x) {
+		df.add(x, df.tanh(x), AddOp("add").alpha(0.5f).beta(-2));
+	});
+	expect_cpu_matches_cudnn({ 2, 3, 4, 5 }, "dot", [](DeepFlow &df, std::string x) {
+		df.dot(x, df.sigmoid(x), DotOp("dot"));
+	});
+	expect_cpu_matches_cudnn({ 2, 3, 4, 5 }, "max", [](DeepFlow &df, std::string x) {
+		df.max(x, df.variable(df.index_fill({ 2, 3, 4, 5 }, -60)), MaxOp("max"));
+	});
+	expect_cpu_matches_cudnn({ 2, 3, 4, 5 }, "nand", [](DeepFlow &df, std::string x) {
+		df.nand(x, df.variable(df.index_fill({ 2, 3, 4, 5 }, -60)), NandOp("nand"));
+	});
+	expect_cpu_matches_cudnn({ 2, 3, 4, 5 }, "bias_add", [](DeepFlow &df, std::string x) {
+		df.bias_add(x, df.variable(df.index_fill({ 1, 3, 1, 1 }, -1)), BiasAddOp("bias_add"));
+	});
+	expect_cpu_matches_cudnn({ 2, 3, 4, 5 }, "prelu", [](DeepFlow &df, std::string x) {
+		df.prelu(x, df.variable(df.index_fill({ 1, 3, 1, 1 }, 0.1f)), PReluOp("prelu"));
+	});
+	expect_cpu_matches_cudnn({ 2, 3, 4, 5 }, "dprelu", [](DeepFlow &df, std::string x) {
+		df.dprelu(x, df.variable(df.index_fill({ 2, 4, 1, 1 }, -2)), DPReluOp("dprelu"));
+	});
+}
+
+TEST(transposed_conv, cpu_matches_cudnn) {
+	// kernel, pad, stride, dilation: the DCGAN deconv, an even kernel, stride 1, a stride above the kernel and a dilated filter.
+	int configs[5][4] = { { 3, 1, 2, 1 }, { 4, 1, 2, 1 }, { 3, 1, 1, 1 }, { 2, 0, 3, 1 }, { 3, 2, 1, 2 } };
+	for (auto config : configs) {
+		expect_cpu_matches_cudnn({ 2, 4, 4, 5 }, "tconv", [&](DeepFlow &df, std::string x) {
+			auto f = df.variable(df.index_fill({ 4, 3, config[0], config[0] }, -6.0f * config[0] * config[0]));
+			auto scaled = df.add(f, f, AddOp().alpha(0.01f).beta(0));
+			df.transposed_conv2d(x, scaled, ConvolutionOp("tconv").kernel(config[0]).pad(config[1]).stride(config[2]).dilation(config[3]));
+		}, 1e-3f);
+	}
+}
+
+TEST(conv2d, cpu_matches_cudnn) {
+	// kernel, pad, stride, dilation
+	int configs[4][4] = { { 3, 1, 1, 1 }, { 5, 2, 2, 1 }, { 4, 0, 3, 1 }, { 3, 2, 1, 2 } };
+	for (auto config : configs) {
+		expect_cpu_matches_cudnn({ 2, 3, 9, 11 }, "conv", [&](DeepFlow &df, std::string x) {
+			auto f = df.variable(df.index_fill({ 4, 3, config[0], config[0] }, -6.0f * config[0] * config[0]));
+			auto scaled = df.add(f, f, AddOp().alpha(0.01f).beta(0));
+			df.conv2d(x, scaled, ConvolutionOp("conv").kernel(config[0]).pad(config[1]).stride(config[2]).dilation(config[3]));
+		}, 1e-3f);
+	}
+	// A blur takes the separable path, a Gabor bank the FFT or GEMM path.
+	expect_cpu_matches_cudnn({ 2, 3, 24, 24 }, "blur", [](DeepFlow &df, std::string x) {
+		df.gaussian_blur(x, 9, 2.0f, GaussianBlurOp("blur"));
+	});
+	expect_cpu_matches_cudnn({ 2, 1, 40, 40 }, "gabor", [](DeepFlow &df, std::string x) {
+		auto k = df.gabor_kernel(GaborKernelOp().orientations(8).scales({ 3.0f }).scaled());
+		df.conv2d(x, k, ConvolutionOp("gabor").pad(6));
+	}, 1e-3f);
+}
+
+TEST(cpu_convolution, cost_model_paths) {
+	struct Case {
+		std::string name;
+		CpuConvolution::Shape shape;
+		bool gaussian;
+		CpuConvolution::Algorithm expected;
+	};
+	std::vector<Case> cases = {
+		{ "blur 3x128x128 k9", { 1, 3, 128, 128, 3, 9, 9, 128, 128, 4, 4, 1, 1, 1, 1 }, true, CpuConvolution::ALGO_SEPARABLE },
+		{ "blur 3x256x256 k25", { 1, 3, 256, 256, 3, 25, 25, 256, 256, 12, 12, 1, 1, 1, 1 }, true, CpuConvolution::ALGO_SEPARABLE },
+		{ "gabor 16x1x256x256 k25", { 1, 1, 256, 256, 16, 25, 25, 256, 256, 12, 12, 1, 1, 1, 1 }, false, CpuConvolution::ALGO_FFT },
+		{ "dense 32x32x32 k3", { 8, 32, 32, 32, 32, 3, 3, 32, 32, 1, 1, 1, 1, 1, 1 }, false, CpuConvolution::ALGO_GEMM }
+	};
+	const char *names[] = { "auto", "gemm", "separable", "fft" };
+	for (auto &test : cases) {
+		auto &shape = test.shape;
+		std::vector<float> x((size_t)shape.n * shape.c * shape.h * shape.w), w((size_t)shape.k * shape.c * shape.r * shape.s);
+		for (size_t i = 0; i < x.size(); ++i)
+			x[i] = sin(0.37f * i);
+		// Diagonal Gaussian taps as ConvGaussianKernel makes them, or rotated Gabor-like taps.
+		for (int k = 0; k < shape.k; ++k)
+			for (int c = 0; c < shape.c; ++c)
+				for (int r = 0; r < shape.r; ++r)
+					for (int s = 0; s < shape.s; ++s) {
+						float dy = r - shape.r / 2.0f, dx = s - shape.s / 2.0f, theta = 3.141592f * k / shape.k;
+						float value = test.gaussian ? (k == c ? exp(-0.5f * (dx * dx + dy * dy) / 16.0f) / (2.0f * 3.141592f * 16.0f) : 0.0f) : exp(-0.5f * (dx * dx + dy * dy) / 36.0f) * cos(0.4f * (dx * cos(theta) + dy * sin(theta)) + c);
+						w[(((size_t)k * shape.c + c) * shape.r + r) * shape.s + s] = value;
+					}
+		auto chosen = CpuConvolution::choose_forward(shape, w.data());
+		EXPECT_EQ(chosen, test.expected) << test.name;
+		// Direct cross-correlation in double, independent of every CpuConvolution path.
+		std::vector<double> reference((size_t)shape.n * shape.k * shape.p * shape.q, 0.0);
+		for (int n = 0; n < shape.n; ++n)
+			for (int k = 0; k < shape.k; ++k)
+				for (int c = 0; c < shape.c; ++c)
+					for (int r = 0; r < shape.r; ++r)
+						for (int s = 0; s < shape.s; ++s) {
+							const double tap = w[(((size_t)k * shape.c + c) * shape.r + r) * shape.s + s];
+							if (tap == 0)
+								continue;
+							for (int p = 0; p < shape.p; ++p) {
+								const int h = p * shape.u + r * shape.dilation_h - shape.pad_h;
+								if (h < 0 || h >= shape.h)
+									continue;
+								const float *xr = &x[(((size_t)n * shape.c + c) * shape.h + h) * shape.w];
+								double *yr = &reference[(((size_t)n * shape.k + k) * shape.p + p) * shape.q];
+								for (int q = 0; q < shape.q; ++q) {
+									const int col = q * shape.v + s * shape.dilation_w - shape.pad_w;
+									if (col >= 0 && col < shape.w)
+										yr[q] += tap * xr[col];
+								}
+							}
+						}
+		std::vector<float> y(reference.size());
+		for (auto algorithm : { CpuConvolution::ALGO_GEMM, chosen }) {
+			CpuConvolution::forward(shape, x.data(), w.data(), y.data(), algorithm);
+			for (size_t i = 0; i < y.size(); ++i)
+				ASSERT_NEAR(y[i], reference[i], 1e-4f * (1 + std::abs(reference[i]))) << test.name << " " << names[algorithm] << " at " << i;
+		}
+	}
+}
+
+TEST(cpu_philox, random123_known_answers) {
+	// philox4x32_10 vectors from the Random123 kat_vectors file. The counter is (block, stream) and the
+	// key is the seed, both split into 32-bit words low word first.
+	struct Case {
+		uint64_t seed, stream, block;
+		uint32_t expected[4];
+	};
+	std::vector<Case> cases = {
+		{ 0, 0, 0, { 0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8 } },
+		{ 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, { 0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd } },
+		{ 0x299f31d0a4093822ULL, 0x0370734413198a2eULL, 0x85a308d3243f6a88ULL, { 0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1 } }
+	};
+	for (auto &test : cases) {
+		uint32_t out[4];
+		CpuPhilox::generate(test.seed, test.stream, test.block, 1, out);
+		for (int j = 0; j < 4; ++j)
+			EXPECT_EQ(out[j], test.expected[j]) << "seed " << test.seed << " word " << j;
+	}
+	// A batch spanning several lane groups gives the same blocks as generating them one at a time.
+	const uint64_t seed = 0x299f31d0a4093822ULL, stream = 7, first = 0xfffffff0ULL;
+	const size_t blocks = 75;
+	std::vector<uint32_t> batch(4 * blocks);
+	CpuPhilox::generate(seed, stream, first, blocks, batch.data());
+	for (size_t i = 0; i < blocks; ++i) {
+		uint32_t single[4];
+		CpuPhilox::generate(seed, stream, first + i, 1, single);
+		for (int j = 0; j < 4; ++j)
+			ASSERT_EQ(batch[4 * i + j], single[j]) << "block " << i << " word " << j;
+	}
+}
+
+TEST(dropout, cpu_bit_mask_and_test_alias) {
+	std::array<int, 4> dims = { 4, 8, 16, 16 };
+	int size = dims[0] * dims[1] * dims[2] * dims[3];
+	std::vector<float> values(size), grads(size);
+	for (int i = 0; i < size; ++i) {
+		values[i] = 1.0f + 0.5f * sin(0.7f * i);
+		grads[i] = cos(0.3f * i);
+	}
+	DeepFlow df;
+	df.with(Tensor::CPU_ONLY_POLICY);
+	auto x = df.place_holder(dims, PlaceholderOp("x"));
+	df.dropout(x, DropoutOp("drop").ratio(0.3f));
+	auto session = df.session();
+	auto context = std::make_shared<ExecutionContext>();
+	session->initialize(context);
+	auto node = session->get_node("drop");
+	auto input = std::make_shared<Tensor>(dims, "input", Tensor::CPU_ONLY_POLICY);
+	input->set(values);
+	auto dy = std::make_shared<Tensor>(dims, "dy", Tensor::CPU_ONLY_POLICY);
+	dy->set(grads);
+	session->forward({ node }, { { session->get_placeholder("x"), input } });
+	auto y = node->output(0)->value()->to_vec();
+	session->backward({ node }, { { node, dy } });
+	auto dx = session->get_node("x")->output(0)->diff()->to_vec();
+	// Kept elements are scaled by 1 / (1 - ratio), backward follows the same mask.
+	int dropped = 0;
+	for (int i = 0; i < size; ++i) {
+		if (y->at(i) == 0) {
+			++dropped;
+			EXPECT_EQ(dx->at(i), 0);
+		}
+		else {
+			EXPECT_NEAR(y->at(i), values[i] / 0.7f, 1e-5f);
+			EXPECT_NEAR(dx->at(i), grads[i] / 0.7f, 1e-5f);
+		}
+	}
+	EXPECT_NEAR((float)dropped / size, 0.3f, 0.02f);
+	// The next step draws a different mask.
+	session->forward({ node }, { { session->get_placeholder("x"), input } });
+	auto y2 = node->output(0)->value()->to_vec();
+	int changed = 0;
+	for (int i = 0; i < size; ++i)
+		changed += (y->at(i) == 0) != (y2->at(i) == 0);
+	EXPECT_GT(changed, size / 10);
+	// In TEST mode the output is the input itself, training goes back to the own buffer.
+	context->execution_mode = ExecutionContext::TEST;
+	session->forward({ node }, { { session->get_placeholder("x"), input } });
+	EXPECT_EQ(node->output(0)->value()->cpu_data(), node->input(0)->value()->cpu_data());
+	EXPECT_TRUE(node->output(0)->value()->verify(values));
+	context->execution_mode = ExecutionContext::TRAIN;
+	session->forward({ node }, { { session->get_placeholder("x"), input } });
+	EXPECT_NE(node->output(0)->value()->cpu_data(), node->input(0)->value()->cpu_data());
+}
+
+TEST(spatial_transformer, cpu_matches_cudnn) {
+	// A rotation with zoom and a shear that samples partly outside the input.
+	expect_cpu_matches_cudnn({ 2, 3, 8, 10 }, "st", [](DeepFlow &df, std::string x) {
+		auto theta = df.variable(df.constant({ 2, 1, 2, 3 }, { 0.9f, -0.3f, 0.1f, 0.25f, 1.1f, -0.2f, 1.2f, 0.4f, -0.3f, -0.5f, 0.8f, 0.15f }));
+		auto grid = df.variable(df.fill({ 2, 7, 9, 2 }, 0));
+		df.spatial_transformer(x, theta, grid, SpatialTransformerOp("st"));
+	}, 1e-3f);
+}
+
+TEST(patch_sampling, cpu_gather_and_backward) {
+	std::array<int, 4> dims = { 3, 2, 10, 12 };
+	int size = dims[0] * dims[1] * dims[2] * dims[3];
+	std::vector<float> values(size), grads(3 * 2 * 4 * 5);
+	for (int i = 0; i < size; ++i)
+		values[i] = (float)i;
+	for (int i = 0; i < grads.size(); ++i)
+		grads[i] = 1.0f + i;
+	DeepFlow df;
+	df.with(Tensor::CPU_ONLY_POLICY);
+	auto x = df.place_holder(dims, PlaceholderOp("x"));
+	df.patch_sampling(x, 5, 4, PatchSamplingOp("patch"));
+	auto session = df.session();
+	session->initialize(std::make_shared<ExecutionContext>());
+	auto node = session->get_node("patch");
+	auto input = std::make_shared<Tensor>(dims, "input", Tensor::CPU_ONLY_POLICY);
+	input->set(values);
+	auto dy = std::make_shared<Tensor>(node->output(0)->dims(), "dy", Tensor::CPU_ONLY_POLICY);
+	dy->set(grads);
+	session->forward({ node }, { { session->get_placeholder("x"), input } });
+	auto y = node->output(0)->value()->to_vec();
+	session->backward({ node }, { { node, dy } });
+	auto dx = session->get_node("x")->output(0)->diff()->to_vec();
+	// The input holds its own index, so the first patch element gives the sample's offset.
+	std::vector<float> expected_dx(size, 0);
+	for (int n = 0; n < 3; ++n) {
+		int origin = (int)y->at(n * 2 * 4 * 5) - n * 2 * 10 * 12;
+		int oy = origin / 12, ox = origin % 12;
+		ASSERT_LE(oy, 10 - 4);
+		ASSERT_LE(ox, 12 - 5);
+		for (int c = 0; c < 2; ++c)
+			for (int h = 0; h < 4; ++h)
+				for (int w = 0; w < 5; ++w) {
+					int out = ((n * 2 + c) * 4 + h) * 5 + w, in = ((n * 2 + c) * 10 + oy + h) * 12 + ox + w;
+					EXPECT_EQ(y->at(out), values[in]);
+					expected_dx[in] = grads[out];
+				}
+	}
+	for (int i = 0; i < size; ++i)
+		EXPECT_EQ(dx->at(i), expected_dx[i]);
+}
+
+TEST(replay_memory, cpu_ring_and_priorities) {
+	std::array<int, 4> dims = { 4, 1, 1, 3 };
+	for (int prioritized = 0; prioritized < 2; ++prioritized) {
+		DeepFlow df;
+		df.with(Tensor::CPU_ONLY_POLICY);
+		auto x = df.place_holder(dims, PlaceholderOp("x"));
+		auto op = ReplayMemoryOp("replay");
+		if (prioritized)
+			op.prioritized(1.0f);
+		df.replay_memory(x, 10, op);
+		auto session = df.session();
+		session->initialize(std::make_shared<ExecutionContext>());
+		auto memory = std::dynamic_pointer_cast<ReplayMemory>(session->get_node("replay"));
+		auto input = std::make_shared<Tensor>(dims, "input", Tensor::CPU_ONLY_POLICY);
+		// Sample s of the whole stream is (s, s, s), it lands in slot s % 10.
+		auto feed = [&](int step) {
+			std::vector<float> values(12);
+			for (int i = 0; i < 12; ++i)
+				values[i] = (float)(step * 4 + i / 3);
+			input->set(values);
+			session->forward({ memory }, { { session->get_placeholder("x"), input } });
+		};
+		for (int step = 0; step < 3; ++step)
+			feed(step);
+		if (prioritized) {
+			// Only slot 7 and the next batch, written to slots 2 to 5 at the largest priority, can be drawn.
+			std::vector<int> slots(10);
+			std::vector<float> priorities(10, 0.0f);
+			for (int i = 0; i < 10; ++i)
+				slots[i] = i;
+			priorities[7] = 1.0f;
+			memory->update_priorities(slots, priorities);
+		}
+		std::set<int> seen;
+		for (int step = 3; step < 20; ++step) {
+			feed(step);
+			auto y = memory->output(0)->value()->to_vec();
+			auto slots = memory->sampled_slots();
+			ASSERT_EQ(slots.size(), 4);
+			for (int i = 0; i < 4; ++i) {
+				int sample = (int)y->at(i * 3);
+				EXPECT_EQ(y->at(i * 3 + 1), sample);
+				EXPECT_EQ(sample % 10, slots[i]);
+				// Still in the ring: one of the last 10 samples written.
+				EXPECT_GT(sample, step * 4 + 3 - 10);
+				EXPECT_LE(sample, step * 4 + 3);
+				if (prioritized && step == 3)
+					EXPECT_TRUE(slots[i] == 7 || (slots[i] >= 2 && slots[i] <= 5));
+				seen.insert(slots[i]);
+			}
+			auto weights = memory->importance_weights(0.5f);
+			EXPECT_FLOAT_EQ(*std::max_element(weights.begin(), weights.end()), 1.0f);
+		}
+		// Draws are per sample, not one contiguous window.
+		EXPECT_GT(seen.size(), 4);
+	}
+}
+
+TEST(graph_fusion, cpu_matches_unfused) {
+	// conv -> bias_add -> batch_normalization -> leaky_relu -> tanh -> square -> exp -> matmul -> bias_add -> sigmoid
+	std::array<int, 4> dims = { 2, 3, 6, 6 };
+	auto values = [](int n, float scale, float offset) {
+		std::vector<float> v(n);
+		for (int i = 0; i < n; ++i)
+			v[i] = offset + scale * std::sin(0.7f * i + 0.3f);
+		return v;
+	};
+	struct Result {
+		std::shared_ptr<std::vector<float>> y, dx, dw, dm;
+		GraphFusion::Report report;
+		std::string cpp, aot;
+	};
+	auto run = [&](bool fuse, ExecutionContext::ExecutionMode mode) {
+		DeepFlow df;
+		df.with(Tensor::CPU_ONLY_POLICY);
+		auto x = df.place_holder(dims, PlaceholderOp("x"));
+		auto w = df.variable(df.fill({ 4, 3, 3, 3 }, 0), "", VariableOp("w"));
+		auto b = df.variable(df.fill({ 1, 4, 1, 1 }, 0), "", VariableOp("b"));
+		auto s = df.variable(df.fill({ 1, 4, 1, 1 }, 0), "", VariableOp("s"));
+		auto t = df.variable(df.fill({ 1, 4, 1, 1 }, 0), "", VariableOp("t"));
+		auto m = df.variable(df.fill({ 144, 5, 1, 1 }, 0), "", VariableOp("m"));
+		auto mb = df.variable(df.fill({ 1, 5, 1, 1 }, 0), "", VariableOp("mb"));
+		auto bn = df.batch_normalization(df.bias_add(df.conv2d(x, w, ConvolutionOp("conv")), b, BiasAddOp("ba")), s, t, BatchNormalizationOp("bn"));
+		auto chain = df.exp(df.square(df.tanh(df.leaky_relu(bn, LeakyReluOp("lrelu")), TanhOp("th")), SquareOp("sq")), ExpOp("ex"));
+		df.sigmoid(df.bias_add(df.matmul(chain, m, MatmulOp("mm")), mb, BiasAddOp("mba")), SigmoidOp("out"));
+		auto set = [&](const std::string &name, std::vector<float> v) {
+			auto weights = df.block()->find_node_param_by_name(name)->mutable_variable_param()->mutable_weights();
+			for (auto value : v)
+				weights->add_data(value);
+		};
+		set("w", values(108, 0.3f, 0));
+		set("b", values(4, 0.2f, 0));
+		set("s", values(4, 0.3f, 1));
+		set("t", values(4, 0.2f, 0.1f));
+		set("m", values(720, 0.05f, 0));
+		set("mb", values(5, 0.1f, 0));
+		auto bn_param = df.block()->find_node_param_by_name("bn")->mutable_batch_normalization_param();
+		for (auto v : values(4, 0.1f, 0.05f))
+			bn_param->mutable_mean()->add_data(v);
+		for (auto v : values(4, 0.3f, 0.8f))
+			bn_param->mutable_var()->add_data(v);
+		auto session = df.session();
+		auto context = std::make_shared<ExecutionContext>();
+		context->execution_mode = mode;
+		context->fuse_graph = fuse;
+		session->initialize(context);
+		auto out = session->get_node("out");
+		auto input = std::make_shared<Tensor>(dims, "input", Tensor::CPU_ONLY_POLICY);
+		input->set(values(216, 1.0f, 0));
+		session->forward({ out }, { { session->get_placeholder("x"), input } });
+		Result result;
+		result.y = out->output(0)->value()->to_vec();
+		result.report = session->fusion_report();
+		result.cpp = session->to_cpp();
+		result.aot = session->to_aot_cpp({ "out" }, "net");
+		if (mode == ExecutionContext::TRAIN) {
+			auto dy = std::make_shared<Tensor>(out->output(0)->dims(), "dy", Tensor::CPU_ONLY_POLICY);
+			dy->set(values(10, 1.0f, 0));
+			session->backward({ out }, { { out, dy } });
+			result.dx = session->get_node("x")->output(0)->diff()->to_vec();
+			result.dw = session->get_node("w")->output(0)->diff()->to_vec();
+			result.dm = session->get_node("m")->output(0)->diff()->to_vec();
+		}
+		return result;
+	};
+	auto expect_near = [](const std::vector<float> &a, const std::vector<float> &b, float tolerance) {
+		ASSERT_EQ(a.size(), b.size());
+		for (size_t i = 0; i < a.size(); ++i)
+			EXPECT_NEAR(a[i], b[i], tolerance * (1.0f + std::abs(b[i])));
+	};
+	// Training keeps batch normalization, the bias moves into the conv epilogue and the pointwise run becomes one node.
+	auto plain = run(false, ExecutionContext::TRAIN);
+	auto fused = run(true, ExecutionContext::TRAIN);
+	EXPECT_EQ(plain.report.nodes_removed, 0);
+	EXPECT_EQ(fused.report.folded_batch_norms, 0);
+	EXPECT_EQ(fused.report.epilogues, 2);
+	EXPECT_EQ(fused.report.chains, 1);
+	EXPECT_EQ(fused.report.nodes_removed, 6);
+	EXPECT_GT(fused.report.bytes, 0);
+	expect_near(*fused.y, *plain.y, 1e-5f);
+	expect_near(*fused.dx, *plain.dx, 1e-5f);
+	expect_near(*fused.dw, *plain.dw, 1e-5f);
+	expect_near(*fused.dm, *plain.dm, 1e-5f);
+	// Fused nodes export the nodes they stand for.
+	EXPECT_EQ(fused.cpp.find("MISSING"), std::string::npos);
+	for (auto call : { "df.bias_add(", "df.leaky_relu(", "df.tanh(", "df.square(", "df.exp(", "df.sigmoid(" })
+		EXPECT_NE(fused.cpp.find(call), std::string::npos) << call;
+	// and the AOT compiler lowers their epilogues and pointwise stages.
+	for (auto statement : { "v = v > 0.0f ? v : v * ", "v = std::tanh(v);", "v = v * v;", "v = std::exp(v);", "v = 1.0f / (1.0f + std::exp(-v));" })
+		EXPECT_NE(fused.aot.find(statement), std::string::npos) << statement;
+	// Inference folds bias_add and batch normalization into the conv, which then takes the leaky relu.
+	plain = run(false, ExecutionContext::TEST);
+	fused = run(true, ExecutionContext::TEST);
+	EXPECT_EQ(fused.report.folded_batch_norms, 1);
+	EXPECT_EQ(fused.report.epilogues, 2);
+	EXPECT_EQ(fused.report.chains, 1);
+	EXPECT_EQ(fused.report.nodes_removed, 9);
+	EXPECT_EQ(fused.report.variable_bytes, 2 * 2 * 4 * sizeof(float));
+	expect_near(*fused.y, *plain.y, 1e-4f);
+}
+
+TEST(graph_simplifier, cpu_matches_unsimplified) {
+	// k -> exp -> square is constant, th2 repeats th1 and sq reads y without being fetched.
+	std::array<int, 4> dims = { 2, 3, 4, 4 };
+	auto values = [](int n, float scale, float offset) {
+		std::vector<float> v(n);
+		for (int i = 0; i < n; ++i)
+			v[i] = offset + scale * std::sin(0.7f * i + 0.3f);
+		return v;
+	};
+	auto run = [&](bool simplify, GraphSimplifier::Report *report) {
+		DeepFlow df;
+		df.with(Tensor::CPU_ONLY_POLICY);
+		auto x = df.place_holder(dims, PlaceholderOp("x"));
+		auto k = df.variable(df.fill({ 1, 3, 1, 1 }, 0), "", VariableOp("k"));
+		auto weights = df.block()->find_node_param_by_name("k")->mutable_variable_param()->mutable_weights();
+		for (auto v : values(3, 0.5f, 0))
+			weights->add_data(v);
+		auto y = df.bias_add(x, df.square(df.exp(k, ExpOp("ek")), SquareOp("sk")), BiasAddOp("y"));
+		df.add(df.tanh(y, TanhOp("th1")), df.tanh(y, TanhOp("th2")), AddOp("out"));
+		df.square(y, SquareOp("sq"));
+		auto session = df.session();
+		if (simplify)
+			session->simplify({ "out" });
+		session->initialize();
+		*report = session->simplifier_report();
+		auto out = session->get_node("out");
+		EXPECT_EQ(session->get_node("th2", "", false) == nullptr, simplify);
+		EXPECT_EQ(session->get_node("sq", "", false) == nullptr, simplify);
+		EXPECT_EQ(session->get_node("ek", "", false) == nullptr, simplify);
+		auto input = std::make_shared<Tensor>(dims, "input", Tensor::CPU_ONLY_POLICY);
+		input->set(values(96, 1.0f, 0));
+		session->forward({ out }, { { session->get_placeholder("x"), input } });
+		return out->output(0)->value()->to_vec();
+	};
+	GraphSimplifier::Report plain_report, report;
+	auto plain = run(false, &plain_report);
+	auto simplified = run(true, &report);
+	EXPECT_EQ(plain_report.folded, 0);
+	EXPECT_EQ(report.deduplicated, 1);
+	EXPECT_EQ(report.folded, 1);
+	EXPECT_EQ(report.dead, 1);
+	EXPECT_EQ(report.constant_bytes, 3 * sizeof(float));
+	ASSERT_EQ(plain->size(), simplified->size());
+	for (size_t i = 0; i < plain->size(); ++i)
+		EXPECT_NEAR(plain->at(i), simplified->at(i), 1e-6f * (1.0f + std::abs(plain->at(i))));
+}
+
+TEST(graph_simplifier, drops_unfetched_sinks) {
+	// The gaussian kernel has no inputs and folds, sq only feeds a display that is not fetched. The cross
+	// entropy loss is never fetched either but is kept with its inputs, as solvers minimise it.
+	auto build = [](DeepFlow &df) {
+		df.with(Tensor::CPU_ONLY_POLICY);
+		auto x = df.place_holder({ 1, 1, 8, 8 }, PlaceholderOp("x"));
+		df.conv2d(x, df.gaussian_kernel(3, 1.0f, GaussianKernelOp("k")), ConvolutionOp("out"));
+		df.display(df.square(x, SquareOp("sq")), DisplayOp("disp"));
+		auto labels = df.place_holder({ 1, 1, 8, 8 }, PlaceholderOp("labels"));
+		df.softmax_cross_entropy(df.abs(x, AbsOp("logits")), labels, SoftmaxCrossEntropyOp("ce"));
+	};
+	std::vector<std::string> evaluated;
+	auto evaluate = [&](const deepflow::BlockParam &constants, const std::vector<std::string> &names, std::vector<GraphSimplifier::Constant> *values) {
+		evaluated.insert(evaluated.end(), names.begin(), names.end());
+		for (size_t i = 0; i < names.size(); ++i)
+			values->push_back({ { 1, 1, 3, 3 }, std::vector<float>(9, 1.0f / 9) });
+	};
+	DeepFlow fetched;
+	build(fetched);
+	auto report = GraphSimplifier::run(fetched.block()->block_param(), { "out" }, evaluate);
+	EXPECT_EQ(report.folded, 1);
+	EXPECT_EQ(report.dead, 2);
+	ASSERT_EQ(evaluated, std::vector<std::string>({ "k" }));
+	EXPECT_TRUE(fetched.block()->find_node_param_by_name("k")->has_variable_param());
+	EXPECT_EQ(fetched.block()->find_node_param_by_name("sq"), nullptr);
+	EXPECT_EQ(fetched.block()->find_node_param_by_name("disp"), nullptr);
+	EXPECT_NE(fetched.block()->find_node_param_by_name("ce"), nullptr);
+	EXPECT_NE(fetched.block()->find_node_param_by_name("logits"), nullptr);
+	EXPECT_NE(fetched.block()->find_node_param_by_name("labels"), nullptr);
+	EXPECT_EQ(fetched.block()->block_param()->node_size(), 6);
+	// Without fetches the display is wanted and keeps sq alive.
+	DeepFlow unfetched;
+	build(unfetched);
+	report = GraphSimplifier::run(unfetched.block()->block_param(), {}, evaluate);
+	EXPECT_EQ(report.folded, 1);
+	EXPECT_EQ(report.dead, 0);
+	EXPECT_EQ(unfetched.block()->block_param()->node_size(), 8);
+}
+
+TEST(graph_layout, cpu_layouts_match_nchw) {
+	// conv -> bias_add -> batch_normalization -> relu -> concate -> patching -> restructure stay in the
+	// chosen layout, square has no consumers and reads NCHW through one reorder.
+	std::array<int, 4> dims = { 2, 3, 6, 6 };
+	auto values = [](int n, float scale, float offset) {
+		std::vector<float> v(n);
+		for (int i = 0; i < n; ++i)
+			v[i] = offset + scale * std::sin(0.7f * i + 0.3f);
+		return v;
+	};
+	struct Result {
+		std::shared_ptr<std::vector<float>> y, dx, dw, db;
+		GraphLayout::Report report;
+	};
+	auto run = [&](ExecutionContext::TensorLayout layout) {
+		DeepFlow df;
+		df.with(Tensor::CPU_ONLY_POLICY);
+		auto x = df.place_holder(dims, PlaceholderOp("x"));
+		auto w = df.variable(df.fill({ 16, 3, 3, 3 }, 0), "", VariableOp("w"));
+		auto b = df.variable(df.fill({ 1, 16, 1, 1 }, 0), "", VariableOp("b"));
+		auto s = df.variable(df.fill({ 1, 16, 1, 1 }, 0), "", VariableOp("s"));
+		auto t = df.variable(df.fill({ 1, 16, 1, 1 }, 0), "", VariableOp("t"));
+		auto relu = df.relu(df.batch_normalization(df.bias_add(df.conv2d(x, w, ConvolutionOp("conv")), b, BiasAddOp("ba")), s, t, BatchNormalizationOp("bn")), ReluOp("relu"));
+		auto patches = df.patching(df.concate({ relu, relu }, ConcateOp("cat")), PatchingOp("patch").samples().down());
+		df.square(df.restructure(patches, 2, 3, RestructureOp("rs")), SquareOp("out"));
+		auto set = [&](const std::string &name, std::vector<float> v) {
+			auto weights = df.block()->find_node_param_by_name(name)->mutable_variable_param()->mutable_weights();
+			for (auto value : v)
+				weights->add_data(value);
+		};
+		set("w", values(432, 0.3f, 0));
+		set("b", values(16, 0.2f, 0));
+		set("s", values(16, 0.3f, 1));
+		set("t", values(16, 0.2f, 0.1f));
+		auto session = df.session();
+		auto context = std::make_shared<ExecutionContext>();
+		context->cpu_layout = layout;
+		session->initialize(context);
+		auto out = session->get_node("out");
+		EXPECT_EQ(out->output(0)->value()->layout(), Tensor::NCHW);
+		auto input = std::make_shared<Tensor>(dims, "input", Tensor::CPU_ONLY_POLICY);
+		input->set(values(216, 1.0f, 0));
+		session->forward({ out }, { { session->get_placeholder("x"), input } });
+		Result result;
+		result.y = out->output(0)->value()->to_vec();
+		result.report = session->layout_report();
+		auto dy = std::make_shared<Tensor>(out->output(0)->dims(), "dy", Tensor::CPU_ONLY_POLICY);
+		dy->set(values(out->output(0)->value()->size(), 1.0f, 0));
+		session->backward({ out }, { { out, dy } });
+		result.dx = session->get_node("x")->output(0)->diff()->to_vec();
+		result.dw = session->get_node("w")->output(0)->diff()->to_vec();
+		result.db = session->get_node("b")->output(0)->diff()->to_vec();
+		return result;
+	};
+	auto expect_near = [](const std::vector<float> &a, const std::vector<float> &b, float tolerance) {
+		ASSERT_EQ(a.size(), b.size());
+		for (size_t i = 0; i < a.size(); ++i)
+			EXPECT_NEAR(a[i], b[i], tolerance * (1.0f + std::abs(b[i])));
+	};
+	auto plain = run(ExecutionContext::NCHW);
+	auto nhwc = run(ExecutionContext::NHWC);
+	auto blocked = run(ExecutionContext::NCHW16C);
+	EXPECT_EQ(plain.report.reorders, 0);
+	EXPECT_EQ(nhwc.report.nhwc, 7);
+	EXPECT_EQ(nhwc.report.reorders, 1);
+	EXPECT_EQ(blocked.report.nchw16c, 7);
+	EXPECT_EQ(blocked.report.reorders, 1);
+	for (auto result : { nhwc, blocked }) {
+		expect_near(*result.y, *plain.y, 1e-4f);
+		expect_near(*result.dx, *plain.dx, 1e-4f);
+		expect_near(*result.dw, *plain.dw, 1e-4f);
+		expect_near(*result.db, *plain.db, 1e-4f);
+	}
+}
+
+TEST(tensor_view, restructure_and_slice_serve_windows) {
+	// back undoes the restructure around a slice of the widths, so it is a strided window of x. second
+	// is the second sample of x, a contiguous window.
+	std::array<int, 4> dims = { 2, 3, 4, 5 };
+	DeepFlow df;
+	df.with(Tensor::CPU_ONLY_POLICY);
+	auto x = df.place_holder(dims, PlaceholderOp("x"));
+	auto widths = df.slice(df.restructure(x, 1, 3, RestructureOp("wc")), 1, 1, 3, SliceOp("widths"));
+	df.square(df.restructure(widths, 1, 3, RestructureOp("back")), SquareOp("sq"));
+	df.slice(x, 0, 1, 1, SliceOp("second"));
+	auto session = df.session();
+	session->initialize();
+	std::vector<float> values(120);
+	for (int i = 0; i < 120; ++i)
+		values[i] = 0.1f * i - 5.0f;
+	auto input = std::make_shared<Tensor>(dims, "input", Tensor::CPU_ONLY_POLICY);
+	input->set(values);
+	auto sq = session->get_node("sq");
+	auto second = session->get_node("second");
+	session->forward({ sq, second }, { { session->get_placeholder("x"), input } });
+	auto x_value = session->get_node("x")->output(0)->value();
+	auto back = session->get_node("back")->output(0)->value();
+	EXPECT_EQ(back->dims(), (std::array<int, 4>{ 2, 3, 4, 3 }));
+	EXPECT_FALSE(back->is_contiguous());
+	EXPECT_TRUE(second->output(0)->value()->is_contiguous());
+	EXPECT_EQ(second->output(0)->value()->cpu_data(), x_value->cpu_data() + 60);
+	auto y = sq->output(0)->value()->to_vec();
+	auto y_second = second->output(0)->value()->to_vec();
+	for (int i = 0; i < 72; ++i) {
+		float v = values[i / 3 * 5 + i % 3 + 1];
+		EXPECT_NEAR(y->at(i), v * v, 1e-5f);
+	}
+	for (int i = 0; i < 60; ++i)
+		EXPECT_EQ(y_second->at(i), values[60 + i]);
+	auto dy = std::make_shared<Tensor>(sq->output(0)->dims(), "dy", Tensor::CPU_ONLY_POLICY);
+	dy->set(std::vector<float>(72, 1.0f));
+	session->backward({ sq }, { { sq, dy } });
+	auto dx = session->get_node("x")->output(0)->diff()->to_vec();
+	for (int i = 0; i < 120; ++i) {
+		int w = i % 5;
+		EXPECT_NEAR(dx->at(i), w >= 1 && w <= 3 ? 2 * values[i] : 0.0f, 1e-5f);
+	}
+}
+
+TEST(session, step_memoizes_unchanged_nodes) {
+	// Within a step sq and e run again only when x is fed, dropout draws a new mask on every forward and
+	// batch normalization is only reused in TEST.
+	DeepFlow df;
+	df.with(Tensor::CPU_ONLY_POLICY);
+	auto x = df.place_holder({ 1, 1, 2, 2 }, PlaceholderOp("x"));
+	auto sq = df.square(x, SquareOp("sq"));
+	df.exp(sq, ExpOp("e"));
+	df.abs(sq, AbsOp("a"));
+	df.dropout(sq, DropoutOp("drop"));
+	df.batch_normalization(x, 1, "", BatchNormalizationOp("bn"));
+	auto session = df.session();
+	auto context = std::make_shared<ExecutionContext>();
+	session->initialize(context);
+	auto input = std::make_shared<Tensor>(std::array<int, 4>{ 1, 1, 2, 2 }, "input", Tensor::CPU_ONLY_POLICY);
+	input->set({ 1, 2, 3, 4 });
+	auto placeholder = session->get_placeholder("x");
+	auto e = session->get_node("e"), a = session->get_node("a"), drop = session->get_node("drop"), bn = session->get_node("bn");
+	auto sq_output = session->get_node("sq")->output(0);
+
+	session->begin_step();
+	session->forward({ e }, { { placeholder, input } });
+	auto sq_version = sq_output->version(), e_version = e->output(0)->version();
+	session->forward({ e });
+	session->forward({ a });
+	EXPECT_EQ(sq_output->version(), sq_version);
+	EXPECT_EQ(e->output(0)->version(), e_version);
+	EXPECT_TRUE(a->output(0)->value()->verify({ 1, 4, 9, 16 }));
+	session->forward({ drop });
+	auto drop_version = drop->output(0)->version();
+	session->forward({ drop });
+	EXPECT_NE(drop->output(0)->version(), drop_version);
+	EXPECT_EQ(sq_output->version(), sq_version);
+	input->set({ 2, 2, 2, 2 });
+	session->forward({ e }, { { placeholder, input } });
+	EXPECT_NE(sq_output->version(), sq_version);
+	EXPECT_TRUE(sq_output->value()->verify({ 4, 4, 4, 4 }));
+	sq_version = sq_output->version();
+	// A constant batch normalizes to the zero bias in TRAIN, the running statistics map it elsewhere in TEST.
+	session->forward({ bn });
+	EXPECT_TRUE(bn->output(0)->value()->verify({ 0, 0, 0, 0 }));
+	auto bn_version = bn->output(0)->version();
+	context->execution_mode = ExecutionContext::TEST;
+	session->forward({ bn });
+	EXPECT_NE(bn->output(0)->version(), bn_version);
+	EXPECT_GT(bn->output(0)->value()->to_vec()->at(0), 1.0f);
+	bn_version = bn->output(0)->version();
+	session->forward({ bn });
+	EXPECT_EQ(bn->output(0)->version(), bn_version);
+	context->execution_mode = ExecutionContext::TRAIN;
+	session->end_step();
+
+	session->forward({ e });
+	EXPECT_NE(sq_output->version(), sq_version);
+	sq_version = sq_output->version();
+	session->begin_step();
+	session->forward({ e });
+	EXPECT_NE(sq_output->version(), sq_version);
+	session->end_step();
+}
+
+TEST(session, backward_skips_what_no_solver_needs) {
+	// d = (z * wg) * wd. With the solver of wg disabled nothing but wd takes a gradient, diffs set to 7 stay.
+	DeepFlow df;
+	df.with(Tensor::CPU_ONLY_POLICY);
+	auto z = df.place_holder({ 1, 1, 2, 2 }, PlaceholderOp("z"));
+	auto g_solver = df.sgd_solver(SgdSolverOp("g_solver"));
+	auto d_solver = df.sgd_solver(SgdSolverOp("d_solver"));
+	auto g = df.dot(z, df.variable(df.fill({ 1, 1, 2, 2 }, 2), g_solver, VariableOp("wg")), DotOp("g"));
+	df.dot(g, df.variable(df.fill({ 1, 1, 2, 2 }, 3), d_solver, VariableOp("wd")), DotOp("d"));
+	auto context = std::make_shared<ExecutionContext>();
+	context->prune_backward = true;
+	auto session = df.session();
+	session->initialize(context);
+	auto input = std::make_shared<Tensor>(std::array<int, 4>{ 1, 1, 2, 2 }, "input", Tensor::CPU_ONLY_POLICY);
+	input->set({ 1, 2, 3, 4 });
+	auto ones = std::make_shared<Tensor>(std::array<int, 4>{ 1, 1, 2, 2 }, "ones", Tensor::CPU_ONLY_POLICY);
+	ones->set({ 1, 1, 1, 1 });
+	auto placeholder = session->get_placeholder("z");
+	auto d = session->get_node("d");
+	auto z_diff = placeholder->output(0)->diff();
+	auto g_diff = session->get_node("g")->output(0)->diff();
+	auto wg_diff = session->get_node("wg")->output(0)->diff();
+	auto wd_diff = session->get_node("wd")->output(0)->diff();
+	for (auto diff : { z_diff, g_diff, wg_diff })
+		diff->set({ 7, 7, 7, 7 });
+
+	session->set_enabled_solvers(false, std::list<std::string>{ "g_solver" });
+	session->forward({ d }, { { placeholder, input } });
+	session->backward({ d }, { { d, ones } });
+	EXPECT_TRUE(wd_diff->verify({ 2, 4, 6, 8 }));
+	EXPECT_TRUE(g_diff->verify({ 7, 7, 7, 7 }));
+	EXPECT_TRUE(wg_diff->verify({ 7, 7, 7, 7 }));
+	EXPECT_FALSE(session->get_node("g")->needsBackward());
+
+	session->set_enabled_solvers(true, std::list<std::string>{ "g_solver" });
+	session->backward({ d }, { { d, ones } });
+	EXPECT_TRUE(g_diff->verify({ 3, 3, 3, 3 }));
+	EXPECT_TRUE(wg_diff->verify({ 3, 6, 9, 12 }));
+	EXPECT_TRUE(z_diff->verify({ 7, 7, 7, 7 }));
+
+	// Host updates from the accumulated gradients: wd took x * 2 twice, wg x * 3 once, lr is 0.1.
+	session->apply_solvers();
+	EXPECT_TRUE(session->get_node("wd")->output(0)->value()->verify({ 2.6f, 2.2f, 1.8f, 1.4f }));
+	EXPECT_TRUE(session->get_node("wg")->output(0)->value()->verify({ 1.7f, 1.4f, 1.1f, 0.8f }));
+}
+
+TEST(session, fused_update_applies_solvers_in_backward) {
+	// d = x * w, the gradient of w is x and sgd without momentum moves w by -0.5 x, its diff left zeroed.
+	DeepFlow df;
+	auto x = df.place_holder({ 1, 1, 2, 2 }, PlaceholderOp("x"));
+	auto solver = df.sgd_solver(SgdSolverOp("sgd").lr(0.5f).momentum(0));
+	df.dot(x, df.variable(df.fill({ 1, 1, 2, 2 }, 1), solver, VariableOp("w")), DotOp("d"));
+	auto context = std::make_shared<ExecutionContext>();
+	context->fused_update = true;
+	auto session = df.session();
+	session->initialize(context);
+	auto input = std::make_shared<Tensor>(std::array<int, 4>{ 1, 1, 2, 2 }, "input", Tensor::GPU_ONLY_POLICY);
+	input->set({ 1, 2, 3, 4 });
+	auto ones = std::make_shared<Tensor>(std::array<int, 4>{ 1, 1, 2, 2 }, "ones", Tensor::GPU_ONLY_POLICY);
+	ones->set({ 1, 1, 1, 1 });
+	auto d = session->get_node("d");
+	auto w = session->get_node("w")->output(0);
+
+	session->forward({ d }, { { session->get_placeholder("x"), input } });
+	session->backward({ d }, { { d, ones } });
+	EXPECT_TRUE(w->value()->verify({ 0.5f, 0, -0.5f, -1 }));
+	EXPECT_TRUE(w->diff()->verify({ 0, 0, 0, 0 }));
+	session->apply_solvers();
+	EXPECT_TRUE(w->value()->verify({ 0.5f, 0, -0.5f, -1 }));
+}
+
+TEST(cpu_math, accuracy) {
+	// Timings of the same sweep against libm are printed by examples/cpu_math_bench.
+	struct Function {
+		std::string name;
+		double low, high;
+		void(*vector)(ExecutionContext::MathAccuracy, size_t, const float *, float *);
+		std::function<double(double)> reference;
+	};
+	std::vector<Function> functions = {
+		{ "exp", -87.3, 88.7, CpuMath::exp, [](double x) { return ::exp(x); } },
+		{ "log", 1e-30, 1e30, CpuMath::log, [](double x) { return ::log(x); } },
+		{ "tanh", -10, 10, CpuMath::tanh, [](double x) { return ::tanh(x); } },
+		{ "sigmoid", -30, 30, CpuMath::sigmoid, [](double x) { return 1 / (1 + ::exp(-x)); } }
+	};
+	const size_t n = 1 << 20;
+	std::vector<float> x(n), y(n);
+	for (auto &f : functions) {
+		// log is swept in log space, the others linearly.
+		for (size_t i = 0; i < n; ++i) {
+			double t = (i + 0.5) / n;
+			x[i] = f.name == "log" ? (float)::exp(::log(f.low) + t * (::log(f.high) - ::log(f.low))) : (float)(f.low + t * (f.high - f.low));
+		}
+		for (int tier = 0; tier <= ExecutionContext::MATH_FAST; ++tier) {
+			f.vector((ExecutionContext::MathAccuracy)tier, n, x.data(), y.data());
+			double max_ulp = 0, max_rel = 0;
+			for (size_t i = 0; i < n; ++i) {
+				double expected = f.reference(x[i]);
+				float rounded = (float)expected;
+				double ulp = std::max((double)nextafterf(fabsf(rounded), FLT_MAX) - fabsf(rounded), (double)FLT_MIN * FLT_EPSILON);
+				max_ulp = std::max(max_ulp, fabs(y[i] - expected) / ulp);
+				if (expected != 0)
+					max_rel = std::max(max_rel, fabs((y[i] - expected) / expected));
+			}
+			if (tier == ExecutionContext::MATH_ACCURATE)
+				EXPECT_LT(max_ulp, 4) << f.name;
+			else if (tier == ExecutionContext::MATH_FAST)
+				EXPECT_LT(max_rel, 2e-4) << f.name;
+		}
+	}
+	const float inf = std::numeric_limits<float>::infinity();
+	float special[] = { 0.0f, -1.0f, inf, -inf, 100.0f, -100.0f, std::numeric_limits<float>::quiet_NaN() };
+	float out[7];
+	for (int tier = 0; tier <= ExecutionContext::MATH_FAST; ++tier) {
+		auto accuracy = (ExecutionContext::MathAccuracy)tier;
+		CpuMath::exp(accuracy, 7, special, out);
+		EXPECT_EQ(out[0], 1.0f);
+		EXPECT_EQ(out[2], inf);
+		EXPECT_EQ(out[3], 0.0f);
+		EXPECT_EQ(out[4], inf);
+		EXPECT_TRUE(out[6] != out[6]);
+		CpuMath::log(accuracy, 7, special, out);
+		EXPECT_EQ(out[0], -inf);
+		EXPECT_TRUE(out[1] != out[1]);
+		EXPECT_EQ(out[2], inf);
+		EXPECT_TRUE(out[6] != out[6]);
+		CpuMath::tanh(accuracy, 7, special, out);
+		EXPECT_EQ(out[2], 1.0f);
+		EXPECT_EQ(out[5], -1.0f);
+		CpuMath::sigmoid(accuracy, 7, special, out);
+		EXPECT_EQ(out[3], 0.0f);
+		EXPECT_EQ(out[4], 1.0f);
+	}
+}
+
+TEST(cpu_reduction, all_ops_and_axes) {
+	std::array<int, 4> dims = { 2, 3, 40, 5 };
+	int size = dims[0] * dims[1] * dims[2] * dims[3];
+	std::vector<float> x(size);
+	for (int i = 0; i < size; ++i)
+		x[i] = 1.0f + 0.1f * sin(1.3f * i);
+	for (int op = deepflow::ReduceParam_ReduceOp_ADD; op <= deepflow::ReduceParam_ReduceOp_NORM2; ++op)
+		for (int axes = 0; axes < 16; ++axes) {
+			auto output_dims = CpuReduction::output_dims(dims, axes);
+			std::vector<float> y(output_dims[0] * output_dims[1] * output_dims[2] * output_dims[3]);
+			std::vector<unsigned int> indices(y.size());
+			CpuReduction::reduce((deepflow::ReduceParam_ReduceOp)op, x.data(), dims, axes, y.data(), 1.0f, 0.0f, indices.data());
+			std::vector<double> expected(y.size(), op == deepflow::ReduceParam_ReduceOp_MUL ? 1 : op == deepflow::ReduceParam_ReduceOp_MIN ? DBL_MAX : 0);
+			std::vector<unsigned int> expected_indices(y.size(), 0);
+			std::vector<int> count(y.size(), 0);
+			for (int n = 0; n < dims[0]; ++n) for (int c = 0; c < dims[1]; ++c) for (int h = 0; h < dims[2]; ++h) for (int w = 0; w < dims[3]; ++w) {
+				int coords[4] = { n, c, h, w };
+				int o = 0;
+				unsigned int position = 0;
+				for (int d = 0; d < 4; ++d) {
+					o = o * output_dims[d] + (((axes >> d) & 1) ? 0 : coords[d]);
+					if ((axes >> d) & 1)
+						position = position * dims[d] + coords[d];
+				}
+				double v = x[((n * dims[1] + c) * dims[2] + h) * dims[3] + w];
+				switch (op) {
+				case deepflow::ReduceParam_ReduceOp_MUL: expected[o] *= v; break;
+				case deepflow::ReduceParam_ReduceOp_MIN: if (v < expected[o]) { expected[o] = v; expected_indices[o] = position; } break;
+				case deepflow::ReduceParam_ReduceOp_MAX: if (v > expected[o]) { expected[o] = v; expected_indices[o] = position; } break;
+				case deepflow::ReduceParam_ReduceOp_AMAX: expected[o] = std::max(expected[o], fabs(v)); break;
+				case deepflow::ReduceParam_ReduceOp_NORM1: expected[o] += fabs(v); break;
+				case deepflow::ReduceParam_ReduceOp_NORM2: expected[o] += v * v; break;
+				default: expected[o] += v;
+				}
+				count[o]++;
+			}
+			for (int o = 0; o < y.size(); ++o) {
+				if (op == deepflow::ReduceParam_ReduceOp_AVG)
+					expected[o] /= count[o];
+				else if (op == deepflow::ReduceParam_ReduceOp_NORM2)
+					expected[o] = sqrt(expected[o]);
+				EXPECT_NEAR(y[o], expected[o], 1e-5 * std::max(1.0, fabs(expected[o]))) << "op " << op << " axes " << axes;
+				if (op == deepflow::ReduceParam_ReduceOp_MIN || op == deepflow::ReduceParam_ReduceOp_MAX)
+					EXPECT_EQ(indices[o], expected_indices[o]) << "op " << op << " axes " << axes;
+			}
+		}
+}
+
+TEST(reduce, cpu_matches_cudnn) {
+	expect_cpu_matches_cudnn({ 2, 3, 4, 5 }, "sum", [](DeepFlow &df, std::string x) {
+		df.reduce(x, ReduceOp("sum").reduce({ 0, 2 }).add());
+	}, 1e-3f);
+	expect_cpu_matches_cudnn({ 2, 3, 4, 5 }, "mean", [](DeepFlow &df, std::string x) {
+		df.reduce(x, ReduceOp("mean").reduce({ 1, 3 }).avg());
+	});
+	expect_cpu_matches_cudnn({ 2, 3, 4, 5 }, "norm1", [](DeepFlow &df, std::string x) {
+		df.reduce_norm1(x, 1, ReduceNorm1Op("norm1"));
+	}, 1e-3f);
+	expect_cpu_matches_cudnn({ 2, 3, 4, 5 }, "norm2", [](DeepFlow &df, std::string x) {
+		df.reduce(x, ReduceOp("norm2").reduce({ 1, 2, 3 }).norm2());
+	}, 1e-3f);
+}
+
+TEST(softmax, cpu_matches_cudnn) {
+	expect_cpu_matches_cudnn({ 3, 10, 1, 1 }, "instance", [](DeepFlow &df, std::string x) {
+		df.softmax(x, SoftmaxOp("instance").by_instance());
+	});
+	expect_cpu_matches_cudnn({ 2, 5, 6, 7 }, "channel", [](DeepFlow &df, std::string x) {
+		df.softmax(x, SoftmaxOp("channel").by_channel());
+	});
+}
+
+TEST(softmax_cross_entropy, loss_and_gradient) {
+	std::vector<float> logits = { 1, 2, 3, 4, -1, 0, 5, 0.5f };
+	std::vector<float> labels = { 0, 0, 1, 0, 0, 0, 0, 1 };
+	for (int cpu = 0; cpu < 2; ++cpu) {
+		auto policy = cpu ? Tensor::CPU_ONLY_POLICY : Tensor::GPU_ONLY_POLICY;
+		DeepFlow df;
+		df.with(policy);
+		auto x = df.place_holder({ 2, 4, 1, 1 }, PlaceholderOp("x"));
+		auto y = df.place_holder({ 2, 4, 1, 1 }, PlaceholderOp("y"));
+		df.softmax_cross_entropy(x, y, SoftmaxCrossEntropyOp("ce"));
+		auto session = df.session();
+		session->initialize();
+		auto ce = session->get_node<SoftmaxCrossEntropy>("ce");
+		auto logits_tensor = std::make_shared<Tensor>(std::array<int, 4>{ 2, 4, 1, 1 }, "logits", policy);
+		logits_tensor->set(logits);
+		auto labels_tensor = std::make_shared<Tensor>(std::array<int, 4>{ 2, 4, 1, 1 }, "labels", policy);
+		labels_tensor->set(labels);
+		session->forward({ ce }, { { session->get_placeholder("x"), logits_tensor }, { session->get_placeholder("y"), labels_tensor } });
+		session->backward({ ce });
+		auto p = ce->output(1)->value()->to_vec();
+		auto dx = session->get_node("x")->output(0)->diff()->to_vec();
+		double loss = 0;
+		for (int n = 0; n < 2; ++n) {
+			double sum = 0;
+			for (int c = 0; c < 4; ++c)
+				sum += exp(logits[n * 4 + c]);
+			for (int c = 0; c < 4; ++c) {
+				int i = n * 4 + c;
+				double expected = exp(logits[i]) / sum;
+				EXPECT_NEAR(p->at(i), expected, 1e-5);
+				EXPECT_NEAR(dx->at(i), (expected - labels[i]) / 2, 1e-5);
+				loss -= labels[i] * log(expected) / 2;
+			}
+		}
+		EXPECT_NEAR(ce->loss(), loss, 1e-4);
+	}
+}
+
 int main(int argc, char** argv) {
 	gflags::ParseCommandLineFlags(&argc, &argv, true);	
 	CudaHelper::setOptimalThreadsPerBlock();